@@ -573,6 +573,86 @@ static Scr4 FitError(float const* aaaa, int &minS, int &maxS, Scr4 &errS) {
   return errS;
 }
 
+/* -----------------------------------------------------------------------------
+ */
+template<const int min, typename dtyp>
+static void GetValues(dtyp const* rgba, int mask, Col16 &values, Col16 &valid)
+{
+  u8 vals[16];
+  u8 vlds[16];
+
+  // bias into [0,max-min], the -128 of s8 is clamped to -127
+  for (int i = 0, imask = mask; i < 16; ++i, imask >>= 1) {
+    vals[i] = (u8)(std::max<int>(min, rgba[4 * i + 3]) - min);
+    vlds[i] = (u8)((imask & 1) ? 0xFF : 0x00);
+  }
+
+  LoadUnaligned(values, vals);
+  LoadUnaligned(valid, vlds);
+}
+
+template<const int min, const int max, const int steps>
+static int FitErrorExhaustive(Col16 const &values, Col16 const &valid, int &minS, int &maxS, const int radius) {
+  // all candidate pairs in the window around the given range
+  const int los = std::max<int>(min, minS - radius), his = std::min<int>(max, minS + radius);
+  const int loe = std::max<int>(min, maxS - radius), hie = std::min<int>(max, maxS + radius);
+
+  // larger than any possible error, 16 * 255 * 255
+  int errC = 0x000FE010 + 1;
+
+  for (int s = los; s <= his; s++) {
+  for (int e = std::max<int>(s, loe); e <= hie; e++) {
+    Col8 codes;
+
+    if (steps == 5)
+      Codebook6<min,max,0>(codes, Col8(s), Col8(e));
+    else if (steps == 7)
+      Codebook8<min,max,0>(codes, Col8(e), Col8(s));
+
+    // distance to the closest code for all 16 values at once
+    Col16 d0 = AbsoluteDifference(values, Col16(s16(codes[0]) - min));
+    Col16 d1 = AbsoluteDifference(values, Col16(s16(codes[1]) - min));
+    Col16 d2 = AbsoluteDifference(values, Col16(s16(codes[2]) - min));
+    Col16 d3 = AbsoluteDifference(values, Col16(s16(codes[3]) - min));
+    Col16 d4 = AbsoluteDifference(values, Col16(s16(codes[4]) - min));
+    Col16 d5 = AbsoluteDifference(values, Col16(s16(codes[5]) - min));
+    Col16 d6 = AbsoluteDifference(values, Col16(s16(codes[6]) - min));
+    Col16 d7 = AbsoluteDifference(values, Col16(s16(codes[7]) - min));
+
+    // encourage OoO
+    Col16 da = Min(d0, d1);
+    Col16 db = Min(d2, d3);
+    Col16 dc = Min(d4, d5);
+    Col16 dd = Min(d6, d7);
+    Col16 de = Min(da, db);
+    Col16 df = Min(dc, dd);
+    Col16 dists = Min(de, df) & valid;
+
+    // Cauchy-Schwarz: SSE >= SAD * SAD / 16, skip the squares if it can't win
+    int sad = HorizontalSum(dists);
+    if (sad * sad >= errC * 16)
+      continue;
+
+    int err = HorizontalSumSquares(dists);
+    if (err < errC) {
+      errC = err;
+      minS = s;
+      maxS = e;
+
+      // lossless
+      if (!errC)
+        return errC;
+    }
+  }
+  }
+
+  assert((minS >= min) && (minS <= max));
+  assert((maxS >= min) && (maxS <= max));
+  assert((minS <= maxS));
+
+  return errC;
+}
+
 /* -----------------------------------------------------------------------------
  */
 static void WriteAlphaBlock(int alpha0, int alpha1, u8 const* indices, void* block)
@@ -645,6 +725,54 @@ static doinline void WriteAlphaBlock7(int alpha0, int alpha1, u8 const* indices,
   WriteAlphaBlock(alpha0, alpha1, indices, block);
 }
 
+/* -----------------------------------------------------------------------------
+ * guess the code-book up front from the histogram of the block:
+ * - at most two distinct values are exact as end-points of the 7-code
+ * - without min/max present the explicit extremes of the 5-code are likely
+ *   wasted, the 7-code is the likely choice with its finer spacing over the
+ *   same range, though a 5-code over a narrower range can still win
+ * - min/max plus at most two other distinct values are exact in the 5-code
+ * only the first and the last rule are exact, the middle one is a heuristic
+ * which trades a bit of quality for speed, it's off by default (see
+ * SetAlphaCodebookGuess())
+ * returns 0 if both code-books need to be evaluated
+ */
+extern int g_alphacodebookguess;
+
+template<const int min, const int max>
+static int ChooseCodebook(u8 const* values, int mask)
+{
+  unsigned int bins[8] = {0,0,0,0,0,0,0,0};
+  int uniques = 0;
+  int extremes = 0;
+
+  for (int i = 0, imask = mask; i < 16; ++i, imask >>= 1) {
+    // check this pixel is valid
+    if ((imask & 1) == 0)
+      continue;
+
+    // values are biased by min
+    const int bin = values[i];
+    const unsigned int bit = 1U << (bin & 31);
+
+    if (!(bins[bin >> 5] & bit)) {
+      bins[bin >> 5] |= bit;
+
+      uniques += 1;
+      extremes += (bin == 0) || (bin == (max - min));
+    }
+  }
+
+  if (uniques <= 2)
+    return 7;
+  if (!extremes && g_alphacodebookguess)
+    return 7;
+  if (uniques - extremes <= 2)
+    return 5;
+
+  return 0;
+}
+
 /* -----------------------------------------------------------------------------
  */
 template<const int min, const int max, const int prc, const int compress, typename otyp, typename dtyp>
@@ -656,7 +784,12 @@ static void CompressAlphaBtc3i(dtyp const* rgba, int mask, void* block, int flag
   int min5 = max, max5 = min;
   int min7 = max, max7 = min;
 
+  // chosen code-book, 0 for both
+  int steps = 0;
+
   if (!((flags & kAlphaIterativeFit) && prc)) {
+    u8 values[16];
+
     for (int i = 0, imask = mask; i < 16; ++i, imask >>= 1) {
       // check this pixel is valid
       if ((imask & 1) == 0)
@@ -677,9 +810,14 @@ static void CompressAlphaBtc3i(dtyp const* rgba, int mask, void* block, int flag
           min5 = value;
         if ((value != max) && (value > max5))
           max5 = value;
+
+        values[i] = (u8)(std::min<int>(max, std::max<int>(min, value)) - min);
    
       }
     }
+
+    if (!(flags & kAlphaDualCodebookFit))
+      steps = ChooseCodebook<min,max>(values, mask);
   }
   else {
     for (int i = 0, imask = mask; i < 16; ++i, imask >>= 1) {
@@ -731,33 +869,65 @@ static void CompressAlphaBtc3i(dtyp const* rgba, int mask, void* block, int flag
   Codebook6<min,max,prc>(codes5, Col8(min5), Col8(max5));
   Codebook8<min,max,prc>(codes7, Col8(max7), Col8(min7));
 
+  // do the exhaustive search on 8bit values
+  if ((flags & kAlphaExhaustiveFit) && !compress && !prc) {
+    Col16 values, valid;
+
+    GetValues<min>(rgba, mask, values, valid);
+
+    int errM = 1;
+    if (steps != 5) {
+      // reconstruct code-book
+      errM = FitErrorExhaustive<min,max,7>(values, valid, min7, max7, FEATURE_EXHAUSTIVE_RADIUS);
+      Codebook8<min,max,prc>(codes7, Col8(max7), Col8(min7));
+    }
+
+    // !lossless
+    if ((steps != 7) && (errM > 0)) {
+      // reconstruct code-book
+      FitErrorExhaustive<min,max,5>(values, valid, min5, max5, FEATURE_EXHAUSTIVE_RADIUS);
+      Codebook6<min,max,prc>(codes5, Col8(min5), Col8(max5));
+    }
+  }
   // do the iterative tangent search
-  if (flags & kAlphaIterativeFit) {
+  else if (flags & kAlphaIterativeFit) {
     Scr4 err5, err7; float aaaa[16];
 
     GetError<prc,otyp>(rgba, mask, codes5, codes7, err5, err7, aaaa);
 
     // binary search, tangent-fitting
-    Scr4 errM = Min(err5, err7);
+    Scr4 errM = (steps == 7 ? err7 : (steps == 5 ? err5 : Min(err5, err7)));
 
     // !lossless, !lossless
-    if (errM > Scr4(FIT_THRESHOLD)) {
+    if ((steps != 5) && (errM > Scr4(FIT_THRESHOLD))) {
       // if better, reconstruct code-book
       errM = FitError<min,max,prc,7>(aaaa, min7, max7, err7);
       Codebook8<min,max,prc>(codes7, Col8(max7), Col8(min7));
+    }
 
-    if (errM > Scr4(FIT_THRESHOLD)) {
+    if ((steps != 7) && (errM > Scr4(FIT_THRESHOLD))) {
       // if better, reconstruct code-book
       errM = FitError<min,max,prc,5>(aaaa, min5, max5, err5);
       Codebook6<min,max,prc>(codes5, Col8(min5), Col8(max5));
-    
-    }}
+    }
   }
 
-  // fit the data to both code books
+  // fit the data to the chosen or both code books
   u8 indices5[16];
   u8 indices7[16];
 
+  if (steps == 7) {
+    FitCodes<prc,otyp>(rgba, mask, codes7, indices7);
+    WriteAlphaBlock7(max7, min7, indices7, block);
+    return;
+  }
+
+  if (steps == 5) {
+    FitCodes<prc,otyp>(rgba, mask, codes5, indices5);
+    WriteAlphaBlock5(min5, max5, indices5, block);
+    return;
+  }
+
   Scr4 err5 = FitCodes<prc,otyp>(rgba, mask, codes5, indices5);
   Scr4 err7 = FitCodes<prc,otyp>(rgba, mask, codes7, indices7);
 
@@ -777,7 +947,12 @@ static void CompressAlphaBtc3f(dtyp const* rgba, int mask, void* block, int flag
   int min5 = max, max5 = min;
   int min7 = max, max7 = min;
 
+  // chosen code-book, 0 for both
+  int steps = 0;
+
   if (!((flags & kAlphaIterativeFit) && prc)) {
+    u8 values[16];
+
     for (int i = 0, imask = mask; i < 16; ++i, imask >>= 1) {
       // check this pixel is valid
       if ((imask & 1) == 0)
@@ -796,8 +971,13 @@ static void CompressAlphaBtc3f(dtyp const* rgba, int mask, void* block, int flag
           min5 = value;
         if ((value != max) && (value > max5))
           max5 = value;
+
+        values[i] = (u8)(std::min<int>(max, std::max<int>(min, value)) - min);
       }
     }
+
+    if (!(flags & kAlphaDualCodebookFit))
+      steps = ChooseCodebook<min,max>(values, mask);
   }
   else {
     for (int i = 0, imask = mask; i < 16; ++i, imask >>= 1) {
@@ -856,26 +1036,38 @@ static void CompressAlphaBtc3f(dtyp const* rgba, int mask, void* block, int flag
     GetError<prc,otyp,max>(rgba, mask, codes5, codes7, err5, err7, aaaa);
 
     // binary search, tangent-fitting
-    Scr4 errM = Min(err5, err7);
+    Scr4 errM = (steps == 7 ? err7 : (steps == 5 ? err5 : Min(err5, err7)));
 
     // !lossless, !lossless
-    if (errM > Scr4(FIT_THRESHOLD)) {
+    if ((steps != 5) && (errM > Scr4(FIT_THRESHOLD))) {
       // if better, reconstruct code-book
       errM = FitError<min,max,prc,7>(aaaa, min7, max7, err7);
       Codebook8<min,max,prc>(codes7, Col8(max7), Col8(min7));
+    }
 
-    if (errM > Scr4(FIT_THRESHOLD)) {
+    if ((steps != 7) && (errM > Scr4(FIT_THRESHOLD))) {
       // if better, reconstruct code-book
       errM = FitError<min,max,prc,5>(aaaa, min5, max5, err5);
       Codebook6<min,max,prc>(codes5, Col8(min5), Col8(max5));
-    
-    }}
+    }
   }
 
-  // fit the data to both code books
+  // fit the data to the chosen or both code books
   u8 indices5[16];
   u8 indices7[16];
 
+  if (steps == 7) {
+    FitCodes<prc,otyp,max>(rgba, mask, codes7, indices7);
+    WriteAlphaBlock7(max7, min7, indices7, block);
+    return;
+  }
+
+  if (steps == 5) {
+    FitCodes<prc,otyp,max>(rgba, mask, codes5, indices5);
+    WriteAlphaBlock5(min5, max5, indices5, block);
+    return;
+  }
+
   Scr4 err5 = FitCodes<prc,otyp,max>(rgba, mask, codes5, indices5);
   Scr4 err7 = FitCodes<prc,otyp,max>(rgba, mask, codes7, indices7);
 
@@ -1010,6 +1202,78 @@ void DecompressDepthBtc4u(f23* rgba, void const* block, int flags) {
   DecompressAlphaBtc3f<CBHB, f23, u16,u8, 255 * (1 << CBHB)>(rgba, block); }
 void DecompressDepthBtc4s(f23* rgba, void const* block, int flags) {
   DecompressAlphaBtc3f<CBHB, f23, s16,s8, 127 * (1 << CBHB)>(rgba, block); }
+
+template<const int prc, typename dtyp, typename ctyp, typename etyp, const int scale, const int correction>
+static void DecompressImageBtc45i(dtyp* rg, int width, int height, void const* blocks, int planes)
+{
+  u8 const* sourceBlock = reinterpret_cast< u8 const* >(blocks);
+  dtyp a16 pixels[16 * 2];
+
+  // loop over blocks
+  for (int y = 0; y < height; y += 4) {
+    for (int x = 0; x < width; x += 4) {
+      Col16 valuesx[2];
+      Col16 valuesy[2];
+
+      if (planes == 1) {
+	// decompress plane 1 into r
+	DecompressPlaneBtc4i<prc,dtyp,ctyp,etyp,scale,correction>(valuesx, sourceBlock);
+
+	StoreUnaligned(valuesx[0], &pixels[0]);
+	if (sizeof(dtyp) != 1)
+	  StoreUnaligned(valuesx[1], &pixels[8]);
+      }
+      else {
+	// decompress plane 1 into r, plane 2 into g
+	DecompressPlaneBtc4i<prc,dtyp,ctyp,etyp,scale,correction>(valuesx, sourceBlock + 8);
+	DecompressPlaneBtc4i<prc,dtyp,ctyp,etyp,scale,correction>(valuesy, sourceBlock + 0);
+
+	Col16 lo, hi;
+	if (sizeof(dtyp) == 1) {
+	  InterleaveBytes(valuesx[0], valuesy[0], lo, hi);
+	  StoreUnaligned(lo, &pixels[ 0]);
+	  StoreUnaligned(hi, &pixels[16]);
+	}
+	else {
+	  InterleaveWords(valuesx[0], valuesy[0], lo, hi);
+	  StoreUnaligned(lo, &pixels[ 0]);
+	  StoreUnaligned(hi, &pixels[ 8]);
+	  InterleaveWords(valuesx[1], valuesy[1], lo, hi);
+	  StoreUnaligned(lo, &pixels[16]);
+	  StoreUnaligned(hi, &pixels[24]);
+	}
+      }
+
+      // write the decompressed pixels to the correct image locations
+      int columns = std::min<int>(4, width - x);
+      for (int py = 0; (py < 4) && (y + py < height); ++py) {
+	dtyp const* sourcePixel = pixels + planes * 4 * py;
+	dtyp* targetPixel = rg + planes * (width * (y + py) + x);
+
+	for (int px = 0; px < columns; ++px) {
+	  for (int i = 0; i < planes; ++i)
+	    targetPixel[i] = sourcePixel[i];
+
+	  sourcePixel += planes;
+	  targetPixel += planes;
+	}
+      }
+
+      // advance
+      sourceBlock += planes * 8;
+    }
+  }
+}
+
+void DecompressImageBtc45u(u8* rg, int width, int height, void const* blocks, int planes) {
+  DecompressImageBtc45i<CBLB, u8 , u16,u8, 255 / 255, 0>(rg, width, height, blocks, planes); }
+void DecompressImageBtc45s(s8* rg, int width, int height, void const* blocks, int planes) {
+  DecompressImageBtc45i<CBLB, s8 , s16,s8, 127 / 127, 0>(rg, width, height, blocks, planes); }
+
+void DecompressImageBtc45u(u16* rg, int width, int height, void const* blocks, int planes) {
+  DecompressImageBtc45i<CBHB, u16, u16,u8, 65535 / 255, CBHB>(rg, width, height, blocks, planes); }
+void DecompressImageBtc45s(s16* rg, int width, int height, void const* blocks, int planes) {
+  DecompressImageBtc45i<CBHB, s16, s16,s8, 0x1FFFFF / 127, CBHB + 6>(rg, width, height, blocks, planes); }
 #endif
 
 /* *****************************************************************************
@@ -69,6 +69,12 @@ namespace squish {
   void DecompressAlphaBtc3s(f23* rgba, void const* block, int flags);
   void DecompressDepthBtc4u(f23* rgba, void const* block, int flags);
   void DecompressDepthBtc4s(f23* rgba, void const* block, int flags);
+
+  void DecompressImageBtc45u(u8 * rg, int width, int height, void const* blocks, int planes);
+  void DecompressImageBtc45s(s8 * rg, int width, int height, void const* blocks, int planes);
+
+  void DecompressImageBtc45u(u16* rg, int width, int height, void const* blocks, int planes);
+  void DecompressImageBtc45s(s16* rg, int width, int height, void const* blocks, int planes);
 #endif
 
 // -----------------------------------------------------------------------------
@@ -51,6 +51,12 @@ namespace squish {
 
   void DecompressNormalsBtc5u(f23* xyzd, void const* blockx, void const* blocky);
   void DecompressNormalsBtc5s(f23* xyzd, void const* blockx, void const* blocky);
+
+  void DecompressImageNormalsBtc5u(u8 * xyz, int width, int height, void const* blocks);
+  void DecompressImageNormalsBtc5s(s8 * xyz, int width, int height, void const* blocks);
+
+  void DecompressImageNormalsBtc5u(u16* xyz, int width, int height, void const* blocks);
+  void DecompressImageNormalsBtc5s(s16* xyz, int width, int height, void const* blocks);
 #endif
 
 // -----------------------------------------------------------------------------
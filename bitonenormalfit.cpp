@@ -229,17 +229,101 @@ BitoneNormalFit::BitoneNormalFit(BitoneSet const* bitones, int flags)
   // snap floating-point-values to the integer-lattice and save
   m_start_candidate = start;
   m_end_candidate   = end;
+
+  // normalize the values once, and transpose them for the 4-wide matching
+  {
+    const Vec3 scale  = Vec3( 1.0f / 0.5f);
+    const Vec3 offset = Vec3(-1.0f * 0.5f);
+
+    float x[16], y[16], z[16];
+    for (int i = 0; i < 16; ++i) {
+      x[i] = y[i] = z[i] = 0.0f;
+
+      if (i < count) {
+	m_normals[i] = Normalize(scale * (offset + values[i]));
+
+	x[i] = m_normals[i].X();
+	y[i] = m_normals[i].Y();
+	z[i] = m_normals[i].Z();
+      }
+    }
+
+    for (int i = 0; i < 4; ++i) {
+      m_xxxx[i] = Vec4(&x[4 * i + 0], &x[4 * i + 1], &x[4 * i + 2], &x[4 * i + 3]);
+      m_yyyy[i] = Vec4(&y[4 * i + 0], &y[4 * i + 1], &y[4 * i + 2], &y[4 * i + 3]);
+      m_zzzz[i] = Vec4(&z[4 * i + 0], &z[4 * i + 1], &z[4 * i + 2], &z[4 * i + 3]);
+    }
+  }
+}
+
+template<const bool which>
+Scr3 BitoneNormalFit::Deviance4(Vec3 const (&codes)[4], u8 (&closest)[16]) const
+{
+  // cache some values
+  int const count = m_bitones->GetCount();
+  Scr3 const* freq = m_bitones->GetWeights();
+
+  // splat the code's components, one code per register
+  Vec4 cx[4], cy[4], cz[4];
+  for (int k = 0; k < 4; ++k) {
+    cx[k] = Vec4(codes[k].X());
+    cy[k] = Vec4(codes[k].Y());
+    cz[k] = Vec4(codes[k].Z());
+  }
+
+  // match 4 values at once against each code
+  Scr3 error = Scr3(DEVIANCE_BASE);
+  for (int i = 0; i < count; i += 4) {
+    Vec4 const& x = m_xxxx[i >> 2];
+    Vec4 const& y = m_yyyy[i >> 2];
+    Vec4 const& z = m_zzzz[i >> 2];
+
+    Vec4 d0 = MultiplyAdd(z, cz[0], MultiplyAdd(y, cy[0], x * cx[0]));
+    Vec4 d1 = MultiplyAdd(z, cz[1], MultiplyAdd(y, cy[1], x * cx[1]));
+    Vec4 d2 = MultiplyAdd(z, cz[2], MultiplyAdd(y, cy[2], x * cx[2]));
+    Vec4 d3 = MultiplyAdd(z, cz[3], MultiplyAdd(y, cy[3], x * cx[3]));
+
+    // select the smallest deviation (NaN as first arg is ignored!)
+    Vec4 dist = Max(d0, Vec4(DEVIANCE_MAX));
+         dist = Max(d1, dist);
+         dist = Max(d2, dist);
+         dist = Max(d3, dist);
+
+    float d[4] = { dist.X(), dist.Y(), dist.Z(), dist.W() };
+
+    int m0 = CompareEqualTo(d0, dist);
+    int m1 = CompareEqualTo(d1, dist);
+    int m2 = CompareEqualTo(d2, dist);
+    int m3 = CompareEqualTo(d3, dist);
+
+    for (int l = 0; (l < 4) && (i + l < count); ++l) {
+      // accumulate the error
+      AddDeviance(Scr3(d[l]), error, freq[i + l]);
+
+      if (which) {
+	// the lowest matching code wins
+	int idx = 0;
+
+	if ((m3 >> l) & 1) { idx = 3; }
+	if ((m2 >> l) & 1) { idx = 2; }
+	if ((m1 >> l) & 1) { idx = 1; }
+	if ((m0 >> l) & 1) { idx = 0; }
+
+	closest[i + l] = (u8)idx;
+      }
+    }
+  }
+
+  return error;
 }
 
 void BitoneNormalFit::kMeans4()
 {
-  const Vec3 scale  = Vec3( 1.0f / 0.5f);
   const Vec3 offset = Vec3(-1.0f * 0.5f);
   const Vec3 scalei = Vec3( 1.0f * 0.5f);
   
   // cache some values
   int const count = m_bitones->GetCount();
-  Vec3 const* values = m_bitones->GetPoints();
   Scr3 const* freq = m_bitones->GetWeights();
   
   Vec3 c_start = m_start, c_end = m_end;
@@ -259,19 +343,13 @@ void BitoneNormalFit::kMeans4()
     // resolve "metric * (value - code)" to "metric * value - metric * code"
     Vec3 codes[4]; Codebook4nc(codes, c_start, c_end);
 
-    Scr3 merror = Scr3(DEVIANCE_BASE);
-    for (int i = 0; i < count; ++i) {
-      int idx = 0;
-
-      // find the closest code
-      Vec3 value = Normalize(scale * (offset + values[i]));
-      Scr3 dist; MinDeviance4c<true>(dist, idx, value, codes);
+    // match each point to the closest code
+    u8 closest[16];
 
-      // accumulate the error
-      AddDeviance(dist, merror, freq[i]);
-      
+    Scr3 merror = Deviance4<true>(codes, closest);
+    for (int i = 0; i < count; ++i) {
       // accumulate the mean
-      means[idx] += value * freq[i];
+      means[closest[i]] += m_normals[i] * freq[i];
     }
   
     if (berror > merror) {
@@ -305,11 +383,6 @@ void BitoneNormalFit::Permute4()
   const Vec3 offset = Vec3(-1.0f * 0.5f);
   const Vec3 scalei = Vec3( 1.0f * 0.5f);
   
-  // cache some values
-  int const count = m_bitones->GetCount();
-  Vec3 const* values = m_bitones->GetPoints();
-  Scr3 const* freq = m_bitones->GetWeights();
-  
   Scr3 berror = Scr3(DEVIANCE_MAXSUM);
   
   Vec3 c_start = scale * (offset + m_start);
@@ -345,15 +418,9 @@ void BitoneNormalFit::Permute4()
     // resolve "metric * (value - code)" to "metric * value - metric * code"
     Vec3 codes[4]; Codebook4nc(codes, p_start, p_end);
 
-    Scr3 merror = Scr3(DEVIANCE_BASE);
-    for (int i = 0; i < count; ++i) {
-      // find the closest code
-      Vec3 value = Normalize(scale * (offset + values[i]));
-      Scr3 dist; MinDeviance4c<false>(dist, i, value, codes);
+    u8 closest[16];
 
-      // accumulate the error
-      AddDeviance(dist, merror, freq[i]);
-    }
+    Scr3 merror = Deviance4<false>(codes, closest);
     
     if (berror > merror) {
       berror = merror;
@@ -367,14 +434,6 @@ void BitoneNormalFit::Permute4()
 
 void BitoneNormalFit::Compress4(void* block)
 {
-  const Vec3 scale  = Vec3( 1.0f / 0.5f);
-  const Vec3 offset = Vec3(-1.0f * 0.5f);
-
-  // cache some values
-  int const count = m_bitones->GetCount();
-  Vec3 const* values = m_bitones->GetPoints();
-  Scr3 const* freq = m_bitones->GetWeights();
-  
   // use a fitting algorithm
   m_start = m_start_candidate;
   m_end   = m_end_candidate;
@@ -390,20 +449,7 @@ void BitoneNormalFit::Compress4(void* block)
   // match each point to the closest code
   u8 closest[16];
 
-  Scr3 error = Scr3(DEVIANCE_BASE);
-  for (int i = 0; i < count; ++i) {
-    int idx = 0;
-
-    // find the closest code
-    Vec3 value = Normalize(scale * (offset + values[i]));
-    Scr3 dist; MinDeviance4c<true>(dist, idx, value, codes);
-
-    // accumulate the error
-    AddDeviance(dist, error, freq[i]);
-
-    // save the index
-    closest[i] = (u8)idx;
-  }
+  Scr3 error = Deviance4<true>(codes, closest);
 
   // save this scheme if it wins
   if (error < m_besterror) {
@@ -41,11 +41,20 @@ public:
   BitoneNormalFit(BitoneSet const* bitones, int flags);
 
 private:
+  template<const bool which>
+  Scr3 Deviance4(Vec3 const (&codes)[4], u8 (&closest)[16]) const;
+
   void kMeans4();
   void Permute4();
 
   virtual void Compress4(void* block);
   
+  // the normalized values, transposed to 4 values per register
+  Vec3 m_normals[16];
+  Vec4 m_xxxx[4];
+  Vec4 m_yyyy[4];
+  Vec4 m_zzzz[4];
+
   Vec3 m_start_candidate;
   Vec3 m_end_candidate;
   Vec3 m_start;
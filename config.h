@@ -45,9 +45,17 @@
 #define	HDRSingleMatch		HDRSingleSnap
 
 /* use the power-method to estimate the principle component axis
- * should be more precise if not faster
+ * should be more precise if not faster, the closed-form solver only
+ * exists for three channels
+ * can be changed at run-time with SetPowerEstimate()
  */
-#define	FEATURE_POWERESTIMATE
+#define	FEATURE_POWERESTIMATE	1
+
+/* the maximum number of power-iterations per principle component axis,
+ * most converge within a handful of them
+ * can be changed at run-time with SetPowerIterations()
+ */
+#define	FEATURE_POWERESTIMATE_ITERATIONS	64
 
 /* totally blank out any colours in the alpha==0 case when colours
  * are weighted by alpha (which is the indicator too assure the third
@@ -106,6 +114,87 @@
 #define	FEATURE_INDEXFIT_INLINED
 #define	FEATURE_INDEXFIT_THOROUGH	true
 
+/* search radius of the exhaustive alpha/gray end-point search around
+ * the range of the block (kAlphaExhaustiveFit), a radius of 255 searches
+ * all (min, max) combinations
+ * each candidate pair is evaluated for all 16 pixels at once, most of
+ * them are rejected by the absolute difference sum alone (SSE >= SAD^2/16)
+ *
+ *   radius 8: at most 289 candidates per codebook, radius 255: ~32k
+ */
+#define	FEATURE_EXHAUSTIVE_RADIUS	8
+
+/* let the alpha/gray code-book choice guess the 7-code for blocks without
+ * min/max present, the exact choices (at most two values, or min/max plus at
+ * most two others) are always made, the guess skips the 5-code fit of the
+ * remaining blocks but loses about a fifth more SSE on those it gets wrong
+ * the value is the default, can be changed at run-time with
+ * SetAlphaCodebookGuess()
+ */
+#define	FEATURE_ALPHA_CODEBOOK_GUESS	0
+
+/* number of BC7 partitions which are fully evaluated per 2/3 subset mode,
+ * the partitions are ranked by an estimate of their error before, which is
+ * the scatter of each subset not explained by its principal axis
+ * the moments of all subsets are built incrementally from the 16 pixels, so
+ * ranking all 64 partitions costs about as much as one range fit
+ * can be changed at run-time with SetPartitionRanking(), 0 searches all
+ */
+#define	FEATURE_PARTITION_RANKING	0
+
+/* search the 8 clusters of 3 bit index modes over prefix sums of the ordered
+ * points, the innermost cluster boundary is evaluated for four candidates
+ * at once (the 2x2 least squares system of each shares one reciprocal)
+ * it is off by default, the snap and the error are still evaluated per
+ * candidate and it's only faster on some images (0.9-1.3x)
+ * the value is the default, can be changed at run-time with
+ * SetClusterSearchPrefixSums(), undefine to compile only the nested loop
+ */
+#define	FEATURE_CLUSTERSEARCH_PREFIXSUMS	0
+
+/* pack and unpack BC7 blocks with one generic packer/unpacker instantiated
+ * from per-mode bit-layout descriptors instead of the hand-written per-mode
+ * functions, both produce identical blocks and pixels
+ * the value is the default, can be changed at run-time with
+ * SetPaletteBlockLayouts(), undefine to compile only the hand-written code
+ */
+#define	FEATURE_PALETTEBLOCK_LAYOUTS	0
+
+/* stop the BC7/BC6H mode, partition and rotation search as soon as a block
+ * reaches a per-block mean squared error (8 bit units, averaged over the 16
+ * texels, weighted like the fits weight the channels), 0 stops only on
+ * lossless blocks
+ * the value is the default, can be changed at run-time with SetTargetError()
+ * or SetTargetPSNR()
+ */
+#define	FEATURE_TARGET_ERROR	0.0f
+
+/* guess for BC7 blocks before the mode search how many subsets are worth
+ * searching: 1-2 colours (or an opaque axis-aligned or grey line) are
+ * searched with the single subset modes only, 3-4 colours with at most two
+ * subsets, the rest fully, this loses some quality on lines and 3-4 colours
+ * the value is the default for the search without effort level, can be
+ * changed at run-time with SetBlockClassifier()
+ */
+#define	FEATURE_BLOCK_CLASSIFIER	0
+
+/* number of BC6H partitions which are fully evaluated per two-region mode,
+ * the 32 partitions are ranked once per block from per-pixel moments of the
+ * points, the one-region modes are searched first and two-region
+ * modes/partitions whose estimate can't beat the best error so far are
+ * skipped
+ * can be changed at run-time with SetHDRPartitionRanking(), 0 searches all
+ */
+#define	FEATURE_HDR_PARTITION_RANKING	0
+
+/* skip the BC6H modes whose delta-coded end-points can't span the block's
+ * range at their precision by far (4x), the remaining modes are searched
+ * one-region first and by decreasing precision, so the early exits trigger
+ * sooner
+ * can be changed at run-time with SetHDRModePruning()
+ */
+#define	FEATURE_HDR_MODE_PRUNING	0
+
 /* - sqrt() the weights in the colourset, affects all fits
  */
 #undef	FEATURE_WEIGHTS_ROOTED		// SSIM: 0.0012824 off, 0.0013257 on - RMSE: 1.9235 off, 1.9540 on
@@ -133,12 +222,18 @@
  * 2) trial shared bits for transparent and low-precision cases (*4,*4*2^6,*4^3*2^4)
  * 3) trial all shared bits
  * 4) check all start/stop up/down combinations (*256 tries), incomplete implementation!
+ * 5) predict the bits from the parity of the unquantized end-points and
+ *    try only those (*1), run-time only
+ *
+ * the value is the default, 0-3 and 5 can be changed at run-time with
+ * SetSharedBitsTrials(), 4 changes the range fit and is compile-time only
  */
 #define	SHAREDBITS_TRIAL_ALPHAONLYOPAQUE	0
 #define	SHAREDBITS_TRIAL_ALPHAONLY		1
 #define	SHAREDBITS_TRIAL_LOWPRC			2
 #define	SHAREDBITS_TRIAL_ALL			3
 #define	SHAREDBITS_TRIAL_PERMUTE		4
+#define	SHAREDBITS_TRIAL_PARITY			5
 
 #define	FEATURE_SHAREDBITS_TRIALS		SHAREDBITS_TRIAL_LOWPRC
  
@@ -156,6 +251,8 @@
 #undef	VERIFY_QUANTIZER
 // throw the decoded rgba values back into the input-image
 #undef	VERIFY_ENCODER
+// run the nested cluster search next to the prefix-sum one and report differences
+#undef	VERIFY_CLUSTERSEARCH
 
 // adjustments working only in "Debug" builds:
 // code only a specific mode-setting
@@ -208,6 +305,11 @@ namespace squish {
 #define SQUISH_USE_XSSE	    0
 #endif
 
+// Set to 1 when building squish to use the F16C half-float conversion instructions.
+#ifndef SQUISH_USE_F16C
+#define SQUISH_USE_F16C	    0
+#endif
+
 // Internally et SQUISH_USE_SIMD when either Altivec or SSE is available.
 #if SQUISH_USE_ALTIVEC && SQUISH_USE_SSE
 #error "Cannot enable both Altivec and SSE!"
@@ -249,10 +351,12 @@ typedef unsigned long long unsigned__int64;
 #undef	SQUISH_USE_ALTIVEC
 #undef	SQUISH_USE_SSE
 #undef	SQUISH_USE_SIMD
+#undef	SQUISH_USE_F16C
 
 #define SQUISH_USE_ALTIVEC	0
 #define SQUISH_USE_SSE		0
 #define SQUISH_USE_SIMD		0
+#define SQUISH_USE_F16C		0
 #endif
 
 /* -----------------------------------------------------------------------------
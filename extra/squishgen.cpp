@@ -438,7 +438,7 @@ static void GenerateDataBtc( std::string const& name, int bits, int sharedbits,
 
       for( int i = 0;; )
       {
-        std::cout << "  {{";
+        std::cout << "  {";
 
         int min_error = 0xFFFF;
         int min_index = 0;
@@ -463,26 +463,36 @@ static void GenerateDataBtc( std::string const& name, int bits, int sharedbits,
 
         std::cout << "/*" << min_index << "*/";
 
-        for( int j = 0;; )
+        // start, end and error go into separate planes
+        for( int p = 0;; )
         {
-	  // lowest error, lowest values, lowest index
-	  SSourceSet const& cset = sets[k];
-	  std::set<SSourceBlock, struct S>::iterator val = cset.values[i][j].begin();
-
-	  if( j < colours )
-	    std::cout << "{"
-	    << (val->start <= 99 ? " " : "") << (val->start <= 9 ? " " : "") << val->start << ","
-	    << (val->end   <= 99 ? " " : "") << (val->end   <= 9 ? " " : "") << val->end   << ","
-	    <<                                                                  val->error << "}";
+          std::cout << "{";
+
+          for( int j = 0;; )
+          {
+	    // lowest error, lowest values, lowest index
+	    SSourceSet const& cset = sets[k];
+	    std::set<SSourceBlock, struct S>::iterator val = cset.values[i][j].begin();
+	    int v = p == 0 ? val->start : p == 1 ? val->end : val->error;
+
+	    if( j >= colours )
+	      std::cout << (p < 2 ? "  0" : "0");
+	    else if( p < 2 )
+	      std::cout << (v <= 99 ? " " : "") << (v <= 9 ? " " : "") << v;
+	    else
+	      std::cout << v;
+	    if( ++j == indices )
+	      break;
+	    std::cout << ",";
+          }
 
-	  else
-	    std::cout << "{0,0,0}";
-	  if( ++j == indices )
+          std::cout << "}";
+          if( ++p == 3 )
 	    break;
-	  std::cout << ",";
+          std::cout << ",";
         }
 
-        std::cout << "}}";
+        std::cout << "}";
         if( ++i == 256 )
 	  break;
 
@@ -40,6 +40,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <sstream>
 #include <ctime>
 #include <cmath>
+#include <cstring>
 #include <assert.h>
 #include <squish.h>
 #include <png.h>
@@ -991,12 +992,400 @@ static void Benchmark(std::string const& sourceFileName, int mapping, int flags)
   std::cout << "decompression speed: " << ((double)(width * height) / (minduration * 1024 * 1024)) << " MPixel/s" << std::endl;
 }
 
+static double Evaluate(PngImage const& sourceImage, int flags, double& duration)
+{
+  // get the image info
+  int width = sourceImage.GetWidth();
+  int height = sourceImage.GetHeight();
+  int stride = sourceImage.GetStride();
+  bool colour = sourceImage.IsColour();
+  bool alpha = sourceImage.IsAlpha();
+
+  // create the target data
+  int bytesPerBlock = 16;
+  int blocks = ((width + 3) / 4) * ((height + 3) / 4);
+  Mem benchData(bytesPerBlock * blocks);
+
+  // get the block data
+  Mem sourceData(16 * 4 * blocks);
+  for (int y = 0, b = 0; y < height; y += 4) {
+    for (int x = 0; x < width; x += 4, ++b) {
+      u8* sourceRgba = sourceData.Get() + 16 * 4 * b;
+
+      for (int py = 0, i = 0; py < 4; ++py) {
+	u8 const* row = sourceImage.GetRow(std::min(y + py, height - 1));
+	for (int px = 0; px < 4; ++px, ++i) {
+	  u8 const* pixel = row + std::min(x + px, width - 1) * stride;
+
+	  for (int j = 0; j < 3; ++j)
+	    sourceRgba[4 * i + j] = colour ? pixel[j] : pixel[0];
+	  sourceRgba[4 * i + 3] = alpha ? pixel[stride - 1] : 255;
+	}
+      }
+    }
+  }
+
+  // compress the image
+  clock_t start = std::clock();
+  for (int b = 0; b < blocks; ++b)
+    Compress(sourceData.Get() + 16 * 4 * b, benchData.Get() + bytesPerBlock * b, flags);
+  clock_t end = std::clock();
+
+  duration = (double)(end - start) / CLOCKS_PER_SEC;
+
+  // decompress and work out the error
+  double error = 0.0;
+  for (int b = 0; b < blocks; ++b) {
+    u8 const* sourceRgba = sourceData.Get() + 16 * 4 * b;
+    u8 targetRgba[16 * 4];
+
+    Decompress(targetRgba, benchData.Get() + bytesPerBlock * b, flags);
+
+    for (int i = 0; i < 16 * 4; ++i) {
+      int diff = (int)sourceRgba[i] - (int)targetRgba[i];
+      error += (double)(diff * diff);
+    }
+  }
+
+  return std::sqrt(error / (blocks * 16));
+}
+
+static void BenchmarkRanking(std::string const& sourceFileName, int flags)
+{
+  // load the source image
+  PngImage sourceImage(sourceFileName);
+
+  static const int counts[] = { 0, 32, 16, 8, 4, 2, 1 };
+  double reference = 0.0;
+
+  std::cout << "partitions\ttime\trms error\tdelta" << std::endl;
+  for (int c = 0; c < (int)(sizeof(counts) / sizeof(counts[0])); ++c) {
+    double duration;
+
+    SetPartitionRanking(counts[c]);
+    double error = Evaluate(sourceImage, flags, duration);
+    if (!counts[c])
+      reference = error;
+
+    if (counts[c])
+      std::cout << counts[c];
+    else
+      std::cout << "all";
+
+    std::cout << "\t" << duration << "s\t" << error << "\t" << (error - reference) << std::endl;
+  }
+
+  // restore the default
+  SetPartitionRanking(0);
+}
+
+static void CheckEfforts(int flags)
+{
+  // two transparent ramps, with and without a fully transparent pixel
+  u8 sourceRgba[2][16 * 4];
+  for (int i = 0; i < 16; ++i) {
+    for (int t = 0; t < 2; ++t) {
+      sourceRgba[t][4 * i + 0] = (u8)(32 + 8 * i);
+      sourceRgba[t][4 * i + 1] = (u8)(200 - 8 * i);
+      sourceRgba[t][4 * i + 2] = (u8)(96 + 4 * i);
+      sourceRgba[t][4 * i + 3] = (u8)(t ? 64 + 12 * i : 17 * i);
+    }
+  }
+
+  // a ramp fits every single-subset mode, every level has to code it nearly lossless
+  for (int level = 0; level <= 9; ++level) {
+    for (int t = 0; t < 2; ++t) {
+      u8 block[16];
+      u8 targetRgba[16 * 4];
+
+      Compress(sourceRgba[t], block, flags + (level + 1) * kEffortLevel0);
+      Decompress(targetRgba, block, flags);
+
+      // the colour of fully transparent pixels is free
+      double error = 0.0;
+      for (int i = 0; i < 16 * 4; ++i) {
+	int diff = (int)sourceRgba[t][i] - (int)targetRgba[i];
+	if (sourceRgba[t][(i | 3)] || ((i & 3) == 3))
+	  error += (double)(diff * diff);
+      }
+
+      error = std::sqrt(error / 16);
+      if (error > 4.0) {
+	std::ostringstream oss;
+	oss << "effort level " << level << " codes a transparent block with rms error " << error;
+
+	throw Error(oss.str());
+      }
+    }
+  }
+}
+
+static void BenchmarkEfforts(std::string const& sourceFileName, int flags)
+{
+  // transparent blocks have to survive all levels
+  CheckEfforts(flags);
+
+  // load the source image
+  PngImage sourceImage(sourceFileName);
+
+  double pixels = (double)(sourceImage.GetWidth() * sourceImage.GetHeight());
+
+  std::cout << "effort	time	MPixel/s	rms error" << std::endl;
+  for (int level = 0; level <= 9; ++level) {
+    double duration;
+    double error = Evaluate(sourceImage, flags + (level + 1) * kEffortLevel0, duration);
+
+    std::cout << level << "\t" << duration << "s\t" << (pixels / (std::max(duration, 1e-6) * 1024 * 1024)) << "\t" << error << std::endl;
+  }
+}
+
+static void BenchmarkClusterSearch(std::string const& sourceFileName, int flags)
+{
+  // load the source image
+  PngImage sourceImage(sourceFileName);
+
+  double durations[2];
+  double errors[2];
+
+  std::cout << "search\ttime\trms error" << std::endl;
+  for (int p = 0; p < 2; ++p) {
+    SetClusterSearchPrefixSums(p != 0);
+    errors[p] = Evaluate(sourceImage, flags, durations[p]);
+
+    std::cout << (p ? "prefix" : "nested") << "\t" << durations[p] << "s\t" << errors[p] << std::endl;
+  }
+
+  std::cout << "speedup " << (durations[0] / std::max(durations[1], 1e-6)) << "x, error delta " << (errors[1] - errors[0]) << std::endl;
+
+  // restore the default
+  SetClusterSearchPrefixSums(FEATURE_CLUSTERSEARCH_PREFIXSUMS != 0);
+}
+
+static void BenchmarkSharedBits(std::string const& sourceFileName, int flags)
+{
+  // load the source image
+  PngImage sourceImage(sourceFileName);
+
+  static const struct { int strategy; const char *name; } strategies[] = {
+    { SHAREDBITS_TRIAL_ALL,             "all"         },
+    { SHAREDBITS_TRIAL_LOWPRC,          "lowprc"      },
+    { SHAREDBITS_TRIAL_ALPHAONLY,       "alphaonly"   },
+    { SHAREDBITS_TRIAL_ALPHAONLYOPAQUE, "opaque"      },
+    { SHAREDBITS_TRIAL_PARITY,          "parity"      }
+  };
+
+  double reference = 0.0;
+
+  std::cout << "p-bits\ttime\trms error\tdelta\tparity hits" << std::endl;
+  for (int s = 0; s < (int)(sizeof(strategies) / sizeof(strategies[0])); ++s) {
+    double duration;
+    long long predictions, hits;
+
+    // the prediction is measured wherever all the bits are tried
+    SetSharedBitsTrials(strategies[s].strategy);
+    SetSharedBitsStatistics(true);
+    double error = Evaluate(sourceImage, flags, duration);
+    GetSharedBitsStatistics(predictions, hits);
+    if (!s)
+      reference = error;
+
+    std::cout << strategies[s].name << "\t" << duration << "s\t" << error << "\t" << (error - reference) << "\t";
+    if (predictions)
+      std::cout << hits << "/" << predictions << " (" << (100.0 * hits / predictions) << "%)";
+    std::cout << std::endl;
+  }
+
+  // restore the defaults
+  SetSharedBitsStatistics(false);
+  SetSharedBitsTrials(FEATURE_SHAREDBITS_TRIALS);
+}
+
+static void BenchmarkLayouts(std::string const& sourceFileName, int flags)
+{
+  // load the source image
+  PngImage sourceImage(sourceFileName);
+
+  // get the image info
+  int width = sourceImage.GetWidth();
+  int height = sourceImage.GetHeight();
+  int stride = sourceImage.GetStride();
+  bool colour = sourceImage.IsColour();
+  bool alpha = sourceImage.IsAlpha();
+
+  // create the target data
+  int bytesPerBlock = 16;
+  int blocks = ((width + 3) / 4) * ((height + 3) / 4);
+  Mem handData(bytesPerBlock * blocks);
+  Mem layoutData(bytesPerBlock * blocks);
+  Mem handRgba(16 * 4 * blocks);
+  Mem layoutRgba(16 * 4 * blocks);
+
+  // get the block data
+  Mem sourceData(16 * 4 * blocks);
+  for (int y = 0, b = 0; y < height; y += 4) {
+    for (int x = 0; x < width; x += 4, ++b) {
+      u8* sourceRgba = sourceData.Get() + 16 * 4 * b;
+
+      for (int py = 0, i = 0; py < 4; ++py) {
+	u8 const* row = sourceImage.GetRow(std::min(y + py, height - 1));
+	for (int px = 0; px < 4; ++px, ++i) {
+	  u8 const* pixel = row + std::min(x + px, width - 1) * stride;
+
+	  for (int j = 0; j < 3; ++j)
+	    sourceRgba[4 * i + j] = colour ? pixel[j] : pixel[0];
+	  sourceRgba[4 * i + 3] = alpha ? pixel[stride - 1] : 255;
+	}
+      }
+    }
+  }
+
+  const int repeats = 16;
+  double encode[2];
+  double decode[2];
+
+  std::cout << "packer\tencode\tdecode\tdecode MPixel/s" << std::endl;
+  for (int p = 0; p < 2; ++p) {
+    u8* targetData = (p ? layoutData : handData).Get();
+    u8* targetRgba = (p ? layoutRgba : handRgba).Get();
+
+    SetPaletteBlockLayouts(p != 0);
+
+    // compress the image
+    clock_t start = std::clock();
+    for (int b = 0; b < blocks; ++b)
+      Compress(sourceData.Get() + 16 * 4 * b, targetData + bytesPerBlock * b, flags);
+    clock_t end = std::clock();
+
+    encode[p] = (double)(end - start) / CLOCKS_PER_SEC;
+
+    // decompress the same (hand-written) blocks with both
+    start = std::clock();
+    for (int r = 0; r < repeats; ++r)
+      for (int b = 0; b < blocks; ++b)
+	Decompress(targetRgba + 16 * 4 * b, handData.Get() + bytesPerBlock * b, flags);
+    end = std::clock();
+
+    decode[p] = (double)(end - start) / (CLOCKS_PER_SEC * repeats);
+
+    std::cout << (p ? "layout" : "hand") << "\t" << encode[p] << "s\t" << decode[p] << "s\t" << ((double)(width * height) / (std::max(decode[p], 1e-6) * 1024 * 1024)) << std::endl;
+  }
+
+  // both have to produce the same bits
+  int blockDiffs = 0;
+  int rgbaDiffs = 0;
+  for (int b = 0; b < blocks; ++b) {
+    blockDiffs += std::memcmp(handData.Get() + bytesPerBlock * b, layoutData.Get() + bytesPerBlock * b, bytesPerBlock) != 0;
+    rgbaDiffs += std::memcmp(handRgba.Get() + 16 * 4 * b, layoutRgba.Get() + 16 * 4 * b, 16 * 4) != 0;
+  }
+
+  std::cout << "encode speedup " << (encode[0] / std::max(encode[1], 1e-6)) << "x, decode speedup " << (decode[0] / std::max(decode[1], 1e-6)) << "x" << std::endl;
+  std::cout << "mismatching blocks " << blockDiffs << ", mismatching decoded blocks " << rgbaDiffs << " of " << blocks << std::endl;
+
+  // restore the default
+  SetPaletteBlockLayouts(FEATURE_PALETTEBLOCK_LAYOUTS != 0);
+}
+
+static void BenchmarkClassifier(std::string const& sourceFileName, int flags)
+{
+  // load the source image
+  PngImage sourceImage(sourceFileName);
+
+  double durations[2];
+  double errors[2];
+
+  std::cout << "search\ttime\trms error" << std::endl;
+  for (int c = 0; c < 2; ++c) {
+    SetBlockClassifier(c != 0);
+    errors[c] = Evaluate(sourceImage, flags, durations[c]);
+
+    std::cout << (c ? "classified" : "full") << "\t" << durations[c] << "s\t" << errors[c] << std::endl;
+  }
+
+  std::cout << "speedup " << (durations[0] / std::max(durations[1], 1e-6)) << "x, error delta " << (errors[1] - errors[0]) << std::endl;
+
+  // restore the default
+  SetBlockClassifier(FEATURE_BLOCK_CLASSIFIER != 0);
+}
+
+static void BenchmarkTargets(std::string const& sourceFileName, int flags)
+{
+  // load the source image
+  PngImage sourceImage(sourceFileName);
+
+  static const float targets[] = { 0.0f, 50.0f, 45.0f, 40.0f, 35.0f };
+  double reference = 0.0;
+
+  std::cout << "target\ttime\trms error\tPSNR\tspeedup" << std::endl;
+  for (int t = 0; t < (int)(sizeof(targets) / sizeof(targets[0])); ++t) {
+    double duration;
+
+    SetTargetPSNR(targets[t]);
+    double error = Evaluate(sourceImage, flags, duration);
+    if (!t)
+      reference = duration;
+
+    if (targets[t] > 0.0f)
+      std::cout << targets[t] << "dB";
+    else
+      std::cout << "lossless";
+
+    std::cout << "\t" << duration << "s\t" << error << "\t" << (20.0 * std::log10(255.0 / std::max(error, 1e-6))) << "\t" << (reference / std::max(duration, 1e-6)) << "x" << std::endl;
+  }
+
+  // restore the default
+  SetTargetError(FEATURE_TARGET_ERROR);
+}
+
+static void BenchmarkSolvers(std::string const& sourceFileName, int flags)
+{
+  // load the source image
+  PngImage sourceImage(sourceFileName);
+
+  static const int caps[] = { 64, 16, 8, 4, 2, 1 };
+
+  std::cout << "solver\ttime\trms error\tsolves\titerations\tsolver time" << std::endl;
+  for (int c = -1; c < (int)(sizeof(caps) / sizeof(caps[0])); ++c) {
+    double duration;
+    long long solves, iterations;
+    double seconds;
+
+    // the closed-form solver first, then the power-method with fewer and fewer iterations
+    SetPowerEstimate(c >= 0);
+    if (c >= 0)
+      SetPowerIterations(caps[c]);
+
+    SetSolverStatistics(true);
+    double error = Evaluate(sourceImage, flags, duration);
+    GetSolverStatistics(solves, iterations, seconds);
+
+    if (c >= 0)
+      std::cout << "power " << caps[c];
+    else
+      std::cout << "closed";
+
+    std::cout << "\t" << duration << "s\t" << error << "\t" << solves << "\t" << ((double)iterations / std::max(solves, 1LL)) << "\t" << seconds << "s" << std::endl;
+  }
+
+  // restore the defaults
+  SetSolverStatistics(false);
+  SetPowerEstimate(FEATURE_POWERESTIMATE != 0);
+  SetPowerIterations(FEATURE_POWERESTIMATE_ITERATIONS);
+}
+
 enum Mode
 {
   kCompress,
   kDecompress,
   kDiff,
-  kBenchmark
+  kBenchmark,
+  kRanking,
+  kEfforts,
+  kClusterSearch,
+  kSharedBits,
+  kLayouts,
+  kTargets,
+  kClassifier,
+  kSolvers
 };
 
 int main(int argc, char* argv[]) {
@@ -1009,6 +1398,7 @@ int main(int argc, char* argv[]) {
     int metric = kColourMetricPerceptual;
     int fit = kColourClusterFit;//kColourClusterFit;
     int alpha = 0;//kAlphaIterativeFit;
+    int books = 0;
     int extra = 0;
     int paint = 0;
     int sign = 0;
@@ -1028,6 +1418,14 @@ int main(int argc, char* argv[]) {
 	    case 'd': mode = kDecompress; break;
 	    case 'e': mode = kDiff; break;
 	    case 'b': mode = kBenchmark; break;
+	    case 'k': mode = kRanking; break;
+	    case 'L': mode = kEfforts; break;
+	    case 'S': mode = kClusterSearch; break;
+	    case 'P': mode = kSharedBits; break;
+	    case 'T': mode = kLayouts; break;
+	    case 'Q': mode = kTargets; break;
+	    case 'C': mode = kClassifier; break;
+	    case 'I': mode = kSolvers; break;
 
 	    case 'p': paint = 1; break;
 	    case 'm': paint = 2; break;
@@ -1050,6 +1448,8 @@ int main(int argc, char* argv[]) {
 	    case 'n': metric = kColourMetricUnit; break;
 
 	    case 'a': alpha = kAlphaIterativeFit; break;
+	    case 'E': alpha = kAlphaExhaustiveFit; break;
+	    case 'D': books = kAlphaDualCodebookFit; break;
 	    case 'r': fit = kColourRangeFit; break;
 	    case 'i': fit = kColourIterativeClusterFit; break;
 	    case 'x': fit = kColourClusterFit * 15; break;
@@ -1086,12 +1486,22 @@ int main(int argc, char* argv[]) {
 	<< "\t-d\tDecompress source raw btc to target png" << std::endl
 	<< "\t-b\tBenchmark the chosen config" << std::endl
 	<< "\t-e\tDiff source and target png" << std::endl
+	<< "\t-k\tCompare BC7 partition pre-ranking against the exhaustive search" << std::endl
+	<< "\t-L\tTabulate speed and error of the BC7 effort levels 0 to 9, after checking them on transparent blocks" << std::endl
+	<< "\t-S\tCompare the BC7 prefix-sum cluster search against the nested loops" << std::endl
+	<< "\t-P\tTabulate speed and error of the BC7 p-bit search strategies" << std::endl
+	<< "\t-T\tCompare the layout-driven BC7 block packer/unpacker against the hand-written one" << std::endl
+	<< "\t-Q\tTabulate speed and error of BC7 PSNR targets against the lossless-only search" << std::endl
+	<< "\t-C\tCompare the BC7 block classifier against the full search" << std::endl
+	<< "\t-I\tTabulate speed, error and iterations of the principal axis solvers for the chosen config" << std::endl
 	<< "\t-123\tSpecifies whether to use DXT1/BC1, DXT3/BC2 or DXT5/BC3 compression" << std::endl
 	<< "\t-45\tSpecifies whether to use ATI/BC4, ATI2/BC5 compression" << std::endl
 	<< "\t-7\tSpecifies whether to use BC7 compression" << std::endl
 	<< "\t-0\tSpecifies whether to use CTX1 compression" << std::endl
 	<< "\t-s\tSpecifies whether to signed block compression" << std::endl
 	<< "\t-a\tUse the slow iterative alpha/gray/normal compressor" << std::endl
+	<< "\t-E\tUse the exhaustive 8bit alpha/gray compressor" << std::endl
+	<< "\t-D\tAlways fit both alpha/gray code-books" << std::endl
 	<< "\t-r\tUse the fast but inferior range-based colour compressor" << std::endl
 	<< "\t-i\tUse the very slow but slightly better iterative colour compressor" << std::endl
 	<< "\t-x\tUse the extreme slow but slightly better iterative colour compressor" << std::endl
@@ -1117,7 +1527,7 @@ int main(int argc, char* argv[]) {
       return -1;
     }
 
-    if (targetFileName.empty() && (mode != kBenchmark)) {
+    if (targetFileName.empty() && (mode != kBenchmark) && (mode != kRanking) && (mode != kEfforts) && (mode != kClusterSearch) && (mode != kSharedBits) && (mode != kLayouts) && (mode != kTargets) && (mode != kClassifier) && (mode != kSolvers)) {
       std::cerr << "no target file given" << std::endl;
       return -1;
     }
@@ -1125,7 +1535,7 @@ int main(int argc, char* argv[]) {
     // do the work
     switch (mode) {
       case kCompress:
-	Compress(sourceFileName, targetFileName, paint, mapping, method + sign + metric + fit + alpha + extra);
+	Compress(sourceFileName, targetFileName, paint, mapping, method + sign + metric + fit + alpha + books + extra);
 	break;
 
       case kDecompress:
@@ -1137,7 +1547,39 @@ int main(int argc, char* argv[]) {
 	break;
 
       case kBenchmark:
-	Benchmark(sourceFileName, mapping, method + metric + sign + fit + alpha + extra);
+	Benchmark(sourceFileName, mapping, method + metric + sign + fit + alpha + books + extra);
+	break;
+
+      case kRanking:
+	BenchmarkRanking(sourceFileName, kBtc7 + metric + fit + extra);
+	break;
+
+      case kEfforts:
+	BenchmarkEfforts(sourceFileName, kBtc7 + metric + extra);
+	break;
+
+      case kClusterSearch:
+	BenchmarkClusterSearch(sourceFileName, kBtc7 + metric + kColourClusterFit + extra);
+	break;
+
+      case kSharedBits:
+	BenchmarkSharedBits(sourceFileName, kBtc7 + metric + fit + extra);
+	break;
+
+      case kLayouts:
+	BenchmarkLayouts(sourceFileName, kBtc7 + metric + fit + extra);
+	break;
+
+      case kTargets:
+	BenchmarkTargets(sourceFileName, kBtc7 + metric + fit + extra);
+	break;
+
+      case kClassifier:
+	BenchmarkClassifier(sourceFileName, kBtc7 + metric + fit + extra);
+	break;
+
+      case kSolvers:
+	BenchmarkSolvers(sourceFileName, method + metric + fit + extra);
 	break;
 
       default:
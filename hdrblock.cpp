@@ -3908,6 +3908,184 @@ void DecompressHDRsBtc6u(f23* rgb, void const* block)
 		rgb[(i * 4) + 3] = 1.0f;
 	}
 }
+
+void DecompressHDRsBtc6u(f10* rgb, void const* block)
+{
+  u16* xyz = (u16*)rgb;
+
+  DecompressHDRsBtc6u(xyz, block);
+
+  // the scaled magnitude already is the half-float, no need to go over float
+  for (int i = 0; i < 16; i++) {
+    xyz[(i * 4) + 0] = (u16)((xyz[(i * 4) + 0] * 31) >> 6);
+    xyz[(i * 4) + 1] = (u16)((xyz[(i * 4) + 1] * 31) >> 6);
+    xyz[(i * 4) + 2] = (u16)((xyz[(i * 4) + 2] * 31) >> 6);
+    xyz[(i * 4) + 3] = 0x3C00;
+  }
+}
+
+/* -----------------------------------------------------------------------------
+ * the blocks are bucketed by mode a stripe at a time (one table lookup per
+ * block), each bucket is then decoded by a loop calling only that mode's
+ * reader, and the pixels are converted to the destination format four
+ * channels at a time while they are written out
+ */
+
+// the mode of the low 5 selector bits (2 bits for modes 1-2), 14 is reserved
+static const u8 hdrmodes[32] = {
+   0,  1,  2, 10,  0,  1,  3, 11,  0,  1,  4, 12,  0,  1,  5, 13,
+   0,  1,  6, 14,  0,  1,  7, 14,  0,  1,  8, 14,  0,  1,  9, 14
+};
+
+template<const int mode>
+static doinline void ReadHDRBlockMode(u16* rgb, void const* block)
+{
+  switch (mode) {
+    case  0: ReadHDRBlock_m1(rgb, block); break;
+    case  1: ReadHDRBlock_m2(rgb, block); break;
+    case  2: ReadHDRBlock_m3(rgb, block); break;
+    case  3: ReadHDRBlock_m4(rgb, block); break;
+    case  4: ReadHDRBlock_m5(rgb, block); break;
+    case  5: ReadHDRBlock_m6(rgb, block); break;
+    case  6: ReadHDRBlock_m7(rgb, block); break;
+    case  7: ReadHDRBlock_m8(rgb, block); break;
+    case  8: ReadHDRBlock_m9(rgb, block); break;
+    case  9: ReadHDRBlock_mA(rgb, block); break;
+    case 10: ReadHDRBlock_mB(rgb, block); break;
+    case 11: ReadHDRBlock_mC(rgb, block); break;
+    case 12: ReadHDRBlock_mD(rgb, block); break;
+    case 13: ReadHDRBlock_mE(rgb, block); break;
+    default:	// reserved
+      for (int i = 0; i < 8; i++)
+	StoreUnaligned(Col4(0), (void *)(rgb + 8 * i));
+      break;
+  }
+}
+
+// same as DecompressHDRsBtc6u() per pixel
+static doinline void WriteHDRPixel(u16* target, u16 const* source)
+{
+  *((unsigned__int64 *)target) = *((unsigned__int64 const *)source);
+}
+
+static doinline void WriteHDRPixel(f10* target, u16 const* source)
+{
+  Col4 p; UnpackWords(p, *((unsigned__int64 const *)source));
+
+  // scale the magnitude by 31/64, alpha is 1.0
+  PackWords(TransferA((p * 31) >> 6, Col4(0x3C00)), *((unsigned__int64 *)target));
+}
+
+static doinline void WriteHDRPixel(f23* target, u16 const* source)
+{
+  f10 a16 halfs[4];
+
+  WriteHDRPixel(halfs, source);
+
+#if	SQUISH_USE_F16C
+  SHalfToFloat(target, halfs, 4);
+#else
+  target[0] = SHalfToFloat(halfs[0].bits);
+  target[1] = SHalfToFloat(halfs[1].bits);
+  target[2] = SHalfToFloat(halfs[2].bits);
+  target[3] = 1.0f;
+#endif
+}
+
+template<const int mode, typename dtyp>
+static void ReadHDRBucket(dtyp* rgb, int width, int height, u8 const* blocks, unsigned short const* bucket, int first, int count)
+{
+  const int columns = (width + 3) >> 2;
+
+  for (int i = 0; i < count; i++) {
+    const int b = first + bucket[i];
+    const int y = (b / columns) << 2;
+    const int x = (b % columns) << 2;
+
+    u16 a16 pixels[16 * 4];
+
+    ReadHDRBlockMode<mode>(pixels, blocks + 16 * b);
+
+    // write the decompressed pixels to the correct image locations
+    if ((x + 4 <= width) && (y + 4 <= height)) {
+      for (int py = 0; py < 4; ++py) {
+	dtyp* targetRow = rgb + 4 * (width * (y + py) + x);
+
+	WriteHDRPixel(targetRow +  0, pixels + 4 * (4 * py + 0));
+	WriteHDRPixel(targetRow +  4, pixels + 4 * (4 * py + 1));
+	WriteHDRPixel(targetRow +  8, pixels + 4 * (4 * py + 2));
+	WriteHDRPixel(targetRow + 12, pixels + 4 * (4 * py + 3));
+      }
+    }
+    else {
+      for (int py = 0; (py < 4) && (y + py < height); ++py) {
+	for (int px = 0; (px < 4) && (x + px < width); ++px) {
+	  WriteHDRPixel(rgb + 4 * (width * (y + py) + (x + px)), pixels + 4 * (4 * py + px));
+	}
+      }
+    }
+  }
+}
+
+template<typename dtyp>
+static void DecompressImageBtc6i(dtyp* rgb, int width, int height, void const* blocks)
+{
+  enum { stripe = 256 };
+
+  u8 const* sourceBlocks = reinterpret_cast< u8 const* >(blocks);
+  const int count = ((width + 3) >> 2) * ((height + 3) >> 2);
+
+  for (int first = 0; first < count; first += stripe) {
+    const int last = (first + stripe < count ? first + stripe : count);
+
+    // 14 modes + reserved
+    int offsets[15 + 1] = {0};
+    u8 modes[stripe];
+    unsigned short buckets[stripe];
+
+    // get the modes
+    for (int b = first; b < last; b++) {
+      const int mode = hdrmodes[sourceBlocks[16 * b] & 0x1F];
+
+      modes[b - first] = (u8)mode;
+      offsets[mode + 1]++;
+    }
+
+    // sort the blocks into the buckets, in image order per bucket
+    for (int m = 1; m <= 15; m++)
+      offsets[m] += offsets[m - 1];
+    for (int b = first; b < last; b++)
+      buckets[offsets[modes[b - first]]++] = (unsigned short)(b - first);
+    for (int m = 15; m >= 1; m--)
+      offsets[m] = offsets[m - 1];
+    offsets[0] = 0;
+
+#define	bucket(m)	rgb, width, height, sourceBlocks, buckets + offsets[m], first, offsets[m + 1] - offsets[m]
+    ReadHDRBucket< 0>(bucket( 0));
+    ReadHDRBucket< 1>(bucket( 1));
+    ReadHDRBucket< 2>(bucket( 2));
+    ReadHDRBucket< 3>(bucket( 3));
+    ReadHDRBucket< 4>(bucket( 4));
+    ReadHDRBucket< 5>(bucket( 5));
+    ReadHDRBucket< 6>(bucket( 6));
+    ReadHDRBucket< 7>(bucket( 7));
+    ReadHDRBucket< 8>(bucket( 8));
+    ReadHDRBucket< 9>(bucket( 9));
+    ReadHDRBucket<10>(bucket(10));
+    ReadHDRBucket<11>(bucket(11));
+    ReadHDRBucket<12>(bucket(12));
+    ReadHDRBucket<13>(bucket(13));
+    ReadHDRBucket<14>(bucket(14));
+#undef	bucket
+  }
+}
+
+void DecompressImageBtc6u(u16* rgb, int width, int height, void const* blocks) {
+  DecompressImageBtc6i(rgb, width, height, blocks); }
+void DecompressImageBtc6u(f23* rgb, int width, int height, void const* blocks) {
+  DecompressImageBtc6i(rgb, width, height, blocks); }
+void DecompressImageBtc6u(f10* rgb, int width, int height, void const* blocks) {
+  DecompressImageBtc6i(rgb, width, height, blocks); }
 #endif
 
 /* *****************************************************************************
@@ -73,6 +73,11 @@ namespace squish {
 
   void DecompressHDRsBtc6u(u16* rgb, void const* block);
   void DecompressHDRsBtc6u(f23* rgb, void const* block);
+  void DecompressHDRsBtc6u(f10* rgb, void const* block);
+
+  void DecompressImageBtc6u(u16* rgb, int width, int height, void const* blocks);
+  void DecompressImageBtc6u(f23* rgb, int width, int height, void const* blocks);
+  void DecompressImageBtc6u(f10* rgb, int width, int height, void const* blocks);
 #endif
 
 // -----------------------------------------------------------------------------
@@ -53,26 +53,18 @@ namespace squish {
  *  13   1  0  4   8     4  4  
  *  14   1  0  12  4     0  4  
  */
+#define	HBCFG(m, ns, pb, eb, sr, sg, sb, dr, dg, db, tb, ib)		\
+  { ns, pb, eb, { sr, sg, sb }, { dr, dg, db }, tb, ib },
+
 static const struct {
   char
    NS,PB,EB,SB[3],DB[3],TB,IB;
 } HBcfg[14] = {
-  { 2, 5,   0, { 5, 5, 5}, {5,5,5},  6, 3 },
-  { 2, 5,   0, { 1, 1, 1}, {6,6,6},  9, 3 },
-  { 2, 5,   0, { 6, 7, 7}, {5,4,4},  5, 3 },
-  { 2, 5,   0, { 7, 6, 7}, {4,5,4},  5, 3 },
-  { 2, 5,   0, { 7, 7, 6}, {4,4,5},  5, 3 },
-  { 2, 5,   0, { 4, 4, 4}, {5,5,5},  7, 3 },
-  { 2, 5,   0, { 2, 3, 3}, {6,5,5},  8, 3 },
-  { 2, 5,   0, { 3, 2, 3}, {5,6,5},  8, 3 },
-  { 2, 5,   0, { 3, 3, 2}, {5,5,5},  8, 3 },
-  { 2, 5,   6, { 0, 0, 0}, {0,0,0}, 10, 3 },
-  { 1, 0,  10, { 0, 0, 0}, {0,0,0},  6, 4 },
-  { 1, 0,   0, { 2, 2, 2}, {9,9,9},  5, 4 },
-  { 1, 0,   0, { 4, 4, 4}, {8,8,8},  4, 4 },
-  { 1, 0,   0, {12,12,12}, {4,4,4},  0, 4 }
+  HDRMODES(HBCFG)
 };
 
+#undef	HBCFG
+
 int HDRFit::GetNumSets(int mode) {
   return
     HBcfg[mode].NS;
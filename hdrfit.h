@@ -34,6 +34,53 @@ namespace squish {
 
 // -----------------------------------------------------------------------------
 #if	!defined(SQUISH_USE_PRE)
+/*! @brief The layout of the BC6H modes, one row per mode
+
+  The run-time table used by HDRFit::Get*Bits() and the compile-time
+  constants of HDRMode<> are both expanded from these rows.
+*/
+//                Mode NS PB  EB  SB        DB      TB  IB
+#define	HDRMODES(MODE)								\
+		MODE( 0,   2, 5,   0,  5, 5, 5, 5,5,5,  6, 3)			\
+		MODE( 1,   2, 5,   0,  1, 1, 1, 6,6,6,  9, 3)			\
+		MODE( 2,   2, 5,   0,  6, 7, 7, 5,4,4,  5, 3)			\
+		MODE( 3,   2, 5,   0,  7, 6, 7, 4,5,4,  5, 3)			\
+		MODE( 4,   2, 5,   0,  7, 7, 6, 4,4,5,  5, 3)			\
+		MODE( 5,   2, 5,   0,  4, 4, 4, 5,5,5,  7, 3)			\
+		MODE( 6,   2, 5,   0,  2, 3, 3, 6,5,5,  8, 3)			\
+		MODE( 7,   2, 5,   0,  3, 2, 3, 5,6,5,  8, 3)			\
+		MODE( 8,   2, 5,   0,  3, 3, 2, 5,5,5,  8, 3)			\
+		MODE( 9,   2, 5,   6,  0, 0, 0, 0,0,0, 10, 3)			\
+		MODE(10,   1, 0,  10,  0, 0, 0, 0,0,0,  6, 4)			\
+		MODE(11,   1, 0,   0,  2, 2, 2, 9,9,9,  5, 4)			\
+		MODE(12,   1, 0,   0,  4, 4, 4, 8,8,8,  4, 4)			\
+		MODE(13,   1, 0,   0, 12,12,12, 4,4,4,  0, 4)
+
+/*! @brief The layout of a BC6H mode as compile-time constants
+
+  The shared and delta bits are packed per channel as 0x00BBGGRR.
+*/
+template<const int mode>
+struct HDRMode;
+
+#define	HDRMODE(m, ns, pb, eb, sr, sg, sb, dr, dg, db, tb, ib)			\
+template<>									\
+struct HDRMode<m> {								\
+  enum {									\
+    NumSets        = ns,							\
+    PartitionBits  = pb,							\
+    IndexBits      = ib,							\
+    ExplicitBits   = eb,							\
+    SharedBits     = (sb << 16) + (sg << 8) + (sr << 0),			\
+    DeltaBits      = (db << 16) + (dg << 8) + (dr << 0),			\
+    TruncationBits = tb,							\
+    PrecisionBits  = 16 - tb							\
+  };										\
+};
+
+HDRMODES(HDRMODE)
+#undef	HDRMODE
+
 class HDRSet;
 class HDRFit
 {
@@ -76,6 +123,7 @@ public:
 #endif
 
   bool Lossless() { return !(m_besterror > Scr3(0.0f)); }
+  bool Sufficient(Scr3 const &target) { return !(m_besterror > target); }
   bool IsBest() { return m_best; }
 
 protected:
@@ -195,13 +195,35 @@ HDRRangeFit::HDRRangeFit(HDRSet const* palette, int flags)
 }
 
 void HDRRangeFit::Compress(void* block, fQuantizer &q, int mode)
+{
+  // dispatch once to the fit specialized for the mode
+  switch (mode) {
+    case  0: CompressMode< 0>(block, q); break;
+    case  1: CompressMode< 1>(block, q); break;
+    case  2: CompressMode< 2>(block, q); break;
+    case  3: CompressMode< 3>(block, q); break;
+    case  4: CompressMode< 4>(block, q); break;
+    case  5: CompressMode< 5>(block, q); break;
+    case  6: CompressMode< 6>(block, q); break;
+    case  7: CompressMode< 7>(block, q); break;
+    case  8: CompressMode< 8>(block, q); break;
+    case  9: CompressMode< 9>(block, q); break;
+    case 10: CompressMode<10>(block, q); break;
+    case 11: CompressMode<11>(block, q); break;
+    case 12: CompressMode<12>(block, q); break;
+    case 13: CompressMode<13>(block, q); break;
+  }
+}
+
+template<const int mode>
+void HDRRangeFit::CompressMode(void* block, fQuantizer &q)
 {
 	int swaps = 0;
 SwapSet1EndPointsAndRedoCalculation:
 
-  int ib = GetIndexBits(mode);
-  int tb = GetTruncationBits(mode);
-  int db = GetDeltaBits(mode);
+  const int ib = HDRMode<mode>::IndexBits;
+  const int tb = HDRMode<mode>::TruncationBits;
+  const int db = HDRMode<mode>::DeltaBits;
 
   q.ChangeField(tb, db);
 
@@ -423,7 +445,9 @@ SwapSet1EndPointsAndRedoCalculation:
       Col3 codeh[1 << 4];
 
       // then translate to float (for linear error measurement)
-      int ccs = CodebookP(codeh, ib, m_qstart[s], m_qend[s]);
+      // the codebook's size is known at compile-time, which lets the loops unroll
+      const int ccs = 1 << ib;
+      CodebookP(codeh, ib, m_qstart[s], m_qend[s]);
       for (int i = 0; i < ccs; ++i)
 	codes[i] = metric * q.UnquantizeFromLattice(codeh[i]);
 
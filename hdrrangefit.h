@@ -47,6 +47,10 @@ public:
   virtual void Compress(void* block, fQuantizer &q, int mode);
 
 private:
+  // the fit specialized to the constant layout of each mode
+  template<const int mode>
+  void CompressMode(void* block, fQuantizer &q);
+
   Vec3 m_centroid[2];
   Col3 m_qstart[2];
   Col3 m_qend  [2];
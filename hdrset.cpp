@@ -120,9 +120,30 @@ HDRSet::HDRSet(f23 const* rgb, int mask, int flags, int partition)
   BuildSet(rgb, mask, SetMode(flags, partition));
 }
 
-HDRSet::HDRSet(HDRSet const &palette, int mask, int flags, int partition)
+HDRSet::HDRSet(f10 const* rgb, int mask, int flags)
   : m_numsets(1), m_partid(0), m_partmask(0xFFFF)
 {
+  // make the set (if successive partition permutation)
+  BuildSet(rgb, mask, SetMode(flags));
+}
+
+HDRSet::HDRSet(f10 const* rgb, int mask, int flags, int partition)
+  : m_numsets(1), m_partid(0), m_partmask(0xFFFF)
+{
+  // make the set
+  BuildSet(rgb, mask, SetMode(flags, partition));
+}
+
+HDRSet::HDRSet(HDRSet const &palette, int mask, int flags, int partition)
+{
+  Permute(palette, mask, flags, partition);
+}
+
+void HDRSet::Permute(HDRSet const &palette, int mask, int flags, int partition)
+{
+  // clean initial state
+  m_numsets = 1, m_partid = 0, m_partmask = 0xFFFF;
+
   flags = SetMode(flags, partition);
 
   // make the new set
@@ -390,6 +411,15 @@ void HDRSet::BuildSet(f23 const* rgb, int mask, int flags) {
   }
 }
 
+void HDRSet::BuildSet(f10 const* rgb, int mask, int flags) {
+  // widen just the block, the image itself stays in half-floats
+  f23 rgbf[4 * 16];
+
+  SHalfToFloat(rgbf, rgb, 4 * 16);
+
+  BuildSet(rgbf, mask, flags);
+}
+
 void HDRSet::PermuteSet(HDRSet const &palette, int mask, int flags) {
   // check the compression mode for btc
   bool const weightByAlpha = ((flags & kWeightColourByAlpha) != 0);
@@ -513,6 +543,133 @@ void HDRSet::UnmapIndices(u8 const* source, u16* destination, int set, __int64 *
     }
   }
 }
+
+/* *****************************************************************************
+ */
+HDRMoments::HDRMoments(HDRSet const &palette, int flags)
+{
+  // the set must be the unpermuted base of the permutations
+  assert(palette.m_numsets == 1);
+
+  // the same metric the fits will use
+  const bool perceptual = ((flags & kColourMetrics) == kColourMetricPerceptual);
+  const bool unit       = ((flags & kColourMetrics) == kColourMetricUnit);
+
+  Vec3 metric = Vec3(0.3333f, 0.3334f, 0.3333f);
+  if (unit)
+    metric = Vec3(0.5000f, 0.5000f, 0.0000f);
+  else if (perceptual)
+    metric = Vec3(0.2126f, 0.7152f, 0.0722f);
+
+  // a point's weight is shared by all the pixels mapping to it
+  int multiplicity[16] = {0};
+  for (int i = 0; i < 16; ++i) {
+    int idx = palette.m_remap[0][i];
+    if (idx >= 0)
+      multiplicity[idx]++;
+  }
+
+  m_used = 0;
+  for (int i = 0; i < 16; ++i) {
+    int idx = palette.m_remap[0][i];
+    if (idx < 0) {
+      m_pixels[i].Clear();
+      continue;
+    }
+
+    // the same (linear) point the permutation will use
+    Vec4 v = Vec4(metric * palette.m_points[0][idx], 0.0f);
+    Vec4 q = v * v;
+    Vec4 r1 = v * RotateLeft<1>(v);
+    Vec4 r2 = v * RotateLeft<2>(v);
+
+    Vec3 w = Vec3(palette.m_weights[0][idx]) * Vec3(1.0f / multiplicity[idx]);
+    Vec4 wgt = Vec4(w, 1.0f);
+
+    m_pixels[i].w  = wgt;
+    m_pixels[i].s  = wgt * v;
+    m_pixels[i].q  = wgt * q;
+    m_pixels[i].r1 = wgt * r1;
+    m_pixels[i].r2 = wgt * r2;
+
+    m_used |= 1 << i;
+  }
+}
+
+void HDRMoments::Accumulate(Moments4 &moments, int mask) const
+{
+  moments.Clear();
+  for (int i = 0, m = mask & m_used; m; ++i, m >>= 1) {
+    if (m & 1)
+      moments.Add(m_pixels[i]);
+  }
+}
+
+/* -----------------------------------------------------------------------------
+ * no interpolated palette can do better than the scatter of a set off its
+ * principal axis (trace - largest eigenvalue), with the metric already applied
+ * it's in the same unit as the error of the fits, four sets are estimated at once
+ */
+static Vec4 EstimateSetErrors(Moments4 const* m)
+{
+  Sym3x3x4 scatter;
+  Vec4 centroid[3];
+  Vec4 axis[3];
+
+  // centered scatter
+  ComputeWeightedCovariance3(scatter, centroid, m, Vec4(1.0f));
+
+  Vec4 weight = Vec4(m[0].w, m[1].w, m[2].w, m[3].w);
+  Vec4 trace = scatter[0] + scatter[3] + scatter[5];
+  Vec4 lambda = EstimatePrincipleComponents(scatter, axis, 8);
+
+  // empty sets or sets without spread are exact
+  Vec4 valid = IsGreaterThan(weight, Vec4(0.0f)) & IsGreaterThan(trace, Vec4(0.0f));
+
+  return valid & Max(Vec4(0.0f), trace - lambda);
+}
+
+void HDRMoments::RankPartitions(int partitions, int (&ranking)[32], Scr3 (&bounds)[32]) const
+{
+  // moments of the whole block, the second set is the remainder
+  Moments4 total;
+  Accumulate(total, 0xFFFF);
+
+  // the sets of all partitions, they are estimated four at a time
+  Moments4 sets[32 * 2 + 2];
+  for (int p = 0; p < partitions; ++p) {
+    Accumulate(sets[p * 2 + 0], ~partitionmasks_2[p] & 0xFFFF);
+
+    sets[p * 2 + 1] = total;
+    sets[p * 2 + 1].Sub(sets[p * 2 + 0]);
+  }
+
+  // pad the last batch with empty sets
+  for (int k = partitions * 2; k & 3; ++k)
+    sets[k].Clear();
+
+  float errors[32 + 1];
+  for (int p = 0; p < partitions; p += 2) {
+    Vec4 estimates = EstimateSetErrors(sets + p * 2);
+
+    errors[p + 0] = estimates.GetO(0) + estimates.GetO(1);
+    errors[p + 1] = estimates.GetO(2) + estimates.GetO(3);
+  }
+
+  for (int p = 0; p < partitions; ++p) {
+    // the eigenvalue is estimated from below, keep a margin
+    bounds[p] = Scr3(errors[p] * 0.75f);
+
+    // insertion-sort by estimated error, ties keep the partition-order
+    int r = p;
+    while ((r > 0) && (errors[p] < errors[ranking[r - 1]])) {
+      ranking[r] = ranking[r - 1];
+      r--;
+    }
+
+    ranking[r] = p;
+  }
+}
 #endif
 
 /* *****************************************************************************
@@ -35,10 +35,14 @@ namespace squish {
 
 // -----------------------------------------------------------------------------
 #if	!defined(SQUISH_USE_PRE)
+class HDRMoments;
+
 /*! @brief Represents a set of block palettes
 */
 class HDRSet
 {
+  friend class HDRMoments;
+
 public:
   static void GetMasks(int flags, int partition, int (&masks)[2]);
 
@@ -56,14 +60,21 @@ public:
   HDRSet(f23 const* rgb, int mask, int flags);
   HDRSet(f23 const* rgb, int mask, int flags, int partition);
 
+  HDRSet(f10 const* rgb, int mask, int flags);
+  HDRSet(f10 const* rgb, int mask, int flags, int partition);
+
   // constructors for managing backups and permutations of palette-sets
   HDRSet() {};
   HDRSet(HDRSet const &palette) { memcpy(this, &palette, sizeof(*this)); };
   HDRSet(HDRSet const &palette, int mask, int flags, int partition);
 
+  // rebuild a permutation in place, for reusing the same workspace
+  void Permute(HDRSet const &palette, int mask, int flags, int partition);
+
 private:
   void BuildSet(u16 const* rgb, int mask, int flags);
   void BuildSet(f23 const* rgb, int mask, int flags);
+  void BuildSet(f10 const* rgb, int mask, int flags);
   void PermuteSet(HDRSet const &palette, int mask, int flags);
 
 public:
@@ -114,6 +125,27 @@ private:
   int   m_grey[2];
 #endif
 };
+
+/*! @brief The per-pixel moments of an unpermuted set
+
+  The moments of any subset of the pixels are sums of the per-pixel moments,
+  which allows to estimate all partitions of a block without permuting it.
+*/
+class HDRMoments
+{
+public:
+  HDRMoments(HDRSet const &palette, int flags);
+
+  // sum up the moments of the pixels in the mask
+  void Accumulate(Moments4 &moments, int mask) const;
+
+  // order the partitions by their estimated error (best first)
+  void RankPartitions(int partitions, int (&ranking)[32], Scr3 (&bounds)[32]) const;
+
+private:
+  int       m_used;
+  Moments4  m_pixels[16];
+};
 #endif
 
 // -----------------------------------------------------------------------------
@@ -928,6 +928,45 @@ static doinline void passreg Codebook6or8(s16 (&codes)[8*1], bool bw) ccr_restri
   }
 }
 
+/* -----------------------------------------------------------------------------
+ * the palette is built with the same scalar code as above (bit-exact), the 48
+ * index-bits and the palette-lookup are done for all 16 values at once, with
+ * a scale of 1 and no correction the values are the codebook entries
+ */
+template<const int prc, typename dtyp, typename ctyp, typename etyp, const int scale, const int correction>
+static doinline void DecompressPlaneBtc4i(Col16 (&values)[2], void const* block)
+{
+  ctyp codes[8];
+  dtyp a16 palette[16 / sizeof(dtyp)] = { 0 };
+
+  // get the two values
+  etyp const* bytes = reinterpret_cast< etyp const* >(block);
+  etyp value0 = bytes[0];
+  etyp value1 = bytes[1];
+
+  // compare the values to build the codebook
+  codes[0] = (ctyp)value0 << prc;
+  codes[1] = (ctyp)value1 << prc;
+
+  // use 5-value or 7-value codebook
+  Codebook6or8<prc>(codes, value0 <= value1);
+
+  // scale the codebook to the output-range
+  for (int i = 0; i < 8; ++i)
+    palette[i] = dtyp((codes[i] * (scale)) >> (correction));
+
+  // decode the indices and look them up
+  Col16 table, indices;
+
+  LoadUnaligned(table, palette);
+  LoadIndices3(indices, block);
+
+  if (sizeof(dtyp) == 1)
+    values[0] = LookupBytes(table, indices);
+  else
+    LookupWords(table, indices, values[0], values[1]);
+}
+
 static int passreg CodebookP(u8 *codes, int bits) ccr_restricted
 {
   // generate the midpoints
@@ -1421,28 +1460,6 @@ static doinline void MinDeviance3c(Scr3 &dist, int &index, Vec3 const &value, Ve
   }
 }
 
-template<const bool which, const int elements>
-static doinline void MinDeviance4c(Scr3 &dist, int &index, Vec3 const &value, Vec3 const (&codes)[elements]) {
-  Scr3 d0 = Dot(value, codes[0]);
-  Scr3 d1 = Dot(value, codes[1]);
-  Scr3 d2 = Dot(value, codes[2]);
-  Scr3 d3 = Dot(value, codes[3]);
-
-  // select the smallest deviation (NaN as first arg is ignored!)
-  dist = Max(d0, Scr3(DEVIANCE_MAX));
-  dist = Max(d1, dist);
-  dist = Max(d2, dist);
-  dist = Max(d3, dist);
-
-  if (which) {
-    // will cause VS to make them all cmovs
-    if (d3 == dist) { index = 3; }
-    if (d2 == dist) { index = 2; }
-    if (d1 == dist) { index = 1; }
-    if (d0 == dist) { index = 0; }
-  }
-}
-
 /* *****************************************************************************
  */
 #if	defined(SQUISH_USE_AMP) || defined(SQUISH_USE_COMPUTE)
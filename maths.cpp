@@ -37,6 +37,8 @@
 #include "maths.h"
 #include "simd.h"
 
+#include <chrono>
+
 #undef max
 #undef min
 
@@ -371,6 +373,187 @@ void ComputeWeightedCovariance4(Sym4x4 &covariance, Vec4 &centroid, int n, Vec4
   covariance_3.StoreX(&covariance[3]);
 }
 
+/* .............................................................................
+ * the covariance of a set from its summed up moments, which is
+ *   sum(w * (p - c) * (p - c)) = sum(w * p * p) - sum(w * p) * c
+ */
+void ComputeWeightedCovariance3(Sym3x3 &covariance, Vec4 &centroid, Moments4 const &moments, Vec4 const &metric) {
+  // compute the centroid
+  Vec4 center = moments.s;
+
+  center /= moments.w;
+
+  // remove the centroid from the second order moments
+  Vec4 covariance_035 = moments.q  - moments.s *               center ;
+  Vec4 covariance_14  = moments.r1 - moments.s * RotateLeft<1>(center);
+  Vec4 covariance_2   = moments.r2 - moments.s * RotateLeft<2>(center);
+
+#ifdef FEATURE_METRIC_COVARIANCE
+  covariance_035 *= metric *               metric ;
+  covariance_14  *= metric * RotateLeft<1>(metric);
+  covariance_2   *= metric * RotateLeft<2>(metric);
+#endif
+
+  // save the centroid
+  centroid = center;
+
+  // save the covariance smatrix (TODO: swizzled store)
+  covariance_035.StoreX(&covariance[0]);
+  covariance_035.StoreY(&covariance[3]);
+  covariance_035.StoreZ(&covariance[5]);
+  covariance_14.StoreX(&covariance[1]);
+  covariance_14.StoreY(&covariance[4]);
+  covariance_2.StoreX(&covariance[2]);
+}
+
+void ComputeWeightedCovariance4(Sym4x4 &covariance, Vec4 &centroid, Moments4 const &moments, Vec4 const &metric) {
+  // compute the centroid
+  Vec4 center = moments.s;
+
+  center /= moments.w;
+
+  // remove the centroid from the second order moments (wx is in r1)
+  Vec4 covariance_0479 = moments.q  - moments.s *               center ;
+  Vec4 covariance_1583 = moments.r1 - moments.s * RotateLeft<1>(center);
+  Vec4 covariance_26   = moments.r2 - moments.s * RotateLeft<2>(center);
+
+#ifdef FEATURE_METRIC_COVARIANCE
+  covariance_0479 *= metric *               metric ;
+  covariance_1583 *= metric * RotateLeft<1>(metric);
+  covariance_26   *= metric * RotateLeft<2>(metric);
+#endif
+
+  // save the centroid
+  centroid = center;
+
+  // save the covariance smatrix (TODO: swizzled store)
+  covariance_0479.StoreX(&covariance[0]);
+  covariance_0479.StoreY(&covariance[4]);
+  covariance_0479.StoreZ(&covariance[7]);
+  covariance_0479.StoreW(&covariance[9]);
+  covariance_1583.StoreX(&covariance[1]);
+  covariance_1583.StoreY(&covariance[5]);
+  covariance_1583.StoreZ(&covariance[8]);
+  covariance_1583.StoreW(&covariance[3]);
+  covariance_26.StoreX(&covariance[2]);
+  covariance_26.StoreY(&covariance[6]);
+}
+
+/* .............................................................................
+ * the same for four consecutive sets at once, the moments are transposed so each
+ * lane holds one set, and the centroids and covariances are computed exactly
+ * as above, just without any shuffles
+ */
+void ComputeWeightedCovariance3(Sym3x3x4 &covariance, Vec4 (&centroid)[3], Moments4 const* moments, Vec4 const &metric) {
+  Vec4 w = Vec4(moments[0].w, moments[1].w, moments[2].w, moments[3].w);
+
+  // one component of all sets per vector (x, y, z, w)
+  Vec4 sx = moments[0].s , sy = moments[1].s , sz = moments[2].s , sw = moments[3].s ;
+  // xx, yy, zz, ww
+  Vec4 qx = moments[0].q , qy = moments[1].q , qz = moments[2].q , qw = moments[3].q ;
+  // xy, yz, zw, wx
+  Vec4 ax = moments[0].r1, ay = moments[1].r1, az = moments[2].r1, aw = moments[3].r1;
+  // xz, yw, zx, wy
+  Vec4 bx = moments[0].r2, by = moments[1].r2, bz = moments[2].r2, bw = moments[3].r2;
+
+  Transpose(sx, sy, sz, sw);
+  Transpose(qx, qy, qz, qw);
+  Transpose(ax, ay, az, aw);
+  Transpose(bx, by, bz, bw);
+
+  // compute the centroids
+  Vec4 rw = Reciprocal(w);
+  Vec4 cx = sx * rw;
+  Vec4 cy = sy * rw;
+  Vec4 cz = sz * rw;
+
+  // remove the centroids from the second order moments
+  covariance[0] = qx - sx * cx;
+  covariance[1] = ax - sx * cy;
+  covariance[2] = bx - sx * cz;
+  covariance[3] = qy - sy * cy;
+  covariance[4] = ay - sy * cz;
+  covariance[5] = qz - sz * cz;
+
+#ifdef FEATURE_METRIC_COVARIANCE
+  Vec4 m0 = metric *               metric ;
+  Vec4 m1 = metric * RotateLeft<1>(metric);
+  Vec4 m2 = metric * RotateLeft<2>(metric);
+
+  covariance[0] *= m0.SplatX();
+  covariance[1] *= m1.SplatX();
+  covariance[2] *= m2.SplatX();
+  covariance[3] *= m0.SplatY();
+  covariance[4] *= m1.SplatY();
+  covariance[5] *= m0.SplatZ();
+#endif
+
+  // save the centroids
+  centroid[0] = cx;
+  centroid[1] = cy;
+  centroid[2] = cz;
+}
+
+void ComputeWeightedCovariance4(Sym4x4x4 &covariance, Vec4 (&centroid)[4], Moments4 const* moments, Vec4 const &metric) {
+  Vec4 w = Vec4(moments[0].w, moments[1].w, moments[2].w, moments[3].w);
+
+  // one component of all sets per vector (x, y, z, w)
+  Vec4 sx = moments[0].s , sy = moments[1].s , sz = moments[2].s , sw = moments[3].s ;
+  // xx, yy, zz, ww
+  Vec4 qx = moments[0].q , qy = moments[1].q , qz = moments[2].q , qw = moments[3].q ;
+  // xy, yz, zw, wx
+  Vec4 ax = moments[0].r1, ay = moments[1].r1, az = moments[2].r1, aw = moments[3].r1;
+  // xz, yw, zx, wy
+  Vec4 bx = moments[0].r2, by = moments[1].r2, bz = moments[2].r2, bw = moments[3].r2;
+
+  Transpose(sx, sy, sz, sw);
+  Transpose(qx, qy, qz, qw);
+  Transpose(ax, ay, az, aw);
+  Transpose(bx, by, bz, bw);
+
+  // compute the centroids
+  Vec4 rw = Reciprocal(w);
+  Vec4 cx = sx * rw;
+  Vec4 cy = sy * rw;
+  Vec4 cz = sz * rw;
+  Vec4 cw = sw * rw;
+
+  // remove the centroids from the second order moments
+  covariance[0] = qx - sx * cx;
+  covariance[1] = ax - sx * cy;
+  covariance[2] = bx - sx * cz;
+  covariance[3] = aw - sw * cx;
+  covariance[4] = qy - sy * cy;
+  covariance[5] = ay - sy * cz;
+  covariance[6] = by - sy * cw;
+  covariance[7] = qz - sz * cz;
+  covariance[8] = az - sz * cw;
+  covariance[9] = qw - sw * cw;
+
+#ifdef FEATURE_METRIC_COVARIANCE
+  Vec4 m0 = metric *               metric ;
+  Vec4 m1 = metric * RotateLeft<1>(metric);
+  Vec4 m2 = metric * RotateLeft<2>(metric);
+
+  covariance[0] *= m0.SplatX();
+  covariance[1] *= m1.SplatX();
+  covariance[2] *= m2.SplatX();
+  covariance[3] *= m1.SplatW();
+  covariance[4] *= m0.SplatY();
+  covariance[5] *= m1.SplatY();
+  covariance[6] *= m2.SplatY();
+  covariance[7] *= m0.SplatZ();
+  covariance[8] *= m1.SplatZ();
+  covariance[9] *= m0.SplatW();
+#endif
+
+  // save the centroids
+  centroid[0] = cx;
+  centroid[1] = cy;
+  centroid[2] = cz;
+  centroid[3] = cw;
+}
+
 /* .............................................................................
  */
 
@@ -698,10 +881,12 @@ void ComputePrincipleComponent(Sym3x3 const& smatrix, Vec4 &out)
  * [63]     9401       816     47776
  *   =    721332    114118   7187609
  */
+extern int g_poweriterations;
+
 #define POWER_ITERATION_COUNT	-1
 #define POWER_ITERATION_PREC	1.0f / 256
 
-void EstimatePrincipleComponent(Sym2x2 const& matrix, Vec4 &out)
+int EstimatePrincipleComponent(Sym2x2 const& matrix, Vec4 &out)
 {
 //Vec4 const row0(matrix[0], matrix[1], 0.0f, 0.0f);
 //Vec4 const row1(matrix[1], matrix[2], 0.0f, 0.0f);
@@ -726,6 +911,7 @@ void EstimatePrincipleComponent(Sym2x2 const& matrix, Vec4 &out)
 #if POWER_ITERATION_COUNT > 0
   for (int i = 0; i < POWER_ITERATION_COUNT; i++) {
 #else
+  int const n = g_poweriterations;
   int i = 0; Vec4 d; do { d = v; i++;
 #endif
     Scr4 x = Dot(v, row0);
@@ -735,7 +921,7 @@ void EstimatePrincipleComponent(Sym2x2 const& matrix, Vec4 &out)
     v *= Reciprocal(HorizontalMax(Abs(v)));
   }
 #if POWER_ITERATION_COUNT <= 0
-  while (CompareAnyGreaterThan(AbsoluteDifference(v, d), Vec4(POWER_ITERATION_PREC)) && (i < 64));
+  while (CompareAnyGreaterThan(AbsoluteDifference(v, d), Vec4(POWER_ITERATION_PREC)) && (i < n));
 #endif
 
 #if defined(TRACK_STATISTICS)
@@ -745,14 +931,19 @@ void EstimatePrincipleComponent(Sym2x2 const& matrix, Vec4 &out)
   assert(v.GetZ() == 0.0f);
   assert(v.GetW() == 0.0f);
   out = v;
+#if POWER_ITERATION_COUNT > 0
+  return POWER_ITERATION_COUNT;
+#else
+  return i;
+#endif
 }
 
-void EstimatePrincipleComponent(Sym3x3 const& matrix, Vec3 &out)
+int EstimatePrincipleComponent(Sym3x3 const& matrix, Vec3 &out)
 {
-  Vec4 tmp; EstimatePrincipleComponent(matrix, tmp); out = tmp.GetVec3();
+  Vec4 tmp; int i = EstimatePrincipleComponent(matrix, tmp); out = tmp.GetVec3(); return i;
 }
 
-void EstimatePrincipleComponent(Sym3x3 const& matrix, Vec4 &out)
+int EstimatePrincipleComponent(Sym3x3 const& matrix, Vec4 &out)
 {
 //Vec4 const row0(matrix[0], matrix[1], matrix[2], 0.0f);
 //Vec4 const row1(matrix[1], matrix[3], matrix[4], 0.0f);
@@ -784,6 +975,7 @@ void EstimatePrincipleComponent(Sym3x3 const& matrix, Vec4 &out)
 #if POWER_ITERATION_COUNT > 0
   for (int i = 0; i < POWER_ITERATION_COUNT; i++) {
 #else
+  int const n = g_poweriterations;
   int i = 0; Vec4 d; do { d = v; i++;
 #endif
     Scr4 x = Dot(v, row0);
@@ -794,7 +986,7 @@ void EstimatePrincipleComponent(Sym3x3 const& matrix, Vec4 &out)
     v *= Reciprocal(HorizontalMax(Abs(v)));
   }
 #if POWER_ITERATION_COUNT <= 0
-  while (CompareAnyGreaterThan(AbsoluteDifference(v, d), Vec4(POWER_ITERATION_PREC)) && (i < 64));
+  while (CompareAnyGreaterThan(AbsoluteDifference(v, d), Vec4(POWER_ITERATION_PREC)) && (i < n));
 #endif
 
 #if defined(TRACK_STATISTICS)
@@ -803,9 +995,14 @@ void EstimatePrincipleComponent(Sym3x3 const& matrix, Vec4 &out)
 
   assert(v.GetW() == 0.0f);
   out = v;
+#if POWER_ITERATION_COUNT > 0
+  return POWER_ITERATION_COUNT;
+#else
+  return i;
+#endif
 }
 
-void EstimatePrincipleComponent(Sym4x4 const& matrix, Vec4 &out)
+int EstimatePrincipleComponent(Sym4x4 const& matrix, Vec4 &out)
 {
   Vec4 const row0(matrix[0], matrix[1], matrix[2], matrix[3]);
   Vec4 const row1(matrix[1], matrix[4], matrix[5], matrix[6]);
@@ -826,6 +1023,7 @@ void EstimatePrincipleComponent(Sym4x4 const& matrix, Vec4 &out)
 #if POWER_ITERATION_COUNT > 0
   for (int i = 0; i < POWER_ITERATION_COUNT; i++) {
 #else
+  int const n = g_poweriterations;
   int i = 0; Vec4 d; do { d = v; i++;
 #endif
     Scr4 x = Dot(v, row0);
@@ -837,7 +1035,7 @@ void EstimatePrincipleComponent(Sym4x4 const& matrix, Vec4 &out)
     v *= Reciprocal(HorizontalMax(Abs(v)));
   }
 #if POWER_ITERATION_COUNT <= 0
-  while (CompareAnyGreaterThan(AbsoluteDifference(v, d), Vec4(POWER_ITERATION_PREC)) && (i < 64));
+  while (CompareAnyGreaterThan(AbsoluteDifference(v, d), Vec4(POWER_ITERATION_PREC)) && (i < n));
 #endif
 
 #if defined(TRACK_STATISTICS)
@@ -845,6 +1043,176 @@ void EstimatePrincipleComponent(Sym4x4 const& matrix, Vec4 &out)
 #endif
 
   out = v;
+#if POWER_ITERATION_COUNT > 0
+  return POWER_ITERATION_COUNT;
+#else
+  return i;
+#endif
+}
+
+/* -----------------------------------------------------------------------------
+ * the fits get their principle component axis through these, the solver and
+ * the accounting of it are chosen at run-time, the closed-form solver exists
+ * for three channels only
+ */
+extern int g_powerestimate;
+extern int g_solverstatistics;
+extern long long g_solversolves;
+extern long long g_solveriterations;
+extern double g_solverseconds;
+
+typedef std::chrono::high_resolution_clock SolverClock;
+
+static void RecordSolve(SolverClock::time_point const &start, int iterations)
+{
+  std::chrono::duration<double> const elapsed = SolverClock::now() - start;
+
+  g_solversolves += 1;
+  g_solveriterations += iterations;
+  g_solverseconds += elapsed.count();
+}
+
+template<class Sym, class Vec>
+static doinline void EstimatePrincipleComponentRecorded(Sym const& matrix, Vec &out)
+{
+  if (!g_solverstatistics) {
+    EstimatePrincipleComponent(matrix, out); return; }
+
+  SolverClock::time_point const start = SolverClock::now();
+  RecordSolve(start, EstimatePrincipleComponent(matrix, out));
+}
+
+template<class Vec>
+static doinline void GetPrincipleComponent3(Sym3x3 const& matrix, Vec &out)
+{
+  if (g_powerestimate) {
+    EstimatePrincipleComponentRecorded(matrix, out); return; }
+  if (!g_solverstatistics) {
+    ComputePrincipleComponent(matrix, out); return; }
+
+  SolverClock::time_point const start = SolverClock::now();
+  ComputePrincipleComponent(matrix, out);
+  RecordSolve(start, 0);
+}
+
+void GetPrincipleComponent(Sym3x3 const& matrix, Vec3 &out)
+{
+  GetPrincipleComponent3(matrix, out);
+}
+
+void GetPrincipleComponent(Sym2x2 const& matrix, Vec4 &out)
+{
+  EstimatePrincipleComponentRecorded(matrix, out);
+}
+
+void GetPrincipleComponent(Sym3x3 const& matrix, Vec4 &out)
+{
+  GetPrincipleComponent3(matrix, out);
+}
+
+void GetPrincipleComponent(Sym4x4 const& matrix, Vec4 &out)
+{
+  EstimatePrincipleComponentRecorded(matrix, out);
+}
+
+/* -----------------------------------------------------------------------------
+ * power-iterations for four matrices at once, starting with the row of the
+ * largest diagonal element, the Rayleigh quotients approach the largest
+ * eigenvalues from below, lanes which run into a zero vector keep their last
+ * estimate, the principal axes are normalized
+ */
+static doinline Vec4 Blend(Vec4 const &mask, Vec4 const &a, Vec4 const &b)
+{
+  return (mask & a) | (mask % b);
+}
+
+Vec4 EstimatePrincipleComponents(Sym3x3x4 const& matrix, Vec4 (&out)[3], int iterations)
+{
+  Vec4 const &xx = matrix[0], &xy = matrix[1], &xz = matrix[2];
+  Vec4 const &yy = matrix[3], &yz = matrix[4], &zz = matrix[5];
+
+  // start with the row of the largest diagonal element
+  Vec4 m1 = IsGreaterThan(yy, xx) & IsGreaterEqual(yy, zz);
+  Vec4 m2 = IsGreaterThan(zz, xx) & IsGreaterThan (zz, yy);
+
+  Vec4 bx = Blend(m1, xy, Blend(m2, xz, xx));
+  Vec4 by = Blend(m1, yy, Blend(m2, yz, xy));
+  Vec4 bz = Blend(m1, yz, Blend(m2, zz, xz));
+
+  Vec4 active = Vec4(true, true, true, true);
+  Vec4 lambda = Vec4(0.0f);
+  for (int i = 0; i < iterations; ++i) {
+    Vec4 tx = xx * bx + xy * by + xz * bz;
+    Vec4 ty = xy * bx + yy * by + yz * bz;
+    Vec4 tz = xz * bx + yz * by + zz * bz;
+
+    Vec4 bb = bx * bx + by * by + bz * bz;
+    Vec4 tt = tx * tx + ty * ty + tz * tz;
+
+    active = active & IsGreaterThan(bb, Vec4(0.0f)) & IsGreaterThan(tt, Vec4(0.0f));
+
+    // Rayleigh quotient of the current estimate
+    lambda = Blend(active, (bx * tx + by * ty + bz * tz) * Reciprocal(bb), lambda);
+
+    Vec4 rt = ReciprocalSqrt(tt);
+    bx = Blend(active, tx * rt, bx);
+    by = Blend(active, ty * rt, by);
+    bz = Blend(active, tz * rt, bz);
+  }
+
+  out[0] = bx;
+  out[1] = by;
+  out[2] = bz;
+
+  return lambda;
+}
+
+Vec4 EstimatePrincipleComponents(Sym4x4x4 const& matrix, Vec4 (&out)[4], int iterations)
+{
+  Vec4 const &xx = matrix[0], &xy = matrix[1], &xz = matrix[2], &wx = matrix[3];
+  Vec4 const &yy = matrix[4], &yz = matrix[5], &yw = matrix[6];
+  Vec4 const &zz = matrix[7], &zw = matrix[8];
+  Vec4 const &ww = matrix[9];
+
+  // start with the row of the largest diagonal element
+  Vec4 m1 = IsGreaterThan(yy, xx) & IsGreaterEqual(yy, zz) & IsGreaterEqual(yy, ww);
+  Vec4 m2 = IsGreaterThan(zz, xx) & IsGreaterThan (zz, yy) & IsGreaterEqual(zz, ww);
+  Vec4 m3 = IsGreaterThan(ww, xx) & IsGreaterThan (ww, yy) & IsGreaterThan (ww, zz);
+
+  Vec4 bx = Blend(m1, xy, Blend(m2, xz, Blend(m3, wx, xx)));
+  Vec4 by = Blend(m1, yy, Blend(m2, yz, Blend(m3, yw, xy)));
+  Vec4 bz = Blend(m1, yz, Blend(m2, zz, Blend(m3, zw, xz)));
+  Vec4 bw = Blend(m1, yw, Blend(m2, zw, Blend(m3, ww, wx)));
+
+  Vec4 active = Vec4(true, true, true, true);
+  Vec4 lambda = Vec4(0.0f);
+  for (int i = 0; i < iterations; ++i) {
+    Vec4 tx = xx * bx + xy * by + xz * bz + wx * bw;
+    Vec4 ty = xy * bx + yy * by + yz * bz + yw * bw;
+    Vec4 tz = xz * bx + yz * by + zz * bz + zw * bw;
+    Vec4 tw = wx * bx + yw * by + zw * bz + ww * bw;
+
+    Vec4 bb = bx * bx + by * by + bz * bz + bw * bw;
+    Vec4 tt = tx * tx + ty * ty + tz * tz + tw * tw;
+
+    active = active & IsGreaterThan(bb, Vec4(0.0f)) & IsGreaterThan(tt, Vec4(0.0f));
+
+    // Rayleigh quotient of the current estimate
+    lambda = Blend(active, (bx * tx + by * ty + bz * tz + bw * tw) * Reciprocal(bb), lambda);
+
+    Vec4 rt = ReciprocalSqrt(tt);
+    bx = Blend(active, tx * rt, bx);
+    by = Blend(active, ty * rt, by);
+    bz = Blend(active, tz * rt, bz);
+    bw = Blend(active, tw * rt, bw);
+  }
+
+  out[0] = bx;
+  out[1] = by;
+  out[2] = bz;
+  out[3] = bw;
+
+  return lambda;
 }
 
 /* -----------------------------------------------------------------------------
@@ -261,6 +261,44 @@ namespace squish {
 #pragma warning(disable: 4100)
 
 #if	!defined(SQUISH_USE_PRE)
+/*! @brief Weighted moments of a set of points
+ *
+ * Sums of the weights, the weighted points, their squares and the
+ * cross-products with the points rotated by one and two components.
+ * Moments of disjoint sets can simply be added up, which allows to
+ * assemble the covariance of any subset from per-pixel moments.
+ */
+struct Moments4
+{
+  Vec4 w, s, q, r1, r2;
+
+  void Clear() { w = s = q = r1 = r2 = Vec4(0.0f); }
+  void Add(Moments4 const &m) { w += m.w; s += m.s; q += m.q; r1 += m.r1; r2 += m.r2; }
+  void Sub(Moments4 const &m) { w -= m.w; s -= m.s; q -= m.q; r1 -= m.r1; r2 -= m.r2; }
+};
+
+/*! @brief Four symmetric matrices side by side
+ *
+ * Element i of the k-th matrix is in lane k of the i-th vector (structure
+ * of arrays, same element order as Sym3x3/Sym4x4). This allows to analyse
+ * four sets at once without horizontal operations.
+ */
+struct Sym3x3x4
+{
+  Vec4 m_x[6];
+
+  Vec4 const &operator[](int index) const { return m_x[index]; }
+  Vec4       &operator[](int index)       { return m_x[index]; }
+};
+
+struct Sym4x4x4
+{
+  Vec4 m_x[10];
+
+  Vec4 const &operator[](int index) const { return m_x[index]; }
+  Vec4       &operator[](int index)       { return m_x[index]; }
+};
+
 void ComputeWeightedCovariance3(Sym3x3 &covariance, Vec3 &centroid, int n, Vec3 const* points, Vec3 const &metric);
 void ComputeWeightedCovariance2(Sym2x2 &covariance, Vec4 &centroid, int n, Vec4 const* points, Vec4 const &metric);
 void ComputeWeightedCovariance3(Sym3x3 &covariance, Vec4 &centroid, int n, Vec4 const* points, Vec4 const &metric);
@@ -269,23 +307,27 @@ void ComputeWeightedCovariance3(Sym3x3 &covariance, Vec3 &centroid, int n, Vec3
 void ComputeWeightedCovariance2(Sym2x2 &covariance, Vec4 &centroid, int n, Vec4 const* points, Vec4 const &metric, Vec4 const* weights);
 void ComputeWeightedCovariance3(Sym3x3 &covariance, Vec4 &centroid, int n, Vec4 const* points, Vec4 const &metric, Vec4 const* weights);
 void ComputeWeightedCovariance4(Sym4x4 &covariance, Vec4 &centroid, int n, Vec4 const* points, Vec4 const &metric, Vec4 const* weights);
+void ComputeWeightedCovariance3(Sym3x3 &covariance, Vec4 &centroid, Moments4 const &moments, Vec4 const &metric);
+void ComputeWeightedCovariance4(Sym4x4 &covariance, Vec4 &centroid, Moments4 const &moments, Vec4 const &metric);
+void ComputeWeightedCovariance3(Sym3x3x4 &covariance, Vec4 (&centroid)[3], Moments4 const* moments, Vec4 const &metric);
+void ComputeWeightedCovariance4(Sym4x4x4 &covariance, Vec4 (&centroid)[4], Moments4 const* moments, Vec4 const &metric);
 void  ComputePrincipleComponent(Sym3x3 const& smatrix, Vec3 &out);
 void  ComputePrincipleComponent(Sym2x2 const& smatrix, Vec4 &out);
 void  ComputePrincipleComponent(Sym3x3 const& smatrix, Vec4 &out);
 void  ComputePrincipleComponent(Sym4x4 const& smatrix, Vec4 &out);
-void EstimatePrincipleComponent(Sym3x3 const& smatrix, Vec3 &out);
-void EstimatePrincipleComponent(Sym2x2 const& smatrix, Vec4 &out);
-void EstimatePrincipleComponent(Sym3x3 const& smatrix, Vec4 &out);
-void EstimatePrincipleComponent(Sym4x4 const& smatrix, Vec4 &out);
+int  EstimatePrincipleComponent(Sym3x3 const& smatrix, Vec3 &out);
+int  EstimatePrincipleComponent(Sym2x2 const& smatrix, Vec4 &out);
+int  EstimatePrincipleComponent(Sym3x3 const& smatrix, Vec4 &out);
+int  EstimatePrincipleComponent(Sym4x4 const& smatrix, Vec4 &out);
+void     GetPrincipleComponent(Sym3x3 const& smatrix, Vec3 &out);
+void     GetPrincipleComponent(Sym2x2 const& smatrix, Vec4 &out);
+void     GetPrincipleComponent(Sym3x3 const& smatrix, Vec4 &out);
+void     GetPrincipleComponent(Sym4x4 const& smatrix, Vec4 &out);
+Vec4 EstimatePrincipleComponents(Sym3x3x4 const& smatrix, Vec4 (&out)[3], int iterations);
+Vec4 EstimatePrincipleComponents(Sym4x4x4 const& smatrix, Vec4 (&out)[4], int iterations);
 void GetPrincipleProjection(Vec3 &enter, Vec3 &leave, Vec3 const &principle, Vec3 const &centroid, int n, Vec3 const* points);
 void GetPrincipleProjection(Vec4 &enter, Vec4 &leave, Vec4 const &principle, Vec4 const &centroid, int n, Vec4 const* points);
 
-#ifdef FEATURE_POWERESTIMATE
-#define GetPrincipleComponent(covariance, m_principle)	EstimatePrincipleComponent(covariance, m_principle)
-#else
-#define GetPrincipleComponent(covariance, m_principle)	 ComputePrincipleComponent(covariance, m_principle)
-#endif
-
 const float *ComputeGammaLUT(bool sRGB);
 #endif
 
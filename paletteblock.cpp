@@ -30,6 +30,7 @@
 #endif
 
 #include "paletteblock.h"
+#include "palettefit.h"
 
 #define SBSTART	0
 #define SBEND	3
@@ -655,8 +656,20 @@ static void passreg RemapPaletteBlock(int partition, Vec4 (&start)[1], Vec4 (&en
 #define	U	UNIQUE
 #define	S	SHARED
 
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+extern int g_palettelayouts;
+
+template<const int mnum, const int sets, const int fields>
+static void passreg PackPaletteBlock(int partition, int rotation, int selection, Vec4 const (&start)[sets], Vec4 const (&end)[sets], int sharedbits, u8 const (&indices)[fields][16], void* block);
+#endif
+
 void WritePaletteBlock3_m1(int partition, Vec4 const (&start)[3], Vec4 const (&end)[3], int sharedbits, u8 const (&indices)[1][16], void* block)
 {
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+  if (g_palettelayouts)
+    return PackPaletteBlock<0>(partition, 0, 0, start, end, sharedbits, indices, block);
+#endif
+
   Vec4 s[3] = {start[0], start[1], start[2]};
   Vec4 e[3] = {end  [0], end  [1], end  [2]};
   Col4 a[3][FIELDN];
@@ -668,7 +681,7 @@ void WritePaletteBlock3_m1(int partition, Vec4 const (&start)[3], Vec4 const (&e
   RemapPaletteBlock<3>(partition, s, e, sharedbits, idxs, indices);
 
   // get the packed values
-#if	defined(FEATURE_SHAREDBITS_TRIALS) && (FEATURE_SHAREDBITS_TRIALS >= SHAREDBITS_TRIAL_LOWPRC)
+#if	defined(FEATURE_SHAREDBITS_TRIALS)
   if ((FEATURE_SHAREDBITS_TRIALS == SHAREDBITS_TRIAL_ALL) || (~sharedbits))
   {
     FloatTo<4,4,4,0,1,0>(s, a, sharedbits >> SBSTART);
@@ -733,6 +746,11 @@ void WritePaletteBlock3_m1(int partition, Vec4 const (&start)[3], Vec4 const (&e
 
 void WritePaletteBlock3_m2(int partition, Vec4 const (&start)[2], Vec4 const (&end)[2], int sharedbits, u8 const (&indices)[1][16], void* block)
 {
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+  if (g_palettelayouts)
+    return PackPaletteBlock<1>(partition, 0, 0, start, end, sharedbits, indices, block);
+#endif
+
   Vec4 s[2] = {start[0], start[1]};
   Vec4 e[2] = {end  [0], end  [1]};
   Col4 a[2][FIELDN];
@@ -744,7 +762,7 @@ void WritePaletteBlock3_m2(int partition, Vec4 const (&start)[2], Vec4 const (&e
   RemapPaletteBlock<3>(partition, s, e, sharedbits, idxs, indices);
 
   // get the packed values
-#if	defined(FEATURE_SHAREDBITS_TRIALS) && (FEATURE_SHAREDBITS_TRIALS >= SHAREDBITS_TRIAL_LOWPRC)
+#if	defined(FEATURE_SHAREDBITS_TRIALS)
   if ((FEATURE_SHAREDBITS_TRIALS >= SHAREDBITS_TRIAL_ALL) || (~sharedbits))
   {
     FloatTo<6,6,6,0,0,1>(s, a, sharedbits >> SBSTART);
@@ -803,6 +821,11 @@ void WritePaletteBlock3_m2(int partition, Vec4 const (&start)[2], Vec4 const (&e
 
 void WritePaletteBlock3_m3(int partition, Vec4 const (&start)[3], Vec4 const (&end)[3], int sharedbits, u8 const (&indices)[1][16], void* block)
 {
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+  if (g_palettelayouts)
+    return PackPaletteBlock<2>(partition, 0, 0, start, end, sharedbits, indices, block);
+#endif
+
   Vec4 s[3] = {start[0], start[1], start[2]};
   Vec4 e[3] = {end  [0], end  [1], end  [2]};
   Col4 a[3][FIELDN];
@@ -866,6 +889,11 @@ void WritePaletteBlock3_m3(int partition, Vec4 const (&start)[3], Vec4 const (&e
 
 void WritePaletteBlock3_m4(int partition, Vec4 const (&start)[2], Vec4 const (&end)[2], int sharedbits, u8 const (&indices)[1][16], void* block)
 {
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+  if (g_palettelayouts)
+    return PackPaletteBlock<3>(partition, 0, 0, start, end, sharedbits, indices, block);
+#endif
+
   Vec4 s[2] = {start[0], start[1]};
   Vec4 e[2] = {end  [0], end  [1]};
   Col4 a[2][FIELDN];
@@ -877,7 +905,7 @@ void WritePaletteBlock3_m4(int partition, Vec4 const (&start)[2], Vec4 const (&e
   RemapPaletteBlock<2>(partition, s, e, sharedbits, idxs, indices);
 
   // get the packed values
-#if	defined(FEATURE_SHAREDBITS_TRIALS) && (FEATURE_SHAREDBITS_TRIALS >= SHAREDBITS_TRIAL_ALL)
+#if	defined(FEATURE_SHAREDBITS_TRIALS)
   if ((FEATURE_SHAREDBITS_TRIALS >= SHAREDBITS_TRIAL_ALL) || (~sharedbits))
   {
     FloatTo<7,7,7,0,1,0>(s, a, sharedbits >> SBSTART);
@@ -938,6 +966,11 @@ void WritePaletteBlock3_m4(int partition, Vec4 const (&start)[2], Vec4 const (&e
 
 void WritePaletteBlock4_m5(int r, int ix, Vec4 const (&start)[1], Vec4 const (&end)[1], int sharedbits, u8 const (&indices)[2][16], void* block)
 {
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+  if (g_palettelayouts)
+    return PackPaletteBlock<4>(0, r, ix, start, end, sharedbits, indices, block);
+#endif
+
   Vec4 s[1] = {start[0]};
   Vec4 e[1] = {end  [0]};
   Col4 a[1][FIELDN];
@@ -1009,6 +1042,11 @@ void WritePaletteBlock4_m5(int r, int ix, Vec4 const (&start)[1], Vec4 const (&e
 
 void WritePaletteBlock4_m6(int rotation, Vec4 const (&start)[1], Vec4 const (&end)[1], int sharedbits, u8 const (&indices)[2][16], void* block)
 {
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+  if (g_palettelayouts)
+    return PackPaletteBlock<5>(0, rotation, 0, start, end, sharedbits, indices, block);
+#endif
+
   Vec4 s[1] = {start[0]};
   Vec4 e[1] = {end  [0]};
   Col4 a[1][FIELDN];
@@ -1073,6 +1111,11 @@ void WritePaletteBlock4_m6(int rotation, Vec4 const (&start)[1], Vec4 const (&en
 
 void WritePaletteBlock4_m7(int partition, Vec4 const (&start)[1], Vec4 const (&end)[1], int sharedbits, u8 const (&indices)[1][16], void* block)
 {
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+  if (g_palettelayouts)
+    return PackPaletteBlock<6>(0, 0, 0, start, end, sharedbits, indices, block);
+#endif
+
   Vec4 s[1] = {start[0]};
   Vec4 e[1] = {end  [0]};
   Col4 a[1][FIELDN];
@@ -1084,7 +1127,7 @@ void WritePaletteBlock4_m7(int partition, Vec4 const (&start)[1], Vec4 const (&e
   RemapPaletteBlock<4>(partition, s, e, sharedbits, idxs, indices);
 
   // get the packed values
-#if	defined(FEATURE_SHAREDBITS_TRIALS) && (FEATURE_SHAREDBITS_TRIALS >= SHAREDBITS_TRIAL_ALPHAONLYOPAQUE)
+#if	defined(FEATURE_SHAREDBITS_TRIALS)
   if ((FEATURE_SHAREDBITS_TRIALS >= SHAREDBITS_TRIAL_ALL) || (~sharedbits)) {
     FloatTo<7,7,7,7,1,0>(s, a, sharedbits >> SBSTART);
     FloatTo<7,7,7,7,1,0>(e, b, sharedbits >> SBEND);
@@ -1140,6 +1183,11 @@ void WritePaletteBlock4_m7(int partition, Vec4 const (&start)[1], Vec4 const (&e
 
 void WritePaletteBlock4_m8(int partition, Vec4 const (&start)[2], Vec4 const (&end)[2], int sharedbits, u8 const (&indices)[1][16], void* block)
 {
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+  if (g_palettelayouts)
+    return PackPaletteBlock<7>(partition, 0, 0, start, end, sharedbits, indices, block);
+#endif
+
   Vec4 s[2] = {start[0], start[1]};
   Vec4 e[2] = {end  [0], end  [1]};
   Col4 a[2][FIELDN];
@@ -1151,7 +1199,7 @@ void WritePaletteBlock4_m8(int partition, Vec4 const (&start)[2], Vec4 const (&e
   RemapPaletteBlock<2>(partition, s, e, sharedbits, idxs, indices);
 
   // get the packed values
-#if	defined(FEATURE_SHAREDBITS_TRIALS) && (FEATURE_SHAREDBITS_TRIALS >= SHAREDBITS_TRIAL_ALPHAONLYOPAQUE)
+#if	defined(FEATURE_SHAREDBITS_TRIALS)
   if ((FEATURE_SHAREDBITS_TRIALS >= SHAREDBITS_TRIAL_ALL) || (~sharedbits)) {
     FloatTo<5,5,5,5,1,0>(s, a, sharedbits >> SBSTART);
     FloatTo<5,5,5,5,1,0>(e, b, sharedbits >> SBEND);
@@ -2374,6 +2422,337 @@ void ReadPaletteBlock4_m8(u8* rgba, void const* block) {
   ReadPaletteBlock<2, 2, 98>(partition, (unsigned int *)codes, blkl, blkh, (int *)rgba);
 }
 
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+/* -----------------------------------------------------------------------------
+ * The bit-layouts of the eight modes, all fields are written in ascending
+ * bit-order:
+ *
+ *  [ mode ][ partition ][ rotation ][ selection ]
+ *  [ red run ][ green run ][ blue run ][ alpha run ]
+ *  [ unique/shared bits ][ index bits ]
+ *
+ * with a run being the start/stop pairs of all sets of the channel, each
+ * pair being cbits (or abits) wide. The separate indices of modes 4 and 5
+ * use the alpha channel as scalar channel, the rotation is applied by the
+ * fit/the codebooks and is not visible to the layout.
+ */
+template<const int mnum, const int ns, const int pb, const int rb, const int xb, const int cb, const int ab, const int ub, const int sb, const int ib, const int jb, const int tr>
+struct PaletteLayoutBase
+{
+  enum {
+    sets   = ns,		// number of sets
+    fields = jb ? 2 : 1,	// number of index fields
+    pbits  = pb,		// partition bits
+    rbits  = rb,		// rotation bits
+    xbits  = xb,		// index-selection bits
+    cbits  = cb,		// colour bits per channel
+    abits  = ab,		// alpha bits
+    ubits  = ub,		// unique bits per end-point
+    sbits  = sb,		// shared bits per set
+    ibits  = ib,		// primary index bits
+    jbits  = jb,		// secondary index bits
+    trials = tr,		// minimum shared-bit trials with explicit bits
+
+    mbits  = mnum + 1,
+    crun   = 2 * ns * cb,
+    arun   = 2 * ns * ab,
+    cbegin = mbits + pb + rb + xb,
+    abegin = cbegin + 3 * crun,
+    pbegin = abegin + arun,
+    pcount = 2 * ns * ub + ns * sb,
+    ibegin = pbegin + pcount
+  };
+};
+
+template<const int mnum>
+struct PaletteLayout;
+
+// the layouts are expanded from the mode rows of PALETTEMODES() (palettefit.h),
+// the rotated modes trial their shared bits for alpha only
+#define	PALETTELAYOUT(m, ns, pb, rb, isb, cb, ab, epb, spb, ib, ib2)		\
+template<> struct PaletteLayout<m> : PaletteLayoutBase<m, ns, pb, rb, isb, cb, ab, epb, spb, ib, ib2,	\
+  (rb ? SHAREDBITS_TRIAL_ALPHAONLY : SHAREDBITS_TRIAL_ALL)> {};
+
+PALETTEMODES(PALETTELAYOUT)
+#undef	PALETTELAYOUT
+
+/* -----------------------------------------------------------------------------
+ * write/read n bits at position p of the 128 bit block, the fields which
+ * straddle the lo to hi border are split at compile time
+ */
+template<const int n, const int p>
+static doinline void passreg PutBits(Col4 &blkl, Col4 &blkh, Col4::Arg v) {
+  enum {
+    lo = p >= 64 ? 0 : (p + n > 64 ? 64 - p : n),
+    hi = n - lo
+  };
+
+  if (lo) blkl = CopyBits<lo, p & 63>(blkl, v);
+  if (hi) blkh = CopyBits<hi, (p + lo) & 63>(blkh, ShiftRightHalf<lo>(v));
+}
+
+template<const int n, const int p>
+static doinline Col4 passreg GetBits(Col4::Arg blkl, Col4::Arg blkh) {
+  enum {
+    lo = p >= 64 ? 0 : (p + n > 64 ? 64 - p : n),
+    hi = n - lo
+  };
+
+  if (!n)
+    return Col4(0);
+  // ExtrBits doesn't mask fields ending on the border
+  if (!hi)
+    return MaskBits<n, 0>(ExtrBits<n, p & 63>(blkl));
+  if (!lo)
+    return MaskBits<n, 0>(ExtrBits<n, p & 63>(blkh));
+
+  return CopyBits<hi, lo>(ExtrBits<lo, p & 63>(blkl), blkh);
+}
+
+/* -----------------------------------------------------------------------------
+ * exchange the separate channel with alpha in a codebook
+ */
+static doinline void passreg RotateCodes(unsigned int *codes, int count, int rotation) {
+  const int shift = (rotation - 1) << 3;
+
+  for (int i = 0; i < count; i++) {
+    unsigned int x = ((codes[i] >> shift) ^ (codes[i] >> 24)) & 0xFF;
+
+    codes[i] ^= (x << shift) ^ (x << 24);
+  }
+}
+
+template<class L, const bool separate = (L::jbits != 0)>
+struct PaletteIndices;
+
+template<class L>
+struct PaletteIndices<L, false>
+{
+  template<const int sets>
+  static doinline void passreg Remap(int partition, int, Vec4 (&s)[sets], Vec4 (&e)[sets], int &sharedbits, Col4 (&idxs)[1], u8 const (&indices)[1][16]) {
+    RemapPaletteBlock<L::ibits>(partition, s, e, sharedbits, idxs, indices);
+  }
+
+  static doinline void passreg Write(int partition, int, Col4 (&idxs)[1], Col4 &blkl, Col4 &blkh) {
+    WritePaletteBlock<L::sets, L::ibits, L::ibegin>(partition, idxs, blkl, blkh);
+  }
+
+  static doinline void passreg Read(int partition, int, int, Col4 (&a)[L::sets][FIELDN], Col4 (&b)[L::sets][FIELDN], Col4 &blkl, Col4 &blkh, u8* rgba) {
+    unsigned int codes[L::sets][1 << L::ibits];
+
+    // generate the midpoints
+    for (int i = 0; i < L::sets; i++)
+      CodebookP<L::ibits>(codes[i], a[i][C], b[i][C]);
+
+    ReadPaletteBlock<L::sets, L::ibits, L::ibegin>(partition, (unsigned int *)codes, blkl, blkh, (int *)rgba);
+  }
+};
+
+template<class L>
+struct PaletteIndices<L, true>
+{
+  static doinline void passreg Remap(int, int selection, Vec4 (&s)[1], Vec4 (&e)[1], int &sharedbits, Col4 (&idxs)[2], u8 const (&indices)[2][16]) {
+    if (!selection)
+      RemapPaletteBlock<L::ibits, L::jbits>(0, s, e, sharedbits, idxs, indices);
+    else
+      RemapPaletteBlock<L::jbits, L::ibits>(0, s, e, sharedbits, idxs, indices);
+  }
+
+  static doinline void passreg Write(int, int selection, Col4 (&idxs)[2], Col4 &blkl, Col4 &blkh) {
+    if (!selection)
+      WritePaletteBlock<1, L::ibits, L::jbits, L::ibegin>(0, idxs, blkl, blkh);
+    else
+      WritePaletteBlock<1, L::jbits, L::ibits, L::ibegin>(0, idxs, blkl, blkh);
+  }
+
+  static doinline void passreg Read(int, int rotation, int selection, Col4 (&a)[2][FIELDN], Col4 (&b)[2][FIELDN], Col4 &blkl, Col4 &blkh, u8* rgba) {
+    enum { kbits = L::ibits > L::jbits ? L::ibits : L::jbits };
+    unsigned int codes[2][1 << kbits];
+
+    // generate the midpoints
+    if (!selection) {
+      CodebookP<L::ibits>(codes[0], a[0][C], b[0][C]);
+      CodebookP<L::jbits>(codes[1], a[1][C], b[1][C]);
+    }
+    else {
+      CodebookP<L::jbits>(codes[0], a[0][C], b[0][C]);
+      CodebookP<L::ibits>(codes[1], a[1][C], b[1][C]);
+    }
+
+    // rotate colors
+    if (rotation) {
+      RotateCodes(codes[0], 1 << (!selection ? L::ibits : L::jbits), rotation);
+      RotateCodes(codes[1], 1 << (!selection ? L::jbits : L::ibits), rotation);
+    }
+
+    if (!selection)
+      ReadPaletteBlock<1, L::ibits, L::jbits, L::ibegin>(0, codes[0], codes[1], blkl, blkh, (int *)rgba);
+    else
+      ReadPaletteBlock<1, L::jbits, L::ibits, L::ibegin>(0, codes[0], codes[1], blkl, blkh, (int *)rgba);
+  }
+};
+
+/* -----------------------------------------------------------------------------
+ */
+template<const int mnum, const int sets, const int fields>
+static void passreg PackPaletteBlock(int partition, int rotation, int selection, Vec4 const (&start)[sets], Vec4 const (&end)[sets], int sharedbits, u8 const (&indices)[fields][16], void* block)
+{
+  typedef PaletteLayout<mnum> L;
+  typedef PaletteIndices<L> I;
+
+  Vec4 s[sets];
+  Vec4 e[sets];
+  Col4 a[sets][FIELDN];
+  Col4 b[sets][FIELDN];
+  Col4 blkl, blkh;
+  Col4 idxs[fields];
+
+  for (int i = 0; i < sets; i++) {
+    s[i] = start[i];
+    e[i] = end  [i];
+  }
+
+  // remap the indices
+  I::Remap(partition, selection, s, e, sharedbits, idxs, indices);
+
+  // get the packed values
+#if	defined(FEATURE_SHAREDBITS_TRIALS)
+  if ((FEATURE_SHAREDBITS_TRIALS >= L::trials) || ((L::ubits + L::sbits) && (~sharedbits)))
+  {
+    const int bitset = (L::ubits + L::sbits) ? sharedbits : ~0;
+
+    FloatTo<L::cbits,L::cbits,L::cbits,L::abits,L::ubits,L::sbits>(s, a, bitset >> SBSTART);
+    FloatTo<L::cbits,L::cbits,L::cbits,L::abits,L::ubits,L::sbits>(e, b, bitset >> (L::sbits ? SBSTART : SBEND));
+  }
+  else
+#endif
+  {
+    FloatTo<L::cbits,L::cbits,L::cbits,L::abits,L::ubits,L::sbits>(s, a);
+    FloatTo<L::cbits,L::cbits,L::cbits,L::abits,L::ubits,L::sbits>(e, b);
+    FloatTo<L::cbits,L::cbits,L::cbits,L::abits,L::ubits,L::sbits>(a, b);		// rounded shared bits
+  }
+
+  // cbits/abits set 1-3 red/green/blue/alpha start/stop
+  for (int i = 0; i < sets; i++) {
+    if (L::abits && (L::abits != L::cbits))
+      a[i][C] |= (b[i][C] = ShiftLeftLo<L::cbits,L::cbits,L::cbits,L::abits>(b[i][C]));
+    else
+      a[i][C] |= (b[i][C] <<= L::cbits);
+  }
+
+  // 2 * cbits set 1-3 red/green/blue/alpha start/stop
+  for (int i = 1; i < sets; i++)
+    a[0][C] |= (a[i][C] <<= (2 * L::cbits * i));
+
+  blkl = blkl.SetLong(
+    (selection << (L::mbits + L::pbits + L::rbits)) +
+    (rotation  << (L::mbits + L::pbits)) +
+    (partition << (L::mbits)) +
+    (1 << mnum));
+
+  PutBits<L::crun, L::cbegin + L::crun * 0>(blkl, blkh,                 a[0][C] );	// set 1-3 red   start/stop
+  PutBits<L::crun, L::cbegin + L::crun * 1>(blkl, blkh, ShiftRight<32>(a[0][C]));	// set 1-3 green start/stop
+  PutBits<L::crun, L::cbegin + L::crun * 2>(blkl, blkh, ShiftRight<64>(a[0][C]));	// set 1-3 blue  start/stop
+  PutBits<L::arun, L::abegin              >(blkl, blkh, ShiftRight<96>(a[0][C]));	// set 1-3 alpha start/stop
+
+  // unique bits start/stop per set, or shared bits per set
+  if (L::pcount) {
+    int pbits = 0;
+
+    for (int i = 0; i < sets; i++) {
+      if (L::ubits)
+	pbits += ((a[i][U].GetLong() & 1) << (2 * i + 0)) +
+	         ((b[i][U].GetLong() & 1) << (2 * i + 1));
+      if (L::sbits)
+	pbits += ((a[i][S].GetLong() & 1) << (1 * i + 0));
+    }
+
+    PutBits<L::pcount, L::pbegin>(blkl, blkh, Col4(pbits, 0, 0, 0));
+  }
+
+  // remaining bits are index bits + 1 bit per set from start/end order
+  I::Write(partition, selection, idxs, blkl, blkh);
+
+  /* write out */
+  StoreUnaligned(blkl, blkh, block);
+}
+
+template<const int mnum>
+static void passreg UnpackPaletteBlock(u8* rgba, void const* block)
+{
+  typedef PaletteLayout<mnum> L;
+  typedef PaletteIndices<L> I;
+
+  // get the packed values
+  Col4 a[L::fields > L::sets ? L::fields : L::sets][FIELDN];
+  Col4 b[L::fields > L::sets ? L::fields : L::sets][FIELDN];
+  Col4 blkl, blkh;
+  Col4 runs;
+
+  int partition, rotation, selection;
+
+  /* read in */
+  LoadUnaligned(blkl, blkh, block);
+
+  partition = GetBits<L::pbits, L::mbits                    >(blkl, blkh).GetLong();
+  rotation  = GetBits<L::rbits, L::mbits + L::pbits          >(blkl, blkh).GetLong();
+  selection = GetBits<L::xbits, L::mbits + L::pbits + L::rbits>(blkl, blkh).GetLong();
+
+  // alpha, blue, green, red runs in the four lanes
+  runs = L::jbits ? Col4(0) :                 GetBits<L::arun, L::abegin              >(blkl, blkh);
+  runs = ShiftLeft<32>(runs) + GetBits<L::crun, L::cbegin + L::crun * 2>(blkl, blkh);
+  runs = ShiftLeft<32>(runs) + GetBits<L::crun, L::cbegin + L::crun * 1>(blkl, blkh);
+  runs = ShiftLeft<32>(runs) + GetBits<L::crun, L::cbegin + L::crun * 0>(blkl, blkh);
+
+  {
+    const Col4 mask = Col4(
+      (1 << L::cbits) - 1,
+      (1 << L::cbits) - 1,
+      (1 << L::cbits) - 1,
+      (1 << L::abits) - 1
+    );
+
+    for (int i = 0; i < L::sets; i++) {
+      a[i][C] = (runs >> (L::cbits * (2 * i + 0))) & mask;
+      b[i][C] = (runs >> (L::cbits * (2 * i + 1))) & mask;
+    }
+  }
+
+  // separate alpha goes into its own "set"
+  if (L::jbits) {
+    a[1][C] = ShiftLeft<96>(GetBits<L::abits, L::abegin + L::abits * 0>(blkl, blkh));
+    b[1][C] = ShiftLeft<96>(GetBits<L::abits, L::abegin + L::abits * 1>(blkl, blkh));
+  }
+
+  // unique bits start/stop per set, or shared bits per set
+  if (L::pcount) {
+    const int pbits = GetBits<L::pcount, L::pbegin>(blkl, blkh).GetLong();
+
+    for (int i = 0; i < L::sets; i++) {
+      if (L::ubits) {
+	const int u = (pbits >> (2 * i + 0)) & 1;
+	const int v = (pbits >> (2 * i + 1)) & 1;
+
+	a[i][U] = Col4(u, u, u, L::abits ? u : 0);
+	b[i][U] = Col4(v, v, v, L::abits ? v : 0);
+      }
+      if (L::sbits) {
+	const int u = (pbits >> (1 * i + 0)) & 1;
+
+	a[i][S] = b[i][S] = Col4(u, u, u, L::abits ? u : 0);
+      }
+    }
+  }
+
+  // insert the unique/shared bits & extend to 8 bits
+  UnpackFrom<L::cbits,L::cbits,L::cbits,L::abits,L::ubits,L::sbits>(a);
+  UnpackFrom<L::cbits,L::cbits,L::cbits,L::abits,L::ubits,L::sbits>(b);
+
+  // generate the midpoints and look up the indices
+  I::Read(partition, rotation, selection, a, b, blkl, blkh, rgba);
+}
+#endif
+
 #undef	C
 #undef	U
 #undef	S
@@ -2391,6 +2770,24 @@ void DecompressColoursBtc7u(u8* rgba, void const* block)
 #endif
 
 
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+  if (g_palettelayouts) {
+    assume(mode >= 0 && mode <= 7);
+    switch (mode) {
+      case 0: UnpackPaletteBlock<0>(rgba, block); break;
+      case 1: UnpackPaletteBlock<1>(rgba, block); break;
+      case 2: UnpackPaletteBlock<2>(rgba, block); break;
+      case 3: UnpackPaletteBlock<3>(rgba, block); break;
+      case 4: UnpackPaletteBlock<4>(rgba, block); break;
+      case 5: UnpackPaletteBlock<5>(rgba, block); break;
+      case 6: UnpackPaletteBlock<6>(rgba, block); break;
+      case 7: UnpackPaletteBlock<7>(rgba, block); break;
+    }
+
+    return;
+  }
+#endif
+
   assume(mode >= 0 && mode <= 7);
   switch (mode) {
     case 0: ReadPaletteBlock3_m1(rgba, block); break;
@@ -2419,6 +2816,135 @@ void DecompressColoursBtc7u(f23* rgba, void const* block)
   for (int v = 0; v < (4 * 16); v++)
     rgba[v] = bytes[v] * (1.0f / 255.0f);
 }
+
+/* -----------------------------------------------------------------------------
+ * the blocks are bucketed by mode a stripe at a time (one ctz per block), each
+ * bucket is then decoded by a loop calling only that mode's reader, which
+ * avoids the mispredicted per-block mode dispatch on mixed-mode images
+ */
+template<const int mode>
+static doinline void ReadPaletteBlockMode(u8* rgba, void const* block)
+{
+  switch (mode) {
+    case 0: ReadPaletteBlock3_m1(rgba, block); break;
+    case 1: ReadPaletteBlock3_m2(rgba, block); break;
+    case 2: ReadPaletteBlock3_m3(rgba, block); break;
+    case 3: ReadPaletteBlock3_m4(rgba, block); break;
+    case 4: ReadPaletteBlock4_m5(rgba, block); break;
+    case 5: ReadPaletteBlock4_m6(rgba, block); break;
+    case 6: ReadPaletteBlock4_m7(rgba, block); break;
+    case 7: ReadPaletteBlock4_m8(rgba, block); break;
+    default:	// reserved
+      StoreUnaligned(Col4(0), (void *)(rgba +  0));
+      StoreUnaligned(Col4(0), (void *)(rgba + 16));
+      StoreUnaligned(Col4(0), (void *)(rgba + 32));
+      StoreUnaligned(Col4(0), (void *)(rgba + 48));
+      break;
+  }
+}
+
+template<const int mode>
+static void ReadPaletteBucket(u8* rgba, int width, int height, u8 const* blocks, unsigned short const* bucket, int first, int count)
+{
+  const int columns = (width + 3) >> 2;
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+  const int layouts = (mode < 8) && g_palettelayouts;
+#endif
+
+  for (int i = 0; i < count; i++) {
+    const int b = first + bucket[i];
+    const int y = (b / columns) << 2;
+    const int x = (b % columns) << 2;
+
+    u8 const* sourceBlock = blocks + 16 * b;
+    u8 a16 pixels[16 * 4];
+
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+    if (layouts)
+      UnpackPaletteBlock<mode < 8 ? mode : 0>(pixels, sourceBlock);
+    else
+#endif
+      ReadPaletteBlockMode<mode>(pixels, sourceBlock);
+
+    // write the decompressed pixels to the correct image locations
+    if ((x + 4 <= width) && (y + 4 <= height)) {
+      Col4 row0, row1, row2, row3;
+
+      LoadAligned(row0, pixels +  0);
+      LoadAligned(row1, pixels + 16);
+      LoadAligned(row2, pixels + 32);
+      LoadAligned(row3, pixels + 48);
+
+      StoreUnaligned(row0, (void *)(rgba + 4 * (width * (y + 0) + x)));
+      StoreUnaligned(row1, (void *)(rgba + 4 * (width * (y + 1) + x)));
+      StoreUnaligned(row2, (void *)(rgba + 4 * (width * (y + 2) + x)));
+      StoreUnaligned(row3, (void *)(rgba + 4 * (width * (y + 3) + x)));
+    }
+    else {
+      for (int py = 0; (py < 4) && (y + py < height); ++py) {
+	for (int px = 0; (px < 4) && (x + px < width); ++px) {
+	  u8 const* sourcePixel = pixels + 4 * (4 * py + px);
+	  u8* targetPixel = rgba + 4 * (width * (y + py) + (x + px));
+
+	  // copy the rgba value
+	  for (int i = 0; i < 4; ++i)
+	    targetPixel[i] = sourcePixel[i];
+	}
+      }
+    }
+  }
+}
+
+void DecompressImageBtc7u(u8* rgba, int width, int height, void const* blocks)
+{
+  enum { stripe = 256 };
+
+  u8 const* sourceBlocks = reinterpret_cast< u8 const* >(blocks);
+  const int count = ((width + 3) >> 2) * ((height + 3) >> 2);
+
+  for (int first = 0; first < count; first += stripe) {
+    const int last = (first + stripe < count ? first + stripe : count);
+
+    // 8 modes + reserved
+    int offsets[9 + 1] = {0};
+    u8 modes[stripe];
+    unsigned short buckets[stripe];
+
+    // get the modes
+    for (int b = first; b < last; b++) {
+      unsigned int bits = sourceBlocks[16 * b] | 0x100;
+#ifdef __GNUC__
+      unsigned long mode = __builtin_ctz(bits);
+#else
+      unsigned long mode; _BitScanForward(&mode, bits);
+#endif
+
+      modes[b - first] = (u8)mode;
+      offsets[mode + 1]++;
+    }
+
+    // sort the blocks into the buckets, in image order per bucket
+    for (int m = 1; m <= 9; m++)
+      offsets[m] += offsets[m - 1];
+    for (int b = first; b < last; b++)
+      buckets[offsets[modes[b - first]]++] = (unsigned short)(b - first);
+    for (int m = 9; m >= 1; m--)
+      offsets[m] = offsets[m - 1];
+    offsets[0] = 0;
+
+#define	bucket(m)	rgba, width, height, sourceBlocks, buckets + offsets[m], first, offsets[m + 1] - offsets[m]
+    ReadPaletteBucket<0>(bucket(0));
+    ReadPaletteBucket<1>(bucket(1));
+    ReadPaletteBucket<2>(bucket(2));
+    ReadPaletteBucket<3>(bucket(3));
+    ReadPaletteBucket<4>(bucket(4));
+    ReadPaletteBucket<5>(bucket(5));
+    ReadPaletteBucket<6>(bucket(6));
+    ReadPaletteBucket<7>(bucket(7));
+    ReadPaletteBucket<8>(bucket(8));
+#undef	bucket
+  }
+}
 #endif
 
 /* *****************************************************************************
@@ -62,6 +62,8 @@ namespace squish {
   void DecompressColoursBtc7u(u8 * rgba, void const* block);
   void DecompressColoursBtc7u(u16* rgba, void const* block);
   void DecompressColoursBtc7u(f23* rgba, void const* block);
+
+  void DecompressImageBtc7u(u8* rgba, int width, int height, void const* blocks);
 #endif
 
 // -----------------------------------------------------------------------------
@@ -64,13 +64,19 @@ PaletteClusterFit::PaletteClusterFit(PaletteSet const* palette, int flags, int s
     // we don't do this for sparse sets
     if (count != 1) {
       Vec4 centroid;
+      Moments4 moments;
+
+      // assemble the statistics from the block's moments if possible
+      bool const summed = m_palette->GetMoments(s, moments);
 
       // combined alpha
       if (trns) {
         Sym4x4 covariance;
 
         // get the covariance matrix
-        if (unweighted)
+        if (summed)
+	  ComputeWeightedCovariance4(covariance, centroid, moments, m_metric[s]);
+        else if (unweighted)
 	  ComputeWeightedCovariance4(covariance, centroid, count, values, m_metric[s]);
         else
 	  ComputeWeightedCovariance4(covariance, centroid, count, values, m_metric[s], weights);
@@ -83,7 +89,9 @@ PaletteClusterFit::PaletteClusterFit(PaletteSet const* palette, int flags, int s
         Sym3x3 covariance;
 
         // get the covariance matrix
-        if (unweighted)
+        if (summed)
+	  ComputeWeightedCovariance3(covariance, centroid, moments, m_metric[s]);
+        else if (unweighted)
 	  ComputeWeightedCovariance3(covariance, centroid, count, values, m_metric[s]);
         else
 	  ComputeWeightedCovariance3(covariance, centroid, count, values, m_metric[s], weights);
@@ -1212,6 +1220,235 @@ Scr4 PaletteClusterFit::ClusterSearch8(u8 (&closest)[4][16], int count, int set,
   return besterror;
 }
 
+#if	defined(FEATURE_CLUSTERSEARCH_PREFIXSUMS)
+extern int g_clustersearchprefix;
+
+static doinline void SplatLanes(Vec4 const &v, Vec4 (&lanes)[4])
+{
+  lanes[0] = v.SplatX();
+  lanes[1] = v.SplatY();
+  lanes[2] = v.SplatZ();
+  lanes[3] = v.SplatW();
+}
+
+Scr4 PaletteClusterFit::ClusterSearch8Prefix(u8 (&closest)[4][16], int count, int set, Vec4 const &metric, vQuantizer &q, int sb)
+{
+  Vec4 const weight1(1.0f / 7.0f, 1.0f / 7.0f, 1.0f / 7.0f,  1.0f / 49.0f);
+  Vec4 const weight2(2.0f / 7.0f, 2.0f / 7.0f, 2.0f / 7.0f,  4.0f / 49.0f);
+  Vec4 const weight3(3.0f / 7.0f, 3.0f / 7.0f, 3.0f / 7.0f,  9.0f / 49.0f);
+  Vec4 const weight4(4.0f / 7.0f, 4.0f / 7.0f, 4.0f / 7.0f, 16.0f / 49.0f);
+  Vec4 const weight5(5.0f / 7.0f, 5.0f / 7.0f, 5.0f / 7.0f, 25.0f / 49.0f);
+  Vec4 const weight6(6.0f / 7.0f, 6.0f / 7.0f, 6.0f / 7.0f, 36.0f / 49.0f);
+  Vec4 const twonineths                        = VEC4_CONST( 6.0f / 49.0f);
+  Vec4 const threenineths                      = VEC4_CONST(10.0f / 49.0f);
+  Vec4 const fournineths                       = VEC4_CONST(12.0f / 49.0f);
+
+  // the seventh cluster moves out of the last one: (weight6 - 1)
+  Vec4 const weight6_ = weight6 - VEC4_CONST(1.0f);
+  Vec4 const two = VEC4_CONST(2.0f);
+
+  assume((count > 0) && (count <= 16));
+
+  // match each point to the closest code
+  int besti = 0, bestj = 0, bestk = 0;
+  int bestl = 0, bestm = 0, bestn = 0;
+  int besto = 0;
+
+  int bestiteration = 0;
+  Vec4 beststart    = VEC4_CONST(0.0f);
+  Vec4 bestend      = VEC4_CONST(0.0f);
+
+  // prepare an ordering using the principle axis
+  ConstructOrdering(m_principle[set], 0, set);
+
+  // check all possible clusters and iterate on the total order
+  Scr4 besterror = Scr4(FLT_MAX);
+
+  // loop over iterations (we avoid the case that all points in first or last cluster)
+  for (int iterationIndex = 0;;) {
+    // cache some values
+    Vec4 const xsum_wsum = m_xsum_wsum[set];
+    Vec4 const* points = m_points_weights[set];
+
+    // prefix sums over the ordering, the cluster [a,b) is prefix[b] - prefix[a]
+    // the tail is padded with the total, so the last batch of four can be
+    // set up in full
+    Vec4 prefix[16 + 4];
+    prefix[0] = VEC4_CONST(0.0f);
+    for (int t = 0; t < count; ++t)
+      prefix[t + 1] = prefix[t] + points[t];
+    prefix[count + 1] = prefix[count + 2] = prefix[count + 3] = prefix[count];
+
+    // the enumeration table: the weights of four consecutive boundaries side by side
+    Vec4 prefixw[16 + 1];
+    for (int t = 0; t <= count; ++t)
+      prefixw[t] = Vec4(prefix[t + 0].SplatW(), prefix[t + 1].SplatW(),
+			prefix[t + 2].SplatW(), prefix[t + 3].SplatW());
+
+    // first cluster [0,i) is at the start
+    for (int i = 0; i < count; ++i) {
+	  Vec4 part0 = prefix[i];
+
+    // second cluster [i,j) is one seventh along
+    for (int j = i; j <= count; ++j) {
+	  Vec4 part1 = prefix[j] - prefix[i];
+	  Vec4 add1a = weight6 * part1;
+	  Vec4 add1b = weight1 * part1;
+
+    // third cluster [j,k) is one seventh along
+    for (int k = j; k <= count; ++k) {
+	  Vec4 part2 = prefix[k] - prefix[j];
+	  Vec4 add2a = MultiplyAdd(weight5, part2, add1a);
+	  Vec4 add2b = MultiplyAdd(weight2, part2, add1b);
+
+    // fourth cluster [k,l) is one seventh along
+    for (int l = k; l <= count; ++l) {
+	  Vec4 part3 = prefix[l] - prefix[k];
+	  Vec4 add3a = MultiplyAdd(weight4, part3, add2a);
+	  Vec4 add3b = MultiplyAdd(weight3, part3, add2b);
+
+    // fifth cluster [l,m) is one seventh along
+    for (int m = l; m <= count; ++m) {
+	  Vec4 part4 = prefix[m] - prefix[l];
+	  Vec4 add4a = MultiplyAdd(weight3, part4, add3a);
+	  Vec4 add4b = MultiplyAdd(weight4, part4, add3b);
+
+	  Vec4 sum34 = fournineths  * (part3 + part4).SplatW();
+
+    // sixths cluster [m,n) is one seventh along
+    for (int n = m; n <= count; ++n) {
+	  Vec4 part5 = prefix[n] - prefix[m];
+	  Vec4 add5a = MultiplyAdd(weight2, part5, add4a);
+	  Vec4 add5b = MultiplyAdd(weight5, part5, add4b);
+
+	  Vec4 sum25 = threenineths * (part2 + part5).SplatW();
+
+	  // everything not depending on the seventh cluster [n,o), the
+	  // last cluster [o,count) is the remainder of everything
+	  Vec4 const alpha5 = add5a + part0;
+	  Vec4 const  beta5 = add5b + xsum_wsum - prefix[n];
+	  Vec4 const ab5    = MultiplyAdd(twonineths, part1.SplatW(), sum25 + sum34);
+
+	  Vec4 const alpha5w = alpha5.SplatW();
+	  Vec4 const  beta5w =  beta5.SplatW();
+	  Vec4 const prefixn = prefix[n];
+	  Vec4 const prefixnw = prefixn.SplatW();
+
+    // seventh cluster [n,o) is six seventh along, four boundaries at once
+    for (int o = (n == 0) ? 1 : n; o <= count; o += 4) {
+	  // the weight of the seventh cluster of four candidates
+	  Vec4 const part6w = prefixw[o] - prefixnw;
+
+	  // the scalar least squares terms of four candidates
+	  Vec4 const alpha2_sums = MultiplyAdd(weight1.SplatW() , part6w, alpha5w);
+	  Vec4 const  beta2_sums = MultiplyAdd(weight6_.SplatW(), part6w,  beta5w);
+	  Vec4 const alphabeta_sums = MultiplyAdd(twonineths, part6w, ab5);
+
+	  // one reciprocal for four 2x2 systems
+	  Vec4 const factors = Reciprocal(NegativeMultiplySubtract(alphabeta_sums, alphabeta_sums, alpha2_sums * beta2_sums));
+
+	  Vec4 alpha2_lanes[4]; SplatLanes(alpha2_sums, alpha2_lanes);
+	  Vec4  beta2_lanes[4]; SplatLanes( beta2_sums,  beta2_lanes);
+	  Vec4 alphabeta_lanes[4]; SplatLanes(alphabeta_sums, alphabeta_lanes);
+	  Vec4 factor_lanes[4]; SplatLanes(factors, factor_lanes);
+
+	  // the padded candidates of the last batch aren't snapped and measured
+	  for (int c = 0; (c < 4) && (o + c <= count); ++c) {
+	    Vec4 const part6 = prefix[o + c] - prefixn;
+
+	    // compute least squares terms directly
+	    Vec4 const alphax_sum = MultiplyAdd(weight1 , part6, alpha5);
+	    Vec4 const  betax_sum = MultiplyAdd(weight6_, part6,  beta5);
+
+	    Vec4 const alpha2_sum = alpha2_lanes[c];
+	    Vec4 const  beta2_sum =  beta2_lanes[c];
+	    Vec4 const alphabeta_sum = alphabeta_lanes[c];
+
+	    // compute the least-squares optimal points
+	    Vec4 a = NegativeMultiplySubtract( betax_sum, alphabeta_sum, alphax_sum *  beta2_sum) * factor_lanes[c];
+	    Vec4 b = NegativeMultiplySubtract(alphax_sum, alphabeta_sum,  betax_sum * alpha2_sum) * factor_lanes[c];
+
+	    // snap floating-point-values to the integer-lattice
+	    a = q.SnapToLattice(a, sb, 1 << SBSTART);
+	    b = q.SnapToLattice(b, sb, 1 << SBEND);
+
+	    // compute the error (we skip the constant xxsum)
+	    Vec4 e1 = MultiplyAdd(a * a, alpha2_sum, b * b * beta2_sum);
+	    Vec4 e2 = NegativeMultiplySubtract(a, alphax_sum, a * b * alphabeta_sum);
+	    Vec4 e3 = NegativeMultiplySubtract(b,  betax_sum, e2);
+	    Vec4 e4 = MultiplyAdd(two, e3, e1);
+
+	    // apply the metric to the error term
+	    Scr4 eS = Dot(e4, metric);
+
+	    // keep the solution if it wins (error can be negative ...)
+	    if (besterror > eS) {
+	      besterror = eS;
+
+	      beststart = a;
+	      bestend   = b;
+	      bestiteration = iterationIndex;
+
+	      besti = i,
+	      bestj = j,
+	      bestk = k,
+	      bestl = l,
+	      bestm = m,
+	      bestn = n,
+	      besto = o + c;
+	    }
+	  }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+
+    // stop if we didn't improve in this iteration
+    if (bestiteration != iterationIndex)
+      break;
+
+    // advance if possible
+    ++iterationIndex;
+    if (iterationIndex == m_iterationCount)
+      break;
+
+    // stop if a new iteration is an ordering that has already been tried
+    Vec4 axis = KillW(bestend - beststart);
+    if (!ConstructOrdering(axis, iterationIndex, set))
+      break;
+  }
+
+  // assign closest points
+  u8 const* order = (u8*)m_order[set] + 16 * bestiteration;
+
+  for (int m =     0; m < besti; ++m)
+    closest[set][order[m]] = 0;
+  for (int m = besti; m < bestj; ++m)
+    closest[set][order[m]] = 1;
+  for (int m = bestj; m < bestk; ++m)
+    closest[set][order[m]] = 2;
+  for (int m = bestk; m < bestl; ++m)
+    closest[set][order[m]] = 3;
+  for (int m = bestl; m < bestm; ++m)
+    closest[set][order[m]] = 4;
+  for (int m = bestm; m < bestn; ++m)
+    closest[set][order[m]] = 5;
+  for (int m = bestn; m < besto; ++m)
+    closest[set][order[m]] = 6;
+  for (int m = besto; m < count; ++m)
+    closest[set][order[m]] = 7;
+
+  // copy rgb into the common start/end definition
+  m_start[set] = beststart;
+  m_end  [set] = bestend;
+
+  return besterror;
+}
+#endif
+
 Scr4 PaletteClusterFit::ClusterSearch8Constant(u8 (&closest)[4][16], int count, int set, Vec4 const &metric, vQuantizer &q, int sb)
 {
   /*
@@ -1590,6 +1827,20 @@ void PaletteClusterFit::CompressS23(void* block, vQuantizer &q, int mode)
         case 3:
           if (m_optimizable[s])
 	    cerror = ClusterSearch8Constant(closest, count, s, KillW(cmetric), q, sb);
+#if	defined(FEATURE_CLUSTERSEARCH_PREFIXSUMS)
+          else if (g_clustersearchprefix) {
+#if	defined(VERIFY_CLUSTERSEARCH)
+	    // run the reference loop first, the vectorized search overwrites its results
+	    Scr4 verror = ClusterSearch8    (closest, count, s, KillW(cmetric), q, sb);
+#endif
+	    cerror = ClusterSearch8Prefix  (closest, count, s, KillW(cmetric), q, sb);
+#if	defined(VERIFY_CLUSTERSEARCH)
+	    // both enumerate the same candidates, only rounding may differ
+	    if (!(Abs(cerror - verror) < Scr4(1e-4f)))
+	      fprintf(stderr, "ClusterSearch8 mismatch: %f vs. %f\n", verror.X(), cerror.X());
+#endif
+          }
+#endif
           else
 	    cerror = ClusterSearch8        (closest, count, s, KillW(cmetric), q, sb);
           break;
@@ -80,6 +80,9 @@ private:
 
   Scr4 ClusterSearch4(u8 (&closest)[4][16], int count, int set, Vec4 const &metric, vQuantizer &q, int sb);
   Scr4 ClusterSearch8(u8 (&closest)[4][16], int count, int set, Vec4 const &metric, vQuantizer &q, int sb);
+#if	defined(FEATURE_CLUSTERSEARCH_PREFIXSUMS)
+  Scr4 ClusterSearch8Prefix(u8 (&closest)[4][16], int count, int set, Vec4 const &metric, vQuantizer &q, int sb);
+#endif
 
   int  m_iterationCount;
   Vec4 m_principle[4];
@@ -98,20 +98,18 @@ static const int maps[2][64] = {
  *  6    1  0  0  0   7  7  1   0   4  0	IB: Index bits per element
  *  7    2  6  0  0   5  5  1   0   2  0	IB2: Secondary index bits per element
  */
+#define	PBCFG(m, ns, pb, rb, isb, cb, ab, epb, spb, ib, ib2)		\
+  { ns, pb, rb, isb, cb, ab, epb, spb, ib, ib2 },
+
 static const struct {
   char
    NS,PB,RB,ISB,CB,AB,EPB,SPB,IB,IB2;
 } PBcfg[8] = {
-  { 3, 4, 0, 0,  4, 0, 1,  0,  3, 0 },
-  { 2, 6, 0, 0,  6, 0, 0,  1,  3, 0 },
-  { 3, 6, 0, 0,  5, 0, 0,  0,  2, 0 },
-  { 2, 6, 0, 0,  7, 0, 1,  0,  2, 0 },
-  { 1, 0, 2, 1,  5, 6, 0,  0,  2, 3 },
-  { 1, 0, 2, 0,  7, 8, 0,  0,  2, 2 },
-  { 1, 0, 0, 0,  7, 7, 1,  0,  4, 0 },
-  { 2, 6, 0, 0,  5, 5, 1,  0,  2, 0 }
+  PALETTEMODES(PBCFG)
 };
 
+#undef	PBCFG
+
 int PaletteFit::GetNumSets(int mode) {
   return
     PBcfg[mode].NS;
@@ -161,6 +159,58 @@ int PaletteFit::GetPrecisionBits(int mode) {
     ((PBcfg[mode].AB + (PBcfg[mode].AB ? PBcfg[mode].EPB + PBcfg[mode].SPB : 0)) << 16);
 }
 
+static int CountOddCodes(Vec4 const &value, int cb, int ab)
+{
+  float const c[4] = { value.X(), value.Y(), value.Z(), value.W() };
+  int const channels = ab ? 4 : 3;
+  int odd = 0;
+
+  // parity of the closest code at the precision including the p-bit
+  for (int i = 0; i < channels; i++) {
+    int const bits = (i < 3 ? cb : ab);
+    float const v = std::max(0.0f, std::min(1.0f, c[i]));
+
+    odd += (int)(v * ((1 << bits) - 1) + 0.5f) & 1;
+  }
+
+  return odd;
+}
+
+int PaletteFit::PredictSharedBits() const
+{
+  int const isets = m_palette->GetSets();
+  int const numb = GetSharedBits(m_mode);
+  int const cb = PBcfg[m_mode].CB + 1;
+  int const ab = PBcfg[m_mode].AB ? PBcfg[m_mode].AB + 1 : 0;
+  int const channels = ab ? 4 : 3;
+
+  if (!numb)
+    return SBSKIP;
+
+  // majority of the channel's parities, ties go to 1 (opaque alpha)
+  int field = 0;
+  for (int s = 0; s < isets; s++) {
+    int const oddstart = CountOddCodes(m_start[s], cb, ab);
+    int const oddend   = CountOddCodes(m_end  [s], cb, ab);
+
+    if (PBcfg[m_mode].EPB) {
+      field |= ((oddstart * 2 >= channels) ? 1 : 0) << (s + SBSTART);
+      field |= ((oddend   * 2 >= channels) ? 1 : 0) << (s + SBEND);
+    }
+    else if ((oddstart + oddend) >= channels) {
+      field |= (1 << (s + SBSTART)) | (1 << (s + SBEND));
+    }
+  }
+
+  // the trial index of the predicted field
+  for (int b = 0; b <= numb; b++) {
+    if (m_sharedmap[b] == field)
+      return b;
+  }
+
+  return 0;
+}
+
 PaletteFit::PaletteFit(PaletteSet const* palette, int flags, int swap, int shared)
   : m_palette(palette), m_swapindex(-1), m_flags(flags), m_sharedbits(-1)
 {
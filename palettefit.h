@@ -34,6 +34,49 @@ namespace squish {
 
 // -----------------------------------------------------------------------------
 #if	!defined(SQUISH_USE_PRE)
+/*! @brief The layout of the BC7 modes, one row per mode
+
+  The run-time table used by PaletteFit::Get*Bits() and the compile-time
+  constants of PaletteMode<> are both expanded from these rows.
+*/
+//                    Mode NS PB RB ISB CB AB EPB SPB IB IB2
+#define	PALETTEMODES(MODE)							\
+			MODE(0,   3, 4, 0, 0,  4, 0, 1,  0,  3, 0)		\
+			MODE(1,   2, 6, 0, 0,  6, 0, 0,  1,  3, 0)		\
+			MODE(2,   3, 6, 0, 0,  5, 0, 0,  0,  2, 0)		\
+			MODE(3,   2, 6, 0, 0,  7, 0, 1,  0,  2, 0)		\
+			MODE(4,   1, 0, 2, 1,  5, 6, 0,  0,  2, 3)		\
+			MODE(5,   1, 0, 2, 0,  7, 8, 0,  0,  2, 2)		\
+			MODE(6,   1, 0, 0, 0,  7, 7, 1,  0,  4, 0)		\
+			MODE(7,   2, 6, 0, 0,  5, 5, 1,  0,  2, 0)
+
+/*! @brief The layout of a BC7 mode as compile-time constants
+
+  The precisions include the end-point and shared p-bits.
+*/
+template<const int mode>
+struct PaletteMode;
+
+#define	PALETTEMODE(m, ns, pb, rb, isb, cb, ab, epb, spb, ib, ib2)		\
+template<>									\
+struct PaletteMode<m> {								\
+  enum {									\
+    NumSets         = ns,							\
+    PartitionBits   = pb,							\
+    RotationBits    = rb,							\
+    SelectionBits   = isb,							\
+    IndexBits       = ib,							\
+    IndexBits2      = ib2,							\
+    ColourPrecision = cb + (cb ? epb + spb : 0),				\
+    AlphaPrecision  = ab + (ab ? epb + spb : 0),				\
+    SharedBits      = epb ? (1 << (ns * epb * 2)) - 1 :				\
+                      spb ? (1 << (ns * spb * 1)) - 1 : 0			\
+  };										\
+};
+
+PALETTEMODES(PALETTEMODE)
+#undef	PALETTEMODE
+
 class PaletteSet;
 class PaletteFit
 {
@@ -76,6 +119,9 @@ public:
   int GetSwap() const { return m_swapindex; }
   int GetSharedField() const { return m_sharedbits; }
 
+  // the shared bits predicted from the parity of the unquantized end-points
+  int PredictSharedBits() const;
+
   // error management
   void SetError(Scr4 &error) { m_besterror = error; m_best = false; }
   Scr4 GetError() { return m_besterror; }
@@ -89,6 +135,7 @@ public:
 #endif
 
   bool Lossless() { return !(m_besterror > Scr4(0.0f)); }
+  bool Sufficient(Scr4 const &target) { return !(m_besterror > target); }
   bool IsBest() { return m_best; }
 
 protected:
@@ -58,6 +58,10 @@ PaletteNormalFit::PaletteNormalFit(PaletteSet const* palette, int flags, int swa
     // we don't do this for sparse sets
     if (count != 1) {
       Vec4 centroid;
+      Moments4 moments;
+
+      // assemble the statistics from the block's moments if possible
+      bool const summed = m_palette->GetMoments(s, moments);
       Vec4 principle;
 
       // combined alpha
@@ -65,7 +69,9 @@ PaletteNormalFit::PaletteNormalFit(PaletteSet const* palette, int flags, int swa
         Sym4x4 covariance;
 
         // get the covariance matrix
-        if (unweighted)
+        if (summed)
+	  ComputeWeightedCovariance4(covariance, centroid, moments, m_metric[s]);
+        else if (unweighted)
 	  ComputeWeightedCovariance4(covariance, centroid, count, values, m_metric[s]);
         else
 	  ComputeWeightedCovariance4(covariance, centroid, count, values, m_metric[s], weights);
@@ -78,7 +84,9 @@ PaletteNormalFit::PaletteNormalFit(PaletteSet const* palette, int flags, int swa
         Sym3x3 covariance;
 
         // get the covariance matrix
-        if (unweighted)
+        if (summed)
+	  ComputeWeightedCovariance3(covariance, centroid, moments, m_metric[s]);
+        else if (unweighted)
 	  ComputeWeightedCovariance3(covariance, centroid, count, values, m_metric[s]);
         else
 	  ComputeWeightedCovariance3(covariance, centroid, count, values, m_metric[s], weights);
@@ -63,6 +63,10 @@ PaletteRangeFit::PaletteRangeFit(PaletteSet const* palette, int flags, int swap,
     // we don't do this for sparse sets
     if (count > 2) {
       Vec4 centroid;
+      Moments4 moments;
+
+      // assemble the statistics from the block's moments if possible
+      bool const summed = m_palette->GetMoments(s, moments);
       Vec4 principle;
 
       // combined alpha
@@ -70,7 +74,9 @@ PaletteRangeFit::PaletteRangeFit(PaletteSet const* palette, int flags, int swap,
         Sym4x4 covariance;
 
         // get the covariance matrix
-        if (unweighted)
+        if (summed)
+	  ComputeWeightedCovariance4(covariance, centroid, moments, m_metric[s]);
+        else if (unweighted)
 	  ComputeWeightedCovariance4(covariance, centroid, count, values, m_metric[s]);
         else
 	  ComputeWeightedCovariance4(covariance, centroid, count, values, m_metric[s], weights);
@@ -83,7 +89,9 @@ PaletteRangeFit::PaletteRangeFit(PaletteSet const* palette, int flags, int swap,
         Sym3x3 covariance;
 
         // get the covariance matrix
-        if (unweighted)
+        if (summed)
+	  ComputeWeightedCovariance3(covariance, centroid, moments, m_metric[s]);
+        else if (unweighted)
 	  ComputeWeightedCovariance3(covariance, centroid, count, values, m_metric[s]);
         else
 	  ComputeWeightedCovariance3(covariance, centroid, count, values, m_metric[s], weights);
@@ -165,12 +173,51 @@ PaletteRangeFit::PaletteRangeFit(PaletteSet const* palette, int flags, int swap,
 #endif
 }
 
+/* -----------------------------------------------------------------------------
+ * match all points to the closest code of a codebook of compile-time size
+ */
+template<const int kb>
+static doinline void MatchCodebook(u8 (&closest)[16], Scr4 &error, int count, Vec4 const* values, Scr4 const* freq, Vec4 const &metric, Vec4 (&codes)[1 << 4])
+{
+  for (int i = 0; i < count; ++i) {
+    int idx = 0;
+
+    // find the closest code
+    Vec4 value = metric * values[i];
+    Scr4 dist = Scr4(FLT_MAX);
+    for (int j = 0; j < (1 << kb); j += 0)
+      MinDistance4<true>(dist, idx, value, codes, j);
+
+    // accumulate the error
+    AddDistance(dist, error, freq[i]);
+
+    // save the index
+    closest[i] = (u8)idx;
+  }
+}
+
 void PaletteRangeFit::Compress(void* block, vQuantizer &q, int mode)
 {
-  int ib = GetIndexBits(mode);
-  int jb = ib >> 16; ib = ib & 0xFF;
-  int cb = GetPrecisionBits(mode);
-  int ab = cb >> 16; cb = cb & 0xFF;
+  // dispatch once to the fit specialized for the mode
+  switch (mode) {
+    case 0: CompressMode<0>(block, q); break;
+    case 1: CompressMode<1>(block, q); break;
+    case 2: CompressMode<2>(block, q); break;
+    case 3: CompressMode<3>(block, q); break;
+    case 4: CompressMode<4>(block, q); break;
+    case 5: CompressMode<5>(block, q); break;
+    case 6: CompressMode<6>(block, q); break;
+    case 7: CompressMode<7>(block, q); break;
+  }
+}
+
+template<const int mode>
+void PaletteRangeFit::CompressMode(void* block, vQuantizer &q)
+{
+  const int ib = PaletteMode<mode>::IndexBits;
+  const int jb = PaletteMode<mode>::IndexBits2;
+  const int cb = PaletteMode<mode>::ColourPrecision;
+  const int ab = PaletteMode<mode>::AlphaPrecision;
   int zb = GetSharedField();
 
   q.ChangeShared(cb, cb, cb, ab, zb);
@@ -252,23 +299,13 @@ void PaletteRangeFit::Compress(void* block, vQuantizer &q, int mode)
       Vec4 end   = q.SnapToLattice(m_end  [s], sb, 1 << SBEND);
       
       // resolve "metric * (value - code)" to "metric * value - metric * code"
-      int ccs = CodebookP(codes, kb, metric * start, metric * end);
-
-      for (int i = 0; i < count; ++i) {
-	int idx = 0;
+      CodebookP(codes, kb, metric * start, metric * end);
 
-	// find the closest code
-	Vec4 value = metric * values[i];
-	Scr4 dist = Scr4(FLT_MAX);
-	for (int j = 0; j < ccs; j += 0)
-	  MinDistance4<true>(dist, idx, value, codes, j);
-
-	// accumulate the error
-	AddDistance(dist, error, freq[i]);
-
-	// save the index
-	closest[s][i] = (u8)idx;
-      }
+      // the codebook-size is one of the two of the mode
+      if (kb == ib)
+	MatchCodebook<ib>(closest[s], error, count, values, freq, metric, codes);
+      else
+	MatchCodebook<jb ? jb : ib>(closest[s], error, count, values, freq, metric, codes);
 
 #elif	defined(FEATURE_SHAREDBITS_TRIALS) && (FEATURE_SHAREDBITS_TRIALS == SHAREDBITS_TRIAL_PERMUTE)
       // if we have a down-forced bit we need to check 2 versions, the +2bt as well
@@ -50,6 +50,10 @@ public:
   virtual void Compress(void* block, vQuantizer &q, int mode);
 
 private:
+  // the fit specialized to the constant layout of each mode
+  template<const int mode>
+  void CompressMode(void* block, vQuantizer &q);
+
 #ifdef	FEATURE_ELIMINATE_FLATBOOKS
   Vec4 m_start_candidate[4];
   Vec4 m_end_candidate[4];
@@ -29,6 +29,8 @@
 
 namespace squish {
 
+extern Vec4 g_metric[8];
+
 // Associated to partition -1, 16 * 0 bit
 extern const u16 partitionmasks_1[1] =
 {
@@ -180,7 +182,8 @@ doinline int PaletteSet::SetMode(int flags, int part_or_rot) {
 
 PaletteSet::PaletteSet(u8 const* rgba, int mask, int flags)
   : m_numsets(1), m_rotid(0), m_partid(0), m_partmask(0xFFFF),
-    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false)
+    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false),
+    m_moments(NULL), m_momentweights(false)
 {
   // make the set (if succesive partition permutation, preserve alpha)
   BuildSet(rgba, mask, SetMode(flags));
@@ -188,7 +191,8 @@ PaletteSet::PaletteSet(u8 const* rgba, int mask, int flags)
 
 PaletteSet::PaletteSet(u16 const* rgba, int mask, int flags)
   : m_numsets(1), m_rotid(0), m_partid(0), m_partmask(0xFFFF),
-    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false)
+    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false),
+    m_moments(NULL), m_momentweights(false)
 {
   // make the set (if succesive partition permutation, preserve alpha)
   BuildSet(rgba, mask, SetMode(flags));
@@ -196,7 +200,8 @@ PaletteSet::PaletteSet(u16 const* rgba, int mask, int flags)
 
 PaletteSet::PaletteSet(f23 const* rgba, int mask, int flags)
   : m_numsets(1), m_rotid(0), m_partid(0), m_partmask(0xFFFF),
-    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false)
+    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false),
+    m_moments(NULL), m_momentweights(false)
 {
   // make the set (if succesive partition permutation, preserve alpha)
   BuildSet(rgba, mask, SetMode(flags));
@@ -204,7 +209,8 @@ PaletteSet::PaletteSet(f23 const* rgba, int mask, int flags)
 
 PaletteSet::PaletteSet(u8 const* rgba, int mask, int flags, int part_or_rot)
   : m_numsets(1), m_rotid(0), m_partid(0), m_partmask(0xFFFF),
-    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false)
+    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false),
+    m_moments(NULL), m_momentweights(false)
 {
   // make the set
   BuildSet(rgba, mask, SetMode(flags, part_or_rot));
@@ -212,7 +218,8 @@ PaletteSet::PaletteSet(u8 const* rgba, int mask, int flags, int part_or_rot)
 
 PaletteSet::PaletteSet(u16 const* rgba, int mask, int flags, int part_or_rot)
   : m_numsets(1), m_rotid(0), m_partid(0), m_partmask(0xFFFF),
-    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false)
+    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false),
+    m_moments(NULL), m_momentweights(false)
 {
   // make the set
   BuildSet(rgba, mask, SetMode(flags, part_or_rot));
@@ -220,16 +227,30 @@ PaletteSet::PaletteSet(u16 const* rgba, int mask, int flags, int part_or_rot)
 
 PaletteSet::PaletteSet(f23 const* rgba, int mask, int flags, int part_or_rot)
   : m_numsets(1), m_rotid(0), m_partid(0), m_partmask(0xFFFF),
-    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false)
+    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false),
+    m_moments(NULL), m_momentweights(false)
 {
   // make the set
   BuildSet(rgba, mask, SetMode(flags, part_or_rot));
 }
 
 PaletteSet::PaletteSet(PaletteSet const &palette, int mask, int flags, int part_or_rot)
-  : m_numsets(1), m_rotid(0), m_partid(0), m_partmask(0xFFFF),
-    m_seperatealpha(false), m_mergedalpha(false), m_transparent(false)
 {
+  Permute(palette, mask, flags, part_or_rot);
+}
+
+PaletteSet::PaletteSet(PaletteSet const &palette, PaletteMoments const &moments, int mask, int flags, int part_or_rot)
+{
+  Permute(palette, moments, mask, flags, part_or_rot);
+}
+
+void PaletteSet::Permute(PaletteSet const &palette, int mask, int flags, int part_or_rot)
+{
+  // clean initial state
+  m_numsets = 1, m_rotid = 0, m_partid = 0, m_partmask = 0xFFFF;
+  m_seperatealpha = m_mergedalpha = m_transparent = false;
+  m_moments = NULL, m_momentweights = false;
+
   flags = SetMode(flags, part_or_rot);
 
   // make, permute or copy the new set
@@ -238,7 +259,53 @@ PaletteSet::PaletteSet(PaletteSet const &palette, int mask, int flags, int part_
   else if (m_numsets > 1)
     PermuteSet(palette, mask, flags);		// permutable
   else
-    memcpy(this, &palette, sizeof(*this));	// identical
+    CopySet(palette);				// identical
+}
+
+void PaletteSet::Permute(PaletteSet const &palette, PaletteMoments const &moments, int mask, int flags, int part_or_rot)
+{
+  Permute(palette, mask, flags, part_or_rot);
+
+#ifndef FEATURE_WEIGHTS_ROOTED
+  // permuted points are the pixels of the initial set, the moments apply
+  if (!m_seperatealpha && (m_numsets > 1))
+    m_moments = &moments,
+    m_momentweights = ((flags & kWeightColourByAlpha) != 0) & (!m_mergedalpha);
+#endif
+}
+
+void PaletteSet::CopySet(PaletteSet const &palette) {
+  // a single set without separate alpha, only copy what's occupied
+  int const count = palette.m_count[0];
+
+  m_numsets       = palette.m_numsets;
+  m_rotid         = palette.m_rotid;
+  m_partid        = palette.m_partid;
+  m_partmask      = palette.m_partmask;
+  m_seperatealpha = palette.m_seperatealpha;
+  m_mergedalpha   = palette.m_mergedalpha;
+  m_transparent   = palette.m_transparent;
+  m_moments       = palette.m_moments;
+  m_momentweights = palette.m_momentweights;
+
+  memcpy(m_unweighted, palette.m_unweighted, sizeof(m_unweighted));
+  memcpy(m_mask, palette.m_mask, sizeof(m_mask));
+  memcpy(m_count, palette.m_count, sizeof(m_count));
+  memcpy(m_remap, palette.m_remap, sizeof(m_remap));
+
+  for (int i = 0; i < count; ++i) {
+    m_points [0][i] = palette.m_points [0][i];
+    m_weights[0][i] = palette.m_weights[0][i];
+  }
+
+  // the per-pixel weights, for successive permutations
+  for (int i = 0; i < 16; ++i)
+    m_weights[3][i] = palette.m_weights[3][i];
+
+#ifdef	FEATURE_TEST_LINES
+  memcpy(m_cnst, palette.m_cnst, sizeof(m_cnst));
+  memcpy(m_grey, palette.m_grey, sizeof(m_grey));
+#endif
 }
 
 void PaletteSet::BuildSet(u8 const* rgba, int mask, int flags) {
@@ -310,8 +377,8 @@ void PaletteSet::BuildSet(u8 const* rgba, int mask, int flags) {
     m_weights[3][i] = Weight<u8>(rgba, i, 0).GetWeights();
   }
   
-  // combined mask
-  amask = mask & (~amask);
+  // combined mask, only the 16 pixels (an unmasked block passes all bits)
+  amask = mask & (~amask) & 0xFFFF;
 
   // clean initial state
   m_count     [0] = m_count     [1] =
@@ -674,8 +741,8 @@ void PaletteSet::BuildSet(f23 const* rgba, int mask, int flags) {
     m_weights[3][i] = Weight<f23>(rgba, i, Scr4(0.0f)).GetWeights();
   }
   
-  // combined mask
-  amask = mask & (~amask);
+  // combined mask, only the 16 pixels (an unmasked block passes all bits)
+  amask = mask & (~amask) & 0xFFFF;
 
   // clean initial state
   m_count     [0] = m_count     [1] =
@@ -1237,6 +1304,244 @@ void PaletteSet::PermuteSet(PaletteSet const &palette, int mask, int flags) {
 #endif
 }
 
+bool PaletteSet::GetMoments(int idx, Moments4 &moments) const
+{
+  if (!m_moments)
+    return false;
+
+  // the sets are disjoint masks of the block's pixels
+  m_moments->Accumulate(moments, m_mask[idx], m_momentweights);
+  return true;
+}
+
+/* -----------------------------------------------------------------------------
+ */
+PaletteMoments::PaletteMoments(PaletteSet const &palette)
+{
+  // the set must be the unpermuted base of the permutations
+  assert(palette.m_numsets == 1);
+
+  Vec4 const wgtn = Vec4(1.0f);
+  Vec4 const wgta = Vec4(0.0f);
+
+  m_transparent = palette.m_transparent;
+  m_used = 0;
+  for (int i = 0; i < 16; ++i) {
+    int idx = palette.m_remap[0][i];
+    if (idx < 0) {
+      m_pixels[0][i].Clear();
+      m_pixels[1][i].Clear();
+      continue;
+    }
+
+    // the same point and weights the permutation will use
+    Vec4 v = palette.m_points[0][idx];
+    Vec4 q = v * v;
+    Vec4 r1 = v * RotateLeft<1>(v);
+    Vec4 r2 = v * RotateLeft<2>(v);
+
+    for (int w = 0; w < 2; ++w) {
+      Weight<Scr4> wa(palette.m_weights, i, w ? wgta : wgtn);
+      Vec4 wgt = Vec4(wa.GetWeights());
+
+      m_pixels[w][i].w  = wgt;
+      m_pixels[w][i].s  = wgt * v;
+      m_pixels[w][i].q  = wgt * q;
+      m_pixels[w][i].r1 = wgt * r1;
+      m_pixels[w][i].r2 = wgt * r2;
+    }
+
+    m_used |= 1 << i;
+  }
+}
+
+void PaletteMoments::Accumulate(Moments4 &moments, int mask, bool weighted) const
+{
+  Moments4 const *pixels = m_pixels[weighted ? 1 : 0];
+
+  moments.Clear();
+  for (int i = 0, m = mask & m_used; m; ++i, m >>= 1) {
+    if (m & 1)
+      moments.Add(pixels[i]);
+  }
+}
+
+/* -----------------------------------------------------------------------------
+ * estimate the error of a set as the part of its scatter not explained by the
+ * principal axis (trace - largest eigenvalue), the eigenvalue is found by a
+ * few power iterations on the 4x4 scatter-matrix, four sets at a time
+ */
+static Vec4 EstimateSetErrors(Moments4 const* m)
+{
+  Sym4x4x4 scatter;
+  Vec4 centroid[4];
+  Vec4 axis[4];
+
+  // centered scatter
+  ComputeWeightedCovariance4(scatter, centroid, m, Vec4(1.0f));
+
+  Vec4 weight = Vec4(m[0].w, m[1].w, m[2].w, m[3].w);
+  Vec4 trace = scatter[0] + scatter[4] + scatter[7] + scatter[9];
+  Vec4 lambda = EstimatePrincipleComponents(scatter, axis, 4);
+
+  // sets of less than two pixels or without spread are exact
+  Vec4 valid = IsGreaterThan(weight, Vec4(1.0f)) & IsGreaterThan(trace, Vec4(0.0f));
+
+  return valid & Max(Vec4(0.0f), trace - lambda);
+}
+
+void PaletteMoments::RankPartitions(int flags, int partitions, int (&ranking)[64]) const
+{
+  bool const threesets =
+    ((flags & kVariableCodingModes) == kVariableCodingMode1) ||
+    ((flags & kVariableCodingModes) == kVariableCodingMode3);
+
+  // moments of the whole block, the last set is the remainder
+  Moments4 total;
+  Accumulate(total, 0xFFFF, false);
+
+  // the sets of all partitions, they are estimated four at a time
+  Moments4 sets[64 * 3 + 3];
+  int owner[64 * 3 + 3];
+  int count = 0;
+
+  // all partitions, the last set is the complement of the others
+  for (int p = 0; p < partitions; ++p) {
+    unsigned int partmask = threesets ? partitionmasks_3[p] : partitionmasks_2[p];
+    int masks[2] = {
+      (int)(( partmask & 0xFFFF) & (~partmask >> 16)),
+      (int)((0xFFFFFFFF & 0xFFFF) & ( partmask >> 16))
+    };
+
+    Moments4 remainder = total;
+
+    for (int t = 0; t < (threesets ? 2 : 1); ++t) {
+      Accumulate(sets[count], masks[t], false);
+      remainder.Sub(sets[count]);
+      owner[count++] = p;
+    }
+
+    sets[count] = remainder;
+    owner[count++] = p;
+  }
+
+  // pad the last batch with empty sets
+  for (int k = count; k & 3; ++k)
+    sets[k].Clear();
+
+  // sum up the estimates in the order of the sets
+  Scr4 errors[64];
+  for (int p = 0; p < partitions; ++p)
+    errors[p] = Scr4(0.0f);
+
+  for (int k = 0; k < count; k += 4) {
+    Vec4 estimates = EstimateSetErrors(sets + k);
+
+    for (int l = k; (l < k + 4) && (l < count); ++l)
+      errors[owner[l]] += Scr4(estimates.GetO(l - k));
+  }
+
+  for (int p = 0; p < partitions; ++p) {
+    // insertion-sort by estimated error, ties keep the partition-order
+    int r = p;
+    while ((r > 0) && (errors[p] < errors[ranking[r - 1]])) {
+      ranking[r] = ranking[r - 1];
+      r--;
+    }
+
+    ranking[r] = p;
+  }
+}
+
+/* -----------------------------------------------------------------------------
+ * the colour-part of a rotation can't do better than its scatter off the
+ * principal axis, the separated channel is fitted alone (with own indices)
+ * the moments need to be of a set with all four channels (not separate alpha)
+ */
+void PaletteMoments::EstimateRotations(int flags, int first, int last, PaletteRotations &rotations) const
+{
+#ifdef FEATURE_METRIC_ROOTED
+  const Vec4 onehalf(sqrtf(0.5f));
+#else
+  const Vec4 onehalf(0.5f);
+#endif
+
+  // the same channel-weights the fits will use
+  Vec4 metric = g_metric[(flags & kColourMetrics) >> 4];
+  if (!m_transparent)
+    metric = KillW(metric);
+  else
+    metric = metric * onehalf;
+
+  float const m[4] = { metric.X(), metric.Y(), metric.Z(), metric.W() };
+
+  // moments of the whole block
+  Moments4 total;
+  Accumulate(total, 0xFFFF, (flags & kWeightColourByAlpha) != 0);
+
+  // centered scatter, weighted by the metric
+  float c[4][4] = {{0.0f}};
+  if (total.w.X() > 1.0f) {
+    static const int sym[4][4] = {{0,1,2,3},{1,4,5,6},{2,5,7,8},{3,6,8,9}};
+
+    Sym4x4 scatter;
+    Vec4 centroid;
+
+    ComputeWeightedCovariance4(scatter, centroid, total, Vec4(1.0f));
+    for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 4; ++j)
+      c[i][j] = scatter[sym[i][j]] * m[i] * m[j];
+  }
+
+  // the colour-parts of all (at most four) rotations, one per lane
+  float colours[6][4] = {{0.0f}};
+
+  assert(last - first < 4);
+  for (int r = first; r <= last; ++r) {
+    // rotation 0 separates alpha, rotation 1-3 swap red/green/blue with it
+    int const sep = (r == 0 ? 3 : r - 1);
+    int const a = (sep == 0 ? 1 : 0);
+    int const b = (sep <= 1 ? 2 : 1);
+    int const d = (sep <= 2 ? 3 : 2);
+
+    colours[0][r - first] = c[a][a]; colours[1][r - first] = c[a][b]; colours[2][r - first] = c[a][d];
+    colours[3][r - first] = c[b][b]; colours[4][r - first] = c[b][d]; colours[5][r - first] = c[d][d];
+  }
+
+  Sym3x3x4 colour;
+  Vec4 axis[3];
+  for (int i = 0; i < 6; ++i)
+    colour[i] = Vec4(colours[i][0], colours[i][1], colours[i][2], colours[i][3]);
+
+  Vec4 const lambdas = EstimatePrincipleComponents(colour, axis, 8);
+
+  for (int r = first; r <= last; ++r) {
+    int const sep = (r == 0 ? 3 : r - 1);
+    int const a = (sep == 0 ? 1 : 0);
+    int const b = (sep <= 1 ? 2 : 1);
+    int const d = (sep <= 2 ? 3 : 2);
+
+    float const lambda = lambdas.GetO(r - first);
+    float const residual = std::max(0.0f, c[a][a] + c[b][b] + c[d][d] - lambda);
+    float const spread = c[sep][sep];
+
+    // the eigenvalue is estimated from below, keep a margin
+    rotations.bound[r] = Scr4(residual * 0.75f);
+
+    // more index-bits for the part with the clearly larger spread along its axis
+    rotations.selection[r] = (lambda > spread * 4.0f) ? 1 : (spread > lambda * 4.0f) ? 0 : -1;
+
+    // insertion-sort by estimated error, ties keep the rotation-order
+    int k = r - first;
+    while ((k > 0) && (rotations.bound[r] < rotations.bound[rotations.ranking[k - 1]])) {
+      rotations.ranking[k] = rotations.ranking[k - 1];
+      k--;
+    }
+
+    rotations.ranking[k] = r;
+  }
+}
+
 void PaletteSet::RemapIndices(u8 const* source, u8* target, int set) const
 {
   const int s = set; {
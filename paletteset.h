@@ -35,10 +35,14 @@ namespace squish {
 
 // -----------------------------------------------------------------------------
 #if	!defined(SQUISH_USE_PRE)
+class PaletteMoments;
+
 /*! @brief Represents a set of block palettes
 */
 class PaletteSet
 {
+  friend class PaletteMoments;
+
 public:
   static void GetMasks(int flags, int partition, int (&masks)[4]);
 
@@ -63,6 +67,11 @@ public:
   PaletteSet() {};
   PaletteSet(PaletteSet const &palette) { memcpy(this, &palette, sizeof(*this)); };
   PaletteSet(PaletteSet const &palette, int mask, int flags, int part_or_rot);
+  PaletteSet(PaletteSet const &palette, PaletteMoments const &moments, int mask, int flags, int part_or_rot);
+
+  // rebuild a permutation in place, for reusing the same workspace
+  void Permute(PaletteSet const &palette, int mask, int flags, int part_or_rot);
+  void Permute(PaletteSet const &palette, PaletteMoments const &moments, int mask, int flags, int part_or_rot);
 
 private:
   void BuildSet(u8  const* rgba, int mask, int flags);
@@ -70,6 +79,7 @@ private:
   void BuildSet(f23 const* rgba, int mask, int flags);
   void BuildSet(PaletteSet const &palette, int mask, int flags);
   void PermuteSet(PaletteSet const &palette, int mask, int flags);
+  void CopySet(PaletteSet const &palette);
 
 public:
   // active attributes based on the parameters passed on initialization
@@ -97,6 +107,9 @@ public:
       (m_numsets > 1 ? m_count[1] <= 1 : 1) /*(m_seperatealpha ? m_count[m_numsets + 1] <= 1 : 1)*/ &
       (m_numsets > 2 ? m_count[2] <= 1 : 1) /*(m_seperatealpha ? m_count[m_numsets + 2] <= 1 : 1)*/; }
 
+  // sum up the moments of a set from the block's per-pixel moments (if available)
+  bool GetMoments(int idx, Moments4 &moments) const;
+
   // map from the set to indices and back to colours
   void RemapIndices(u8 const* source, u8* target, int set) const;
   void UnmapIndices(u8 const* source, u8* rgba, int set, unsigned int *codes, int cmask) const;
@@ -116,6 +129,9 @@ private:
   Vec4  m_points[4][16];
   Scr4  m_weights[4][16];
   char  m_remap[4][16];
+
+  PaletteMoments const *m_moments;
+  bool  m_momentweights;
   
 #ifdef	FEATURE_TEST_LINES
   /* --------------------------------------------------------------------------- */
@@ -145,6 +161,41 @@ private:
   int   m_grey[4];
 #endif
 };
+
+/*! @brief The estimated merit of the component rotations of a block
+*/
+struct PaletteRotations
+{
+  int  ranking[4];	// the rotations ordered by estimated error (best first)
+  Scr4 bound[4];	// the estimated least error of the colour-part of a rotation
+  int  selection[4];	// the suggested index-selection, -1 if undecided
+};
+
+/*! @brief Per-pixel moments of a block, shared by all partitions
+
+  The moments are computed once from the unpermuted set and can be summed
+  up for any pixel-mask, which gives the statistics of each partition's
+  sets without visiting the points again.
+*/
+class PaletteMoments
+{
+public:
+  PaletteMoments(PaletteSet const &palette);
+
+  // sum up the moments of the pixels in the mask
+  void Accumulate(Moments4 &moments, int mask, bool weighted) const;
+
+  // order the partitions by their estimated error (best first)
+  void RankPartitions(int flags, int partitions, int (&ranking)[64]) const;
+
+  // order the separate-alpha rotations by their estimated error (best first)
+  void EstimateRotations(int flags, int first, int last, PaletteRotations &rotations) const;
+
+private:
+  bool      m_transparent;
+  int       m_used;
+  Moments4  m_pixels[2][16];
+};
 #endif
 
 // -----------------------------------------------------------------------------
@@ -35,29 +35,30 @@ namespace squish {
 /* *****************************************************************************
  */
 #if	!defined(SQUISH_USE_PRE)
-struct SP_SourceBlock
-{
-  u8 start;
-  u8 end;
-  u8 error;
-};
-
+// start/end/error are separate planes per entry, the error scan over
+// the codebook indices runs over contiguous bytes
 struct PaletteSingleLookup2
 {
-  SP_SourceBlock sources[2];
+  u8 start[2];
+  u8 end[2];
+  u8 error[2];
 };
 
 struct PaletteSingleLookup4
 {
-  SP_SourceBlock sources[4];
+  u8 start[4];
+  u8 end[4];
+  u8 error[4];
 };
 
 struct PaletteSingleLookup8
 {
-  SP_SourceBlock sources[8];
+  u8 start[8];
+  u8 end[8];
+  u8 error[8];
 };
 
-#define	SCL_ITERATIVE
+#define	SPL_ITERATIVE
 #include "palettesinglelookup.inl"
 
 PaletteSingleFit::PaletteSingleFit(PaletteSet const* palette, int flags, int swap, int shared)
@@ -191,25 +192,21 @@ Scr4 PaletteSingleFit::ComputeEndPoints(int set, Vec4 const &metric, PaletteSing
   assert(m_entry[set][3] == (u8)FloatToInt<true,false>(255.0f * values->W(), 255));
    */
 
+  // grab the entries of all channels once, skip those which are
+  // completely irrelevant what's in them
+  PaletteSingleLookup2 const* entries[4] = {NULL};
+  for (int channel = 0, cmask = mask; channel < 4; ++channel, cmask >>= 1) {
+    if (cmask & 1)
+      entries[channel] = lookups[channel] + m_entry[set][channel];
+  }
+
   for (int index = 0; index < 2; ++index) {
-    // check the error for this codebook index
-    SP_SourceBlock const* sources[4] = {NULL};
-    Vec4 cerror(0.0f);
-    
-    for (int channel = 0, cmask = mask; channel < 4; ++channel, cmask >>= 1) {
-      // skip if it's completely irrelevant what's in a specific channel
-      if (cmask & 1) {
-	// grab the lookup table and index for this channel
-	PaletteSingleLookup2 const* lookup = lookups[channel];
-	int target = m_entry[set][channel];
-
-	// store a pointer to the source for this channel
-	sources[channel] = lookup[target].sources + index;
-
-	// accumulate the error
-	cerror.GetO(channel) = eLUT[sources[channel]->error];
-      }
-    }
+    // gather the error of this codebook index for all channels at once
+    Vec4 cerror = Vec4(
+      entries[0] ? eLUT[entries[0]->error[index]] : 0.0f,
+      entries[1] ? eLUT[entries[1]->error[index]] : 0.0f,
+      entries[2] ? eLUT[entries[2]->error[index]] : 0.0f,
+      entries[3] ? eLUT[entries[3]->error[index]] : 0.0f);
 
     // calculate the error
     Scr4 error = LengthSquared(metric * cerror);
@@ -220,15 +217,15 @@ Scr4 PaletteSingleFit::ComputeEndPoints(int set, Vec4 const &metric, PaletteSing
       besterror = error;
 
       Col4 s = Col4(
-	sources[0] ? sources[0]->start : 0x00,
-	sources[1] ? sources[1]->start : 0x00,
-	sources[2] ? sources[2]->start : 0x00,
-	sources[3] ? sources[3]->start : 0xFF);
+	entries[0] ? entries[0]->start[index] : 0x00,
+	entries[1] ? entries[1]->start[index] : 0x00,
+	entries[2] ? entries[2]->start[index] : 0x00,
+	entries[3] ? entries[3]->start[index] : 0xFF);
       Col4 e = Col4(
-	sources[0] ? sources[0]->end   : 0x00,
-	sources[1] ? sources[1]->end   : 0x00,
-	sources[2] ? sources[2]->end   : 0x00,
-	sources[3] ? sources[3]->end   : 0xFF);
+	entries[0] ? entries[0]->end[index]   : 0x00,
+	entries[1] ? entries[1]->end[index]   : 0x00,
+	entries[2] ? entries[2]->end[index]   : 0x00,
+	entries[3] ? entries[3]->end[index]   : 0xFF);
 
       m_start[set] = Vec4(s) * (1.0f / 255.0f);
       m_end  [set] = Vec4(e) * (1.0f / 255.0f);
@@ -264,25 +261,21 @@ Scr4 PaletteSingleFit::ComputeEndPoints(int set, Vec4 const &metric, PaletteSing
   assert(m_entry[set][3] == (u8)FloatToInt<true,false>(255.0f * values->W(), 255));
    */
 
+  // grab the entries of all channels once, skip those which are
+  // completely irrelevant what's in them
+  PaletteSingleLookup4 const* entries[4] = {NULL};
+  for (int channel = 0, cmask = mask; channel < 4; ++channel, cmask >>= 1) {
+    if (cmask & 1)
+      entries[channel] = lookups[channel] + m_entry[set][channel];
+  }
+
   for (int index = 0; index < 4; ++index) {
-    // check the error for this codebook index
-    SP_SourceBlock const* sources[4] = {NULL};
-    Vec4 cerror(0.0f);
-    
-    for (int channel = 0, cmask = mask; channel < 4; ++channel, cmask >>= 1) {
-      // skip if it's completely irrelevant what's in a specific channel
-      if (cmask & 1) {
-	// grab the lookup table and index for this channel
-	PaletteSingleLookup4 const* lookup = lookups[channel];
-	int target = m_entry[set][channel];
-
-	// store a pointer to the source for this channel
-	sources[channel] = lookup[target].sources + index;
-
-	// accumulate the error
-	cerror.GetO(channel) = eLUT[sources[channel]->error];
-      }
-    }
+    // gather the error of this codebook index for all channels at once
+    Vec4 cerror = Vec4(
+      entries[0] ? eLUT[entries[0]->error[index]] : 0.0f,
+      entries[1] ? eLUT[entries[1]->error[index]] : 0.0f,
+      entries[2] ? eLUT[entries[2]->error[index]] : 0.0f,
+      entries[3] ? eLUT[entries[3]->error[index]] : 0.0f);
 
     // calculate the error
     Scr4 error = LengthSquared(metric * cerror);
@@ -292,15 +285,15 @@ Scr4 PaletteSingleFit::ComputeEndPoints(int set, Vec4 const &metric, PaletteSing
       besterror = error;
 
       Col4 s = Col4(
-	sources[0] ? sources[0]->start : 0x00,
-	sources[1] ? sources[1]->start : 0x00,
-	sources[2] ? sources[2]->start : 0x00,
-	sources[3] ? sources[3]->start : 0xFF);
+	entries[0] ? entries[0]->start[index] : 0x00,
+	entries[1] ? entries[1]->start[index] : 0x00,
+	entries[2] ? entries[2]->start[index] : 0x00,
+	entries[3] ? entries[3]->start[index] : 0xFF);
       Col4 e = Col4(
-	sources[0] ? sources[0]->end   : 0x00,
-	sources[1] ? sources[1]->end   : 0x00,
-	sources[2] ? sources[2]->end   : 0x00,
-	sources[3] ? sources[3]->end   : 0xFF);
+	entries[0] ? entries[0]->end[index]   : 0x00,
+	entries[1] ? entries[1]->end[index]   : 0x00,
+	entries[2] ? entries[2]->end[index]   : 0x00,
+	entries[3] ? entries[3]->end[index]   : 0xFF);
 
       m_start[set] = Vec4(s) * (1.0f / 255.0f);
       m_end  [set] = Vec4(e) * (1.0f / 255.0f);
@@ -336,25 +329,21 @@ Scr4 PaletteSingleFit::ComputeEndPoints(int set, Vec4 const &metric, PaletteSing
   assert(m_entry[set][3] == (u8)FloatToInt<true,false>(255.0f * values->W(), 255));
   */ 
 
+  // grab the entries of all channels once, skip those which are
+  // completely irrelevant what's in them
+  PaletteSingleLookup8 const* entries[4] = {NULL};
+  for (int channel = 0, cmask = mask; channel < 4; ++channel, cmask >>= 1) {
+    if (cmask & 1)
+      entries[channel] = lookups[channel] + m_entry[set][channel];
+  }
+
   for (int index = 0; index < 8; ++index) {
-    // check the error for this codebook index
-    SP_SourceBlock const* sources[4] = {NULL};
-    Vec4 cerror(0.0f);
-
-    for (int channel = 0, cmask = mask; channel < 4; ++channel, cmask >>= 1) {
-      // skip if it's completely irrelevant what's in a specific channel
-      if (cmask & 1) {
-	// grab the lookup table and index for this channel
-	PaletteSingleLookup8 const* lookup = lookups[channel];
-	int target = m_entry[set][channel];
-
-	// store a pointer to the source for this channel
-	sources[channel] = lookup[target].sources + index;
-
-	// accumulate the error
-	cerror.GetO(channel) = eLUT[sources[channel]->error];
-      }
-    }
+    // gather the error of this codebook index for all channels at once
+    Vec4 cerror = Vec4(
+      entries[0] ? eLUT[entries[0]->error[index]] : 0.0f,
+      entries[1] ? eLUT[entries[1]->error[index]] : 0.0f,
+      entries[2] ? eLUT[entries[2]->error[index]] : 0.0f,
+      entries[3] ? eLUT[entries[3]->error[index]] : 0.0f);
 
     // calculate the error
     Scr4 error = LengthSquared(metric * cerror);
@@ -364,15 +353,15 @@ Scr4 PaletteSingleFit::ComputeEndPoints(int set, Vec4 const &metric, PaletteSing
       besterror = error;
 
       Col4 s = Col4(
-	sources[0] ? sources[0]->start : 0x00,
-	sources[1] ? sources[1]->start : 0x00,
-	sources[2] ? sources[2]->start : 0x00,
-	sources[3] ? sources[3]->start : 0xFF);
+	entries[0] ? entries[0]->start[index] : 0x00,
+	entries[1] ? entries[1]->start[index] : 0x00,
+	entries[2] ? entries[2]->start[index] : 0x00,
+	entries[3] ? entries[3]->start[index] : 0xFF);
       Col4 e = Col4(
-	sources[0] ? sources[0]->end   : 0x00,
-	sources[1] ? sources[1]->end   : 0x00,
-	sources[2] ? sources[2]->end   : 0x00,
-	sources[3] ? sources[3]->end   : 0xFF);
+	entries[0] ? entries[0]->end[index]   : 0x00,
+	entries[1] ? entries[1]->end[index]   : 0x00,
+	entries[2] ? entries[2]->end[index]   : 0x00,
+	entries[3] ? entries[3]->end[index]   : 0xFF);
 
       m_start[set] = Vec4(s) * (1.0f / 255.0f);
       m_end  [set] = Vec4(e) * (1.0f / 255.0f);
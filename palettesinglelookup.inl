@@ -2,818 +2,818 @@
 /* 256 * 2 * 3 * 1 = 1536 */
 static PaletteSingleLookup2 const sp_lookup_5_4[256] =
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  0,  0,1},{  0,  0,1}}},  {{/*1*/{  0,  0,2},{  0,  8,0}}},  {{/*1*/{  0,  0,3},{  0,  8,1}}},
-  {{/*1*/{  0,  0,4},{  0, 16,1}}},  {{/*1*/{  8,  8,3},{  0, 16,0}}},  {{/*1*/{  8,  8,2},{  0, 16,1}}},  {{/*1*/{  8,  8,1},{  0, 24,0}}},
-  {{/*1*/{  8,  8,0},{  8,  8,0}}},  {{/*1*/{  8,  8,1},{  0, 33,1}}},  {{/*1*/{  8,  8,2},{  0, 33,0}}},  {{/*1*/{  8,  8,3},{  0, 33,1}}},
-  {{/*1*/{  8,  8,4},{  0, 41,1}}},  {{/*1*/{ 16, 16,3},{  0, 41,0}}},  {{/*1*/{ 16, 16,2},{  0, 41,1}}},  {{/*1*/{ 16, 16,1},{  0, 49,1}}},
-  {{/*1*/{ 16, 16,0},{  0, 49,0}}},  {{/*1*/{ 16, 16,1},{  0, 49,1}}},  {{/*1*/{ 16, 16,2},{  0, 57,0}}},  {{/*1*/{ 16, 16,3},{  0, 57,1}}},
-  {{/*1*/{ 16, 16,4},{  0, 66,1}}},  {{/*1*/{ 24, 24,3},{  0, 66,0}}},  {{/*1*/{ 24, 24,2},{ 33,  0,0}}},  {{/*1*/{ 24, 24,1},{  0, 74,1}}},
-  {{/*1*/{ 24, 24,0},{  0, 74,0}}},  {{/*1*/{ 24, 24,1},{  0, 74,1}}},  {{/*1*/{ 24, 24,2},{  0, 82,0}}},  {{/*1*/{ 24, 24,3},{  8, 66,0}}},
-  {{/*1*/{ 24, 24,4},{  0, 90,1}}},  {{/*1*/{ 33, 33,4},{  0, 90,0}}},  {{/*1*/{ 33, 33,3},{ 33, 24,0}}},  {{/*1*/{ 33, 33,2},{  0, 99,1}}},
-  {{/*1*/{ 33, 33,1},{  0, 99,0}}},  {{/*1*/{ 33, 33,0},{ 33, 33,0}}},  {{/*1*/{ 33, 33,1},{  8, 90,0}}},  {{/*1*/{ 33, 33,2},{  0,107,0}}},
-  {{/*1*/{ 33, 33,3},{  0,107,1}}},  {{/*1*/{ 33, 33,4},{  0,115,0}}},  {{/*1*/{ 41, 41,3},{ 33, 49,0}}},  {{/*1*/{ 41, 41,2},{  0,123,1}}},
-  {{/*1*/{ 41, 41,1},{  0,123,0}}},  {{/*1*/{ 41, 41,0},{ 41, 41,0}}},  {{/*1*/{ 41, 41,1},{  0,132,1}}},  {{/*1*/{ 41, 41,2},{  0,132,0}}},
-  {{/*1*/{ 41, 41,3},{ 66,  0,0}}},  {{/*1*/{ 41, 41,4},{  0,140,0}}},  {{/*1*/{ 49, 49,3},{ 33, 74,0}}},  {{/*1*/{ 49, 49,2},{  0,148,1}}},
-  {{/*1*/{ 49, 49,1},{  0,148,0}}},  {{/*1*/{ 49, 49,0},{ 33, 82,0}}},  {{/*1*/{ 49, 49,1},{  0,156,1}}},  {{/*1*/{ 49, 49,2},{  0,156,0}}},
-  {{/*1*/{ 49, 49,3},{ 66, 24,0}}},  {{/*1*/{ 49, 49,4},{  8,148,0}}},  {{/*1*/{ 57, 57,3},{  0,165,0}}},  {{/*1*/{ 57, 57,2},{ 66, 33,0}}},
-  {{/*1*/{ 57, 57,1},{  0,173,0}}},  {{/*1*/{ 57, 57,0},{ 33,107,0}}},  {{/*1*/{ 57, 57,1},{  0,181,1}}},  {{/*1*/{ 57, 57,2},{  0,181,0}}},
-  {{/*1*/{ 57, 57,3},{ 41, 99,0}}},  {{/*1*/{ 57, 57,4},{ 16,156,0}}},  {{/*1*/{ 66, 66,4},{  0,189,0}}},  {{/*1*/{ 66, 66,3},{ 66, 57,0}}},
-  {{/*1*/{ 66, 66,2},{  0,198,0}}},  {{/*1*/{ 66, 66,1},{ 33,132,0}}},  {{/*1*/{ 66, 66,0},{ 66, 66,0}}},  {{/*1*/{ 66, 66,1},{  0,206,0}}},
-  {{/*1*/{ 66, 66,2},{ 33,140,0}}},  {{/*1*/{ 66, 66,3},{ 99,  8,0}}},  {{/*1*/{ 66, 66,4},{  0,214,0}}},  {{/*1*/{ 74, 74,3},{ 66, 82,0}}},
-  {{/*1*/{ 74, 74,2},{  0,222,0}}},  {{/*1*/{ 74, 74,1},{ 33,156,0}}},  {{/*1*/{ 74, 74,0},{ 74, 74,0}}},  {{/*1*/{ 74, 74,1},{  0,231,0}}},
-  {{/*1*/{ 74, 74,2},{ 33,165,0}}},  {{/*1*/{ 74, 74,3},{ 99, 33,0}}},  {{/*1*/{ 74, 74,4},{  0,239,0}}},  {{/*1*/{ 82, 82,3},{ 66,107,0}}},
-  {{/*1*/{ 82, 82,2},{ 16,214,0}}},  {{/*1*/{ 82, 82,1},{  0,247,0}}},  {{/*1*/{ 82, 82,0},{ 66,115,0}}},  {{/*1*/{ 82, 82,1},{  0,255,0}}},
-  {{/*1*/{ 82, 82,2},{ 33,189,0}}},  {{/*1*/{ 82, 82,3},{ 99, 57,0}}},  {{/*1*/{ 82, 82,4},{  8,247,0}}},  {{/*1*/{ 90, 90,3},{ 33,198,0}}},
-  {{/*1*/{ 90, 90,2},{ 24,222,0}}},  {{/*1*/{ 90, 90,1},{  8,255,0}}},  {{/*1*/{ 90, 90,0},{ 66,140,0}}},  {{/*1*/{ 90, 90,1},{ 16,247,0}}},
-  {{/*1*/{ 90, 90,2},{ 33,214,0}}},  {{/*1*/{ 90, 90,3},{ 74,132,0}}},  {{/*1*/{ 90, 90,4},{ 16,255,0}}},  {{/*1*/{ 99, 99,4},{ 33,222,0}}},
-  {{/*1*/{ 99, 99,3},{ 99, 90,0}}},  {{/*1*/{ 99, 99,2},{ 24,247,0}}},  {{/*1*/{ 99, 99,1},{ 66,165,0}}},  {{/*1*/{ 99, 99,0},{ 24,255,0}}},
-  {{/*1*/{ 99, 99,1},{ 33,239,0}}},  {{/*1*/{ 99, 99,2},{ 66,173,0}}},  {{/*1*/{ 99, 99,3},{132, 41,0}}},  {{/*1*/{ 99, 99,4},{ 33,247,0}}},
-  {{/*1*/{107,107,3},{ 99,115,0}}},  {{/*1*/{107,107,2},{ 33,255,0}}},  {{/*1*/{107,107,1},{ 66,189,0}}},  {{/*1*/{107,107,0},{107,107,0}}},
-  {{/*1*/{107,107,1},{ 41,247,0}}},  {{/*1*/{107,107,2},{ 66,198,0}}},  {{/*1*/{107,107,3},{132, 66,0}}},  {{/*1*/{107,107,4},{ 41,255,0}}},
-  {{/*1*/{115,115,3},{ 99,140,0}}},  {{/*1*/{115,115,2},{ 49,247,0}}},  {{/*1*/{115,115,1},{ 57,231,0}}},  {{/*1*/{115,115,0},{ 99,148,0}}},
-  {{/*1*/{115,115,1},{ 49,255,0}}},  {{/*1*/{115,115,2},{ 66,222,0}}},  {{/*1*/{115,115,3},{132, 90,0}}},  {{/*1*/{115,115,4},{ 57,247,0}}},
-  {{/*1*/{123,123,3},{ 66,231,0}}},  {{/*1*/{123,123,2},{ 57,255,0}}},  {{/*1*/{123,123,1},{ 66,239,0}}},  {{/*1*/{123,123,0},{ 99,173,0}}},
-  {{/*1*/{123,123,1},{165, 41,0}}},  {{/*1*/{123,123,2},{ 66,247,0}}},  {{/*1*/{123,123,3},{107,165,0}}},  {{/*1*/{123,123,4},{ 82,222,0}}},
-  {{/*1*/{132,132,4},{ 66,255,0}}},  {{/*1*/{132,132,3},{132,123,0}}},  {{/*1*/{132,132,2},{ 74,247,0}}},  {{/*1*/{132,132,1},{ 99,198,0}}},
-  {{/*1*/{132,132,0},{132,132,0}}},  {{/*1*/{132,132,1},{ 74,255,0}}},  {{/*1*/{132,132,2},{ 99,206,0}}},  {{/*1*/{132,132,3},{165, 74,0}}},
-  {{/*1*/{132,132,4},{ 82,247,0}}},  {{/*1*/{140,140,3},{132,148,0}}},  {{/*1*/{140,140,2},{ 82,255,0}}},  {{/*1*/{140,140,1},{ 99,222,0}}},
-  {{/*1*/{140,140,0},{140,140,0}}},  {{/*1*/{140,140,1},{ 90,247,0}}},  {{/*1*/{140,140,2},{ 99,231,0}}},  {{/*1*/{140,140,3},{165, 99,0}}},
-  {{/*1*/{140,140,4},{ 90,255,0}}},  {{/*1*/{148,148,3},{132,173,0}}},  {{/*1*/{148,148,2},{198, 41,0}}},  {{/*1*/{148,148,1},{ 99,247,0}}},
-  {{/*1*/{148,148,0},{132,181,0}}},  {{/*1*/{148,148,1},{198, 49,0}}},  {{/*1*/{148,148,2},{ 99,255,0}}},  {{/*1*/{148,148,3},{165,123,0}}},
-  {{/*1*/{148,148,4},{107,247,0}}},  {{/*1*/{156,156,3},{115,231,0}}},  {{/*1*/{156,156,2},{165,132,0}}},  {{/*1*/{156,156,1},{107,255,0}}},
-  {{/*1*/{156,156,0},{132,206,0}}},  {{/*1*/{156,156,1},{198, 74,0}}},  {{/*1*/{156,156,2},{115,247,0}}},  {{/*1*/{156,156,3},{140,198,0}}},
-  {{/*1*/{156,156,4},{115,255,0}}},  {{/*1*/{165,165,4},{123,239,0}}},  {{/*1*/{165,165,3},{165,156,0}}},  {{/*1*/{165,165,2},{123,247,0}}},
-  {{/*1*/{165,165,1},{132,231,0}}},  {{/*1*/{165,165,0},{165,165,0}}},  {{/*1*/{165,165,1},{123,255,0}}},  {{/*1*/{165,165,2},{132,239,0}}},
-  {{/*1*/{165,165,3},{198,107,0}}},  {{/*1*/{165,165,4},{132,247,0}}},  {{/*1*/{173,173,3},{165,181,0}}},  {{/*1*/{173,173,2},{231, 49,0}}},
-  {{/*1*/{173,173,1},{132,255,0}}},  {{/*1*/{173,173,0},{173,173,0}}},  {{/*1*/{173,173,1},{239, 41,0}}},  {{/*1*/{173,173,2},{140,247,0}}},
-  {{/*1*/{173,173,3},{198,132,0}}},  {{/*1*/{173,173,4},{140,255,0}}},  {{/*1*/{181,181,3},{165,206,0}}},  {{/*1*/{181,181,2},{231, 74,0}}},
-  {{/*1*/{181,181,1},{148,247,0}}},  {{/*1*/{181,181,0},{165,214,0}}},  {{/*1*/{181,181,1},{231, 82,0}}},  {{/*1*/{181,181,2},{148,255,0}}},
-  {{/*1*/{181,181,3},{198,156,0}}},  {{/*1*/{181,181,4},{156,247,0}}},  {{/*1*/{189,189,3},{165,231,0}}},  {{/*1*/{189,189,2},{198,165,0}}},
-  {{/*1*/{189,189,1},{156,255,0}}},  {{/*1*/{189,189,0},{165,239,0}}},  {{/*1*/{189,189,1},{231,107,0}}},  {{/*1*/{189,189,2},{165,247,0}}},
-  {{/*1*/{189,189,3},{173,231,0}}},  {{/*1*/{189,189,4},{239, 99,0}}},  {{/*1*/{198,198,4},{165,255,0}}},  {{/*1*/{198,198,3},{198,189,0}}},
-  {{/*1*/{198,198,2},{173,247,1}}},  {{/*1*/{198,198,1},{173,247,0}}},  {{/*1*/{198,198,0},{198,198,0}}},  {{/*1*/{198,198,1},{173,255,0}}},
-  {{/*1*/{198,198,2},{181,239,0}}},  {{/*1*/{198,198,3},{231,140,0}}},  {{/*1*/{198,198,4},{181,247,0}}},  {{/*1*/{206,206,3},{198,214,0}}},
-  {{/*1*/{206,206,2},{181,255,1}}},  {{/*1*/{206,206,1},{181,255,0}}},  {{/*1*/{206,206,0},{206,206,0}}},  {{/*1*/{206,206,1},{189,247,1}}},
-  {{/*1*/{206,206,2},{189,247,0}}},  {{/*1*/{206,206,3},{231,165,0}}},  {{/*1*/{206,206,4},{189,255,0}}},  {{/*1*/{214,214,3},{198,239,0}}},
-  {{/*1*/{214,214,2},{198,239,1}}},  {{/*1*/{214,214,1},{198,247,1}}},  {{/*1*/{214,214,0},{198,247,0}}},  {{/*1*/{214,214,1},{198,247,1}}},
-  {{/*1*/{214,214,2},{198,255,0}}},  {{/*1*/{214,214,3},{231,189,0}}},  {{/*1*/{214,214,4},{206,247,1}}},  {{/*1*/{222,222,3},{206,247,0}}},
-  {{/*1*/{222,222,2},{231,198,0}}},  {{/*1*/{222,222,1},{206,255,1}}},  {{/*1*/{222,222,0},{206,255,0}}},  {{/*1*/{222,222,1},{206,255,1}}},
-  {{/*1*/{222,222,2},{214,247,0}}},  {{/*1*/{222,222,3},{231,214,0}}},  {{/*1*/{222,222,4},{214,255,1}}},  {{/*1*/{231,231,4},{214,255,0}}},
-  {{/*1*/{231,231,3},{231,222,0}}},  {{/*1*/{231,231,2},{222,247,1}}},  {{/*1*/{231,231,1},{222,247,0}}},  {{/*1*/{231,231,0},{231,231,0}}},
-  {{/*1*/{231,231,1},{222,255,0}}},  {{/*1*/{231,231,2},{231,239,0}}},  {{/*1*/{231,231,3},{231,239,1}}},  {{/*1*/{231,231,4},{231,247,1}}},
-  {{/*1*/{239,239,3},{231,247,0}}},  {{/*1*/{239,239,2},{231,247,1}}},  {{/*1*/{239,239,1},{231,255,0}}},  {{/*1*/{239,239,0},{239,239,0}}},
-  {{/*1*/{239,239,1},{239,239,1}}},  {{/*1*/{239,239,2},{239,247,0}}},  {{/*1*/{239,239,3},{239,247,1}}},  {{/*1*/{239,239,4},{239,255,1}}},
-  {{/*1*/{247,247,3},{239,255,0}}},  {{/*1*/{247,247,2},{239,255,1}}},  {{/*1*/{247,247,1},{247,247,1}}},  {{/*1*/{247,247,0},{247,247,0}}},
-  {{/*1*/{247,247,1},{247,247,1}}},  {{/*1*/{247,247,2},{247,255,0}}},  {{/*1*/{247,247,3},{247,255,1}}},  {{/*1*/{247,247,4},{255,247,1}}},
-  {{/*1*/{255,255,3},{255,247,0}}},  {{/*1*/{255,255,2},{255,247,1}}},  {{/*1*/{255,255,1},{255,255,1}}},  {{/*1*/{255,255,0},{255,255,0}}}
+  {/*1*/{  0,  0},{  0,  0},{0,0}},  {/*1*/{  0,  0},{  0,  0},{1,1}},  {/*1*/{  0,  0},{  0,  8},{2,0}},  {/*1*/{  0,  0},{  0,  8},{3,1}},
+  {/*1*/{  0,  0},{  0, 16},{4,1}},  {/*1*/{  8,  0},{  8, 16},{3,0}},  {/*1*/{  8,  0},{  8, 16},{2,1}},  {/*1*/{  8,  0},{  8, 24},{1,0}},
+  {/*1*/{  8,  8},{  8,  8},{0,0}},  {/*1*/{  8,  0},{  8, 33},{1,1}},  {/*1*/{  8,  0},{  8, 33},{2,0}},  {/*1*/{  8,  0},{  8, 33},{3,1}},
+  {/*1*/{  8,  0},{  8, 41},{4,1}},  {/*1*/{ 16,  0},{ 16, 41},{3,0}},  {/*1*/{ 16,  0},{ 16, 41},{2,1}},  {/*1*/{ 16,  0},{ 16, 49},{1,1}},
+  {/*1*/{ 16,  0},{ 16, 49},{0,0}},  {/*1*/{ 16,  0},{ 16, 49},{1,1}},  {/*1*/{ 16,  0},{ 16, 57},{2,0}},  {/*1*/{ 16,  0},{ 16, 57},{3,1}},
+  {/*1*/{ 16,  0},{ 16, 66},{4,1}},  {/*1*/{ 24,  0},{ 24, 66},{3,0}},  {/*1*/{ 24, 33},{ 24,  0},{2,0}},  {/*1*/{ 24,  0},{ 24, 74},{1,1}},
+  {/*1*/{ 24,  0},{ 24, 74},{0,0}},  {/*1*/{ 24,  0},{ 24, 74},{1,1}},  {/*1*/{ 24,  0},{ 24, 82},{2,0}},  {/*1*/{ 24,  8},{ 24, 66},{3,0}},
+  {/*1*/{ 24,  0},{ 24, 90},{4,1}},  {/*1*/{ 33,  0},{ 33, 90},{4,0}},  {/*1*/{ 33, 33},{ 33, 24},{3,0}},  {/*1*/{ 33,  0},{ 33, 99},{2,1}},
+  {/*1*/{ 33,  0},{ 33, 99},{1,0}},  {/*1*/{ 33, 33},{ 33, 33},{0,0}},  {/*1*/{ 33,  8},{ 33, 90},{1,0}},  {/*1*/{ 33,  0},{ 33,107},{2,0}},
+  {/*1*/{ 33,  0},{ 33,107},{3,1}},  {/*1*/{ 33,  0},{ 33,115},{4,0}},  {/*1*/{ 41, 33},{ 41, 49},{3,0}},  {/*1*/{ 41,  0},{ 41,123},{2,1}},
+  {/*1*/{ 41,  0},{ 41,123},{1,0}},  {/*1*/{ 41, 41},{ 41, 41},{0,0}},  {/*1*/{ 41,  0},{ 41,132},{1,1}},  {/*1*/{ 41,  0},{ 41,132},{2,0}},
+  {/*1*/{ 41, 66},{ 41,  0},{3,0}},  {/*1*/{ 41,  0},{ 41,140},{4,0}},  {/*1*/{ 49, 33},{ 49, 74},{3,0}},  {/*1*/{ 49,  0},{ 49,148},{2,1}},
+  {/*1*/{ 49,  0},{ 49,148},{1,0}},  {/*1*/{ 49, 33},{ 49, 82},{0,0}},  {/*1*/{ 49,  0},{ 49,156},{1,1}},  {/*1*/{ 49,  0},{ 49,156},{2,0}},
+  {/*1*/{ 49, 66},{ 49, 24},{3,0}},  {/*1*/{ 49,  8},{ 49,148},{4,0}},  {/*1*/{ 57,  0},{ 57,165},{3,0}},  {/*1*/{ 57, 66},{ 57, 33},{2,0}},
+  {/*1*/{ 57,  0},{ 57,173},{1,0}},  {/*1*/{ 57, 33},{ 57,107},{0,0}},  {/*1*/{ 57,  0},{ 57,181},{1,1}},  {/*1*/{ 57,  0},{ 57,181},{2,0}},
+  {/*1*/{ 57, 41},{ 57, 99},{3,0}},  {/*1*/{ 57, 16},{ 57,156},{4,0}},  {/*1*/{ 66,  0},{ 66,189},{4,0}},  {/*1*/{ 66, 66},{ 66, 57},{3,0}},
+  {/*1*/{ 66,  0},{ 66,198},{2,0}},  {/*1*/{ 66, 33},{ 66,132},{1,0}},  {/*1*/{ 66, 66},{ 66, 66},{0,0}},  {/*1*/{ 66,  0},{ 66,206},{1,0}},
+  {/*1*/{ 66, 33},{ 66,140},{2,0}},  {/*1*/{ 66, 99},{ 66,  8},{3,0}},  {/*1*/{ 66,  0},{ 66,214},{4,0}},  {/*1*/{ 74, 66},{ 74, 82},{3,0}},
+  {/*1*/{ 74,  0},{ 74,222},{2,0}},  {/*1*/{ 74, 33},{ 74,156},{1,0}},  {/*1*/{ 74, 74},{ 74, 74},{0,0}},  {/*1*/{ 74,  0},{ 74,231},{1,0}},
+  {/*1*/{ 74, 33},{ 74,165},{2,0}},  {/*1*/{ 74, 99},{ 74, 33},{3,0}},  {/*1*/{ 74,  0},{ 74,239},{4,0}},  {/*1*/{ 82, 66},{ 82,107},{3,0}},
+  {/*1*/{ 82, 16},{ 82,214},{2,0}},  {/*1*/{ 82,  0},{ 82,247},{1,0}},  {/*1*/{ 82, 66},{ 82,115},{0,0}},  {/*1*/{ 82,  0},{ 82,255},{1,0}},
+  {/*1*/{ 82, 33},{ 82,189},{2,0}},  {/*1*/{ 82, 99},{ 82, 57},{3,0}},  {/*1*/{ 82,  8},{ 82,247},{4,0}},  {/*1*/{ 90, 33},{ 90,198},{3,0}},
+  {/*1*/{ 90, 24},{ 90,222},{2,0}},  {/*1*/{ 90,  8},{ 90,255},{1,0}},  {/*1*/{ 90, 66},{ 90,140},{0,0}},  {/*1*/{ 90, 16},{ 90,247},{1,0}},
+  {/*1*/{ 90, 33},{ 90,214},{2,0}},  {/*1*/{ 90, 74},{ 90,132},{3,0}},  {/*1*/{ 90, 16},{ 90,255},{4,0}},  {/*1*/{ 99, 33},{ 99,222},{4,0}},
+  {/*1*/{ 99, 99},{ 99, 90},{3,0}},  {/*1*/{ 99, 24},{ 99,247},{2,0}},  {/*1*/{ 99, 66},{ 99,165},{1,0}},  {/*1*/{ 99, 24},{ 99,255},{0,0}},
+  {/*1*/{ 99, 33},{ 99,239},{1,0}},  {/*1*/{ 99, 66},{ 99,173},{2,0}},  {/*1*/{ 99,132},{ 99, 41},{3,0}},  {/*1*/{ 99, 33},{ 99,247},{4,0}},
+  {/*1*/{107, 99},{107,115},{3,0}},  {/*1*/{107, 33},{107,255},{2,0}},  {/*1*/{107, 66},{107,189},{1,0}},  {/*1*/{107,107},{107,107},{0,0}},
+  {/*1*/{107, 41},{107,247},{1,0}},  {/*1*/{107, 66},{107,198},{2,0}},  {/*1*/{107,132},{107, 66},{3,0}},  {/*1*/{107, 41},{107,255},{4,0}},
+  {/*1*/{115, 99},{115,140},{3,0}},  {/*1*/{115, 49},{115,247},{2,0}},  {/*1*/{115, 57},{115,231},{1,0}},  {/*1*/{115, 99},{115,148},{0,0}},
+  {/*1*/{115, 49},{115,255},{1,0}},  {/*1*/{115, 66},{115,222},{2,0}},  {/*1*/{115,132},{115, 90},{3,0}},  {/*1*/{115, 57},{115,247},{4,0}},
+  {/*1*/{123, 66},{123,231},{3,0}},  {/*1*/{123, 57},{123,255},{2,0}},  {/*1*/{123, 66},{123,239},{1,0}},  {/*1*/{123, 99},{123,173},{0,0}},
+  {/*1*/{123,165},{123, 41},{1,0}},  {/*1*/{123, 66},{123,247},{2,0}},  {/*1*/{123,107},{123,165},{3,0}},  {/*1*/{123, 82},{123,222},{4,0}},
+  {/*1*/{132, 66},{132,255},{4,0}},  {/*1*/{132,132},{132,123},{3,0}},  {/*1*/{132, 74},{132,247},{2,0}},  {/*1*/{132, 99},{132,198},{1,0}},
+  {/*1*/{132,132},{132,132},{0,0}},  {/*1*/{132, 74},{132,255},{1,0}},  {/*1*/{132, 99},{132,206},{2,0}},  {/*1*/{132,165},{132, 74},{3,0}},
+  {/*1*/{132, 82},{132,247},{4,0}},  {/*1*/{140,132},{140,148},{3,0}},  {/*1*/{140, 82},{140,255},{2,0}},  {/*1*/{140, 99},{140,222},{1,0}},
+  {/*1*/{140,140},{140,140},{0,0}},  {/*1*/{140, 90},{140,247},{1,0}},  {/*1*/{140, 99},{140,231},{2,0}},  {/*1*/{140,165},{140, 99},{3,0}},
+  {/*1*/{140, 90},{140,255},{4,0}},  {/*1*/{148,132},{148,173},{3,0}},  {/*1*/{148,198},{148, 41},{2,0}},  {/*1*/{148, 99},{148,247},{1,0}},
+  {/*1*/{148,132},{148,181},{0,0}},  {/*1*/{148,198},{148, 49},{1,0}},  {/*1*/{148, 99},{148,255},{2,0}},  {/*1*/{148,165},{148,123},{3,0}},
+  {/*1*/{148,107},{148,247},{4,0}},  {/*1*/{156,115},{156,231},{3,0}},  {/*1*/{156,165},{156,132},{2,0}},  {/*1*/{156,107},{156,255},{1,0}},
+  {/*1*/{156,132},{156,206},{0,0}},  {/*1*/{156,198},{156, 74},{1,0}},  {/*1*/{156,115},{156,247},{2,0}},  {/*1*/{156,140},{156,198},{3,0}},
+  {/*1*/{156,115},{156,255},{4,0}},  {/*1*/{165,123},{165,239},{4,0}},  {/*1*/{165,165},{165,156},{3,0}},  {/*1*/{165,123},{165,247},{2,0}},
+  {/*1*/{165,132},{165,231},{1,0}},  {/*1*/{165,165},{165,165},{0,0}},  {/*1*/{165,123},{165,255},{1,0}},  {/*1*/{165,132},{165,239},{2,0}},
+  {/*1*/{165,198},{165,107},{3,0}},  {/*1*/{165,132},{165,247},{4,0}},  {/*1*/{173,165},{173,181},{3,0}},  {/*1*/{173,231},{173, 49},{2,0}},
+  {/*1*/{173,132},{173,255},{1,0}},  {/*1*/{173,173},{173,173},{0,0}},  {/*1*/{173,239},{173, 41},{1,0}},  {/*1*/{173,140},{173,247},{2,0}},
+  {/*1*/{173,198},{173,132},{3,0}},  {/*1*/{173,140},{173,255},{4,0}},  {/*1*/{181,165},{181,206},{3,0}},  {/*1*/{181,231},{181, 74},{2,0}},
+  {/*1*/{181,148},{181,247},{1,0}},  {/*1*/{181,165},{181,214},{0,0}},  {/*1*/{181,231},{181, 82},{1,0}},  {/*1*/{181,148},{181,255},{2,0}},
+  {/*1*/{181,198},{181,156},{3,0}},  {/*1*/{181,156},{181,247},{4,0}},  {/*1*/{189,165},{189,231},{3,0}},  {/*1*/{189,198},{189,165},{2,0}},
+  {/*1*/{189,156},{189,255},{1,0}},  {/*1*/{189,165},{189,239},{0,0}},  {/*1*/{189,231},{189,107},{1,0}},  {/*1*/{189,165},{189,247},{2,0}},
+  {/*1*/{189,173},{189,231},{3,0}},  {/*1*/{189,239},{189, 99},{4,0}},  {/*1*/{198,165},{198,255},{4,0}},  {/*1*/{198,198},{198,189},{3,0}},
+  {/*1*/{198,173},{198,247},{2,1}},  {/*1*/{198,173},{198,247},{1,0}},  {/*1*/{198,198},{198,198},{0,0}},  {/*1*/{198,173},{198,255},{1,0}},
+  {/*1*/{198,181},{198,239},{2,0}},  {/*1*/{198,231},{198,140},{3,0}},  {/*1*/{198,181},{198,247},{4,0}},  {/*1*/{206,198},{206,214},{3,0}},
+  {/*1*/{206,181},{206,255},{2,1}},  {/*1*/{206,181},{206,255},{1,0}},  {/*1*/{206,206},{206,206},{0,0}},  {/*1*/{206,189},{206,247},{1,1}},
+  {/*1*/{206,189},{206,247},{2,0}},  {/*1*/{206,231},{206,165},{3,0}},  {/*1*/{206,189},{206,255},{4,0}},  {/*1*/{214,198},{214,239},{3,0}},
+  {/*1*/{214,198},{214,239},{2,1}},  {/*1*/{214,198},{214,247},{1,1}},  {/*1*/{214,198},{214,247},{0,0}},  {/*1*/{214,198},{214,247},{1,1}},
+  {/*1*/{214,198},{214,255},{2,0}},  {/*1*/{214,231},{214,189},{3,0}},  {/*1*/{214,206},{214,247},{4,1}},  {/*1*/{222,206},{222,247},{3,0}},
+  {/*1*/{222,231},{222,198},{2,0}},  {/*1*/{222,206},{222,255},{1,1}},  {/*1*/{222,206},{222,255},{0,0}},  {/*1*/{222,206},{222,255},{1,1}},
+  {/*1*/{222,214},{222,247},{2,0}},  {/*1*/{222,231},{222,214},{3,0}},  {/*1*/{222,214},{222,255},{4,1}},  {/*1*/{231,214},{231,255},{4,0}},
+  {/*1*/{231,231},{231,222},{3,0}},  {/*1*/{231,222},{231,247},{2,1}},  {/*1*/{231,222},{231,247},{1,0}},  {/*1*/{231,231},{231,231},{0,0}},
+  {/*1*/{231,222},{231,255},{1,0}},  {/*1*/{231,231},{231,239},{2,0}},  {/*1*/{231,231},{231,239},{3,1}},  {/*1*/{231,231},{231,247},{4,1}},
+  {/*1*/{239,231},{239,247},{3,0}},  {/*1*/{239,231},{239,247},{2,1}},  {/*1*/{239,231},{239,255},{1,0}},  {/*1*/{239,239},{239,239},{0,0}},
+  {/*1*/{239,239},{239,239},{1,1}},  {/*1*/{239,239},{239,247},{2,0}},  {/*1*/{239,239},{239,247},{3,1}},  {/*1*/{239,239},{239,255},{4,1}},
+  {/*1*/{247,239},{247,255},{3,0}},  {/*1*/{247,239},{247,255},{2,1}},  {/*1*/{247,247},{247,247},{1,1}},  {/*1*/{247,247},{247,247},{0,0}},
+  {/*1*/{247,247},{247,247},{1,1}},  {/*1*/{247,247},{247,255},{2,0}},  {/*1*/{247,247},{247,255},{3,1}},  {/*1*/{247,255},{247,247},{4,1}},
+  {/*1*/{255,255},{255,247},{3,0}},  {/*1*/{255,255},{255,247},{2,1}},  {/*1*/{255,255},{255,255},{1,1}},  {/*1*/{255,255},{255,255},{0,0}}
 };
 
 /* 256 * 2 * 3 * 1 = 1536 */
 static PaletteSingleLookup2 const sp_lookup_6_4[256] =
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  0,  0,1},{  0,  4,0}}},  {{/*1*/{  0,  0,2},{  0,  8,0}}},  {{/*1*/{  4,  4,1},{  0, 12,0}}},
-  {{/*1*/{  4,  4,0},{  4,  4,0}}},  {{/*1*/{  4,  4,1},{  0, 16,0}}},  {{/*1*/{  4,  4,2},{  0, 20,0}}},  {{/*1*/{  8,  8,1},{  0, 24,0}}},
-  {{/*1*/{  8,  8,0},{  8,  8,0}}},  {{/*1*/{  8,  8,1},{  0, 28,0}}},  {{/*1*/{  8,  8,2},{  0, 32,0}}},  {{/*1*/{ 12, 12,1},{  0, 36,0}}},
-  {{/*1*/{ 12, 12,0},{ 12, 12,0}}},  {{/*1*/{ 12, 12,1},{  0, 40,0}}},  {{/*1*/{ 12, 12,2},{  0, 44,0}}},  {{/*1*/{ 16, 16,1},{  0, 48,0}}},
-  {{/*1*/{ 16, 16,0},{ 16, 16,0}}},  {{/*1*/{ 16, 16,1},{  0, 52,0}}},  {{/*1*/{ 16, 16,2},{  0, 56,0}}},  {{/*1*/{ 20, 20,1},{  0, 60,0}}},
-  {{/*1*/{ 20, 20,0},{ 20, 20,0}}},  {{/*1*/{ 20, 20,1},{  0, 65,0}}},  {{/*1*/{ 20, 20,2},{  0, 69,0}}},  {{/*1*/{ 24, 24,1},{  0, 73,0}}},
-  {{/*1*/{ 24, 24,0},{  4, 65,0}}},  {{/*1*/{ 24, 24,1},{  0, 77,0}}},  {{/*1*/{ 24, 24,2},{  0, 81,0}}},  {{/*1*/{ 28, 28,1},{  0, 85,0}}},
-  {{/*1*/{ 28, 28,0},{  8, 69,0}}},  {{/*1*/{ 28, 28,1},{  0, 89,0}}},  {{/*1*/{ 28, 28,2},{  0, 93,0}}},  {{/*1*/{ 32, 32,1},{  0, 97,0}}},
-  {{/*1*/{ 32, 32,0},{ 12, 73,0}}},  {{/*1*/{ 32, 32,1},{  0,101,0}}},  {{/*1*/{ 32, 32,2},{  0,105,0}}},  {{/*1*/{ 36, 36,1},{  0,109,0}}},
-  {{/*1*/{ 36, 36,0},{ 16, 77,0}}},  {{/*1*/{ 36, 36,1},{  0,113,0}}},  {{/*1*/{ 36, 36,2},{  0,117,0}}},  {{/*1*/{ 40, 40,1},{  0,121,0}}},
-  {{/*1*/{ 40, 40,0},{ 20, 81,0}}},  {{/*1*/{ 40, 40,1},{  0,125,0}}},  {{/*1*/{ 40, 40,2},{  0,130,0}}},  {{/*1*/{ 44, 44,1},{  0,134,0}}},
-  {{/*1*/{ 44, 44,0},{ 24, 85,0}}},  {{/*1*/{ 44, 44,1},{  0,138,0}}},  {{/*1*/{ 44, 44,2},{  0,142,0}}},  {{/*1*/{ 48, 48,1},{  0,146,0}}},
-  {{/*1*/{ 48, 48,0},{  8,130,0}}},  {{/*1*/{ 48, 48,1},{  0,150,0}}},  {{/*1*/{ 48, 48,2},{  0,154,0}}},  {{/*1*/{ 52, 52,1},{  0,158,0}}},
-  {{/*1*/{ 52, 52,0},{ 12,134,0}}},  {{/*1*/{ 52, 52,1},{  0,162,0}}},  {{/*1*/{ 52, 52,2},{  0,166,0}}},  {{/*1*/{ 56, 56,1},{  0,170,0}}},
-  {{/*1*/{ 56, 56,0},{ 16,138,0}}},  {{/*1*/{ 56, 56,1},{  0,174,0}}},  {{/*1*/{ 56, 56,2},{  0,178,0}}},  {{/*1*/{ 60, 60,1},{  0,182,0}}},
-  {{/*1*/{ 60, 60,0},{ 20,142,0}}},  {{/*1*/{ 60, 60,1},{  0,186,0}}},  {{/*1*/{ 60, 60,2},{  0,190,0}}},  {{/*1*/{ 65, 65,2},{  0,195,0}}},
-  {{/*1*/{ 65, 65,1},{ 24,146,0}}},  {{/*1*/{ 65, 65,0},{  0,199,0}}},  {{/*1*/{ 65, 65,1},{  0,203,0}}},  {{/*1*/{ 65, 65,2},{  0,207,0}}},
-  {{/*1*/{ 69, 69,1},{ 28,150,0}}},  {{/*1*/{ 69, 69,0},{  0,211,0}}},  {{/*1*/{ 69, 69,1},{  0,215,0}}},  {{/*1*/{ 69, 69,2},{  0,219,0}}},
-  {{/*1*/{ 73, 73,1},{ 12,195,0}}},  {{/*1*/{ 73, 73,0},{  0,223,0}}},  {{/*1*/{ 73, 73,1},{  0,227,0}}},  {{/*1*/{ 73, 73,2},{  0,231,0}}},
-  {{/*1*/{ 77, 77,1},{ 16,199,0}}},  {{/*1*/{ 77, 77,0},{  0,235,0}}},  {{/*1*/{ 77, 77,1},{  0,239,0}}},  {{/*1*/{ 77, 77,2},{  0,243,0}}},
-  {{/*1*/{ 81, 81,1},{ 20,203,0}}},  {{/*1*/{ 81, 81,0},{  0,247,0}}},  {{/*1*/{ 81, 81,1},{  0,251,0}}},  {{/*1*/{ 81, 81,2},{  0,255,0}}},
-  {{/*1*/{ 85, 85,1},{ 24,207,0}}},  {{/*1*/{ 85, 85,0},{  4,251,0}}},  {{/*1*/{ 85, 85,1},{  4,255,0}}},  {{/*1*/{ 85, 85,2},{  8,251,0}}},
-  {{/*1*/{ 89, 89,1},{ 28,211,0}}},  {{/*1*/{ 89, 89,0},{  8,255,0}}},  {{/*1*/{ 89, 89,1},{ 12,251,0}}},  {{/*1*/{ 89, 89,2},{ 12,255,0}}},
-  {{/*1*/{ 93, 93,1},{ 32,215,0}}},  {{/*1*/{ 93, 93,0},{ 16,251,0}}},  {{/*1*/{ 93, 93,1},{ 16,255,0}}},  {{/*1*/{ 93, 93,2},{ 20,251,0}}},
-  {{/*1*/{ 97, 97,1},{ 36,219,0}}},  {{/*1*/{ 97, 97,0},{ 20,255,0}}},  {{/*1*/{ 97, 97,1},{ 24,251,0}}},  {{/*1*/{ 97, 97,2},{ 24,255,0}}},
-  {{/*1*/{101,101,1},{ 40,223,0}}},  {{/*1*/{101,101,0},{ 28,251,0}}},  {{/*1*/{101,101,1},{ 28,255,0}}},  {{/*1*/{101,101,2},{ 32,251,0}}},
-  {{/*1*/{105,105,1},{ 44,227,0}}},  {{/*1*/{105,105,0},{ 32,255,0}}},  {{/*1*/{105,105,1},{ 36,251,0}}},  {{/*1*/{105,105,2},{ 36,255,0}}},
-  {{/*1*/{109,109,1},{ 48,231,0}}},  {{/*1*/{109,109,0},{ 40,251,0}}},  {{/*1*/{109,109,1},{ 40,255,0}}},  {{/*1*/{109,109,2},{ 44,251,0}}},
-  {{/*1*/{113,113,1},{ 52,235,0}}},  {{/*1*/{113,113,0},{ 44,255,0}}},  {{/*1*/{113,113,1},{ 48,251,0}}},  {{/*1*/{113,113,2},{ 48,255,0}}},
-  {{/*1*/{117,117,1},{ 56,239,0}}},  {{/*1*/{117,117,0},{ 52,251,0}}},  {{/*1*/{117,117,1},{ 52,255,0}}},  {{/*1*/{117,117,2},{ 56,251,0}}},
-  {{/*1*/{121,121,1},{ 60,243,0}}},  {{/*1*/{121,121,0},{ 56,255,0}}},  {{/*1*/{121,121,1},{ 60,251,0}}},  {{/*1*/{121,121,2},{ 60,255,0}}},
-  {{/*1*/{125,125,1},{ 65,247,0}}},  {{/*1*/{125,125,0},{ 85,207,0}}},  {{/*1*/{125,125,1},{ 65,251,0}}},  {{/*1*/{125,125,2},{ 65,255,0}}},
-  {{/*1*/{130,130,2},{ 69,251,0}}},  {{/*1*/{130,130,1},{ 89,211,0}}},  {{/*1*/{130,130,0},{ 69,255,0}}},  {{/*1*/{130,130,1},{ 73,251,0}}},
-  {{/*1*/{130,130,2},{ 73,255,0}}},  {{/*1*/{134,134,1},{ 93,215,0}}},  {{/*1*/{134,134,0},{ 77,251,0}}},  {{/*1*/{134,134,1},{ 77,255,0}}},
-  {{/*1*/{134,134,2},{ 81,251,0}}},  {{/*1*/{138,138,1},{ 97,219,0}}},  {{/*1*/{138,138,0},{ 81,255,0}}},  {{/*1*/{138,138,1},{ 85,251,0}}},
-  {{/*1*/{138,138,2},{ 85,255,0}}},  {{/*1*/{142,142,1},{101,223,0}}},  {{/*1*/{142,142,0},{ 89,251,0}}},  {{/*1*/{142,142,1},{ 89,255,0}}},
-  {{/*1*/{142,142,2},{ 93,251,0}}},  {{/*1*/{146,146,1},{105,227,0}}},  {{/*1*/{146,146,0},{ 93,255,0}}},  {{/*1*/{146,146,1},{ 97,251,0}}},
-  {{/*1*/{146,146,2},{ 97,255,0}}},  {{/*1*/{150,150,1},{109,231,0}}},  {{/*1*/{150,150,0},{101,251,0}}},  {{/*1*/{150,150,1},{101,255,0}}},
-  {{/*1*/{150,150,2},{105,251,0}}},  {{/*1*/{154,154,1},{113,235,0}}},  {{/*1*/{154,154,0},{105,255,0}}},  {{/*1*/{154,154,1},{109,251,0}}},
-  {{/*1*/{154,154,2},{109,255,0}}},  {{/*1*/{158,158,1},{117,239,0}}},  {{/*1*/{158,158,0},{113,251,0}}},  {{/*1*/{158,158,1},{113,255,0}}},
-  {{/*1*/{158,158,2},{117,251,0}}},  {{/*1*/{162,162,1},{121,243,0}}},  {{/*1*/{162,162,0},{117,255,0}}},  {{/*1*/{162,162,1},{121,251,0}}},
-  {{/*1*/{162,162,2},{121,255,0}}},  {{/*1*/{166,166,1},{125,247,0}}},  {{/*1*/{166,166,0},{125,251,0}}},  {{/*1*/{166,166,1},{125,255,0}}},
-  {{/*1*/{166,166,2},{130,247,0}}},  {{/*1*/{170,170,1},{130,251,0}}},  {{/*1*/{170,170,0},{150,211,0}}},  {{/*1*/{170,170,1},{130,255,0}}},
-  {{/*1*/{170,170,2},{134,251,0}}},  {{/*1*/{174,174,1},{134,255,0}}},  {{/*1*/{174,174,0},{154,215,0}}},  {{/*1*/{174,174,1},{138,251,0}}},
-  {{/*1*/{174,174,2},{138,255,0}}},  {{/*1*/{178,178,1},{142,251,0}}},  {{/*1*/{178,178,0},{158,219,0}}},  {{/*1*/{178,178,1},{142,255,0}}},
-  {{/*1*/{178,178,2},{146,251,0}}},  {{/*1*/{182,182,1},{146,255,0}}},  {{/*1*/{182,182,0},{162,223,0}}},  {{/*1*/{182,182,1},{150,251,0}}},
-  {{/*1*/{182,182,2},{150,255,0}}},  {{/*1*/{186,186,1},{154,251,0}}},  {{/*1*/{186,186,0},{166,227,0}}},  {{/*1*/{186,186,1},{154,255,0}}},
-  {{/*1*/{186,186,2},{158,251,0}}},  {{/*1*/{190,190,1},{158,255,0}}},  {{/*1*/{190,190,0},{170,231,0}}},  {{/*1*/{190,190,1},{162,251,0}}},
-  {{/*1*/{190,190,2},{162,255,0}}},  {{/*1*/{195,195,2},{166,251,0}}},  {{/*1*/{195,195,1},{174,235,0}}},  {{/*1*/{195,195,0},{166,255,0}}},
-  {{/*1*/{195,195,1},{170,251,0}}},  {{/*1*/{195,195,2},{170,255,0}}},  {{/*1*/{199,199,1},{178,239,0}}},  {{/*1*/{199,199,0},{174,251,0}}},
-  {{/*1*/{199,199,1},{174,255,0}}},  {{/*1*/{199,199,2},{178,251,0}}},  {{/*1*/{203,203,1},{182,243,0}}},  {{/*1*/{203,203,0},{178,255,0}}},
-  {{/*1*/{203,203,1},{182,251,0}}},  {{/*1*/{203,203,2},{182,255,0}}},  {{/*1*/{207,207,1},{186,247,0}}},  {{/*1*/{207,207,0},{186,251,0}}},
-  {{/*1*/{207,207,1},{186,255,0}}},  {{/*1*/{207,207,2},{195,239,0}}},  {{/*1*/{211,211,1},{190,251,0}}},  {{/*1*/{211,211,0},{190,255,0}}},
-  {{/*1*/{211,211,1},{195,247,0}}},  {{/*1*/{211,211,2},{195,251,0}}},  {{/*1*/{215,215,1},{195,255,0}}},  {{/*1*/{215,215,0},{215,215,0}}},
-  {{/*1*/{215,215,1},{199,251,0}}},  {{/*1*/{215,215,2},{199,255,0}}},  {{/*1*/{219,219,1},{203,251,0}}},  {{/*1*/{219,219,0},{219,219,0}}},
-  {{/*1*/{219,219,1},{203,255,0}}},  {{/*1*/{219,219,2},{207,251,0}}},  {{/*1*/{223,223,1},{207,255,0}}},  {{/*1*/{223,223,0},{223,223,0}}},
-  {{/*1*/{223,223,1},{211,251,0}}},  {{/*1*/{223,223,2},{211,255,0}}},  {{/*1*/{227,227,1},{215,251,0}}},  {{/*1*/{227,227,0},{227,227,0}}},
-  {{/*1*/{227,227,1},{215,255,0}}},  {{/*1*/{227,227,2},{219,251,0}}},  {{/*1*/{231,231,1},{219,255,0}}},  {{/*1*/{231,231,0},{231,231,0}}},
-  {{/*1*/{231,231,1},{223,251,0}}},  {{/*1*/{231,231,2},{223,255,0}}},  {{/*1*/{235,235,1},{227,251,0}}},  {{/*1*/{235,235,0},{235,235,0}}},
-  {{/*1*/{235,235,1},{227,255,0}}},  {{/*1*/{235,235,2},{231,251,0}}},  {{/*1*/{239,239,1},{231,255,0}}},  {{/*1*/{239,239,0},{239,239,0}}},
-  {{/*1*/{239,239,1},{235,251,0}}},  {{/*1*/{239,239,2},{235,255,0}}},  {{/*1*/{243,243,1},{239,251,0}}},  {{/*1*/{243,243,0},{243,243,0}}},
-  {{/*1*/{243,243,1},{239,255,0}}},  {{/*1*/{243,243,2},{243,251,0}}},  {{/*1*/{247,247,1},{243,255,0}}},  {{/*1*/{247,247,0},{247,247,0}}},
-  {{/*1*/{247,247,1},{247,251,0}}},  {{/*1*/{247,247,2},{247,255,0}}},  {{/*1*/{251,251,1},{247,255,1}}},  {{/*1*/{251,251,0},{251,251,0}}},
-  {{/*1*/{251,251,1},{251,255,0}}},  {{/*1*/{251,251,2},{255,251,0}}},  {{/*1*/{255,255,1},{255,255,1}}},  {{/*1*/{255,255,0},{255,255,0}}}
+  {/*1*/{  0,  0},{  0,  0},{0,0}},  {/*1*/{  0,  0},{  0,  4},{1,0}},  {/*1*/{  0,  0},{  0,  8},{2,0}},  {/*1*/{  4,  0},{  4, 12},{1,0}},
+  {/*1*/{  4,  4},{  4,  4},{0,0}},  {/*1*/{  4,  0},{  4, 16},{1,0}},  {/*1*/{  4,  0},{  4, 20},{2,0}},  {/*1*/{  8,  0},{  8, 24},{1,0}},
+  {/*1*/{  8,  8},{  8,  8},{0,0}},  {/*1*/{  8,  0},{  8, 28},{1,0}},  {/*1*/{  8,  0},{  8, 32},{2,0}},  {/*1*/{ 12,  0},{ 12, 36},{1,0}},
+  {/*1*/{ 12, 12},{ 12, 12},{0,0}},  {/*1*/{ 12,  0},{ 12, 40},{1,0}},  {/*1*/{ 12,  0},{ 12, 44},{2,0}},  {/*1*/{ 16,  0},{ 16, 48},{1,0}},
+  {/*1*/{ 16, 16},{ 16, 16},{0,0}},  {/*1*/{ 16,  0},{ 16, 52},{1,0}},  {/*1*/{ 16,  0},{ 16, 56},{2,0}},  {/*1*/{ 20,  0},{ 20, 60},{1,0}},
+  {/*1*/{ 20, 20},{ 20, 20},{0,0}},  {/*1*/{ 20,  0},{ 20, 65},{1,0}},  {/*1*/{ 20,  0},{ 20, 69},{2,0}},  {/*1*/{ 24,  0},{ 24, 73},{1,0}},
+  {/*1*/{ 24,  4},{ 24, 65},{0,0}},  {/*1*/{ 24,  0},{ 24, 77},{1,0}},  {/*1*/{ 24,  0},{ 24, 81},{2,0}},  {/*1*/{ 28,  0},{ 28, 85},{1,0}},
+  {/*1*/{ 28,  8},{ 28, 69},{0,0}},  {/*1*/{ 28,  0},{ 28, 89},{1,0}},  {/*1*/{ 28,  0},{ 28, 93},{2,0}},  {/*1*/{ 32,  0},{ 32, 97},{1,0}},
+  {/*1*/{ 32, 12},{ 32, 73},{0,0}},  {/*1*/{ 32,  0},{ 32,101},{1,0}},  {/*1*/{ 32,  0},{ 32,105},{2,0}},  {/*1*/{ 36,  0},{ 36,109},{1,0}},
+  {/*1*/{ 36, 16},{ 36, 77},{0,0}},  {/*1*/{ 36,  0},{ 36,113},{1,0}},  {/*1*/{ 36,  0},{ 36,117},{2,0}},  {/*1*/{ 40,  0},{ 40,121},{1,0}},
+  {/*1*/{ 40, 20},{ 40, 81},{0,0}},  {/*1*/{ 40,  0},{ 40,125},{1,0}},  {/*1*/{ 40,  0},{ 40,130},{2,0}},  {/*1*/{ 44,  0},{ 44,134},{1,0}},
+  {/*1*/{ 44, 24},{ 44, 85},{0,0}},  {/*1*/{ 44,  0},{ 44,138},{1,0}},  {/*1*/{ 44,  0},{ 44,142},{2,0}},  {/*1*/{ 48,  0},{ 48,146},{1,0}},
+  {/*1*/{ 48,  8},{ 48,130},{0,0}},  {/*1*/{ 48,  0},{ 48,150},{1,0}},  {/*1*/{ 48,  0},{ 48,154},{2,0}},  {/*1*/{ 52,  0},{ 52,158},{1,0}},
+  {/*1*/{ 52, 12},{ 52,134},{0,0}},  {/*1*/{ 52,  0},{ 52,162},{1,0}},  {/*1*/{ 52,  0},{ 52,166},{2,0}},  {/*1*/{ 56,  0},{ 56,170},{1,0}},
+  {/*1*/{ 56, 16},{ 56,138},{0,0}},  {/*1*/{ 56,  0},{ 56,174},{1,0}},  {/*1*/{ 56,  0},{ 56,178},{2,0}},  {/*1*/{ 60,  0},{ 60,182},{1,0}},
+  {/*1*/{ 60, 20},{ 60,142},{0,0}},  {/*1*/{ 60,  0},{ 60,186},{1,0}},  {/*1*/{ 60,  0},{ 60,190},{2,0}},  {/*1*/{ 65,  0},{ 65,195},{2,0}},
+  {/*1*/{ 65, 24},{ 65,146},{1,0}},  {/*1*/{ 65,  0},{ 65,199},{0,0}},  {/*1*/{ 65,  0},{ 65,203},{1,0}},  {/*1*/{ 65,  0},{ 65,207},{2,0}},
+  {/*1*/{ 69, 28},{ 69,150},{1,0}},  {/*1*/{ 69,  0},{ 69,211},{0,0}},  {/*1*/{ 69,  0},{ 69,215},{1,0}},  {/*1*/{ 69,  0},{ 69,219},{2,0}},
+  {/*1*/{ 73, 12},{ 73,195},{1,0}},  {/*1*/{ 73,  0},{ 73,223},{0,0}},  {/*1*/{ 73,  0},{ 73,227},{1,0}},  {/*1*/{ 73,  0},{ 73,231},{2,0}},
+  {/*1*/{ 77, 16},{ 77,199},{1,0}},  {/*1*/{ 77,  0},{ 77,235},{0,0}},  {/*1*/{ 77,  0},{ 77,239},{1,0}},  {/*1*/{ 77,  0},{ 77,243},{2,0}},
+  {/*1*/{ 81, 20},{ 81,203},{1,0}},  {/*1*/{ 81,  0},{ 81,247},{0,0}},  {/*1*/{ 81,  0},{ 81,251},{1,0}},  {/*1*/{ 81,  0},{ 81,255},{2,0}},
+  {/*1*/{ 85, 24},{ 85,207},{1,0}},  {/*1*/{ 85,  4},{ 85,251},{0,0}},  {/*1*/{ 85,  4},{ 85,255},{1,0}},  {/*1*/{ 85,  8},{ 85,251},{2,0}},
+  {/*1*/{ 89, 28},{ 89,211},{1,0}},  {/*1*/{ 89,  8},{ 89,255},{0,0}},  {/*1*/{ 89, 12},{ 89,251},{1,0}},  {/*1*/{ 89, 12},{ 89,255},{2,0}},
+  {/*1*/{ 93, 32},{ 93,215},{1,0}},  {/*1*/{ 93, 16},{ 93,251},{0,0}},  {/*1*/{ 93, 16},{ 93,255},{1,0}},  {/*1*/{ 93, 20},{ 93,251},{2,0}},
+  {/*1*/{ 97, 36},{ 97,219},{1,0}},  {/*1*/{ 97, 20},{ 97,255},{0,0}},  {/*1*/{ 97, 24},{ 97,251},{1,0}},  {/*1*/{ 97, 24},{ 97,255},{2,0}},
+  {/*1*/{101, 40},{101,223},{1,0}},  {/*1*/{101, 28},{101,251},{0,0}},  {/*1*/{101, 28},{101,255},{1,0}},  {/*1*/{101, 32},{101,251},{2,0}},
+  {/*1*/{105, 44},{105,227},{1,0}},  {/*1*/{105, 32},{105,255},{0,0}},  {/*1*/{105, 36},{105,251},{1,0}},  {/*1*/{105, 36},{105,255},{2,0}},
+  {/*1*/{109, 48},{109,231},{1,0}},  {/*1*/{109, 40},{109,251},{0,0}},  {/*1*/{109, 40},{109,255},{1,0}},  {/*1*/{109, 44},{109,251},{2,0}},
+  {/*1*/{113, 52},{113,235},{1,0}},  {/*1*/{113, 44},{113,255},{0,0}},  {/*1*/{113, 48},{113,251},{1,0}},  {/*1*/{113, 48},{113,255},{2,0}},
+  {/*1*/{117, 56},{117,239},{1,0}},  {/*1*/{117, 52},{117,251},{0,0}},  {/*1*/{117, 52},{117,255},{1,0}},  {/*1*/{117, 56},{117,251},{2,0}},
+  {/*1*/{121, 60},{121,243},{1,0}},  {/*1*/{121, 56},{121,255},{0,0}},  {/*1*/{121, 60},{121,251},{1,0}},  {/*1*/{121, 60},{121,255},{2,0}},
+  {/*1*/{125, 65},{125,247},{1,0}},  {/*1*/{125, 85},{125,207},{0,0}},  {/*1*/{125, 65},{125,251},{1,0}},  {/*1*/{125, 65},{125,255},{2,0}},
+  {/*1*/{130, 69},{130,251},{2,0}},  {/*1*/{130, 89},{130,211},{1,0}},  {/*1*/{130, 69},{130,255},{0,0}},  {/*1*/{130, 73},{130,251},{1,0}},
+  {/*1*/{130, 73},{130,255},{2,0}},  {/*1*/{134, 93},{134,215},{1,0}},  {/*1*/{134, 77},{134,251},{0,0}},  {/*1*/{134, 77},{134,255},{1,0}},
+  {/*1*/{134, 81},{134,251},{2,0}},  {/*1*/{138, 97},{138,219},{1,0}},  {/*1*/{138, 81},{138,255},{0,0}},  {/*1*/{138, 85},{138,251},{1,0}},
+  {/*1*/{138, 85},{138,255},{2,0}},  {/*1*/{142,101},{142,223},{1,0}},  {/*1*/{142, 89},{142,251},{0,0}},  {/*1*/{142, 89},{142,255},{1,0}},
+  {/*1*/{142, 93},{142,251},{2,0}},  {/*1*/{146,105},{146,227},{1,0}},  {/*1*/{146, 93},{146,255},{0,0}},  {/*1*/{146, 97},{146,251},{1,0}},
+  {/*1*/{146, 97},{146,255},{2,0}},  {/*1*/{150,109},{150,231},{1,0}},  {/*1*/{150,101},{150,251},{0,0}},  {/*1*/{150,101},{150,255},{1,0}},
+  {/*1*/{150,105},{150,251},{2,0}},  {/*1*/{154,113},{154,235},{1,0}},  {/*1*/{154,105},{154,255},{0,0}},  {/*1*/{154,109},{154,251},{1,0}},
+  {/*1*/{154,109},{154,255},{2,0}},  {/*1*/{158,117},{158,239},{1,0}},  {/*1*/{158,113},{158,251},{0,0}},  {/*1*/{158,113},{158,255},{1,0}},
+  {/*1*/{158,117},{158,251},{2,0}},  {/*1*/{162,121},{162,243},{1,0}},  {/*1*/{162,117},{162,255},{0,0}},  {/*1*/{162,121},{162,251},{1,0}},
+  {/*1*/{162,121},{162,255},{2,0}},  {/*1*/{166,125},{166,247},{1,0}},  {/*1*/{166,125},{166,251},{0,0}},  {/*1*/{166,125},{166,255},{1,0}},
+  {/*1*/{166,130},{166,247},{2,0}},  {/*1*/{170,130},{170,251},{1,0}},  {/*1*/{170,150},{170,211},{0,0}},  {/*1*/{170,130},{170,255},{1,0}},
+  {/*1*/{170,134},{170,251},{2,0}},  {/*1*/{174,134},{174,255},{1,0}},  {/*1*/{174,154},{174,215},{0,0}},  {/*1*/{174,138},{174,251},{1,0}},
+  {/*1*/{174,138},{174,255},{2,0}},  {/*1*/{178,142},{178,251},{1,0}},  {/*1*/{178,158},{178,219},{0,0}},  {/*1*/{178,142},{178,255},{1,0}},
+  {/*1*/{178,146},{178,251},{2,0}},  {/*1*/{182,146},{182,255},{1,0}},  {/*1*/{182,162},{182,223},{0,0}},  {/*1*/{182,150},{182,251},{1,0}},
+  {/*1*/{182,150},{182,255},{2,0}},  {/*1*/{186,154},{186,251},{1,0}},  {/*1*/{186,166},{186,227},{0,0}},  {/*1*/{186,154},{186,255},{1,0}},
+  {/*1*/{186,158},{186,251},{2,0}},  {/*1*/{190,158},{190,255},{1,0}},  {/*1*/{190,170},{190,231},{0,0}},  {/*1*/{190,162},{190,251},{1,0}},
+  {/*1*/{190,162},{190,255},{2,0}},  {/*1*/{195,166},{195,251},{2,0}},  {/*1*/{195,174},{195,235},{1,0}},  {/*1*/{195,166},{195,255},{0,0}},
+  {/*1*/{195,170},{195,251},{1,0}},  {/*1*/{195,170},{195,255},{2,0}},  {/*1*/{199,178},{199,239},{1,0}},  {/*1*/{199,174},{199,251},{0,0}},
+  {/*1*/{199,174},{199,255},{1,0}},  {/*1*/{199,178},{199,251},{2,0}},  {/*1*/{203,182},{203,243},{1,0}},  {/*1*/{203,178},{203,255},{0,0}},
+  {/*1*/{203,182},{203,251},{1,0}},  {/*1*/{203,182},{203,255},{2,0}},  {/*1*/{207,186},{207,247},{1,0}},  {/*1*/{207,186},{207,251},{0,0}},
+  {/*1*/{207,186},{207,255},{1,0}},  {/*1*/{207,195},{207,239},{2,0}},  {/*1*/{211,190},{211,251},{1,0}},  {/*1*/{211,190},{211,255},{0,0}},
+  {/*1*/{211,195},{211,247},{1,0}},  {/*1*/{211,195},{211,251},{2,0}},  {/*1*/{215,195},{215,255},{1,0}},  {/*1*/{215,215},{215,215},{0,0}},
+  {/*1*/{215,199},{215,251},{1,0}},  {/*1*/{215,199},{215,255},{2,0}},  {/*1*/{219,203},{219,251},{1,0}},  {/*1*/{219,219},{219,219},{0,0}},
+  {/*1*/{219,203},{219,255},{1,0}},  {/*1*/{219,207},{219,251},{2,0}},  {/*1*/{223,207},{223,255},{1,0}},  {/*1*/{223,223},{223,223},{0,0}},
+  {/*1*/{223,211},{223,251},{1,0}},  {/*1*/{223,211},{223,255},{2,0}},  {/*1*/{227,215},{227,251},{1,0}},  {/*1*/{227,227},{227,227},{0,0}},
+  {/*1*/{227,215},{227,255},{1,0}},  {/*1*/{227,219},{227,251},{2,0}},  {/*1*/{231,219},{231,255},{1,0}},  {/*1*/{231,231},{231,231},{0,0}},
+  {/*1*/{231,223},{231,251},{1,0}},  {/*1*/{231,223},{231,255},{2,0}},  {/*1*/{235,227},{235,251},{1,0}},  {/*1*/{235,235},{235,235},{0,0}},
+  {/*1*/{235,227},{235,255},{1,0}},  {/*1*/{235,231},{235,251},{2,0}},  {/*1*/{239,231},{239,255},{1,0}},  {/*1*/{239,239},{239,239},{0,0}},
+  {/*1*/{239,235},{239,251},{1,0}},  {/*1*/{239,235},{239,255},{2,0}},  {/*1*/{243,239},{243,251},{1,0}},  {/*1*/{243,243},{243,243},{0,0}},
+  {/*1*/{243,239},{243,255},{1,0}},  {/*1*/{243,243},{243,251},{2,0}},  {/*1*/{247,243},{247,255},{1,0}},  {/*1*/{247,247},{247,247},{0,0}},
+  {/*1*/{247,247},{247,251},{1,0}},  {/*1*/{247,247},{247,255},{2,0}},  {/*1*/{251,247},{251,255},{1,1}},  {/*1*/{251,251},{251,251},{0,0}},
+  {/*1*/{251,251},{251,255},{1,0}},  {/*1*/{251,255},{251,251},{2,0}},  {/*1*/{255,255},{255,255},{1,1}},  {/*1*/{255,255},{255,255},{0,0}}
 };
 
 /* 256 * 2 * 3 * 1 = 1536 */
 static PaletteSingleLookup2 const sp_lookup_7_4[256] =
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  0,  0,1},{  0,  4,0}}},  {{/*1*/{  2,  2,0},{  0,  8,0}}},  {{/*1*/{  2,  2,1},{  0, 10,0}}},
-  {{/*1*/{  4,  4,0},{  0, 14,0}}},  {{/*1*/{  4,  4,1},{  0, 16,0}}},  {{/*1*/{  6,  6,0},{  0, 20,0}}},  {{/*1*/{  6,  6,1},{  0, 22,0}}},
-  {{/*1*/{  8,  8,0},{  0, 26,0}}},  {{/*1*/{  8,  8,1},{  0, 28,0}}},  {{/*1*/{ 10, 10,0},{  0, 32,0}}},  {{/*1*/{ 10, 10,1},{  0, 34,0}}},
-  {{/*1*/{ 12, 12,0},{  0, 38,0}}},  {{/*1*/{ 12, 12,1},{  0, 40,0}}},  {{/*1*/{ 14, 14,0},{  0, 44,0}}},  {{/*1*/{ 14, 14,1},{  0, 46,0}}},
-  {{/*1*/{ 16, 16,0},{  0, 50,0}}},  {{/*1*/{ 16, 16,1},{  0, 52,0}}},  {{/*1*/{ 18, 18,0},{  0, 56,0}}},  {{/*1*/{ 18, 18,1},{  0, 58,0}}},
-  {{/*1*/{ 20, 20,0},{  0, 62,0}}},  {{/*1*/{ 20, 20,1},{  0, 64,0}}},  {{/*1*/{ 22, 22,0},{  0, 68,0}}},  {{/*1*/{ 22, 22,1},{  0, 72,0}}},
-  {{/*1*/{ 24, 24,0},{  0, 74,0}}},  {{/*1*/{ 24, 24,1},{  0, 78,0}}},  {{/*1*/{ 26, 26,0},{  0, 80,0}}},  {{/*1*/{ 26, 26,1},{  0, 84,0}}},
-  {{/*1*/{ 28, 28,0},{  0, 86,0}}},  {{/*1*/{ 28, 28,1},{  0, 90,0}}},  {{/*1*/{ 30, 30,0},{  0, 92,0}}},  {{/*1*/{ 30, 30,1},{  0, 96,0}}},
-  {{/*1*/{ 32, 32,0},{  0, 98,0}}},  {{/*1*/{ 32, 32,1},{  0,102,0}}},  {{/*1*/{ 34, 34,0},{  0,104,0}}},  {{/*1*/{ 34, 34,1},{  0,108,0}}},
-  {{/*1*/{ 36, 36,0},{  0,110,0}}},  {{/*1*/{ 36, 36,1},{  0,114,0}}},  {{/*1*/{ 38, 38,0},{  0,116,0}}},  {{/*1*/{ 38, 38,1},{  0,120,0}}},
-  {{/*1*/{ 40, 40,0},{  0,122,0}}},  {{/*1*/{ 40, 40,1},{  0,126,0}}},  {{/*1*/{ 42, 42,0},{  0,129,0}}},  {{/*1*/{ 42, 42,1},{  0,133,0}}},
-  {{/*1*/{ 44, 44,0},{  0,135,0}}},  {{/*1*/{ 44, 44,1},{  0,139,0}}},  {{/*1*/{ 46, 46,0},{  0,141,0}}},  {{/*1*/{ 46, 46,1},{  0,145,0}}},
-  {{/*1*/{ 48, 48,0},{  0,147,0}}},  {{/*1*/{ 48, 48,1},{  0,151,0}}},  {{/*1*/{ 50, 50,0},{  0,153,0}}},  {{/*1*/{ 50, 50,1},{  0,157,0}}},
-  {{/*1*/{ 52, 52,0},{  0,159,0}}},  {{/*1*/{ 52, 52,1},{  0,163,0}}},  {{/*1*/{ 54, 54,0},{  0,165,0}}},  {{/*1*/{ 54, 54,1},{  0,169,0}}},
-  {{/*1*/{ 56, 56,0},{  0,171,0}}},  {{/*1*/{ 56, 56,1},{  0,175,0}}},  {{/*1*/{ 58, 58,0},{  0,177,0}}},  {{/*1*/{ 58, 58,1},{  0,181,0}}},
-  {{/*1*/{ 60, 60,0},{  0,183,0}}},  {{/*1*/{ 60, 60,1},{  0,187,0}}},  {{/*1*/{ 62, 62,0},{  0,189,0}}},  {{/*1*/{ 62, 62,1},{  0,193,0}}},
-  {{/*1*/{ 64, 64,0},{  0,197,0}}},  {{/*1*/{ 64, 64,1},{  0,199,0}}},  {{/*1*/{ 66, 66,0},{  0,203,0}}},  {{/*1*/{ 66, 66,1},{  0,205,0}}},
-  {{/*1*/{ 68, 68,0},{  0,209,0}}},  {{/*1*/{ 68, 68,1},{  0,211,0}}},  {{/*1*/{ 70, 70,0},{  0,215,0}}},  {{/*1*/{ 70, 70,1},{  0,217,0}}},
-  {{/*1*/{ 72, 72,0},{  0,221,0}}},  {{/*1*/{ 72, 72,1},{  0,223,0}}},  {{/*1*/{ 74, 74,0},{  0,227,0}}},  {{/*1*/{ 74, 74,1},{  0,229,0}}},
-  {{/*1*/{ 76, 76,0},{  0,233,0}}},  {{/*1*/{ 76, 76,1},{  0,235,0}}},  {{/*1*/{ 78, 78,0},{  0,239,0}}},  {{/*1*/{ 78, 78,1},{  0,241,0}}},
-  {{/*1*/{ 80, 80,0},{  0,245,0}}},  {{/*1*/{ 80, 80,1},{  0,247,0}}},  {{/*1*/{ 82, 82,0},{  0,251,0}}},  {{/*1*/{ 82, 82,1},{  0,253,0}}},
-  {{/*1*/{ 84, 84,0},{  2,253,0}}},  {{/*1*/{ 84, 84,1},{  2,255,0}}},  {{/*1*/{ 86, 86,0},{  4,255,0}}},  {{/*1*/{ 86, 86,1},{  6,253,0}}},
-  {{/*1*/{ 88, 88,0},{  8,253,0}}},  {{/*1*/{ 88, 88,1},{  8,255,0}}},  {{/*1*/{ 90, 90,0},{ 10,255,0}}},  {{/*1*/{ 90, 90,1},{ 12,253,0}}},
-  {{/*1*/{ 92, 92,0},{ 14,253,0}}},  {{/*1*/{ 92, 92,1},{ 14,255,0}}},  {{/*1*/{ 94, 94,0},{ 16,255,0}}},  {{/*1*/{ 94, 94,1},{ 18,253,0}}},
-  {{/*1*/{ 96, 96,0},{ 20,253,0}}},  {{/*1*/{ 96, 96,1},{ 20,255,0}}},  {{/*1*/{ 98, 98,0},{ 22,255,0}}},  {{/*1*/{ 98, 98,1},{ 24,253,0}}},
-  {{/*1*/{100,100,0},{ 26,253,0}}},  {{/*1*/{100,100,1},{ 26,255,0}}},  {{/*1*/{102,102,0},{ 28,255,0}}},  {{/*1*/{102,102,1},{ 30,253,0}}},
-  {{/*1*/{104,104,0},{ 32,253,0}}},  {{/*1*/{104,104,1},{ 32,255,0}}},  {{/*1*/{106,106,0},{ 34,255,0}}},  {{/*1*/{106,106,1},{ 36,253,0}}},
-  {{/*1*/{108,108,0},{ 38,253,0}}},  {{/*1*/{108,108,1},{ 38,255,0}}},  {{/*1*/{110,110,0},{ 40,255,0}}},  {{/*1*/{110,110,1},{ 42,253,0}}},
-  {{/*1*/{112,112,0},{ 44,253,0}}},  {{/*1*/{112,112,1},{ 44,255,0}}},  {{/*1*/{114,114,0},{ 46,255,0}}},  {{/*1*/{114,114,1},{ 48,253,0}}},
-  {{/*1*/{116,116,0},{ 50,253,0}}},  {{/*1*/{116,116,1},{ 50,255,0}}},  {{/*1*/{118,118,0},{ 52,255,0}}},  {{/*1*/{118,118,1},{ 54,253,0}}},
-  {{/*1*/{120,120,0},{ 56,253,0}}},  {{/*1*/{120,120,1},{ 56,255,0}}},  {{/*1*/{122,122,0},{ 58,255,0}}},  {{/*1*/{122,122,1},{ 60,253,0}}},
-  {{/*1*/{124,124,0},{ 62,251,0}}},  {{/*1*/{124,124,1},{ 62,255,0}}},  {{/*1*/{126,126,0},{ 64,253,0}}},  {{/*1*/{126,126,1},{ 66,253,0}}},
-  {{/*1*/{129,129,1},{ 66,255,0}}},  {{/*1*/{129,129,0},{ 68,255,0}}},  {{/*1*/{129,129,1},{ 70,253,0}}},  {{/*1*/{131,131,0},{ 72,253,0}}},
-  {{/*1*/{131,131,1},{ 72,255,0}}},  {{/*1*/{133,133,0},{ 74,255,0}}},  {{/*1*/{133,133,1},{ 76,253,0}}},  {{/*1*/{135,135,0},{ 78,253,0}}},
-  {{/*1*/{135,135,1},{ 78,255,0}}},  {{/*1*/{137,137,0},{ 80,255,0}}},  {{/*1*/{137,137,1},{ 82,253,0}}},  {{/*1*/{139,139,0},{ 84,253,0}}},
-  {{/*1*/{139,139,1},{ 84,255,0}}},  {{/*1*/{141,141,0},{ 86,255,0}}},  {{/*1*/{141,141,1},{ 88,253,0}}},  {{/*1*/{143,143,0},{ 90,253,0}}},
-  {{/*1*/{143,143,1},{ 90,255,0}}},  {{/*1*/{145,145,0},{ 92,255,0}}},  {{/*1*/{145,145,1},{ 94,253,0}}},  {{/*1*/{147,147,0},{ 96,253,0}}},
-  {{/*1*/{147,147,1},{ 96,255,0}}},  {{/*1*/{149,149,0},{ 98,255,0}}},  {{/*1*/{149,149,1},{100,253,0}}},  {{/*1*/{151,151,0},{102,253,0}}},
-  {{/*1*/{151,151,1},{102,255,0}}},  {{/*1*/{153,153,0},{104,255,0}}},  {{/*1*/{153,153,1},{106,253,0}}},  {{/*1*/{155,155,0},{108,253,0}}},
-  {{/*1*/{155,155,1},{108,255,0}}},  {{/*1*/{157,157,0},{110,255,0}}},  {{/*1*/{157,157,1},{112,253,0}}},  {{/*1*/{159,159,0},{114,253,0}}},
-  {{/*1*/{159,159,1},{114,255,0}}},  {{/*1*/{161,161,0},{116,255,0}}},  {{/*1*/{161,161,1},{118,253,0}}},  {{/*1*/{163,163,0},{120,253,0}}},
-  {{/*1*/{163,163,1},{120,255,0}}},  {{/*1*/{165,165,0},{122,255,0}}},  {{/*1*/{165,165,1},{124,253,0}}},  {{/*1*/{167,167,0},{126,251,0}}},
-  {{/*1*/{167,167,1},{126,255,0}}},  {{/*1*/{169,169,0},{129,251,0}}},  {{/*1*/{169,169,1},{129,255,0}}},  {{/*1*/{171,171,0},{131,253,0}}},
-  {{/*1*/{171,171,1},{133,253,0}}},  {{/*1*/{173,173,0},{133,255,0}}},  {{/*1*/{173,173,1},{135,255,0}}},  {{/*1*/{175,175,0},{137,253,0}}},
-  {{/*1*/{175,175,1},{139,253,0}}},  {{/*1*/{177,177,0},{139,255,0}}},  {{/*1*/{177,177,1},{141,255,0}}},  {{/*1*/{179,179,0},{143,253,0}}},
-  {{/*1*/{179,179,1},{145,253,0}}},  {{/*1*/{181,181,0},{145,255,0}}},  {{/*1*/{181,181,1},{147,255,0}}},  {{/*1*/{183,183,0},{149,253,0}}},
-  {{/*1*/{183,183,1},{151,253,0}}},  {{/*1*/{185,185,0},{151,255,0}}},  {{/*1*/{185,185,1},{153,255,0}}},  {{/*1*/{187,187,0},{155,253,0}}},
-  {{/*1*/{187,187,1},{157,253,0}}},  {{/*1*/{189,189,0},{157,255,0}}},  {{/*1*/{189,189,1},{159,255,0}}},  {{/*1*/{191,191,0},{161,253,0}}},
-  {{/*1*/{191,191,1},{163,253,0}}},  {{/*1*/{193,193,0},{163,255,0}}},  {{/*1*/{193,193,1},{165,255,0}}},  {{/*1*/{195,195,0},{167,253,0}}},
-  {{/*1*/{195,195,1},{169,253,0}}},  {{/*1*/{197,197,0},{169,255,0}}},  {{/*1*/{197,197,1},{171,255,0}}},  {{/*1*/{199,199,0},{173,253,0}}},
-  {{/*1*/{199,199,1},{175,253,0}}},  {{/*1*/{201,201,0},{175,255,0}}},  {{/*1*/{201,201,1},{177,255,0}}},  {{/*1*/{203,203,0},{179,253,0}}},
-  {{/*1*/{203,203,1},{181,253,0}}},  {{/*1*/{205,205,0},{181,255,0}}},  {{/*1*/{205,205,1},{183,255,0}}},  {{/*1*/{207,207,0},{185,253,0}}},
-  {{/*1*/{207,207,1},{187,251,0}}},  {{/*1*/{209,209,0},{187,255,0}}},  {{/*1*/{209,209,1},{189,253,0}}},  {{/*1*/{211,211,0},{191,253,0}}},
-  {{/*1*/{211,211,1},{191,255,0}}},  {{/*1*/{213,213,0},{193,255,0}}},  {{/*1*/{213,213,1},{195,253,0}}},  {{/*1*/{215,215,0},{197,253,0}}},
-  {{/*1*/{215,215,1},{197,255,0}}},  {{/*1*/{217,217,0},{199,255,0}}},  {{/*1*/{217,217,1},{201,253,0}}},  {{/*1*/{219,219,0},{203,253,0}}},
-  {{/*1*/{219,219,1},{203,255,0}}},  {{/*1*/{221,221,0},{205,255,0}}},  {{/*1*/{221,221,1},{207,253,0}}},  {{/*1*/{223,223,0},{209,253,0}}},
-  {{/*1*/{223,223,1},{209,255,0}}},  {{/*1*/{225,225,0},{211,255,0}}},  {{/*1*/{225,225,1},{213,253,0}}},  {{/*1*/{227,227,0},{215,253,0}}},
-  {{/*1*/{227,227,1},{215,255,0}}},  {{/*1*/{229,229,0},{217,255,0}}},  {{/*1*/{229,229,1},{219,253,0}}},  {{/*1*/{231,231,0},{221,253,0}}},
-  {{/*1*/{231,231,1},{221,255,0}}},  {{/*1*/{233,233,0},{223,255,0}}},  {{/*1*/{233,233,1},{225,253,0}}},  {{/*1*/{235,235,0},{227,253,0}}},
-  {{/*1*/{235,235,1},{227,255,0}}},  {{/*1*/{237,237,0},{229,255,0}}},  {{/*1*/{237,237,1},{231,253,0}}},  {{/*1*/{239,239,0},{233,253,0}}},
-  {{/*1*/{239,239,1},{233,255,0}}},  {{/*1*/{241,241,0},{235,255,0}}},  {{/*1*/{241,241,1},{237,253,0}}},  {{/*1*/{243,243,0},{239,253,0}}},
-  {{/*1*/{243,243,1},{239,255,0}}},  {{/*1*/{245,245,0},{241,255,0}}},  {{/*1*/{245,245,1},{243,253,0}}},  {{/*1*/{247,247,0},{245,253,0}}},
-  {{/*1*/{247,247,1},{245,255,0}}},  {{/*1*/{249,249,0},{247,255,0}}},  {{/*1*/{249,249,1},{249,253,0}}},  {{/*1*/{251,251,0},{251,251,0}}},
-  {{/*1*/{251,251,1},{251,255,0}}},  {{/*1*/{253,253,0},{253,253,0}}},  {{/*1*/{253,253,1},{255,253,0}}},  {{/*1*/{255,255,0},{255,255,0}}}
+  {/*1*/{  0,  0},{  0,  0},{0,0}},  {/*1*/{  0,  0},{  0,  4},{1,0}},  {/*1*/{  2,  0},{  2,  8},{0,0}},  {/*1*/{  2,  0},{  2, 10},{1,0}},
+  {/*1*/{  4,  0},{  4, 14},{0,0}},  {/*1*/{  4,  0},{  4, 16},{1,0}},  {/*1*/{  6,  0},{  6, 20},{0,0}},  {/*1*/{  6,  0},{  6, 22},{1,0}},
+  {/*1*/{  8,  0},{  8, 26},{0,0}},  {/*1*/{  8,  0},{  8, 28},{1,0}},  {/*1*/{ 10,  0},{ 10, 32},{0,0}},  {/*1*/{ 10,  0},{ 10, 34},{1,0}},
+  {/*1*/{ 12,  0},{ 12, 38},{0,0}},  {/*1*/{ 12,  0},{ 12, 40},{1,0}},  {/*1*/{ 14,  0},{ 14, 44},{0,0}},  {/*1*/{ 14,  0},{ 14, 46},{1,0}},
+  {/*1*/{ 16,  0},{ 16, 50},{0,0}},  {/*1*/{ 16,  0},{ 16, 52},{1,0}},  {/*1*/{ 18,  0},{ 18, 56},{0,0}},  {/*1*/{ 18,  0},{ 18, 58},{1,0}},
+  {/*1*/{ 20,  0},{ 20, 62},{0,0}},  {/*1*/{ 20,  0},{ 20, 64},{1,0}},  {/*1*/{ 22,  0},{ 22, 68},{0,0}},  {/*1*/{ 22,  0},{ 22, 72},{1,0}},
+  {/*1*/{ 24,  0},{ 24, 74},{0,0}},  {/*1*/{ 24,  0},{ 24, 78},{1,0}},  {/*1*/{ 26,  0},{ 26, 80},{0,0}},  {/*1*/{ 26,  0},{ 26, 84},{1,0}},
+  {/*1*/{ 28,  0},{ 28, 86},{0,0}},  {/*1*/{ 28,  0},{ 28, 90},{1,0}},  {/*1*/{ 30,  0},{ 30, 92},{0,0}},  {/*1*/{ 30,  0},{ 30, 96},{1,0}},
+  {/*1*/{ 32,  0},{ 32, 98},{0,0}},  {/*1*/{ 32,  0},{ 32,102},{1,0}},  {/*1*/{ 34,  0},{ 34,104},{0,0}},  {/*1*/{ 34,  0},{ 34,108},{1,0}},
+  {/*1*/{ 36,  0},{ 36,110},{0,0}},  {/*1*/{ 36,  0},{ 36,114},{1,0}},  {/*1*/{ 38,  0},{ 38,116},{0,0}},  {/*1*/{ 38,  0},{ 38,120},{1,0}},
+  {/*1*/{ 40,  0},{ 40,122},{0,0}},  {/*1*/{ 40,  0},{ 40,126},{1,0}},  {/*1*/{ 42,  0},{ 42,129},{0,0}},  {/*1*/{ 42,  0},{ 42,133},{1,0}},
+  {/*1*/{ 44,  0},{ 44,135},{0,0}},  {/*1*/{ 44,  0},{ 44,139},{1,0}},  {/*1*/{ 46,  0},{ 46,141},{0,0}},  {/*1*/{ 46,  0},{ 46,145},{1,0}},
+  {/*1*/{ 48,  0},{ 48,147},{0,0}},  {/*1*/{ 48,  0},{ 48,151},{1,0}},  {/*1*/{ 50,  0},{ 50,153},{0,0}},  {/*1*/{ 50,  0},{ 50,157},{1,0}},
+  {/*1*/{ 52,  0},{ 52,159},{0,0}},  {/*1*/{ 52,  0},{ 52,163},{1,0}},  {/*1*/{ 54,  0},{ 54,165},{0,0}},  {/*1*/{ 54,  0},{ 54,169},{1,0}},
+  {/*1*/{ 56,  0},{ 56,171},{0,0}},  {/*1*/{ 56,  0},{ 56,175},{1,0}},  {/*1*/{ 58,  0},{ 58,177},{0,0}},  {/*1*/{ 58,  0},{ 58,181},{1,0}},
+  {/*1*/{ 60,  0},{ 60,183},{0,0}},  {/*1*/{ 60,  0},{ 60,187},{1,0}},  {/*1*/{ 62,  0},{ 62,189},{0,0}},  {/*1*/{ 62,  0},{ 62,193},{1,0}},
+  {/*1*/{ 64,  0},{ 64,197},{0,0}},  {/*1*/{ 64,  0},{ 64,199},{1,0}},  {/*1*/{ 66,  0},{ 66,203},{0,0}},  {/*1*/{ 66,  0},{ 66,205},{1,0}},
+  {/*1*/{ 68,  0},{ 68,209},{0,0}},  {/*1*/{ 68,  0},{ 68,211},{1,0}},  {/*1*/{ 70,  0},{ 70,215},{0,0}},  {/*1*/{ 70,  0},{ 70,217},{1,0}},
+  {/*1*/{ 72,  0},{ 72,221},{0,0}},  {/*1*/{ 72,  0},{ 72,223},{1,0}},  {/*1*/{ 74,  0},{ 74,227},{0,0}},  {/*1*/{ 74,  0},{ 74,229},{1,0}},
+  {/*1*/{ 76,  0},{ 76,233},{0,0}},  {/*1*/{ 76,  0},{ 76,235},{1,0}},  {/*1*/{ 78,  0},{ 78,239},{0,0}},  {/*1*/{ 78,  0},{ 78,241},{1,0}},
+  {/*1*/{ 80,  0},{ 80,245},{0,0}},  {/*1*/{ 80,  0},{ 80,247},{1,0}},  {/*1*/{ 82,  0},{ 82,251},{0,0}},  {/*1*/{ 82,  0},{ 82,253},{1,0}},
+  {/*1*/{ 84,  2},{ 84,253},{0,0}},  {/*1*/{ 84,  2},{ 84,255},{1,0}},  {/*1*/{ 86,  4},{ 86,255},{0,0}},  {/*1*/{ 86,  6},{ 86,253},{1,0}},
+  {/*1*/{ 88,  8},{ 88,253},{0,0}},  {/*1*/{ 88,  8},{ 88,255},{1,0}},  {/*1*/{ 90, 10},{ 90,255},{0,0}},  {/*1*/{ 90, 12},{ 90,253},{1,0}},
+  {/*1*/{ 92, 14},{ 92,253},{0,0}},  {/*1*/{ 92, 14},{ 92,255},{1,0}},  {/*1*/{ 94, 16},{ 94,255},{0,0}},  {/*1*/{ 94, 18},{ 94,253},{1,0}},
+  {/*1*/{ 96, 20},{ 96,253},{0,0}},  {/*1*/{ 96, 20},{ 96,255},{1,0}},  {/*1*/{ 98, 22},{ 98,255},{0,0}},  {/*1*/{ 98, 24},{ 98,253},{1,0}},
+  {/*1*/{100, 26},{100,253},{0,0}},  {/*1*/{100, 26},{100,255},{1,0}},  {/*1*/{102, 28},{102,255},{0,0}},  {/*1*/{102, 30},{102,253},{1,0}},
+  {/*1*/{104, 32},{104,253},{0,0}},  {/*1*/{104, 32},{104,255},{1,0}},  {/*1*/{106, 34},{106,255},{0,0}},  {/*1*/{106, 36},{106,253},{1,0}},
+  {/*1*/{108, 38},{108,253},{0,0}},  {/*1*/{108, 38},{108,255},{1,0}},  {/*1*/{110, 40},{110,255},{0,0}},  {/*1*/{110, 42},{110,253},{1,0}},
+  {/*1*/{112, 44},{112,253},{0,0}},  {/*1*/{112, 44},{112,255},{1,0}},  {/*1*/{114, 46},{114,255},{0,0}},  {/*1*/{114, 48},{114,253},{1,0}},
+  {/*1*/{116, 50},{116,253},{0,0}},  {/*1*/{116, 50},{116,255},{1,0}},  {/*1*/{118, 52},{118,255},{0,0}},  {/*1*/{118, 54},{118,253},{1,0}},
+  {/*1*/{120, 56},{120,253},{0,0}},  {/*1*/{120, 56},{120,255},{1,0}},  {/*1*/{122, 58},{122,255},{0,0}},  {/*1*/{122, 60},{122,253},{1,0}},
+  {/*1*/{124, 62},{124,251},{0,0}},  {/*1*/{124, 62},{124,255},{1,0}},  {/*1*/{126, 64},{126,253},{0,0}},  {/*1*/{126, 66},{126,253},{1,0}},
+  {/*1*/{129, 66},{129,255},{1,0}},  {/*1*/{129, 68},{129,255},{0,0}},  {/*1*/{129, 70},{129,253},{1,0}},  {/*1*/{131, 72},{131,253},{0,0}},
+  {/*1*/{131, 72},{131,255},{1,0}},  {/*1*/{133, 74},{133,255},{0,0}},  {/*1*/{133, 76},{133,253},{1,0}},  {/*1*/{135, 78},{135,253},{0,0}},
+  {/*1*/{135, 78},{135,255},{1,0}},  {/*1*/{137, 80},{137,255},{0,0}},  {/*1*/{137, 82},{137,253},{1,0}},  {/*1*/{139, 84},{139,253},{0,0}},
+  {/*1*/{139, 84},{139,255},{1,0}},  {/*1*/{141, 86},{141,255},{0,0}},  {/*1*/{141, 88},{141,253},{1,0}},  {/*1*/{143, 90},{143,253},{0,0}},
+  {/*1*/{143, 90},{143,255},{1,0}},  {/*1*/{145, 92},{145,255},{0,0}},  {/*1*/{145, 94},{145,253},{1,0}},  {/*1*/{147, 96},{147,253},{0,0}},
+  {/*1*/{147, 96},{147,255},{1,0}},  {/*1*/{149, 98},{149,255},{0,0}},  {/*1*/{149,100},{149,253},{1,0}},  {/*1*/{151,102},{151,253},{0,0}},
+  {/*1*/{151,102},{151,255},{1,0}},  {/*1*/{153,104},{153,255},{0,0}},  {/*1*/{153,106},{153,253},{1,0}},  {/*1*/{155,108},{155,253},{0,0}},
+  {/*1*/{155,108},{155,255},{1,0}},  {/*1*/{157,110},{157,255},{0,0}},  {/*1*/{157,112},{157,253},{1,0}},  {/*1*/{159,114},{159,253},{0,0}},
+  {/*1*/{159,114},{159,255},{1,0}},  {/*1*/{161,116},{161,255},{0,0}},  {/*1*/{161,118},{161,253},{1,0}},  {/*1*/{163,120},{163,253},{0,0}},
+  {/*1*/{163,120},{163,255},{1,0}},  {/*1*/{165,122},{165,255},{0,0}},  {/*1*/{165,124},{165,253},{1,0}},  {/*1*/{167,126},{167,251},{0,0}},
+  {/*1*/{167,126},{167,255},{1,0}},  {/*1*/{169,129},{169,251},{0,0}},  {/*1*/{169,129},{169,255},{1,0}},  {/*1*/{171,131},{171,253},{0,0}},
+  {/*1*/{171,133},{171,253},{1,0}},  {/*1*/{173,133},{173,255},{0,0}},  {/*1*/{173,135},{173,255},{1,0}},  {/*1*/{175,137},{175,253},{0,0}},
+  {/*1*/{175,139},{175,253},{1,0}},  {/*1*/{177,139},{177,255},{0,0}},  {/*1*/{177,141},{177,255},{1,0}},  {/*1*/{179,143},{179,253},{0,0}},
+  {/*1*/{179,145},{179,253},{1,0}},  {/*1*/{181,145},{181,255},{0,0}},  {/*1*/{181,147},{181,255},{1,0}},  {/*1*/{183,149},{183,253},{0,0}},
+  {/*1*/{183,151},{183,253},{1,0}},  {/*1*/{185,151},{185,255},{0,0}},  {/*1*/{185,153},{185,255},{1,0}},  {/*1*/{187,155},{187,253},{0,0}},
+  {/*1*/{187,157},{187,253},{1,0}},  {/*1*/{189,157},{189,255},{0,0}},  {/*1*/{189,159},{189,255},{1,0}},  {/*1*/{191,161},{191,253},{0,0}},
+  {/*1*/{191,163},{191,253},{1,0}},  {/*1*/{193,163},{193,255},{0,0}},  {/*1*/{193,165},{193,255},{1,0}},  {/*1*/{195,167},{195,253},{0,0}},
+  {/*1*/{195,169},{195,253},{1,0}},  {/*1*/{197,169},{197,255},{0,0}},  {/*1*/{197,171},{197,255},{1,0}},  {/*1*/{199,173},{199,253},{0,0}},
+  {/*1*/{199,175},{199,253},{1,0}},  {/*1*/{201,175},{201,255},{0,0}},  {/*1*/{201,177},{201,255},{1,0}},  {/*1*/{203,179},{203,253},{0,0}},
+  {/*1*/{203,181},{203,253},{1,0}},  {/*1*/{205,181},{205,255},{0,0}},  {/*1*/{205,183},{205,255},{1,0}},  {/*1*/{207,185},{207,253},{0,0}},
+  {/*1*/{207,187},{207,251},{1,0}},  {/*1*/{209,187},{209,255},{0,0}},  {/*1*/{209,189},{209,253},{1,0}},  {/*1*/{211,191},{211,253},{0,0}},
+  {/*1*/{211,191},{211,255},{1,0}},  {/*1*/{213,193},{213,255},{0,0}},  {/*1*/{213,195},{213,253},{1,0}},  {/*1*/{215,197},{215,253},{0,0}},
+  {/*1*/{215,197},{215,255},{1,0}},  {/*1*/{217,199},{217,255},{0,0}},  {/*1*/{217,201},{217,253},{1,0}},  {/*1*/{219,203},{219,253},{0,0}},
+  {/*1*/{219,203},{219,255},{1,0}},  {/*1*/{221,205},{221,255},{0,0}},  {/*1*/{221,207},{221,253},{1,0}},  {/*1*/{223,209},{223,253},{0,0}},
+  {/*1*/{223,209},{223,255},{1,0}},  {/*1*/{225,211},{225,255},{0,0}},  {/*1*/{225,213},{225,253},{1,0}},  {/*1*/{227,215},{227,253},{0,0}},
+  {/*1*/{227,215},{227,255},{1,0}},  {/*1*/{229,217},{229,255},{0,0}},  {/*1*/{229,219},{229,253},{1,0}},  {/*1*/{231,221},{231,253},{0,0}},
+  {/*1*/{231,221},{231,255},{1,0}},  {/*1*/{233,223},{233,255},{0,0}},  {/*1*/{233,225},{233,253},{1,0}},  {/*1*/{235,227},{235,253},{0,0}},
+  {/*1*/{235,227},{235,255},{1,0}},  {/*1*/{237,229},{237,255},{0,0}},  {/*1*/{237,231},{237,253},{1,0}},  {/*1*/{239,233},{239,253},{0,0}},
+  {/*1*/{239,233},{239,255},{1,0}},  {/*1*/{241,235},{241,255},{0,0}},  {/*1*/{241,237},{241,253},{1,0}},  {/*1*/{243,239},{243,253},{0,0}},
+  {/*1*/{243,239},{243,255},{1,0}},  {/*1*/{245,241},{245,255},{0,0}},  {/*1*/{245,243},{245,253},{1,0}},  {/*1*/{247,245},{247,253},{0,0}},
+  {/*1*/{247,245},{247,255},{1,0}},  {/*1*/{249,247},{249,255},{0,0}},  {/*1*/{249,249},{249,253},{1,0}},  {/*1*/{251,251},{251,251},{0,0}},
+  {/*1*/{251,251},{251,255},{1,0}},  {/*1*/{253,253},{253,253},{0,0}},  {/*1*/{253,255},{253,253},{1,0}},  {/*1*/{255,255},{255,255},{0,0}}
 };
 
 /* 256 * 2 * 3 * 1 = 1536 */
 static PaletteSingleLookup2 const sp_lookup_8_4[256] =
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  1,  1,0},{  0,  4,0}}},  {{/*1*/{  2,  2,0},{  0,  7,0}}},  {{/*1*/{  3,  3,0},{  0, 10,0}}},
-  {{/*1*/{  4,  4,0},{  0, 13,0}}},  {{/*1*/{  5,  5,0},{  0, 16,0}}},  {{/*1*/{  6,  6,0},{  0, 19,0}}},  {{/*1*/{  7,  7,0},{  0, 22,0}}},
-  {{/*1*/{  8,  8,0},{  0, 25,0}}},  {{/*1*/{  9,  9,0},{  0, 28,0}}},  {{/*1*/{ 10, 10,0},{  0, 31,0}}},  {{/*1*/{ 11, 11,0},{  0, 34,0}}},
-  {{/*1*/{ 12, 12,0},{  0, 37,0}}},  {{/*1*/{ 13, 13,0},{  0, 40,0}}},  {{/*1*/{ 14, 14,0},{  0, 43,0}}},  {{/*1*/{ 15, 15,0},{  0, 46,0}}},
-  {{/*1*/{ 16, 16,0},{  0, 49,0}}},  {{/*1*/{ 17, 17,0},{  0, 52,0}}},  {{/*1*/{ 18, 18,0},{  0, 55,0}}},  {{/*1*/{ 19, 19,0},{  0, 58,0}}},
-  {{/*1*/{ 20, 20,0},{  0, 61,0}}},  {{/*1*/{ 21, 21,0},{  0, 64,0}}},  {{/*1*/{ 22, 22,0},{  0, 68,0}}},  {{/*1*/{ 23, 23,0},{  0, 71,0}}},
-  {{/*1*/{ 24, 24,0},{  0, 74,0}}},  {{/*1*/{ 25, 25,0},{  0, 77,0}}},  {{/*1*/{ 26, 26,0},{  0, 80,0}}},  {{/*1*/{ 27, 27,0},{  0, 83,0}}},
-  {{/*1*/{ 28, 28,0},{  0, 86,0}}},  {{/*1*/{ 29, 29,0},{  0, 89,0}}},  {{/*1*/{ 30, 30,0},{  0, 92,0}}},  {{/*1*/{ 31, 31,0},{  0, 95,0}}},
-  {{/*1*/{ 32, 32,0},{  0, 98,0}}},  {{/*1*/{ 33, 33,0},{  0,101,0}}},  {{/*1*/{ 34, 34,0},{  0,104,0}}},  {{/*1*/{ 35, 35,0},{  0,107,0}}},
-  {{/*1*/{ 36, 36,0},{  0,110,0}}},  {{/*1*/{ 37, 37,0},{  0,113,0}}},  {{/*1*/{ 38, 38,0},{  0,116,0}}},  {{/*1*/{ 39, 39,0},{  0,119,0}}},
-  {{/*1*/{ 40, 40,0},{  0,122,0}}},  {{/*1*/{ 41, 41,0},{  0,125,0}}},  {{/*1*/{ 42, 42,0},{  0,128,0}}},  {{/*1*/{ 43, 43,0},{  0,132,0}}},
-  {{/*1*/{ 44, 44,0},{  0,135,0}}},  {{/*1*/{ 45, 45,0},{  0,138,0}}},  {{/*1*/{ 46, 46,0},{  0,141,0}}},  {{/*1*/{ 47, 47,0},{  0,144,0}}},
-  {{/*1*/{ 48, 48,0},{  0,147,0}}},  {{/*1*/{ 49, 49,0},{  0,150,0}}},  {{/*1*/{ 50, 50,0},{  0,153,0}}},  {{/*1*/{ 51, 51,0},{  0,156,0}}},
-  {{/*1*/{ 52, 52,0},{  0,159,0}}},  {{/*1*/{ 53, 53,0},{  0,162,0}}},  {{/*1*/{ 54, 54,0},{  0,165,0}}},  {{/*1*/{ 55, 55,0},{  0,168,0}}},
-  {{/*1*/{ 56, 56,0},{  0,171,0}}},  {{/*1*/{ 57, 57,0},{  0,174,0}}},  {{/*1*/{ 58, 58,0},{  0,177,0}}},  {{/*1*/{ 59, 59,0},{  0,180,0}}},
-  {{/*1*/{ 60, 60,0},{  0,183,0}}},  {{/*1*/{ 61, 61,0},{  0,186,0}}},  {{/*1*/{ 62, 62,0},{  0,189,0}}},  {{/*1*/{ 63, 63,0},{  0,192,0}}},
-  {{/*1*/{ 64, 64,0},{  0,196,0}}},  {{/*1*/{ 65, 65,0},{  0,199,0}}},  {{/*1*/{ 66, 66,0},{  0,202,0}}},  {{/*1*/{ 67, 67,0},{  0,205,0}}},
-  {{/*1*/{ 68, 68,0},{  0,208,0}}},  {{/*1*/{ 69, 69,0},{  0,211,0}}},  {{/*1*/{ 70, 70,0},{  0,214,0}}},  {{/*1*/{ 71, 71,0},{  0,217,0}}},
-  {{/*1*/{ 72, 72,0},{  0,220,0}}},  {{/*1*/{ 73, 73,0},{  0,223,0}}},  {{/*1*/{ 74, 74,0},{  0,226,0}}},  {{/*1*/{ 75, 75,0},{  0,229,0}}},
-  {{/*1*/{ 76, 76,0},{  0,232,0}}},  {{/*1*/{ 77, 77,0},{  0,235,0}}},  {{/*1*/{ 78, 78,0},{  0,238,0}}},  {{/*1*/{ 79, 79,0},{  0,241,0}}},
-  {{/*1*/{ 80, 80,0},{  0,244,0}}},  {{/*1*/{ 81, 81,0},{  0,247,0}}},  {{/*1*/{ 82, 82,0},{  0,250,0}}},  {{/*1*/{ 83, 83,0},{  0,253,0}}},
-  {{/*1*/{ 84, 84,0},{  1,254,0}}},  {{/*1*/{ 85, 85,0},{  2,255,0}}},  {{/*1*/{ 86, 86,0},{  4,254,0}}},  {{/*1*/{ 87, 87,0},{  5,255,0}}},
-  {{/*1*/{ 88, 88,0},{  7,254,0}}},  {{/*1*/{ 89, 89,0},{  8,255,0}}},  {{/*1*/{ 90, 90,0},{ 10,254,0}}},  {{/*1*/{ 91, 91,0},{ 11,255,0}}},
-  {{/*1*/{ 92, 92,0},{ 13,254,0}}},  {{/*1*/{ 93, 93,0},{ 14,255,0}}},  {{/*1*/{ 94, 94,0},{ 16,254,0}}},  {{/*1*/{ 95, 95,0},{ 17,255,0}}},
-  {{/*1*/{ 96, 96,0},{ 19,254,0}}},  {{/*1*/{ 97, 97,0},{ 20,255,0}}},  {{/*1*/{ 98, 98,0},{ 22,254,0}}},  {{/*1*/{ 99, 99,0},{ 23,255,0}}},
-  {{/*1*/{100,100,0},{ 25,254,0}}},  {{/*1*/{101,101,0},{ 26,255,0}}},  {{/*1*/{102,102,0},{ 28,254,0}}},  {{/*1*/{103,103,0},{ 29,255,0}}},
-  {{/*1*/{104,104,0},{ 31,254,0}}},  {{/*1*/{105,105,0},{ 32,255,0}}},  {{/*1*/{106,106,0},{ 34,254,0}}},  {{/*1*/{107,107,0},{ 35,255,0}}},
-  {{/*1*/{108,108,0},{ 37,254,0}}},  {{/*1*/{109,109,0},{ 38,255,0}}},  {{/*1*/{110,110,0},{ 40,254,0}}},  {{/*1*/{111,111,0},{ 41,255,0}}},
-  {{/*1*/{112,112,0},{ 43,254,0}}},  {{/*1*/{113,113,0},{ 44,255,0}}},  {{/*1*/{114,114,0},{ 46,254,0}}},  {{/*1*/{115,115,0},{ 47,255,0}}},
-  {{/*1*/{116,116,0},{ 49,254,0}}},  {{/*1*/{117,117,0},{ 50,255,0}}},  {{/*1*/{118,118,0},{ 52,254,0}}},  {{/*1*/{119,119,0},{ 53,255,0}}},
-  {{/*1*/{120,120,0},{ 55,254,0}}},  {{/*1*/{121,121,0},{ 56,255,0}}},  {{/*1*/{122,122,0},{ 58,254,0}}},  {{/*1*/{123,123,0},{ 59,255,0}}},
-  {{/*1*/{124,124,0},{ 61,253,0}}},  {{/*1*/{125,125,0},{ 62,254,0}}},  {{/*1*/{126,126,0},{ 63,255,0}}},  {{/*1*/{127,127,0},{ 65,254,0}}},
-  {{/*1*/{128,128,0},{ 66,255,0}}},  {{/*1*/{129,129,0},{ 68,254,0}}},  {{/*1*/{130,130,0},{ 69,255,0}}},  {{/*1*/{131,131,0},{ 71,254,0}}},
-  {{/*1*/{132,132,0},{ 72,255,0}}},  {{/*1*/{133,133,0},{ 74,254,0}}},  {{/*1*/{134,134,0},{ 75,255,0}}},  {{/*1*/{135,135,0},{ 77,254,0}}},
-  {{/*1*/{136,136,0},{ 78,255,0}}},  {{/*1*/{137,137,0},{ 80,254,0}}},  {{/*1*/{138,138,0},{ 81,255,0}}},  {{/*1*/{139,139,0},{ 83,254,0}}},
-  {{/*1*/{140,140,0},{ 84,255,0}}},  {{/*1*/{141,141,0},{ 86,254,0}}},  {{/*1*/{142,142,0},{ 87,255,0}}},  {{/*1*/{143,143,0},{ 89,254,0}}},
-  {{/*1*/{144,144,0},{ 90,255,0}}},  {{/*1*/{145,145,0},{ 92,254,0}}},  {{/*1*/{146,146,0},{ 93,255,0}}},  {{/*1*/{147,147,0},{ 95,254,0}}},
-  {{/*1*/{148,148,0},{ 96,255,0}}},  {{/*1*/{149,149,0},{ 98,254,0}}},  {{/*1*/{150,150,0},{ 99,255,0}}},  {{/*1*/{151,151,0},{101,254,0}}},
-  {{/*1*/{152,152,0},{102,255,0}}},  {{/*1*/{153,153,0},{104,254,0}}},  {{/*1*/{154,154,0},{105,255,0}}},  {{/*1*/{155,155,0},{107,254,0}}},
-  {{/*1*/{156,156,0},{108,255,0}}},  {{/*1*/{157,157,0},{110,254,0}}},  {{/*1*/{158,158,0},{111,255,0}}},  {{/*1*/{159,159,0},{113,254,0}}},
-  {{/*1*/{160,160,0},{114,255,0}}},  {{/*1*/{161,161,0},{116,254,0}}},  {{/*1*/{162,162,0},{117,255,0}}},  {{/*1*/{163,163,0},{119,254,0}}},
-  {{/*1*/{164,164,0},{120,255,0}}},  {{/*1*/{165,165,0},{122,254,0}}},  {{/*1*/{166,166,0},{123,255,0}}},  {{/*1*/{167,167,0},{125,253,0}}},
-  {{/*1*/{168,168,0},{126,254,0}}},  {{/*1*/{169,169,0},{127,255,0}}},  {{/*1*/{170,170,0},{129,254,0}}},  {{/*1*/{171,171,0},{130,255,0}}},
-  {{/*1*/{172,172,0},{132,254,0}}},  {{/*1*/{173,173,0},{133,255,0}}},  {{/*1*/{174,174,0},{135,254,0}}},  {{/*1*/{175,175,0},{136,255,0}}},
-  {{/*1*/{176,176,0},{138,254,0}}},  {{/*1*/{177,177,0},{139,255,0}}},  {{/*1*/{178,178,0},{141,254,0}}},  {{/*1*/{179,179,0},{142,255,0}}},
-  {{/*1*/{180,180,0},{144,254,0}}},  {{/*1*/{181,181,0},{145,255,0}}},  {{/*1*/{182,182,0},{147,254,0}}},  {{/*1*/{183,183,0},{148,255,0}}},
-  {{/*1*/{184,184,0},{150,254,0}}},  {{/*1*/{185,185,0},{151,255,0}}},  {{/*1*/{186,186,0},{153,254,0}}},  {{/*1*/{187,187,0},{154,255,0}}},
-  {{/*1*/{188,188,0},{156,254,0}}},  {{/*1*/{189,189,0},{157,255,0}}},  {{/*1*/{190,190,0},{159,254,0}}},  {{/*1*/{191,191,0},{160,255,0}}},
-  {{/*1*/{192,192,0},{162,254,0}}},  {{/*1*/{193,193,0},{163,255,0}}},  {{/*1*/{194,194,0},{165,254,0}}},  {{/*1*/{195,195,0},{166,255,0}}},
-  {{/*1*/{196,196,0},{168,254,0}}},  {{/*1*/{197,197,0},{169,255,0}}},  {{/*1*/{198,198,0},{171,254,0}}},  {{/*1*/{199,199,0},{172,255,0}}},
-  {{/*1*/{200,200,0},{174,254,0}}},  {{/*1*/{201,201,0},{175,255,0}}},  {{/*1*/{202,202,0},{177,254,0}}},  {{/*1*/{203,203,0},{178,255,0}}},
-  {{/*1*/{204,204,0},{180,254,0}}},  {{/*1*/{205,205,0},{181,255,0}}},  {{/*1*/{206,206,0},{183,254,0}}},  {{/*1*/{207,207,0},{184,255,0}}},
-  {{/*1*/{208,208,0},{186,254,0}}},  {{/*1*/{209,209,0},{187,255,0}}},  {{/*1*/{210,210,0},{189,253,0}}},  {{/*1*/{211,211,0},{190,254,0}}},
-  {{/*1*/{212,212,0},{191,255,0}}},  {{/*1*/{213,213,0},{193,254,0}}},  {{/*1*/{214,214,0},{194,255,0}}},  {{/*1*/{215,215,0},{196,254,0}}},
-  {{/*1*/{216,216,0},{197,255,0}}},  {{/*1*/{217,217,0},{199,254,0}}},  {{/*1*/{218,218,0},{200,255,0}}},  {{/*1*/{219,219,0},{202,254,0}}},
-  {{/*1*/{220,220,0},{203,255,0}}},  {{/*1*/{221,221,0},{205,254,0}}},  {{/*1*/{222,222,0},{206,255,0}}},  {{/*1*/{223,223,0},{208,254,0}}},
-  {{/*1*/{224,224,0},{209,255,0}}},  {{/*1*/{225,225,0},{211,254,0}}},  {{/*1*/{226,226,0},{212,255,0}}},  {{/*1*/{227,227,0},{214,254,0}}},
-  {{/*1*/{228,228,0},{215,255,0}}},  {{/*1*/{229,229,0},{217,254,0}}},  {{/*1*/{230,230,0},{218,255,0}}},  {{/*1*/{231,231,0},{220,254,0}}},
-  {{/*1*/{232,232,0},{221,255,0}}},  {{/*1*/{233,233,0},{223,254,0}}},  {{/*1*/{234,234,0},{224,255,0}}},  {{/*1*/{235,235,0},{226,254,0}}},
-  {{/*1*/{236,236,0},{227,255,0}}},  {{/*1*/{237,237,0},{229,254,0}}},  {{/*1*/{238,238,0},{230,255,0}}},  {{/*1*/{239,239,0},{232,254,0}}},
-  {{/*1*/{240,240,0},{233,255,0}}},  {{/*1*/{241,241,0},{235,254,0}}},  {{/*1*/{242,242,0},{236,255,0}}},  {{/*1*/{243,243,0},{238,254,0}}},
-  {{/*1*/{244,244,0},{239,255,0}}},  {{/*1*/{245,245,0},{241,254,0}}},  {{/*1*/{246,246,0},{242,255,0}}},  {{/*1*/{247,247,0},{244,254,0}}},
-  {{/*1*/{248,248,0},{245,255,0}}},  {{/*1*/{249,249,0},{247,254,0}}},  {{/*1*/{250,250,0},{248,255,0}}},  {{/*1*/{251,251,0},{250,254,0}}},
-  {{/*1*/{252,252,0},{251,255,0}}},  {{/*1*/{253,253,0},{253,253,0}}},  {{/*1*/{254,254,0},{254,254,0}}},  {{/*1*/{255,255,0},{255,255,0}}}
+  {/*1*/{  0,  0},{  0,  0},{0,0}},  {/*1*/{  1,  0},{  1,  4},{0,0}},  {/*1*/{  2,  0},{  2,  7},{0,0}},  {/*1*/{  3,  0},{  3, 10},{0,0}},
+  {/*1*/{  4,  0},{  4, 13},{0,0}},  {/*1*/{  5,  0},{  5, 16},{0,0}},  {/*1*/{  6,  0},{  6, 19},{0,0}},  {/*1*/{  7,  0},{  7, 22},{0,0}},
+  {/*1*/{  8,  0},{  8, 25},{0,0}},  {/*1*/{  9,  0},{  9, 28},{0,0}},  {/*1*/{ 10,  0},{ 10, 31},{0,0}},  {/*1*/{ 11,  0},{ 11, 34},{0,0}},
+  {/*1*/{ 12,  0},{ 12, 37},{0,0}},  {/*1*/{ 13,  0},{ 13, 40},{0,0}},  {/*1*/{ 14,  0},{ 14, 43},{0,0}},  {/*1*/{ 15,  0},{ 15, 46},{0,0}},
+  {/*1*/{ 16,  0},{ 16, 49},{0,0}},  {/*1*/{ 17,  0},{ 17, 52},{0,0}},  {/*1*/{ 18,  0},{ 18, 55},{0,0}},  {/*1*/{ 19,  0},{ 19, 58},{0,0}},
+  {/*1*/{ 20,  0},{ 20, 61},{0,0}},  {/*1*/{ 21,  0},{ 21, 64},{0,0}},  {/*1*/{ 22,  0},{ 22, 68},{0,0}},  {/*1*/{ 23,  0},{ 23, 71},{0,0}},
+  {/*1*/{ 24,  0},{ 24, 74},{0,0}},  {/*1*/{ 25,  0},{ 25, 77},{0,0}},  {/*1*/{ 26,  0},{ 26, 80},{0,0}},  {/*1*/{ 27,  0},{ 27, 83},{0,0}},
+  {/*1*/{ 28,  0},{ 28, 86},{0,0}},  {/*1*/{ 29,  0},{ 29, 89},{0,0}},  {/*1*/{ 30,  0},{ 30, 92},{0,0}},  {/*1*/{ 31,  0},{ 31, 95},{0,0}},
+  {/*1*/{ 32,  0},{ 32, 98},{0,0}},  {/*1*/{ 33,  0},{ 33,101},{0,0}},  {/*1*/{ 34,  0},{ 34,104},{0,0}},  {/*1*/{ 35,  0},{ 35,107},{0,0}},
+  {/*1*/{ 36,  0},{ 36,110},{0,0}},  {/*1*/{ 37,  0},{ 37,113},{0,0}},  {/*1*/{ 38,  0},{ 38,116},{0,0}},  {/*1*/{ 39,  0},{ 39,119},{0,0}},
+  {/*1*/{ 40,  0},{ 40,122},{0,0}},  {/*1*/{ 41,  0},{ 41,125},{0,0}},  {/*1*/{ 42,  0},{ 42,128},{0,0}},  {/*1*/{ 43,  0},{ 43,132},{0,0}},
+  {/*1*/{ 44,  0},{ 44,135},{0,0}},  {/*1*/{ 45,  0},{ 45,138},{0,0}},  {/*1*/{ 46,  0},{ 46,141},{0,0}},  {/*1*/{ 47,  0},{ 47,144},{0,0}},
+  {/*1*/{ 48,  0},{ 48,147},{0,0}},  {/*1*/{ 49,  0},{ 49,150},{0,0}},  {/*1*/{ 50,  0},{ 50,153},{0,0}},  {/*1*/{ 51,  0},{ 51,156},{0,0}},
+  {/*1*/{ 52,  0},{ 52,159},{0,0}},  {/*1*/{ 53,  0},{ 53,162},{0,0}},  {/*1*/{ 54,  0},{ 54,165},{0,0}},  {/*1*/{ 55,  0},{ 55,168},{0,0}},
+  {/*1*/{ 56,  0},{ 56,171},{0,0}},  {/*1*/{ 57,  0},{ 57,174},{0,0}},  {/*1*/{ 58,  0},{ 58,177},{0,0}},  {/*1*/{ 59,  0},{ 59,180},{0,0}},
+  {/*1*/{ 60,  0},{ 60,183},{0,0}},  {/*1*/{ 61,  0},{ 61,186},{0,0}},  {/*1*/{ 62,  0},{ 62,189},{0,0}},  {/*1*/{ 63,  0},{ 63,192},{0,0}},
+  {/*1*/{ 64,  0},{ 64,196},{0,0}},  {/*1*/{ 65,  0},{ 65,199},{0,0}},  {/*1*/{ 66,  0},{ 66,202},{0,0}},  {/*1*/{ 67,  0},{ 67,205},{0,0}},
+  {/*1*/{ 68,  0},{ 68,208},{0,0}},  {/*1*/{ 69,  0},{ 69,211},{0,0}},  {/*1*/{ 70,  0},{ 70,214},{0,0}},  {/*1*/{ 71,  0},{ 71,217},{0,0}},
+  {/*1*/{ 72,  0},{ 72,220},{0,0}},  {/*1*/{ 73,  0},{ 73,223},{0,0}},  {/*1*/{ 74,  0},{ 74,226},{0,0}},  {/*1*/{ 75,  0},{ 75,229},{0,0}},
+  {/*1*/{ 76,  0},{ 76,232},{0,0}},  {/*1*/{ 77,  0},{ 77,235},{0,0}},  {/*1*/{ 78,  0},{ 78,238},{0,0}},  {/*1*/{ 79,  0},{ 79,241},{0,0}},
+  {/*1*/{ 80,  0},{ 80,244},{0,0}},  {/*1*/{ 81,  0},{ 81,247},{0,0}},  {/*1*/{ 82,  0},{ 82,250},{0,0}},  {/*1*/{ 83,  0},{ 83,253},{0,0}},
+  {/*1*/{ 84,  1},{ 84,254},{0,0}},  {/*1*/{ 85,  2},{ 85,255},{0,0}},  {/*1*/{ 86,  4},{ 86,254},{0,0}},  {/*1*/{ 87,  5},{ 87,255},{0,0}},
+  {/*1*/{ 88,  7},{ 88,254},{0,0}},  {/*1*/{ 89,  8},{ 89,255},{0,0}},  {/*1*/{ 90, 10},{ 90,254},{0,0}},  {/*1*/{ 91, 11},{ 91,255},{0,0}},
+  {/*1*/{ 92, 13},{ 92,254},{0,0}},  {/*1*/{ 93, 14},{ 93,255},{0,0}},  {/*1*/{ 94, 16},{ 94,254},{0,0}},  {/*1*/{ 95, 17},{ 95,255},{0,0}},
+  {/*1*/{ 96, 19},{ 96,254},{0,0}},  {/*1*/{ 97, 20},{ 97,255},{0,0}},  {/*1*/{ 98, 22},{ 98,254},{0,0}},  {/*1*/{ 99, 23},{ 99,255},{0,0}},
+  {/*1*/{100, 25},{100,254},{0,0}},  {/*1*/{101, 26},{101,255},{0,0}},  {/*1*/{102, 28},{102,254},{0,0}},  {/*1*/{103, 29},{103,255},{0,0}},
+  {/*1*/{104, 31},{104,254},{0,0}},  {/*1*/{105, 32},{105,255},{0,0}},  {/*1*/{106, 34},{106,254},{0,0}},  {/*1*/{107, 35},{107,255},{0,0}},
+  {/*1*/{108, 37},{108,254},{0,0}},  {/*1*/{109, 38},{109,255},{0,0}},  {/*1*/{110, 40},{110,254},{0,0}},  {/*1*/{111, 41},{111,255},{0,0}},
+  {/*1*/{112, 43},{112,254},{0,0}},  {/*1*/{113, 44},{113,255},{0,0}},  {/*1*/{114, 46},{114,254},{0,0}},  {/*1*/{115, 47},{115,255},{0,0}},
+  {/*1*/{116, 49},{116,254},{0,0}},  {/*1*/{117, 50},{117,255},{0,0}},  {/*1*/{118, 52},{118,254},{0,0}},  {/*1*/{119, 53},{119,255},{0,0}},
+  {/*1*/{120, 55},{120,254},{0,0}},  {/*1*/{121, 56},{121,255},{0,0}},  {/*1*/{122, 58},{122,254},{0,0}},  {/*1*/{123, 59},{123,255},{0,0}},
+  {/*1*/{124, 61},{124,253},{0,0}},  {/*1*/{125, 62},{125,254},{0,0}},  {/*1*/{126, 63},{126,255},{0,0}},  {/*1*/{127, 65},{127,254},{0,0}},
+  {/*1*/{128, 66},{128,255},{0,0}},  {/*1*/{129, 68},{129,254},{0,0}},  {/*1*/{130, 69},{130,255},{0,0}},  {/*1*/{131, 71},{131,254},{0,0}},
+  {/*1*/{132, 72},{132,255},{0,0}},  {/*1*/{133, 74},{133,254},{0,0}},  {/*1*/{134, 75},{134,255},{0,0}},  {/*1*/{135, 77},{135,254},{0,0}},
+  {/*1*/{136, 78},{136,255},{0,0}},  {/*1*/{137, 80},{137,254},{0,0}},  {/*1*/{138, 81},{138,255},{0,0}},  {/*1*/{139, 83},{139,254},{0,0}},
+  {/*1*/{140, 84},{140,255},{0,0}},  {/*1*/{141, 86},{141,254},{0,0}},  {/*1*/{142, 87},{142,255},{0,0}},  {/*1*/{143, 89},{143,254},{0,0}},
+  {/*1*/{144, 90},{144,255},{0,0}},  {/*1*/{145, 92},{145,254},{0,0}},  {/*1*/{146, 93},{146,255},{0,0}},  {/*1*/{147, 95},{147,254},{0,0}},
+  {/*1*/{148, 96},{148,255},{0,0}},  {/*1*/{149, 98},{149,254},{0,0}},  {/*1*/{150, 99},{150,255},{0,0}},  {/*1*/{151,101},{151,254},{0,0}},
+  {/*1*/{152,102},{152,255},{0,0}},  {/*1*/{153,104},{153,254},{0,0}},  {/*1*/{154,105},{154,255},{0,0}},  {/*1*/{155,107},{155,254},{0,0}},
+  {/*1*/{156,108},{156,255},{0,0}},  {/*1*/{157,110},{157,254},{0,0}},  {/*1*/{158,111},{158,255},{0,0}},  {/*1*/{159,113},{159,254},{0,0}},
+  {/*1*/{160,114},{160,255},{0,0}},  {/*1*/{161,116},{161,254},{0,0}},  {/*1*/{162,117},{162,255},{0,0}},  {/*1*/{163,119},{163,254},{0,0}},
+  {/*1*/{164,120},{164,255},{0,0}},  {/*1*/{165,122},{165,254},{0,0}},  {/*1*/{166,123},{166,255},{0,0}},  {/*1*/{167,125},{167,253},{0,0}},
+  {/*1*/{168,126},{168,254},{0,0}},  {/*1*/{169,127},{169,255},{0,0}},  {/*1*/{170,129},{170,254},{0,0}},  {/*1*/{171,130},{171,255},{0,0}},
+  {/*1*/{172,132},{172,254},{0,0}},  {/*1*/{173,133},{173,255},{0,0}},  {/*1*/{174,135},{174,254},{0,0}},  {/*1*/{175,136},{175,255},{0,0}},
+  {/*1*/{176,138},{176,254},{0,0}},  {/*1*/{177,139},{177,255},{0,0}},  {/*1*/{178,141},{178,254},{0,0}},  {/*1*/{179,142},{179,255},{0,0}},
+  {/*1*/{180,144},{180,254},{0,0}},  {/*1*/{181,145},{181,255},{0,0}},  {/*1*/{182,147},{182,254},{0,0}},  {/*1*/{183,148},{183,255},{0,0}},
+  {/*1*/{184,150},{184,254},{0,0}},  {/*1*/{185,151},{185,255},{0,0}},  {/*1*/{186,153},{186,254},{0,0}},  {/*1*/{187,154},{187,255},{0,0}},
+  {/*1*/{188,156},{188,254},{0,0}},  {/*1*/{189,157},{189,255},{0,0}},  {/*1*/{190,159},{190,254},{0,0}},  {/*1*/{191,160},{191,255},{0,0}},
+  {/*1*/{192,162},{192,254},{0,0}},  {/*1*/{193,163},{193,255},{0,0}},  {/*1*/{194,165},{194,254},{0,0}},  {/*1*/{195,166},{195,255},{0,0}},
+  {/*1*/{196,168},{196,254},{0,0}},  {/*1*/{197,169},{197,255},{0,0}},  {/*1*/{198,171},{198,254},{0,0}},  {/*1*/{199,172},{199,255},{0,0}},
+  {/*1*/{200,174},{200,254},{0,0}},  {/*1*/{201,175},{201,255},{0,0}},  {/*1*/{202,177},{202,254},{0,0}},  {/*1*/{203,178},{203,255},{0,0}},
+  {/*1*/{204,180},{204,254},{0,0}},  {/*1*/{205,181},{205,255},{0,0}},  {/*1*/{206,183},{206,254},{0,0}},  {/*1*/{207,184},{207,255},{0,0}},
+  {/*1*/{208,186},{208,254},{0,0}},  {/*1*/{209,187},{209,255},{0,0}},  {/*1*/{210,189},{210,253},{0,0}},  {/*1*/{211,190},{211,254},{0,0}},
+  {/*1*/{212,191},{212,255},{0,0}},  {/*1*/{213,193},{213,254},{0,0}},  {/*1*/{214,194},{214,255},{0,0}},  {/*1*/{215,196},{215,254},{0,0}},
+  {/*1*/{216,197},{216,255},{0,0}},  {/*1*/{217,199},{217,254},{0,0}},  {/*1*/{218,200},{218,255},{0,0}},  {/*1*/{219,202},{219,254},{0,0}},
+  {/*1*/{220,203},{220,255},{0,0}},  {/*1*/{221,205},{221,254},{0,0}},  {/*1*/{222,206},{222,255},{0,0}},  {/*1*/{223,208},{223,254},{0,0}},
+  {/*1*/{224,209},{224,255},{0,0}},  {/*1*/{225,211},{225,254},{0,0}},  {/*1*/{226,212},{226,255},{0,0}},  {/*1*/{227,214},{227,254},{0,0}},
+  {/*1*/{228,215},{228,255},{0,0}},  {/*1*/{229,217},{229,254},{0,0}},  {/*1*/{230,218},{230,255},{0,0}},  {/*1*/{231,220},{231,254},{0,0}},
+  {/*1*/{232,221},{232,255},{0,0}},  {/*1*/{233,223},{233,254},{0,0}},  {/*1*/{234,224},{234,255},{0,0}},  {/*1*/{235,226},{235,254},{0,0}},
+  {/*1*/{236,227},{236,255},{0,0}},  {/*1*/{237,229},{237,254},{0,0}},  {/*1*/{238,230},{238,255},{0,0}},  {/*1*/{239,232},{239,254},{0,0}},
+  {/*1*/{240,233},{240,255},{0,0}},  {/*1*/{241,235},{241,254},{0,0}},  {/*1*/{242,236},{242,255},{0,0}},  {/*1*/{243,238},{243,254},{0,0}},
+  {/*1*/{244,239},{244,255},{0,0}},  {/*1*/{245,241},{245,254},{0,0}},  {/*1*/{246,242},{246,255},{0,0}},  {/*1*/{247,244},{247,254},{0,0}},
+  {/*1*/{248,245},{248,255},{0,0}},  {/*1*/{249,247},{249,254},{0,0}},  {/*1*/{250,248},{250,255},{0,0}},  {/*1*/{251,250},{251,254},{0,0}},
+  {/*1*/{252,251},{252,255},{0,0}},  {/*1*/{253,253},{253,253},{0,0}},  {/*1*/{254,254},{254,254},{0,0}},  {/*1*/{255,255},{255,255},{0,0}}
 };
 
 /* 256 * 4 * 3 * 1 = 3072 */
 static PaletteSingleLookup4 const sp_lookup_5_8[256] =
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  0,  0,1},{  0,  8,0},{  0,  0,1},{  0,  0,1}}},  {{/*1*/{  0,  0,2},{  0, 16,0},{  0,  8,0},{  0,  8,1}}},  {{/*1*/{  0,  0,3},{  0, 24,0},{  0,  8,1},{  0,  8,0}}},
-  {{/*1*/{  0,  0,4},{  0, 33,0},{  0, 16,0},{  8,  0,0}}},  {{/*1*/{  8,  8,3},{  0, 41,0},{  8,  0,0},{  0, 16,1}}},  {{/*1*/{  8,  8,2},{  0, 49,0},{  0, 24,0},{  0, 16,0}}},  {{/*1*/{  8,  8,1},{  0, 49,1},{  0, 24,1},{  0, 16,1}}},
-  {{/*1*/{  8,  8,0},{  0, 57,0},{  8,  8,0},{  8,  8,0}}},  {{/*1*/{  8,  8,1},{  0, 66,0},{  0, 33,0},{ 16,  0,0}}},  {{/*1*/{  8,  8,2},{  0, 74,0},{  8, 16,0},{  0, 24,0}}},  {{/*1*/{  8,  8,3},{  0, 82,0},{  0, 41,0},{  8, 16,0}}},
-  {{/*1*/{  8,  8,4},{  0, 90,0},{  8, 24,0},{ 16,  8,0}}},  {{/*1*/{ 16, 16,3},{  0, 99,0},{  0, 49,0},{  0, 33,0}}},  {{/*1*/{ 16, 16,2},{  8, 57,0},{  0, 49,1},{  8, 24,0}}},  {{/*1*/{ 16, 16,1},{  0,107,0},{  8, 33,0},{  8, 24,1}}},
-  {{/*1*/{ 16, 16,0},{  0,115,0},{  0, 57,0},{ 16, 16,0}}},  {{/*1*/{ 16, 16,1},{  0,123,0},{  8, 41,0},{  0, 41,0}}},  {{/*1*/{ 16, 16,2},{  0,132,0},{  0, 66,0},{  8, 33,0}}},  {{/*1*/{ 16, 16,3},{  0,140,0},{  8, 49,0},{ 16, 24,0}}},
-  {{/*1*/{ 16, 16,4},{  0,148,0},{  0, 74,0},{  0, 49,0}}},  {{/*1*/{ 24, 24,3},{  0,156,0},{  8, 57,0},{  8, 41,0}}},  {{/*1*/{ 24, 24,2},{ 24, 16,0},{  0, 82,1},{ 33,  8,0}}},  {{/*1*/{ 24, 24,1},{  0,165,0},{  0, 82,0},{ 16, 33,0}}},
-  {{/*1*/{ 24, 24,0},{  0,173,0},{  8, 66,0},{  0, 57,0}}},  {{/*1*/{ 24, 24,1},{  0,181,0},{  0, 90,0},{  8, 49,0}}},  {{/*1*/{ 24, 24,2},{  0,189,0},{  8, 74,0},{ 16, 41,0}}},  {{/*1*/{ 24, 24,3},{  0,198,0},{  0, 99,0},{  0, 66,0}}},
-  {{/*1*/{ 24, 24,4},{  0,206,0},{  8, 82,0},{  8, 57,0}}},  {{/*1*/{ 33, 33,4},{ 16,115,0},{ 41,  0,0},{ 16, 49,0}}},  {{/*1*/{ 33, 33,3},{  0,214,0},{  0,107,0},{ 41, 16,0}}},  {{/*1*/{ 33, 33,2},{  0,222,0},{  8, 90,0},{  0, 74,0}}},
-  {{/*1*/{ 33, 33,1},{  0,231,0},{  0,115,0},{  8, 66,0}}},  {{/*1*/{ 33, 33,0},{  0,239,0},{  8, 99,0},{ 16, 57,0}}},  {{/*1*/{ 33, 33,1},{  0,247,0},{  0,123,0},{  0, 82,0}}},  {{/*1*/{ 33, 33,2},{  0,255,0},{  8,107,0},{  8, 74,0}}},
-  {{/*1*/{ 33, 33,3},{  8,214,0},{ 16, 90,0},{ 33, 41,0}}},  {{/*1*/{ 33, 33,4},{ 24,123,0},{  0,132,0},{  0, 90,0}}},  {{/*1*/{ 41, 41,3},{  8,222,0},{  8,115,0},{ 49, 24,0}}},  {{/*1*/{ 41, 41,2},{  8,231,0},{  0,140,0},{  8, 82,0}}},
-  {{/*1*/{ 41, 41,1},{  8,239,0},{  8,123,0},{ 16, 74,0}}},  {{/*1*/{ 41, 41,0},{  8,247,0},{  0,148,0},{  0, 99,0}}},  {{/*1*/{ 41, 41,1},{  8,255,0},{  8,132,0},{  8, 90,0}}},  {{/*1*/{ 41, 41,2},{ 16,214,0},{  0,156,0},{ 16, 82,0}}},
-  {{/*1*/{ 41, 41,3},{ 16,222,0},{ 33, 74,0},{ 41, 49,0}}},  {{/*1*/{ 41, 41,4},{ 33,123,0},{  8,140,0},{  0,107,0}}},  {{/*1*/{ 49, 49,3},{ 16,231,0},{  0,165,0},{  8, 99,0}}},  {{/*1*/{ 49, 49,2},{ 16,239,0},{  8,148,0},{ 16, 90,0}}},
-  {{/*1*/{ 49, 49,1},{ 16,247,0},{  0,173,0},{  0,115,0}}},  {{/*1*/{ 49, 49,0},{ 16,255,0},{  8,156,0},{  8,107,0}}},  {{/*1*/{ 49, 49,1},{ 24,214,0},{  0,181,0},{ 33, 74,0}}},  {{/*1*/{ 49, 49,2},{ 24,222,0},{ 24,123,0},{  0,123,0}}},
-  {{/*1*/{ 49, 49,3},{ 33,173,0},{  8,165,0},{ 49, 57,0}}},  {{/*1*/{ 49, 49,4},{ 24,231,0},{  0,189,0},{  8,115,0}}},  {{/*1*/{ 57, 57,3},{ 24,239,0},{  8,173,0},{ 16,107,0}}},  {{/*1*/{ 57, 57,2},{ 24,247,0},{  0,198,0},{  0,132,0}}},
-  {{/*1*/{ 57, 57,1},{ 24,255,0},{  8,181,0},{  8,123,0}}},  {{/*1*/{ 57, 57,0},{ 33,206,0},{  0,206,0},{ 16,115,0}}},  {{/*1*/{ 57, 57,1},{ 33,214,0},{  8,189,0},{ 41, 82,0}}},  {{/*1*/{ 57, 57,2},{ 33,222,0},{ 41,107,0},{  0,140,0}}},
-  {{/*1*/{ 57, 57,3},{ 33,231,0},{  0,214,0},{  8,132,0}}},  {{/*1*/{ 57, 57,4},{ 33,239,0},{  8,198,0},{ 16,123,0}}},  {{/*1*/{ 66, 66,4},{ 49,148,0},{  0,222,0},{  0,148,0}}},  {{/*1*/{ 66, 66,3},{ 33,247,0},{  8,206,0},{  8,140,0}}},
-  {{/*1*/{ 66, 66,2},{ 33,255,0},{  0,231,0},{ 16,132,0}}},  {{/*1*/{ 66, 66,1},{ 41,214,0},{  8,214,0},{  0,156,0}}},  {{/*1*/{ 66, 66,0},{ 41,222,0},{ 41,132,0},{ 49, 90,0}}},  {{/*1*/{ 66, 66,1},{ 41,231,0},{  0,239,0},{  8,148,0}}},
-  {{/*1*/{ 66, 66,2},{ 41,239,0},{  8,222,0},{ 16,140,0}}},  {{/*1*/{ 66, 66,3},{ 41,247,0},{  0,247,0},{  0,165,0}}},  {{/*1*/{ 66, 66,4},{ 57,156,0},{  8,231,0},{  8,156,0}}},  {{/*1*/{ 74, 74,3},{ 41,255,0},{  0,255,0},{ 16,148,0}}},
-  {{/*1*/{ 74, 74,2},{ 49,214,0},{  8,239,0},{  0,173,0}}},  {{/*1*/{ 74, 74,1},{ 49,222,0},{ 16,222,0},{ 49,107,0}}},  {{/*1*/{ 74, 74,0},{ 49,231,0},{ 33,181,0},{  8,165,0}}},  {{/*1*/{ 74, 74,1},{ 49,239,0},{  8,247,0},{ 16,156,0}}},
-  {{/*1*/{ 74, 74,2},{ 49,247,0},{ 16,231,0},{  0,181,0}}},  {{/*1*/{ 74, 74,3},{ 49,255,0},{  8,255,0},{  8,173,0}}},  {{/*1*/{ 74, 74,4},{ 66,156,0},{ 16,239,0},{ 16,165,0}}},  {{/*1*/{ 82, 82,3},{ 57,214,0},{ 24,222,0},{  0,189,0}}},
-  {{/*1*/{ 82, 82,2},{ 57,222,0},{ 16,247,0},{  8,181,0}}},  {{/*1*/{ 82, 82,1},{ 57,231,0},{ 33,206,0},{ 33,148,0}}},  {{/*1*/{ 82, 82,0},{ 57,239,0},{ 24,231,0},{ 16,173,0}}},  {{/*1*/{ 82, 82,1},{ 57,247,0},{ 16,255,0},{  0,198,0}}},
-  {{/*1*/{ 82, 82,2},{ 57,255,0},{ 24,239,0},{  8,189,0}}},  {{/*1*/{ 82, 82,3},{ 66,206,0},{ 41,198,0},{ 16,181,0}}},  {{/*1*/{ 82, 82,4},{ 66,214,0},{ 24,247,0},{  0,206,0}}},  {{/*1*/{ 90, 90,3},{ 66,222,0},{ 41,206,0},{ 49,140,0}}},
-  {{/*1*/{ 90, 90,2},{ 90, 82,0},{ 24,255,0},{  8,198,0}}},  {{/*1*/{ 90, 90,1},{ 66,231,0},{ 41,214,0},{ 41,156,0}}},  {{/*1*/{ 90, 90,0},{ 66,239,0},{ 33,239,0},{  0,214,0}}},  {{/*1*/{ 90, 90,1},{ 66,247,0},{ 41,222,0},{  8,206,0}}},
-  {{/*1*/{ 90, 90,2},{ 66,255,0},{ 74,140,0},{ 16,198,0}}},  {{/*1*/{ 90, 90,3},{ 74,214,0},{ 33,247,0},{  0,222,0}}},  {{/*1*/{ 90, 90,4},{ 74,222,0},{ 41,231,0},{  8,214,0}}},  {{/*1*/{ 99, 99,4},{ 82,181,0},{ 33,255,0},{ 33,181,0}}},
-  {{/*1*/{ 99, 99,3},{ 74,231,0},{ 41,239,0},{ 16,206,0}}},  {{/*1*/{ 99, 99,2},{ 74,239,0},{ 49,222,0},{  0,231,0}}},  {{/*1*/{ 99, 99,1},{ 74,247,0},{ 41,247,0},{  8,222,0}}},  {{/*1*/{ 99, 99,0},{ 74,255,0},{ 74,165,0},{ 16,214,0}}},
-  {{/*1*/{ 99, 99,1},{ 82,214,0},{ 49,231,0},{  0,239,0}}},  {{/*1*/{ 99, 99,2},{ 82,222,0},{ 41,255,0},{ 49,173,0}}},  {{/*1*/{ 99, 99,3},{ 82,231,0},{ 49,239,0},{  8,231,0}}},  {{/*1*/{ 99, 99,4},{ 90,189,0},{ 57,222,0},{ 41,189,0}}},
-  {{/*1*/{107,107,3},{ 82,239,0},{ 49,247,0},{  0,247,0}}},  {{/*1*/{107,107,2},{ 82,247,0},{ 57,231,0},{  8,239,0}}},  {{/*1*/{107,107,1},{ 82,255,0},{ 49,255,0},{ 16,231,0}}},  {{/*1*/{107,107,0},{ 90,214,0},{ 66,214,0},{  0,255,0}}},
-  {{/*1*/{107,107,1},{ 90,222,0},{ 57,239,0},{  8,247,0}}},  {{/*1*/{107,107,2},{ 90,231,0},{ 66,222,0},{ 33,214,0}}},  {{/*1*/{107,107,3},{ 90,239,0},{ 57,247,0},{ 16,239,0}}},  {{/*1*/{107,107,4},{ 99,189,0},{ 74,206,0},{ 24,231,0}}},
-  {{/*1*/{115,115,3},{ 90,247,0},{ 57,255,0},{  8,255,0}}},  {{/*1*/{115,115,2},{ 90,255,0},{ 74,214,0},{ 16,247,0}}},  {{/*1*/{115,115,1},{ 99,206,0},{ 66,239,0},{ 24,239,0}}},  {{/*1*/{115,115,0},{ 99,214,0},{ 74,222,0},{ 49,206,0}}},
-  {{/*1*/{115,115,1},{ 99,222,0},{ 66,247,0},{ 16,255,0}}},  {{/*1*/{115,115,2},{ 99,231,0},{ 90,189,0},{ 41,222,0}}},  {{/*1*/{115,115,3},{ 99,239,0},{ 74,231,0},{ 24,247,0}}},  {{/*1*/{115,115,4},{ 99,247,0},{ 66,255,0},{ 33,239,0}}},
-  {{/*1*/{123,123,3},{ 99,255,0},{ 74,239,0},{ 82,173,0}}},  {{/*1*/{123,123,2},{123,115,0},{ 82,222,0},{ 24,255,0}}},  {{/*1*/{123,123,1},{107,214,0},{ 74,247,0},{ 74,189,0}}},  {{/*1*/{123,123,0},{107,222,0},{ 82,231,0},{ 33,247,0}}},
-  {{/*1*/{123,123,1},{107,231,0},{ 74,255,0},{ 41,239,0}}},  {{/*1*/{123,123,2},{107,239,0},{107,173,0},{ 49,231,0}}},  {{/*1*/{123,123,3},{107,247,0},{ 82,239,0},{ 33,255,0}}},  {{/*1*/{123,123,4},{107,255,0},{ 90,222,0},{ 41,247,0}}},
-  {{/*1*/{132,132,4},{115,214,0},{ 82,247,0},{ 66,214,0}}},  {{/*1*/{132,132,3},{132,115,0},{ 90,231,0},{ 49,239,0}}},  {{/*1*/{132,132,2},{115,222,0},{ 82,255,0},{ 57,231,0}}},  {{/*1*/{132,132,1},{115,231,0},{ 90,239,0},{ 41,255,0}}},
-  {{/*1*/{132,132,0},{115,239,0},{107,198,0},{ 49,247,0}}},  {{/*1*/{132,132,1},{115,247,0},{ 99,222,0},{ 57,239,0}}},  {{/*1*/{132,132,2},{115,255,0},{ 90,247,0},{ 82,206,0}}},  {{/*1*/{132,132,3},{123,214,0},{115,189,0},{ 49,255,0}}},
-  {{/*1*/{132,132,4},{123,222,0},{ 90,255,0},{ 74,222,0}}},  {{/*1*/{140,140,3},{132,173,0},{107,214,0},{ 57,247,0}}},  {{/*1*/{140,140,2},{123,231,0},{ 99,239,0},{ 66,239,0}}},  {{/*1*/{140,140,1},{123,239,0},{107,222,0},{115,173,0}}},
-  {{/*1*/{140,140,0},{123,247,0},{ 99,247,0},{ 57,255,0}}},  {{/*1*/{140,140,1},{123,255,0},{107,231,0},{ 82,222,0}}},  {{/*1*/{140,140,2},{132,206,0},{ 99,255,0},{ 66,247,0}}},  {{/*1*/{140,140,3},{132,214,0},{132,173,0},{ 74,239,0}}},
-  {{/*1*/{140,140,4},{132,222,0},{107,239,0},{ 82,231,0}}},  {{/*1*/{148,148,3},{132,231,0},{115,222,0},{ 66,255,0}}},  {{/*1*/{148,148,2},{140,189,0},{107,247,0},{ 74,247,0}}},  {{/*1*/{148,148,1},{132,239,0},{115,231,0},{ 99,214,0}}},
-  {{/*1*/{148,148,0},{132,247,0},{107,255,0},{ 82,239,0}}},  {{/*1*/{148,148,1},{132,255,0},{115,239,0},{ 90,231,0}}},  {{/*1*/{148,148,2},{140,214,0},{123,222,0},{ 74,255,0}}},  {{/*1*/{148,148,3},{140,222,0},{140,181,0},{ 82,247,0}}},
-  {{/*1*/{148,148,4},{140,231,0},{115,247,0},{ 90,239,0}}},  {{/*1*/{156,156,3},{140,239,0},{123,231,0},{115,206,0}}},  {{/*1*/{156,156,2},{156,148,0},{115,255,0},{ 82,255,0}}},  {{/*1*/{156,156,1},{140,247,0},{123,239,0},{107,222,0}}},
-  {{/*1*/{156,156,0},{140,255,0},{140,198,0},{ 90,247,0}}},  {{/*1*/{156,156,1},{148,214,0},{123,247,0},{140,181,0}}},  {{/*1*/{156,156,2},{148,222,0},{140,206,0},{ 99,239,0}}},  {{/*1*/{156,156,3},{148,231,0},{132,231,0},{ 90,255,0}}},
-  {{/*1*/{156,156,4},{148,239,0},{123,255,0},{115,222,0}}},  {{/*1*/{165,165,4},{148,247,0},{173,132,0},{ 99,247,0}}},  {{/*1*/{165,165,3},{165,148,0},{132,239,0},{107,239,0}}},  {{/*1*/{165,165,2},{148,255,0},{140,222,0},{115,231,0}}},
-  {{/*1*/{165,165,1},{156,214,0},{132,247,0},{ 99,255,0}}},  {{/*1*/{165,165,0},{156,222,0},{140,231,0},{148,189,0}}},  {{/*1*/{165,165,1},{156,231,0},{132,255,0},{107,247,0}}},  {{/*1*/{165,165,2},{156,239,0},{140,239,0},{115,239,0}}},
-  {{/*1*/{165,165,3},{156,247,0},{148,222,0},{123,231,0}}},  {{/*1*/{165,165,4},{156,255,0},{165,181,0},{107,255,0}}},  {{/*1*/{173,173,3},{165,206,0},{140,247,0},{115,247,0}}},  {{/*1*/{173,173,2},{165,214,0},{148,231,0},{123,239,0}}},
-  {{/*1*/{173,173,1},{181,123,0},{140,255,0},{148,206,0}}},  {{/*1*/{173,173,0},{165,222,0},{148,239,0},{132,231,0}}},  {{/*1*/{173,173,1},{165,231,0},{156,222,0},{115,255,0}}},  {{/*1*/{173,173,2},{165,239,0},{148,247,0},{123,247,0}}},
-  {{/*1*/{173,173,3},{165,247,0},{165,206,0},{173,181,0}}},  {{/*1*/{173,173,4},{165,255,0},{156,231,0},{132,239,0}}},  {{/*1*/{181,181,3},{173,214,0},{148,255,0},{123,255,0}}},  {{/*1*/{181,181,2},{173,222,0},{156,239,0},{148,222,0}}},
-  {{/*1*/{181,181,1},{189,132,0},{173,198,0},{132,247,0}}},  {{/*1*/{181,181,0},{173,231,0},{156,247,0},{140,239,0}}},  {{/*1*/{181,181,1},{173,239,0},{173,206,0},{165,206,0}}},  {{/*1*/{181,181,2},{173,247,0},{156,255,0},{132,255,0}}},
-  {{/*1*/{181,181,3},{173,255,0},{173,214,0},{181,189,0}}},  {{/*1*/{181,181,4},{181,214,0},{165,239,0},{140,247,0}}},  {{/*1*/{189,189,3},{181,222,0},{173,222,0},{148,239,0}}},  {{/*1*/{189,189,2},{189,181,0},{206,140,0},{156,231,0}}},
-  {{/*1*/{189,189,1},{181,231,0},{165,247,0},{140,255,0}}},  {{/*1*/{189,189,0},{181,239,0},{173,231,0},{148,247,0}}},  {{/*1*/{189,189,1},{181,247,0},{165,255,0},{173,214,0}}},  {{/*1*/{189,189,2},{181,255,0},{173,239,0},{156,239,0}}},
-  {{/*1*/{189,189,3},{189,214,0},{181,222,0},{165,231,0}}},  {{/*1*/{189,189,4},{189,222,0},{173,247,0},{148,255,0}}},  {{/*1*/{198,198,4},{189,231,0},{206,165,0},{156,247,0}}},  {{/*1*/{198,198,3},{198,181,0},{181,231,0},{206,181,0}}},
-  {{/*1*/{198,198,2},{189,239,0},{173,255,0},{165,239,0}}},  {{/*1*/{198,198,1},{189,247,0},{181,239,0},{156,255,0}}},  {{/*1*/{198,198,0},{189,255,0},{189,222,0},{181,222,0}}},  {{/*1*/{198,198,1},{198,206,0},{181,247,0},{165,247,0}}},
-  {{/*1*/{198,198,2},{198,214,0},{189,231,0},{173,239,0}}},  {{/*1*/{198,198,3},{198,222,0},{181,255,0},{198,206,0}}},  {{/*1*/{198,198,4},{198,231,0},{198,214,0},{165,255,0}}},  {{/*1*/{206,206,3},{198,239,0},{189,239,0},{214,189,0}}},
-  {{/*1*/{206,206,2},{198,247,0},{198,222,0},{173,247,0}}},  {{/*1*/{206,206,1},{214,156,0},{189,247,0},{181,239,0}}},  {{/*1*/{206,206,0},{198,255,0},{206,206,0},{189,231,0}}},  {{/*1*/{206,206,1},{206,214,0},{189,255,0},{173,255,0}}},
-  {{/*1*/{206,206,2},{206,222,0},{206,214,0},{181,247,0}}},  {{/*1*/{206,206,3},{206,231,0},{198,239,0},{206,214,0}}},  {{/*1*/{206,206,4},{206,239,0},{206,222,0},{189,239,0}}},  {{/*1*/{214,214,3},{206,247,0},{198,247,0},{198,231,0}}},
-  {{/*1*/{214,214,2},{206,255,0},{222,189,0},{181,255,0}}},  {{/*1*/{214,214,1},{222,165,0},{206,231,0},{189,247,0}}},  {{/*1*/{214,214,0},{214,214,0},{198,255,0},{214,214,0}}},  {{/*1*/{214,214,1},{214,222,0},{206,239,0},{198,239,0}}},
-  {{/*1*/{214,214,2},{214,231,0},{214,222,0},{189,255,0}}},  {{/*1*/{214,214,3},{214,239,0},{206,247,0},{214,222,0}}},  {{/*1*/{214,214,4},{214,247,0},{214,231,0},{198,247,0}}},  {{/*1*/{222,222,3},{214,255,0},{206,255,0},{206,239,0}}},
-  {{/*1*/{222,222,2},{222,214,0},{239,173,0},{231,206,0}}},  {{/*1*/{222,222,1},{231,165,0},{214,239,0},{214,231,0}}},  {{/*1*/{222,222,0},{222,222,0},{222,222,0},{198,255,0}}},  {{/*1*/{222,222,1},{222,231,0},{214,247,0},{206,247,0}}},
-  {{/*1*/{222,222,2},{222,239,0},{222,231,0},{214,239,0}}},  {{/*1*/{222,222,3},{222,247,0},{214,255,0},{222,231,0}}},  {{/*1*/{222,222,4},{222,255,0},{222,239,0},{206,255,0}}},  {{/*1*/{231,231,4},{231,206,0},{239,198,0},{214,247,0}}},
-  {{/*1*/{231,231,3},{231,214,0},{231,222,0},{239,214,0}}},  {{/*1*/{231,231,2},{231,222,0},{222,247,0},{222,239,0}}},  {{/*1*/{231,231,1},{239,181,0},{247,189,0},{255,198,0}}},  {{/*1*/{231,231,0},{231,231,0},{222,255,0},{214,255,0}}},
-  {{/*1*/{231,231,1},{231,239,0},{222,255,1},{222,247,0}}},  {{/*1*/{231,231,2},{231,247,0},{231,239,0},{247,214,0}}},  {{/*1*/{231,231,3},{231,255,0},{239,222,0},{231,239,0}}},  {{/*1*/{231,231,4},{239,214,0},{231,247,0},{222,255,0}}},
-  {{/*1*/{239,239,3},{239,222,0},{239,231,0},{247,222,0}}},  {{/*1*/{239,239,2},{239,231,0},{231,255,0},{231,247,0}}},  {{/*1*/{239,239,1},{247,189,0},{255,198,0},{231,247,1}}},  {{/*1*/{239,239,0},{239,239,0},{239,239,0},{239,239,0}}},
-  {{/*1*/{239,239,1},{239,247,0},{239,239,1},{247,231,0}}},  {{/*1*/{239,239,2},{239,255,0},{239,247,0},{231,255,0}}},  {{/*1*/{239,239,3},{247,214,0},{247,231,0},{239,247,0}}},  {{/*1*/{239,239,4},{247,222,0},{239,255,0},{247,239,0}}},
-  {{/*1*/{247,247,3},{247,231,0},{247,239,0},{255,231,0}}},  {{/*1*/{247,247,2},{247,239,0},{255,222,0},{239,255,0}}},  {{/*1*/{247,247,1},{255,198,0},{247,247,1},{239,255,1}}},  {{/*1*/{247,247,0},{247,247,0},{247,247,0},{247,247,0}}},
-  {{/*1*/{247,247,1},{247,255,0},{255,231,0},{255,239,0}}},  {{/*1*/{247,247,2},{255,214,0},{247,255,0},{247,255,1}}},  {{/*1*/{247,247,3},{255,222,0},{255,239,0},{247,255,0}}},  {{/*1*/{247,247,4},{255,231,0},{255,247,1},{255,247,0}}},
-  {{/*1*/{255,255,3},{255,239,0},{255,247,0},{255,247,1}}},  {{/*1*/{255,255,2},{255,247,0},{255,247,1},{255,255,2}}},  {{/*1*/{255,255,1},{255,255,1},{255,255,1},{255,255,1}}},  {{/*1*/{255,255,0},{255,255,0},{255,255,0},{255,255,0}}}
+  {/*1*/{  0,  0,  0,  0},{  0,  0,  0,  0},{0,0,0,0}},  {/*1*/{  0,  0,  0,  0},{  0,  8,  0,  0},{1,0,1,1}},  {/*1*/{  0,  0,  0,  0},{  0, 16,  8,  8},{2,0,0,1}},  {/*1*/{  0,  0,  0,  0},{  0, 24,  8,  8},{3,0,1,0}},
+  {/*1*/{  0,  0,  0,  8},{  0, 33, 16,  0},{4,0,0,0}},  {/*1*/{  8,  0,  8,  0},{  8, 41,  0, 16},{3,0,0,1}},  {/*1*/{  8,  0,  0,  0},{  8, 49, 24, 16},{2,0,0,0}},  {/*1*/{  8,  0,  0,  0},{  8, 49, 24, 16},{1,1,1,1}},
+  {/*1*/{  8,  0,  8,  8},{  8, 57,  8,  8},{0,0,0,0}},  {/*1*/{  8,  0,  0, 16},{  8, 66, 33,  0},{1,0,0,0}},  {/*1*/{  8,  0,  8,  0},{  8, 74, 16, 24},{2,0,0,0}},  {/*1*/{  8,  0,  0,  8},{  8, 82, 41, 16},{3,0,0,0}},
+  {/*1*/{  8,  0,  8, 16},{  8, 90, 24,  8},{4,0,0,0}},  {/*1*/{ 16,  0,  0,  0},{ 16, 99, 49, 33},{3,0,0,0}},  {/*1*/{ 16,  8,  0,  8},{ 16, 57, 49, 24},{2,0,1,0}},  {/*1*/{ 16,  0,  8,  8},{ 16,107, 33, 24},{1,0,0,1}},
+  {/*1*/{ 16,  0,  0, 16},{ 16,115, 57, 16},{0,0,0,0}},  {/*1*/{ 16,  0,  8,  0},{ 16,123, 41, 41},{1,0,0,0}},  {/*1*/{ 16,  0,  0,  8},{ 16,132, 66, 33},{2,0,0,0}},  {/*1*/{ 16,  0,  8, 16},{ 16,140, 49, 24},{3,0,0,0}},
+  {/*1*/{ 16,  0,  0,  0},{ 16,148, 74, 49},{4,0,0,0}},  {/*1*/{ 24,  0,  8,  8},{ 24,156, 57, 41},{3,0,0,0}},  {/*1*/{ 24, 24,  0, 33},{ 24, 16, 82,  8},{2,0,1,0}},  {/*1*/{ 24,  0,  0, 16},{ 24,165, 82, 33},{1,0,0,0}},
+  {/*1*/{ 24,  0,  8,  0},{ 24,173, 66, 57},{0,0,0,0}},  {/*1*/{ 24,  0,  0,  8},{ 24,181, 90, 49},{1,0,0,0}},  {/*1*/{ 24,  0,  8, 16},{ 24,189, 74, 41},{2,0,0,0}},  {/*1*/{ 24,  0,  0,  0},{ 24,198, 99, 66},{3,0,0,0}},
+  {/*1*/{ 24,  0,  8,  8},{ 24,206, 82, 57},{4,0,0,0}},  {/*1*/{ 33, 16, 41, 16},{ 33,115,  0, 49},{4,0,0,0}},  {/*1*/{ 33,  0,  0, 41},{ 33,214,107, 16},{3,0,0,0}},  {/*1*/{ 33,  0,  8,  0},{ 33,222, 90, 74},{2,0,0,0}},
+  {/*1*/{ 33,  0,  0,  8},{ 33,231,115, 66},{1,0,0,0}},  {/*1*/{ 33,  0,  8, 16},{ 33,239, 99, 57},{0,0,0,0}},  {/*1*/{ 33,  0,  0,  0},{ 33,247,123, 82},{1,0,0,0}},  {/*1*/{ 33,  0,  8,  8},{ 33,255,107, 74},{2,0,0,0}},
+  {/*1*/{ 33,  8, 16, 33},{ 33,214, 90, 41},{3,0,0,0}},  {/*1*/{ 33, 24,  0,  0},{ 33,123,132, 90},{4,0,0,0}},  {/*1*/{ 41,  8,  8, 49},{ 41,222,115, 24},{3,0,0,0}},  {/*1*/{ 41,  8,  0,  8},{ 41,231,140, 82},{2,0,0,0}},
+  {/*1*/{ 41,  8,  8, 16},{ 41,239,123, 74},{1,0,0,0}},  {/*1*/{ 41,  8,  0,  0},{ 41,247,148, 99},{0,0,0,0}},  {/*1*/{ 41,  8,  8,  8},{ 41,255,132, 90},{1,0,0,0}},  {/*1*/{ 41, 16,  0, 16},{ 41,214,156, 82},{2,0,0,0}},
+  {/*1*/{ 41, 16, 33, 41},{ 41,222, 74, 49},{3,0,0,0}},  {/*1*/{ 41, 33,  8,  0},{ 41,123,140,107},{4,0,0,0}},  {/*1*/{ 49, 16,  0,  8},{ 49,231,165, 99},{3,0,0,0}},  {/*1*/{ 49, 16,  8, 16},{ 49,239,148, 90},{2,0,0,0}},
+  {/*1*/{ 49, 16,  0,  0},{ 49,247,173,115},{1,0,0,0}},  {/*1*/{ 49, 16,  8,  8},{ 49,255,156,107},{0,0,0,0}},  {/*1*/{ 49, 24,  0, 33},{ 49,214,181, 74},{1,0,0,0}},  {/*1*/{ 49, 24, 24,  0},{ 49,222,123,123},{2,0,0,0}},
+  {/*1*/{ 49, 33,  8, 49},{ 49,173,165, 57},{3,0,0,0}},  {/*1*/{ 49, 24,  0,  8},{ 49,231,189,115},{4,0,0,0}},  {/*1*/{ 57, 24,  8, 16},{ 57,239,173,107},{3,0,0,0}},  {/*1*/{ 57, 24,  0,  0},{ 57,247,198,132},{2,0,0,0}},
+  {/*1*/{ 57, 24,  8,  8},{ 57,255,181,123},{1,0,0,0}},  {/*1*/{ 57, 33,  0, 16},{ 57,206,206,115},{0,0,0,0}},  {/*1*/{ 57, 33,  8, 41},{ 57,214,189, 82},{1,0,0,0}},  {/*1*/{ 57, 33, 41,  0},{ 57,222,107,140},{2,0,0,0}},
+  {/*1*/{ 57, 33,  0,  8},{ 57,231,214,132},{3,0,0,0}},  {/*1*/{ 57, 33,  8, 16},{ 57,239,198,123},{4,0,0,0}},  {/*1*/{ 66, 49,  0,  0},{ 66,148,222,148},{4,0,0,0}},  {/*1*/{ 66, 33,  8,  8},{ 66,247,206,140},{3,0,0,0}},
+  {/*1*/{ 66, 33,  0, 16},{ 66,255,231,132},{2,0,0,0}},  {/*1*/{ 66, 41,  8,  0},{ 66,214,214,156},{1,0,0,0}},  {/*1*/{ 66, 41, 41, 49},{ 66,222,132, 90},{0,0,0,0}},  {/*1*/{ 66, 41,  0,  8},{ 66,231,239,148},{1,0,0,0}},
+  {/*1*/{ 66, 41,  8, 16},{ 66,239,222,140},{2,0,0,0}},  {/*1*/{ 66, 41,  0,  0},{ 66,247,247,165},{3,0,0,0}},  {/*1*/{ 66, 57,  8,  8},{ 66,156,231,156},{4,0,0,0}},  {/*1*/{ 74, 41,  0, 16},{ 74,255,255,148},{3,0,0,0}},
+  {/*1*/{ 74, 49,  8,  0},{ 74,214,239,173},{2,0,0,0}},  {/*1*/{ 74, 49, 16, 49},{ 74,222,222,107},{1,0,0,0}},  {/*1*/{ 74, 49, 33,  8},{ 74,231,181,165},{0,0,0,0}},  {/*1*/{ 74, 49,  8, 16},{ 74,239,247,156},{1,0,0,0}},
+  {/*1*/{ 74, 49, 16,  0},{ 74,247,231,181},{2,0,0,0}},  {/*1*/{ 74, 49,  8,  8},{ 74,255,255,173},{3,0,0,0}},  {/*1*/{ 74, 66, 16, 16},{ 74,156,239,165},{4,0,0,0}},  {/*1*/{ 82, 57, 24,  0},{ 82,214,222,189},{3,0,0,0}},
+  {/*1*/{ 82, 57, 16,  8},{ 82,222,247,181},{2,0,0,0}},  {/*1*/{ 82, 57, 33, 33},{ 82,231,206,148},{1,0,0,0}},  {/*1*/{ 82, 57, 24, 16},{ 82,239,231,173},{0,0,0,0}},  {/*1*/{ 82, 57, 16,  0},{ 82,247,255,198},{1,0,0,0}},
+  {/*1*/{ 82, 57, 24,  8},{ 82,255,239,189},{2,0,0,0}},  {/*1*/{ 82, 66, 41, 16},{ 82,206,198,181},{3,0,0,0}},  {/*1*/{ 82, 66, 24,  0},{ 82,214,247,206},{4,0,0,0}},  {/*1*/{ 90, 66, 41, 49},{ 90,222,206,140},{3,0,0,0}},
+  {/*1*/{ 90, 90, 24,  8},{ 90, 82,255,198},{2,0,0,0}},  {/*1*/{ 90, 66, 41, 41},{ 90,231,214,156},{1,0,0,0}},  {/*1*/{ 90, 66, 33,  0},{ 90,239,239,214},{0,0,0,0}},  {/*1*/{ 90, 66, 41,  8},{ 90,247,222,206},{1,0,0,0}},
+  {/*1*/{ 90, 66, 74, 16},{ 90,255,140,198},{2,0,0,0}},  {/*1*/{ 90, 74, 33,  0},{ 90,214,247,222},{3,0,0,0}},  {/*1*/{ 90, 74, 41,  8},{ 90,222,231,214},{4,0,0,0}},  {/*1*/{ 99, 82, 33, 33},{ 99,181,255,181},{4,0,0,0}},
+  {/*1*/{ 99, 74, 41, 16},{ 99,231,239,206},{3,0,0,0}},  {/*1*/{ 99, 74, 49,  0},{ 99,239,222,231},{2,0,0,0}},  {/*1*/{ 99, 74, 41,  8},{ 99,247,247,222},{1,0,0,0}},  {/*1*/{ 99, 74, 74, 16},{ 99,255,165,214},{0,0,0,0}},
+  {/*1*/{ 99, 82, 49,  0},{ 99,214,231,239},{1,0,0,0}},  {/*1*/{ 99, 82, 41, 49},{ 99,222,255,173},{2,0,0,0}},  {/*1*/{ 99, 82, 49,  8},{ 99,231,239,231},{3,0,0,0}},  {/*1*/{ 99, 90, 57, 41},{ 99,189,222,189},{4,0,0,0}},
+  {/*1*/{107, 82, 49,  0},{107,239,247,247},{3,0,0,0}},  {/*1*/{107, 82, 57,  8},{107,247,231,239},{2,0,0,0}},  {/*1*/{107, 82, 49, 16},{107,255,255,231},{1,0,0,0}},  {/*1*/{107, 90, 66,  0},{107,214,214,255},{0,0,0,0}},
+  {/*1*/{107, 90, 57,  8},{107,222,239,247},{1,0,0,0}},  {/*1*/{107, 90, 66, 33},{107,231,222,214},{2,0,0,0}},  {/*1*/{107, 90, 57, 16},{107,239,247,239},{3,0,0,0}},  {/*1*/{107, 99, 74, 24},{107,189,206,231},{4,0,0,0}},
+  {/*1*/{115, 90, 57,  8},{115,247,255,255},{3,0,0,0}},  {/*1*/{115, 90, 74, 16},{115,255,214,247},{2,0,0,0}},  {/*1*/{115, 99, 66, 24},{115,206,239,239},{1,0,0,0}},  {/*1*/{115, 99, 74, 49},{115,214,222,206},{0,0,0,0}},
+  {/*1*/{115, 99, 66, 16},{115,222,247,255},{1,0,0,0}},  {/*1*/{115, 99, 90, 41},{115,231,189,222},{2,0,0,0}},  {/*1*/{115, 99, 74, 24},{115,239,231,247},{3,0,0,0}},  {/*1*/{115, 99, 66, 33},{115,247,255,239},{4,0,0,0}},
+  {/*1*/{123, 99, 74, 82},{123,255,239,173},{3,0,0,0}},  {/*1*/{123,123, 82, 24},{123,115,222,255},{2,0,0,0}},  {/*1*/{123,107, 74, 74},{123,214,247,189},{1,0,0,0}},  {/*1*/{123,107, 82, 33},{123,222,231,247},{0,0,0,0}},
+  {/*1*/{123,107, 74, 41},{123,231,255,239},{1,0,0,0}},  {/*1*/{123,107,107, 49},{123,239,173,231},{2,0,0,0}},  {/*1*/{123,107, 82, 33},{123,247,239,255},{3,0,0,0}},  {/*1*/{123,107, 90, 41},{123,255,222,247},{4,0,0,0}},
+  {/*1*/{132,115, 82, 66},{132,214,247,214},{4,0,0,0}},  {/*1*/{132,132, 90, 49},{132,115,231,239},{3,0,0,0}},  {/*1*/{132,115, 82, 57},{132,222,255,231},{2,0,0,0}},  {/*1*/{132,115, 90, 41},{132,231,239,255},{1,0,0,0}},
+  {/*1*/{132,115,107, 49},{132,239,198,247},{0,0,0,0}},  {/*1*/{132,115, 99, 57},{132,247,222,239},{1,0,0,0}},  {/*1*/{132,115, 90, 82},{132,255,247,206},{2,0,0,0}},  {/*1*/{132,123,115, 49},{132,214,189,255},{3,0,0,0}},
+  {/*1*/{132,123, 90, 74},{132,222,255,222},{4,0,0,0}},  {/*1*/{140,132,107, 57},{140,173,214,247},{3,0,0,0}},  {/*1*/{140,123, 99, 66},{140,231,239,239},{2,0,0,0}},  {/*1*/{140,123,107,115},{140,239,222,173},{1,0,0,0}},
+  {/*1*/{140,123, 99, 57},{140,247,247,255},{0,0,0,0}},  {/*1*/{140,123,107, 82},{140,255,231,222},{1,0,0,0}},  {/*1*/{140,132, 99, 66},{140,206,255,247},{2,0,0,0}},  {/*1*/{140,132,132, 74},{140,214,173,239},{3,0,0,0}},
+  {/*1*/{140,132,107, 82},{140,222,239,231},{4,0,0,0}},  {/*1*/{148,132,115, 66},{148,231,222,255},{3,0,0,0}},  {/*1*/{148,140,107, 74},{148,189,247,247},{2,0,0,0}},  {/*1*/{148,132,115, 99},{148,239,231,214},{1,0,0,0}},
+  {/*1*/{148,132,107, 82},{148,247,255,239},{0,0,0,0}},  {/*1*/{148,132,115, 90},{148,255,239,231},{1,0,0,0}},  {/*1*/{148,140,123, 74},{148,214,222,255},{2,0,0,0}},  {/*1*/{148,140,140, 82},{148,222,181,247},{3,0,0,0}},
+  {/*1*/{148,140,115, 90},{148,231,247,239},{4,0,0,0}},  {/*1*/{156,140,123,115},{156,239,231,206},{3,0,0,0}},  {/*1*/{156,156,115, 82},{156,148,255,255},{2,0,0,0}},  {/*1*/{156,140,123,107},{156,247,239,222},{1,0,0,0}},
+  {/*1*/{156,140,140, 90},{156,255,198,247},{0,0,0,0}},  {/*1*/{156,148,123,140},{156,214,247,181},{1,0,0,0}},  {/*1*/{156,148,140, 99},{156,222,206,239},{2,0,0,0}},  {/*1*/{156,148,132, 90},{156,231,231,255},{3,0,0,0}},
+  {/*1*/{156,148,123,115},{156,239,255,222},{4,0,0,0}},  {/*1*/{165,148,173, 99},{165,247,132,247},{4,0,0,0}},  {/*1*/{165,165,132,107},{165,148,239,239},{3,0,0,0}},  {/*1*/{165,148,140,115},{165,255,222,231},{2,0,0,0}},
+  {/*1*/{165,156,132, 99},{165,214,247,255},{1,0,0,0}},  {/*1*/{165,156,140,148},{165,222,231,189},{0,0,0,0}},  {/*1*/{165,156,132,107},{165,231,255,247},{1,0,0,0}},  {/*1*/{165,156,140,115},{165,239,239,239},{2,0,0,0}},
+  {/*1*/{165,156,148,123},{165,247,222,231},{3,0,0,0}},  {/*1*/{165,156,165,107},{165,255,181,255},{4,0,0,0}},  {/*1*/{173,165,140,115},{173,206,247,247},{3,0,0,0}},  {/*1*/{173,165,148,123},{173,214,231,239},{2,0,0,0}},
+  {/*1*/{173,181,140,148},{173,123,255,206},{1,0,0,0}},  {/*1*/{173,165,148,132},{173,222,239,231},{0,0,0,0}},  {/*1*/{173,165,156,115},{173,231,222,255},{1,0,0,0}},  {/*1*/{173,165,148,123},{173,239,247,247},{2,0,0,0}},
+  {/*1*/{173,165,165,173},{173,247,206,181},{3,0,0,0}},  {/*1*/{173,165,156,132},{173,255,231,239},{4,0,0,0}},  {/*1*/{181,173,148,123},{181,214,255,255},{3,0,0,0}},  {/*1*/{181,173,156,148},{181,222,239,222},{2,0,0,0}},
+  {/*1*/{181,189,173,132},{181,132,198,247},{1,0,0,0}},  {/*1*/{181,173,156,140},{181,231,247,239},{0,0,0,0}},  {/*1*/{181,173,173,165},{181,239,206,206},{1,0,0,0}},  {/*1*/{181,173,156,132},{181,247,255,255},{2,0,0,0}},
+  {/*1*/{181,173,173,181},{181,255,214,189},{3,0,0,0}},  {/*1*/{181,181,165,140},{181,214,239,247},{4,0,0,0}},  {/*1*/{189,181,173,148},{189,222,222,239},{3,0,0,0}},  {/*1*/{189,189,206,156},{189,181,140,231},{2,0,0,0}},
+  {/*1*/{189,181,165,140},{189,231,247,255},{1,0,0,0}},  {/*1*/{189,181,173,148},{189,239,231,247},{0,0,0,0}},  {/*1*/{189,181,165,173},{189,247,255,214},{1,0,0,0}},  {/*1*/{189,181,173,156},{189,255,239,239},{2,0,0,0}},
+  {/*1*/{189,189,181,165},{189,214,222,231},{3,0,0,0}},  {/*1*/{189,189,173,148},{189,222,247,255},{4,0,0,0}},  {/*1*/{198,189,206,156},{198,231,165,247},{4,0,0,0}},  {/*1*/{198,198,181,206},{198,181,231,181},{3,0,0,0}},
+  {/*1*/{198,189,173,165},{198,239,255,239},{2,0,0,0}},  {/*1*/{198,189,181,156},{198,247,239,255},{1,0,0,0}},  {/*1*/{198,189,189,181},{198,255,222,222},{0,0,0,0}},  {/*1*/{198,198,181,165},{198,206,247,247},{1,0,0,0}},
+  {/*1*/{198,198,189,173},{198,214,231,239},{2,0,0,0}},  {/*1*/{198,198,181,198},{198,222,255,206},{3,0,0,0}},  {/*1*/{198,198,198,165},{198,231,214,255},{4,0,0,0}},  {/*1*/{206,198,189,214},{206,239,239,189},{3,0,0,0}},
+  {/*1*/{206,198,198,173},{206,247,222,247},{2,0,0,0}},  {/*1*/{206,214,189,181},{206,156,247,239},{1,0,0,0}},  {/*1*/{206,198,206,189},{206,255,206,231},{0,0,0,0}},  {/*1*/{206,206,189,173},{206,214,255,255},{1,0,0,0}},
+  {/*1*/{206,206,206,181},{206,222,214,247},{2,0,0,0}},  {/*1*/{206,206,198,206},{206,231,239,214},{3,0,0,0}},  {/*1*/{206,206,206,189},{206,239,222,239},{4,0,0,0}},  {/*1*/{214,206,198,198},{214,247,247,231},{3,0,0,0}},
+  {/*1*/{214,206,222,181},{214,255,189,255},{2,0,0,0}},  {/*1*/{214,222,206,189},{214,165,231,247},{1,0,0,0}},  {/*1*/{214,214,198,214},{214,214,255,214},{0,0,0,0}},  {/*1*/{214,214,206,198},{214,222,239,239},{1,0,0,0}},
+  {/*1*/{214,214,214,189},{214,231,222,255},{2,0,0,0}},  {/*1*/{214,214,206,214},{214,239,247,222},{3,0,0,0}},  {/*1*/{214,214,214,198},{214,247,231,247},{4,0,0,0}},  {/*1*/{222,214,206,206},{222,255,255,239},{3,0,0,0}},
+  {/*1*/{222,222,239,231},{222,214,173,206},{2,0,0,0}},  {/*1*/{222,231,214,214},{222,165,239,231},{1,0,0,0}},  {/*1*/{222,222,222,198},{222,222,222,255},{0,0,0,0}},  {/*1*/{222,222,214,206},{222,231,247,247},{1,0,0,0}},
+  {/*1*/{222,222,222,214},{222,239,231,239},{2,0,0,0}},  {/*1*/{222,222,214,222},{222,247,255,231},{3,0,0,0}},  {/*1*/{222,222,222,206},{222,255,239,255},{4,0,0,0}},  {/*1*/{231,231,239,214},{231,206,198,247},{4,0,0,0}},
+  {/*1*/{231,231,231,239},{231,214,222,214},{3,0,0,0}},  {/*1*/{231,231,222,222},{231,222,247,239},{2,0,0,0}},  {/*1*/{231,239,247,255},{231,181,189,198},{1,0,0,0}},  {/*1*/{231,231,222,214},{231,231,255,255},{0,0,0,0}},
+  {/*1*/{231,231,222,222},{231,239,255,247},{1,0,1,0}},  {/*1*/{231,231,231,247},{231,247,239,214},{2,0,0,0}},  {/*1*/{231,231,239,231},{231,255,222,239},{3,0,0,0}},  {/*1*/{231,239,231,222},{231,214,247,255},{4,0,0,0}},
+  {/*1*/{239,239,239,247},{239,222,231,222},{3,0,0,0}},  {/*1*/{239,239,231,231},{239,231,255,247},{2,0,0,0}},  {/*1*/{239,247,255,231},{239,189,198,247},{1,0,0,1}},  {/*1*/{239,239,239,239},{239,239,239,239},{0,0,0,0}},
+  {/*1*/{239,239,239,247},{239,247,239,231},{1,0,1,0}},  {/*1*/{239,239,239,231},{239,255,247,255},{2,0,0,0}},  {/*1*/{239,247,247,239},{239,214,231,247},{3,0,0,0}},  {/*1*/{239,247,239,247},{239,222,255,239},{4,0,0,0}},
+  {/*1*/{247,247,247,255},{247,231,239,231},{3,0,0,0}},  {/*1*/{247,247,255,239},{247,239,222,255},{2,0,0,0}},  {/*1*/{247,255,247,239},{247,198,247,255},{1,0,1,1}},  {/*1*/{247,247,247,247},{247,247,247,247},{0,0,0,0}},
+  {/*1*/{247,247,255,255},{247,255,231,239},{1,0,0,0}},  {/*1*/{247,255,247,247},{247,214,255,255},{2,0,0,1}},  {/*1*/{247,255,255,247},{247,222,239,255},{3,0,0,0}},  {/*1*/{247,255,255,255},{247,231,247,247},{4,0,1,0}},
+  {/*1*/{255,255,255,255},{255,239,247,247},{3,0,0,1}},  {/*1*/{255,255,255,255},{255,247,247,255},{2,0,1,2}},  {/*1*/{255,255,255,255},{255,255,255,255},{1,1,1,1}},  {/*1*/{255,255,255,255},{255,255,255,255},{0,0,0,0}}
 };
 
 /* 256 * 4 * 3 * 1 = 3072 */
 static PaletteSingleLookup4 const sp_lookup_6_8[256] =
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  0,  0,1},{  0,  8,0},{  0,  4,0},{  0,  4,0}}},  {{/*1*/{  0,  0,2},{  0, 16,0},{  0,  8,0},{  4,  0,0}}},  {{/*1*/{  4,  4,1},{  0, 24,0},{  0, 12,0},{  0,  8,0}}},
-  {{/*1*/{  4,  4,0},{  0, 32,0},{  0, 16,0},{  4,  4,0}}},  {{/*1*/{  4,  4,1},{  0, 36,0},{  0, 20,0},{  0, 12,0}}},  {{/*1*/{  4,  4,2},{  0, 44,0},{  0, 24,0},{  0, 16,0}}},  {{/*1*/{  8,  8,1},{  0, 52,0},{  0, 28,0},{  4, 12,0}}},
-  {{/*1*/{  8,  8,0},{  0, 60,0},{  4, 20,0},{  0, 20,0}}},  {{/*1*/{  8,  8,1},{  0, 65,0},{  0, 32,0},{  4, 16,0}}},  {{/*1*/{  8,  8,2},{  0, 73,0},{  0, 36,0},{  0, 24,0}}},  {{/*1*/{ 12, 12,1},{  0, 81,0},{  0, 40,0},{  0, 28,0}}},
-  {{/*1*/{ 12, 12,0},{  0, 89,0},{  0, 44,0},{  4, 24,0}}},  {{/*1*/{ 12, 12,1},{  0, 93,0},{  0, 48,0},{  0, 32,0}}},  {{/*1*/{ 12, 12,2},{  0,101,0},{  0, 52,0},{  4, 28,0}}},  {{/*1*/{ 16, 16,1},{  0,109,0},{  0, 56,0},{  0, 36,0}}},
-  {{/*1*/{ 16, 16,0},{  0,117,0},{  0, 60,0},{  0, 40,0}}},  {{/*1*/{ 16, 16,1},{  0,121,0},{  4, 52,0},{  4, 36,0}}},  {{/*1*/{ 16, 16,2},{  0,130,0},{  0, 65,0},{  0, 44,0}}},  {{/*1*/{ 20, 20,1},{  0,138,0},{  0, 69,0},{  4, 40,0}}},
-  {{/*1*/{ 20, 20,0},{  0,146,0},{  0, 73,0},{  0, 48,0}}},  {{/*1*/{ 20, 20,1},{  0,150,0},{  0, 77,0},{  0, 52,0}}},  {{/*1*/{ 20, 20,2},{  0,158,0},{  0, 81,0},{  4, 48,0}}},  {{/*1*/{ 24, 24,1},{  0,166,0},{  0, 85,0},{  0, 56,0}}},
-  {{/*1*/{ 24, 24,0},{  0,174,0},{  4, 77,0},{  4, 52,0}}},  {{/*1*/{ 24, 24,1},{  0,178,0},{  0, 89,0},{  0, 60,0}}},  {{/*1*/{ 24, 24,2},{  0,186,0},{  0, 93,0},{  8, 52,0}}},  {{/*1*/{ 28, 28,1},{  0,195,0},{  0, 97,0},{  0, 65,0}}},
-  {{/*1*/{ 28, 28,0},{  0,203,0},{  0,101,0},{  8, 56,0}}},  {{/*1*/{ 28, 28,1},{  0,207,0},{  0,105,0},{  0, 69,0}}},  {{/*1*/{ 28, 28,2},{  0,215,0},{  0,109,0},{  0, 73,0}}},  {{/*1*/{ 32, 32,1},{  0,223,0},{  0,113,0},{  4, 69,0}}},
-  {{/*1*/{ 32, 32,0},{  0,231,0},{  0,117,0},{  0, 77,0}}},  {{/*1*/{ 32, 32,1},{  0,235,0},{  4,109,0},{  4, 73,0}}},  {{/*1*/{ 32, 32,2},{  0,243,0},{  0,121,0},{  0, 81,0}}},  {{/*1*/{ 36, 36,1},{  0,251,0},{  0,125,0},{  0, 85,0}}},
-  {{/*1*/{ 36, 36,0},{  4,235,0},{  0,130,0},{  4, 81,0}}},  {{/*1*/{ 36, 36,1},{  4,239,0},{  0,134,0},{  0, 89,0}}},  {{/*1*/{ 36, 36,2},{  4,247,0},{  0,138,0},{  4, 85,0}}},  {{/*1*/{ 40, 40,1},{  4,255,0},{  0,142,0},{  0, 93,0}}},
-  {{/*1*/{ 40, 40,0},{  8,239,0},{  4,134,0},{  0, 97,0}}},  {{/*1*/{ 40, 40,1},{  8,243,0},{  0,146,0},{  4, 93,0}}},  {{/*1*/{ 40, 40,2},{  8,251,0},{  0,150,0},{  0,101,0}}},  {{/*1*/{ 44, 44,1},{ 12,235,0},{  0,154,0},{  4, 97,0}}},
-  {{/*1*/{ 44, 44,0},{ 12,243,0},{  0,158,0},{  0,105,0}}},  {{/*1*/{ 44, 44,1},{ 12,247,0},{  0,162,0},{  0,109,0}}},  {{/*1*/{ 44, 44,2},{ 12,255,0},{  0,166,0},{  4,105,0}}},  {{/*1*/{ 48, 48,1},{ 16,239,0},{  0,170,0},{  0,113,0}}},
-  {{/*1*/{ 48, 48,0},{ 16,247,0},{  0,174,0},{  4,109,0}}},  {{/*1*/{ 48, 48,1},{ 16,251,0},{  4,166,0},{  0,117,0}}},  {{/*1*/{ 48, 48,2},{ 20,235,0},{  0,178,0},{  8,109,0}}},  {{/*1*/{ 52, 52,1},{ 20,243,0},{  0,182,0},{  0,121,0}}},
-  {{/*1*/{ 52, 52,0},{ 20,251,0},{  0,186,0},{  0,125,0}}},  {{/*1*/{ 52, 52,1},{ 20,255,0},{  0,190,0},{  4,121,0}}},  {{/*1*/{ 52, 52,2},{ 24,239,0},{  0,195,0},{  0,130,0}}},  {{/*1*/{ 56, 56,1},{ 24,247,0},{  0,199,0},{  4,125,0}}},
-  {{/*1*/{ 56, 56,0},{ 24,255,0},{  4,190,0},{  0,134,0}}},  {{/*1*/{ 56, 56,1},{ 28,235,0},{  0,203,0},{  4,130,0}}},  {{/*1*/{ 56, 56,2},{ 28,243,0},{  0,207,0},{  0,138,0}}},  {{/*1*/{ 60, 60,1},{ 28,251,0},{  0,211,0},{  0,142,0}}},
-  {{/*1*/{ 60, 60,0},{ 32,235,0},{  0,215,0},{  4,138,0}}},  {{/*1*/{ 60, 60,1},{ 32,239,0},{  0,219,0},{  0,146,0}}},  {{/*1*/{ 60, 60,2},{ 32,247,0},{  0,223,0},{  4,142,0}}},  {{/*1*/{ 65, 65,2},{ 32,255,0},{  0,227,0},{  0,150,0}}},
-  {{/*1*/{ 65, 65,1},{ 36,239,0},{  0,231,0},{  0,154,0}}},  {{/*1*/{ 65, 65,0},{ 36,243,0},{  4,223,0},{  4,150,0}}},  {{/*1*/{ 65, 65,1},{ 36,251,0},{  0,235,0},{  0,158,0}}},  {{/*1*/{ 65, 65,2},{ 40,235,0},{  0,239,0},{  4,154,0}}},
-  {{/*1*/{ 69, 69,1},{ 40,243,0},{  0,243,0},{  0,162,0}}},  {{/*1*/{ 69, 69,0},{ 40,247,0},{  0,247,0},{  8,154,0}}},  {{/*1*/{ 69, 69,1},{ 40,255,0},{  0,251,0},{  0,166,0}}},  {{/*1*/{ 69, 69,2},{ 44,239,0},{  0,255,0},{  0,170,0}}},
-  {{/*1*/{ 73, 73,1},{ 44,247,0},{  4,247,0},{  4,166,0}}},  {{/*1*/{ 73, 73,0},{ 44,251,0},{  4,251,0},{  0,174,0}}},  {{/*1*/{ 73, 73,1},{ 48,235,0},{  4,255,0},{  4,170,0}}},  {{/*1*/{ 73, 73,2},{ 48,243,0},{  8,247,0},{  0,178,0}}},
-  {{/*1*/{ 77, 77,1},{ 48,251,0},{  8,251,0},{  0,182,0}}},  {{/*1*/{ 77, 77,0},{ 48,255,0},{  8,255,0},{  4,178,0}}},  {{/*1*/{ 77, 77,1},{ 52,239,0},{ 12,247,0},{  0,186,0}}},  {{/*1*/{ 77, 77,2},{ 52,247,0},{ 12,251,0},{  4,182,0}}},
-  {{/*1*/{ 81, 81,1},{ 52,255,0},{ 12,255,0},{  0,190,0}}},  {{/*1*/{ 81, 81,0},{ 56,235,0},{ 20,239,0},{  8,182,0}}},  {{/*1*/{ 81, 81,1},{ 56,243,0},{ 16,251,0},{  0,195,0}}},  {{/*1*/{ 81, 81,2},{ 56,251,0},{ 16,255,0},{  0,199,0}}},
-  {{/*1*/{ 85, 85,1},{ 60,231,0},{ 20,251,0},{  4,195,0}}},  {{/*1*/{ 85, 85,0},{ 60,239,0},{ 24,243,0},{  0,203,0}}},  {{/*1*/{ 85, 85,1},{ 60,247,0},{ 20,255,0},{  4,199,0}}},  {{/*1*/{ 85, 85,2},{ 60,255,0},{ 24,251,0},{  0,207,0}}},
-  {{/*1*/{ 89, 89,1},{ 65,231,0},{ 24,255,0},{  8,199,0}}},  {{/*1*/{ 89, 89,0},{ 65,239,0},{ 28,247,0},{  0,211,0}}},  {{/*1*/{ 89, 89,1},{ 65,243,0},{ 28,251,0},{  0,215,0}}},  {{/*1*/{ 89, 89,2},{ 65,251,0},{ 28,255,0},{  4,211,0}}},
-  {{/*1*/{ 93, 93,1},{ 69,235,0},{ 32,247,0},{  0,219,0}}},  {{/*1*/{ 93, 93,0},{ 69,243,0},{ 32,251,0},{  4,215,0}}},  {{/*1*/{ 93, 93,1},{ 69,247,0},{ 32,255,0},{  0,223,0}}},  {{/*1*/{ 93, 93,2},{ 69,255,0},{ 36,247,0},{  0,227,0}}},
-  {{/*1*/{ 97, 97,1},{ 73,239,0},{ 36,251,0},{  4,223,0}}},  {{/*1*/{ 97, 97,0},{ 73,247,0},{ 36,255,0},{  0,231,0}}},  {{/*1*/{ 97, 97,1},{ 73,251,0},{ 40,247,0},{  4,227,0}}},  {{/*1*/{ 97, 97,2},{ 77,235,0},{ 40,251,0},{  0,235,0}}},
-  {{/*1*/{101,101,1},{ 77,243,0},{ 40,255,0},{  0,239,0}}},  {{/*1*/{101,101,0},{ 77,251,0},{ 44,247,0},{  4,235,0}}},  {{/*1*/{101,101,1},{ 77,255,0},{ 44,251,0},{  0,243,0}}},  {{/*1*/{101,101,2},{ 81,239,0},{ 44,255,0},{  4,239,0}}},
-  {{/*1*/{105,105,1},{ 81,247,0},{ 52,239,0},{  0,247,0}}},  {{/*1*/{105,105,0},{ 81,255,0},{ 48,251,0},{  0,251,0}}},  {{/*1*/{105,105,1},{ 85,235,0},{ 48,255,0},{  4,247,0}}},  {{/*1*/{105,105,2},{ 85,243,0},{ 52,251,0},{  0,255,0}}},
-  {{/*1*/{109,109,1},{ 85,251,0},{ 56,243,0},{  4,251,0}}},  {{/*1*/{109,109,0},{ 89,235,0},{ 52,255,0},{  4,255,0}}},  {{/*1*/{109,109,1},{ 89,239,0},{ 56,251,0},{  8,251,0}}},  {{/*1*/{109,109,2},{ 89,247,0},{ 56,255,0},{ 12,247,0}}},
-  {{/*1*/{113,113,1},{ 89,255,0},{ 60,247,0},{  8,255,0}}},  {{/*1*/{113,113,0},{ 93,239,0},{ 60,251,0},{ 16,247,0}}},  {{/*1*/{113,113,1},{ 93,243,0},{ 60,255,0},{ 12,255,0}}},  {{/*1*/{113,113,2},{ 93,251,0},{ 65,243,0},{ 16,251,0}}},
-  {{/*1*/{117,117,1},{ 97,235,0},{ 65,247,0},{ 16,255,0}}},  {{/*1*/{117,117,0},{ 97,243,0},{ 65,251,0},{ 20,251,0}}},  {{/*1*/{117,117,1},{ 97,247,0},{ 65,255,0},{ 24,247,0}}},  {{/*1*/{117,117,2},{ 97,255,0},{ 69,247,0},{ 20,255,0}}},
-  {{/*1*/{121,121,1},{101,239,0},{ 69,251,0},{ 28,247,0}}},  {{/*1*/{121,121,0},{101,247,0},{ 69,255,0},{ 24,255,0}}},  {{/*1*/{121,121,1},{101,251,0},{ 77,239,0},{ 28,251,0}}},  {{/*1*/{121,121,2},{105,235,0},{ 73,251,0},{ 28,255,0}}},
-  {{/*1*/{125,125,1},{105,243,0},{ 73,255,0},{ 32,251,0}}},  {{/*1*/{125,125,0},{105,251,0},{ 77,251,0},{ 36,247,0}}},  {{/*1*/{125,125,1},{105,255,0},{ 81,243,0},{ 32,255,0}}},  {{/*1*/{125,125,2},{109,239,0},{ 77,255,0},{ 40,247,0}}},
-  {{/*1*/{130,130,2},{109,247,0},{ 81,251,0},{ 36,255,0}}},  {{/*1*/{130,130,1},{109,255,0},{ 81,255,0},{ 40,251,0}}},  {{/*1*/{130,130,0},{113,235,0},{ 85,247,0},{ 40,255,0}}},  {{/*1*/{130,130,1},{113,243,0},{ 85,251,0},{ 44,251,0}}},
-  {{/*1*/{130,130,2},{113,251,0},{ 85,255,0},{ 52,243,0}}},  {{/*1*/{134,134,1},{117,231,0},{ 89,247,0},{ 44,255,0}}},  {{/*1*/{134,134,0},{117,239,0},{ 89,251,0},{ 52,247,0}}},  {{/*1*/{134,134,1},{117,247,0},{ 89,255,0},{ 48,255,0}}},
-  {{/*1*/{134,134,2},{117,255,0},{ 93,247,0},{ 56,247,0}}},  {{/*1*/{138,138,1},{121,235,0},{ 93,251,0},{ 52,255,0}}},  {{/*1*/{138,138,0},{121,243,0},{ 93,255,0},{ 56,251,0}}},  {{/*1*/{138,138,1},{121,251,0},{ 97,247,0},{ 56,255,0}}},
-  {{/*1*/{138,138,2},{125,235,0},{ 97,251,0},{ 60,251,0}}},  {{/*1*/{142,142,1},{125,239,0},{ 97,255,0},{ 65,247,0}}},  {{/*1*/{142,142,0},{125,247,0},{101,247,0},{ 60,255,0}}},  {{/*1*/{142,142,1},{125,255,0},{101,251,0},{ 65,251,0}}},
-  {{/*1*/{142,142,2},{130,231,0},{101,255,0},{ 69,247,0}}},  {{/*1*/{146,146,1},{130,239,0},{109,239,0},{ 65,255,0}}},  {{/*1*/{146,146,0},{130,247,0},{105,251,0},{ 73,247,0}}},  {{/*1*/{146,146,1},{130,251,0},{105,255,0},{ 69,255,0}}},
-  {{/*1*/{146,146,2},{134,235,0},{109,251,0},{ 73,251,0}}},  {{/*1*/{150,150,1},{134,243,0},{113,243,0},{ 73,255,0}}},  {{/*1*/{150,150,0},{134,251,0},{109,255,0},{ 77,251,0}}},  {{/*1*/{150,150,1},{134,255,0},{113,251,0},{ 81,247,0}}},
-  {{/*1*/{150,150,2},{138,239,0},{113,255,0},{ 77,255,0}}},  {{/*1*/{154,154,1},{138,247,0},{117,247,0},{ 85,247,0}}},  {{/*1*/{154,154,0},{138,255,0},{117,251,0},{ 81,255,0}}},  {{/*1*/{154,154,1},{142,235,0},{117,255,0},{ 85,251,0}}},
-  {{/*1*/{154,154,2},{142,243,0},{121,247,0},{ 85,255,0}}},  {{/*1*/{158,158,1},{142,251,0},{121,251,0},{ 89,251,0}}},  {{/*1*/{158,158,0},{146,235,0},{121,255,0},{ 97,243,0}}},  {{/*1*/{158,158,1},{146,239,0},{125,247,0},{ 89,255,0}}},
-  {{/*1*/{158,158,2},{146,247,0},{125,251,0},{ 97,247,0}}},  {{/*1*/{162,162,1},{146,255,0},{125,255,0},{ 93,255,0}}},  {{/*1*/{162,162,0},{150,239,0},{130,247,0},{101,247,0}}},  {{/*1*/{162,162,1},{150,243,0},{134,239,0},{ 97,255,0}}},
-  {{/*1*/{162,162,2},{150,251,0},{130,251,0},{101,251,0}}},  {{/*1*/{166,166,1},{154,235,0},{130,255,0},{101,255,0}}},  {{/*1*/{166,166,0},{154,243,0},{134,251,0},{105,251,0}}},  {{/*1*/{166,166,1},{154,247,0},{138,243,0},{109,247,0}}},
-  {{/*1*/{166,166,2},{154,255,0},{134,255,0},{105,255,0}}},  {{/*1*/{170,170,1},{158,239,0},{138,251,0},{113,247,0}}},  {{/*1*/{170,170,0},{158,247,0},{138,255,0},{109,255,0}}},  {{/*1*/{170,170,1},{158,251,0},{142,247,0},{113,251,0}}},
-  {{/*1*/{170,170,2},{162,235,0},{142,251,0},{113,255,0}}},  {{/*1*/{174,174,1},{162,243,0},{142,255,0},{117,251,0}}},  {{/*1*/{174,174,0},{162,251,0},{146,247,0},{121,247,0}}},  {{/*1*/{174,174,1},{162,255,0},{146,251,0},{117,255,0}}},
-  {{/*1*/{174,174,2},{166,239,0},{146,255,0},{125,247,0}}},  {{/*1*/{178,178,1},{166,247,0},{150,247,0},{121,255,0}}},  {{/*1*/{178,178,0},{166,255,0},{150,251,0},{125,251,0}}},  {{/*1*/{178,178,1},{170,235,0},{150,255,0},{125,255,0}}},
-  {{/*1*/{178,178,2},{170,243,0},{154,247,0},{138,239,0}}},  {{/*1*/{182,182,1},{170,251,0},{154,251,0},{130,251,0}}},  {{/*1*/{182,182,0},{174,231,0},{154,255,0},{130,255,0}}},  {{/*1*/{182,182,1},{174,239,0},{158,247,0},{134,251,0}}},
-  {{/*1*/{182,182,2},{174,247,0},{158,251,0},{142,243,0}}},  {{/*1*/{186,186,1},{174,255,0},{158,255,0},{134,255,0}}},  {{/*1*/{186,186,0},{178,235,0},{166,239,0},{142,247,0}}},  {{/*1*/{186,186,1},{178,243,0},{162,251,0},{138,255,0}}},
-  {{/*1*/{186,186,2},{178,251,0},{162,255,0},{146,247,0}}},  {{/*1*/{190,190,1},{182,235,0},{166,251,0},{142,255,0}}},  {{/*1*/{190,190,0},{182,239,0},{170,243,0},{146,251,0}}},  {{/*1*/{190,190,1},{182,247,0},{166,255,0},{146,255,0}}},
-  {{/*1*/{190,190,2},{182,255,0},{170,251,0},{150,251,0}}},  {{/*1*/{195,195,2},{186,239,0},{170,255,0},{154,247,0}}},  {{/*1*/{195,195,1},{186,243,0},{174,247,0},{150,255,0}}},  {{/*1*/{195,195,0},{186,251,0},{174,251,0},{158,247,0}}},
-  {{/*1*/{195,195,1},{190,235,0},{174,255,0},{154,255,0}}},  {{/*1*/{195,195,2},{190,243,0},{178,247,0},{158,251,0}}},  {{/*1*/{199,199,1},{190,247,0},{178,251,0},{158,255,0}}},  {{/*1*/{199,199,0},{190,255,0},{178,255,0},{162,251,0}}},
-  {{/*1*/{199,199,1},{195,231,0},{182,247,0},{166,247,0}}},  {{/*1*/{199,199,2},{195,239,0},{182,251,0},{162,255,0}}},  {{/*1*/{203,203,1},{195,247,0},{182,255,0},{170,247,0}}},  {{/*1*/{203,203,0},{195,255,0},{186,247,0},{166,255,0}}},
-  {{/*1*/{203,203,1},{199,235,0},{186,251,0},{170,251,0}}},  {{/*1*/{203,203,2},{199,243,0},{186,255,0},{170,255,0}}},  {{/*1*/{207,207,1},{199,251,0},{190,247,0},{174,251,0}}},  {{/*1*/{207,207,0},{203,235,0},{190,251,0},{178,247,0}}},
-  {{/*1*/{207,207,1},{203,239,0},{190,255,0},{174,255,0}}},  {{/*1*/{207,207,2},{203,247,0},{195,247,0},{182,247,0}}},  {{/*1*/{211,211,1},{203,255,0},{195,251,0},{178,255,0}}},  {{/*1*/{211,211,0},{207,239,0},{195,255,0},{182,251,0}}},
-  {{/*1*/{211,211,1},{207,243,0},{199,247,0},{182,255,0}}},  {{/*1*/{211,211,2},{207,251,0},{199,251,0},{186,251,0}}},  {{/*1*/{215,215,1},{211,235,0},{199,255,0},{190,247,0}}},  {{/*1*/{215,215,0},{211,243,0},{203,247,0},{186,255,0}}},
-  {{/*1*/{215,215,1},{211,247,0},{203,251,0},{195,247,0}}},  {{/*1*/{215,215,2},{211,255,0},{203,255,0},{190,255,0}}},  {{/*1*/{219,219,1},{215,239,0},{207,247,0},{195,251,0}}},  {{/*1*/{219,219,0},{215,247,0},{207,251,0},{199,247,0}}},
-  {{/*1*/{219,219,1},{215,251,0},{207,255,0},{195,255,0}}},  {{/*1*/{219,219,2},{219,235,0},{211,247,0},{203,247,0}}},  {{/*1*/{223,223,1},{219,243,0},{211,251,0},{199,255,0}}},  {{/*1*/{223,223,0},{219,251,0},{211,255,0},{203,251,0}}},
-  {{/*1*/{223,223,1},{219,255,0},{215,247,0},{203,255,0}}},  {{/*1*/{223,223,2},{223,239,0},{215,251,0},{207,251,0}}},  {{/*1*/{227,227,1},{223,247,0},{215,255,0},{211,247,0}}},  {{/*1*/{227,227,0},{223,255,0},{223,239,0},{207,255,0}}},
-  {{/*1*/{227,227,1},{227,235,0},{219,251,0},{215,247,0}}},  {{/*1*/{227,227,2},{227,243,0},{219,255,0},{211,255,0}}},  {{/*1*/{231,231,1},{227,251,0},{223,251,0},{215,251,0}}},  {{/*1*/{231,231,0},{231,231,0},{227,243,0},{215,255,0}}},
-  {{/*1*/{231,231,1},{231,239,0},{223,255,0},{219,251,0}}},  {{/*1*/{231,231,2},{231,247,0},{227,251,0},{223,247,0}}},  {{/*1*/{235,235,1},{231,255,0},{227,255,0},{219,255,0}}},  {{/*1*/{235,235,0},{235,235,0},{231,247,0},{227,247,0}}},
-  {{/*1*/{235,235,1},{235,243,0},{231,251,0},{223,255,0}}},  {{/*1*/{235,235,2},{235,251,0},{231,255,0},{227,251,0}}},  {{/*1*/{239,239,1},{239,235,0},{235,247,0},{227,255,0}}},  {{/*1*/{239,239,0},{239,239,0},{235,251,0},{231,251,0}}},
-  {{/*1*/{239,239,1},{239,247,0},{235,255,0},{235,247,0}}},  {{/*1*/{239,239,2},{239,255,0},{239,247,0},{231,255,0}}},  {{/*1*/{243,243,1},{243,239,0},{239,251,0},{239,247,0}}},  {{/*1*/{243,243,0},{243,243,0},{239,255,0},{235,255,0}}},
-  {{/*1*/{243,243,1},{243,251,0},{243,247,0},{239,251,0}}},  {{/*1*/{243,243,2},{247,239,0},{243,251,0},{239,255,0}}},  {{/*1*/{247,247,1},{247,243,0},{243,255,0},{243,251,0}}},  {{/*1*/{247,247,0},{247,247,0},{247,247,0},{247,247,0}}},
-  {{/*1*/{247,247,1},{247,255,0},{247,251,0},{243,255,0}}},  {{/*1*/{247,247,2},{251,243,0},{247,255,0},{251,247,0}}},  {{/*1*/{251,251,1},{251,247,0},{255,239,0},{247,255,0}}},  {{/*1*/{251,251,0},{251,251,0},{251,251,0},{251,251,0}}},
-  {{/*1*/{251,251,1},{255,239,0},{251,255,0},{251,255,0}}},  {{/*1*/{251,251,2},{255,247,0},{255,251,0},{255,251,0}}},  {{/*1*/{255,255,1},{255,251,0},{255,255,1},{255,255,1}}},  {{/*1*/{255,255,0},{255,255,0},{255,255,0},{255,255,0}}}
+  {/*1*/{  0,  0,  0,  0},{  0,  0,  0,  0},{0,0,0,0}},  {/*1*/{  0,  0,  0,  0},{  0,  8,  4,  4},{1,0,0,0}},  {/*1*/{  0,  0,  0,  4},{  0, 16,  8,  0},{2,0,0,0}},  {/*1*/{  4,  0,  0,  0},{  4, 24, 12,  8},{1,0,0,0}},
+  {/*1*/{  4,  0,  0,  4},{  4, 32, 16,  4},{0,0,0,0}},  {/*1*/{  4,  0,  0,  0},{  4, 36, 20, 12},{1,0,0,0}},  {/*1*/{  4,  0,  0,  0},{  4, 44, 24, 16},{2,0,0,0}},  {/*1*/{  8,  0,  0,  4},{  8, 52, 28, 12},{1,0,0,0}},
+  {/*1*/{  8,  0,  4,  0},{  8, 60, 20, 20},{0,0,0,0}},  {/*1*/{  8,  0,  0,  4},{  8, 65, 32, 16},{1,0,0,0}},  {/*1*/{  8,  0,  0,  0},{  8, 73, 36, 24},{2,0,0,0}},  {/*1*/{ 12,  0,  0,  0},{ 12, 81, 40, 28},{1,0,0,0}},
+  {/*1*/{ 12,  0,  0,  4},{ 12, 89, 44, 24},{0,0,0,0}},  {/*1*/{ 12,  0,  0,  0},{ 12, 93, 48, 32},{1,0,0,0}},  {/*1*/{ 12,  0,  0,  4},{ 12,101, 52, 28},{2,0,0,0}},  {/*1*/{ 16,  0,  0,  0},{ 16,109, 56, 36},{1,0,0,0}},
+  {/*1*/{ 16,  0,  0,  0},{ 16,117, 60, 40},{0,0,0,0}},  {/*1*/{ 16,  0,  4,  4},{ 16,121, 52, 36},{1,0,0,0}},  {/*1*/{ 16,  0,  0,  0},{ 16,130, 65, 44},{2,0,0,0}},  {/*1*/{ 20,  0,  0,  4},{ 20,138, 69, 40},{1,0,0,0}},
+  {/*1*/{ 20,  0,  0,  0},{ 20,146, 73, 48},{0,0,0,0}},  {/*1*/{ 20,  0,  0,  0},{ 20,150, 77, 52},{1,0,0,0}},  {/*1*/{ 20,  0,  0,  4},{ 20,158, 81, 48},{2,0,0,0}},  {/*1*/{ 24,  0,  0,  0},{ 24,166, 85, 56},{1,0,0,0}},
+  {/*1*/{ 24,  0,  4,  4},{ 24,174, 77, 52},{0,0,0,0}},  {/*1*/{ 24,  0,  0,  0},{ 24,178, 89, 60},{1,0,0,0}},  {/*1*/{ 24,  0,  0,  8},{ 24,186, 93, 52},{2,0,0,0}},  {/*1*/{ 28,  0,  0,  0},{ 28,195, 97, 65},{1,0,0,0}},
+  {/*1*/{ 28,  0,  0,  8},{ 28,203,101, 56},{0,0,0,0}},  {/*1*/{ 28,  0,  0,  0},{ 28,207,105, 69},{1,0,0,0}},  {/*1*/{ 28,  0,  0,  0},{ 28,215,109, 73},{2,0,0,0}},  {/*1*/{ 32,  0,  0,  4},{ 32,223,113, 69},{1,0,0,0}},
+  {/*1*/{ 32,  0,  0,  0},{ 32,231,117, 77},{0,0,0,0}},  {/*1*/{ 32,  0,  4,  4},{ 32,235,109, 73},{1,0,0,0}},  {/*1*/{ 32,  0,  0,  0},{ 32,243,121, 81},{2,0,0,0}},  {/*1*/{ 36,  0,  0,  0},{ 36,251,125, 85},{1,0,0,0}},
+  {/*1*/{ 36,  4,  0,  4},{ 36,235,130, 81},{0,0,0,0}},  {/*1*/{ 36,  4,  0,  0},{ 36,239,134, 89},{1,0,0,0}},  {/*1*/{ 36,  4,  0,  4},{ 36,247,138, 85},{2,0,0,0}},  {/*1*/{ 40,  4,  0,  0},{ 40,255,142, 93},{1,0,0,0}},
+  {/*1*/{ 40,  8,  4,  0},{ 40,239,134, 97},{0,0,0,0}},  {/*1*/{ 40,  8,  0,  4},{ 40,243,146, 93},{1,0,0,0}},  {/*1*/{ 40,  8,  0,  0},{ 40,251,150,101},{2,0,0,0}},  {/*1*/{ 44, 12,  0,  4},{ 44,235,154, 97},{1,0,0,0}},
+  {/*1*/{ 44, 12,  0,  0},{ 44,243,158,105},{0,0,0,0}},  {/*1*/{ 44, 12,  0,  0},{ 44,247,162,109},{1,0,0,0}},  {/*1*/{ 44, 12,  0,  4},{ 44,255,166,105},{2,0,0,0}},  {/*1*/{ 48, 16,  0,  0},{ 48,239,170,113},{1,0,0,0}},
+  {/*1*/{ 48, 16,  0,  4},{ 48,247,174,109},{0,0,0,0}},  {/*1*/{ 48, 16,  4,  0},{ 48,251,166,117},{1,0,0,0}},  {/*1*/{ 48, 20,  0,  8},{ 48,235,178,109},{2,0,0,0}},  {/*1*/{ 52, 20,  0,  0},{ 52,243,182,121},{1,0,0,0}},
+  {/*1*/{ 52, 20,  0,  0},{ 52,251,186,125},{0,0,0,0}},  {/*1*/{ 52, 20,  0,  4},{ 52,255,190,121},{1,0,0,0}},  {/*1*/{ 52, 24,  0,  0},{ 52,239,195,130},{2,0,0,0}},  {/*1*/{ 56, 24,  0,  4},{ 56,247,199,125},{1,0,0,0}},
+  {/*1*/{ 56, 24,  4,  0},{ 56,255,190,134},{0,0,0,0}},  {/*1*/{ 56, 28,  0,  4},{ 56,235,203,130},{1,0,0,0}},  {/*1*/{ 56, 28,  0,  0},{ 56,243,207,138},{2,0,0,0}},  {/*1*/{ 60, 28,  0,  0},{ 60,251,211,142},{1,0,0,0}},
+  {/*1*/{ 60, 32,  0,  4},{ 60,235,215,138},{0,0,0,0}},  {/*1*/{ 60, 32,  0,  0},{ 60,239,219,146},{1,0,0,0}},  {/*1*/{ 60, 32,  0,  4},{ 60,247,223,142},{2,0,0,0}},  {/*1*/{ 65, 32,  0,  0},{ 65,255,227,150},{2,0,0,0}},
+  {/*1*/{ 65, 36,  0,  0},{ 65,239,231,154},{1,0,0,0}},  {/*1*/{ 65, 36,  4,  4},{ 65,243,223,150},{0,0,0,0}},  {/*1*/{ 65, 36,  0,  0},{ 65,251,235,158},{1,0,0,0}},  {/*1*/{ 65, 40,  0,  4},{ 65,235,239,154},{2,0,0,0}},
+  {/*1*/{ 69, 40,  0,  0},{ 69,243,243,162},{1,0,0,0}},  {/*1*/{ 69, 40,  0,  8},{ 69,247,247,154},{0,0,0,0}},  {/*1*/{ 69, 40,  0,  0},{ 69,255,251,166},{1,0,0,0}},  {/*1*/{ 69, 44,  0,  0},{ 69,239,255,170},{2,0,0,0}},
+  {/*1*/{ 73, 44,  4,  4},{ 73,247,247,166},{1,0,0,0}},  {/*1*/{ 73, 44,  4,  0},{ 73,251,251,174},{0,0,0,0}},  {/*1*/{ 73, 48,  4,  4},{ 73,235,255,170},{1,0,0,0}},  {/*1*/{ 73, 48,  8,  0},{ 73,243,247,178},{2,0,0,0}},
+  {/*1*/{ 77, 48,  8,  0},{ 77,251,251,182},{1,0,0,0}},  {/*1*/{ 77, 48,  8,  4},{ 77,255,255,178},{0,0,0,0}},  {/*1*/{ 77, 52, 12,  0},{ 77,239,247,186},{1,0,0,0}},  {/*1*/{ 77, 52, 12,  4},{ 77,247,251,182},{2,0,0,0}},
+  {/*1*/{ 81, 52, 12,  0},{ 81,255,255,190},{1,0,0,0}},  {/*1*/{ 81, 56, 20,  8},{ 81,235,239,182},{0,0,0,0}},  {/*1*/{ 81, 56, 16,  0},{ 81,243,251,195},{1,0,0,0}},  {/*1*/{ 81, 56, 16,  0},{ 81,251,255,199},{2,0,0,0}},
+  {/*1*/{ 85, 60, 20,  4},{ 85,231,251,195},{1,0,0,0}},  {/*1*/{ 85, 60, 24,  0},{ 85,239,243,203},{0,0,0,0}},  {/*1*/{ 85, 60, 20,  4},{ 85,247,255,199},{1,0,0,0}},  {/*1*/{ 85, 60, 24,  0},{ 85,255,251,207},{2,0,0,0}},
+  {/*1*/{ 89, 65, 24,  8},{ 89,231,255,199},{1,0,0,0}},  {/*1*/{ 89, 65, 28,  0},{ 89,239,247,211},{0,0,0,0}},  {/*1*/{ 89, 65, 28,  0},{ 89,243,251,215},{1,0,0,0}},  {/*1*/{ 89, 65, 28,  4},{ 89,251,255,211},{2,0,0,0}},
+  {/*1*/{ 93, 69, 32,  0},{ 93,235,247,219},{1,0,0,0}},  {/*1*/{ 93, 69, 32,  4},{ 93,243,251,215},{0,0,0,0}},  {/*1*/{ 93, 69, 32,  0},{ 93,247,255,223},{1,0,0,0}},  {/*1*/{ 93, 69, 36,  0},{ 93,255,247,227},{2,0,0,0}},
+  {/*1*/{ 97, 73, 36,  4},{ 97,239,251,223},{1,0,0,0}},  {/*1*/{ 97, 73, 36,  0},{ 97,247,255,231},{0,0,0,0}},  {/*1*/{ 97, 73, 40,  4},{ 97,251,247,227},{1,0,0,0}},  {/*1*/{ 97, 77, 40,  0},{ 97,235,251,235},{2,0,0,0}},
+  {/*1*/{101, 77, 40,  0},{101,243,255,239},{1,0,0,0}},  {/*1*/{101, 77, 44,  4},{101,251,247,235},{0,0,0,0}},  {/*1*/{101, 77, 44,  0},{101,255,251,243},{1,0,0,0}},  {/*1*/{101, 81, 44,  4},{101,239,255,239},{2,0,0,0}},
+  {/*1*/{105, 81, 52,  0},{105,247,239,247},{1,0,0,0}},  {/*1*/{105, 81, 48,  0},{105,255,251,251},{0,0,0,0}},  {/*1*/{105, 85, 48,  4},{105,235,255,247},{1,0,0,0}},  {/*1*/{105, 85, 52,  0},{105,243,251,255},{2,0,0,0}},
+  {/*1*/{109, 85, 56,  4},{109,251,243,251},{1,0,0,0}},  {/*1*/{109, 89, 52,  4},{109,235,255,255},{0,0,0,0}},  {/*1*/{109, 89, 56,  8},{109,239,251,251},{1,0,0,0}},  {/*1*/{109, 89, 56, 12},{109,247,255,247},{2,0,0,0}},
+  {/*1*/{113, 89, 60,  8},{113,255,247,255},{1,0,0,0}},  {/*1*/{113, 93, 60, 16},{113,239,251,247},{0,0,0,0}},  {/*1*/{113, 93, 60, 12},{113,243,255,255},{1,0,0,0}},  {/*1*/{113, 93, 65, 16},{113,251,243,251},{2,0,0,0}},
+  {/*1*/{117, 97, 65, 16},{117,235,247,255},{1,0,0,0}},  {/*1*/{117, 97, 65, 20},{117,243,251,251},{0,0,0,0}},  {/*1*/{117, 97, 65, 24},{117,247,255,247},{1,0,0,0}},  {/*1*/{117, 97, 69, 20},{117,255,247,255},{2,0,0,0}},
+  {/*1*/{121,101, 69, 28},{121,239,251,247},{1,0,0,0}},  {/*1*/{121,101, 69, 24},{121,247,255,255},{0,0,0,0}},  {/*1*/{121,101, 77, 28},{121,251,239,251},{1,0,0,0}},  {/*1*/{121,105, 73, 28},{121,235,251,255},{2,0,0,0}},
+  {/*1*/{125,105, 73, 32},{125,243,255,251},{1,0,0,0}},  {/*1*/{125,105, 77, 36},{125,251,251,247},{0,0,0,0}},  {/*1*/{125,105, 81, 32},{125,255,243,255},{1,0,0,0}},  {/*1*/{125,109, 77, 40},{125,239,255,247},{2,0,0,0}},
+  {/*1*/{130,109, 81, 36},{130,247,251,255},{2,0,0,0}},  {/*1*/{130,109, 81, 40},{130,255,255,251},{1,0,0,0}},  {/*1*/{130,113, 85, 40},{130,235,247,255},{0,0,0,0}},  {/*1*/{130,113, 85, 44},{130,243,251,251},{1,0,0,0}},
+  {/*1*/{130,113, 85, 52},{130,251,255,243},{2,0,0,0}},  {/*1*/{134,117, 89, 44},{134,231,247,255},{1,0,0,0}},  {/*1*/{134,117, 89, 52},{134,239,251,247},{0,0,0,0}},  {/*1*/{134,117, 89, 48},{134,247,255,255},{1,0,0,0}},
+  {/*1*/{134,117, 93, 56},{134,255,247,247},{2,0,0,0}},  {/*1*/{138,121, 93, 52},{138,235,251,255},{1,0,0,0}},  {/*1*/{138,121, 93, 56},{138,243,255,251},{0,0,0,0}},  {/*1*/{138,121, 97, 56},{138,251,247,255},{1,0,0,0}},
+  {/*1*/{138,125, 97, 60},{138,235,251,251},{2,0,0,0}},  {/*1*/{142,125, 97, 65},{142,239,255,247},{1,0,0,0}},  {/*1*/{142,125,101, 60},{142,247,247,255},{0,0,0,0}},  {/*1*/{142,125,101, 65},{142,255,251,251},{1,0,0,0}},
+  {/*1*/{142,130,101, 69},{142,231,255,247},{2,0,0,0}},  {/*1*/{146,130,109, 65},{146,239,239,255},{1,0,0,0}},  {/*1*/{146,130,105, 73},{146,247,251,247},{0,0,0,0}},  {/*1*/{146,130,105, 69},{146,251,255,255},{1,0,0,0}},
+  {/*1*/{146,134,109, 73},{146,235,251,251},{2,0,0,0}},  {/*1*/{150,134,113, 73},{150,243,243,255},{1,0,0,0}},  {/*1*/{150,134,109, 77},{150,251,255,251},{0,0,0,0}},  {/*1*/{150,134,113, 81},{150,255,251,247},{1,0,0,0}},
+  {/*1*/{150,138,113, 77},{150,239,255,255},{2,0,0,0}},  {/*1*/{154,138,117, 85},{154,247,247,247},{1,0,0,0}},  {/*1*/{154,138,117, 81},{154,255,251,255},{0,0,0,0}},  {/*1*/{154,142,117, 85},{154,235,255,251},{1,0,0,0}},
+  {/*1*/{154,142,121, 85},{154,243,247,255},{2,0,0,0}},  {/*1*/{158,142,121, 89},{158,251,251,251},{1,0,0,0}},  {/*1*/{158,146,121, 97},{158,235,255,243},{0,0,0,0}},  {/*1*/{158,146,125, 89},{158,239,247,255},{1,0,0,0}},
+  {/*1*/{158,146,125, 97},{158,247,251,247},{2,0,0,0}},  {/*1*/{162,146,125, 93},{162,255,255,255},{1,0,0,0}},  {/*1*/{162,150,130,101},{162,239,247,247},{0,0,0,0}},  {/*1*/{162,150,134, 97},{162,243,239,255},{1,0,0,0}},
+  {/*1*/{162,150,130,101},{162,251,251,251},{2,0,0,0}},  {/*1*/{166,154,130,101},{166,235,255,255},{1,0,0,0}},  {/*1*/{166,154,134,105},{166,243,251,251},{0,0,0,0}},  {/*1*/{166,154,138,109},{166,247,243,247},{1,0,0,0}},
+  {/*1*/{166,154,134,105},{166,255,255,255},{2,0,0,0}},  {/*1*/{170,158,138,113},{170,239,251,247},{1,0,0,0}},  {/*1*/{170,158,138,109},{170,247,255,255},{0,0,0,0}},  {/*1*/{170,158,142,113},{170,251,247,251},{1,0,0,0}},
+  {/*1*/{170,162,142,113},{170,235,251,255},{2,0,0,0}},  {/*1*/{174,162,142,117},{174,243,255,251},{1,0,0,0}},  {/*1*/{174,162,146,121},{174,251,247,247},{0,0,0,0}},  {/*1*/{174,162,146,117},{174,255,251,255},{1,0,0,0}},
+  {/*1*/{174,166,146,125},{174,239,255,247},{2,0,0,0}},  {/*1*/{178,166,150,121},{178,247,247,255},{1,0,0,0}},  {/*1*/{178,166,150,125},{178,255,251,251},{0,0,0,0}},  {/*1*/{178,170,150,125},{178,235,255,255},{1,0,0,0}},
+  {/*1*/{178,170,154,138},{178,243,247,239},{2,0,0,0}},  {/*1*/{182,170,154,130},{182,251,251,251},{1,0,0,0}},  {/*1*/{182,174,154,130},{182,231,255,255},{0,0,0,0}},  {/*1*/{182,174,158,134},{182,239,247,251},{1,0,0,0}},
+  {/*1*/{182,174,158,142},{182,247,251,243},{2,0,0,0}},  {/*1*/{186,174,158,134},{186,255,255,255},{1,0,0,0}},  {/*1*/{186,178,166,142},{186,235,239,247},{0,0,0,0}},  {/*1*/{186,178,162,138},{186,243,251,255},{1,0,0,0}},
+  {/*1*/{186,178,162,146},{186,251,255,247},{2,0,0,0}},  {/*1*/{190,182,166,142},{190,235,251,255},{1,0,0,0}},  {/*1*/{190,182,170,146},{190,239,243,251},{0,0,0,0}},  {/*1*/{190,182,166,146},{190,247,255,255},{1,0,0,0}},
+  {/*1*/{190,182,170,150},{190,255,251,251},{2,0,0,0}},  {/*1*/{195,186,170,154},{195,239,255,247},{2,0,0,0}},  {/*1*/{195,186,174,150},{195,243,247,255},{1,0,0,0}},  {/*1*/{195,186,174,158},{195,251,251,247},{0,0,0,0}},
+  {/*1*/{195,190,174,154},{195,235,255,255},{1,0,0,0}},  {/*1*/{195,190,178,158},{195,243,247,251},{2,0,0,0}},  {/*1*/{199,190,178,158},{199,247,251,255},{1,0,0,0}},  {/*1*/{199,190,178,162},{199,255,255,251},{0,0,0,0}},
+  {/*1*/{199,195,182,166},{199,231,247,247},{1,0,0,0}},  {/*1*/{199,195,182,162},{199,239,251,255},{2,0,0,0}},  {/*1*/{203,195,182,170},{203,247,255,247},{1,0,0,0}},  {/*1*/{203,195,186,166},{203,255,247,255},{0,0,0,0}},
+  {/*1*/{203,199,186,170},{203,235,251,251},{1,0,0,0}},  {/*1*/{203,199,186,170},{203,243,255,255},{2,0,0,0}},  {/*1*/{207,199,190,174},{207,251,247,251},{1,0,0,0}},  {/*1*/{207,203,190,178},{207,235,251,247},{0,0,0,0}},
+  {/*1*/{207,203,190,174},{207,239,255,255},{1,0,0,0}},  {/*1*/{207,203,195,182},{207,247,247,247},{2,0,0,0}},  {/*1*/{211,203,195,178},{211,255,251,255},{1,0,0,0}},  {/*1*/{211,207,195,182},{211,239,255,251},{0,0,0,0}},
+  {/*1*/{211,207,199,182},{211,243,247,255},{1,0,0,0}},  {/*1*/{211,207,199,186},{211,251,251,251},{2,0,0,0}},  {/*1*/{215,211,199,190},{215,235,255,247},{1,0,0,0}},  {/*1*/{215,211,203,186},{215,243,247,255},{0,0,0,0}},
+  {/*1*/{215,211,203,195},{215,247,251,247},{1,0,0,0}},  {/*1*/{215,211,203,190},{215,255,255,255},{2,0,0,0}},  {/*1*/{219,215,207,195},{219,239,247,251},{1,0,0,0}},  {/*1*/{219,215,207,199},{219,247,251,247},{0,0,0,0}},
+  {/*1*/{219,215,207,195},{219,251,255,255},{1,0,0,0}},  {/*1*/{219,219,211,203},{219,235,247,247},{2,0,0,0}},  {/*1*/{223,219,211,199},{223,243,251,255},{1,0,0,0}},  {/*1*/{223,219,211,203},{223,251,255,251},{0,0,0,0}},
+  {/*1*/{223,219,215,203},{223,255,247,255},{1,0,0,0}},  {/*1*/{223,223,215,207},{223,239,251,251},{2,0,0,0}},  {/*1*/{227,223,215,211},{227,247,255,247},{1,0,0,0}},  {/*1*/{227,223,223,207},{227,255,239,255},{0,0,0,0}},
+  {/*1*/{227,227,219,215},{227,235,251,247},{1,0,0,0}},  {/*1*/{227,227,219,211},{227,243,255,255},{2,0,0,0}},  {/*1*/{231,227,223,215},{231,251,251,251},{1,0,0,0}},  {/*1*/{231,231,227,215},{231,231,243,255},{0,0,0,0}},
+  {/*1*/{231,231,223,219},{231,239,255,251},{1,0,0,0}},  {/*1*/{231,231,227,223},{231,247,251,247},{2,0,0,0}},  {/*1*/{235,231,227,219},{235,255,255,255},{1,0,0,0}},  {/*1*/{235,235,231,227},{235,235,247,247},{0,0,0,0}},
+  {/*1*/{235,235,231,223},{235,243,251,255},{1,0,0,0}},  {/*1*/{235,235,231,227},{235,251,255,251},{2,0,0,0}},  {/*1*/{239,239,235,227},{239,235,247,255},{1,0,0,0}},  {/*1*/{239,239,235,231},{239,239,251,251},{0,0,0,0}},
+  {/*1*/{239,239,235,235},{239,247,255,247},{1,0,0,0}},  {/*1*/{239,239,239,231},{239,255,247,255},{2,0,0,0}},  {/*1*/{243,243,239,239},{243,239,251,247},{1,0,0,0}},  {/*1*/{243,243,239,235},{243,243,255,255},{0,0,0,0}},
+  {/*1*/{243,243,243,239},{243,251,247,251},{1,0,0,0}},  {/*1*/{243,247,243,239},{243,239,251,255},{2,0,0,0}},  {/*1*/{247,247,243,243},{247,243,255,251},{1,0,0,0}},  {/*1*/{247,247,247,247},{247,247,247,247},{0,0,0,0}},
+  {/*1*/{247,247,247,243},{247,255,251,255},{1,0,0,0}},  {/*1*/{247,251,247,251},{247,243,255,247},{2,0,0,0}},  {/*1*/{251,251,255,247},{251,247,239,255},{1,0,0,0}},  {/*1*/{251,251,251,251},{251,251,251,251},{0,0,0,0}},
+  {/*1*/{251,255,251,251},{251,239,255,255},{1,0,0,0}},  {/*1*/{251,255,255,255},{251,247,251,251},{2,0,0,0}},  {/*1*/{255,255,255,255},{255,251,255,255},{1,0,1,1}},  {/*1*/{255,255,255,255},{255,255,255,255},{0,0,0,0}}
 };
 
 /* 256 * 4 * 3 * 1 = 3072 */
 static PaletteSingleLookup4 const sp_lookup_7_8[256] =
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  0,  0,1},{  0,  8,0},{  0,  4,0},{  0,  4,0}}},  {{/*1*/{  2,  2,0},{  0, 16,0},{  0,  8,0},{  0,  6,0}}},  {{/*1*/{  2,  2,1},{  0, 22,0},{  0, 12,0},{  0,  8,0}}},
-  {{/*1*/{  4,  4,0},{  0, 30,0},{  0, 16,0},{  0, 10,0}}},  {{/*1*/{  4,  4,1},{  0, 36,0},{  0, 18,0},{  0, 12,0}}},  {{/*1*/{  6,  6,0},{  0, 44,0},{  0, 22,0},{  0, 16,0}}},  {{/*1*/{  6,  6,1},{  0, 50,0},{  0, 26,0},{  0, 18,0}}},
-  {{/*1*/{  8,  8,0},{  0, 58,0},{  0, 30,0},{  0, 20,0}}},  {{/*1*/{  8,  8,1},{  0, 64,0},{  0, 32,0},{  0, 22,0}}},  {{/*1*/{ 10, 10,0},{  0, 72,0},{  0, 36,0},{  0, 24,0}}},  {{/*1*/{ 10, 10,1},{  0, 80,0},{  0, 40,0},{  0, 28,0}}},
-  {{/*1*/{ 12, 12,0},{  0, 86,0},{  0, 44,0},{  0, 30,0}}},  {{/*1*/{ 12, 12,1},{  0, 94,0},{  0, 48,0},{  0, 32,0}}},  {{/*1*/{ 14, 14,0},{  0,100,0},{  0, 50,0},{  0, 34,0}}},  {{/*1*/{ 14, 14,1},{  0,108,0},{  0, 54,0},{  0, 36,0}}},
-  {{/*1*/{ 16, 16,0},{  0,114,0},{  0, 58,0},{  0, 38,0}}},  {{/*1*/{ 16, 16,1},{  0,122,0},{  0, 62,0},{  0, 42,0}}},  {{/*1*/{ 18, 18,0},{  0,129,0},{  0, 64,0},{  0, 44,0}}},  {{/*1*/{ 18, 18,1},{  0,137,0},{  0, 68,0},{  0, 46,0}}},
-  {{/*1*/{ 20, 20,0},{  0,143,0},{  0, 72,0},{  0, 48,0}}},  {{/*1*/{ 20, 20,1},{  0,151,0},{  0, 76,0},{  0, 50,0}}},  {{/*1*/{ 22, 22,0},{  0,157,0},{  0, 80,0},{  0, 54,0}}},  {{/*1*/{ 22, 22,1},{  0,165,0},{  0, 82,0},{  0, 56,0}}},
-  {{/*1*/{ 24, 24,0},{  0,171,0},{  0, 86,0},{  0, 58,0}}},  {{/*1*/{ 24, 24,1},{  0,179,0},{  0, 90,0},{  0, 60,0}}},  {{/*1*/{ 26, 26,0},{  0,185,0},{  0, 94,0},{  0, 62,0}}},  {{/*1*/{ 26, 26,1},{  0,193,0},{  0, 96,0},{  0, 64,0}}},
-  {{/*1*/{ 28, 28,0},{  0,201,0},{  0,100,0},{  0, 68,0}}},  {{/*1*/{ 28, 28,1},{  0,207,0},{  0,104,0},{  0, 70,0}}},  {{/*1*/{ 30, 30,0},{  0,215,0},{  0,108,0},{  0, 72,0}}},  {{/*1*/{ 30, 30,1},{  0,221,0},{  0,112,0},{  0, 74,0}}},
-  {{/*1*/{ 32, 32,0},{  0,229,0},{  0,114,0},{  0, 76,0}}},  {{/*1*/{ 32, 32,1},{  0,235,0},{  0,118,0},{  0, 80,0}}},  {{/*1*/{ 34, 34,0},{  0,243,0},{  0,122,0},{  0, 82,0}}},  {{/*1*/{ 34, 34,1},{  0,249,0},{  0,126,0},{  0, 84,0}}},
-  {{/*1*/{ 36, 36,0},{  2,245,0},{  0,129,0},{  0, 86,0}}},  {{/*1*/{ 36, 36,1},{  2,251,0},{  0,133,0},{  0, 88,0}}},  {{/*1*/{ 38, 38,0},{  4,247,0},{  0,137,0},{  0, 92,0}}},  {{/*1*/{ 38, 38,1},{  4,253,0},{  0,139,0},{  0, 94,0}}},
-  {{/*1*/{ 40, 40,0},{  6,249,0},{  0,143,0},{  0, 96,0}}},  {{/*1*/{ 40, 40,1},{  6,255,0},{  0,147,0},{  0, 98,0}}},  {{/*1*/{ 42, 42,0},{  8,251,0},{  0,151,0},{  0,100,0}}},  {{/*1*/{ 42, 42,1},{ 10,245,0},{  0,153,0},{  0,102,0}}},
-  {{/*1*/{ 44, 44,0},{ 10,253,0},{  0,157,0},{  0,106,0}}},  {{/*1*/{ 44, 44,1},{ 12,247,0},{  0,161,0},{  0,108,0}}},  {{/*1*/{ 46, 46,0},{ 12,255,0},{  0,165,0},{  0,110,0}}},  {{/*1*/{ 46, 46,1},{ 14,249,0},{  0,169,0},{  0,112,0}}},
-  {{/*1*/{ 48, 48,0},{ 16,245,0},{  0,171,0},{  0,114,0}}},  {{/*1*/{ 48, 48,1},{ 16,251,0},{  0,175,0},{  0,118,0}}},  {{/*1*/{ 50, 50,0},{ 18,247,0},{  0,179,0},{  0,120,0}}},  {{/*1*/{ 50, 50,1},{ 18,253,0},{  0,183,0},{  0,122,0}}},
-  {{/*1*/{ 52, 52,0},{ 20,249,0},{  0,185,0},{  0,124,0}}},  {{/*1*/{ 52, 52,1},{ 20,255,0},{  0,189,0},{  0,126,0}}},  {{/*1*/{ 54, 54,0},{ 22,251,0},{  0,193,0},{  0,129,0}}},  {{/*1*/{ 54, 54,1},{ 24,245,0},{  0,197,0},{  0,131,0}}},
-  {{/*1*/{ 56, 56,0},{ 24,253,0},{  0,201,0},{  0,133,0}}},  {{/*1*/{ 56, 56,1},{ 26,247,0},{  0,203,0},{  0,137,0}}},  {{/*1*/{ 58, 58,0},{ 26,255,0},{  0,207,0},{  0,139,0}}},  {{/*1*/{ 58, 58,1},{ 28,249,0},{  0,211,0},{  0,141,0}}},
-  {{/*1*/{ 60, 60,0},{ 30,245,0},{  0,215,0},{  0,143,0}}},  {{/*1*/{ 60, 60,1},{ 30,251,0},{  0,217,0},{  0,145,0}}},  {{/*1*/{ 62, 62,0},{ 32,247,0},{  0,221,0},{  0,147,0}}},  {{/*1*/{ 62, 62,1},{ 32,253,0},{  0,225,0},{  0,151,0}}},
-  {{/*1*/{ 64, 64,0},{ 34,249,0},{  0,229,0},{  0,153,0}}},  {{/*1*/{ 64, 64,1},{ 34,255,0},{  0,233,0},{  0,155,0}}},  {{/*1*/{ 66, 66,0},{ 36,251,0},{  0,235,0},{  0,157,0}}},  {{/*1*/{ 66, 66,1},{ 38,245,0},{  0,239,0},{  0,159,0}}},
-  {{/*1*/{ 68, 68,0},{ 38,253,0},{  0,243,0},{  0,163,0}}},  {{/*1*/{ 68, 68,1},{ 40,247,0},{  0,247,0},{  0,165,0}}},  {{/*1*/{ 70, 70,0},{ 40,255,0},{  0,249,0},{  0,167,0}}},  {{/*1*/{ 70, 70,1},{ 42,249,0},{  0,253,0},{  0,169,0}}},
-  {{/*1*/{ 72, 72,0},{ 44,245,0},{  2,251,0},{  0,171,0}}},  {{/*1*/{ 72, 72,1},{ 44,251,0},{  2,255,0},{  0,175,0}}},  {{/*1*/{ 74, 74,0},{ 46,247,0},{  4,253,0},{  0,177,0}}},  {{/*1*/{ 74, 74,1},{ 46,253,0},{  6,253,0},{  0,179,0}}},
-  {{/*1*/{ 76, 76,0},{ 48,249,0},{  6,255,0},{  0,181,0}}},  {{/*1*/{ 76, 76,1},{ 48,255,0},{  8,255,0},{  0,183,0}}},  {{/*1*/{ 78, 78,0},{ 50,251,0},{ 10,253,0},{  0,185,0}}},  {{/*1*/{ 78, 78,1},{ 52,245,0},{ 12,251,0},{  0,189,0}}},
-  {{/*1*/{ 80, 80,0},{ 52,253,0},{ 12,255,0},{  0,191,0}}},  {{/*1*/{ 80, 80,1},{ 54,247,0},{ 14,253,0},{  0,193,0}}},  {{/*1*/{ 82, 82,0},{ 54,255,0},{ 16,251,0},{  0,195,0}}},  {{/*1*/{ 82, 82,1},{ 56,249,0},{ 16,255,0},{  0,197,0}}},
-  {{/*1*/{ 84, 84,0},{ 58,243,0},{ 18,253,0},{  0,201,0}}},  {{/*1*/{ 84, 84,1},{ 58,251,0},{ 20,253,0},{  0,203,0}}},  {{/*1*/{ 86, 86,0},{ 60,245,0},{ 20,255,0},{  0,205,0}}},  {{/*1*/{ 86, 86,1},{ 60,253,0},{ 22,255,0},{  0,207,0}}},
-  {{/*1*/{ 88, 88,0},{ 62,247,0},{ 24,253,0},{  0,209,0}}},  {{/*1*/{ 88, 88,1},{ 62,255,0},{ 26,251,0},{  0,211,0}}},  {{/*1*/{ 90, 90,0},{ 64,249,0},{ 26,255,0},{  0,215,0}}},  {{/*1*/{ 90, 90,1},{ 66,245,0},{ 28,253,0},{  0,217,0}}},
-  {{/*1*/{ 92, 92,0},{ 66,251,0},{ 30,251,0},{  0,219,0}}},  {{/*1*/{ 92, 92,1},{ 68,247,0},{ 30,255,0},{  0,221,0}}},  {{/*1*/{ 94, 94,0},{ 68,253,0},{ 32,253,0},{  0,223,0}}},  {{/*1*/{ 94, 94,1},{ 70,249,0},{ 34,251,0},{  0,227,0}}},
-  {{/*1*/{ 96, 96,0},{ 70,255,0},{ 34,255,0},{  0,229,0}}},  {{/*1*/{ 96, 96,1},{ 72,251,0},{ 36,253,0},{  0,231,0}}},  {{/*1*/{ 98, 98,0},{ 74,245,0},{ 38,253,0},{  0,233,0}}},  {{/*1*/{ 98, 98,1},{ 74,253,0},{ 38,255,0},{  0,235,0}}},
-  {{/*1*/{100,100,0},{ 76,247,0},{ 40,255,0},{  0,239,0}}},  {{/*1*/{100,100,1},{ 76,255,0},{ 42,253,0},{  0,241,0}}},  {{/*1*/{102,102,0},{ 78,249,0},{ 44,251,0},{  0,243,0}}},  {{/*1*/{102,102,1},{ 80,245,0},{ 44,255,0},{  0,245,0}}},
-  {{/*1*/{104,104,0},{ 80,251,0},{ 46,253,0},{  0,247,0}}},  {{/*1*/{104,104,1},{ 82,247,0},{ 48,251,0},{  0,249,0}}},  {{/*1*/{106,106,0},{ 82,253,0},{ 48,255,0},{  0,253,0}}},  {{/*1*/{106,106,1},{ 84,249,0},{ 50,253,0},{  0,255,0}}},
-  {{/*1*/{108,108,0},{ 84,255,0},{ 52,253,0},{  2,255,0}}},  {{/*1*/{108,108,1},{ 86,251,0},{ 52,255,0},{  4,253,0}}},  {{/*1*/{110,110,0},{ 88,245,0},{ 54,255,0},{  6,253,0}}},  {{/*1*/{110,110,1},{ 88,253,0},{ 56,253,0},{  6,255,0}}},
-  {{/*1*/{112,112,0},{ 90,247,0},{ 58,251,0},{  8,255,0}}},  {{/*1*/{112,112,1},{ 90,255,0},{ 58,255,0},{ 10,255,0}}},  {{/*1*/{114,114,0},{ 92,249,0},{ 60,253,0},{ 12,255,0}}},  {{/*1*/{114,114,1},{ 94,245,0},{ 62,251,0},{ 14,255,0}}},
-  {{/*1*/{116,116,0},{ 94,251,0},{ 62,255,0},{ 16,255,0}}},  {{/*1*/{116,116,1},{ 96,247,0},{ 64,253,0},{ 18,253,0}}},  {{/*1*/{118,118,0},{ 96,253,0},{ 66,251,0},{ 20,253,0}}},  {{/*1*/{118,118,1},{ 98,249,0},{ 66,255,0},{ 20,255,0}}},
-  {{/*1*/{120,120,0},{ 98,255,0},{ 68,253,0},{ 22,255,0}}},  {{/*1*/{120,120,1},{100,251,0},{ 70,253,0},{ 24,255,0}}},  {{/*1*/{122,122,0},{102,245,0},{ 70,255,0},{ 26,255,0}}},  {{/*1*/{122,122,1},{102,253,0},{ 72,255,0},{ 28,255,0}}},
-  {{/*1*/{124,124,0},{104,247,0},{ 74,253,0},{ 30,253,0}}},  {{/*1*/{124,124,1},{104,255,0},{ 76,251,0},{ 32,253,0}}},  {{/*1*/{126,126,0},{106,249,0},{ 76,255,0},{ 32,255,0}}},  {{/*1*/{126,126,1},{108,245,0},{ 78,253,0},{ 34,255,0}}},
-  {{/*1*/{129,129,1},{108,251,0},{ 80,251,0},{ 36,255,0}}},  {{/*1*/{129,129,0},{110,247,0},{ 80,255,0},{ 38,255,0}}},  {{/*1*/{129,129,1},{110,253,0},{ 82,253,0},{ 40,255,0}}},  {{/*1*/{131,131,0},{112,249,0},{ 84,253,0},{ 42,253,0}}},
-  {{/*1*/{131,131,1},{112,255,0},{ 84,255,0},{ 44,253,0}}},  {{/*1*/{133,133,0},{114,251,0},{ 86,255,0},{ 44,255,0}}},  {{/*1*/{133,133,1},{116,245,0},{ 88,253,0},{ 46,255,0}}},  {{/*1*/{135,135,0},{116,253,0},{ 90,251,0},{ 48,255,0}}},
-  {{/*1*/{135,135,1},{118,247,0},{ 90,255,0},{ 50,255,0}}},  {{/*1*/{137,137,0},{118,255,0},{ 92,253,0},{ 52,255,0}}},  {{/*1*/{137,137,1},{120,249,0},{ 94,251,0},{ 54,255,0}}},  {{/*1*/{139,139,0},{122,243,0},{ 94,255,0},{ 56,253,0}}},
-  {{/*1*/{139,139,1},{122,251,0},{ 96,253,0},{ 58,253,0}}},  {{/*1*/{141,141,0},{124,245,0},{ 98,251,0},{ 58,255,0}}},  {{/*1*/{141,141,1},{124,253,0},{ 98,255,0},{ 60,255,0}}},  {{/*1*/{143,143,0},{126,247,0},{100,253,0},{ 62,255,0}}},
-  {{/*1*/{143,143,1},{126,255,0},{102,253,0},{ 64,255,0}}},  {{/*1*/{145,145,0},{129,243,0},{102,255,0},{ 66,255,0}}},  {{/*1*/{145,145,1},{129,251,0},{104,255,0},{ 68,253,0}}},  {{/*1*/{147,147,0},{131,245,0},{106,253,0},{ 70,253,0}}},
-  {{/*1*/{147,147,1},{131,253,0},{108,251,0},{ 70,255,0}}},  {{/*1*/{149,149,0},{133,247,0},{108,255,0},{ 72,255,0}}},  {{/*1*/{149,149,1},{133,255,0},{110,253,0},{ 74,255,0}}},  {{/*1*/{151,151,0},{135,249,0},{112,251,0},{ 76,255,0}}},
-  {{/*1*/{151,151,1},{137,245,0},{112,255,0},{ 78,255,0}}},  {{/*1*/{153,153,0},{137,251,0},{114,253,0},{ 80,255,0}}},  {{/*1*/{153,153,1},{139,247,0},{116,253,0},{ 82,253,0}}},  {{/*1*/{155,155,0},{139,253,0},{116,255,0},{ 84,253,0}}},
-  {{/*1*/{155,155,1},{141,249,0},{118,255,0},{ 84,255,0}}},  {{/*1*/{157,157,0},{141,255,0},{120,253,0},{ 86,255,0}}},  {{/*1*/{157,157,1},{143,251,0},{122,251,0},{ 88,255,0}}},  {{/*1*/{159,159,0},{145,245,0},{122,255,0},{ 90,255,0}}},
-  {{/*1*/{159,159,1},{145,253,0},{124,253,0},{ 92,255,0}}},  {{/*1*/{161,161,0},{147,247,0},{126,251,0},{ 94,253,0}}},  {{/*1*/{161,161,1},{147,255,0},{126,255,0},{ 96,253,0}}},  {{/*1*/{163,163,0},{149,249,0},{129,251,0},{ 96,255,0}}},
-  {{/*1*/{163,163,1},{151,245,0},{129,255,0},{ 98,255,0}}},  {{/*1*/{165,165,0},{151,251,0},{131,253,0},{100,255,0}}},  {{/*1*/{165,165,1},{153,247,0},{133,251,0},{102,255,0}}},  {{/*1*/{167,167,0},{153,253,0},{133,255,0},{104,255,0}}},
-  {{/*1*/{167,167,1},{155,249,0},{135,253,0},{106,253,0}}},  {{/*1*/{169,169,0},{155,255,0},{137,251,0},{108,253,0}}},  {{/*1*/{169,169,1},{157,251,0},{137,255,0},{108,255,0}}},  {{/*1*/{171,171,0},{159,245,0},{139,253,0},{110,255,0}}},
-  {{/*1*/{171,171,1},{159,253,0},{141,253,0},{112,255,0}}},  {{/*1*/{173,173,0},{161,247,0},{141,255,0},{114,255,0}}},  {{/*1*/{173,173,1},{161,255,0},{143,255,0},{116,255,0}}},  {{/*1*/{175,175,0},{163,249,0},{145,253,0},{118,255,0}}},
-  {{/*1*/{175,175,1},{165,245,0},{147,251,0},{120,253,0}}},  {{/*1*/{177,177,0},{165,251,0},{147,255,0},{122,253,0}}},  {{/*1*/{177,177,1},{167,247,0},{149,253,0},{122,255,0}}},  {{/*1*/{179,179,0},{167,253,0},{151,251,0},{124,255,0}}},
-  {{/*1*/{179,179,1},{169,249,0},{151,255,0},{126,255,0}}},  {{/*1*/{181,181,0},{169,255,0},{153,253,0},{129,253,0}}},  {{/*1*/{181,181,1},{171,251,0},{155,251,0},{129,255,0}}},  {{/*1*/{183,183,0},{173,245,0},{155,255,0},{131,255,0}}},
-  {{/*1*/{183,183,1},{173,253,0},{157,253,0},{133,255,0}}},  {{/*1*/{185,185,0},{175,247,0},{159,253,0},{135,255,0}}},  {{/*1*/{185,185,1},{175,255,0},{159,255,0},{137,255,0}}},  {{/*1*/{187,187,0},{177,249,0},{161,255,0},{139,253,0}}},
-  {{/*1*/{187,187,1},{179,243,0},{163,253,0},{141,253,0}}},  {{/*1*/{189,189,0},{179,251,0},{165,251,0},{141,255,0}}},  {{/*1*/{189,189,1},{181,245,0},{165,255,0},{143,255,0}}},  {{/*1*/{191,191,0},{181,253,0},{167,253,0},{145,255,0}}},
-  {{/*1*/{191,191,1},{183,247,0},{169,251,0},{147,255,0}}},  {{/*1*/{193,193,0},{183,255,0},{169,255,0},{149,255,0}}},  {{/*1*/{193,193,1},{185,249,0},{171,253,0},{151,253,0}}},  {{/*1*/{195,195,0},{187,245,0},{173,253,0},{153,253,0}}},
-  {{/*1*/{195,195,1},{187,251,0},{173,255,0},{153,255,0}}},  {{/*1*/{197,197,0},{189,247,0},{175,255,0},{155,255,0}}},  {{/*1*/{197,197,1},{189,253,0},{177,253,0},{157,255,0}}},  {{/*1*/{199,199,0},{191,249,0},{179,251,0},{159,255,0}}},
-  {{/*1*/{199,199,1},{191,255,0},{179,255,0},{161,255,0}}},  {{/*1*/{201,201,0},{193,251,0},{181,253,0},{163,255,0}}},  {{/*1*/{201,201,1},{195,245,0},{183,251,0},{165,253,0}}},  {{/*1*/{203,203,0},{195,253,0},{183,255,0},{167,253,0}}},
-  {{/*1*/{203,203,1},{197,247,0},{185,253,0},{167,255,0}}},  {{/*1*/{205,205,0},{197,255,0},{187,251,0},{169,255,0}}},  {{/*1*/{205,205,1},{199,249,0},{187,255,0},{171,255,0}}},  {{/*1*/{207,207,0},{201,245,0},{189,253,0},{173,255,0}}},
-  {{/*1*/{207,207,1},{201,251,0},{191,253,0},{175,255,0}}},  {{/*1*/{209,209,0},{203,247,0},{191,255,0},{177,253,0}}},  {{/*1*/{209,209,1},{203,253,0},{193,255,0},{179,253,0}}},  {{/*1*/{211,211,0},{205,249,0},{195,253,0},{179,255,0}}},
-  {{/*1*/{211,211,1},{205,255,0},{197,251,0},{181,255,0}}},  {{/*1*/{213,213,0},{207,251,0},{197,255,0},{183,255,0}}},  {{/*1*/{213,213,1},{209,245,0},{199,253,0},{185,255,0}}},  {{/*1*/{215,215,0},{209,253,0},{201,251,0},{187,255,0}}},
-  {{/*1*/{215,215,1},{211,247,0},{201,255,0},{189,253,0}}},  {{/*1*/{217,217,0},{211,255,0},{203,253,0},{191,253,0}}},  {{/*1*/{217,217,1},{213,249,0},{205,253,0},{191,255,0}}},  {{/*1*/{219,219,0},{215,245,0},{205,255,0},{193,255,0}}},
-  {{/*1*/{219,219,1},{215,251,0},{207,255,0},{195,255,0}}},  {{/*1*/{221,221,0},{217,247,0},{209,253,0},{197,255,0}}},  {{/*1*/{221,221,1},{217,253,0},{211,251,0},{199,255,0}}},  {{/*1*/{223,223,0},{219,249,0},{211,255,0},{201,255,0}}},
-  {{/*1*/{223,223,1},{219,255,0},{213,253,0},{203,253,0}}},  {{/*1*/{225,225,0},{221,251,0},{215,251,0},{205,253,0}}},  {{/*1*/{225,225,1},{223,245,0},{215,255,0},{205,255,0}}},  {{/*1*/{227,227,0},{223,253,0},{217,253,0},{207,255,0}}},
-  {{/*1*/{227,227,1},{225,247,0},{219,251,0},{209,255,0}}},  {{/*1*/{229,229,0},{225,255,0},{219,255,0},{211,255,0}}},  {{/*1*/{229,229,1},{227,249,0},{221,253,0},{213,255,0}}},  {{/*1*/{231,231,0},{229,245,0},{223,253,0},{215,253,0}}},
-  {{/*1*/{231,231,1},{229,251,0},{223,255,0},{217,253,0}}},  {{/*1*/{233,233,0},{231,247,0},{225,255,0},{217,255,0}}},  {{/*1*/{233,233,1},{231,253,0},{227,253,0},{219,255,0}}},  {{/*1*/{235,235,0},{233,249,0},{229,251,0},{221,255,0}}},
-  {{/*1*/{235,235,1},{233,255,0},{229,255,0},{223,255,0}}},  {{/*1*/{237,237,0},{235,251,0},{231,253,0},{225,255,0}}},  {{/*1*/{237,237,1},{237,245,0},{233,251,0},{227,255,0}}},  {{/*1*/{239,239,0},{237,253,0},{233,255,0},{229,253,0}}},
-  {{/*1*/{239,239,1},{239,247,0},{235,253,0},{231,253,0}}},  {{/*1*/{241,241,0},{239,255,0},{237,253,0},{231,255,0}}},  {{/*1*/{241,241,1},{241,249,0},{237,255,0},{233,255,0}}},  {{/*1*/{243,243,0},{243,243,0},{239,255,0},{235,255,0}}},
-  {{/*1*/{243,243,1},{243,251,0},{241,253,0},{237,255,0}}},  {{/*1*/{245,245,0},{245,245,0},{243,251,0},{239,255,0}}},  {{/*1*/{245,245,1},{245,253,0},{243,255,0},{241,253,0}}},  {{/*1*/{247,247,0},{247,247,0},{245,253,0},{243,253,0}}},
-  {{/*1*/{247,247,1},{247,255,0},{247,251,0},{243,255,0}}},  {{/*1*/{249,249,0},{249,249,0},{247,255,0},{245,255,0}}},  {{/*1*/{249,249,1},{251,249,0},{249,253,0},{247,255,0}}},  {{/*1*/{251,251,0},{251,251,0},{251,251,0},{249,255,0}}},
-  {{/*1*/{251,251,1},{253,251,0},{251,255,0},{251,255,0}}},  {{/*1*/{253,253,0},{253,253,0},{253,253,0},{253,253,0}}},  {{/*1*/{253,253,1},{255,253,0},{255,253,0},{255,253,0}}},  {{/*1*/{255,255,0},{255,255,0},{255,255,0},{255,255,0}}}
+  {/*1*/{  0,  0,  0,  0},{  0,  0,  0,  0},{0,0,0,0}},  {/*1*/{  0,  0,  0,  0},{  0,  8,  4,  4},{1,0,0,0}},  {/*1*/{  2,  0,  0,  0},{  2, 16,  8,  6},{0,0,0,0}},  {/*1*/{  2,  0,  0,  0},{  2, 22, 12,  8},{1,0,0,0}},
+  {/*1*/{  4,  0,  0,  0},{  4, 30, 16, 10},{0,0,0,0}},  {/*1*/{  4,  0,  0,  0},{  4, 36, 18, 12},{1,0,0,0}},  {/*1*/{  6,  0,  0,  0},{  6, 44, 22, 16},{0,0,0,0}},  {/*1*/{  6,  0,  0,  0},{  6, 50, 26, 18},{1,0,0,0}},
+  {/*1*/{  8,  0,  0,  0},{  8, 58, 30, 20},{0,0,0,0}},  {/*1*/{  8,  0,  0,  0},{  8, 64, 32, 22},{1,0,0,0}},  {/*1*/{ 10,  0,  0,  0},{ 10, 72, 36, 24},{0,0,0,0}},  {/*1*/{ 10,  0,  0,  0},{ 10, 80, 40, 28},{1,0,0,0}},
+  {/*1*/{ 12,  0,  0,  0},{ 12, 86, 44, 30},{0,0,0,0}},  {/*1*/{ 12,  0,  0,  0},{ 12, 94, 48, 32},{1,0,0,0}},  {/*1*/{ 14,  0,  0,  0},{ 14,100, 50, 34},{0,0,0,0}},  {/*1*/{ 14,  0,  0,  0},{ 14,108, 54, 36},{1,0,0,0}},
+  {/*1*/{ 16,  0,  0,  0},{ 16,114, 58, 38},{0,0,0,0}},  {/*1*/{ 16,  0,  0,  0},{ 16,122, 62, 42},{1,0,0,0}},  {/*1*/{ 18,  0,  0,  0},{ 18,129, 64, 44},{0,0,0,0}},  {/*1*/{ 18,  0,  0,  0},{ 18,137, 68, 46},{1,0,0,0}},
+  {/*1*/{ 20,  0,  0,  0},{ 20,143, 72, 48},{0,0,0,0}},  {/*1*/{ 20,  0,  0,  0},{ 20,151, 76, 50},{1,0,0,0}},  {/*1*/{ 22,  0,  0,  0},{ 22,157, 80, 54},{0,0,0,0}},  {/*1*/{ 22,  0,  0,  0},{ 22,165, 82, 56},{1,0,0,0}},
+  {/*1*/{ 24,  0,  0,  0},{ 24,171, 86, 58},{0,0,0,0}},  {/*1*/{ 24,  0,  0,  0},{ 24,179, 90, 60},{1,0,0,0}},  {/*1*/{ 26,  0,  0,  0},{ 26,185, 94, 62},{0,0,0,0}},  {/*1*/{ 26,  0,  0,  0},{ 26,193, 96, 64},{1,0,0,0}},
+  {/*1*/{ 28,  0,  0,  0},{ 28,201,100, 68},{0,0,0,0}},  {/*1*/{ 28,  0,  0,  0},{ 28,207,104, 70},{1,0,0,0}},  {/*1*/{ 30,  0,  0,  0},{ 30,215,108, 72},{0,0,0,0}},  {/*1*/{ 30,  0,  0,  0},{ 30,221,112, 74},{1,0,0,0}},
+  {/*1*/{ 32,  0,  0,  0},{ 32,229,114, 76},{0,0,0,0}},  {/*1*/{ 32,  0,  0,  0},{ 32,235,118, 80},{1,0,0,0}},  {/*1*/{ 34,  0,  0,  0},{ 34,243,122, 82},{0,0,0,0}},  {/*1*/{ 34,  0,  0,  0},{ 34,249,126, 84},{1,0,0,0}},
+  {/*1*/{ 36,  2,  0,  0},{ 36,245,129, 86},{0,0,0,0}},  {/*1*/{ 36,  2,  0,  0},{ 36,251,133, 88},{1,0,0,0}},  {/*1*/{ 38,  4,  0,  0},{ 38,247,137, 92},{0,0,0,0}},  {/*1*/{ 38,  4,  0,  0},{ 38,253,139, 94},{1,0,0,0}},
+  {/*1*/{ 40,  6,  0,  0},{ 40,249,143, 96},{0,0,0,0}},  {/*1*/{ 40,  6,  0,  0},{ 40,255,147, 98},{1,0,0,0}},  {/*1*/{ 42,  8,  0,  0},{ 42,251,151,100},{0,0,0,0}},  {/*1*/{ 42, 10,  0,  0},{ 42,245,153,102},{1,0,0,0}},
+  {/*1*/{ 44, 10,  0,  0},{ 44,253,157,106},{0,0,0,0}},  {/*1*/{ 44, 12,  0,  0},{ 44,247,161,108},{1,0,0,0}},  {/*1*/{ 46, 12,  0,  0},{ 46,255,165,110},{0,0,0,0}},  {/*1*/{ 46, 14,  0,  0},{ 46,249,169,112},{1,0,0,0}},
+  {/*1*/{ 48, 16,  0,  0},{ 48,245,171,114},{0,0,0,0}},  {/*1*/{ 48, 16,  0,  0},{ 48,251,175,118},{1,0,0,0}},  {/*1*/{ 50, 18,  0,  0},{ 50,247,179,120},{0,0,0,0}},  {/*1*/{ 50, 18,  0,  0},{ 50,253,183,122},{1,0,0,0}},
+  {/*1*/{ 52, 20,  0,  0},{ 52,249,185,124},{0,0,0,0}},  {/*1*/{ 52, 20,  0,  0},{ 52,255,189,126},{1,0,0,0}},  {/*1*/{ 54, 22,  0,  0},{ 54,251,193,129},{0,0,0,0}},  {/*1*/{ 54, 24,  0,  0},{ 54,245,197,131},{1,0,0,0}},
+  {/*1*/{ 56, 24,  0,  0},{ 56,253,201,133},{0,0,0,0}},  {/*1*/{ 56, 26,  0,  0},{ 56,247,203,137},{1,0,0,0}},  {/*1*/{ 58, 26,  0,  0},{ 58,255,207,139},{0,0,0,0}},  {/*1*/{ 58, 28,  0,  0},{ 58,249,211,141},{1,0,0,0}},
+  {/*1*/{ 60, 30,  0,  0},{ 60,245,215,143},{0,0,0,0}},  {/*1*/{ 60, 30,  0,  0},{ 60,251,217,145},{1,0,0,0}},  {/*1*/{ 62, 32,  0,  0},{ 62,247,221,147},{0,0,0,0}},  {/*1*/{ 62, 32,  0,  0},{ 62,253,225,151},{1,0,0,0}},
+  {/*1*/{ 64, 34,  0,  0},{ 64,249,229,153},{0,0,0,0}},  {/*1*/{ 64, 34,  0,  0},{ 64,255,233,155},{1,0,0,0}},  {/*1*/{ 66, 36,  0,  0},{ 66,251,235,157},{0,0,0,0}},  {/*1*/{ 66, 38,  0,  0},{ 66,245,239,159},{1,0,0,0}},
+  {/*1*/{ 68, 38,  0,  0},{ 68,253,243,163},{0,0,0,0}},  {/*1*/{ 68, 40,  0,  0},{ 68,247,247,165},{1,0,0,0}},  {/*1*/{ 70, 40,  0,  0},{ 70,255,249,167},{0,0,0,0}},  {/*1*/{ 70, 42,  0,  0},{ 70,249,253,169},{1,0,0,0}},
+  {/*1*/{ 72, 44,  2,  0},{ 72,245,251,171},{0,0,0,0}},  {/*1*/{ 72, 44,  2,  0},{ 72,251,255,175},{1,0,0,0}},  {/*1*/{ 74, 46,  4,  0},{ 74,247,253,177},{0,0,0,0}},  {/*1*/{ 74, 46,  6,  0},{ 74,253,253,179},{1,0,0,0}},
+  {/*1*/{ 76, 48,  6,  0},{ 76,249,255,181},{0,0,0,0}},  {/*1*/{ 76, 48,  8,  0},{ 76,255,255,183},{1,0,0,0}},  {/*1*/{ 78, 50, 10,  0},{ 78,251,253,185},{0,0,0,0}},  {/*1*/{ 78, 52, 12,  0},{ 78,245,251,189},{1,0,0,0}},
+  {/*1*/{ 80, 52, 12,  0},{ 80,253,255,191},{0,0,0,0}},  {/*1*/{ 80, 54, 14,  0},{ 80,247,253,193},{1,0,0,0}},  {/*1*/{ 82, 54, 16,  0},{ 82,255,251,195},{0,0,0,0}},  {/*1*/{ 82, 56, 16,  0},{ 82,249,255,197},{1,0,0,0}},
+  {/*1*/{ 84, 58, 18,  0},{ 84,243,253,201},{0,0,0,0}},  {/*1*/{ 84, 58, 20,  0},{ 84,251,253,203},{1,0,0,0}},  {/*1*/{ 86, 60, 20,  0},{ 86,245,255,205},{0,0,0,0}},  {/*1*/{ 86, 60, 22,  0},{ 86,253,255,207},{1,0,0,0}},
+  {/*1*/{ 88, 62, 24,  0},{ 88,247,253,209},{0,0,0,0}},  {/*1*/{ 88, 62, 26,  0},{ 88,255,251,211},{1,0,0,0}},  {/*1*/{ 90, 64, 26,  0},{ 90,249,255,215},{0,0,0,0}},  {/*1*/{ 90, 66, 28,  0},{ 90,245,253,217},{1,0,0,0}},
+  {/*1*/{ 92, 66, 30,  0},{ 92,251,251,219},{0,0,0,0}},  {/*1*/{ 92, 68, 30,  0},{ 92,247,255,221},{1,0,0,0}},  {/*1*/{ 94, 68, 32,  0},{ 94,253,253,223},{0,0,0,0}},  {/*1*/{ 94, 70, 34,  0},{ 94,249,251,227},{1,0,0,0}},
+  {/*1*/{ 96, 70, 34,  0},{ 96,255,255,229},{0,0,0,0}},  {/*1*/{ 96, 72, 36,  0},{ 96,251,253,231},{1,0,0,0}},  {/*1*/{ 98, 74, 38,  0},{ 98,245,253,233},{0,0,0,0}},  {/*1*/{ 98, 74, 38,  0},{ 98,253,255,235},{1,0,0,0}},
+  {/*1*/{100, 76, 40,  0},{100,247,255,239},{0,0,0,0}},  {/*1*/{100, 76, 42,  0},{100,255,253,241},{1,0,0,0}},  {/*1*/{102, 78, 44,  0},{102,249,251,243},{0,0,0,0}},  {/*1*/{102, 80, 44,  0},{102,245,255,245},{1,0,0,0}},
+  {/*1*/{104, 80, 46,  0},{104,251,253,247},{0,0,0,0}},  {/*1*/{104, 82, 48,  0},{104,247,251,249},{1,0,0,0}},  {/*1*/{106, 82, 48,  0},{106,253,255,253},{0,0,0,0}},  {/*1*/{106, 84, 50,  0},{106,249,253,255},{1,0,0,0}},
+  {/*1*/{108, 84, 52,  2},{108,255,253,255},{0,0,0,0}},  {/*1*/{108, 86, 52,  4},{108,251,255,253},{1,0,0,0}},  {/*1*/{110, 88, 54,  6},{110,245,255,253},{0,0,0,0}},  {/*1*/{110, 88, 56,  6},{110,253,253,255},{1,0,0,0}},
+  {/*1*/{112, 90, 58,  8},{112,247,251,255},{0,0,0,0}},  {/*1*/{112, 90, 58, 10},{112,255,255,255},{1,0,0,0}},  {/*1*/{114, 92, 60, 12},{114,249,253,255},{0,0,0,0}},  {/*1*/{114, 94, 62, 14},{114,245,251,255},{1,0,0,0}},
+  {/*1*/{116, 94, 62, 16},{116,251,255,255},{0,0,0,0}},  {/*1*/{116, 96, 64, 18},{116,247,253,253},{1,0,0,0}},  {/*1*/{118, 96, 66, 20},{118,253,251,253},{0,0,0,0}},  {/*1*/{118, 98, 66, 20},{118,249,255,255},{1,0,0,0}},
+  {/*1*/{120, 98, 68, 22},{120,255,253,255},{0,0,0,0}},  {/*1*/{120,100, 70, 24},{120,251,253,255},{1,0,0,0}},  {/*1*/{122,102, 70, 26},{122,245,255,255},{0,0,0,0}},  {/*1*/{122,102, 72, 28},{122,253,255,255},{1,0,0,0}},
+  {/*1*/{124,104, 74, 30},{124,247,253,253},{0,0,0,0}},  {/*1*/{124,104, 76, 32},{124,255,251,253},{1,0,0,0}},  {/*1*/{126,106, 76, 32},{126,249,255,255},{0,0,0,0}},  {/*1*/{126,108, 78, 34},{126,245,253,255},{1,0,0,0}},
+  {/*1*/{129,108, 80, 36},{129,251,251,255},{1,0,0,0}},  {/*1*/{129,110, 80, 38},{129,247,255,255},{0,0,0,0}},  {/*1*/{129,110, 82, 40},{129,253,253,255},{1,0,0,0}},  {/*1*/{131,112, 84, 42},{131,249,253,253},{0,0,0,0}},
+  {/*1*/{131,112, 84, 44},{131,255,255,253},{1,0,0,0}},  {/*1*/{133,114, 86, 44},{133,251,255,255},{0,0,0,0}},  {/*1*/{133,116, 88, 46},{133,245,253,255},{1,0,0,0}},  {/*1*/{135,116, 90, 48},{135,253,251,255},{0,0,0,0}},
+  {/*1*/{135,118, 90, 50},{135,247,255,255},{1,0,0,0}},  {/*1*/{137,118, 92, 52},{137,255,253,255},{0,0,0,0}},  {/*1*/{137,120, 94, 54},{137,249,251,255},{1,0,0,0}},  {/*1*/{139,122, 94, 56},{139,243,255,253},{0,0,0,0}},
+  {/*1*/{139,122, 96, 58},{139,251,253,253},{1,0,0,0}},  {/*1*/{141,124, 98, 58},{141,245,251,255},{0,0,0,0}},  {/*1*/{141,124, 98, 60},{141,253,255,255},{1,0,0,0}},  {/*1*/{143,126,100, 62},{143,247,253,255},{0,0,0,0}},
+  {/*1*/{143,126,102, 64},{143,255,253,255},{1,0,0,0}},  {/*1*/{145,129,102, 66},{145,243,255,255},{0,0,0,0}},  {/*1*/{145,129,104, 68},{145,251,255,253},{1,0,0,0}},  {/*1*/{147,131,106, 70},{147,245,253,253},{0,0,0,0}},
+  {/*1*/{147,131,108, 70},{147,253,251,255},{1,0,0,0}},  {/*1*/{149,133,108, 72},{149,247,255,255},{0,0,0,0}},  {/*1*/{149,133,110, 74},{149,255,253,255},{1,0,0,0}},  {/*1*/{151,135,112, 76},{151,249,251,255},{0,0,0,0}},
+  {/*1*/{151,137,112, 78},{151,245,255,255},{1,0,0,0}},  {/*1*/{153,137,114, 80},{153,251,253,255},{0,0,0,0}},  {/*1*/{153,139,116, 82},{153,247,253,253},{1,0,0,0}},  {/*1*/{155,139,116, 84},{155,253,255,253},{0,0,0,0}},
+  {/*1*/{155,141,118, 84},{155,249,255,255},{1,0,0,0}},  {/*1*/{157,141,120, 86},{157,255,253,255},{0,0,0,0}},  {/*1*/{157,143,122, 88},{157,251,251,255},{1,0,0,0}},  {/*1*/{159,145,122, 90},{159,245,255,255},{0,0,0,0}},
+  {/*1*/{159,145,124, 92},{159,253,253,255},{1,0,0,0}},  {/*1*/{161,147,126, 94},{161,247,251,253},{0,0,0,0}},  {/*1*/{161,147,126, 96},{161,255,255,253},{1,0,0,0}},  {/*1*/{163,149,129, 96},{163,249,251,255},{0,0,0,0}},
+  {/*1*/{163,151,129, 98},{163,245,255,255},{1,0,0,0}},  {/*1*/{165,151,131,100},{165,251,253,255},{0,0,0,0}},  {/*1*/{165,153,133,102},{165,247,251,255},{1,0,0,0}},  {/*1*/{167,153,133,104},{167,253,255,255},{0,0,0,0}},
+  {/*1*/{167,155,135,106},{167,249,253,253},{1,0,0,0}},  {/*1*/{169,155,137,108},{169,255,251,253},{0,0,0,0}},  {/*1*/{169,157,137,108},{169,251,255,255},{1,0,0,0}},  {/*1*/{171,159,139,110},{171,245,253,255},{0,0,0,0}},
+  {/*1*/{171,159,141,112},{171,253,253,255},{1,0,0,0}},  {/*1*/{173,161,141,114},{173,247,255,255},{0,0,0,0}},  {/*1*/{173,161,143,116},{173,255,255,255},{1,0,0,0}},  {/*1*/{175,163,145,118},{175,249,253,255},{0,0,0,0}},
+  {/*1*/{175,165,147,120},{175,245,251,253},{1,0,0,0}},  {/*1*/{177,165,147,122},{177,251,255,253},{0,0,0,0}},  {/*1*/{177,167,149,122},{177,247,253,255},{1,0,0,0}},  {/*1*/{179,167,151,124},{179,253,251,255},{0,0,0,0}},
+  {/*1*/{179,169,151,126},{179,249,255,255},{1,0,0,0}},  {/*1*/{181,169,153,129},{181,255,253,253},{0,0,0,0}},  {/*1*/{181,171,155,129},{181,251,251,255},{1,0,0,0}},  {/*1*/{183,173,155,131},{183,245,255,255},{0,0,0,0}},
+  {/*1*/{183,173,157,133},{183,253,253,255},{1,0,0,0}},  {/*1*/{185,175,159,135},{185,247,253,255},{0,0,0,0}},  {/*1*/{185,175,159,137},{185,255,255,255},{1,0,0,0}},  {/*1*/{187,177,161,139},{187,249,255,253},{0,0,0,0}},
+  {/*1*/{187,179,163,141},{187,243,253,253},{1,0,0,0}},  {/*1*/{189,179,165,141},{189,251,251,255},{0,0,0,0}},  {/*1*/{189,181,165,143},{189,245,255,255},{1,0,0,0}},  {/*1*/{191,181,167,145},{191,253,253,255},{0,0,0,0}},
+  {/*1*/{191,183,169,147},{191,247,251,255},{1,0,0,0}},  {/*1*/{193,183,169,149},{193,255,255,255},{0,0,0,0}},  {/*1*/{193,185,171,151},{193,249,253,253},{1,0,0,0}},  {/*1*/{195,187,173,153},{195,245,253,253},{0,0,0,0}},
+  {/*1*/{195,187,173,153},{195,251,255,255},{1,0,0,0}},  {/*1*/{197,189,175,155},{197,247,255,255},{0,0,0,0}},  {/*1*/{197,189,177,157},{197,253,253,255},{1,0,0,0}},  {/*1*/{199,191,179,159},{199,249,251,255},{0,0,0,0}},
+  {/*1*/{199,191,179,161},{199,255,255,255},{1,0,0,0}},  {/*1*/{201,193,181,163},{201,251,253,255},{0,0,0,0}},  {/*1*/{201,195,183,165},{201,245,251,253},{1,0,0,0}},  {/*1*/{203,195,183,167},{203,253,255,253},{0,0,0,0}},
+  {/*1*/{203,197,185,167},{203,247,253,255},{1,0,0,0}},  {/*1*/{205,197,187,169},{205,255,251,255},{0,0,0,0}},  {/*1*/{205,199,187,171},{205,249,255,255},{1,0,0,0}},  {/*1*/{207,201,189,173},{207,245,253,255},{0,0,0,0}},
+  {/*1*/{207,201,191,175},{207,251,253,255},{1,0,0,0}},  {/*1*/{209,203,191,177},{209,247,255,253},{0,0,0,0}},  {/*1*/{209,203,193,179},{209,253,255,253},{1,0,0,0}},  {/*1*/{211,205,195,179},{211,249,253,255},{0,0,0,0}},
+  {/*1*/{211,205,197,181},{211,255,251,255},{1,0,0,0}},  {/*1*/{213,207,197,183},{213,251,255,255},{0,0,0,0}},  {/*1*/{213,209,199,185},{213,245,253,255},{1,0,0,0}},  {/*1*/{215,209,201,187},{215,253,251,255},{0,0,0,0}},
+  {/*1*/{215,211,201,189},{215,247,255,253},{1,0,0,0}},  {/*1*/{217,211,203,191},{217,255,253,253},{0,0,0,0}},  {/*1*/{217,213,205,191},{217,249,253,255},{1,0,0,0}},  {/*1*/{219,215,205,193},{219,245,255,255},{0,0,0,0}},
+  {/*1*/{219,215,207,195},{219,251,255,255},{1,0,0,0}},  {/*1*/{221,217,209,197},{221,247,253,255},{0,0,0,0}},  {/*1*/{221,217,211,199},{221,253,251,255},{1,0,0,0}},  {/*1*/{223,219,211,201},{223,249,255,255},{0,0,0,0}},
+  {/*1*/{223,219,213,203},{223,255,253,253},{1,0,0,0}},  {/*1*/{225,221,215,205},{225,251,251,253},{0,0,0,0}},  {/*1*/{225,223,215,205},{225,245,255,255},{1,0,0,0}},  {/*1*/{227,223,217,207},{227,253,253,255},{0,0,0,0}},
+  {/*1*/{227,225,219,209},{227,247,251,255},{1,0,0,0}},  {/*1*/{229,225,219,211},{229,255,255,255},{0,0,0,0}},  {/*1*/{229,227,221,213},{229,249,253,255},{1,0,0,0}},  {/*1*/{231,229,223,215},{231,245,253,253},{0,0,0,0}},
+  {/*1*/{231,229,223,217},{231,251,255,253},{1,0,0,0}},  {/*1*/{233,231,225,217},{233,247,255,255},{0,0,0,0}},  {/*1*/{233,231,227,219},{233,253,253,255},{1,0,0,0}},  {/*1*/{235,233,229,221},{235,249,251,255},{0,0,0,0}},
+  {/*1*/{235,233,229,223},{235,255,255,255},{1,0,0,0}},  {/*1*/{237,235,231,225},{237,251,253,255},{0,0,0,0}},  {/*1*/{237,237,233,227},{237,245,251,255},{1,0,0,0}},  {/*1*/{239,237,233,229},{239,253,255,253},{0,0,0,0}},
+  {/*1*/{239,239,235,231},{239,247,253,253},{1,0,0,0}},  {/*1*/{241,239,237,231},{241,255,253,255},{0,0,0,0}},  {/*1*/{241,241,237,233},{241,249,255,255},{1,0,0,0}},  {/*1*/{243,243,239,235},{243,243,255,255},{0,0,0,0}},
+  {/*1*/{243,243,241,237},{243,251,253,255},{1,0,0,0}},  {/*1*/{245,245,243,239},{245,245,251,255},{0,0,0,0}},  {/*1*/{245,245,243,241},{245,253,255,253},{1,0,0,0}},  {/*1*/{247,247,245,243},{247,247,253,253},{0,0,0,0}},
+  {/*1*/{247,247,247,243},{247,255,251,255},{1,0,0,0}},  {/*1*/{249,249,247,245},{249,249,255,255},{0,0,0,0}},  {/*1*/{249,251,249,247},{249,249,253,255},{1,0,0,0}},  {/*1*/{251,251,251,249},{251,251,251,255},{0,0,0,0}},
+  {/*1*/{251,253,251,251},{251,251,255,255},{1,0,0,0}},  {/*1*/{253,253,253,253},{253,253,253,253},{0,0,0,0}},  {/*1*/{253,255,255,255},{253,253,253,253},{1,0,0,0}},  {/*1*/{255,255,255,255},{255,255,255,255},{0,0,0,0}}
 };
 
 /* 256 * 8 * 3 * 1 = 6144 */
 static PaletteSingleLookup8 const sp_lookup_8_16[256] =
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  1,  1,0},{  0, 16,0},{  0,  8,0},{  0,  5,0},{  0,  4,0},{  0,  4,0},{  0,  3,0},{  0,  3,0}}},  {{/*1*/{  2,  2,0},{  0, 32,0},{  0, 15,0},{  0, 10,0},{  0,  8,0},{  0,  7,0},{  0,  5,0},{  0,  5,0}}},  {{/*1*/{  3,  3,0},{  0, 48,0},{  0, 22,0},{  0, 15,0},{  0, 12,0},{  0, 10,0},{  0,  8,0},{  0,  7,0}}},
-  {{/*1*/{  4,  4,0},{  0, 64,0},{  0, 29,0},{  0, 20,0},{  0, 16,0},{  0, 13,0},{  0, 10,0},{  0,  9,0}}},  {{/*1*/{  5,  5,0},{  0, 80,0},{  0, 36,0},{  0, 25,0},{  0, 19,0},{  0, 16,0},{  0, 13,0},{  0, 11,0}}},  {{/*1*/{  6,  6,0},{  0, 96,0},{  0, 43,0},{  0, 30,0},{  0, 23,0},{  0, 19,0},{  0, 15,0},{  0, 13,0}}},  {{/*1*/{  7,  7,0},{  0,112,0},{  0, 50,0},{  0, 35,0},{  0, 27,0},{  0, 22,0},{  0, 18,0},{  0, 15,0}}},
-  {{/*1*/{  8,  8,0},{  0,128,0},{  0, 57,0},{  0, 40,0},{  0, 31,0},{  0, 25,0},{  0, 20,0},{  0, 18,0}}},  {{/*1*/{  9,  9,0},{  0,144,0},{  0, 64,0},{  0, 45,0},{  0, 34,0},{  0, 28,0},{  0, 23,0},{  0, 20,0}}},  {{/*1*/{ 10, 10,0},{  0,160,0},{  0, 72,0},{  0, 50,0},{  0, 38,0},{  0, 31,0},{  0, 25,0},{  0, 22,0}}},  {{/*1*/{ 11, 11,0},{  0,176,0},{  0, 79,0},{  0, 55,0},{  0, 42,0},{  0, 34,0},{  0, 28,0},{  0, 24,0}}},
-  {{/*1*/{ 12, 12,0},{  0,192,0},{  0, 86,0},{  0, 60,0},{  0, 46,0},{  0, 37,0},{  0, 30,0},{  0, 26,0}}},  {{/*1*/{ 13, 13,0},{  0,208,0},{  0, 93,0},{  0, 64,0},{  0, 49,0},{  0, 40,0},{  0, 32,0},{  0, 28,0}}},  {{/*1*/{ 14, 14,0},{  0,224,0},{  0,100,0},{  0, 69,0},{  0, 53,0},{  0, 43,0},{  0, 35,0},{  0, 30,0}}},  {{/*1*/{ 15, 15,0},{  0,240,0},{  0,107,0},{  0, 74,0},{  0, 57,0},{  0, 46,0},{  0, 37,0},{  0, 32,0}}},
-  {{/*1*/{ 16, 16,0},{  1,241,0},{  0,114,0},{  0, 79,0},{  0, 61,0},{  0, 49,0},{  0, 40,0},{  0, 35,0}}},  {{/*1*/{ 17, 17,0},{  2,242,0},{  0,121,0},{  0, 84,0},{  0, 64,0},{  0, 52,0},{  0, 42,0},{  0, 37,0}}},  {{/*1*/{ 18, 18,0},{  3,243,0},{  0,128,0},{  0, 89,0},{  0, 68,0},{  0, 55,0},{  0, 45,0},{  0, 39,0}}},  {{/*1*/{ 19, 19,0},{  4,244,0},{  0,136,0},{  0, 94,0},{  0, 72,0},{  0, 58,0},{  0, 47,0},{  0, 41,0}}},
-  {{/*1*/{ 20, 20,0},{  5,245,0},{  0,143,0},{  0, 99,0},{  0, 76,0},{  0, 61,0},{  0, 50,0},{  0, 43,0}}},  {{/*1*/{ 21, 21,0},{  6,246,0},{  0,150,0},{  0,104,0},{  0, 80,0},{  0, 64,0},{  0, 52,0},{  0, 45,0}}},  {{/*1*/{ 22, 22,0},{  7,247,0},{  0,157,0},{  0,109,0},{  0, 83,0},{  0, 68,0},{  0, 55,0},{  0, 47,0}}},  {{/*1*/{ 23, 23,0},{  8,248,0},{  0,164,0},{  0,114,0},{  0, 87,0},{  0, 71,0},{  0, 57,0},{  0, 50,0}}},
-  {{/*1*/{ 24, 24,0},{  9,249,0},{  0,171,0},{  0,119,0},{  0, 91,0},{  0, 74,0},{  0, 60,0},{  0, 52,0}}},  {{/*1*/{ 25, 25,0},{ 10,250,0},{  0,178,0},{  0,124,0},{  0, 95,0},{  0, 77,0},{  0, 62,0},{  0, 54,0}}},  {{/*1*/{ 26, 26,0},{ 11,251,0},{  0,185,0},{  0,128,0},{  0, 98,0},{  0, 80,0},{  0, 64,0},{  0, 56,0}}},  {{/*1*/{ 27, 27,0},{ 12,252,0},{  0,192,0},{  0,133,0},{  0,102,0},{  0, 83,0},{  0, 67,0},{  0, 58,0}}},
-  {{/*1*/{ 28, 28,0},{ 13,253,0},{  0,200,0},{  0,138,0},{  0,106,0},{  0, 86,0},{  0, 69,0},{  0, 60,0}}},  {{/*1*/{ 29, 29,0},{ 14,254,0},{  0,207,0},{  0,143,0},{  0,110,0},{  0, 89,0},{  0, 72,0},{  0, 62,0}}},  {{/*1*/{ 30, 30,0},{ 15,255,0},{  0,214,0},{  0,148,0},{  0,113,0},{  0, 92,0},{  0, 74,0},{  0, 64,0}}},  {{/*1*/{ 31, 31,0},{ 17,241,0},{  0,221,0},{  0,153,0},{  0,117,0},{  0, 95,0},{  0, 77,0},{  0, 67,0}}},
-  {{/*1*/{ 32, 32,0},{ 18,242,0},{  0,228,0},{  0,158,0},{  0,121,0},{  0, 98,0},{  0, 79,0},{  0, 69,0}}},  {{/*1*/{ 33, 33,0},{ 19,243,0},{  0,235,0},{  0,163,0},{  0,125,0},{  0,101,0},{  0, 82,0},{  0, 71,0}}},  {{/*1*/{ 34, 34,0},{ 20,244,0},{  0,242,0},{  0,168,0},{  0,128,0},{  0,104,0},{  0, 84,0},{  0, 73,0}}},  {{/*1*/{ 35, 35,0},{ 21,245,0},{  0,249,0},{  0,173,0},{  0,132,0},{  0,107,0},{  0, 87,0},{  0, 75,0}}},
-  {{/*1*/{ 36, 36,0},{ 22,246,0},{  1,250,0},{  0,178,0},{  0,136,0},{  0,110,0},{  0, 89,0},{  0, 77,0}}},  {{/*1*/{ 37, 37,0},{ 23,247,0},{  2,251,0},{  0,183,0},{  0,140,0},{  0,113,0},{  0, 92,0},{  0, 79,0}}},  {{/*1*/{ 38, 38,0},{ 24,248,0},{  3,252,0},{  0,188,0},{  0,144,0},{  0,116,0},{  0, 94,0},{  0, 82,0}}},  {{/*1*/{ 39, 39,0},{ 25,249,0},{  4,253,0},{  0,192,0},{  0,147,0},{  0,119,0},{  0, 96,0},{  0, 84,0}}},
-  {{/*1*/{ 40, 40,0},{ 26,250,0},{  5,254,0},{  0,197,0},{  0,151,0},{  0,122,0},{  0, 99,0},{  0, 86,0}}},  {{/*1*/{ 41, 41,0},{ 27,251,0},{  6,255,0},{  0,202,0},{  0,155,0},{  0,125,0},{  0,101,0},{  0, 88,0}}},  {{/*1*/{ 42, 42,0},{ 28,252,0},{  8,250,0},{  0,207,0},{  0,159,0},{  0,128,0},{  0,104,0},{  0, 90,0}}},  {{/*1*/{ 43, 43,0},{ 29,253,0},{  9,251,0},{  0,212,0},{  0,162,0},{  0,132,0},{  0,106,0},{  0, 92,0}}},
-  {{/*1*/{ 44, 44,0},{ 30,254,0},{ 10,252,0},{  0,217,0},{  0,166,0},{  0,135,0},{  0,109,0},{  0, 94,0}}},  {{/*1*/{ 45, 45,0},{ 31,255,0},{ 11,253,0},{  0,222,0},{  0,170,0},{  0,138,0},{  0,111,0},{  0, 96,0}}},  {{/*1*/{ 46, 46,0},{ 33,241,0},{ 12,254,0},{  0,227,0},{  0,174,0},{  0,141,0},{  0,114,0},{  0, 99,0}}},  {{/*1*/{ 47, 47,0},{ 34,242,0},{ 13,255,0},{  0,232,0},{  0,177,0},{  0,144,0},{  0,116,0},{  0,101,0}}},
-  {{/*1*/{ 48, 48,0},{ 35,243,0},{ 15,250,0},{  0,237,0},{  0,181,0},{  0,147,0},{  0,119,0},{  0,103,0}}},  {{/*1*/{ 49, 49,0},{ 36,244,0},{ 16,251,0},{  0,242,0},{  0,185,0},{  0,150,0},{  0,121,0},{  0,105,0}}},  {{/*1*/{ 50, 50,0},{ 37,245,0},{ 17,252,0},{  0,247,0},{  0,189,0},{  0,153,0},{  0,124,0},{  0,107,0}}},  {{/*1*/{ 51, 51,0},{ 38,246,0},{ 18,253,0},{  0,252,0},{  0,192,0},{  0,156,0},{  0,126,0},{  0,109,0}}},
-  {{/*1*/{ 52, 52,0},{ 39,247,0},{ 19,254,0},{  1,253,0},{  0,196,0},{  0,159,0},{  0,128,0},{  0,111,0}}},  {{/*1*/{ 53, 53,0},{ 40,248,0},{ 20,255,0},{  2,254,0},{  0,200,0},{  0,162,0},{  0,131,0},{  0,114,0}}},  {{/*1*/{ 54, 54,0},{ 41,249,0},{ 22,250,0},{  3,255,0},{  0,204,0},{  0,165,0},{  0,133,0},{  0,116,0}}},  {{/*1*/{ 55, 55,0},{ 42,250,0},{ 23,251,0},{  5,252,0},{  0,208,0},{  0,168,0},{  0,136,0},{  0,118,0}}},
-  {{/*1*/{ 56, 56,0},{ 43,251,0},{ 24,252,0},{  6,253,0},{  0,211,0},{  0,171,0},{  0,138,0},{  0,120,0}}},  {{/*1*/{ 57, 57,0},{ 44,252,0},{ 25,253,0},{  7,254,0},{  0,215,0},{  0,174,0},{  0,141,0},{  0,122,0}}},  {{/*1*/{ 58, 58,0},{ 45,253,0},{ 26,254,0},{  8,255,0},{  0,219,0},{  0,177,0},{  0,143,0},{  0,124,0}}},  {{/*1*/{ 59, 59,0},{ 46,254,0},{ 27,255,0},{ 10,252,0},{  0,223,0},{  0,180,0},{  0,146,0},{  0,126,0}}},
-  {{/*1*/{ 60, 60,0},{ 47,255,0},{ 29,250,0},{ 11,253,0},{  0,226,0},{  0,183,0},{  0,148,0},{  0,128,0}}},  {{/*1*/{ 61, 61,0},{ 49,241,0},{ 30,251,0},{ 12,254,0},{  0,230,0},{  0,186,0},{  0,151,0},{  0,131,0}}},  {{/*1*/{ 62, 62,0},{ 50,242,0},{ 31,252,0},{ 13,255,0},{  0,234,0},{  0,189,0},{  0,153,0},{  0,133,0}}},  {{/*1*/{ 63, 63,0},{ 51,243,0},{ 32,253,0},{ 15,252,0},{  0,238,0},{  0,192,0},{  0,156,0},{  0,135,0}}},
-  {{/*1*/{ 64, 64,0},{ 52,244,0},{ 33,254,0},{ 16,253,0},{  0,241,0},{  0,196,0},{  0,158,0},{  0,137,0}}},  {{/*1*/{ 65, 65,0},{ 53,245,0},{ 34,255,0},{ 17,254,0},{  0,245,0},{  0,199,0},{  0,160,0},{  0,139,0}}},  {{/*1*/{ 66, 66,0},{ 54,246,0},{ 36,250,0},{ 18,255,0},{  0,249,0},{  0,202,0},{  0,163,0},{  0,141,0}}},  {{/*1*/{ 67, 67,0},{ 55,247,0},{ 37,251,0},{ 20,252,0},{  0,253,0},{  0,205,0},{  0,165,0},{  0,143,0}}},
-  {{/*1*/{ 68, 68,0},{ 56,248,0},{ 38,252,0},{ 21,253,0},{  1,254,0},{  0,208,0},{  0,168,0},{  0,146,0}}},  {{/*1*/{ 69, 69,0},{ 57,249,0},{ 39,253,0},{ 22,254,0},{  2,255,0},{  0,211,0},{  0,170,0},{  0,148,0}}},  {{/*1*/{ 70, 70,0},{ 58,250,0},{ 40,254,0},{ 23,255,0},{  4,253,0},{  0,214,0},{  0,173,0},{  0,150,0}}},  {{/*1*/{ 71, 71,0},{ 59,251,0},{ 41,255,0},{ 25,252,0},{  5,254,0},{  0,217,0},{  0,175,0},{  0,152,0}}},
-  {{/*1*/{ 72, 72,0},{ 60,252,0},{ 43,250,0},{ 26,253,0},{  6,255,0},{  0,220,0},{  0,178,0},{  0,154,0}}},  {{/*1*/{ 73, 73,0},{ 61,253,0},{ 44,251,0},{ 27,254,0},{  8,253,0},{  0,223,0},{  0,180,0},{  0,156,0}}},  {{/*1*/{ 74, 74,0},{ 62,254,0},{ 45,252,0},{ 28,255,0},{  9,254,0},{  0,226,0},{  0,183,0},{  0,158,0}}},  {{/*1*/{ 75, 75,0},{ 63,255,0},{ 46,253,0},{ 30,252,0},{ 10,255,0},{  0,229,0},{  0,185,0},{  0,160,0}}},
-  {{/*1*/{ 76, 76,0},{ 65,241,0},{ 47,254,0},{ 31,253,0},{ 12,253,0},{  0,232,0},{  0,188,0},{  0,163,0}}},  {{/*1*/{ 77, 77,0},{ 66,242,0},{ 48,255,0},{ 32,254,0},{ 13,254,0},{  0,235,0},{  0,190,0},{  0,165,0}}},  {{/*1*/{ 78, 78,0},{ 67,243,0},{ 50,250,0},{ 33,255,0},{ 14,255,0},{  0,238,0},{  0,192,0},{  0,167,0}}},  {{/*1*/{ 79, 79,0},{ 68,244,0},{ 51,251,0},{ 35,252,0},{ 16,254,0},{  0,241,0},{  0,195,0},{  0,169,0}}},
-  {{/*1*/{ 80, 80,0},{ 69,245,0},{ 52,252,0},{ 36,253,0},{ 17,255,0},{  0,244,0},{  0,197,0},{  0,171,0}}},  {{/*1*/{ 81, 81,0},{ 70,246,0},{ 53,253,0},{ 37,254,0},{ 19,253,0},{  0,247,0},{  0,200,0},{  0,173,0}}},  {{/*1*/{ 82, 82,0},{ 71,247,0},{ 54,254,0},{ 38,255,0},{ 20,254,0},{  0,250,0},{  0,202,0},{  0,175,0}}},  {{/*1*/{ 83, 83,0},{ 72,248,0},{ 55,255,0},{ 40,252,0},{ 21,255,0},{  0,253,0},{  0,205,0},{  0,178,0}}},
-  {{/*1*/{ 84, 84,0},{ 73,249,0},{ 57,249,0},{ 41,253,0},{ 23,253,0},{  1,254,0},{  0,207,0},{  0,180,0}}},  {{/*1*/{ 85, 85,0},{ 74,250,0},{ 58,250,0},{ 42,254,0},{ 24,254,0},{  2,255,0},{  0,210,0},{  0,182,0}}},  {{/*1*/{ 86, 86,0},{ 75,251,0},{ 59,251,0},{ 43,255,0},{ 25,255,0},{  4,254,0},{  0,212,0},{  0,184,0}}},  {{/*1*/{ 87, 87,0},{ 76,252,0},{ 60,252,0},{ 45,252,0},{ 27,253,0},{  5,255,0},{  0,215,0},{  0,186,0}}},
-  {{/*1*/{ 88, 88,0},{ 77,253,0},{ 61,253,0},{ 46,253,0},{ 28,254,0},{  7,254,0},{  0,217,0},{  0,188,0}}},  {{/*1*/{ 89, 89,0},{ 78,254,0},{ 62,254,0},{ 47,254,0},{ 29,255,0},{  8,255,0},{  0,220,0},{  0,190,0}}},  {{/*1*/{ 90, 90,0},{ 79,255,0},{ 63,255,0},{ 48,255,0},{ 31,254,0},{ 10,254,0},{  0,222,0},{  0,192,0}}},  {{/*1*/{ 91, 91,0},{ 81,241,0},{ 65,250,0},{ 50,252,0},{ 32,255,0},{ 11,255,0},{  0,224,0},{  0,195,0}}},
-  {{/*1*/{ 92, 92,0},{ 82,242,0},{ 66,251,0},{ 51,253,0},{ 34,253,0},{ 13,254,0},{  0,227,0},{  0,197,0}}},  {{/*1*/{ 93, 93,0},{ 83,243,0},{ 67,252,0},{ 52,254,0},{ 35,254,0},{ 14,255,0},{  0,229,0},{  0,199,0}}},  {{/*1*/{ 94, 94,0},{ 84,244,0},{ 68,253,0},{ 53,255,0},{ 36,255,0},{ 16,254,0},{  0,232,0},{  0,201,0}}},  {{/*1*/{ 95, 95,0},{ 85,245,0},{ 69,254,0},{ 55,252,0},{ 38,253,0},{ 17,255,0},{  0,234,0},{  0,203,0}}},
-  {{/*1*/{ 96, 96,0},{ 86,246,0},{ 70,255,0},{ 56,253,0},{ 39,254,0},{ 19,254,0},{  0,237,0},{  0,205,0}}},  {{/*1*/{ 97, 97,0},{ 87,247,0},{ 72,250,0},{ 57,254,0},{ 40,255,0},{ 20,255,0},{  0,239,0},{  0,207,0}}},  {{/*1*/{ 98, 98,0},{ 88,248,0},{ 73,251,0},{ 58,255,0},{ 42,253,0},{ 22,254,0},{  0,242,0},{  0,210,0}}},  {{/*1*/{ 99, 99,0},{ 89,249,0},{ 74,252,0},{ 60,252,0},{ 43,254,0},{ 23,255,0},{  0,244,0},{  0,212,0}}},
-  {{/*1*/{100,100,0},{ 90,250,0},{ 75,253,0},{ 61,253,0},{ 44,255,0},{ 25,254,0},{  0,247,0},{  0,214,0}}},  {{/*1*/{101,101,0},{ 91,251,0},{ 76,254,0},{ 62,254,0},{ 46,254,0},{ 26,255,0},{  0,249,0},{  0,216,0}}},  {{/*1*/{102,102,0},{ 92,252,0},{ 77,255,0},{ 63,255,0},{ 47,255,0},{ 28,254,0},{  0,252,0},{  0,218,0}}},  {{/*1*/{103,103,0},{ 93,253,0},{ 79,250,0},{ 65,253,0},{ 49,253,0},{ 29,255,0},{  0,254,0},{  0,220,0}}},
-  {{/*1*/{104,104,0},{ 94,254,0},{ 80,251,0},{ 66,254,0},{ 50,254,0},{ 31,254,0},{  1,255,0},{  0,222,0}}},  {{/*1*/{105,105,0},{ 95,255,0},{ 81,252,0},{ 67,255,0},{ 51,255,0},{ 32,255,0},{  3,255,0},{  0,224,0}}},  {{/*1*/{106,106,0},{ 97,241,0},{ 82,253,0},{ 69,252,0},{ 53,253,0},{ 34,254,0},{  5,254,0},{  0,227,0}}},  {{/*1*/{107,107,0},{ 98,242,0},{ 83,254,0},{ 70,253,0},{ 54,254,0},{ 35,255,0},{  6,255,0},{  0,229,0}}},
-  {{/*1*/{108,108,0},{ 99,243,0},{ 84,255,0},{ 71,254,0},{ 55,255,0},{ 37,254,0},{  8,255,0},{  0,231,0}}},  {{/*1*/{109,109,0},{100,244,0},{ 86,250,0},{ 72,255,0},{ 57,253,0},{ 38,255,0},{ 10,254,0},{  0,233,0}}},  {{/*1*/{110,110,0},{101,245,0},{ 87,251,0},{ 74,252,0},{ 58,254,0},{ 40,254,0},{ 11,255,0},{  0,235,0}}},  {{/*1*/{111,111,0},{102,246,0},{ 88,252,0},{ 75,253,0},{ 59,255,0},{ 41,255,0},{ 13,255,0},{  0,237,0}}},
-  {{/*1*/{112,112,0},{103,247,0},{ 89,253,0},{ 76,254,0},{ 61,253,0},{ 43,254,0},{ 15,254,0},{  0,239,0}}},  {{/*1*/{113,113,0},{104,248,0},{ 90,254,0},{ 77,255,0},{ 62,254,0},{ 44,255,0},{ 16,255,0},{  0,242,0}}},  {{/*1*/{114,114,0},{105,249,0},{ 91,255,0},{ 79,252,0},{ 63,255,0},{ 46,254,0},{ 18,255,0},{  0,244,0}}},  {{/*1*/{115,115,0},{106,250,0},{ 93,250,0},{ 80,253,0},{ 65,254,0},{ 47,255,0},{ 20,254,0},{  0,246,0}}},
-  {{/*1*/{116,116,0},{107,251,0},{ 94,251,0},{ 81,254,0},{ 66,255,0},{ 49,254,0},{ 21,255,0},{  0,248,0}}},  {{/*1*/{117,117,0},{108,252,0},{ 95,252,0},{ 82,255,0},{ 68,253,0},{ 50,255,0},{ 23,255,0},{  0,250,0}}},  {{/*1*/{118,118,0},{109,253,0},{ 96,253,0},{ 84,252,0},{ 69,254,0},{ 52,254,0},{ 25,254,0},{  0,252,0}}},  {{/*1*/{119,119,0},{110,254,0},{ 97,254,0},{ 85,253,0},{ 70,255,0},{ 53,255,0},{ 26,255,0},{  0,254,0}}},
-  {{/*1*/{120,120,0},{111,255,0},{ 98,255,0},{ 86,254,0},{ 72,253,0},{ 55,254,0},{ 28,255,0},{  1,255,0}}},  {{/*1*/{121,121,0},{113,241,0},{100,250,0},{ 87,255,0},{ 73,254,0},{ 56,255,0},{ 30,254,0},{  3,255,0}}},  {{/*1*/{122,122,0},{114,242,0},{101,251,0},{ 89,252,0},{ 74,255,0},{ 58,254,0},{ 31,255,0},{  5,255,0}}},  {{/*1*/{123,123,0},{115,243,0},{102,252,0},{ 90,253,0},{ 76,253,0},{ 59,255,0},{ 33,255,0},{  7,255,0}}},
-  {{/*1*/{124,124,0},{116,244,0},{103,253,0},{ 91,254,0},{ 77,254,0},{ 61,253,0},{ 35,255,0},{  9,255,0}}},  {{/*1*/{125,125,0},{117,245,0},{104,254,0},{ 92,255,0},{ 78,255,0},{ 62,254,0},{ 37,254,0},{ 11,255,0}}},  {{/*1*/{126,126,0},{118,246,0},{105,255,0},{ 94,252,0},{ 80,254,0},{ 63,255,0},{ 38,255,0},{ 13,255,0}}},  {{/*1*/{127,127,0},{119,247,0},{107,250,0},{ 95,253,0},{ 81,255,0},{ 65,254,0},{ 40,255,0},{ 15,254,0}}},
-  {{/*1*/{128,128,0},{120,248,0},{108,251,0},{ 96,254,0},{ 83,253,0},{ 66,255,0},{ 42,254,0},{ 16,255,0}}},  {{/*1*/{129,129,0},{121,249,0},{109,252,0},{ 97,255,0},{ 84,254,0},{ 68,254,0},{ 43,255,0},{ 18,255,0}}},  {{/*1*/{130,130,0},{122,250,0},{110,253,0},{ 99,252,0},{ 85,255,0},{ 69,255,0},{ 45,255,0},{ 20,255,0}}},  {{/*1*/{131,131,0},{123,251,0},{111,254,0},{100,253,0},{ 87,253,0},{ 71,254,0},{ 47,254,0},{ 22,255,0}}},
-  {{/*1*/{132,132,0},{124,252,0},{112,255,0},{101,254,0},{ 88,254,0},{ 72,255,0},{ 48,255,0},{ 24,255,0}}},  {{/*1*/{133,133,0},{125,253,0},{114,250,0},{102,255,0},{ 89,255,0},{ 74,254,0},{ 50,255,0},{ 26,255,0}}},  {{/*1*/{134,134,0},{126,254,0},{115,251,0},{104,252,0},{ 91,253,0},{ 75,255,0},{ 52,254,0},{ 28,255,0}}},  {{/*1*/{135,135,0},{127,255,0},{116,252,0},{105,253,0},{ 92,254,0},{ 77,254,0},{ 53,255,0},{ 30,254,0}}},
-  {{/*1*/{136,136,0},{129,241,0},{117,253,0},{106,254,0},{ 93,255,0},{ 78,255,0},{ 55,255,0},{ 31,255,0}}},  {{/*1*/{137,137,0},{130,242,0},{118,254,0},{107,255,0},{ 95,254,0},{ 80,254,0},{ 57,254,0},{ 33,255,0}}},  {{/*1*/{138,138,0},{131,243,0},{119,255,0},{109,252,0},{ 96,255,0},{ 81,255,0},{ 58,255,0},{ 35,255,0}}},  {{/*1*/{139,139,0},{132,244,0},{121,249,0},{110,253,0},{ 98,253,0},{ 83,254,0},{ 60,255,0},{ 37,255,0}}},
-  {{/*1*/{140,140,0},{133,245,0},{122,250,0},{111,254,0},{ 99,254,0},{ 84,255,0},{ 62,254,0},{ 39,255,0}}},  {{/*1*/{141,141,0},{134,246,0},{123,251,0},{112,255,0},{100,255,0},{ 86,254,0},{ 63,255,0},{ 41,255,0}}},  {{/*1*/{142,142,0},{135,247,0},{124,252,0},{114,252,0},{102,253,0},{ 87,255,0},{ 65,255,0},{ 43,255,0}}},  {{/*1*/{143,143,0},{136,248,0},{125,253,0},{115,253,0},{103,254,0},{ 89,254,0},{ 67,255,0},{ 45,255,0}}},
-  {{/*1*/{144,144,0},{137,249,0},{126,254,0},{116,254,0},{104,255,0},{ 90,255,0},{ 69,254,0},{ 47,254,0}}},  {{/*1*/{145,145,0},{138,250,0},{127,255,0},{117,255,0},{106,253,0},{ 92,254,0},{ 70,255,0},{ 48,255,0}}},  {{/*1*/{146,146,0},{139,251,0},{129,250,0},{119,252,0},{107,254,0},{ 93,255,0},{ 72,255,0},{ 50,255,0}}},  {{/*1*/{147,147,0},{140,252,0},{130,251,0},{120,253,0},{108,255,0},{ 95,254,0},{ 74,254,0},{ 52,255,0}}},
-  {{/*1*/{148,148,0},{141,253,0},{131,252,0},{121,254,0},{110,254,0},{ 96,255,0},{ 75,255,0},{ 54,255,0}}},  {{/*1*/{149,149,0},{142,254,0},{132,253,0},{122,255,0},{111,255,0},{ 98,254,0},{ 77,255,0},{ 56,255,0}}},  {{/*1*/{150,150,0},{143,255,0},{133,254,0},{124,252,0},{113,253,0},{ 99,255,0},{ 79,254,0},{ 58,255,0}}},  {{/*1*/{151,151,0},{145,241,0},{134,255,0},{125,253,0},{114,254,0},{101,254,0},{ 80,255,0},{ 60,255,0}}},
-  {{/*1*/{152,152,0},{146,242,0},{136,250,0},{126,254,0},{115,255,0},{102,255,0},{ 82,255,0},{ 62,254,0}}},  {{/*1*/{153,153,0},{147,243,0},{137,251,0},{127,255,0},{117,253,0},{104,254,0},{ 84,254,0},{ 63,255,0}}},  {{/*1*/{154,154,0},{148,244,0},{138,252,0},{129,253,0},{118,254,0},{105,255,0},{ 85,255,0},{ 65,255,0}}},  {{/*1*/{155,155,0},{149,245,0},{139,253,0},{130,254,0},{119,255,0},{107,254,0},{ 87,255,0},{ 67,255,0}}},
-  {{/*1*/{156,156,0},{150,246,0},{140,254,0},{131,255,0},{121,253,0},{108,255,0},{ 89,254,0},{ 69,255,0}}},  {{/*1*/{157,157,0},{151,247,0},{141,255,0},{133,252,0},{122,254,0},{110,254,0},{ 90,255,0},{ 71,255,0}}},  {{/*1*/{158,158,0},{152,248,0},{143,250,0},{134,253,0},{123,255,0},{111,255,0},{ 92,255,0},{ 73,255,0}}},  {{/*1*/{159,159,0},{153,249,0},{144,251,0},{135,254,0},{125,253,0},{113,254,0},{ 94,254,0},{ 75,255,0}}},
-  {{/*1*/{160,160,0},{154,250,0},{145,252,0},{136,255,0},{126,254,0},{114,255,0},{ 95,255,0},{ 77,255,0}}},  {{/*1*/{161,161,0},{155,251,0},{146,253,0},{138,252,0},{127,255,0},{116,254,0},{ 97,255,0},{ 79,254,0}}},  {{/*1*/{162,162,0},{156,252,0},{147,254,0},{139,253,0},{129,254,0},{117,255,0},{ 99,255,0},{ 80,255,0}}},  {{/*1*/{163,163,0},{157,253,0},{148,255,0},{140,254,0},{130,255,0},{119,254,0},{101,254,0},{ 82,255,0}}},
-  {{/*1*/{164,164,0},{158,254,0},{150,250,0},{141,255,0},{132,253,0},{120,255,0},{102,255,0},{ 84,255,0}}},  {{/*1*/{165,165,0},{159,255,0},{151,251,0},{143,252,0},{133,254,0},{122,254,0},{104,255,0},{ 86,255,0}}},  {{/*1*/{166,166,0},{161,241,0},{152,252,0},{144,253,0},{134,255,0},{123,255,0},{106,254,0},{ 88,255,0}}},  {{/*1*/{167,167,0},{162,242,0},{153,253,0},{145,254,0},{136,253,0},{125,253,0},{107,255,0},{ 90,255,0}}},
-  {{/*1*/{168,168,0},{163,243,0},{154,254,0},{146,255,0},{137,254,0},{126,254,0},{109,255,0},{ 92,255,0}}},  {{/*1*/{169,169,0},{164,244,0},{155,255,0},{148,252,0},{138,255,0},{127,255,0},{111,254,0},{ 94,254,0}}},  {{/*1*/{170,170,0},{165,245,0},{157,250,0},{149,253,0},{140,253,0},{129,254,0},{112,255,0},{ 95,255,0}}},  {{/*1*/{171,171,0},{166,246,0},{158,251,0},{150,254,0},{141,254,0},{130,255,0},{114,255,0},{ 97,255,0}}},
-  {{/*1*/{172,172,0},{167,247,0},{159,252,0},{151,255,0},{142,255,0},{132,254,0},{116,254,0},{ 99,255,0}}},  {{/*1*/{173,173,0},{168,248,0},{160,253,0},{153,252,0},{144,254,0},{133,255,0},{117,255,0},{101,255,0}}},  {{/*1*/{174,174,0},{169,249,0},{161,254,0},{154,253,0},{145,255,0},{135,254,0},{119,255,0},{103,255,0}}},  {{/*1*/{175,175,0},{170,250,0},{162,255,0},{155,254,0},{147,253,0},{136,255,0},{121,254,0},{105,255,0}}},
-  {{/*1*/{176,176,0},{171,251,0},{164,250,0},{156,255,0},{148,254,0},{138,254,0},{122,255,0},{107,255,0}}},  {{/*1*/{177,177,0},{172,252,0},{165,251,0},{158,252,0},{149,255,0},{139,255,0},{124,255,0},{109,255,0}}},  {{/*1*/{178,178,0},{173,253,0},{166,252,0},{159,253,0},{151,253,0},{141,254,0},{126,254,0},{111,254,0}}},  {{/*1*/{179,179,0},{174,254,0},{167,253,0},{160,254,0},{152,254,0},{142,255,0},{127,255,0},{112,255,0}}},
-  {{/*1*/{180,180,0},{175,255,0},{168,254,0},{161,255,0},{153,255,0},{144,254,0},{129,255,0},{114,255,0}}},  {{/*1*/{181,181,0},{177,241,0},{169,255,0},{163,252,0},{155,253,0},{145,255,0},{131,255,0},{116,255,0}}},  {{/*1*/{182,182,0},{178,242,0},{171,250,0},{164,253,0},{156,254,0},{147,254,0},{133,254,0},{118,255,0}}},  {{/*1*/{183,183,0},{179,243,0},{172,251,0},{165,254,0},{157,255,0},{148,255,0},{134,255,0},{120,255,0}}},
-  {{/*1*/{184,184,0},{180,244,0},{173,252,0},{166,255,0},{159,254,0},{150,254,0},{136,255,0},{122,255,0}}},  {{/*1*/{185,185,0},{181,245,0},{174,253,0},{168,252,0},{160,255,0},{151,255,0},{138,254,0},{124,255,0}}},  {{/*1*/{186,186,0},{182,246,0},{175,254,0},{169,253,0},{162,253,0},{153,254,0},{139,255,0},{126,254,0}}},  {{/*1*/{187,187,0},{183,247,0},{176,255,0},{170,254,0},{163,254,0},{154,255,0},{141,255,0},{127,255,0}}},
-  {{/*1*/{188,188,0},{184,248,0},{178,250,0},{171,255,0},{164,255,0},{156,254,0},{143,254,0},{129,255,0}}},  {{/*1*/{189,189,0},{185,249,0},{179,251,0},{173,252,0},{166,253,0},{157,255,0},{144,255,0},{131,255,0}}},  {{/*1*/{190,190,0},{186,250,0},{180,252,0},{174,253,0},{167,254,0},{159,254,0},{146,255,0},{133,255,0}}},  {{/*1*/{191,191,0},{187,251,0},{181,253,0},{175,254,0},{168,255,0},{160,255,0},{148,254,0},{135,255,0}}},
-  {{/*1*/{192,192,0},{188,252,0},{182,254,0},{176,255,0},{170,253,0},{162,254,0},{149,255,0},{137,255,0}}},  {{/*1*/{193,193,0},{189,253,0},{183,255,0},{178,252,0},{171,254,0},{163,255,0},{151,255,0},{139,255,0}}},  {{/*1*/{194,194,0},{190,254,0},{185,249,0},{179,253,0},{172,255,0},{165,254,0},{153,254,0},{141,255,0}}},  {{/*1*/{195,195,0},{191,255,0},{186,250,0},{180,254,0},{174,254,0},{166,255,0},{154,255,0},{143,254,0}}},
-  {{/*1*/{196,196,0},{193,241,0},{187,251,0},{181,255,0},{175,255,0},{168,254,0},{156,255,0},{144,255,0}}},  {{/*1*/{197,197,0},{194,242,0},{188,252,0},{183,252,0},{177,253,0},{169,255,0},{158,254,0},{146,255,0}}},  {{/*1*/{198,198,0},{195,243,0},{189,253,0},{184,253,0},{178,254,0},{171,254,0},{159,255,0},{148,255,0}}},  {{/*1*/{199,199,0},{196,244,0},{190,254,0},{185,254,0},{179,255,0},{172,255,0},{161,255,0},{150,255,0}}},
-  {{/*1*/{200,200,0},{197,245,0},{191,255,0},{186,255,0},{181,253,0},{174,254,0},{163,255,0},{152,255,0}}},  {{/*1*/{201,201,0},{198,246,0},{193,250,0},{188,252,0},{182,254,0},{175,255,0},{165,254,0},{154,255,0}}},  {{/*1*/{202,202,0},{199,247,0},{194,251,0},{189,253,0},{183,255,0},{177,254,0},{166,255,0},{156,255,0}}},  {{/*1*/{203,203,0},{200,248,0},{195,252,0},{190,254,0},{185,253,0},{178,255,0},{168,255,0},{158,254,0}}},
-  {{/*1*/{204,204,0},{201,249,0},{196,253,0},{191,255,0},{186,254,0},{180,254,0},{170,254,0},{159,255,0}}},  {{/*1*/{205,205,0},{202,250,0},{197,254,0},{193,253,0},{187,255,0},{181,255,0},{171,255,0},{161,255,0}}},  {{/*1*/{206,206,0},{203,251,0},{198,255,0},{194,254,0},{189,253,0},{183,254,0},{173,255,0},{163,255,0}}},  {{/*1*/{207,207,0},{204,252,0},{200,250,0},{195,255,0},{190,254,0},{184,255,0},{175,254,0},{165,255,0}}},
-  {{/*1*/{208,208,0},{205,253,0},{201,251,0},{197,252,0},{191,255,0},{186,254,0},{176,255,0},{167,255,0}}},  {{/*1*/{209,209,0},{206,254,0},{202,252,0},{198,253,0},{193,254,0},{187,255,0},{178,255,0},{169,255,0}}},  {{/*1*/{210,210,0},{207,255,0},{203,253,0},{199,254,0},{194,255,0},{189,253,0},{180,254,0},{171,255,0}}},  {{/*1*/{211,211,0},{209,241,0},{204,254,0},{200,255,0},{196,253,0},{190,254,0},{181,255,0},{173,255,0}}},
-  {{/*1*/{212,212,0},{210,242,0},{205,255,0},{202,252,0},{197,254,0},{191,255,0},{183,255,0},{175,254,0}}},  {{/*1*/{213,213,0},{211,243,0},{207,250,0},{203,253,0},{198,255,0},{193,254,0},{185,254,0},{176,255,0}}},  {{/*1*/{214,214,0},{212,244,0},{208,251,0},{204,254,0},{200,253,0},{194,255,0},{186,255,0},{178,255,0}}},  {{/*1*/{215,215,0},{213,245,0},{209,252,0},{205,255,0},{201,254,0},{196,254,0},{188,255,0},{180,255,0}}},
-  {{/*1*/{216,216,0},{214,246,0},{210,253,0},{207,252,0},{202,255,0},{197,255,0},{190,254,0},{182,255,0}}},  {{/*1*/{217,217,0},{215,247,0},{211,254,0},{208,253,0},{204,253,0},{199,254,0},{191,255,0},{184,255,0}}},  {{/*1*/{218,218,0},{216,248,0},{212,255,0},{209,254,0},{205,254,0},{200,255,0},{193,255,0},{186,255,0}}},  {{/*1*/{219,219,0},{217,249,0},{214,250,0},{210,255,0},{206,255,0},{202,254,0},{195,255,0},{188,255,0}}},
-  {{/*1*/{220,220,0},{218,250,0},{215,251,0},{212,252,0},{208,254,0},{203,255,0},{197,254,0},{190,254,0}}},  {{/*1*/{221,221,0},{219,251,0},{216,252,0},{213,253,0},{209,255,0},{205,254,0},{198,255,0},{191,255,0}}},  {{/*1*/{222,222,0},{220,252,0},{217,253,0},{214,254,0},{211,253,0},{206,255,0},{200,255,0},{193,255,0}}},  {{/*1*/{223,223,0},{221,253,0},{218,254,0},{215,255,0},{212,254,0},{208,254,0},{202,254,0},{195,255,0}}},
-  {{/*1*/{224,224,0},{222,254,0},{219,255,0},{217,252,0},{213,255,0},{209,255,0},{203,255,0},{197,255,0}}},  {{/*1*/{225,225,0},{223,255,0},{221,250,0},{218,253,0},{215,253,0},{211,254,0},{205,255,0},{199,255,0}}},  {{/*1*/{226,226,0},{225,241,0},{222,251,0},{219,254,0},{216,254,0},{212,255,0},{207,254,0},{201,255,0}}},  {{/*1*/{227,227,0},{226,242,0},{223,252,0},{220,255,0},{217,255,0},{214,254,0},{208,255,0},{203,255,0}}},
-  {{/*1*/{228,228,0},{227,243,0},{224,253,0},{222,252,0},{219,253,0},{215,255,0},{210,255,0},{205,255,0}}},  {{/*1*/{229,229,0},{228,244,0},{225,254,0},{223,253,0},{220,254,0},{217,254,0},{212,254,0},{207,254,0}}},  {{/*1*/{230,230,0},{229,245,0},{226,255,0},{224,254,0},{221,255,0},{218,255,0},{213,255,0},{208,255,0}}},  {{/*1*/{231,231,0},{230,246,0},{228,250,0},{225,255,0},{223,254,0},{220,254,0},{215,255,0},{210,255,0}}},
-  {{/*1*/{232,232,0},{231,247,0},{229,251,0},{227,252,0},{224,255,0},{221,255,0},{217,254,0},{212,255,0}}},  {{/*1*/{233,233,0},{232,248,0},{230,252,0},{228,253,0},{226,253,0},{223,254,0},{218,255,0},{214,255,0}}},  {{/*1*/{234,234,0},{233,249,0},{231,253,0},{229,254,0},{227,254,0},{224,255,0},{220,255,0},{216,255,0}}},  {{/*1*/{235,235,0},{234,250,0},{232,254,0},{230,255,0},{228,255,0},{226,254,0},{222,254,0},{218,255,0}}},
-  {{/*1*/{236,236,0},{235,251,0},{233,255,0},{232,252,0},{230,253,0},{227,255,0},{223,255,0},{220,255,0}}},  {{/*1*/{237,237,0},{236,252,0},{235,250,0},{233,253,0},{231,254,0},{229,254,0},{225,255,0},{222,254,0}}},  {{/*1*/{238,238,0},{237,253,0},{236,251,0},{234,254,0},{232,255,0},{230,255,0},{227,255,0},{223,255,0}}},  {{/*1*/{239,239,0},{238,254,0},{237,252,0},{235,255,0},{234,253,0},{232,254,0},{229,254,0},{225,255,0}}},
-  {{/*1*/{240,240,0},{239,255,0},{238,253,0},{237,252,0},{235,254,0},{233,255,0},{230,255,0},{227,255,0}}},  {{/*1*/{241,241,0},{241,241,0},{239,254,0},{238,253,0},{236,255,0},{235,254,0},{232,255,0},{229,255,0}}},  {{/*1*/{242,242,0},{242,242,0},{240,255,0},{239,254,0},{238,254,0},{236,255,0},{234,254,0},{231,255,0}}},  {{/*1*/{243,243,0},{243,243,0},{242,250,0},{240,255,0},{239,255,0},{238,254,0},{235,255,0},{233,255,0}}},
-  {{/*1*/{244,244,0},{244,244,0},{243,251,0},{242,252,0},{241,253,0},{239,255,0},{237,255,0},{235,255,0}}},  {{/*1*/{245,245,0},{245,245,0},{244,252,0},{243,253,0},{242,254,0},{241,254,0},{239,254,0},{237,255,0}}},  {{/*1*/{246,246,0},{246,246,0},{245,253,0},{244,254,0},{243,255,0},{242,255,0},{240,255,0},{239,254,0}}},  {{/*1*/{247,247,0},{247,247,0},{246,254,0},{245,255,0},{245,253,0},{244,254,0},{242,255,0},{240,255,0}}},
-  {{/*1*/{248,248,0},{248,248,0},{247,255,0},{247,252,0},{246,254,0},{245,255,0},{244,254,0},{242,255,0}}},  {{/*1*/{249,249,0},{249,249,0},{249,249,0},{248,253,0},{247,255,0},{247,254,0},{245,255,0},{244,255,0}}},  {{/*1*/{250,250,0},{250,250,0},{250,250,0},{249,254,0},{249,253,0},{248,255,0},{247,255,0},{246,255,0}}},  {{/*1*/{251,251,0},{251,251,0},{251,251,0},{250,255,0},{250,254,0},{250,254,0},{249,254,0},{248,255,0}}},
-  {{/*1*/{252,252,0},{252,252,0},{252,252,0},{252,252,0},{251,255,0},{251,255,0},{250,255,0},{250,255,0}}},  {{/*1*/{253,253,0},{253,253,0},{253,253,0},{253,253,0},{253,253,0},{253,253,0},{252,255,0},{252,255,0}}},  {{/*1*/{254,254,0},{254,254,0},{254,254,0},{254,254,0},{254,254,0},{254,254,0},{254,254,0},{254,254,0}}},  {{/*1*/{255,255,0},{255,255,0},{255,255,0},{255,255,0},{255,255,0},{255,255,0},{255,255,0},{255,255,0}}}
+  {/*1*/{  0,  0,  0,  0,  0,  0,  0,  0},{  0,  0,  0,  0,  0,  0,  0,  0},{0,0,0,0,0,0,0,0}},  {/*1*/{  1,  0,  0,  0,  0,  0,  0,  0},{  1, 16,  8,  5,  4,  4,  3,  3},{0,0,0,0,0,0,0,0}},  {/*1*/{  2,  0,  0,  0,  0,  0,  0,  0},{  2, 32, 15, 10,  8,  7,  5,  5},{0,0,0,0,0,0,0,0}},  {/*1*/{  3,  0,  0,  0,  0,  0,  0,  0},{  3, 48, 22, 15, 12, 10,  8,  7},{0,0,0,0,0,0,0,0}},
+  {/*1*/{  4,  0,  0,  0,  0,  0,  0,  0},{  4, 64, 29, 20, 16, 13, 10,  9},{0,0,0,0,0,0,0,0}},  {/*1*/{  5,  0,  0,  0,  0,  0,  0,  0},{  5, 80, 36, 25, 19, 16, 13, 11},{0,0,0,0,0,0,0,0}},  {/*1*/{  6,  0,  0,  0,  0,  0,  0,  0},{  6, 96, 43, 30, 23, 19, 15, 13},{0,0,0,0,0,0,0,0}},  {/*1*/{  7,  0,  0,  0,  0,  0,  0,  0},{  7,112, 50, 35, 27, 22, 18, 15},{0,0,0,0,0,0,0,0}},
+  {/*1*/{  8,  0,  0,  0,  0,  0,  0,  0},{  8,128, 57, 40, 31, 25, 20, 18},{0,0,0,0,0,0,0,0}},  {/*1*/{  9,  0,  0,  0,  0,  0,  0,  0},{  9,144, 64, 45, 34, 28, 23, 20},{0,0,0,0,0,0,0,0}},  {/*1*/{ 10,  0,  0,  0,  0,  0,  0,  0},{ 10,160, 72, 50, 38, 31, 25, 22},{0,0,0,0,0,0,0,0}},  {/*1*/{ 11,  0,  0,  0,  0,  0,  0,  0},{ 11,176, 79, 55, 42, 34, 28, 24},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 12,  0,  0,  0,  0,  0,  0,  0},{ 12,192, 86, 60, 46, 37, 30, 26},{0,0,0,0,0,0,0,0}},  {/*1*/{ 13,  0,  0,  0,  0,  0,  0,  0},{ 13,208, 93, 64, 49, 40, 32, 28},{0,0,0,0,0,0,0,0}},  {/*1*/{ 14,  0,  0,  0,  0,  0,  0,  0},{ 14,224,100, 69, 53, 43, 35, 30},{0,0,0,0,0,0,0,0}},  {/*1*/{ 15,  0,  0,  0,  0,  0,  0,  0},{ 15,240,107, 74, 57, 46, 37, 32},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 16,  1,  0,  0,  0,  0,  0,  0},{ 16,241,114, 79, 61, 49, 40, 35},{0,0,0,0,0,0,0,0}},  {/*1*/{ 17,  2,  0,  0,  0,  0,  0,  0},{ 17,242,121, 84, 64, 52, 42, 37},{0,0,0,0,0,0,0,0}},  {/*1*/{ 18,  3,  0,  0,  0,  0,  0,  0},{ 18,243,128, 89, 68, 55, 45, 39},{0,0,0,0,0,0,0,0}},  {/*1*/{ 19,  4,  0,  0,  0,  0,  0,  0},{ 19,244,136, 94, 72, 58, 47, 41},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 20,  5,  0,  0,  0,  0,  0,  0},{ 20,245,143, 99, 76, 61, 50, 43},{0,0,0,0,0,0,0,0}},  {/*1*/{ 21,  6,  0,  0,  0,  0,  0,  0},{ 21,246,150,104, 80, 64, 52, 45},{0,0,0,0,0,0,0,0}},  {/*1*/{ 22,  7,  0,  0,  0,  0,  0,  0},{ 22,247,157,109, 83, 68, 55, 47},{0,0,0,0,0,0,0,0}},  {/*1*/{ 23,  8,  0,  0,  0,  0,  0,  0},{ 23,248,164,114, 87, 71, 57, 50},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 24,  9,  0,  0,  0,  0,  0,  0},{ 24,249,171,119, 91, 74, 60, 52},{0,0,0,0,0,0,0,0}},  {/*1*/{ 25, 10,  0,  0,  0,  0,  0,  0},{ 25,250,178,124, 95, 77, 62, 54},{0,0,0,0,0,0,0,0}},  {/*1*/{ 26, 11,  0,  0,  0,  0,  0,  0},{ 26,251,185,128, 98, 80, 64, 56},{0,0,0,0,0,0,0,0}},  {/*1*/{ 27, 12,  0,  0,  0,  0,  0,  0},{ 27,252,192,133,102, 83, 67, 58},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 28, 13,  0,  0,  0,  0,  0,  0},{ 28,253,200,138,106, 86, 69, 60},{0,0,0,0,0,0,0,0}},  {/*1*/{ 29, 14,  0,  0,  0,  0,  0,  0},{ 29,254,207,143,110, 89, 72, 62},{0,0,0,0,0,0,0,0}},  {/*1*/{ 30, 15,  0,  0,  0,  0,  0,  0},{ 30,255,214,148,113, 92, 74, 64},{0,0,0,0,0,0,0,0}},  {/*1*/{ 31, 17,  0,  0,  0,  0,  0,  0},{ 31,241,221,153,117, 95, 77, 67},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 32, 18,  0,  0,  0,  0,  0,  0},{ 32,242,228,158,121, 98, 79, 69},{0,0,0,0,0,0,0,0}},  {/*1*/{ 33, 19,  0,  0,  0,  0,  0,  0},{ 33,243,235,163,125,101, 82, 71},{0,0,0,0,0,0,0,0}},  {/*1*/{ 34, 20,  0,  0,  0,  0,  0,  0},{ 34,244,242,168,128,104, 84, 73},{0,0,0,0,0,0,0,0}},  {/*1*/{ 35, 21,  0,  0,  0,  0,  0,  0},{ 35,245,249,173,132,107, 87, 75},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 36, 22,  1,  0,  0,  0,  0,  0},{ 36,246,250,178,136,110, 89, 77},{0,0,0,0,0,0,0,0}},  {/*1*/{ 37, 23,  2,  0,  0,  0,  0,  0},{ 37,247,251,183,140,113, 92, 79},{0,0,0,0,0,0,0,0}},  {/*1*/{ 38, 24,  3,  0,  0,  0,  0,  0},{ 38,248,252,188,144,116, 94, 82},{0,0,0,0,0,0,0,0}},  {/*1*/{ 39, 25,  4,  0,  0,  0,  0,  0},{ 39,249,253,192,147,119, 96, 84},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 40, 26,  5,  0,  0,  0,  0,  0},{ 40,250,254,197,151,122, 99, 86},{0,0,0,0,0,0,0,0}},  {/*1*/{ 41, 27,  6,  0,  0,  0,  0,  0},{ 41,251,255,202,155,125,101, 88},{0,0,0,0,0,0,0,0}},  {/*1*/{ 42, 28,  8,  0,  0,  0,  0,  0},{ 42,252,250,207,159,128,104, 90},{0,0,0,0,0,0,0,0}},  {/*1*/{ 43, 29,  9,  0,  0,  0,  0,  0},{ 43,253,251,212,162,132,106, 92},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 44, 30, 10,  0,  0,  0,  0,  0},{ 44,254,252,217,166,135,109, 94},{0,0,0,0,0,0,0,0}},  {/*1*/{ 45, 31, 11,  0,  0,  0,  0,  0},{ 45,255,253,222,170,138,111, 96},{0,0,0,0,0,0,0,0}},  {/*1*/{ 46, 33, 12,  0,  0,  0,  0,  0},{ 46,241,254,227,174,141,114, 99},{0,0,0,0,0,0,0,0}},  {/*1*/{ 47, 34, 13,  0,  0,  0,  0,  0},{ 47,242,255,232,177,144,116,101},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 48, 35, 15,  0,  0,  0,  0,  0},{ 48,243,250,237,181,147,119,103},{0,0,0,0,0,0,0,0}},  {/*1*/{ 49, 36, 16,  0,  0,  0,  0,  0},{ 49,244,251,242,185,150,121,105},{0,0,0,0,0,0,0,0}},  {/*1*/{ 50, 37, 17,  0,  0,  0,  0,  0},{ 50,245,252,247,189,153,124,107},{0,0,0,0,0,0,0,0}},  {/*1*/{ 51, 38, 18,  0,  0,  0,  0,  0},{ 51,246,253,252,192,156,126,109},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 52, 39, 19,  1,  0,  0,  0,  0},{ 52,247,254,253,196,159,128,111},{0,0,0,0,0,0,0,0}},  {/*1*/{ 53, 40, 20,  2,  0,  0,  0,  0},{ 53,248,255,254,200,162,131,114},{0,0,0,0,0,0,0,0}},  {/*1*/{ 54, 41, 22,  3,  0,  0,  0,  0},{ 54,249,250,255,204,165,133,116},{0,0,0,0,0,0,0,0}},  {/*1*/{ 55, 42, 23,  5,  0,  0,  0,  0},{ 55,250,251,252,208,168,136,118},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 56, 43, 24,  6,  0,  0,  0,  0},{ 56,251,252,253,211,171,138,120},{0,0,0,0,0,0,0,0}},  {/*1*/{ 57, 44, 25,  7,  0,  0,  0,  0},{ 57,252,253,254,215,174,141,122},{0,0,0,0,0,0,0,0}},  {/*1*/{ 58, 45, 26,  8,  0,  0,  0,  0},{ 58,253,254,255,219,177,143,124},{0,0,0,0,0,0,0,0}},  {/*1*/{ 59, 46, 27, 10,  0,  0,  0,  0},{ 59,254,255,252,223,180,146,126},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 60, 47, 29, 11,  0,  0,  0,  0},{ 60,255,250,253,226,183,148,128},{0,0,0,0,0,0,0,0}},  {/*1*/{ 61, 49, 30, 12,  0,  0,  0,  0},{ 61,241,251,254,230,186,151,131},{0,0,0,0,0,0,0,0}},  {/*1*/{ 62, 50, 31, 13,  0,  0,  0,  0},{ 62,242,252,255,234,189,153,133},{0,0,0,0,0,0,0,0}},  {/*1*/{ 63, 51, 32, 15,  0,  0,  0,  0},{ 63,243,253,252,238,192,156,135},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 64, 52, 33, 16,  0,  0,  0,  0},{ 64,244,254,253,241,196,158,137},{0,0,0,0,0,0,0,0}},  {/*1*/{ 65, 53, 34, 17,  0,  0,  0,  0},{ 65,245,255,254,245,199,160,139},{0,0,0,0,0,0,0,0}},  {/*1*/{ 66, 54, 36, 18,  0,  0,  0,  0},{ 66,246,250,255,249,202,163,141},{0,0,0,0,0,0,0,0}},  {/*1*/{ 67, 55, 37, 20,  0,  0,  0,  0},{ 67,247,251,252,253,205,165,143},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 68, 56, 38, 21,  1,  0,  0,  0},{ 68,248,252,253,254,208,168,146},{0,0,0,0,0,0,0,0}},  {/*1*/{ 69, 57, 39, 22,  2,  0,  0,  0},{ 69,249,253,254,255,211,170,148},{0,0,0,0,0,0,0,0}},  {/*1*/{ 70, 58, 40, 23,  4,  0,  0,  0},{ 70,250,254,255,253,214,173,150},{0,0,0,0,0,0,0,0}},  {/*1*/{ 71, 59, 41, 25,  5,  0,  0,  0},{ 71,251,255,252,254,217,175,152},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 72, 60, 43, 26,  6,  0,  0,  0},{ 72,252,250,253,255,220,178,154},{0,0,0,0,0,0,0,0}},  {/*1*/{ 73, 61, 44, 27,  8,  0,  0,  0},{ 73,253,251,254,253,223,180,156},{0,0,0,0,0,0,0,0}},  {/*1*/{ 74, 62, 45, 28,  9,  0,  0,  0},{ 74,254,252,255,254,226,183,158},{0,0,0,0,0,0,0,0}},  {/*1*/{ 75, 63, 46, 30, 10,  0,  0,  0},{ 75,255,253,252,255,229,185,160},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 76, 65, 47, 31, 12,  0,  0,  0},{ 76,241,254,253,253,232,188,163},{0,0,0,0,0,0,0,0}},  {/*1*/{ 77, 66, 48, 32, 13,  0,  0,  0},{ 77,242,255,254,254,235,190,165},{0,0,0,0,0,0,0,0}},  {/*1*/{ 78, 67, 50, 33, 14,  0,  0,  0},{ 78,243,250,255,255,238,192,167},{0,0,0,0,0,0,0,0}},  {/*1*/{ 79, 68, 51, 35, 16,  0,  0,  0},{ 79,244,251,252,254,241,195,169},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 80, 69, 52, 36, 17,  0,  0,  0},{ 80,245,252,253,255,244,197,171},{0,0,0,0,0,0,0,0}},  {/*1*/{ 81, 70, 53, 37, 19,  0,  0,  0},{ 81,246,253,254,253,247,200,173},{0,0,0,0,0,0,0,0}},  {/*1*/{ 82, 71, 54, 38, 20,  0,  0,  0},{ 82,247,254,255,254,250,202,175},{0,0,0,0,0,0,0,0}},  {/*1*/{ 83, 72, 55, 40, 21,  0,  0,  0},{ 83,248,255,252,255,253,205,178},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 84, 73, 57, 41, 23,  1,  0,  0},{ 84,249,249,253,253,254,207,180},{0,0,0,0,0,0,0,0}},  {/*1*/{ 85, 74, 58, 42, 24,  2,  0,  0},{ 85,250,250,254,254,255,210,182},{0,0,0,0,0,0,0,0}},  {/*1*/{ 86, 75, 59, 43, 25,  4,  0,  0},{ 86,251,251,255,255,254,212,184},{0,0,0,0,0,0,0,0}},  {/*1*/{ 87, 76, 60, 45, 27,  5,  0,  0},{ 87,252,252,252,253,255,215,186},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 88, 77, 61, 46, 28,  7,  0,  0},{ 88,253,253,253,254,254,217,188},{0,0,0,0,0,0,0,0}},  {/*1*/{ 89, 78, 62, 47, 29,  8,  0,  0},{ 89,254,254,254,255,255,220,190},{0,0,0,0,0,0,0,0}},  {/*1*/{ 90, 79, 63, 48, 31, 10,  0,  0},{ 90,255,255,255,254,254,222,192},{0,0,0,0,0,0,0,0}},  {/*1*/{ 91, 81, 65, 50, 32, 11,  0,  0},{ 91,241,250,252,255,255,224,195},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 92, 82, 66, 51, 34, 13,  0,  0},{ 92,242,251,253,253,254,227,197},{0,0,0,0,0,0,0,0}},  {/*1*/{ 93, 83, 67, 52, 35, 14,  0,  0},{ 93,243,252,254,254,255,229,199},{0,0,0,0,0,0,0,0}},  {/*1*/{ 94, 84, 68, 53, 36, 16,  0,  0},{ 94,244,253,255,255,254,232,201},{0,0,0,0,0,0,0,0}},  {/*1*/{ 95, 85, 69, 55, 38, 17,  0,  0},{ 95,245,254,252,253,255,234,203},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 96, 86, 70, 56, 39, 19,  0,  0},{ 96,246,255,253,254,254,237,205},{0,0,0,0,0,0,0,0}},  {/*1*/{ 97, 87, 72, 57, 40, 20,  0,  0},{ 97,247,250,254,255,255,239,207},{0,0,0,0,0,0,0,0}},  {/*1*/{ 98, 88, 73, 58, 42, 22,  0,  0},{ 98,248,251,255,253,254,242,210},{0,0,0,0,0,0,0,0}},  {/*1*/{ 99, 89, 74, 60, 43, 23,  0,  0},{ 99,249,252,252,254,255,244,212},{0,0,0,0,0,0,0,0}},
+  {/*1*/{100, 90, 75, 61, 44, 25,  0,  0},{100,250,253,253,255,254,247,214},{0,0,0,0,0,0,0,0}},  {/*1*/{101, 91, 76, 62, 46, 26,  0,  0},{101,251,254,254,254,255,249,216},{0,0,0,0,0,0,0,0}},  {/*1*/{102, 92, 77, 63, 47, 28,  0,  0},{102,252,255,255,255,254,252,218},{0,0,0,0,0,0,0,0}},  {/*1*/{103, 93, 79, 65, 49, 29,  0,  0},{103,253,250,253,253,255,254,220},{0,0,0,0,0,0,0,0}},
+  {/*1*/{104, 94, 80, 66, 50, 31,  1,  0},{104,254,251,254,254,254,255,222},{0,0,0,0,0,0,0,0}},  {/*1*/{105, 95, 81, 67, 51, 32,  3,  0},{105,255,252,255,255,255,255,224},{0,0,0,0,0,0,0,0}},  {/*1*/{106, 97, 82, 69, 53, 34,  5,  0},{106,241,253,252,253,254,254,227},{0,0,0,0,0,0,0,0}},  {/*1*/{107, 98, 83, 70, 54, 35,  6,  0},{107,242,254,253,254,255,255,229},{0,0,0,0,0,0,0,0}},
+  {/*1*/{108, 99, 84, 71, 55, 37,  8,  0},{108,243,255,254,255,254,255,231},{0,0,0,0,0,0,0,0}},  {/*1*/{109,100, 86, 72, 57, 38, 10,  0},{109,244,250,255,253,255,254,233},{0,0,0,0,0,0,0,0}},  {/*1*/{110,101, 87, 74, 58, 40, 11,  0},{110,245,251,252,254,254,255,235},{0,0,0,0,0,0,0,0}},  {/*1*/{111,102, 88, 75, 59, 41, 13,  0},{111,246,252,253,255,255,255,237},{0,0,0,0,0,0,0,0}},
+  {/*1*/{112,103, 89, 76, 61, 43, 15,  0},{112,247,253,254,253,254,254,239},{0,0,0,0,0,0,0,0}},  {/*1*/{113,104, 90, 77, 62, 44, 16,  0},{113,248,254,255,254,255,255,242},{0,0,0,0,0,0,0,0}},  {/*1*/{114,105, 91, 79, 63, 46, 18,  0},{114,249,255,252,255,254,255,244},{0,0,0,0,0,0,0,0}},  {/*1*/{115,106, 93, 80, 65, 47, 20,  0},{115,250,250,253,254,255,254,246},{0,0,0,0,0,0,0,0}},
+  {/*1*/{116,107, 94, 81, 66, 49, 21,  0},{116,251,251,254,255,254,255,248},{0,0,0,0,0,0,0,0}},  {/*1*/{117,108, 95, 82, 68, 50, 23,  0},{117,252,252,255,253,255,255,250},{0,0,0,0,0,0,0,0}},  {/*1*/{118,109, 96, 84, 69, 52, 25,  0},{118,253,253,252,254,254,254,252},{0,0,0,0,0,0,0,0}},  {/*1*/{119,110, 97, 85, 70, 53, 26,  0},{119,254,254,253,255,255,255,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{120,111, 98, 86, 72, 55, 28,  1},{120,255,255,254,253,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{121,113,100, 87, 73, 56, 30,  3},{121,241,250,255,254,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{122,114,101, 89, 74, 58, 31,  5},{122,242,251,252,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{123,115,102, 90, 76, 59, 33,  7},{123,243,252,253,253,255,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{124,116,103, 91, 77, 61, 35,  9},{124,244,253,254,254,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{125,117,104, 92, 78, 62, 37, 11},{125,245,254,255,255,254,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{126,118,105, 94, 80, 63, 38, 13},{126,246,255,252,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{127,119,107, 95, 81, 65, 40, 15},{127,247,250,253,255,254,255,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{128,120,108, 96, 83, 66, 42, 16},{128,248,251,254,253,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{129,121,109, 97, 84, 68, 43, 18},{129,249,252,255,254,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{130,122,110, 99, 85, 69, 45, 20},{130,250,253,252,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{131,123,111,100, 87, 71, 47, 22},{131,251,254,253,253,254,254,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{132,124,112,101, 88, 72, 48, 24},{132,252,255,254,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{133,125,114,102, 89, 74, 50, 26},{133,253,250,255,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{134,126,115,104, 91, 75, 52, 28},{134,254,251,252,253,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{135,127,116,105, 92, 77, 53, 30},{135,255,252,253,254,254,255,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{136,129,117,106, 93, 78, 55, 31},{136,241,253,254,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{137,130,118,107, 95, 80, 57, 33},{137,242,254,255,254,254,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{138,131,119,109, 96, 81, 58, 35},{138,243,255,252,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{139,132,121,110, 98, 83, 60, 37},{139,244,249,253,253,254,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{140,133,122,111, 99, 84, 62, 39},{140,245,250,254,254,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{141,134,123,112,100, 86, 63, 41},{141,246,251,255,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{142,135,124,114,102, 87, 65, 43},{142,247,252,252,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{143,136,125,115,103, 89, 67, 45},{143,248,253,253,254,254,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{144,137,126,116,104, 90, 69, 47},{144,249,254,254,255,255,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{145,138,127,117,106, 92, 70, 48},{145,250,255,255,253,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{146,139,129,119,107, 93, 72, 50},{146,251,250,252,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{147,140,130,120,108, 95, 74, 52},{147,252,251,253,255,254,254,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{148,141,131,121,110, 96, 75, 54},{148,253,252,254,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{149,142,132,122,111, 98, 77, 56},{149,254,253,255,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{150,143,133,124,113, 99, 79, 58},{150,255,254,252,253,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{151,145,134,125,114,101, 80, 60},{151,241,255,253,254,254,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{152,146,136,126,115,102, 82, 62},{152,242,250,254,255,255,255,254},{0,0,0,0,0,0,0,0}},  {/*1*/{153,147,137,127,117,104, 84, 63},{153,243,251,255,253,254,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{154,148,138,129,118,105, 85, 65},{154,244,252,253,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{155,149,139,130,119,107, 87, 67},{155,245,253,254,255,254,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{156,150,140,131,121,108, 89, 69},{156,246,254,255,253,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{157,151,141,133,122,110, 90, 71},{157,247,255,252,254,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{158,152,143,134,123,111, 92, 73},{158,248,250,253,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{159,153,144,135,125,113, 94, 75},{159,249,251,254,253,254,254,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{160,154,145,136,126,114, 95, 77},{160,250,252,255,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{161,155,146,138,127,116, 97, 79},{161,251,253,252,255,254,255,254},{0,0,0,0,0,0,0,0}},  {/*1*/{162,156,147,139,129,117, 99, 80},{162,252,254,253,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{163,157,148,140,130,119,101, 82},{163,253,255,254,255,254,254,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{164,158,150,141,132,120,102, 84},{164,254,250,255,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{165,159,151,143,133,122,104, 86},{165,255,251,252,254,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{166,161,152,144,134,123,106, 88},{166,241,252,253,255,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{167,162,153,145,136,125,107, 90},{167,242,253,254,253,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{168,163,154,146,137,126,109, 92},{168,243,254,255,254,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{169,164,155,148,138,127,111, 94},{169,244,255,252,255,255,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{170,165,157,149,140,129,112, 95},{170,245,250,253,253,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{171,166,158,150,141,130,114, 97},{171,246,251,254,254,255,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{172,167,159,151,142,132,116, 99},{172,247,252,255,255,254,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{173,168,160,153,144,133,117,101},{173,248,253,252,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{174,169,161,154,145,135,119,103},{174,249,254,253,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{175,170,162,155,147,136,121,105},{175,250,255,254,253,255,254,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{176,171,164,156,148,138,122,107},{176,251,250,255,254,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{177,172,165,158,149,139,124,109},{177,252,251,252,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{178,173,166,159,151,141,126,111},{178,253,252,253,253,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{179,174,167,160,152,142,127,112},{179,254,253,254,254,255,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{180,175,168,161,153,144,129,114},{180,255,254,255,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{181,177,169,163,155,145,131,116},{181,241,255,252,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{182,178,171,164,156,147,133,118},{182,242,250,253,254,254,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{183,179,172,165,157,148,134,120},{183,243,251,254,255,255,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{184,180,173,166,159,150,136,122},{184,244,252,255,254,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{185,181,174,168,160,151,138,124},{185,245,253,252,255,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{186,182,175,169,162,153,139,126},{186,246,254,253,253,254,255,254},{0,0,0,0,0,0,0,0}},  {/*1*/{187,183,176,170,163,154,141,127},{187,247,255,254,254,255,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{188,184,178,171,164,156,143,129},{188,248,250,255,255,254,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{189,185,179,173,166,157,144,131},{189,249,251,252,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{190,186,180,174,167,159,146,133},{190,250,252,253,254,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{191,187,181,175,168,160,148,135},{191,251,253,254,255,255,254,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{192,188,182,176,170,162,149,137},{192,252,254,255,253,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{193,189,183,178,171,163,151,139},{193,253,255,252,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{194,190,185,179,172,165,153,141},{194,254,249,253,255,254,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{195,191,186,180,174,166,154,143},{195,255,250,254,254,255,255,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{196,193,187,181,175,168,156,144},{196,241,251,255,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{197,194,188,183,177,169,158,146},{197,242,252,252,253,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{198,195,189,184,178,171,159,148},{198,243,253,253,254,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{199,196,190,185,179,172,161,150},{199,244,254,254,255,255,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{200,197,191,186,181,174,163,152},{200,245,255,255,253,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{201,198,193,188,182,175,165,154},{201,246,250,252,254,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{202,199,194,189,183,177,166,156},{202,247,251,253,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{203,200,195,190,185,178,168,158},{203,248,252,254,253,255,255,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{204,201,196,191,186,180,170,159},{204,249,253,255,254,254,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{205,202,197,193,187,181,171,161},{205,250,254,253,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{206,203,198,194,189,183,173,163},{206,251,255,254,253,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{207,204,200,195,190,184,175,165},{207,252,250,255,254,255,254,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{208,205,201,197,191,186,176,167},{208,253,251,252,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{209,206,202,198,193,187,178,169},{209,254,252,253,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{210,207,203,199,194,189,180,171},{210,255,253,254,255,253,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{211,209,204,200,196,190,181,173},{211,241,254,255,253,254,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{212,210,205,202,197,191,183,175},{212,242,255,252,254,255,255,254},{0,0,0,0,0,0,0,0}},  {/*1*/{213,211,207,203,198,193,185,176},{213,243,250,253,255,254,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{214,212,208,204,200,194,186,178},{214,244,251,254,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{215,213,209,205,201,196,188,180},{215,245,252,255,254,254,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{216,214,210,207,202,197,190,182},{216,246,253,252,255,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{217,215,211,208,204,199,191,184},{217,247,254,253,253,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{218,216,212,209,205,200,193,186},{218,248,255,254,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{219,217,214,210,206,202,195,188},{219,249,250,255,255,254,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{220,218,215,212,208,203,197,190},{220,250,251,252,254,255,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{221,219,216,213,209,205,198,191},{221,251,252,253,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{222,220,217,214,211,206,200,193},{222,252,253,254,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{223,221,218,215,212,208,202,195},{223,253,254,255,254,254,254,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{224,222,219,217,213,209,203,197},{224,254,255,252,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{225,223,221,218,215,211,205,199},{225,255,250,253,253,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{226,225,222,219,216,212,207,201},{226,241,251,254,254,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{227,226,223,220,217,214,208,203},{227,242,252,255,255,254,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{228,227,224,222,219,215,210,205},{228,243,253,252,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{229,228,225,223,220,217,212,207},{229,244,254,253,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{230,229,226,224,221,218,213,208},{230,245,255,254,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{231,230,228,225,223,220,215,210},{231,246,250,255,254,254,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{232,231,229,227,224,221,217,212},{232,247,251,252,255,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{233,232,230,228,226,223,218,214},{233,248,252,253,253,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{234,233,231,229,227,224,220,216},{234,249,253,254,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{235,234,232,230,228,226,222,218},{235,250,254,255,255,254,254,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{236,235,233,232,230,227,223,220},{236,251,255,252,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{237,236,235,233,231,229,225,222},{237,252,250,253,254,254,255,254},{0,0,0,0,0,0,0,0}},  {/*1*/{238,237,236,234,232,230,227,223},{238,253,251,254,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{239,238,237,235,234,232,229,225},{239,254,252,255,253,254,254,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{240,239,238,237,235,233,230,227},{240,255,253,252,254,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{241,241,239,238,236,235,232,229},{241,241,254,253,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{242,242,240,239,238,236,234,231},{242,242,255,254,254,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{243,243,242,240,239,238,235,233},{243,243,250,255,255,254,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{244,244,243,242,241,239,237,235},{244,244,251,252,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{245,245,244,243,242,241,239,237},{245,245,252,253,254,254,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{246,246,245,244,243,242,240,239},{246,246,253,254,255,255,255,254},{0,0,0,0,0,0,0,0}},  {/*1*/{247,247,246,245,245,244,242,240},{247,247,254,255,253,254,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{248,248,247,247,246,245,244,242},{248,248,255,252,254,255,254,255},{0,0,0,0,0,0,0,0}},  {/*1*/{249,249,249,248,247,247,245,244},{249,249,249,253,255,254,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{250,250,250,249,249,248,247,246},{250,250,250,254,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{251,251,251,250,250,250,249,248},{251,251,251,255,254,254,254,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{252,252,252,252,251,251,250,250},{252,252,252,252,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{253,253,253,253,253,253,252,252},{253,253,253,253,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{254,254,254,254,254,254,254,254},{254,254,254,254,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{255,255,255,255,255,255,255,255},{255,255,255,255,255,255,255,255},{0,0,0,0,0,0,0,0}}
 };
 
 /* 256 * 2 * 3 * 4 = 6144 */
 static PaletteSingleLookup2 const sp_lookup_5u1_4[4][256] =
 {
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  0,  0,1},{  0,  0,1}}},  {{/*1*/{  0,  0,2},{  0,  8,0}}},  {{/*1*/{  0,  0,3},{  0,  8,1}}},
-  {{/*1*/{  0,  0,4},{  0, 16,1}}},  {{/*1*/{  8,  8,3},{  0, 16,0}}},  {{/*1*/{  8,  8,2},{  0, 16,1}}},  {{/*1*/{  8,  8,1},{  0, 24,0}}},
-  {{/*1*/{  8,  8,0},{  8,  8,0}}},  {{/*1*/{  8,  8,1},{  0, 32,1}}},  {{/*1*/{  8,  8,2},{  0, 32,0}}},  {{/*1*/{  8,  8,3},{  0, 32,1}}},
-  {{/*1*/{  8,  8,4},{  0, 40,1}}},  {{/*1*/{ 16, 16,3},{  0, 40,0}}},  {{/*1*/{ 16, 16,2},{  0, 40,1}}},  {{/*1*/{ 16, 16,1},{  0, 48,0}}},
-  {{/*1*/{ 16, 16,0},{ 16, 16,0}}},  {{/*1*/{ 16, 16,1},{  0, 56,1}}},  {{/*1*/{ 16, 16,2},{  0, 56,0}}},  {{/*1*/{ 16, 16,3},{  0, 56,1}}},
-  {{/*1*/{ 16, 16,4},{  0, 65,1}}},  {{/*1*/{ 24, 24,3},{  0, 65,0}}},  {{/*1*/{ 24, 24,2},{  0, 65,1}}},  {{/*1*/{ 24, 24,1},{  0, 73,0}}},
-  {{/*1*/{ 24, 24,0},{ 24, 24,0}}},  {{/*1*/{ 24, 24,1},{  0, 81,1}}},  {{/*1*/{ 24, 24,2},{  0, 81,0}}},  {{/*1*/{ 24, 24,3},{  0, 81,1}}},
-  {{/*1*/{ 24, 24,4},{  0, 89,1}}},  {{/*1*/{ 32, 32,3},{  0, 89,0}}},  {{/*1*/{ 32, 32,2},{  0, 89,1}}},  {{/*1*/{ 32, 32,1},{  0, 97,0}}},
-  {{/*1*/{ 32, 32,0},{ 16, 65,0}}},  {{/*1*/{ 32, 32,1},{  0,105,1}}},  {{/*1*/{ 32, 32,2},{  0,105,0}}},  {{/*1*/{ 32, 32,3},{  0,105,1}}},
-  {{/*1*/{ 32, 32,4},{  0,113,1}}},  {{/*1*/{ 40, 40,3},{  0,113,0}}},  {{/*1*/{ 40, 40,2},{  0,113,1}}},  {{/*1*/{ 40, 40,1},{  0,121,0}}},
-  {{/*1*/{ 40, 40,0},{ 24, 73,0}}},  {{/*1*/{ 40, 40,1},{  0,130,1}}},  {{/*1*/{ 40, 40,2},{  0,130,0}}},  {{/*1*/{ 40, 40,3},{ 65,  0,0}}},
-  {{/*1*/{ 40, 40,4},{  0,138,1}}},  {{/*1*/{ 48, 48,3},{  0,138,0}}},  {{/*1*/{ 48, 48,2},{ 65,  8,0}}},  {{/*1*/{ 48, 48,1},{  0,146,0}}},
-  {{/*1*/{ 48, 48,0},{  8,130,0}}},  {{/*1*/{ 48, 48,1},{ 73,  0,0}}},  {{/*1*/{ 48, 48,2},{  0,154,0}}},  {{/*1*/{ 48, 48,3},{ 65, 24,0}}},
-  {{/*1*/{ 48, 48,4},{  0,162,1}}},  {{/*1*/{ 56, 56,3},{  0,162,0}}},  {{/*1*/{ 56, 56,2},{ 65, 32,0}}},  {{/*1*/{ 56, 56,1},{  0,170,0}}},
-  {{/*1*/{ 56, 56,0},{ 16,138,0}}},  {{/*1*/{ 56, 56,1},{ 81,  8,0}}},  {{/*1*/{ 56, 56,2},{  0,178,0}}},  {{/*1*/{ 56, 56,3},{ 65, 48,0}}},
-  {{/*1*/{ 56, 56,4},{  0,186,1}}},  {{/*1*/{ 65, 65,4},{  0,186,0}}},  {{/*1*/{ 65, 65,3},{ 65, 56,0}}},  {{/*1*/{ 65, 65,2},{  0,195,0}}},
-  {{/*1*/{ 65, 65,1},{ 24,146,0}}},  {{/*1*/{ 65, 65,0},{ 65, 65,0}}},  {{/*1*/{ 65, 65,1},{  0,203,0}}},  {{/*1*/{ 65, 65,2},{ 65, 73,0}}},
-  {{/*1*/{ 65, 65,3},{  0,211,1}}},  {{/*1*/{ 65, 65,4},{  0,211,0}}},  {{/*1*/{ 73, 73,3},{ 65, 81,0}}},  {{/*1*/{ 73, 73,2},{  0,219,0}}},
-  {{/*1*/{ 73, 73,1},{ 32,154,0}}},  {{/*1*/{ 73, 73,0},{ 73, 73,0}}},  {{/*1*/{ 73, 73,1},{  0,227,0}}},  {{/*1*/{ 73, 73,2},{ 65, 97,0}}},
-  {{/*1*/{ 73, 73,3},{  0,235,1}}},  {{/*1*/{ 73, 73,4},{  0,235,0}}},  {{/*1*/{ 81, 81,3},{ 65,105,0}}},  {{/*1*/{ 81, 81,2},{  0,243,0}}},
-  {{/*1*/{ 81, 81,1},{ 24,195,0}}},  {{/*1*/{ 81, 81,0},{ 81, 81,0}}},  {{/*1*/{ 81, 81,1},{  0,251,0}}},  {{/*1*/{ 81, 81,2},{ 65,121,0}}},
-  {{/*1*/{ 81, 81,3},{  8,243,1}}},  {{/*1*/{ 81, 81,4},{  8,243,0}}},  {{/*1*/{ 89, 89,3},{ 65,130,0}}},  {{/*1*/{ 89, 89,2},{  8,251,0}}},
-  {{/*1*/{ 89, 89,1},{ 32,203,0}}},  {{/*1*/{ 89, 89,0},{ 89, 89,0}}},  {{/*1*/{ 89, 89,1},{ 16,243,0}}},  {{/*1*/{ 89, 89,2},{ 65,146,0}}},
-  {{/*1*/{ 89, 89,3},{130, 16,0}}},  {{/*1*/{ 89, 89,4},{ 16,251,0}}},  {{/*1*/{ 97, 97,3},{ 65,154,0}}},  {{/*1*/{ 97, 97,2},{ 24,243,0}}},
-  {{/*1*/{ 97, 97,1},{ 40,211,0}}},  {{/*1*/{ 97, 97,0},{ 81,130,0}}},  {{/*1*/{ 97, 97,1},{ 24,251,0}}},  {{/*1*/{ 97, 97,2},{ 65,170,0}}},
-  {{/*1*/{ 97, 97,3},{130, 40,0}}},  {{/*1*/{ 97, 97,4},{ 32,243,0}}},  {{/*1*/{105,105,3},{ 65,178,0}}},  {{/*1*/{105,105,2},{ 32,251,0}}},
-  {{/*1*/{105,105,1},{ 48,219,0}}},  {{/*1*/{105,105,0},{ 89,138,0}}},  {{/*1*/{105,105,1},{ 40,243,0}}},  {{/*1*/{105,105,2},{ 65,195,0}}},
-  {{/*1*/{105,105,3},{130, 65,0}}},  {{/*1*/{105,105,4},{ 40,251,0}}},  {{/*1*/{113,113,3},{ 65,203,0}}},  {{/*1*/{113,113,2},{ 48,243,0}}},
-  {{/*1*/{113,113,1},{ 56,227,0}}},  {{/*1*/{113,113,0},{ 73,195,0}}},  {{/*1*/{113,113,1},{ 48,251,0}}},  {{/*1*/{113,113,2},{ 65,219,0}}},
-  {{/*1*/{113,113,3},{130, 89,0}}},  {{/*1*/{113,113,4},{ 56,243,0}}},  {{/*1*/{121,121,3},{ 65,227,0}}},  {{/*1*/{121,121,2},{ 56,251,0}}},
-  {{/*1*/{121,121,1},{ 65,235,0}}},  {{/*1*/{121,121,0},{ 81,203,0}}},  {{/*1*/{121,121,1},{146, 73,0}}},  {{/*1*/{121,121,2},{ 65,243,0}}},
-  {{/*1*/{121,121,3},{130,113,0}}},  {{/*1*/{121,121,4},{ 65,251,1}}},  {{/*1*/{130,130,4},{ 65,251,0}}},  {{/*1*/{130,130,3},{130,121,0}}},
-  {{/*1*/{130,130,2},{ 73,243,0}}},  {{/*1*/{130,130,1},{ 89,211,0}}},  {{/*1*/{130,130,0},{130,130,0}}},  {{/*1*/{130,130,1},{ 73,251,0}}},
-  {{/*1*/{130,130,2},{130,138,0}}},  {{/*1*/{130,130,3},{195,  8,0}}},  {{/*1*/{130,130,4},{ 81,243,0}}},  {{/*1*/{138,138,3},{130,146,0}}},
-  {{/*1*/{138,138,2},{ 81,251,0}}},  {{/*1*/{138,138,1},{ 97,219,0}}},  {{/*1*/{138,138,0},{138,138,0}}},  {{/*1*/{138,138,1},{ 89,243,0}}},
-  {{/*1*/{138,138,2},{130,162,0}}},  {{/*1*/{138,138,3},{195, 32,0}}},  {{/*1*/{138,138,4},{ 89,251,0}}},  {{/*1*/{146,146,3},{130,170,0}}},
-  {{/*1*/{146,146,2},{ 97,243,0}}},  {{/*1*/{146,146,1},{105,227,0}}},  {{/*1*/{146,146,0},{146,146,0}}},  {{/*1*/{146,146,1},{ 97,251,0}}},
-  {{/*1*/{146,146,2},{130,186,0}}},  {{/*1*/{146,146,3},{195, 56,0}}},  {{/*1*/{146,146,4},{105,243,0}}},  {{/*1*/{154,154,3},{130,195,0}}},
-  {{/*1*/{154,154,2},{105,251,0}}},  {{/*1*/{154,154,1},{113,235,0}}},  {{/*1*/{154,154,0},{154,154,0}}},  {{/*1*/{154,154,1},{113,243,0}}},
-  {{/*1*/{154,154,2},{130,211,0}}},  {{/*1*/{154,154,3},{195, 81,0}}},  {{/*1*/{154,154,4},{113,251,0}}},  {{/*1*/{162,162,3},{130,219,0}}},
-  {{/*1*/{162,162,2},{195, 89,0}}},  {{/*1*/{162,162,1},{121,243,0}}},  {{/*1*/{162,162,0},{146,195,0}}},  {{/*1*/{162,162,1},{121,251,0}}},
-  {{/*1*/{162,162,2},{130,235,0}}},  {{/*1*/{162,162,3},{195,105,0}}},  {{/*1*/{162,162,4},{130,243,1}}},  {{/*1*/{170,170,3},{130,243,0}}},
-  {{/*1*/{170,170,2},{195,113,0}}},  {{/*1*/{170,170,1},{130,251,0}}},  {{/*1*/{170,170,0},{154,203,0}}},  {{/*1*/{170,170,1},{219, 73,0}}},
-  {{/*1*/{170,170,2},{138,243,0}}},  {{/*1*/{170,170,3},{195,130,0}}},  {{/*1*/{170,170,4},{138,251,1}}},  {{/*1*/{178,178,3},{138,251,0}}},
-  {{/*1*/{178,178,2},{195,138,0}}},  {{/*1*/{178,178,1},{146,243,0}}},  {{/*1*/{178,178,0},{162,211,0}}},  {{/*1*/{178,178,1},{203,130,0}}},
-  {{/*1*/{178,178,2},{146,251,0}}},  {{/*1*/{178,178,3},{195,154,0}}},  {{/*1*/{178,178,4},{154,243,1}}},  {{/*1*/{186,186,3},{154,243,0}}},
-  {{/*1*/{186,186,2},{195,162,0}}},  {{/*1*/{186,186,1},{154,251,0}}},  {{/*1*/{186,186,0},{170,219,0}}},  {{/*1*/{186,186,1},{211,138,0}}},
-  {{/*1*/{186,186,2},{162,243,0}}},  {{/*1*/{186,186,3},{195,178,0}}},  {{/*1*/{186,186,4},{162,251,1}}},  {{/*1*/{195,195,4},{162,251,0}}},
-  {{/*1*/{195,195,3},{195,186,0}}},  {{/*1*/{195,195,2},{170,243,0}}},  {{/*1*/{195,195,1},{178,227,0}}},  {{/*1*/{195,195,0},{195,195,0}}},
-  {{/*1*/{195,195,1},{170,251,0}}},  {{/*1*/{195,195,2},{195,203,0}}},  {{/*1*/{195,195,3},{178,243,1}}},  {{/*1*/{195,195,4},{178,243,0}}},
-  {{/*1*/{203,203,3},{195,211,0}}},  {{/*1*/{203,203,2},{178,251,0}}},  {{/*1*/{203,203,1},{186,235,0}}},  {{/*1*/{203,203,0},{203,203,0}}},
-  {{/*1*/{203,203,1},{186,243,0}}},  {{/*1*/{203,203,2},{195,227,0}}},  {{/*1*/{203,203,3},{186,251,1}}},  {{/*1*/{203,203,4},{186,251,0}}},
-  {{/*1*/{211,211,3},{195,235,0}}},  {{/*1*/{211,211,2},{195,235,1}}},  {{/*1*/{211,211,1},{195,243,0}}},  {{/*1*/{211,211,0},{211,211,0}}},
-  {{/*1*/{211,211,1},{195,251,1}}},  {{/*1*/{211,211,2},{195,251,0}}},  {{/*1*/{211,211,3},{195,251,1}}},  {{/*1*/{211,211,4},{203,243,1}}},
-  {{/*1*/{219,219,3},{203,243,0}}},  {{/*1*/{219,219,2},{203,243,1}}},  {{/*1*/{219,219,1},{203,251,0}}},  {{/*1*/{219,219,0},{219,219,0}}},
-  {{/*1*/{219,219,1},{211,243,1}}},  {{/*1*/{219,219,2},{211,243,0}}},  {{/*1*/{219,219,3},{211,243,1}}},  {{/*1*/{219,219,4},{211,251,1}}},
-  {{/*1*/{227,227,3},{211,251,0}}},  {{/*1*/{227,227,2},{211,251,1}}},  {{/*1*/{227,227,1},{219,243,0}}},  {{/*1*/{227,227,0},{227,227,0}}},
-  {{/*1*/{227,227,1},{219,251,1}}},  {{/*1*/{227,227,2},{219,251,0}}},  {{/*1*/{227,227,3},{219,251,1}}},  {{/*1*/{227,227,4},{227,243,1}}},
-  {{/*1*/{235,235,3},{227,243,0}}},  {{/*1*/{235,235,2},{227,243,1}}},  {{/*1*/{235,235,1},{227,251,0}}},  {{/*1*/{235,235,0},{235,235,0}}},
-  {{/*1*/{235,235,1},{235,235,1}}},  {{/*1*/{235,235,2},{235,243,0}}},  {{/*1*/{235,235,3},{235,243,1}}},  {{/*1*/{235,235,4},{235,251,1}}},
-  {{/*1*/{243,243,3},{235,251,0}}},  {{/*1*/{243,243,2},{235,251,1}}},  {{/*1*/{243,243,1},{243,243,1}}},  {{/*1*/{243,243,0},{243,243,0}}},
-  {{/*1*/{243,243,1},{243,243,1}}},  {{/*1*/{243,243,2},{243,251,0}}},  {{/*1*/{243,243,3},{243,251,1}}},  {{/*1*/{243,243,4},{251,243,1}}},
-  {{/*1*/{251,251,3},{251,243,0}}},  {{/*1*/{251,251,2},{251,243,1}}},  {{/*1*/{251,251,1},{251,251,1}}},  {{/*1*/{251,251,0},{251,251,0}}},
-  {{/*1*/{251,251,1},{251,251,1}}},  {{/*1*/{251,251,2},{251,251,2}}},  {{/*1*/{251,251,3},{251,251,3}}},  {{/*1*/{251,251,4},{251,251,4}}}
+  {/*1*/{  0,  0},{  0,  0},{0,0}},  {/*1*/{  0,  0},{  0,  0},{1,1}},  {/*1*/{  0,  0},{  0,  8},{2,0}},  {/*1*/{  0,  0},{  0,  8},{3,1}},
+  {/*1*/{  0,  0},{  0, 16},{4,1}},  {/*1*/{  8,  0},{  8, 16},{3,0}},  {/*1*/{  8,  0},{  8, 16},{2,1}},  {/*1*/{  8,  0},{  8, 24},{1,0}},
+  {/*1*/{  8,  8},{  8,  8},{0,0}},  {/*1*/{  8,  0},{  8, 32},{1,1}},  {/*1*/{  8,  0},{  8, 32},{2,0}},  {/*1*/{  8,  0},{  8, 32},{3,1}},
+  {/*1*/{  8,  0},{  8, 40},{4,1}},  {/*1*/{ 16,  0},{ 16, 40},{3,0}},  {/*1*/{ 16,  0},{ 16, 40},{2,1}},  {/*1*/{ 16,  0},{ 16, 48},{1,0}},
+  {/*1*/{ 16, 16},{ 16, 16},{0,0}},  {/*1*/{ 16,  0},{ 16, 56},{1,1}},  {/*1*/{ 16,  0},{ 16, 56},{2,0}},  {/*1*/{ 16,  0},{ 16, 56},{3,1}},
+  {/*1*/{ 16,  0},{ 16, 65},{4,1}},  {/*1*/{ 24,  0},{ 24, 65},{3,0}},  {/*1*/{ 24,  0},{ 24, 65},{2,1}},  {/*1*/{ 24,  0},{ 24, 73},{1,0}},
+  {/*1*/{ 24, 24},{ 24, 24},{0,0}},  {/*1*/{ 24,  0},{ 24, 81},{1,1}},  {/*1*/{ 24,  0},{ 24, 81},{2,0}},  {/*1*/{ 24,  0},{ 24, 81},{3,1}},
+  {/*1*/{ 24,  0},{ 24, 89},{4,1}},  {/*1*/{ 32,  0},{ 32, 89},{3,0}},  {/*1*/{ 32,  0},{ 32, 89},{2,1}},  {/*1*/{ 32,  0},{ 32, 97},{1,0}},
+  {/*1*/{ 32, 16},{ 32, 65},{0,0}},  {/*1*/{ 32,  0},{ 32,105},{1,1}},  {/*1*/{ 32,  0},{ 32,105},{2,0}},  {/*1*/{ 32,  0},{ 32,105},{3,1}},
+  {/*1*/{ 32,  0},{ 32,113},{4,1}},  {/*1*/{ 40,  0},{ 40,113},{3,0}},  {/*1*/{ 40,  0},{ 40,113},{2,1}},  {/*1*/{ 40,  0},{ 40,121},{1,0}},
+  {/*1*/{ 40, 24},{ 40, 73},{0,0}},  {/*1*/{ 40,  0},{ 40,130},{1,1}},  {/*1*/{ 40,  0},{ 40,130},{2,0}},  {/*1*/{ 40, 65},{ 40,  0},{3,0}},
+  {/*1*/{ 40,  0},{ 40,138},{4,1}},  {/*1*/{ 48,  0},{ 48,138},{3,0}},  {/*1*/{ 48, 65},{ 48,  8},{2,0}},  {/*1*/{ 48,  0},{ 48,146},{1,0}},
+  {/*1*/{ 48,  8},{ 48,130},{0,0}},  {/*1*/{ 48, 73},{ 48,  0},{1,0}},  {/*1*/{ 48,  0},{ 48,154},{2,0}},  {/*1*/{ 48, 65},{ 48, 24},{3,0}},
+  {/*1*/{ 48,  0},{ 48,162},{4,1}},  {/*1*/{ 56,  0},{ 56,162},{3,0}},  {/*1*/{ 56, 65},{ 56, 32},{2,0}},  {/*1*/{ 56,  0},{ 56,170},{1,0}},
+  {/*1*/{ 56, 16},{ 56,138},{0,0}},  {/*1*/{ 56, 81},{ 56,  8},{1,0}},  {/*1*/{ 56,  0},{ 56,178},{2,0}},  {/*1*/{ 56, 65},{ 56, 48},{3,0}},
+  {/*1*/{ 56,  0},{ 56,186},{4,1}},  {/*1*/{ 65,  0},{ 65,186},{4,0}},  {/*1*/{ 65, 65},{ 65, 56},{3,0}},  {/*1*/{ 65,  0},{ 65,195},{2,0}},
+  {/*1*/{ 65, 24},{ 65,146},{1,0}},  {/*1*/{ 65, 65},{ 65, 65},{0,0}},  {/*1*/{ 65,  0},{ 65,203},{1,0}},  {/*1*/{ 65, 65},{ 65, 73},{2,0}},
+  {/*1*/{ 65,  0},{ 65,211},{3,1}},  {/*1*/{ 65,  0},{ 65,211},{4,0}},  {/*1*/{ 73, 65},{ 73, 81},{3,0}},  {/*1*/{ 73,  0},{ 73,219},{2,0}},
+  {/*1*/{ 73, 32},{ 73,154},{1,0}},  {/*1*/{ 73, 73},{ 73, 73},{0,0}},  {/*1*/{ 73,  0},{ 73,227},{1,0}},  {/*1*/{ 73, 65},{ 73, 97},{2,0}},
+  {/*1*/{ 73,  0},{ 73,235},{3,1}},  {/*1*/{ 73,  0},{ 73,235},{4,0}},  {/*1*/{ 81, 65},{ 81,105},{3,0}},  {/*1*/{ 81,  0},{ 81,243},{2,0}},
+  {/*1*/{ 81, 24},{ 81,195},{1,0}},  {/*1*/{ 81, 81},{ 81, 81},{0,0}},  {/*1*/{ 81,  0},{ 81,251},{1,0}},  {/*1*/{ 81, 65},{ 81,121},{2,0}},
+  {/*1*/{ 81,  8},{ 81,243},{3,1}},  {/*1*/{ 81,  8},{ 81,243},{4,0}},  {/*1*/{ 89, 65},{ 89,130},{3,0}},  {/*1*/{ 89,  8},{ 89,251},{2,0}},
+  {/*1*/{ 89, 32},{ 89,203},{1,0}},  {/*1*/{ 89, 89},{ 89, 89},{0,0}},  {/*1*/{ 89, 16},{ 89,243},{1,0}},  {/*1*/{ 89, 65},{ 89,146},{2,0}},
+  {/*1*/{ 89,130},{ 89, 16},{3,0}},  {/*1*/{ 89, 16},{ 89,251},{4,0}},  {/*1*/{ 97, 65},{ 97,154},{3,0}},  {/*1*/{ 97, 24},{ 97,243},{2,0}},
+  {/*1*/{ 97, 40},{ 97,211},{1,0}},  {/*1*/{ 97, 81},{ 97,130},{0,0}},  {/*1*/{ 97, 24},{ 97,251},{1,0}},  {/*1*/{ 97, 65},{ 97,170},{2,0}},
+  {/*1*/{ 97,130},{ 97, 40},{3,0}},  {/*1*/{ 97, 32},{ 97,243},{4,0}},  {/*1*/{105, 65},{105,178},{3,0}},  {/*1*/{105, 32},{105,251},{2,0}},
+  {/*1*/{105, 48},{105,219},{1,0}},  {/*1*/{105, 89},{105,138},{0,0}},  {/*1*/{105, 40},{105,243},{1,0}},  {/*1*/{105, 65},{105,195},{2,0}},
+  {/*1*/{105,130},{105, 65},{3,0}},  {/*1*/{105, 40},{105,251},{4,0}},  {/*1*/{113, 65},{113,203},{3,0}},  {/*1*/{113, 48},{113,243},{2,0}},
+  {/*1*/{113, 56},{113,227},{1,0}},  {/*1*/{113, 73},{113,195},{0,0}},  {/*1*/{113, 48},{113,251},{1,0}},  {/*1*/{113, 65},{113,219},{2,0}},
+  {/*1*/{113,130},{113, 89},{3,0}},  {/*1*/{113, 56},{113,243},{4,0}},  {/*1*/{121, 65},{121,227},{3,0}},  {/*1*/{121, 56},{121,251},{2,0}},
+  {/*1*/{121, 65},{121,235},{1,0}},  {/*1*/{121, 81},{121,203},{0,0}},  {/*1*/{121,146},{121, 73},{1,0}},  {/*1*/{121, 65},{121,243},{2,0}},
+  {/*1*/{121,130},{121,113},{3,0}},  {/*1*/{121, 65},{121,251},{4,1}},  {/*1*/{130, 65},{130,251},{4,0}},  {/*1*/{130,130},{130,121},{3,0}},
+  {/*1*/{130, 73},{130,243},{2,0}},  {/*1*/{130, 89},{130,211},{1,0}},  {/*1*/{130,130},{130,130},{0,0}},  {/*1*/{130, 73},{130,251},{1,0}},
+  {/*1*/{130,130},{130,138},{2,0}},  {/*1*/{130,195},{130,  8},{3,0}},  {/*1*/{130, 81},{130,243},{4,0}},  {/*1*/{138,130},{138,146},{3,0}},
+  {/*1*/{138, 81},{138,251},{2,0}},  {/*1*/{138, 97},{138,219},{1,0}},  {/*1*/{138,138},{138,138},{0,0}},  {/*1*/{138, 89},{138,243},{1,0}},
+  {/*1*/{138,130},{138,162},{2,0}},  {/*1*/{138,195},{138, 32},{3,0}},  {/*1*/{138, 89},{138,251},{4,0}},  {/*1*/{146,130},{146,170},{3,0}},
+  {/*1*/{146, 97},{146,243},{2,0}},  {/*1*/{146,105},{146,227},{1,0}},  {/*1*/{146,146},{146,146},{0,0}},  {/*1*/{146, 97},{146,251},{1,0}},
+  {/*1*/{146,130},{146,186},{2,0}},  {/*1*/{146,195},{146, 56},{3,0}},  {/*1*/{146,105},{146,243},{4,0}},  {/*1*/{154,130},{154,195},{3,0}},
+  {/*1*/{154,105},{154,251},{2,0}},  {/*1*/{154,113},{154,235},{1,0}},  {/*1*/{154,154},{154,154},{0,0}},  {/*1*/{154,113},{154,243},{1,0}},
+  {/*1*/{154,130},{154,211},{2,0}},  {/*1*/{154,195},{154, 81},{3,0}},  {/*1*/{154,113},{154,251},{4,0}},  {/*1*/{162,130},{162,219},{3,0}},
+  {/*1*/{162,195},{162, 89},{2,0}},  {/*1*/{162,121},{162,243},{1,0}},  {/*1*/{162,146},{162,195},{0,0}},  {/*1*/{162,121},{162,251},{1,0}},
+  {/*1*/{162,130},{162,235},{2,0}},  {/*1*/{162,195},{162,105},{3,0}},  {/*1*/{162,130},{162,243},{4,1}},  {/*1*/{170,130},{170,243},{3,0}},
+  {/*1*/{170,195},{170,113},{2,0}},  {/*1*/{170,130},{170,251},{1,0}},  {/*1*/{170,154},{170,203},{0,0}},  {/*1*/{170,219},{170, 73},{1,0}},
+  {/*1*/{170,138},{170,243},{2,0}},  {/*1*/{170,195},{170,130},{3,0}},  {/*1*/{170,138},{170,251},{4,1}},  {/*1*/{178,138},{178,251},{3,0}},
+  {/*1*/{178,195},{178,138},{2,0}},  {/*1*/{178,146},{178,243},{1,0}},  {/*1*/{178,162},{178,211},{0,0}},  {/*1*/{178,203},{178,130},{1,0}},
+  {/*1*/{178,146},{178,251},{2,0}},  {/*1*/{178,195},{178,154},{3,0}},  {/*1*/{178,154},{178,243},{4,1}},  {/*1*/{186,154},{186,243},{3,0}},
+  {/*1*/{186,195},{186,162},{2,0}},  {/*1*/{186,154},{186,251},{1,0}},  {/*1*/{186,170},{186,219},{0,0}},  {/*1*/{186,211},{186,138},{1,0}},
+  {/*1*/{186,162},{186,243},{2,0}},  {/*1*/{186,195},{186,178},{3,0}},  {/*1*/{186,162},{186,251},{4,1}},  {/*1*/{195,162},{195,251},{4,0}},
+  {/*1*/{195,195},{195,186},{3,0}},  {/*1*/{195,170},{195,243},{2,0}},  {/*1*/{195,178},{195,227},{1,0}},  {/*1*/{195,195},{195,195},{0,0}},
+  {/*1*/{195,170},{195,251},{1,0}},  {/*1*/{195,195},{195,203},{2,0}},  {/*1*/{195,178},{195,243},{3,1}},  {/*1*/{195,178},{195,243},{4,0}},
+  {/*1*/{203,195},{203,211},{3,0}},  {/*1*/{203,178},{203,251},{2,0}},  {/*1*/{203,186},{203,235},{1,0}},  {/*1*/{203,203},{203,203},{0,0}},
+  {/*1*/{203,186},{203,243},{1,0}},  {/*1*/{203,195},{203,227},{2,0}},  {/*1*/{203,186},{203,251},{3,1}},  {/*1*/{203,186},{203,251},{4,0}},
+  {/*1*/{211,195},{211,235},{3,0}},  {/*1*/{211,195},{211,235},{2,1}},  {/*1*/{211,195},{211,243},{1,0}},  {/*1*/{211,211},{211,211},{0,0}},
+  {/*1*/{211,195},{211,251},{1,1}},  {/*1*/{211,195},{211,251},{2,0}},  {/*1*/{211,195},{211,251},{3,1}},  {/*1*/{211,203},{211,243},{4,1}},
+  {/*1*/{219,203},{219,243},{3,0}},  {/*1*/{219,203},{219,243},{2,1}},  {/*1*/{219,203},{219,251},{1,0}},  {/*1*/{219,219},{219,219},{0,0}},
+  {/*1*/{219,211},{219,243},{1,1}},  {/*1*/{219,211},{219,243},{2,0}},  {/*1*/{219,211},{219,243},{3,1}},  {/*1*/{219,211},{219,251},{4,1}},
+  {/*1*/{227,211},{227,251},{3,0}},  {/*1*/{227,211},{227,251},{2,1}},  {/*1*/{227,219},{227,243},{1,0}},  {/*1*/{227,227},{227,227},{0,0}},
+  {/*1*/{227,219},{227,251},{1,1}},  {/*1*/{227,219},{227,251},{2,0}},  {/*1*/{227,219},{227,251},{3,1}},  {/*1*/{227,227},{227,243},{4,1}},
+  {/*1*/{235,227},{235,243},{3,0}},  {/*1*/{235,227},{235,243},{2,1}},  {/*1*/{235,227},{235,251},{1,0}},  {/*1*/{235,235},{235,235},{0,0}},
+  {/*1*/{235,235},{235,235},{1,1}},  {/*1*/{235,235},{235,243},{2,0}},  {/*1*/{235,235},{235,243},{3,1}},  {/*1*/{235,235},{235,251},{4,1}},
+  {/*1*/{243,235},{243,251},{3,0}},  {/*1*/{243,235},{243,251},{2,1}},  {/*1*/{243,243},{243,243},{1,1}},  {/*1*/{243,243},{243,243},{0,0}},
+  {/*1*/{243,243},{243,243},{1,1}},  {/*1*/{243,243},{243,251},{2,0}},  {/*1*/{243,243},{243,251},{3,1}},  {/*1*/{243,251},{243,243},{4,1}},
+  {/*1*/{251,251},{251,243},{3,0}},  {/*1*/{251,251},{251,243},{2,1}},  {/*1*/{251,251},{251,251},{1,1}},  {/*1*/{251,251},{251,251},{0,0}},
+  {/*1*/{251,251},{251,251},{1,1}},  {/*1*/{251,251},{251,251},{2,2}},  {/*1*/{251,251},{251,251},{3,3}},  {/*1*/{251,251},{251,251},{4,4}}
 },{
-  {{/*1*/{  4,  0,4},{  4,  0,2}}},  {{/*1*/{  4,  0,3},{  4,  0,1}}},  {{/*1*/{  4,  0,2},{  4,  0,0}}},  {{/*1*/{  4,  0,1},{  4,  0,1}}},
-  {{/*0*/{  4,  0,0},{  4,  8,1}}},  {{/*1*/{  4,  0,1},{  4,  8,0}}},  {{/*1*/{  4,  0,2},{  4,  8,1}}},  {{/*1*/{  4,  0,3},{  4, 16,0}}},
-  {{/*1*/{  4,  0,4},{ 12,  0,0}}},  {{/*1*/{ 12,  8,3},{  4, 24,1}}},  {{/*1*/{ 12,  8,2},{  4, 24,0}}},  {{/*1*/{ 12,  8,1},{  4, 24,1}}},
-  {{/*0*/{ 12,  8,0},{  4, 32,1}}},  {{/*1*/{ 12,  8,1},{  4, 32,0}}},  {{/*1*/{ 12,  8,2},{  4, 32,1}}},  {{/*1*/{ 12,  8,3},{  4, 40,0}}},
-  {{/*1*/{ 12,  8,4},{ 20,  8,0}}},  {{/*1*/{ 20, 16,3},{  4, 48,1}}},  {{/*1*/{ 20, 16,2},{  4, 48,0}}},  {{/*1*/{ 20, 16,1},{  4, 48,1}}},
-  {{/*0*/{ 20, 16,0},{  4, 56,1}}},  {{/*1*/{ 20, 16,1},{  4, 56,0}}},  {{/*1*/{ 20, 16,2},{  4, 56,1}}},  {{/*1*/{ 20, 16,3},{ 12, 48,0}}},
-  {{/*1*/{ 20, 16,4},{  4, 65,0}}},  {{/*1*/{ 28, 24,3},{  4, 65,1}}},  {{/*1*/{ 28, 24,2},{  4, 73,0}}},  {{/*1*/{ 28, 24,1},{  4, 73,1}}},
-  {{/*0*/{ 28, 24,0},{  4, 81,1}}},  {{/*1*/{ 28, 24,1},{  4, 81,0}}},  {{/*1*/{ 28, 24,2},{  4, 81,1}}},  {{/*1*/{ 28, 24,3},{  4, 89,0}}},
-  {{/*1*/{ 28, 24,4},{ 12, 73,0}}},  {{/*1*/{ 36, 32,3},{  4, 97,1}}},  {{/*1*/{ 36, 32,2},{  4, 97,0}}},  {{/*1*/{ 36, 32,1},{  4, 97,1}}},
-  {{/*0*/{ 36, 32,0},{  4,105,1}}},  {{/*1*/{ 36, 32,1},{  4,105,0}}},  {{/*1*/{ 36, 32,2},{  4,105,1}}},  {{/*1*/{ 36, 32,3},{  4,113,0}}},
-  {{/*1*/{ 36, 32,4},{ 20, 81,0}}},  {{/*1*/{ 44, 40,3},{  4,121,1}}},  {{/*1*/{ 44, 40,2},{  4,121,0}}},  {{/*1*/{ 44, 40,1},{  4,121,1}}},
-  {{/*0*/{ 44, 40,0},{  4,130,1}}},  {{/*1*/{ 44, 40,1},{  4,130,0}}},  {{/*1*/{ 44, 40,2},{ 69,  0,0}}},  {{/*1*/{ 44, 40,3},{  4,138,0}}},
-  {{/*1*/{ 44, 40,4},{ 28, 89,0}}},  {{/*1*/{ 52, 48,3},{  4,146,1}}},  {{/*1*/{ 52, 48,2},{  4,146,0}}},  {{/*1*/{ 52, 48,1},{ 69, 16,0}}},
-  {{/*0*/{ 52, 48,0},{  4,154,1}}},  {{/*1*/{ 52, 48,1},{  4,154,0}}},  {{/*1*/{ 52, 48,2},{ 69, 24,0}}},  {{/*1*/{ 52, 48,3},{  4,162,0}}},
-  {{/*1*/{ 52, 48,4},{ 20,130,0}}},  {{/*1*/{ 60, 56,3},{ 85,  0,0}}},  {{/*1*/{ 60, 56,2},{  4,170,0}}},  {{/*1*/{ 60, 56,1},{ 69, 40,0}}},
-  {{/*0*/{ 60, 56,0},{  4,178,1}}},  {{/*1*/{ 60, 56,1},{  4,178,0}}},  {{/*1*/{ 60, 56,2},{ 69, 48,0}}},  {{/*1*/{ 60, 56,3},{  4,186,0}}},
-  {{/*1*/{ 60, 56,4},{ 28,138,0}}},  {{/*1*/{ 69, 65,4},{ 93,  8,0}}},  {{/*1*/{ 69, 65,3},{  4,195,0}}},  {{/*1*/{ 69, 65,2},{ 69, 65,0}}},
-  {{/*1*/{ 69, 65,1},{  4,203,1}}},  {{/*1*/{ 69, 65,0},{  4,203,0}}},  {{/*1*/{ 69, 65,1},{ 69, 73,0}}},  {{/*1*/{ 69, 65,2},{  4,211,0}}},
-  {{/*1*/{ 69, 65,3},{ 12,195,0}}},  {{/*1*/{ 69, 65,4},{ 77, 65,0}}},  {{/*1*/{ 77, 73,3},{  4,219,0}}},  {{/*1*/{ 77, 73,2},{ 69, 89,0}}},
-  {{/*1*/{ 77, 73,1},{  4,227,1}}},  {{/*1*/{ 77, 73,0},{  4,227,0}}},  {{/*1*/{ 77, 73,1},{ 69, 97,0}}},  {{/*1*/{ 77, 73,2},{  4,235,0}}},
-  {{/*1*/{ 77, 73,3},{ 20,203,0}}},  {{/*1*/{ 77, 73,4},{ 85, 73,0}}},  {{/*1*/{ 85, 81,3},{  4,243,0}}},  {{/*1*/{ 85, 81,2},{ 69,113,0}}},
-  {{/*1*/{ 85, 81,1},{  4,251,1}}},  {{/*1*/{ 85, 81,0},{  4,251,0}}},  {{/*1*/{ 85, 81,1},{ 69,121,0}}},  {{/*1*/{ 85, 81,2},{ 12,243,0}}},
-  {{/*1*/{ 85, 81,3},{ 28,211,0}}},  {{/*1*/{ 85, 81,4},{ 69,130,0}}},  {{/*1*/{ 93, 89,3},{ 12,251,0}}},  {{/*1*/{ 93, 89,2},{ 69,138,0}}},
-  {{/*1*/{ 93, 89,1},{134,  8,0}}},  {{/*1*/{ 93, 89,0},{ 20,243,0}}},  {{/*1*/{ 93, 89,1},{ 69,146,0}}},  {{/*1*/{ 93, 89,2},{ 20,251,0}}},
-  {{/*1*/{ 93, 89,3},{ 36,219,0}}},  {{/*1*/{ 93, 89,4},{ 77,138,0}}},  {{/*1*/{101, 97,3},{ 28,243,0}}},  {{/*1*/{101, 97,2},{ 69,162,0}}},
-  {{/*1*/{101, 97,1},{134, 32,0}}},  {{/*1*/{101, 97,0},{ 28,251,0}}},  {{/*1*/{101, 97,1},{ 69,170,0}}},  {{/*1*/{101, 97,2},{ 36,243,0}}},
-  {{/*1*/{101, 97,3},{ 44,227,0}}},  {{/*1*/{101, 97,4},{ 85,146,0}}},  {{/*1*/{109,105,3},{ 36,251,0}}},  {{/*1*/{109,105,2},{ 69,186,0}}},
-  {{/*1*/{109,105,1},{134, 56,0}}},  {{/*1*/{109,105,0},{ 44,243,0}}},  {{/*1*/{109,105,1},{ 69,195,0}}},  {{/*1*/{109,105,2},{ 44,251,0}}},
-  {{/*1*/{109,105,3},{ 52,235,0}}},  {{/*1*/{109,105,4},{ 93,154,0}}},  {{/*1*/{117,113,3},{ 52,243,0}}},  {{/*1*/{117,113,2},{ 69,211,0}}},
-  {{/*1*/{117,113,1},{134, 81,0}}},  {{/*1*/{117,113,0},{ 52,251,0}}},  {{/*1*/{117,113,1},{ 69,219,0}}},  {{/*1*/{117,113,2},{134, 89,0}}},
-  {{/*1*/{117,113,3},{ 60,243,0}}},  {{/*1*/{117,113,4},{ 85,195,0}}},  {{/*1*/{125,121,3},{ 60,251,0}}},  {{/*1*/{125,121,2},{ 69,235,0}}},
-  {{/*1*/{125,121,1},{134,105,0}}},  {{/*0*/{125,121,0},{ 69,243,1}}},  {{/*1*/{125,121,1},{ 69,243,0}}},  {{/*1*/{125,121,2},{134,113,0}}},
-  {{/*1*/{125,121,3},{ 69,251,0}}},  {{/*1*/{125,121,4},{ 93,203,0}}},  {{/*1*/{134,130,4},{158, 73,0}}},  {{/*1*/{134,130,3},{ 77,243,0}}},
-  {{/*1*/{134,130,2},{134,130,0}}},  {{/*1*/{134,130,1},{199,  0,0}}},  {{/*1*/{134,130,0},{ 77,251,0}}},  {{/*1*/{134,130,1},{134,138,0}}},
-  {{/*1*/{134,130,2},{ 85,243,0}}},  {{/*1*/{134,130,3},{101,211,0}}},  {{/*1*/{134,130,4},{142,130,0}}},  {{/*1*/{142,138,3},{ 85,251,0}}},
-  {{/*1*/{142,138,2},{134,154,0}}},  {{/*1*/{142,138,1},{199, 24,0}}},  {{/*1*/{142,138,0},{ 93,243,0}}},  {{/*1*/{142,138,1},{134,162,0}}},
-  {{/*1*/{142,138,2},{ 93,251,0}}},  {{/*1*/{142,138,3},{109,219,0}}},  {{/*1*/{142,138,4},{150,138,0}}},  {{/*1*/{150,146,3},{101,243,0}}},
-  {{/*1*/{150,146,2},{134,178,0}}},  {{/*1*/{150,146,1},{199, 48,0}}},  {{/*1*/{150,146,0},{101,251,0}}},  {{/*1*/{150,146,1},{134,186,0}}},
-  {{/*1*/{150,146,2},{109,243,0}}},  {{/*1*/{150,146,3},{117,227,0}}},  {{/*1*/{150,146,4},{134,195,0}}},  {{/*1*/{158,154,3},{109,251,0}}},
-  {{/*1*/{158,154,2},{134,203,0}}},  {{/*1*/{158,154,1},{199, 73,0}}},  {{/*1*/{158,154,0},{117,243,0}}},  {{/*1*/{158,154,1},{134,211,0}}},
-  {{/*1*/{158,154,2},{117,251,0}}},  {{/*1*/{158,154,3},{125,235,0}}},  {{/*1*/{158,154,4},{142,203,0}}},  {{/*1*/{166,162,3},{125,243,0}}},
-  {{/*1*/{166,162,2},{134,227,0}}},  {{/*1*/{166,162,1},{199, 97,0}}},  {{/*1*/{166,162,0},{125,251,0}}},  {{/*1*/{166,162,1},{134,235,0}}},
-  {{/*1*/{166,162,2},{199,105,0}}},  {{/*1*/{166,162,3},{134,243,0}}},  {{/*1*/{166,162,4},{150,211,0}}},  {{/*1*/{174,170,3},{215, 81,0}}},
-  {{/*1*/{174,170,2},{134,251,0}}},  {{/*1*/{174,170,1},{199,121,0}}},  {{/*0*/{174,170,0},{142,243,1}}},  {{/*1*/{174,170,1},{142,243,0}}},
-  {{/*1*/{174,170,2},{199,130,0}}},  {{/*1*/{174,170,3},{142,251,0}}},  {{/*1*/{174,170,4},{158,219,0}}},  {{/*1*/{182,178,3},{223, 89,0}}},
-  {{/*1*/{182,178,2},{150,243,0}}},  {{/*1*/{182,178,1},{199,146,0}}},  {{/*0*/{182,178,0},{150,251,1}}},  {{/*1*/{182,178,1},{150,251,0}}},
-  {{/*1*/{182,178,2},{199,154,0}}},  {{/*1*/{182,178,3},{158,243,0}}},  {{/*1*/{182,178,4},{166,227,0}}},  {{/*1*/{190,186,3},{215,130,0}}},
-  {{/*1*/{190,186,2},{158,251,0}}},  {{/*1*/{190,186,1},{199,170,0}}},  {{/*0*/{190,186,0},{166,243,1}}},  {{/*1*/{190,186,1},{166,243,0}}},
-  {{/*1*/{190,186,2},{199,178,0}}},  {{/*1*/{190,186,3},{166,251,0}}},  {{/*1*/{190,186,4},{174,235,0}}},  {{/*1*/{199,195,4},{223,138,0}}},
-  {{/*1*/{199,195,3},{174,243,0}}},  {{/*1*/{199,195,2},{199,195,0}}},  {{/*1*/{199,195,1},{174,251,1}}},  {{/*1*/{199,195,0},{174,251,0}}},
-  {{/*1*/{199,195,1},{199,203,0}}},  {{/*1*/{199,195,2},{182,243,1}}},  {{/*1*/{199,195,3},{182,243,0}}},  {{/*1*/{199,195,4},{207,195,0}}},
-  {{/*1*/{207,203,3},{182,251,0}}},  {{/*1*/{207,203,2},{199,219,0}}},  {{/*1*/{207,203,1},{190,243,1}}},  {{/*1*/{207,203,0},{190,243,0}}},
-  {{/*1*/{207,203,1},{199,227,0}}},  {{/*1*/{207,203,2},{190,251,1}}},  {{/*1*/{207,203,3},{190,251,0}}},  {{/*1*/{207,203,4},{215,203,0}}},
-  {{/*1*/{215,211,3},{199,243,1}}},  {{/*1*/{215,211,2},{199,243,0}}},  {{/*1*/{215,211,1},{199,243,1}}},  {{/*0*/{215,211,0},{199,251,1}}},
-  {{/*1*/{215,211,1},{199,251,0}}},  {{/*1*/{215,211,2},{199,251,1}}},  {{/*1*/{215,211,3},{207,243,0}}},  {{/*1*/{215,211,4},{223,211,0}}},
-  {{/*1*/{223,219,3},{207,251,1}}},  {{/*1*/{223,219,2},{207,251,0}}},  {{/*1*/{223,219,1},{207,251,1}}},  {{/*0*/{223,219,0},{215,243,1}}},
-  {{/*1*/{223,219,1},{215,243,0}}},  {{/*1*/{223,219,2},{215,243,1}}},  {{/*1*/{223,219,3},{215,251,0}}},  {{/*1*/{223,219,4},{231,219,0}}},
-  {{/*1*/{231,227,3},{223,243,1}}},  {{/*1*/{231,227,2},{223,243,0}}},  {{/*1*/{231,227,1},{223,243,1}}},  {{/*0*/{231,227,0},{223,251,1}}},
-  {{/*1*/{231,227,1},{223,251,0}}},  {{/*1*/{231,227,2},{223,251,1}}},  {{/*1*/{231,227,3},{231,243,0}}},  {{/*1*/{231,227,4},{239,227,0}}},
-  {{/*1*/{239,235,3},{231,251,1}}},  {{/*1*/{239,235,2},{231,251,0}}},  {{/*1*/{239,235,1},{231,251,1}}},  {{/*0*/{239,235,0},{239,243,1}}},
-  {{/*1*/{239,235,1},{239,243,0}}},  {{/*1*/{239,235,2},{239,243,1}}},  {{/*1*/{239,235,3},{239,251,0}}},  {{/*1*/{239,235,4},{247,235,0}}},
-  {{/*1*/{247,243,3},{247,243,1}}},  {{/*1*/{247,243,2},{247,243,0}}},  {{/*1*/{247,243,1},{247,243,1}}},  {{/*0*/{247,243,0},{247,251,1}}},
-  {{/*1*/{247,243,1},{247,251,0}}},  {{/*1*/{247,243,2},{247,251,1}}},  {{/*1*/{247,243,3},{255,243,1}}},  {{/*1*/{247,243,4},{255,243,0}}},
-  {{/*1*/{255,251,3},{255,251,1}}},  {{/*1*/{255,251,2},{255,251,0}}},  {{/*1*/{255,251,1},{255,251,1}}},  {{/*0*/{255,251,0},{255,251,2}}}
+  {/*1*/{  4,  4},{  0,  0},{4,2}},  {/*1*/{  4,  4},{  0,  0},{3,1}},  {/*1*/{  4,  4},{  0,  0},{2,0}},  {/*1*/{  4,  4},{  0,  0},{1,1}},
+  {/*0*/{  4,  4},{  0,  8},{0,1}},  {/*1*/{  4,  4},{  0,  8},{1,0}},  {/*1*/{  4,  4},{  0,  8},{2,1}},  {/*1*/{  4,  4},{  0, 16},{3,0}},
+  {/*1*/{  4, 12},{  0,  0},{4,0}},  {/*1*/{ 12,  4},{  8, 24},{3,1}},  {/*1*/{ 12,  4},{  8, 24},{2,0}},  {/*1*/{ 12,  4},{  8, 24},{1,1}},
+  {/*0*/{ 12,  4},{  8, 32},{0,1}},  {/*1*/{ 12,  4},{  8, 32},{1,0}},  {/*1*/{ 12,  4},{  8, 32},{2,1}},  {/*1*/{ 12,  4},{  8, 40},{3,0}},
+  {/*1*/{ 12, 20},{  8,  8},{4,0}},  {/*1*/{ 20,  4},{ 16, 48},{3,1}},  {/*1*/{ 20,  4},{ 16, 48},{2,0}},  {/*1*/{ 20,  4},{ 16, 48},{1,1}},
+  {/*0*/{ 20,  4},{ 16, 56},{0,1}},  {/*1*/{ 20,  4},{ 16, 56},{1,0}},  {/*1*/{ 20,  4},{ 16, 56},{2,1}},  {/*1*/{ 20, 12},{ 16, 48},{3,0}},
+  {/*1*/{ 20,  4},{ 16, 65},{4,0}},  {/*1*/{ 28,  4},{ 24, 65},{3,1}},  {/*1*/{ 28,  4},{ 24, 73},{2,0}},  {/*1*/{ 28,  4},{ 24, 73},{1,1}},
+  {/*0*/{ 28,  4},{ 24, 81},{0,1}},  {/*1*/{ 28,  4},{ 24, 81},{1,0}},  {/*1*/{ 28,  4},{ 24, 81},{2,1}},  {/*1*/{ 28,  4},{ 24, 89},{3,0}},
+  {/*1*/{ 28, 12},{ 24, 73},{4,0}},  {/*1*/{ 36,  4},{ 32, 97},{3,1}},  {/*1*/{ 36,  4},{ 32, 97},{2,0}},  {/*1*/{ 36,  4},{ 32, 97},{1,1}},
+  {/*0*/{ 36,  4},{ 32,105},{0,1}},  {/*1*/{ 36,  4},{ 32,105},{1,0}},  {/*1*/{ 36,  4},{ 32,105},{2,1}},  {/*1*/{ 36,  4},{ 32,113},{3,0}},
+  {/*1*/{ 36, 20},{ 32, 81},{4,0}},  {/*1*/{ 44,  4},{ 40,121},{3,1}},  {/*1*/{ 44,  4},{ 40,121},{2,0}},  {/*1*/{ 44,  4},{ 40,121},{1,1}},
+  {/*0*/{ 44,  4},{ 40,130},{0,1}},  {/*1*/{ 44,  4},{ 40,130},{1,0}},  {/*1*/{ 44, 69},{ 40,  0},{2,0}},  {/*1*/{ 44,  4},{ 40,138},{3,0}},
+  {/*1*/{ 44, 28},{ 40, 89},{4,0}},  {/*1*/{ 52,  4},{ 48,146},{3,1}},  {/*1*/{ 52,  4},{ 48,146},{2,0}},  {/*1*/{ 52, 69},{ 48, 16},{1,0}},
+  {/*0*/{ 52,  4},{ 48,154},{0,1}},  {/*1*/{ 52,  4},{ 48,154},{1,0}},  {/*1*/{ 52, 69},{ 48, 24},{2,0}},  {/*1*/{ 52,  4},{ 48,162},{3,0}},
+  {/*1*/{ 52, 20},{ 48,130},{4,0}},  {/*1*/{ 60, 85},{ 56,  0},{3,0}},  {/*1*/{ 60,  4},{ 56,170},{2,0}},  {/*1*/{ 60, 69},{ 56, 40},{1,0}},
+  {/*0*/{ 60,  4},{ 56,178},{0,1}},  {/*1*/{ 60,  4},{ 56,178},{1,0}},  {/*1*/{ 60, 69},{ 56, 48},{2,0}},  {/*1*/{ 60,  4},{ 56,186},{3,0}},
+  {/*1*/{ 60, 28},{ 56,138},{4,0}},  {/*1*/{ 69, 93},{ 65,  8},{4,0}},  {/*1*/{ 69,  4},{ 65,195},{3,0}},  {/*1*/{ 69, 69},{ 65, 65},{2,0}},
+  {/*1*/{ 69,  4},{ 65,203},{1,1}},  {/*1*/{ 69,  4},{ 65,203},{0,0}},  {/*1*/{ 69, 69},{ 65, 73},{1,0}},  {/*1*/{ 69,  4},{ 65,211},{2,0}},
+  {/*1*/{ 69, 12},{ 65,195},{3,0}},  {/*1*/{ 69, 77},{ 65, 65},{4,0}},  {/*1*/{ 77,  4},{ 73,219},{3,0}},  {/*1*/{ 77, 69},{ 73, 89},{2,0}},
+  {/*1*/{ 77,  4},{ 73,227},{1,1}},  {/*1*/{ 77,  4},{ 73,227},{0,0}},  {/*1*/{ 77, 69},{ 73, 97},{1,0}},  {/*1*/{ 77,  4},{ 73,235},{2,0}},
+  {/*1*/{ 77, 20},{ 73,203},{3,0}},  {/*1*/{ 77, 85},{ 73, 73},{4,0}},  {/*1*/{ 85,  4},{ 81,243},{3,0}},  {/*1*/{ 85, 69},{ 81,113},{2,0}},
+  {/*1*/{ 85,  4},{ 81,251},{1,1}},  {/*1*/{ 85,  4},{ 81,251},{0,0}},  {/*1*/{ 85, 69},{ 81,121},{1,0}},  {/*1*/{ 85, 12},{ 81,243},{2,0}},
+  {/*1*/{ 85, 28},{ 81,211},{3,0}},  {/*1*/{ 85, 69},{ 81,130},{4,0}},  {/*1*/{ 93, 12},{ 89,251},{3,0}},  {/*1*/{ 93, 69},{ 89,138},{2,0}},
+  {/*1*/{ 93,134},{ 89,  8},{1,0}},  {/*1*/{ 93, 20},{ 89,243},{0,0}},  {/*1*/{ 93, 69},{ 89,146},{1,0}},  {/*1*/{ 93, 20},{ 89,251},{2,0}},
+  {/*1*/{ 93, 36},{ 89,219},{3,0}},  {/*1*/{ 93, 77},{ 89,138},{4,0}},  {/*1*/{101, 28},{ 97,243},{3,0}},  {/*1*/{101, 69},{ 97,162},{2,0}},
+  {/*1*/{101,134},{ 97, 32},{1,0}},  {/*1*/{101, 28},{ 97,251},{0,0}},  {/*1*/{101, 69},{ 97,170},{1,0}},  {/*1*/{101, 36},{ 97,243},{2,0}},
+  {/*1*/{101, 44},{ 97,227},{3,0}},  {/*1*/{101, 85},{ 97,146},{4,0}},  {/*1*/{109, 36},{105,251},{3,0}},  {/*1*/{109, 69},{105,186},{2,0}},
+  {/*1*/{109,134},{105, 56},{1,0}},  {/*1*/{109, 44},{105,243},{0,0}},  {/*1*/{109, 69},{105,195},{1,0}},  {/*1*/{109, 44},{105,251},{2,0}},
+  {/*1*/{109, 52},{105,235},{3,0}},  {/*1*/{109, 93},{105,154},{4,0}},  {/*1*/{117, 52},{113,243},{3,0}},  {/*1*/{117, 69},{113,211},{2,0}},
+  {/*1*/{117,134},{113, 81},{1,0}},  {/*1*/{117, 52},{113,251},{0,0}},  {/*1*/{117, 69},{113,219},{1,0}},  {/*1*/{117,134},{113, 89},{2,0}},
+  {/*1*/{117, 60},{113,243},{3,0}},  {/*1*/{117, 85},{113,195},{4,0}},  {/*1*/{125, 60},{121,251},{3,0}},  {/*1*/{125, 69},{121,235},{2,0}},
+  {/*1*/{125,134},{121,105},{1,0}},  {/*0*/{125, 69},{121,243},{0,1}},  {/*1*/{125, 69},{121,243},{1,0}},  {/*1*/{125,134},{121,113},{2,0}},
+  {/*1*/{125, 69},{121,251},{3,0}},  {/*1*/{125, 93},{121,203},{4,0}},  {/*1*/{134,158},{130, 73},{4,0}},  {/*1*/{134, 77},{130,243},{3,0}},
+  {/*1*/{134,134},{130,130},{2,0}},  {/*1*/{134,199},{130,  0},{1,0}},  {/*1*/{134, 77},{130,251},{0,0}},  {/*1*/{134,134},{130,138},{1,0}},
+  {/*1*/{134, 85},{130,243},{2,0}},  {/*1*/{134,101},{130,211},{3,0}},  {/*1*/{134,142},{130,130},{4,0}},  {/*1*/{142, 85},{138,251},{3,0}},
+  {/*1*/{142,134},{138,154},{2,0}},  {/*1*/{142,199},{138, 24},{1,0}},  {/*1*/{142, 93},{138,243},{0,0}},  {/*1*/{142,134},{138,162},{1,0}},
+  {/*1*/{142, 93},{138,251},{2,0}},  {/*1*/{142,109},{138,219},{3,0}},  {/*1*/{142,150},{138,138},{4,0}},  {/*1*/{150,101},{146,243},{3,0}},
+  {/*1*/{150,134},{146,178},{2,0}},  {/*1*/{150,199},{146, 48},{1,0}},  {/*1*/{150,101},{146,251},{0,0}},  {/*1*/{150,134},{146,186},{1,0}},
+  {/*1*/{150,109},{146,243},{2,0}},  {/*1*/{150,117},{146,227},{3,0}},  {/*1*/{150,134},{146,195},{4,0}},  {/*1*/{158,109},{154,251},{3,0}},
+  {/*1*/{158,134},{154,203},{2,0}},  {/*1*/{158,199},{154, 73},{1,0}},  {/*1*/{158,117},{154,243},{0,0}},  {/*1*/{158,134},{154,211},{1,0}},
+  {/*1*/{158,117},{154,251},{2,0}},  {/*1*/{158,125},{154,235},{3,0}},  {/*1*/{158,142},{154,203},{4,0}},  {/*1*/{166,125},{162,243},{3,0}},
+  {/*1*/{166,134},{162,227},{2,0}},  {/*1*/{166,199},{162, 97},{1,0}},  {/*1*/{166,125},{162,251},{0,0}},  {/*1*/{166,134},{162,235},{1,0}},
+  {/*1*/{166,199},{162,105},{2,0}},  {/*1*/{166,134},{162,243},{3,0}},  {/*1*/{166,150},{162,211},{4,0}},  {/*1*/{174,215},{170, 81},{3,0}},
+  {/*1*/{174,134},{170,251},{2,0}},  {/*1*/{174,199},{170,121},{1,0}},  {/*0*/{174,142},{170,243},{0,1}},  {/*1*/{174,142},{170,243},{1,0}},
+  {/*1*/{174,199},{170,130},{2,0}},  {/*1*/{174,142},{170,251},{3,0}},  {/*1*/{174,158},{170,219},{4,0}},  {/*1*/{182,223},{178, 89},{3,0}},
+  {/*1*/{182,150},{178,243},{2,0}},  {/*1*/{182,199},{178,146},{1,0}},  {/*0*/{182,150},{178,251},{0,1}},  {/*1*/{182,150},{178,251},{1,0}},
+  {/*1*/{182,199},{178,154},{2,0}},  {/*1*/{182,158},{178,243},{3,0}},  {/*1*/{182,166},{178,227},{4,0}},  {/*1*/{190,215},{186,130},{3,0}},
+  {/*1*/{190,158},{186,251},{2,0}},  {/*1*/{190,199},{186,170},{1,0}},  {/*0*/{190,166},{186,243},{0,1}},  {/*1*/{190,166},{186,243},{1,0}},
+  {/*1*/{190,199},{186,178},{2,0}},  {/*1*/{190,166},{186,251},{3,0}},  {/*1*/{190,174},{186,235},{4,0}},  {/*1*/{199,223},{195,138},{4,0}},
+  {/*1*/{199,174},{195,243},{3,0}},  {/*1*/{199,199},{195,195},{2,0}},  {/*1*/{199,174},{195,251},{1,1}},  {/*1*/{199,174},{195,251},{0,0}},
+  {/*1*/{199,199},{195,203},{1,0}},  {/*1*/{199,182},{195,243},{2,1}},  {/*1*/{199,182},{195,243},{3,0}},  {/*1*/{199,207},{195,195},{4,0}},
+  {/*1*/{207,182},{203,251},{3,0}},  {/*1*/{207,199},{203,219},{2,0}},  {/*1*/{207,190},{203,243},{1,1}},  {/*1*/{207,190},{203,243},{0,0}},
+  {/*1*/{207,199},{203,227},{1,0}},  {/*1*/{207,190},{203,251},{2,1}},  {/*1*/{207,190},{203,251},{3,0}},  {/*1*/{207,215},{203,203},{4,0}},
+  {/*1*/{215,199},{211,243},{3,1}},  {/*1*/{215,199},{211,243},{2,0}},  {/*1*/{215,199},{211,243},{1,1}},  {/*0*/{215,199},{211,251},{0,1}},
+  {/*1*/{215,199},{211,251},{1,0}},  {/*1*/{215,199},{211,251},{2,1}},  {/*1*/{215,207},{211,243},{3,0}},  {/*1*/{215,223},{211,211},{4,0}},
+  {/*1*/{223,207},{219,251},{3,1}},  {/*1*/{223,207},{219,251},{2,0}},  {/*1*/{223,207},{219,251},{1,1}},  {/*0*/{223,215},{219,243},{0,1}},
+  {/*1*/{223,215},{219,243},{1,0}},  {/*1*/{223,215},{219,243},{2,1}},  {/*1*/{223,215},{219,251},{3,0}},  {/*1*/{223,231},{219,219},{4,0}},
+  {/*1*/{231,223},{227,243},{3,1}},  {/*1*/{231,223},{227,243},{2,0}},  {/*1*/{231,223},{227,243},{1,1}},  {/*0*/{231,223},{227,251},{0,1}},
+  {/*1*/{231,223},{227,251},{1,0}},  {/*1*/{231,223},{227,251},{2,1}},  {/*1*/{231,231},{227,243},{3,0}},  {/*1*/{231,239},{227,227},{4,0}},
+  {/*1*/{239,231},{235,251},{3,1}},  {/*1*/{239,231},{235,251},{2,0}},  {/*1*/{239,231},{235,251},{1,1}},  {/*0*/{239,239},{235,243},{0,1}},
+  {/*1*/{239,239},{235,243},{1,0}},  {/*1*/{239,239},{235,243},{2,1}},  {/*1*/{239,239},{235,251},{3,0}},  {/*1*/{239,247},{235,235},{4,0}},
+  {/*1*/{247,247},{243,243},{3,1}},  {/*1*/{247,247},{243,243},{2,0}},  {/*1*/{247,247},{243,243},{1,1}},  {/*0*/{247,247},{243,251},{0,1}},
+  {/*1*/{247,247},{243,251},{1,0}},  {/*1*/{247,247},{243,251},{2,1}},  {/*1*/{247,255},{243,243},{3,1}},  {/*1*/{247,255},{243,243},{4,0}},
+  {/*1*/{255,255},{251,251},{3,1}},  {/*1*/{255,255},{251,251},{2,0}},  {/*1*/{255,255},{251,251},{1,1}},  {/*0*/{255,255},{251,251},{0,2}}
 },{
-  {{/*0*/{  0,  4,0},{  0,  4,1}}},  {{/*1*/{  0,  4,1},{  0,  4,0}}},  {{/*1*/{  0,  4,2},{  0,  4,1}}},  {{/*1*/{  0,  4,3},{  0, 12,0}}},
-  {{/*1*/{  0,  4,4},{  0, 12,1}}},  {{/*1*/{  8,  4,3},{  0, 20,1}}},  {{/*1*/{  8,  4,2},{  0, 20,0}}},  {{/*1*/{  8,  4,1},{  0, 20,1}}},
-  {{/*0*/{  8,  4,0},{  0, 28,1}}},  {{/*1*/{  8,  4,1},{  0, 28,0}}},  {{/*1*/{  8,  4,2},{  0, 28,1}}},  {{/*1*/{  8,  4,3},{  0, 36,0}}},
-  {{/*1*/{  8,  4,4},{ 16,  4,0}}},  {{/*1*/{ 16, 12,3},{  0, 44,1}}},  {{/*1*/{ 16, 12,2},{  0, 44,0}}},  {{/*1*/{ 16, 12,1},{  0, 44,1}}},
-  {{/*0*/{ 16, 12,0},{  0, 52,1}}},  {{/*1*/{ 16, 12,1},{  0, 52,0}}},  {{/*1*/{ 16, 12,2},{  0, 52,1}}},  {{/*1*/{ 16, 12,3},{  0, 60,0}}},
-  {{/*1*/{ 16, 12,4},{ 24, 12,0}}},  {{/*1*/{ 24, 20,3},{  0, 69,1}}},  {{/*1*/{ 24, 20,2},{  0, 69,0}}},  {{/*1*/{ 24, 20,1},{  0, 69,1}}},
-  {{/*0*/{ 24, 20,0},{  0, 77,1}}},  {{/*1*/{ 24, 20,1},{  0, 77,0}}},  {{/*1*/{ 24, 20,2},{  0, 77,1}}},  {{/*1*/{ 24, 20,3},{  0, 85,0}}},
-  {{/*1*/{ 24, 20,4},{  8, 69,0}}},  {{/*1*/{ 32, 28,3},{  0, 93,1}}},  {{/*1*/{ 32, 28,2},{  0, 93,0}}},  {{/*1*/{ 32, 28,1},{  0, 93,1}}},
-  {{/*0*/{ 32, 28,0},{  0,101,1}}},  {{/*1*/{ 32, 28,1},{  0,101,0}}},  {{/*1*/{ 32, 28,2},{  0,101,1}}},  {{/*1*/{ 32, 28,3},{  0,109,0}}},
-  {{/*1*/{ 32, 28,4},{ 16, 77,0}}},  {{/*1*/{ 40, 36,3},{  0,117,1}}},  {{/*1*/{ 40, 36,2},{  0,117,0}}},  {{/*1*/{ 40, 36,1},{  0,117,1}}},
-  {{/*0*/{ 40, 36,0},{  0,125,1}}},  {{/*1*/{ 40, 36,1},{  0,125,0}}},  {{/*1*/{ 40, 36,2},{  0,125,1}}},  {{/*1*/{ 40, 36,3},{  0,134,0}}},
-  {{/*1*/{ 40, 36,4},{ 24, 85,0}}},  {{/*1*/{ 48, 44,3},{  0,142,1}}},  {{/*1*/{ 48, 44,2},{  0,142,0}}},  {{/*1*/{ 48, 44,1},{ 65, 12,0}}},
-  {{/*0*/{ 48, 44,0},{  0,150,1}}},  {{/*1*/{ 48, 44,1},{  0,150,0}}},  {{/*1*/{ 48, 44,2},{ 65, 20,0}}},  {{/*1*/{ 48, 44,3},{  0,158,0}}},
-  {{/*1*/{ 48, 44,4},{ 32, 93,0}}},  {{/*1*/{ 56, 52,3},{  0,166,1}}},  {{/*1*/{ 56, 52,2},{  0,166,0}}},  {{/*1*/{ 56, 52,1},{ 65, 36,0}}},
-  {{/*0*/{ 56, 52,0},{  0,174,1}}},  {{/*1*/{ 56, 52,1},{  0,174,0}}},  {{/*1*/{ 56, 52,2},{ 65, 44,0}}},  {{/*1*/{ 56, 52,3},{  0,182,0}}},
-  {{/*1*/{ 56, 52,4},{ 24,134,0}}},  {{/*1*/{ 65, 69,4},{ 89,  4,0}}},  {{/*1*/{ 65, 69,3},{  0,190,0}}},  {{/*1*/{ 65, 69,2},{ 65, 60,0}}},
-  {{/*1*/{ 65, 69,1},{  0,199,1}}},  {{/*1*/{ 65, 69,0},{  0,199,0}}},  {{/*1*/{ 65, 69,1},{ 65, 69,0}}},  {{/*1*/{ 65, 69,2},{  0,207,0}}},
-  {{/*1*/{ 65, 69,3},{ 32,142,0}}},  {{/*1*/{ 65, 69,4},{ 97, 12,0}}},  {{/*1*/{ 73, 69,3},{  0,215,0}}},  {{/*1*/{ 73, 69,2},{ 65, 85,0}}},
-  {{/*1*/{ 73, 69,1},{  0,223,1}}},  {{/*1*/{ 73, 69,0},{  0,223,0}}},  {{/*1*/{ 73, 69,1},{ 65, 93,0}}},  {{/*1*/{ 73, 69,2},{  0,231,0}}},
-  {{/*1*/{ 73, 69,3},{ 16,199,0}}},  {{/*1*/{ 73, 69,4},{ 81, 69,0}}},  {{/*1*/{ 81, 77,3},{  0,239,0}}},  {{/*1*/{ 81, 77,2},{ 65,109,0}}},
-  {{/*1*/{ 81, 77,1},{  0,247,1}}},  {{/*1*/{ 81, 77,0},{  0,247,0}}},  {{/*1*/{ 81, 77,1},{ 65,117,0}}},  {{/*1*/{ 81, 77,2},{  0,255,0}}},
-  {{/*1*/{ 81, 77,3},{ 24,207,0}}},  {{/*1*/{ 81, 77,4},{ 89, 77,0}}},  {{/*1*/{ 89, 85,3},{  8,247,0}}},  {{/*1*/{ 89, 85,2},{ 65,134,0}}},
-  {{/*1*/{ 89, 85,1},{130,  4,0}}},  {{/*1*/{ 89, 85,0},{  8,255,0}}},  {{/*1*/{ 89, 85,1},{ 65,142,0}}},  {{/*1*/{ 89, 85,2},{ 16,247,0}}},
-  {{/*1*/{ 89, 85,3},{ 32,215,0}}},  {{/*1*/{ 89, 85,4},{ 73,134,0}}},  {{/*1*/{ 97, 93,3},{ 16,255,0}}},  {{/*1*/{ 97, 93,2},{ 65,158,0}}},
-  {{/*1*/{ 97, 93,1},{130, 28,0}}},  {{/*1*/{ 97, 93,0},{ 24,247,0}}},  {{/*1*/{ 97, 93,1},{ 65,166,0}}},  {{/*1*/{ 97, 93,2},{ 24,255,0}}},
-  {{/*1*/{ 97, 93,3},{ 40,223,0}}},  {{/*1*/{ 97, 93,4},{ 81,142,0}}},  {{/*1*/{105,101,3},{ 32,247,0}}},  {{/*1*/{105,101,2},{ 65,182,0}}},
-  {{/*1*/{105,101,1},{130, 52,0}}},  {{/*1*/{105,101,0},{ 32,255,0}}},  {{/*1*/{105,101,1},{ 65,190,0}}},  {{/*1*/{105,101,2},{ 40,247,0}}},
-  {{/*1*/{105,101,3},{ 48,231,0}}},  {{/*1*/{105,101,4},{ 89,150,0}}},  {{/*1*/{113,109,3},{ 40,255,0}}},  {{/*1*/{113,109,2},{ 65,207,0}}},
-  {{/*1*/{113,109,1},{130, 77,0}}},  {{/*1*/{113,109,0},{ 48,247,0}}},  {{/*1*/{113,109,1},{ 65,215,0}}},  {{/*1*/{113,109,2},{ 48,255,0}}},
-  {{/*1*/{113,109,3},{ 56,239,0}}},  {{/*1*/{113,109,4},{ 97,158,0}}},  {{/*1*/{121,117,3},{ 56,247,0}}},  {{/*1*/{121,117,2},{ 65,231,0}}},
-  {{/*1*/{121,117,1},{130,101,0}}},  {{/*1*/{121,117,0},{ 56,255,0}}},  {{/*1*/{121,117,1},{ 65,239,0}}},  {{/*1*/{121,117,2},{130,109,0}}},
-  {{/*1*/{121,117,3},{ 65,247,0}}},  {{/*1*/{121,117,4},{ 89,199,0}}},  {{/*1*/{130,134,4},{154, 69,0}}},  {{/*1*/{130,134,3},{ 65,255,0}}},
-  {{/*1*/{130,134,2},{130,125,0}}},  {{/*1*/{130,134,1},{ 73,247,1}}},  {{/*1*/{130,134,0},{ 73,247,0}}},  {{/*1*/{130,134,1},{130,134,0}}},
-  {{/*1*/{130,134,2},{ 73,255,0}}},  {{/*1*/{130,134,3},{ 97,207,0}}},  {{/*1*/{130,134,4},{162, 77,0}}},  {{/*1*/{138,134,3},{ 81,247,0}}},
-  {{/*1*/{138,134,2},{130,150,0}}},  {{/*1*/{138,134,1},{195, 20,0}}},  {{/*1*/{138,134,0},{ 81,255,0}}},  {{/*1*/{138,134,1},{130,158,0}}},
-  {{/*1*/{138,134,2},{ 89,247,0}}},  {{/*1*/{138,134,3},{105,215,0}}},  {{/*1*/{138,134,4},{146,134,0}}},  {{/*1*/{146,142,3},{ 89,255,0}}},
-  {{/*1*/{146,142,2},{130,174,0}}},  {{/*1*/{146,142,1},{195, 44,0}}},  {{/*1*/{146,142,0},{ 97,247,0}}},  {{/*1*/{146,142,1},{130,182,0}}},
-  {{/*1*/{146,142,2},{ 97,255,0}}},  {{/*1*/{146,142,3},{113,223,0}}},  {{/*1*/{146,142,4},{154,142,0}}},  {{/*1*/{154,150,3},{105,247,0}}},
-  {{/*1*/{154,150,2},{130,199,0}}},  {{/*1*/{154,150,1},{195, 69,0}}},  {{/*1*/{154,150,0},{105,255,0}}},  {{/*1*/{154,150,1},{130,207,0}}},
-  {{/*1*/{154,150,2},{113,247,0}}},  {{/*1*/{154,150,3},{121,231,0}}},  {{/*1*/{154,150,4},{138,199,0}}},  {{/*1*/{162,158,3},{113,255,0}}},
-  {{/*1*/{162,158,2},{130,223,0}}},  {{/*1*/{162,158,1},{195, 93,0}}},  {{/*1*/{162,158,0},{121,247,0}}},  {{/*1*/{162,158,1},{130,231,0}}},
-  {{/*1*/{162,158,2},{121,255,0}}},  {{/*1*/{162,158,3},{130,239,0}}},  {{/*1*/{162,158,4},{146,207,0}}},  {{/*1*/{170,166,3},{211, 77,0}}},
-  {{/*1*/{170,166,2},{130,247,0}}},  {{/*1*/{170,166,1},{195,117,0}}},  {{/*0*/{170,166,0},{130,255,1}}},  {{/*1*/{170,166,1},{130,255,0}}},
-  {{/*1*/{170,166,2},{195,125,0}}},  {{/*1*/{170,166,3},{138,247,0}}},  {{/*1*/{170,166,4},{154,215,0}}},  {{/*1*/{178,174,3},{219, 85,0}}},
-  {{/*1*/{178,174,2},{138,255,0}}},  {{/*1*/{178,174,1},{195,142,0}}},  {{/*0*/{178,174,0},{146,247,1}}},  {{/*1*/{178,174,1},{146,247,0}}},
-  {{/*1*/{178,174,2},{195,150,0}}},  {{/*1*/{178,174,3},{146,255,0}}},  {{/*1*/{178,174,4},{162,223,0}}},  {{/*1*/{186,182,3},{227, 93,0}}},
-  {{/*1*/{186,182,2},{154,247,0}}},  {{/*1*/{186,182,1},{195,166,0}}},  {{/*0*/{186,182,0},{154,255,1}}},  {{/*1*/{186,182,1},{154,255,0}}},
-  {{/*1*/{186,182,2},{195,174,0}}},  {{/*1*/{186,182,3},{162,247,0}}},  {{/*1*/{186,182,4},{170,231,0}}},  {{/*1*/{195,199,4},{219,134,0}}},
-  {{/*1*/{195,199,3},{162,255,0}}},  {{/*1*/{195,199,2},{195,190,0}}},  {{/*1*/{195,199,1},{170,247,1}}},  {{/*1*/{195,199,0},{170,247,0}}},
-  {{/*1*/{195,199,1},{195,199,0}}},  {{/*1*/{195,199,2},{170,255,0}}},  {{/*1*/{195,199,3},{178,239,0}}},  {{/*1*/{195,199,4},{227,142,0}}},
-  {{/*1*/{203,199,3},{178,247,0}}},  {{/*1*/{203,199,2},{195,215,0}}},  {{/*1*/{203,199,1},{178,255,1}}},  {{/*1*/{203,199,0},{178,255,0}}},
-  {{/*1*/{203,199,1},{195,223,0}}},  {{/*1*/{203,199,2},{186,247,1}}},  {{/*1*/{203,199,3},{186,247,0}}},  {{/*1*/{203,199,4},{211,199,0}}},
-  {{/*1*/{211,207,3},{186,255,0}}},  {{/*1*/{211,207,2},{195,239,0}}},  {{/*1*/{211,207,1},{195,239,1}}},  {{/*0*/{211,207,0},{195,247,1}}},
-  {{/*1*/{211,207,1},{195,247,0}}},  {{/*1*/{211,207,2},{195,247,1}}},  {{/*1*/{211,207,3},{195,255,0}}},  {{/*1*/{211,207,4},{219,207,0}}},
-  {{/*1*/{219,215,3},{203,247,1}}},  {{/*1*/{219,215,2},{203,247,0}}},  {{/*1*/{219,215,1},{203,247,1}}},  {{/*0*/{219,215,0},{203,255,1}}},
-  {{/*1*/{219,215,1},{203,255,0}}},  {{/*1*/{219,215,2},{203,255,1}}},  {{/*1*/{219,215,3},{211,247,0}}},  {{/*1*/{219,215,4},{227,215,0}}},
-  {{/*1*/{227,223,3},{211,255,1}}},  {{/*1*/{227,223,2},{211,255,0}}},  {{/*1*/{227,223,1},{211,255,1}}},  {{/*0*/{227,223,0},{219,247,1}}},
-  {{/*1*/{227,223,1},{219,247,0}}},  {{/*1*/{227,223,2},{219,247,1}}},  {{/*1*/{227,223,3},{219,255,0}}},  {{/*1*/{227,223,4},{235,223,0}}},
-  {{/*1*/{235,231,3},{227,247,1}}},  {{/*1*/{235,231,2},{227,247,0}}},  {{/*1*/{235,231,1},{227,247,1}}},  {{/*0*/{235,231,0},{227,255,1}}},
-  {{/*1*/{235,231,1},{227,255,0}}},  {{/*1*/{235,231,2},{227,255,1}}},  {{/*1*/{235,231,3},{235,247,0}}},  {{/*1*/{235,231,4},{243,231,0}}},
-  {{/*1*/{243,239,3},{235,255,1}}},  {{/*1*/{243,239,2},{235,255,0}}},  {{/*1*/{243,239,1},{235,255,1}}},  {{/*0*/{243,239,0},{243,247,1}}},
-  {{/*1*/{243,239,1},{243,247,0}}},  {{/*1*/{243,239,2},{243,247,1}}},  {{/*1*/{243,239,3},{243,255,0}}},  {{/*1*/{243,239,4},{251,239,0}}},
-  {{/*1*/{251,247,3},{251,247,1}}},  {{/*1*/{251,247,2},{251,247,0}}},  {{/*1*/{251,247,1},{251,247,1}}},  {{/*0*/{251,247,0},{251,255,1}}},
-  {{/*1*/{251,247,1},{251,255,0}}},  {{/*1*/{251,247,2},{251,255,1}}},  {{/*1*/{251,247,3},{251,255,2}}},  {{/*1*/{251,247,4},{251,255,3}}}
+  {/*0*/{  0,  0},{  4,  4},{0,1}},  {/*1*/{  0,  0},{  4,  4},{1,0}},  {/*1*/{  0,  0},{  4,  4},{2,1}},  {/*1*/{  0,  0},{  4, 12},{3,0}},
+  {/*1*/{  0,  0},{  4, 12},{4,1}},  {/*1*/{  8,  0},{  4, 20},{3,1}},  {/*1*/{  8,  0},{  4, 20},{2,0}},  {/*1*/{  8,  0},{  4, 20},{1,1}},
+  {/*0*/{  8,  0},{  4, 28},{0,1}},  {/*1*/{  8,  0},{  4, 28},{1,0}},  {/*1*/{  8,  0},{  4, 28},{2,1}},  {/*1*/{  8,  0},{  4, 36},{3,0}},
+  {/*1*/{  8, 16},{  4,  4},{4,0}},  {/*1*/{ 16,  0},{ 12, 44},{3,1}},  {/*1*/{ 16,  0},{ 12, 44},{2,0}},  {/*1*/{ 16,  0},{ 12, 44},{1,1}},
+  {/*0*/{ 16,  0},{ 12, 52},{0,1}},  {/*1*/{ 16,  0},{ 12, 52},{1,0}},  {/*1*/{ 16,  0},{ 12, 52},{2,1}},  {/*1*/{ 16,  0},{ 12, 60},{3,0}},
+  {/*1*/{ 16, 24},{ 12, 12},{4,0}},  {/*1*/{ 24,  0},{ 20, 69},{3,1}},  {/*1*/{ 24,  0},{ 20, 69},{2,0}},  {/*1*/{ 24,  0},{ 20, 69},{1,1}},
+  {/*0*/{ 24,  0},{ 20, 77},{0,1}},  {/*1*/{ 24,  0},{ 20, 77},{1,0}},  {/*1*/{ 24,  0},{ 20, 77},{2,1}},  {/*1*/{ 24,  0},{ 20, 85},{3,0}},
+  {/*1*/{ 24,  8},{ 20, 69},{4,0}},  {/*1*/{ 32,  0},{ 28, 93},{3,1}},  {/*1*/{ 32,  0},{ 28, 93},{2,0}},  {/*1*/{ 32,  0},{ 28, 93},{1,1}},
+  {/*0*/{ 32,  0},{ 28,101},{0,1}},  {/*1*/{ 32,  0},{ 28,101},{1,0}},  {/*1*/{ 32,  0},{ 28,101},{2,1}},  {/*1*/{ 32,  0},{ 28,109},{3,0}},
+  {/*1*/{ 32, 16},{ 28, 77},{4,0}},  {/*1*/{ 40,  0},{ 36,117},{3,1}},  {/*1*/{ 40,  0},{ 36,117},{2,0}},  {/*1*/{ 40,  0},{ 36,117},{1,1}},
+  {/*0*/{ 40,  0},{ 36,125},{0,1}},  {/*1*/{ 40,  0},{ 36,125},{1,0}},  {/*1*/{ 40,  0},{ 36,125},{2,1}},  {/*1*/{ 40,  0},{ 36,134},{3,0}},
+  {/*1*/{ 40, 24},{ 36, 85},{4,0}},  {/*1*/{ 48,  0},{ 44,142},{3,1}},  {/*1*/{ 48,  0},{ 44,142},{2,0}},  {/*1*/{ 48, 65},{ 44, 12},{1,0}},
+  {/*0*/{ 48,  0},{ 44,150},{0,1}},  {/*1*/{ 48,  0},{ 44,150},{1,0}},  {/*1*/{ 48, 65},{ 44, 20},{2,0}},  {/*1*/{ 48,  0},{ 44,158},{3,0}},
+  {/*1*/{ 48, 32},{ 44, 93},{4,0}},  {/*1*/{ 56,  0},{ 52,166},{3,1}},  {/*1*/{ 56,  0},{ 52,166},{2,0}},  {/*1*/{ 56, 65},{ 52, 36},{1,0}},
+  {/*0*/{ 56,  0},{ 52,174},{0,1}},  {/*1*/{ 56,  0},{ 52,174},{1,0}},  {/*1*/{ 56, 65},{ 52, 44},{2,0}},  {/*1*/{ 56,  0},{ 52,182},{3,0}},
+  {/*1*/{ 56, 24},{ 52,134},{4,0}},  {/*1*/{ 65, 89},{ 69,  4},{4,0}},  {/*1*/{ 65,  0},{ 69,190},{3,0}},  {/*1*/{ 65, 65},{ 69, 60},{2,0}},
+  {/*1*/{ 65,  0},{ 69,199},{1,1}},  {/*1*/{ 65,  0},{ 69,199},{0,0}},  {/*1*/{ 65, 65},{ 69, 69},{1,0}},  {/*1*/{ 65,  0},{ 69,207},{2,0}},
+  {/*1*/{ 65, 32},{ 69,142},{3,0}},  {/*1*/{ 65, 97},{ 69, 12},{4,0}},  {/*1*/{ 73,  0},{ 69,215},{3,0}},  {/*1*/{ 73, 65},{ 69, 85},{2,0}},
+  {/*1*/{ 73,  0},{ 69,223},{1,1}},  {/*1*/{ 73,  0},{ 69,223},{0,0}},  {/*1*/{ 73, 65},{ 69, 93},{1,0}},  {/*1*/{ 73,  0},{ 69,231},{2,0}},
+  {/*1*/{ 73, 16},{ 69,199},{3,0}},  {/*1*/{ 73, 81},{ 69, 69},{4,0}},  {/*1*/{ 81,  0},{ 77,239},{3,0}},  {/*1*/{ 81, 65},{ 77,109},{2,0}},
+  {/*1*/{ 81,  0},{ 77,247},{1,1}},  {/*1*/{ 81,  0},{ 77,247},{0,0}},  {/*1*/{ 81, 65},{ 77,117},{1,0}},  {/*1*/{ 81,  0},{ 77,255},{2,0}},
+  {/*1*/{ 81, 24},{ 77,207},{3,0}},  {/*1*/{ 81, 89},{ 77, 77},{4,0}},  {/*1*/{ 89,  8},{ 85,247},{3,0}},  {/*1*/{ 89, 65},{ 85,134},{2,0}},
+  {/*1*/{ 89,130},{ 85,  4},{1,0}},  {/*1*/{ 89,  8},{ 85,255},{0,0}},  {/*1*/{ 89, 65},{ 85,142},{1,0}},  {/*1*/{ 89, 16},{ 85,247},{2,0}},
+  {/*1*/{ 89, 32},{ 85,215},{3,0}},  {/*1*/{ 89, 73},{ 85,134},{4,0}},  {/*1*/{ 97, 16},{ 93,255},{3,0}},  {/*1*/{ 97, 65},{ 93,158},{2,0}},
+  {/*1*/{ 97,130},{ 93, 28},{1,0}},  {/*1*/{ 97, 24},{ 93,247},{0,0}},  {/*1*/{ 97, 65},{ 93,166},{1,0}},  {/*1*/{ 97, 24},{ 93,255},{2,0}},
+  {/*1*/{ 97, 40},{ 93,223},{3,0}},  {/*1*/{ 97, 81},{ 93,142},{4,0}},  {/*1*/{105, 32},{101,247},{3,0}},  {/*1*/{105, 65},{101,182},{2,0}},
+  {/*1*/{105,130},{101, 52},{1,0}},  {/*1*/{105, 32},{101,255},{0,0}},  {/*1*/{105, 65},{101,190},{1,0}},  {/*1*/{105, 40},{101,247},{2,0}},
+  {/*1*/{105, 48},{101,231},{3,0}},  {/*1*/{105, 89},{101,150},{4,0}},  {/*1*/{113, 40},{109,255},{3,0}},  {/*1*/{113, 65},{109,207},{2,0}},
+  {/*1*/{113,130},{109, 77},{1,0}},  {/*1*/{113, 48},{109,247},{0,0}},  {/*1*/{113, 65},{109,215},{1,0}},  {/*1*/{113, 48},{109,255},{2,0}},
+  {/*1*/{113, 56},{109,239},{3,0}},  {/*1*/{113, 97},{109,158},{4,0}},  {/*1*/{121, 56},{117,247},{3,0}},  {/*1*/{121, 65},{117,231},{2,0}},
+  {/*1*/{121,130},{117,101},{1,0}},  {/*1*/{121, 56},{117,255},{0,0}},  {/*1*/{121, 65},{117,239},{1,0}},  {/*1*/{121,130},{117,109},{2,0}},
+  {/*1*/{121, 65},{117,247},{3,0}},  {/*1*/{121, 89},{117,199},{4,0}},  {/*1*/{130,154},{134, 69},{4,0}},  {/*1*/{130, 65},{134,255},{3,0}},
+  {/*1*/{130,130},{134,125},{2,0}},  {/*1*/{130, 73},{134,247},{1,1}},  {/*1*/{130, 73},{134,247},{0,0}},  {/*1*/{130,130},{134,134},{1,0}},
+  {/*1*/{130, 73},{134,255},{2,0}},  {/*1*/{130, 97},{134,207},{3,0}},  {/*1*/{130,162},{134, 77},{4,0}},  {/*1*/{138, 81},{134,247},{3,0}},
+  {/*1*/{138,130},{134,150},{2,0}},  {/*1*/{138,195},{134, 20},{1,0}},  {/*1*/{138, 81},{134,255},{0,0}},  {/*1*/{138,130},{134,158},{1,0}},
+  {/*1*/{138, 89},{134,247},{2,0}},  {/*1*/{138,105},{134,215},{3,0}},  {/*1*/{138,146},{134,134},{4,0}},  {/*1*/{146, 89},{142,255},{3,0}},
+  {/*1*/{146,130},{142,174},{2,0}},  {/*1*/{146,195},{142, 44},{1,0}},  {/*1*/{146, 97},{142,247},{0,0}},  {/*1*/{146,130},{142,182},{1,0}},
+  {/*1*/{146, 97},{142,255},{2,0}},  {/*1*/{146,113},{142,223},{3,0}},  {/*1*/{146,154},{142,142},{4,0}},  {/*1*/{154,105},{150,247},{3,0}},
+  {/*1*/{154,130},{150,199},{2,0}},  {/*1*/{154,195},{150, 69},{1,0}},  {/*1*/{154,105},{150,255},{0,0}},  {/*1*/{154,130},{150,207},{1,0}},
+  {/*1*/{154,113},{150,247},{2,0}},  {/*1*/{154,121},{150,231},{3,0}},  {/*1*/{154,138},{150,199},{4,0}},  {/*1*/{162,113},{158,255},{3,0}},
+  {/*1*/{162,130},{158,223},{2,0}},  {/*1*/{162,195},{158, 93},{1,0}},  {/*1*/{162,121},{158,247},{0,0}},  {/*1*/{162,130},{158,231},{1,0}},
+  {/*1*/{162,121},{158,255},{2,0}},  {/*1*/{162,130},{158,239},{3,0}},  {/*1*/{162,146},{158,207},{4,0}},  {/*1*/{170,211},{166, 77},{3,0}},
+  {/*1*/{170,130},{166,247},{2,0}},  {/*1*/{170,195},{166,117},{1,0}},  {/*0*/{170,130},{166,255},{0,1}},  {/*1*/{170,130},{166,255},{1,0}},
+  {/*1*/{170,195},{166,125},{2,0}},  {/*1*/{170,138},{166,247},{3,0}},  {/*1*/{170,154},{166,215},{4,0}},  {/*1*/{178,219},{174, 85},{3,0}},
+  {/*1*/{178,138},{174,255},{2,0}},  {/*1*/{178,195},{174,142},{1,0}},  {/*0*/{178,146},{174,247},{0,1}},  {/*1*/{178,146},{174,247},{1,0}},
+  {/*1*/{178,195},{174,150},{2,0}},  {/*1*/{178,146},{174,255},{3,0}},  {/*1*/{178,162},{174,223},{4,0}},  {/*1*/{186,227},{182, 93},{3,0}},
+  {/*1*/{186,154},{182,247},{2,0}},  {/*1*/{186,195},{182,166},{1,0}},  {/*0*/{186,154},{182,255},{0,1}},  {/*1*/{186,154},{182,255},{1,0}},
+  {/*1*/{186,195},{182,174},{2,0}},  {/*1*/{186,162},{182,247},{3,0}},  {/*1*/{186,170},{182,231},{4,0}},  {/*1*/{195,219},{199,134},{4,0}},
+  {/*1*/{195,162},{199,255},{3,0}},  {/*1*/{195,195},{199,190},{2,0}},  {/*1*/{195,170},{199,247},{1,1}},  {/*1*/{195,170},{199,247},{0,0}},
+  {/*1*/{195,195},{199,199},{1,0}},  {/*1*/{195,170},{199,255},{2,0}},  {/*1*/{195,178},{199,239},{3,0}},  {/*1*/{195,227},{199,142},{4,0}},
+  {/*1*/{203,178},{199,247},{3,0}},  {/*1*/{203,195},{199,215},{2,0}},  {/*1*/{203,178},{199,255},{1,1}},  {/*1*/{203,178},{199,255},{0,0}},
+  {/*1*/{203,195},{199,223},{1,0}},  {/*1*/{203,186},{199,247},{2,1}},  {/*1*/{203,186},{199,247},{3,0}},  {/*1*/{203,211},{199,199},{4,0}},
+  {/*1*/{211,186},{207,255},{3,0}},  {/*1*/{211,195},{207,239},{2,0}},  {/*1*/{211,195},{207,239},{1,1}},  {/*0*/{211,195},{207,247},{0,1}},
+  {/*1*/{211,195},{207,247},{1,0}},  {/*1*/{211,195},{207,247},{2,1}},  {/*1*/{211,195},{207,255},{3,0}},  {/*1*/{211,219},{207,207},{4,0}},
+  {/*1*/{219,203},{215,247},{3,1}},  {/*1*/{219,203},{215,247},{2,0}},  {/*1*/{219,203},{215,247},{1,1}},  {/*0*/{219,203},{215,255},{0,1}},
+  {/*1*/{219,203},{215,255},{1,0}},  {/*1*/{219,203},{215,255},{2,1}},  {/*1*/{219,211},{215,247},{3,0}},  {/*1*/{219,227},{215,215},{4,0}},
+  {/*1*/{227,211},{223,255},{3,1}},  {/*1*/{227,211},{223,255},{2,0}},  {/*1*/{227,211},{223,255},{1,1}},  {/*0*/{227,219},{223,247},{0,1}},
+  {/*1*/{227,219},{223,247},{1,0}},  {/*1*/{227,219},{223,247},{2,1}},  {/*1*/{227,219},{223,255},{3,0}},  {/*1*/{227,235},{223,223},{4,0}},
+  {/*1*/{235,227},{231,247},{3,1}},  {/*1*/{235,227},{231,247},{2,0}},  {/*1*/{235,227},{231,247},{1,1}},  {/*0*/{235,227},{231,255},{0,1}},
+  {/*1*/{235,227},{231,255},{1,0}},  {/*1*/{235,227},{231,255},{2,1}},  {/*1*/{235,235},{231,247},{3,0}},  {/*1*/{235,243},{231,231},{4,0}},
+  {/*1*/{243,235},{239,255},{3,1}},  {/*1*/{243,235},{239,255},{2,0}},  {/*1*/{243,235},{239,255},{1,1}},  {/*0*/{243,243},{239,247},{0,1}},
+  {/*1*/{243,243},{239,247},{1,0}},  {/*1*/{243,243},{239,247},{2,1}},  {/*1*/{243,243},{239,255},{3,0}},  {/*1*/{243,251},{239,239},{4,0}},
+  {/*1*/{251,251},{247,247},{3,1}},  {/*1*/{251,251},{247,247},{2,0}},  {/*1*/{251,251},{247,247},{1,1}},  {/*0*/{251,251},{247,255},{0,1}},
+  {/*1*/{251,251},{247,255},{1,0}},  {/*1*/{251,251},{247,255},{2,1}},  {/*1*/{251,251},{247,255},{3,2}},  {/*1*/{251,251},{247,255},{4,3}}
 },{
-  {{/*1*/{  4,  4,4},{  4,  4,4}}},  {{/*1*/{  4,  4,3},{  4,  4,3}}},  {{/*1*/{  4,  4,2},{  4,  4,2}}},  {{/*1*/{  4,  4,1},{  4,  4,1}}},
-  {{/*1*/{  4,  4,0},{  4,  4,0}}},  {{/*1*/{  4,  4,1},{  4,  4,1}}},  {{/*1*/{  4,  4,2},{  4, 12,0}}},  {{/*1*/{  4,  4,3},{  4, 12,1}}},
-  {{/*1*/{  4,  4,4},{  4, 20,1}}},  {{/*1*/{ 12, 12,3},{  4, 20,0}}},  {{/*1*/{ 12, 12,2},{  4, 20,1}}},  {{/*1*/{ 12, 12,1},{  4, 28,0}}},
-  {{/*1*/{ 12, 12,0},{ 12, 12,0}}},  {{/*1*/{ 12, 12,1},{  4, 36,1}}},  {{/*1*/{ 12, 12,2},{  4, 36,0}}},  {{/*1*/{ 12, 12,3},{  4, 36,1}}},
-  {{/*1*/{ 12, 12,4},{  4, 44,1}}},  {{/*1*/{ 20, 20,3},{  4, 44,0}}},  {{/*1*/{ 20, 20,2},{  4, 44,1}}},  {{/*1*/{ 20, 20,1},{  4, 52,0}}},
-  {{/*1*/{ 20, 20,0},{ 20, 20,0}}},  {{/*1*/{ 20, 20,1},{  4, 60,1}}},  {{/*1*/{ 20, 20,2},{  4, 60,0}}},  {{/*1*/{ 20, 20,3},{  4, 60,1}}},
-  {{/*1*/{ 20, 20,4},{  4, 69,1}}},  {{/*1*/{ 28, 28,3},{  4, 69,0}}},  {{/*1*/{ 28, 28,2},{  4, 69,1}}},  {{/*1*/{ 28, 28,1},{  4, 77,0}}},
-  {{/*1*/{ 28, 28,0},{ 28, 28,0}}},  {{/*1*/{ 28, 28,1},{  4, 85,1}}},  {{/*1*/{ 28, 28,2},{  4, 85,0}}},  {{/*1*/{ 28, 28,3},{  4, 85,1}}},
-  {{/*1*/{ 28, 28,4},{  4, 93,1}}},  {{/*1*/{ 36, 36,3},{  4, 93,0}}},  {{/*1*/{ 36, 36,2},{  4, 93,1}}},  {{/*1*/{ 36, 36,1},{  4,101,0}}},
-  {{/*1*/{ 36, 36,0},{ 20, 69,0}}},  {{/*1*/{ 36, 36,1},{  4,109,1}}},  {{/*1*/{ 36, 36,2},{  4,109,0}}},  {{/*1*/{ 36, 36,3},{  4,109,1}}},
-  {{/*1*/{ 36, 36,4},{  4,117,1}}},  {{/*1*/{ 44, 44,3},{  4,117,0}}},  {{/*1*/{ 44, 44,2},{  4,117,1}}},  {{/*1*/{ 44, 44,1},{  4,125,0}}},
-  {{/*1*/{ 44, 44,0},{ 28, 77,0}}},  {{/*1*/{ 44, 44,1},{  4,134,1}}},  {{/*1*/{ 44, 44,2},{  4,134,0}}},  {{/*1*/{ 44, 44,3},{ 69,  4,0}}},
-  {{/*1*/{ 44, 44,4},{  4,142,1}}},  {{/*1*/{ 52, 52,3},{  4,142,0}}},  {{/*1*/{ 52, 52,2},{ 69, 12,0}}},  {{/*1*/{ 52, 52,1},{  4,150,0}}},
-  {{/*1*/{ 52, 52,0},{ 12,134,0}}},  {{/*1*/{ 52, 52,1},{ 77,  4,0}}},  {{/*1*/{ 52, 52,2},{  4,158,0}}},  {{/*1*/{ 52, 52,3},{ 69, 28,0}}},
-  {{/*1*/{ 52, 52,4},{  4,166,1}}},  {{/*1*/{ 60, 60,3},{  4,166,0}}},  {{/*1*/{ 60, 60,2},{ 69, 36,0}}},  {{/*1*/{ 60, 60,1},{  4,174,0}}},
-  {{/*1*/{ 60, 60,0},{ 20,142,0}}},  {{/*1*/{ 60, 60,1},{ 85, 12,0}}},  {{/*1*/{ 60, 60,2},{  4,182,0}}},  {{/*1*/{ 60, 60,3},{ 69, 52,0}}},
-  {{/*1*/{ 60, 60,4},{  4,190,1}}},  {{/*1*/{ 69, 69,4},{  4,190,0}}},  {{/*1*/{ 69, 69,3},{ 69, 60,0}}},  {{/*1*/{ 69, 69,2},{  4,199,0}}},
-  {{/*1*/{ 69, 69,1},{ 28,150,0}}},  {{/*1*/{ 69, 69,0},{ 69, 69,0}}},  {{/*1*/{ 69, 69,1},{  4,207,0}}},  {{/*1*/{ 69, 69,2},{ 69, 77,0}}},
-  {{/*1*/{ 69, 69,3},{  4,215,1}}},  {{/*1*/{ 69, 69,4},{  4,215,0}}},  {{/*1*/{ 77, 77,3},{ 69, 85,0}}},  {{/*1*/{ 77, 77,2},{  4,223,0}}},
-  {{/*1*/{ 77, 77,1},{ 36,158,0}}},  {{/*1*/{ 77, 77,0},{ 77, 77,0}}},  {{/*1*/{ 77, 77,1},{  4,231,0}}},  {{/*1*/{ 77, 77,2},{ 69,101,0}}},
-  {{/*1*/{ 77, 77,3},{  4,239,1}}},  {{/*1*/{ 77, 77,4},{  4,239,0}}},  {{/*1*/{ 85, 85,3},{ 69,109,0}}},  {{/*1*/{ 85, 85,2},{  4,247,0}}},
-  {{/*1*/{ 85, 85,1},{ 28,199,0}}},  {{/*1*/{ 85, 85,0},{ 85, 85,0}}},  {{/*1*/{ 85, 85,1},{  4,255,0}}},  {{/*1*/{ 85, 85,2},{ 69,125,0}}},
-  {{/*1*/{ 85, 85,3},{ 12,247,1}}},  {{/*1*/{ 85, 85,4},{ 12,247,0}}},  {{/*1*/{ 93, 93,3},{ 69,134,0}}},  {{/*1*/{ 93, 93,2},{ 12,255,0}}},
-  {{/*1*/{ 93, 93,1},{ 36,207,0}}},  {{/*1*/{ 93, 93,0},{ 93, 93,0}}},  {{/*1*/{ 93, 93,1},{ 20,247,0}}},  {{/*1*/{ 93, 93,2},{ 69,150,0}}},
-  {{/*1*/{ 93, 93,3},{134, 20,0}}},  {{/*1*/{ 93, 93,4},{ 20,255,0}}},  {{/*1*/{101,101,3},{ 69,158,0}}},  {{/*1*/{101,101,2},{ 28,247,0}}},
-  {{/*1*/{101,101,1},{ 44,215,0}}},  {{/*1*/{101,101,0},{ 85,134,0}}},  {{/*1*/{101,101,1},{ 28,255,0}}},  {{/*1*/{101,101,2},{ 69,174,0}}},
-  {{/*1*/{101,101,3},{134, 44,0}}},  {{/*1*/{101,101,4},{ 36,247,0}}},  {{/*1*/{109,109,3},{ 69,182,0}}},  {{/*1*/{109,109,2},{ 36,255,0}}},
-  {{/*1*/{109,109,1},{ 52,223,0}}},  {{/*1*/{109,109,0},{ 93,142,0}}},  {{/*1*/{109,109,1},{ 44,247,0}}},  {{/*1*/{109,109,2},{ 69,199,0}}},
-  {{/*1*/{109,109,3},{134, 69,0}}},  {{/*1*/{109,109,4},{ 44,255,0}}},  {{/*1*/{117,117,3},{ 69,207,0}}},  {{/*1*/{117,117,2},{ 52,247,0}}},
-  {{/*1*/{117,117,1},{ 60,231,0}}},  {{/*1*/{117,117,0},{ 77,199,0}}},  {{/*1*/{117,117,1},{ 52,255,0}}},  {{/*1*/{117,117,2},{ 69,223,0}}},
-  {{/*1*/{117,117,3},{134, 93,0}}},  {{/*1*/{117,117,4},{ 60,247,0}}},  {{/*1*/{125,125,3},{ 69,231,0}}},  {{/*1*/{125,125,2},{ 60,255,0}}},
-  {{/*1*/{125,125,1},{ 69,239,0}}},  {{/*1*/{125,125,0},{ 85,207,0}}},  {{/*1*/{125,125,1},{150, 77,0}}},  {{/*1*/{125,125,2},{ 69,247,0}}},
-  {{/*1*/{125,125,3},{134,117,0}}},  {{/*1*/{125,125,4},{ 69,255,1}}},  {{/*1*/{134,134,4},{ 69,255,0}}},  {{/*1*/{134,134,3},{134,125,0}}},
-  {{/*1*/{134,134,2},{ 77,247,0}}},  {{/*1*/{134,134,1},{ 93,215,0}}},  {{/*1*/{134,134,0},{134,134,0}}},  {{/*1*/{134,134,1},{ 77,255,0}}},
-  {{/*1*/{134,134,2},{134,142,0}}},  {{/*1*/{134,134,3},{199, 12,0}}},  {{/*1*/{134,134,4},{ 85,247,0}}},  {{/*1*/{142,142,3},{134,150,0}}},
-  {{/*1*/{142,142,2},{ 85,255,0}}},  {{/*1*/{142,142,1},{101,223,0}}},  {{/*1*/{142,142,0},{142,142,0}}},  {{/*1*/{142,142,1},{ 93,247,0}}},
-  {{/*1*/{142,142,2},{134,166,0}}},  {{/*1*/{142,142,3},{199, 36,0}}},  {{/*1*/{142,142,4},{ 93,255,0}}},  {{/*1*/{150,150,3},{134,174,0}}},
-  {{/*1*/{150,150,2},{101,247,0}}},  {{/*1*/{150,150,1},{109,231,0}}},  {{/*1*/{150,150,0},{150,150,0}}},  {{/*1*/{150,150,1},{101,255,0}}},
-  {{/*1*/{150,150,2},{134,190,0}}},  {{/*1*/{150,150,3},{199, 60,0}}},  {{/*1*/{150,150,4},{109,247,0}}},  {{/*1*/{158,158,3},{134,199,0}}},
-  {{/*1*/{158,158,2},{109,255,0}}},  {{/*1*/{158,158,1},{117,239,0}}},  {{/*1*/{158,158,0},{158,158,0}}},  {{/*1*/{158,158,1},{117,247,0}}},
-  {{/*1*/{158,158,2},{134,215,0}}},  {{/*1*/{158,158,3},{199, 85,0}}},  {{/*1*/{158,158,4},{117,255,0}}},  {{/*1*/{166,166,3},{134,223,0}}},
-  {{/*1*/{166,166,2},{199, 93,0}}},  {{/*1*/{166,166,1},{125,247,0}}},  {{/*1*/{166,166,0},{150,199,0}}},  {{/*1*/{166,166,1},{125,255,0}}},
-  {{/*1*/{166,166,2},{134,239,0}}},  {{/*1*/{166,166,3},{199,109,0}}},  {{/*1*/{166,166,4},{134,247,1}}},  {{/*1*/{174,174,3},{134,247,0}}},
-  {{/*1*/{174,174,2},{199,117,0}}},  {{/*1*/{174,174,1},{134,255,0}}},  {{/*1*/{174,174,0},{158,207,0}}},  {{/*1*/{174,174,1},{223, 77,0}}},
-  {{/*1*/{174,174,2},{142,247,0}}},  {{/*1*/{174,174,3},{199,134,0}}},  {{/*1*/{174,174,4},{142,255,1}}},  {{/*1*/{182,182,3},{142,255,0}}},
-  {{/*1*/{182,182,2},{199,142,0}}},  {{/*1*/{182,182,1},{150,247,0}}},  {{/*1*/{182,182,0},{166,215,0}}},  {{/*1*/{182,182,1},{207,134,0}}},
-  {{/*1*/{182,182,2},{150,255,0}}},  {{/*1*/{182,182,3},{199,158,0}}},  {{/*1*/{182,182,4},{158,247,1}}},  {{/*1*/{190,190,3},{158,247,0}}},
-  {{/*1*/{190,190,2},{199,166,0}}},  {{/*1*/{190,190,1},{158,255,0}}},  {{/*1*/{190,190,0},{174,223,0}}},  {{/*1*/{190,190,1},{215,142,0}}},
-  {{/*1*/{190,190,2},{166,247,0}}},  {{/*1*/{190,190,3},{199,182,0}}},  {{/*1*/{190,190,4},{166,255,1}}},  {{/*1*/{199,199,4},{166,255,0}}},
-  {{/*1*/{199,199,3},{199,190,0}}},  {{/*1*/{199,199,2},{174,247,0}}},  {{/*1*/{199,199,1},{182,231,0}}},  {{/*1*/{199,199,0},{199,199,0}}},
-  {{/*1*/{199,199,1},{174,255,0}}},  {{/*1*/{199,199,2},{199,207,0}}},  {{/*1*/{199,199,3},{182,247,1}}},  {{/*1*/{199,199,4},{182,247,0}}},
-  {{/*1*/{207,207,3},{199,215,0}}},  {{/*1*/{207,207,2},{182,255,0}}},  {{/*1*/{207,207,1},{190,239,0}}},  {{/*1*/{207,207,0},{207,207,0}}},
-  {{/*1*/{207,207,1},{190,247,0}}},  {{/*1*/{207,207,2},{199,231,0}}},  {{/*1*/{207,207,3},{190,255,1}}},  {{/*1*/{207,207,4},{190,255,0}}},
-  {{/*1*/{215,215,3},{199,239,0}}},  {{/*1*/{215,215,2},{199,239,1}}},  {{/*1*/{215,215,1},{199,247,0}}},  {{/*1*/{215,215,0},{215,215,0}}},
-  {{/*1*/{215,215,1},{199,255,1}}},  {{/*1*/{215,215,2},{199,255,0}}},  {{/*1*/{215,215,3},{199,255,1}}},  {{/*1*/{215,215,4},{207,247,1}}},
-  {{/*1*/{223,223,3},{207,247,0}}},  {{/*1*/{223,223,2},{207,247,1}}},  {{/*1*/{223,223,1},{207,255,0}}},  {{/*1*/{223,223,0},{223,223,0}}},
-  {{/*1*/{223,223,1},{215,247,1}}},  {{/*1*/{223,223,2},{215,247,0}}},  {{/*1*/{223,223,3},{215,247,1}}},  {{/*1*/{223,223,4},{215,255,1}}},
-  {{/*1*/{231,231,3},{215,255,0}}},  {{/*1*/{231,231,2},{215,255,1}}},  {{/*1*/{231,231,1},{223,247,0}}},  {{/*1*/{231,231,0},{231,231,0}}},
-  {{/*1*/{231,231,1},{223,255,1}}},  {{/*1*/{231,231,2},{223,255,0}}},  {{/*1*/{231,231,3},{223,255,1}}},  {{/*1*/{231,231,4},{231,247,1}}},
-  {{/*1*/{239,239,3},{231,247,0}}},  {{/*1*/{239,239,2},{231,247,1}}},  {{/*1*/{239,239,1},{231,255,0}}},  {{/*1*/{239,239,0},{239,239,0}}},
-  {{/*1*/{239,239,1},{239,239,1}}},  {{/*1*/{239,239,2},{239,247,0}}},  {{/*1*/{239,239,3},{239,247,1}}},  {{/*1*/{239,239,4},{239,255,1}}},
-  {{/*1*/{247,247,3},{239,255,0}}},  {{/*1*/{247,247,2},{239,255,1}}},  {{/*1*/{247,247,1},{247,247,1}}},  {{/*1*/{247,247,0},{247,247,0}}},
-  {{/*1*/{247,247,1},{247,247,1}}},  {{/*1*/{247,247,2},{247,255,0}}},  {{/*1*/{247,247,3},{247,255,1}}},  {{/*1*/{247,247,4},{255,247,1}}},
-  {{/*1*/{255,255,3},{255,247,0}}},  {{/*1*/{255,255,2},{255,247,1}}},  {{/*1*/{255,255,1},{255,255,1}}},  {{/*1*/{255,255,0},{255,255,0}}}
+  {/*1*/{  4,  4},{  4,  4},{4,4}},  {/*1*/{  4,  4},{  4,  4},{3,3}},  {/*1*/{  4,  4},{  4,  4},{2,2}},  {/*1*/{  4,  4},{  4,  4},{1,1}},
+  {/*1*/{  4,  4},{  4,  4},{0,0}},  {/*1*/{  4,  4},{  4,  4},{1,1}},  {/*1*/{  4,  4},{  4, 12},{2,0}},  {/*1*/{  4,  4},{  4, 12},{3,1}},
+  {/*1*/{  4,  4},{  4, 20},{4,1}},  {/*1*/{ 12,  4},{ 12, 20},{3,0}},  {/*1*/{ 12,  4},{ 12, 20},{2,1}},  {/*1*/{ 12,  4},{ 12, 28},{1,0}},
+  {/*1*/{ 12, 12},{ 12, 12},{0,0}},  {/*1*/{ 12,  4},{ 12, 36},{1,1}},  {/*1*/{ 12,  4},{ 12, 36},{2,0}},  {/*1*/{ 12,  4},{ 12, 36},{3,1}},
+  {/*1*/{ 12,  4},{ 12, 44},{4,1}},  {/*1*/{ 20,  4},{ 20, 44},{3,0}},  {/*1*/{ 20,  4},{ 20, 44},{2,1}},  {/*1*/{ 20,  4},{ 20, 52},{1,0}},
+  {/*1*/{ 20, 20},{ 20, 20},{0,0}},  {/*1*/{ 20,  4},{ 20, 60},{1,1}},  {/*1*/{ 20,  4},{ 20, 60},{2,0}},  {/*1*/{ 20,  4},{ 20, 60},{3,1}},
+  {/*1*/{ 20,  4},{ 20, 69},{4,1}},  {/*1*/{ 28,  4},{ 28, 69},{3,0}},  {/*1*/{ 28,  4},{ 28, 69},{2,1}},  {/*1*/{ 28,  4},{ 28, 77},{1,0}},
+  {/*1*/{ 28, 28},{ 28, 28},{0,0}},  {/*1*/{ 28,  4},{ 28, 85},{1,1}},  {/*1*/{ 28,  4},{ 28, 85},{2,0}},  {/*1*/{ 28,  4},{ 28, 85},{3,1}},
+  {/*1*/{ 28,  4},{ 28, 93},{4,1}},  {/*1*/{ 36,  4},{ 36, 93},{3,0}},  {/*1*/{ 36,  4},{ 36, 93},{2,1}},  {/*1*/{ 36,  4},{ 36,101},{1,0}},
+  {/*1*/{ 36, 20},{ 36, 69},{0,0}},  {/*1*/{ 36,  4},{ 36,109},{1,1}},  {/*1*/{ 36,  4},{ 36,109},{2,0}},  {/*1*/{ 36,  4},{ 36,109},{3,1}},
+  {/*1*/{ 36,  4},{ 36,117},{4,1}},  {/*1*/{ 44,  4},{ 44,117},{3,0}},  {/*1*/{ 44,  4},{ 44,117},{2,1}},  {/*1*/{ 44,  4},{ 44,125},{1,0}},
+  {/*1*/{ 44, 28},{ 44, 77},{0,0}},  {/*1*/{ 44,  4},{ 44,134},{1,1}},  {/*1*/{ 44,  4},{ 44,134},{2,0}},  {/*1*/{ 44, 69},{ 44,  4},{3,0}},
+  {/*1*/{ 44,  4},{ 44,142},{4,1}},  {/*1*/{ 52,  4},{ 52,142},{3,0}},  {/*1*/{ 52, 69},{ 52, 12},{2,0}},  {/*1*/{ 52,  4},{ 52,150},{1,0}},
+  {/*1*/{ 52, 12},{ 52,134},{0,0}},  {/*1*/{ 52, 77},{ 52,  4},{1,0}},  {/*1*/{ 52,  4},{ 52,158},{2,0}},  {/*1*/{ 52, 69},{ 52, 28},{3,0}},
+  {/*1*/{ 52,  4},{ 52,166},{4,1}},  {/*1*/{ 60,  4},{ 60,166},{3,0}},  {/*1*/{ 60, 69},{ 60, 36},{2,0}},  {/*1*/{ 60,  4},{ 60,174},{1,0}},
+  {/*1*/{ 60, 20},{ 60,142},{0,0}},  {/*1*/{ 60, 85},{ 60, 12},{1,0}},  {/*1*/{ 60,  4},{ 60,182},{2,0}},  {/*1*/{ 60, 69},{ 60, 52},{3,0}},
+  {/*1*/{ 60,  4},{ 60,190},{4,1}},  {/*1*/{ 69,  4},{ 69,190},{4,0}},  {/*1*/{ 69, 69},{ 69, 60},{3,0}},  {/*1*/{ 69,  4},{ 69,199},{2,0}},
+  {/*1*/{ 69, 28},{ 69,150},{1,0}},  {/*1*/{ 69, 69},{ 69, 69},{0,0}},  {/*1*/{ 69,  4},{ 69,207},{1,0}},  {/*1*/{ 69, 69},{ 69, 77},{2,0}},
+  {/*1*/{ 69,  4},{ 69,215},{3,1}},  {/*1*/{ 69,  4},{ 69,215},{4,0}},  {/*1*/{ 77, 69},{ 77, 85},{3,0}},  {/*1*/{ 77,  4},{ 77,223},{2,0}},
+  {/*1*/{ 77, 36},{ 77,158},{1,0}},  {/*1*/{ 77, 77},{ 77, 77},{0,0}},  {/*1*/{ 77,  4},{ 77,231},{1,0}},  {/*1*/{ 77, 69},{ 77,101},{2,0}},
+  {/*1*/{ 77,  4},{ 77,239},{3,1}},  {/*1*/{ 77,  4},{ 77,239},{4,0}},  {/*1*/{ 85, 69},{ 85,109},{3,0}},  {/*1*/{ 85,  4},{ 85,247},{2,0}},
+  {/*1*/{ 85, 28},{ 85,199},{1,0}},  {/*1*/{ 85, 85},{ 85, 85},{0,0}},  {/*1*/{ 85,  4},{ 85,255},{1,0}},  {/*1*/{ 85, 69},{ 85,125},{2,0}},
+  {/*1*/{ 85, 12},{ 85,247},{3,1}},  {/*1*/{ 85, 12},{ 85,247},{4,0}},  {/*1*/{ 93, 69},{ 93,134},{3,0}},  {/*1*/{ 93, 12},{ 93,255},{2,0}},
+  {/*1*/{ 93, 36},{ 93,207},{1,0}},  {/*1*/{ 93, 93},{ 93, 93},{0,0}},  {/*1*/{ 93, 20},{ 93,247},{1,0}},  {/*1*/{ 93, 69},{ 93,150},{2,0}},
+  {/*1*/{ 93,134},{ 93, 20},{3,0}},  {/*1*/{ 93, 20},{ 93,255},{4,0}},  {/*1*/{101, 69},{101,158},{3,0}},  {/*1*/{101, 28},{101,247},{2,0}},
+  {/*1*/{101, 44},{101,215},{1,0}},  {/*1*/{101, 85},{101,134},{0,0}},  {/*1*/{101, 28},{101,255},{1,0}},  {/*1*/{101, 69},{101,174},{2,0}},
+  {/*1*/{101,134},{101, 44},{3,0}},  {/*1*/{101, 36},{101,247},{4,0}},  {/*1*/{109, 69},{109,182},{3,0}},  {/*1*/{109, 36},{109,255},{2,0}},
+  {/*1*/{109, 52},{109,223},{1,0}},  {/*1*/{109, 93},{109,142},{0,0}},  {/*1*/{109, 44},{109,247},{1,0}},  {/*1*/{109, 69},{109,199},{2,0}},
+  {/*1*/{109,134},{109, 69},{3,0}},  {/*1*/{109, 44},{109,255},{4,0}},  {/*1*/{117, 69},{117,207},{3,0}},  {/*1*/{117, 52},{117,247},{2,0}},
+  {/*1*/{117, 60},{117,231},{1,0}},  {/*1*/{117, 77},{117,199},{0,0}},  {/*1*/{117, 52},{117,255},{1,0}},  {/*1*/{117, 69},{117,223},{2,0}},
+  {/*1*/{117,134},{117, 93},{3,0}},  {/*1*/{117, 60},{117,247},{4,0}},  {/*1*/{125, 69},{125,231},{3,0}},  {/*1*/{125, 60},{125,255},{2,0}},
+  {/*1*/{125, 69},{125,239},{1,0}},  {/*1*/{125, 85},{125,207},{0,0}},  {/*1*/{125,150},{125, 77},{1,0}},  {/*1*/{125, 69},{125,247},{2,0}},
+  {/*1*/{125,134},{125,117},{3,0}},  {/*1*/{125, 69},{125,255},{4,1}},  {/*1*/{134, 69},{134,255},{4,0}},  {/*1*/{134,134},{134,125},{3,0}},
+  {/*1*/{134, 77},{134,247},{2,0}},  {/*1*/{134, 93},{134,215},{1,0}},  {/*1*/{134,134},{134,134},{0,0}},  {/*1*/{134, 77},{134,255},{1,0}},
+  {/*1*/{134,134},{134,142},{2,0}},  {/*1*/{134,199},{134, 12},{3,0}},  {/*1*/{134, 85},{134,247},{4,0}},  {/*1*/{142,134},{142,150},{3,0}},
+  {/*1*/{142, 85},{142,255},{2,0}},  {/*1*/{142,101},{142,223},{1,0}},  {/*1*/{142,142},{142,142},{0,0}},  {/*1*/{142, 93},{142,247},{1,0}},
+  {/*1*/{142,134},{142,166},{2,0}},  {/*1*/{142,199},{142, 36},{3,0}},  {/*1*/{142, 93},{142,255},{4,0}},  {/*1*/{150,134},{150,174},{3,0}},
+  {/*1*/{150,101},{150,247},{2,0}},  {/*1*/{150,109},{150,231},{1,0}},  {/*1*/{150,150},{150,150},{0,0}},  {/*1*/{150,101},{150,255},{1,0}},
+  {/*1*/{150,134},{150,190},{2,0}},  {/*1*/{150,199},{150, 60},{3,0}},  {/*1*/{150,109},{150,247},{4,0}},  {/*1*/{158,134},{158,199},{3,0}},
+  {/*1*/{158,109},{158,255},{2,0}},  {/*1*/{158,117},{158,239},{1,0}},  {/*1*/{158,158},{158,158},{0,0}},  {/*1*/{158,117},{158,247},{1,0}},
+  {/*1*/{158,134},{158,215},{2,0}},  {/*1*/{158,199},{158, 85},{3,0}},  {/*1*/{158,117},{158,255},{4,0}},  {/*1*/{166,134},{166,223},{3,0}},
+  {/*1*/{166,199},{166, 93},{2,0}},  {/*1*/{166,125},{166,247},{1,0}},  {/*1*/{166,150},{166,199},{0,0}},  {/*1*/{166,125},{166,255},{1,0}},
+  {/*1*/{166,134},{166,239},{2,0}},  {/*1*/{166,199},{166,109},{3,0}},  {/*1*/{166,134},{166,247},{4,1}},  {/*1*/{174,134},{174,247},{3,0}},
+  {/*1*/{174,199},{174,117},{2,0}},  {/*1*/{174,134},{174,255},{1,0}},  {/*1*/{174,158},{174,207},{0,0}},  {/*1*/{174,223},{174, 77},{1,0}},
+  {/*1*/{174,142},{174,247},{2,0}},  {/*1*/{174,199},{174,134},{3,0}},  {/*1*/{174,142},{174,255},{4,1}},  {/*1*/{182,142},{182,255},{3,0}},
+  {/*1*/{182,199},{182,142},{2,0}},  {/*1*/{182,150},{182,247},{1,0}},  {/*1*/{182,166},{182,215},{0,0}},  {/*1*/{182,207},{182,134},{1,0}},
+  {/*1*/{182,150},{182,255},{2,0}},  {/*1*/{182,199},{182,158},{3,0}},  {/*1*/{182,158},{182,247},{4,1}},  {/*1*/{190,158},{190,247},{3,0}},
+  {/*1*/{190,199},{190,166},{2,0}},  {/*1*/{190,158},{190,255},{1,0}},  {/*1*/{190,174},{190,223},{0,0}},  {/*1*/{190,215},{190,142},{1,0}},
+  {/*1*/{190,166},{190,247},{2,0}},  {/*1*/{190,199},{190,182},{3,0}},  {/*1*/{190,166},{190,255},{4,1}},  {/*1*/{199,166},{199,255},{4,0}},
+  {/*1*/{199,199},{199,190},{3,0}},  {/*1*/{199,174},{199,247},{2,0}},  {/*1*/{199,182},{199,231},{1,0}},  {/*1*/{199,199},{199,199},{0,0}},
+  {/*1*/{199,174},{199,255},{1,0}},  {/*1*/{199,199},{199,207},{2,0}},  {/*1*/{199,182},{199,247},{3,1}},  {/*1*/{199,182},{199,247},{4,0}},
+  {/*1*/{207,199},{207,215},{3,0}},  {/*1*/{207,182},{207,255},{2,0}},  {/*1*/{207,190},{207,239},{1,0}},  {/*1*/{207,207},{207,207},{0,0}},
+  {/*1*/{207,190},{207,247},{1,0}},  {/*1*/{207,199},{207,231},{2,0}},  {/*1*/{207,190},{207,255},{3,1}},  {/*1*/{207,190},{207,255},{4,0}},
+  {/*1*/{215,199},{215,239},{3,0}},  {/*1*/{215,199},{215,239},{2,1}},  {/*1*/{215,199},{215,247},{1,0}},  {/*1*/{215,215},{215,215},{0,0}},
+  {/*1*/{215,199},{215,255},{1,1}},  {/*1*/{215,199},{215,255},{2,0}},  {/*1*/{215,199},{215,255},{3,1}},  {/*1*/{215,207},{215,247},{4,1}},
+  {/*1*/{223,207},{223,247},{3,0}},  {/*1*/{223,207},{223,247},{2,1}},  {/*1*/{223,207},{223,255},{1,0}},  {/*1*/{223,223},{223,223},{0,0}},
+  {/*1*/{223,215},{223,247},{1,1}},  {/*1*/{223,215},{223,247},{2,0}},  {/*1*/{223,215},{223,247},{3,1}},  {/*1*/{223,215},{223,255},{4,1}},
+  {/*1*/{231,215},{231,255},{3,0}},  {/*1*/{231,215},{231,255},{2,1}},  {/*1*/{231,223},{231,247},{1,0}},  {/*1*/{231,231},{231,231},{0,0}},
+  {/*1*/{231,223},{231,255},{1,1}},  {/*1*/{231,223},{231,255},{2,0}},  {/*1*/{231,223},{231,255},{3,1}},  {/*1*/{231,231},{231,247},{4,1}},
+  {/*1*/{239,231},{239,247},{3,0}},  {/*1*/{239,231},{239,247},{2,1}},  {/*1*/{239,231},{239,255},{1,0}},  {/*1*/{239,239},{239,239},{0,0}},
+  {/*1*/{239,239},{239,239},{1,1}},  {/*1*/{239,239},{239,247},{2,0}},  {/*1*/{239,239},{239,247},{3,1}},  {/*1*/{239,239},{239,255},{4,1}},
+  {/*1*/{247,239},{247,255},{3,0}},  {/*1*/{247,239},{247,255},{2,1}},  {/*1*/{247,247},{247,247},{1,1}},  {/*1*/{247,247},{247,247},{0,0}},
+  {/*1*/{247,247},{247,247},{1,1}},  {/*1*/{247,247},{247,255},{2,0}},  {/*1*/{247,247},{247,255},{3,1}},  {/*1*/{247,255},{247,247},{4,1}},
+  {/*1*/{255,255},{255,247},{3,0}},  {/*1*/{255,255},{255,247},{2,1}},  {/*1*/{255,255},{255,255},{1,1}},  {/*1*/{255,255},{255,255},{0,0}}
 }
 };
 
@@ -821,265 +821,265 @@ static PaletteSingleLookup2 const sp_lookup_5u1_4[4][256] =
 static PaletteSingleLookup2 const sp_lookup_7u1_4[4][256] =
 {
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  0,  0,1},{  0,  4,0}}},  {{/*1*/{  2,  2,0},{  0,  8,0}}},  {{/*1*/{  2,  2,1},{  0, 10,0}}},
-  {{/*1*/{  4,  4,0},{  0, 14,0}}},  {{/*1*/{  4,  4,1},{  0, 16,0}}},  {{/*1*/{  6,  6,0},{  0, 20,0}}},  {{/*1*/{  6,  6,1},{  0, 22,0}}},
-  {{/*1*/{  8,  8,0},{  0, 26,0}}},  {{/*1*/{  8,  8,1},{  0, 28,0}}},  {{/*1*/{ 10, 10,0},{  0, 32,0}}},  {{/*1*/{ 10, 10,1},{  0, 34,0}}},
-  {{/*1*/{ 12, 12,0},{  0, 38,0}}},  {{/*1*/{ 12, 12,1},{  0, 40,0}}},  {{/*1*/{ 14, 14,0},{  0, 44,0}}},  {{/*1*/{ 14, 14,1},{  0, 46,0}}},
-  {{/*1*/{ 16, 16,0},{  0, 50,0}}},  {{/*1*/{ 16, 16,1},{  0, 52,0}}},  {{/*1*/{ 18, 18,0},{  0, 56,0}}},  {{/*1*/{ 18, 18,1},{  0, 58,0}}},
-  {{/*1*/{ 20, 20,0},{  0, 62,0}}},  {{/*1*/{ 20, 20,1},{  0, 64,0}}},  {{/*1*/{ 22, 22,0},{  0, 68,0}}},  {{/*1*/{ 22, 22,1},{  0, 72,0}}},
-  {{/*1*/{ 24, 24,0},{  0, 74,0}}},  {{/*1*/{ 24, 24,1},{  0, 78,0}}},  {{/*1*/{ 26, 26,0},{  0, 80,0}}},  {{/*1*/{ 26, 26,1},{  0, 84,0}}},
-  {{/*1*/{ 28, 28,0},{  0, 86,0}}},  {{/*1*/{ 28, 28,1},{  0, 90,0}}},  {{/*1*/{ 30, 30,0},{  0, 92,0}}},  {{/*1*/{ 30, 30,1},{  0, 96,0}}},
-  {{/*1*/{ 32, 32,0},{  0, 98,0}}},  {{/*1*/{ 32, 32,1},{  0,102,0}}},  {{/*1*/{ 34, 34,0},{  0,104,0}}},  {{/*1*/{ 34, 34,1},{  0,108,0}}},
-  {{/*1*/{ 36, 36,0},{  0,110,0}}},  {{/*1*/{ 36, 36,1},{  0,114,0}}},  {{/*1*/{ 38, 38,0},{  0,116,0}}},  {{/*1*/{ 38, 38,1},{  0,120,0}}},
-  {{/*1*/{ 40, 40,0},{  0,122,0}}},  {{/*1*/{ 40, 40,1},{  0,126,0}}},  {{/*1*/{ 42, 42,0},{  0,128,0}}},  {{/*1*/{ 42, 42,1},{  0,132,0}}},
-  {{/*1*/{ 44, 44,0},{  0,136,0}}},  {{/*1*/{ 44, 44,1},{  0,138,0}}},  {{/*1*/{ 46, 46,0},{  0,142,0}}},  {{/*1*/{ 46, 46,1},{  0,144,0}}},
-  {{/*1*/{ 48, 48,0},{  0,148,0}}},  {{/*1*/{ 48, 48,1},{  0,150,0}}},  {{/*1*/{ 50, 50,0},{  0,154,0}}},  {{/*1*/{ 50, 50,1},{  0,156,0}}},
-  {{/*1*/{ 52, 52,0},{  0,160,0}}},  {{/*1*/{ 52, 52,1},{  0,162,0}}},  {{/*1*/{ 54, 54,0},{  0,166,0}}},  {{/*1*/{ 54, 54,1},{  0,168,0}}},
-  {{/*1*/{ 56, 56,0},{  0,172,0}}},  {{/*1*/{ 56, 56,1},{  0,174,0}}},  {{/*1*/{ 58, 58,0},{  0,178,0}}},  {{/*1*/{ 58, 58,1},{  0,180,0}}},
-  {{/*1*/{ 60, 60,0},{  0,184,0}}},  {{/*1*/{ 60, 60,1},{  0,186,0}}},  {{/*1*/{ 62, 62,0},{  0,190,0}}},  {{/*1*/{ 62, 62,1},{  0,192,0}}},
-  {{/*1*/{ 64, 64,0},{  0,196,0}}},  {{/*1*/{ 64, 64,1},{  0,200,0}}},  {{/*1*/{ 66, 66,0},{  0,202,0}}},  {{/*1*/{ 66, 66,1},{  0,206,0}}},
-  {{/*1*/{ 68, 68,0},{  0,208,0}}},  {{/*1*/{ 68, 68,1},{  0,212,0}}},  {{/*1*/{ 70, 70,0},{  0,214,0}}},  {{/*1*/{ 70, 70,1},{  0,218,0}}},
-  {{/*1*/{ 72, 72,0},{  0,220,0}}},  {{/*1*/{ 72, 72,1},{  0,224,0}}},  {{/*1*/{ 74, 74,0},{  0,226,0}}},  {{/*1*/{ 74, 74,1},{  0,230,0}}},
-  {{/*1*/{ 76, 76,0},{  0,232,0}}},  {{/*1*/{ 76, 76,1},{  0,236,0}}},  {{/*1*/{ 78, 78,0},{  0,238,0}}},  {{/*1*/{ 78, 78,1},{  0,242,0}}},
-  {{/*1*/{ 80, 80,0},{  0,244,0}}},  {{/*1*/{ 80, 80,1},{  0,248,0}}},  {{/*1*/{ 82, 82,0},{  0,250,0}}},  {{/*1*/{ 82, 82,1},{  0,254,0}}},
-  {{/*1*/{ 84, 84,0},{  2,252,0}}},  {{/*1*/{ 84, 84,1},{  4,252,0}}},  {{/*1*/{ 86, 86,0},{  4,254,0}}},  {{/*1*/{ 86, 86,1},{  6,254,0}}},
-  {{/*1*/{ 88, 88,0},{  8,252,0}}},  {{/*1*/{ 88, 88,1},{ 10,252,0}}},  {{/*1*/{ 90, 90,0},{ 10,254,0}}},  {{/*1*/{ 90, 90,1},{ 12,254,0}}},
-  {{/*1*/{ 92, 92,0},{ 14,252,0}}},  {{/*1*/{ 92, 92,1},{ 16,252,0}}},  {{/*1*/{ 94, 94,0},{ 16,254,0}}},  {{/*1*/{ 94, 94,1},{ 18,254,0}}},
-  {{/*1*/{ 96, 96,0},{ 20,252,0}}},  {{/*1*/{ 96, 96,1},{ 22,252,0}}},  {{/*1*/{ 98, 98,0},{ 22,254,0}}},  {{/*1*/{ 98, 98,1},{ 24,254,0}}},
-  {{/*1*/{100,100,0},{ 26,252,0}}},  {{/*1*/{100,100,1},{ 28,252,0}}},  {{/*1*/{102,102,0},{ 28,254,0}}},  {{/*1*/{102,102,1},{ 30,254,0}}},
-  {{/*1*/{104,104,0},{ 32,252,0}}},  {{/*1*/{104,104,1},{ 34,252,0}}},  {{/*1*/{106,106,0},{ 34,254,0}}},  {{/*1*/{106,106,1},{ 36,254,0}}},
-  {{/*1*/{108,108,0},{ 38,252,0}}},  {{/*1*/{108,108,1},{ 40,252,0}}},  {{/*1*/{110,110,0},{ 40,254,0}}},  {{/*1*/{110,110,1},{ 42,254,0}}},
-  {{/*1*/{112,112,0},{ 44,252,0}}},  {{/*1*/{112,112,1},{ 46,252,0}}},  {{/*1*/{114,114,0},{ 46,254,0}}},  {{/*1*/{114,114,1},{ 48,254,0}}},
-  {{/*1*/{116,116,0},{ 50,252,0}}},  {{/*1*/{116,116,1},{ 52,252,0}}},  {{/*1*/{118,118,0},{ 52,254,0}}},  {{/*1*/{118,118,1},{ 54,254,0}}},
-  {{/*1*/{120,120,0},{ 56,252,0}}},  {{/*1*/{120,120,1},{ 58,250,0}}},  {{/*1*/{122,122,0},{ 58,254,0}}},  {{/*1*/{122,122,1},{ 60,252,0}}},
-  {{/*1*/{124,124,0},{ 62,252,0}}},  {{/*1*/{124,124,1},{ 62,254,0}}},  {{/*1*/{126,126,0},{ 64,254,0}}},  {{/*1*/{126,126,1},{ 66,252,0}}},
-  {{/*1*/{128,128,0},{ 68,252,0}}},  {{/*1*/{128,128,1},{ 68,254,0}}},  {{/*1*/{130,130,0},{ 70,254,0}}},  {{/*1*/{130,130,1},{ 72,252,0}}},
-  {{/*1*/{132,132,0},{ 74,252,0}}},  {{/*1*/{132,132,1},{ 74,254,0}}},  {{/*1*/{134,134,0},{ 76,254,0}}},  {{/*1*/{134,134,1},{ 78,252,0}}},
-  {{/*1*/{136,136,0},{ 80,252,0}}},  {{/*1*/{136,136,1},{ 80,254,0}}},  {{/*1*/{138,138,0},{ 82,254,0}}},  {{/*1*/{138,138,1},{ 84,252,0}}},
-  {{/*1*/{140,140,0},{ 86,252,0}}},  {{/*1*/{140,140,1},{ 86,254,0}}},  {{/*1*/{142,142,0},{ 88,254,0}}},  {{/*1*/{142,142,1},{ 90,252,0}}},
-  {{/*1*/{144,144,0},{ 92,252,0}}},  {{/*1*/{144,144,1},{ 92,254,0}}},  {{/*1*/{146,146,0},{ 94,254,0}}},  {{/*1*/{146,146,1},{ 96,252,0}}},
-  {{/*1*/{148,148,0},{ 98,252,0}}},  {{/*1*/{148,148,1},{ 98,254,0}}},  {{/*1*/{150,150,0},{100,254,0}}},  {{/*1*/{150,150,1},{102,252,0}}},
-  {{/*1*/{152,152,0},{104,252,0}}},  {{/*1*/{152,152,1},{104,254,0}}},  {{/*1*/{154,154,0},{106,254,0}}},  {{/*1*/{154,154,1},{108,252,0}}},
-  {{/*1*/{156,156,0},{110,252,0}}},  {{/*1*/{156,156,1},{110,254,0}}},  {{/*1*/{158,158,0},{112,254,0}}},  {{/*1*/{158,158,1},{114,252,0}}},
-  {{/*1*/{160,160,0},{116,252,0}}},  {{/*1*/{160,160,1},{116,254,0}}},  {{/*1*/{162,162,0},{118,254,0}}},  {{/*1*/{162,162,1},{120,252,0}}},
-  {{/*1*/{164,164,0},{122,250,0}}},  {{/*1*/{164,164,1},{122,254,0}}},  {{/*1*/{166,166,0},{124,252,0}}},  {{/*1*/{166,166,1},{126,252,0}}},
-  {{/*1*/{168,168,0},{126,254,0}}},  {{/*1*/{168,168,1},{128,254,0}}},  {{/*1*/{170,170,0},{130,252,0}}},  {{/*1*/{170,170,1},{132,252,0}}},
-  {{/*1*/{172,172,0},{132,254,0}}},  {{/*1*/{172,172,1},{134,254,0}}},  {{/*1*/{174,174,0},{136,252,0}}},  {{/*1*/{174,174,1},{138,252,0}}},
-  {{/*1*/{176,176,0},{138,254,0}}},  {{/*1*/{176,176,1},{140,254,0}}},  {{/*1*/{178,178,0},{142,252,0}}},  {{/*1*/{178,178,1},{144,252,0}}},
-  {{/*1*/{180,180,0},{144,254,0}}},  {{/*1*/{180,180,1},{146,254,0}}},  {{/*1*/{182,182,0},{148,252,0}}},  {{/*1*/{182,182,1},{150,252,0}}},
-  {{/*1*/{184,184,0},{150,254,0}}},  {{/*1*/{184,184,1},{152,254,0}}},  {{/*1*/{186,186,0},{154,252,0}}},  {{/*1*/{186,186,1},{156,252,0}}},
-  {{/*1*/{188,188,0},{156,254,0}}},  {{/*1*/{188,188,1},{158,254,0}}},  {{/*1*/{190,190,0},{160,252,0}}},  {{/*1*/{190,190,1},{162,252,0}}},
-  {{/*1*/{192,192,0},{162,254,0}}},  {{/*1*/{192,192,1},{164,254,0}}},  {{/*1*/{194,194,0},{166,252,0}}},  {{/*1*/{194,194,1},{168,252,0}}},
-  {{/*1*/{196,196,0},{168,254,0}}},  {{/*1*/{196,196,1},{170,254,0}}},  {{/*1*/{198,198,0},{172,252,0}}},  {{/*1*/{198,198,1},{174,252,0}}},
-  {{/*1*/{200,200,0},{174,254,0}}},  {{/*1*/{200,200,1},{176,254,0}}},  {{/*1*/{202,202,0},{178,252,0}}},  {{/*1*/{202,202,1},{180,252,0}}},
-  {{/*1*/{204,204,0},{180,254,0}}},  {{/*1*/{204,204,1},{182,254,0}}},  {{/*1*/{206,206,0},{184,252,0}}},  {{/*1*/{206,206,1},{186,250,0}}},
-  {{/*1*/{208,208,0},{186,254,0}}},  {{/*1*/{208,208,1},{188,252,0}}},  {{/*1*/{210,210,0},{190,252,0}}},  {{/*1*/{210,210,1},{190,254,0}}},
-  {{/*1*/{212,212,0},{192,254,0}}},  {{/*1*/{212,212,1},{194,252,0}}},  {{/*1*/{214,214,0},{196,252,0}}},  {{/*1*/{214,214,1},{196,254,0}}},
-  {{/*1*/{216,216,0},{198,254,0}}},  {{/*1*/{216,216,1},{200,252,0}}},  {{/*1*/{218,218,0},{202,252,0}}},  {{/*1*/{218,218,1},{202,254,0}}},
-  {{/*1*/{220,220,0},{204,254,0}}},  {{/*1*/{220,220,1},{206,252,0}}},  {{/*1*/{222,222,0},{208,252,0}}},  {{/*1*/{222,222,1},{208,254,0}}},
-  {{/*1*/{224,224,0},{210,254,0}}},  {{/*1*/{224,224,1},{212,252,0}}},  {{/*1*/{226,226,0},{214,252,0}}},  {{/*1*/{226,226,1},{214,254,0}}},
-  {{/*1*/{228,228,0},{216,254,0}}},  {{/*1*/{228,228,1},{218,252,0}}},  {{/*1*/{230,230,0},{220,252,0}}},  {{/*1*/{230,230,1},{220,254,0}}},
-  {{/*1*/{232,232,0},{222,254,0}}},  {{/*1*/{232,232,1},{224,252,0}}},  {{/*1*/{234,234,0},{226,252,0}}},  {{/*1*/{234,234,1},{226,254,0}}},
-  {{/*1*/{236,236,0},{228,254,0}}},  {{/*1*/{236,236,1},{230,252,0}}},  {{/*1*/{238,238,0},{232,252,0}}},  {{/*1*/{238,238,1},{232,254,0}}},
-  {{/*1*/{240,240,0},{234,254,0}}},  {{/*1*/{240,240,1},{236,252,0}}},  {{/*1*/{242,242,0},{238,252,0}}},  {{/*1*/{242,242,1},{238,254,0}}},
-  {{/*1*/{244,244,0},{240,254,0}}},  {{/*1*/{244,244,1},{242,252,0}}},  {{/*1*/{246,246,0},{244,252,0}}},  {{/*1*/{246,246,1},{244,254,0}}},
-  {{/*1*/{248,248,0},{246,254,0}}},  {{/*1*/{248,248,1},{248,252,0}}},  {{/*1*/{250,250,0},{250,250,0}}},  {{/*1*/{250,250,1},{250,254,0}}},
-  {{/*1*/{252,252,0},{252,252,0}}},  {{/*1*/{252,252,1},{254,252,0}}},  {{/*1*/{254,254,0},{254,254,0}}},  {{/*1*/{254,254,1},{254,254,1}}}
+  {/*1*/{  0,  0},{  0,  0},{0,0}},  {/*1*/{  0,  0},{  0,  4},{1,0}},  {/*1*/{  2,  0},{  2,  8},{0,0}},  {/*1*/{  2,  0},{  2, 10},{1,0}},
+  {/*1*/{  4,  0},{  4, 14},{0,0}},  {/*1*/{  4,  0},{  4, 16},{1,0}},  {/*1*/{  6,  0},{  6, 20},{0,0}},  {/*1*/{  6,  0},{  6, 22},{1,0}},
+  {/*1*/{  8,  0},{  8, 26},{0,0}},  {/*1*/{  8,  0},{  8, 28},{1,0}},  {/*1*/{ 10,  0},{ 10, 32},{0,0}},  {/*1*/{ 10,  0},{ 10, 34},{1,0}},
+  {/*1*/{ 12,  0},{ 12, 38},{0,0}},  {/*1*/{ 12,  0},{ 12, 40},{1,0}},  {/*1*/{ 14,  0},{ 14, 44},{0,0}},  {/*1*/{ 14,  0},{ 14, 46},{1,0}},
+  {/*1*/{ 16,  0},{ 16, 50},{0,0}},  {/*1*/{ 16,  0},{ 16, 52},{1,0}},  {/*1*/{ 18,  0},{ 18, 56},{0,0}},  {/*1*/{ 18,  0},{ 18, 58},{1,0}},
+  {/*1*/{ 20,  0},{ 20, 62},{0,0}},  {/*1*/{ 20,  0},{ 20, 64},{1,0}},  {/*1*/{ 22,  0},{ 22, 68},{0,0}},  {/*1*/{ 22,  0},{ 22, 72},{1,0}},
+  {/*1*/{ 24,  0},{ 24, 74},{0,0}},  {/*1*/{ 24,  0},{ 24, 78},{1,0}},  {/*1*/{ 26,  0},{ 26, 80},{0,0}},  {/*1*/{ 26,  0},{ 26, 84},{1,0}},
+  {/*1*/{ 28,  0},{ 28, 86},{0,0}},  {/*1*/{ 28,  0},{ 28, 90},{1,0}},  {/*1*/{ 30,  0},{ 30, 92},{0,0}},  {/*1*/{ 30,  0},{ 30, 96},{1,0}},
+  {/*1*/{ 32,  0},{ 32, 98},{0,0}},  {/*1*/{ 32,  0},{ 32,102},{1,0}},  {/*1*/{ 34,  0},{ 34,104},{0,0}},  {/*1*/{ 34,  0},{ 34,108},{1,0}},
+  {/*1*/{ 36,  0},{ 36,110},{0,0}},  {/*1*/{ 36,  0},{ 36,114},{1,0}},  {/*1*/{ 38,  0},{ 38,116},{0,0}},  {/*1*/{ 38,  0},{ 38,120},{1,0}},
+  {/*1*/{ 40,  0},{ 40,122},{0,0}},  {/*1*/{ 40,  0},{ 40,126},{1,0}},  {/*1*/{ 42,  0},{ 42,128},{0,0}},  {/*1*/{ 42,  0},{ 42,132},{1,0}},
+  {/*1*/{ 44,  0},{ 44,136},{0,0}},  {/*1*/{ 44,  0},{ 44,138},{1,0}},  {/*1*/{ 46,  0},{ 46,142},{0,0}},  {/*1*/{ 46,  0},{ 46,144},{1,0}},
+  {/*1*/{ 48,  0},{ 48,148},{0,0}},  {/*1*/{ 48,  0},{ 48,150},{1,0}},  {/*1*/{ 50,  0},{ 50,154},{0,0}},  {/*1*/{ 50,  0},{ 50,156},{1,0}},
+  {/*1*/{ 52,  0},{ 52,160},{0,0}},  {/*1*/{ 52,  0},{ 52,162},{1,0}},  {/*1*/{ 54,  0},{ 54,166},{0,0}},  {/*1*/{ 54,  0},{ 54,168},{1,0}},
+  {/*1*/{ 56,  0},{ 56,172},{0,0}},  {/*1*/{ 56,  0},{ 56,174},{1,0}},  {/*1*/{ 58,  0},{ 58,178},{0,0}},  {/*1*/{ 58,  0},{ 58,180},{1,0}},
+  {/*1*/{ 60,  0},{ 60,184},{0,0}},  {/*1*/{ 60,  0},{ 60,186},{1,0}},  {/*1*/{ 62,  0},{ 62,190},{0,0}},  {/*1*/{ 62,  0},{ 62,192},{1,0}},
+  {/*1*/{ 64,  0},{ 64,196},{0,0}},  {/*1*/{ 64,  0},{ 64,200},{1,0}},  {/*1*/{ 66,  0},{ 66,202},{0,0}},  {/*1*/{ 66,  0},{ 66,206},{1,0}},
+  {/*1*/{ 68,  0},{ 68,208},{0,0}},  {/*1*/{ 68,  0},{ 68,212},{1,0}},  {/*1*/{ 70,  0},{ 70,214},{0,0}},  {/*1*/{ 70,  0},{ 70,218},{1,0}},
+  {/*1*/{ 72,  0},{ 72,220},{0,0}},  {/*1*/{ 72,  0},{ 72,224},{1,0}},  {/*1*/{ 74,  0},{ 74,226},{0,0}},  {/*1*/{ 74,  0},{ 74,230},{1,0}},
+  {/*1*/{ 76,  0},{ 76,232},{0,0}},  {/*1*/{ 76,  0},{ 76,236},{1,0}},  {/*1*/{ 78,  0},{ 78,238},{0,0}},  {/*1*/{ 78,  0},{ 78,242},{1,0}},
+  {/*1*/{ 80,  0},{ 80,244},{0,0}},  {/*1*/{ 80,  0},{ 80,248},{1,0}},  {/*1*/{ 82,  0},{ 82,250},{0,0}},  {/*1*/{ 82,  0},{ 82,254},{1,0}},
+  {/*1*/{ 84,  2},{ 84,252},{0,0}},  {/*1*/{ 84,  4},{ 84,252},{1,0}},  {/*1*/{ 86,  4},{ 86,254},{0,0}},  {/*1*/{ 86,  6},{ 86,254},{1,0}},
+  {/*1*/{ 88,  8},{ 88,252},{0,0}},  {/*1*/{ 88, 10},{ 88,252},{1,0}},  {/*1*/{ 90, 10},{ 90,254},{0,0}},  {/*1*/{ 90, 12},{ 90,254},{1,0}},
+  {/*1*/{ 92, 14},{ 92,252},{0,0}},  {/*1*/{ 92, 16},{ 92,252},{1,0}},  {/*1*/{ 94, 16},{ 94,254},{0,0}},  {/*1*/{ 94, 18},{ 94,254},{1,0}},
+  {/*1*/{ 96, 20},{ 96,252},{0,0}},  {/*1*/{ 96, 22},{ 96,252},{1,0}},  {/*1*/{ 98, 22},{ 98,254},{0,0}},  {/*1*/{ 98, 24},{ 98,254},{1,0}},
+  {/*1*/{100, 26},{100,252},{0,0}},  {/*1*/{100, 28},{100,252},{1,0}},  {/*1*/{102, 28},{102,254},{0,0}},  {/*1*/{102, 30},{102,254},{1,0}},
+  {/*1*/{104, 32},{104,252},{0,0}},  {/*1*/{104, 34},{104,252},{1,0}},  {/*1*/{106, 34},{106,254},{0,0}},  {/*1*/{106, 36},{106,254},{1,0}},
+  {/*1*/{108, 38},{108,252},{0,0}},  {/*1*/{108, 40},{108,252},{1,0}},  {/*1*/{110, 40},{110,254},{0,0}},  {/*1*/{110, 42},{110,254},{1,0}},
+  {/*1*/{112, 44},{112,252},{0,0}},  {/*1*/{112, 46},{112,252},{1,0}},  {/*1*/{114, 46},{114,254},{0,0}},  {/*1*/{114, 48},{114,254},{1,0}},
+  {/*1*/{116, 50},{116,252},{0,0}},  {/*1*/{116, 52},{116,252},{1,0}},  {/*1*/{118, 52},{118,254},{0,0}},  {/*1*/{118, 54},{118,254},{1,0}},
+  {/*1*/{120, 56},{120,252},{0,0}},  {/*1*/{120, 58},{120,250},{1,0}},  {/*1*/{122, 58},{122,254},{0,0}},  {/*1*/{122, 60},{122,252},{1,0}},
+  {/*1*/{124, 62},{124,252},{0,0}},  {/*1*/{124, 62},{124,254},{1,0}},  {/*1*/{126, 64},{126,254},{0,0}},  {/*1*/{126, 66},{126,252},{1,0}},
+  {/*1*/{128, 68},{128,252},{0,0}},  {/*1*/{128, 68},{128,254},{1,0}},  {/*1*/{130, 70},{130,254},{0,0}},  {/*1*/{130, 72},{130,252},{1,0}},
+  {/*1*/{132, 74},{132,252},{0,0}},  {/*1*/{132, 74},{132,254},{1,0}},  {/*1*/{134, 76},{134,254},{0,0}},  {/*1*/{134, 78},{134,252},{1,0}},
+  {/*1*/{136, 80},{136,252},{0,0}},  {/*1*/{136, 80},{136,254},{1,0}},  {/*1*/{138, 82},{138,254},{0,0}},  {/*1*/{138, 84},{138,252},{1,0}},
+  {/*1*/{140, 86},{140,252},{0,0}},  {/*1*/{140, 86},{140,254},{1,0}},  {/*1*/{142, 88},{142,254},{0,0}},  {/*1*/{142, 90},{142,252},{1,0}},
+  {/*1*/{144, 92},{144,252},{0,0}},  {/*1*/{144, 92},{144,254},{1,0}},  {/*1*/{146, 94},{146,254},{0,0}},  {/*1*/{146, 96},{146,252},{1,0}},
+  {/*1*/{148, 98},{148,252},{0,0}},  {/*1*/{148, 98},{148,254},{1,0}},  {/*1*/{150,100},{150,254},{0,0}},  {/*1*/{150,102},{150,252},{1,0}},
+  {/*1*/{152,104},{152,252},{0,0}},  {/*1*/{152,104},{152,254},{1,0}},  {/*1*/{154,106},{154,254},{0,0}},  {/*1*/{154,108},{154,252},{1,0}},
+  {/*1*/{156,110},{156,252},{0,0}},  {/*1*/{156,110},{156,254},{1,0}},  {/*1*/{158,112},{158,254},{0,0}},  {/*1*/{158,114},{158,252},{1,0}},
+  {/*1*/{160,116},{160,252},{0,0}},  {/*1*/{160,116},{160,254},{1,0}},  {/*1*/{162,118},{162,254},{0,0}},  {/*1*/{162,120},{162,252},{1,0}},
+  {/*1*/{164,122},{164,250},{0,0}},  {/*1*/{164,122},{164,254},{1,0}},  {/*1*/{166,124},{166,252},{0,0}},  {/*1*/{166,126},{166,252},{1,0}},
+  {/*1*/{168,126},{168,254},{0,0}},  {/*1*/{168,128},{168,254},{1,0}},  {/*1*/{170,130},{170,252},{0,0}},  {/*1*/{170,132},{170,252},{1,0}},
+  {/*1*/{172,132},{172,254},{0,0}},  {/*1*/{172,134},{172,254},{1,0}},  {/*1*/{174,136},{174,252},{0,0}},  {/*1*/{174,138},{174,252},{1,0}},
+  {/*1*/{176,138},{176,254},{0,0}},  {/*1*/{176,140},{176,254},{1,0}},  {/*1*/{178,142},{178,252},{0,0}},  {/*1*/{178,144},{178,252},{1,0}},
+  {/*1*/{180,144},{180,254},{0,0}},  {/*1*/{180,146},{180,254},{1,0}},  {/*1*/{182,148},{182,252},{0,0}},  {/*1*/{182,150},{182,252},{1,0}},
+  {/*1*/{184,150},{184,254},{0,0}},  {/*1*/{184,152},{184,254},{1,0}},  {/*1*/{186,154},{186,252},{0,0}},  {/*1*/{186,156},{186,252},{1,0}},
+  {/*1*/{188,156},{188,254},{0,0}},  {/*1*/{188,158},{188,254},{1,0}},  {/*1*/{190,160},{190,252},{0,0}},  {/*1*/{190,162},{190,252},{1,0}},
+  {/*1*/{192,162},{192,254},{0,0}},  {/*1*/{192,164},{192,254},{1,0}},  {/*1*/{194,166},{194,252},{0,0}},  {/*1*/{194,168},{194,252},{1,0}},
+  {/*1*/{196,168},{196,254},{0,0}},  {/*1*/{196,170},{196,254},{1,0}},  {/*1*/{198,172},{198,252},{0,0}},  {/*1*/{198,174},{198,252},{1,0}},
+  {/*1*/{200,174},{200,254},{0,0}},  {/*1*/{200,176},{200,254},{1,0}},  {/*1*/{202,178},{202,252},{0,0}},  {/*1*/{202,180},{202,252},{1,0}},
+  {/*1*/{204,180},{204,254},{0,0}},  {/*1*/{204,182},{204,254},{1,0}},  {/*1*/{206,184},{206,252},{0,0}},  {/*1*/{206,186},{206,250},{1,0}},
+  {/*1*/{208,186},{208,254},{0,0}},  {/*1*/{208,188},{208,252},{1,0}},  {/*1*/{210,190},{210,252},{0,0}},  {/*1*/{210,190},{210,254},{1,0}},
+  {/*1*/{212,192},{212,254},{0,0}},  {/*1*/{212,194},{212,252},{1,0}},  {/*1*/{214,196},{214,252},{0,0}},  {/*1*/{214,196},{214,254},{1,0}},
+  {/*1*/{216,198},{216,254},{0,0}},  {/*1*/{216,200},{216,252},{1,0}},  {/*1*/{218,202},{218,252},{0,0}},  {/*1*/{218,202},{218,254},{1,0}},
+  {/*1*/{220,204},{220,254},{0,0}},  {/*1*/{220,206},{220,252},{1,0}},  {/*1*/{222,208},{222,252},{0,0}},  {/*1*/{222,208},{222,254},{1,0}},
+  {/*1*/{224,210},{224,254},{0,0}},  {/*1*/{224,212},{224,252},{1,0}},  {/*1*/{226,214},{226,252},{0,0}},  {/*1*/{226,214},{226,254},{1,0}},
+  {/*1*/{228,216},{228,254},{0,0}},  {/*1*/{228,218},{228,252},{1,0}},  {/*1*/{230,220},{230,252},{0,0}},  {/*1*/{230,220},{230,254},{1,0}},
+  {/*1*/{232,222},{232,254},{0,0}},  {/*1*/{232,224},{232,252},{1,0}},  {/*1*/{234,226},{234,252},{0,0}},  {/*1*/{234,226},{234,254},{1,0}},
+  {/*1*/{236,228},{236,254},{0,0}},  {/*1*/{236,230},{236,252},{1,0}},  {/*1*/{238,232},{238,252},{0,0}},  {/*1*/{238,232},{238,254},{1,0}},
+  {/*1*/{240,234},{240,254},{0,0}},  {/*1*/{240,236},{240,252},{1,0}},  {/*1*/{242,238},{242,252},{0,0}},  {/*1*/{242,238},{242,254},{1,0}},
+  {/*1*/{244,240},{244,254},{0,0}},  {/*1*/{244,242},{244,252},{1,0}},  {/*1*/{246,244},{246,252},{0,0}},  {/*1*/{246,244},{246,254},{1,0}},
+  {/*1*/{248,246},{248,254},{0,0}},  {/*1*/{248,248},{248,252},{1,0}},  {/*1*/{250,250},{250,250},{0,0}},  {/*1*/{250,250},{250,254},{1,0}},
+  {/*1*/{252,252},{252,252},{0,0}},  {/*1*/{252,254},{252,252},{1,0}},  {/*1*/{254,254},{254,254},{0,0}},  {/*1*/{254,254},{254,254},{1,1}}
 },{
-  {{/*1*/{  1,  0,1},{  1,  0,0}}},  {{/*1*/{  1,  0,0},{  1,  2,0}}},  {{/*1*/{  1,  0,1},{  1,  6,0}}},  {{/*1*/{  3,  2,0},{  1,  8,0}}},
-  {{/*1*/{  3,  2,1},{  1, 12,0}}},  {{/*1*/{  5,  4,0},{  1, 14,0}}},  {{/*1*/{  5,  4,1},{  1, 18,0}}},  {{/*1*/{  7,  6,0},{  1, 20,0}}},
-  {{/*1*/{  7,  6,1},{  1, 24,0}}},  {{/*1*/{  9,  8,0},{  1, 26,0}}},  {{/*1*/{  9,  8,1},{  1, 30,0}}},  {{/*1*/{ 11, 10,0},{  1, 32,0}}},
-  {{/*1*/{ 11, 10,1},{  1, 36,0}}},  {{/*1*/{ 13, 12,0},{  1, 38,0}}},  {{/*1*/{ 13, 12,1},{  1, 42,0}}},  {{/*1*/{ 15, 14,0},{  1, 44,0}}},
-  {{/*1*/{ 15, 14,1},{  1, 48,0}}},  {{/*1*/{ 17, 16,0},{  1, 50,0}}},  {{/*1*/{ 17, 16,1},{  1, 54,0}}},  {{/*1*/{ 19, 18,0},{  1, 56,0}}},
-  {{/*1*/{ 19, 18,1},{  1, 60,0}}},  {{/*1*/{ 21, 20,0},{  1, 62,0}}},  {{/*1*/{ 21, 20,1},{  1, 66,0}}},  {{/*1*/{ 23, 22,0},{  1, 70,0}}},
-  {{/*1*/{ 23, 22,1},{  1, 72,0}}},  {{/*1*/{ 25, 24,0},{  1, 76,0}}},  {{/*1*/{ 25, 24,1},{  1, 78,0}}},  {{/*1*/{ 27, 26,0},{  1, 82,0}}},
-  {{/*1*/{ 27, 26,1},{  1, 84,0}}},  {{/*1*/{ 29, 28,0},{  1, 88,0}}},  {{/*1*/{ 29, 28,1},{  1, 90,0}}},  {{/*1*/{ 31, 30,0},{  1, 94,0}}},
-  {{/*1*/{ 31, 30,1},{  1, 96,0}}},  {{/*1*/{ 33, 32,0},{  1,100,0}}},  {{/*1*/{ 33, 32,1},{  1,102,0}}},  {{/*1*/{ 35, 34,0},{  1,106,0}}},
-  {{/*1*/{ 35, 34,1},{  1,108,0}}},  {{/*1*/{ 37, 36,0},{  1,112,0}}},  {{/*1*/{ 37, 36,1},{  1,114,0}}},  {{/*1*/{ 39, 38,0},{  1,118,0}}},
-  {{/*1*/{ 39, 38,1},{  1,120,0}}},  {{/*1*/{ 41, 40,0},{  1,124,0}}},  {{/*1*/{ 41, 40,1},{  1,126,0}}},  {{/*1*/{ 43, 42,0},{  1,130,0}}},
-  {{/*1*/{ 43, 42,1},{  1,134,0}}},  {{/*1*/{ 45, 44,0},{  1,136,0}}},  {{/*1*/{ 45, 44,1},{  1,140,0}}},  {{/*1*/{ 47, 46,0},{  1,142,0}}},
-  {{/*1*/{ 47, 46,1},{  1,146,0}}},  {{/*1*/{ 49, 48,0},{  1,148,0}}},  {{/*1*/{ 49, 48,1},{  1,152,0}}},  {{/*1*/{ 51, 50,0},{  1,154,0}}},
-  {{/*1*/{ 51, 50,1},{  1,158,0}}},  {{/*1*/{ 53, 52,0},{  1,160,0}}},  {{/*1*/{ 53, 52,1},{  1,164,0}}},  {{/*1*/{ 55, 54,0},{  1,166,0}}},
-  {{/*1*/{ 55, 54,1},{  1,170,0}}},  {{/*1*/{ 57, 56,0},{  1,172,0}}},  {{/*1*/{ 57, 56,1},{  1,176,0}}},  {{/*1*/{ 59, 58,0},{  1,178,0}}},
-  {{/*1*/{ 59, 58,1},{  1,182,0}}},  {{/*1*/{ 61, 60,0},{  1,184,0}}},  {{/*1*/{ 61, 60,1},{  1,188,0}}},  {{/*1*/{ 63, 62,0},{  1,190,0}}},
-  {{/*1*/{ 63, 62,1},{  1,194,0}}},  {{/*1*/{ 65, 64,0},{  1,198,0}}},  {{/*1*/{ 65, 64,1},{  1,200,0}}},  {{/*1*/{ 67, 66,0},{  1,204,0}}},
-  {{/*1*/{ 67, 66,1},{  1,206,0}}},  {{/*1*/{ 69, 68,0},{  1,210,0}}},  {{/*1*/{ 69, 68,1},{  1,212,0}}},  {{/*1*/{ 71, 70,0},{  1,216,0}}},
-  {{/*1*/{ 71, 70,1},{  1,218,0}}},  {{/*1*/{ 73, 72,0},{  1,222,0}}},  {{/*1*/{ 73, 72,1},{  1,224,0}}},  {{/*1*/{ 75, 74,0},{  1,228,0}}},
-  {{/*1*/{ 75, 74,1},{  1,230,0}}},  {{/*1*/{ 77, 76,0},{  1,234,0}}},  {{/*1*/{ 77, 76,1},{  1,236,0}}},  {{/*1*/{ 79, 78,0},{  1,240,0}}},
-  {{/*1*/{ 79, 78,1},{  1,242,0}}},  {{/*1*/{ 81, 80,0},{  1,246,0}}},  {{/*1*/{ 81, 80,1},{  1,248,0}}},  {{/*1*/{ 83, 82,0},{  1,252,0}}},
-  {{/*1*/{ 83, 82,1},{  1,254,0}}},  {{/*1*/{ 85, 84,0},{  3,254,0}}},  {{/*1*/{ 85, 84,1},{  5,252,0}}},  {{/*1*/{ 87, 86,0},{  7,252,0}}},
-  {{/*1*/{ 87, 86,1},{  7,254,0}}},  {{/*1*/{ 89, 88,0},{  9,254,0}}},  {{/*1*/{ 89, 88,1},{ 11,252,0}}},  {{/*1*/{ 91, 90,0},{ 13,252,0}}},
-  {{/*1*/{ 91, 90,1},{ 13,254,0}}},  {{/*1*/{ 93, 92,0},{ 15,254,0}}},  {{/*1*/{ 93, 92,1},{ 17,252,0}}},  {{/*1*/{ 95, 94,0},{ 19,252,0}}},
-  {{/*1*/{ 95, 94,1},{ 19,254,0}}},  {{/*1*/{ 97, 96,0},{ 21,254,0}}},  {{/*1*/{ 97, 96,1},{ 23,252,0}}},  {{/*1*/{ 99, 98,0},{ 25,252,0}}},
-  {{/*1*/{ 99, 98,1},{ 25,254,0}}},  {{/*1*/{101,100,0},{ 27,254,0}}},  {{/*1*/{101,100,1},{ 29,252,0}}},  {{/*1*/{103,102,0},{ 31,252,0}}},
-  {{/*1*/{103,102,1},{ 31,254,0}}},  {{/*1*/{105,104,0},{ 33,254,0}}},  {{/*1*/{105,104,1},{ 35,252,0}}},  {{/*1*/{107,106,0},{ 37,252,0}}},
-  {{/*1*/{107,106,1},{ 37,254,0}}},  {{/*1*/{109,108,0},{ 39,254,0}}},  {{/*1*/{109,108,1},{ 41,252,0}}},  {{/*1*/{111,110,0},{ 43,252,0}}},
-  {{/*1*/{111,110,1},{ 43,254,0}}},  {{/*1*/{113,112,0},{ 45,254,0}}},  {{/*1*/{113,112,1},{ 47,252,0}}},  {{/*1*/{115,114,0},{ 49,252,0}}},
-  {{/*1*/{115,114,1},{ 49,254,0}}},  {{/*1*/{117,116,0},{ 51,254,0}}},  {{/*1*/{117,116,1},{ 53,252,0}}},  {{/*1*/{119,118,0},{ 55,252,0}}},
-  {{/*1*/{119,118,1},{ 55,254,0}}},  {{/*1*/{121,120,0},{ 57,254,0}}},  {{/*1*/{121,120,1},{ 59,252,0}}},  {{/*1*/{123,122,0},{ 61,250,0}}},
-  {{/*1*/{123,122,1},{ 61,254,0}}},  {{/*1*/{125,124,0},{ 63,252,0}}},  {{/*1*/{125,124,1},{ 65,252,0}}},  {{/*1*/{127,126,0},{ 65,254,0}}},
-  {{/*1*/{127,126,1},{ 67,254,0}}},  {{/*1*/{129,128,0},{ 69,252,0}}},  {{/*1*/{129,128,1},{ 71,252,0}}},  {{/*1*/{131,130,0},{ 71,254,0}}},
-  {{/*1*/{131,130,1},{ 73,254,0}}},  {{/*1*/{133,132,0},{ 75,252,0}}},  {{/*1*/{133,132,1},{ 77,252,0}}},  {{/*1*/{135,134,0},{ 77,254,0}}},
-  {{/*1*/{135,134,1},{ 79,254,0}}},  {{/*1*/{137,136,0},{ 81,252,0}}},  {{/*1*/{137,136,1},{ 83,252,0}}},  {{/*1*/{139,138,0},{ 83,254,0}}},
-  {{/*1*/{139,138,1},{ 85,254,0}}},  {{/*1*/{141,140,0},{ 87,252,0}}},  {{/*1*/{141,140,1},{ 89,252,0}}},  {{/*1*/{143,142,0},{ 89,254,0}}},
-  {{/*1*/{143,142,1},{ 91,254,0}}},  {{/*1*/{145,144,0},{ 93,252,0}}},  {{/*1*/{145,144,1},{ 95,252,0}}},  {{/*1*/{147,146,0},{ 95,254,0}}},
-  {{/*1*/{147,146,1},{ 97,254,0}}},  {{/*1*/{149,148,0},{ 99,252,0}}},  {{/*1*/{149,148,1},{101,252,0}}},  {{/*1*/{151,150,0},{101,254,0}}},
-  {{/*1*/{151,150,1},{103,254,0}}},  {{/*1*/{153,152,0},{105,252,0}}},  {{/*1*/{153,152,1},{107,252,0}}},  {{/*1*/{155,154,0},{107,254,0}}},
-  {{/*1*/{155,154,1},{109,254,0}}},  {{/*1*/{157,156,0},{111,252,0}}},  {{/*1*/{157,156,1},{113,252,0}}},  {{/*1*/{159,158,0},{113,254,0}}},
-  {{/*1*/{159,158,1},{115,254,0}}},  {{/*1*/{161,160,0},{117,252,0}}},  {{/*1*/{161,160,1},{119,252,0}}},  {{/*1*/{163,162,0},{119,254,0}}},
-  {{/*1*/{163,162,1},{121,254,0}}},  {{/*1*/{165,164,0},{123,252,0}}},  {{/*1*/{165,164,1},{125,250,0}}},  {{/*1*/{167,166,0},{125,254,0}}},
-  {{/*1*/{167,166,1},{127,252,0}}},  {{/*1*/{169,168,0},{129,252,0}}},  {{/*1*/{169,168,1},{129,254,0}}},  {{/*1*/{171,170,0},{131,254,0}}},
-  {{/*1*/{171,170,1},{133,252,0}}},  {{/*1*/{173,172,0},{135,252,0}}},  {{/*1*/{173,172,1},{135,254,0}}},  {{/*1*/{175,174,0},{137,254,0}}},
-  {{/*1*/{175,174,1},{139,252,0}}},  {{/*1*/{177,176,0},{141,252,0}}},  {{/*1*/{177,176,1},{141,254,0}}},  {{/*1*/{179,178,0},{143,254,0}}},
-  {{/*1*/{179,178,1},{145,252,0}}},  {{/*1*/{181,180,0},{147,252,0}}},  {{/*1*/{181,180,1},{147,254,0}}},  {{/*1*/{183,182,0},{149,254,0}}},
-  {{/*1*/{183,182,1},{151,252,0}}},  {{/*1*/{185,184,0},{153,252,0}}},  {{/*1*/{185,184,1},{153,254,0}}},  {{/*1*/{187,186,0},{155,254,0}}},
-  {{/*1*/{187,186,1},{157,252,0}}},  {{/*1*/{189,188,0},{159,252,0}}},  {{/*1*/{189,188,1},{159,254,0}}},  {{/*1*/{191,190,0},{161,254,0}}},
-  {{/*1*/{191,190,1},{163,252,0}}},  {{/*1*/{193,192,0},{165,252,0}}},  {{/*1*/{193,192,1},{165,254,0}}},  {{/*1*/{195,194,0},{167,254,0}}},
-  {{/*1*/{195,194,1},{169,252,0}}},  {{/*1*/{197,196,0},{171,252,0}}},  {{/*1*/{197,196,1},{171,254,0}}},  {{/*1*/{199,198,0},{173,254,0}}},
-  {{/*1*/{199,198,1},{175,252,0}}},  {{/*1*/{201,200,0},{177,252,0}}},  {{/*1*/{201,200,1},{177,254,0}}},  {{/*1*/{203,202,0},{179,254,0}}},
-  {{/*1*/{203,202,1},{181,252,0}}},  {{/*1*/{205,204,0},{183,252,0}}},  {{/*1*/{205,204,1},{183,254,0}}},  {{/*1*/{207,206,0},{185,254,0}}},
-  {{/*1*/{207,206,1},{187,252,0}}},  {{/*1*/{209,208,0},{189,250,0}}},  {{/*1*/{209,208,1},{189,254,0}}},  {{/*1*/{211,210,0},{191,252,0}}},
-  {{/*1*/{211,210,1},{193,252,0}}},  {{/*1*/{213,212,0},{193,254,0}}},  {{/*1*/{213,212,1},{195,254,0}}},  {{/*1*/{215,214,0},{197,252,0}}},
-  {{/*1*/{215,214,1},{199,252,0}}},  {{/*1*/{217,216,0},{199,254,0}}},  {{/*1*/{217,216,1},{201,254,0}}},  {{/*1*/{219,218,0},{203,252,0}}},
-  {{/*1*/{219,218,1},{205,252,0}}},  {{/*1*/{221,220,0},{205,254,0}}},  {{/*1*/{221,220,1},{207,254,0}}},  {{/*1*/{223,222,0},{209,252,0}}},
-  {{/*1*/{223,222,1},{211,252,0}}},  {{/*1*/{225,224,0},{211,254,0}}},  {{/*1*/{225,224,1},{213,254,0}}},  {{/*1*/{227,226,0},{215,252,0}}},
-  {{/*1*/{227,226,1},{217,252,0}}},  {{/*1*/{229,228,0},{217,254,0}}},  {{/*1*/{229,228,1},{219,254,0}}},  {{/*1*/{231,230,0},{221,252,0}}},
-  {{/*1*/{231,230,1},{223,252,0}}},  {{/*1*/{233,232,0},{223,254,0}}},  {{/*1*/{233,232,1},{225,254,0}}},  {{/*1*/{235,234,0},{227,252,0}}},
-  {{/*1*/{235,234,1},{229,252,0}}},  {{/*1*/{237,236,0},{229,254,0}}},  {{/*1*/{237,236,1},{231,254,0}}},  {{/*1*/{239,238,0},{233,252,0}}},
-  {{/*1*/{239,238,1},{235,252,0}}},  {{/*1*/{241,240,0},{235,254,0}}},  {{/*1*/{241,240,1},{237,254,0}}},  {{/*1*/{243,242,0},{239,252,0}}},
-  {{/*1*/{243,242,1},{241,252,0}}},  {{/*1*/{245,244,0},{241,254,0}}},  {{/*1*/{245,244,1},{243,254,0}}},  {{/*1*/{247,246,0},{245,252,0}}},
-  {{/*1*/{247,246,1},{247,252,0}}},  {{/*1*/{249,248,0},{247,254,0}}},  {{/*1*/{249,248,1},{249,254,0}}},  {{/*1*/{251,250,0},{251,252,0}}},
-  {{/*1*/{251,250,1},{253,252,0}}},  {{/*1*/{253,252,0},{253,254,0}}},  {{/*1*/{253,252,1},{255,254,0}}},  {{/*0*/{255,254,0},{255,254,1}}}
+  {/*1*/{  1,  1},{  0,  0},{1,0}},  {/*1*/{  1,  1},{  0,  2},{0,0}},  {/*1*/{  1,  1},{  0,  6},{1,0}},  {/*1*/{  3,  1},{  2,  8},{0,0}},
+  {/*1*/{  3,  1},{  2, 12},{1,0}},  {/*1*/{  5,  1},{  4, 14},{0,0}},  {/*1*/{  5,  1},{  4, 18},{1,0}},  {/*1*/{  7,  1},{  6, 20},{0,0}},
+  {/*1*/{  7,  1},{  6, 24},{1,0}},  {/*1*/{  9,  1},{  8, 26},{0,0}},  {/*1*/{  9,  1},{  8, 30},{1,0}},  {/*1*/{ 11,  1},{ 10, 32},{0,0}},
+  {/*1*/{ 11,  1},{ 10, 36},{1,0}},  {/*1*/{ 13,  1},{ 12, 38},{0,0}},  {/*1*/{ 13,  1},{ 12, 42},{1,0}},  {/*1*/{ 15,  1},{ 14, 44},{0,0}},
+  {/*1*/{ 15,  1},{ 14, 48},{1,0}},  {/*1*/{ 17,  1},{ 16, 50},{0,0}},  {/*1*/{ 17,  1},{ 16, 54},{1,0}},  {/*1*/{ 19,  1},{ 18, 56},{0,0}},
+  {/*1*/{ 19,  1},{ 18, 60},{1,0}},  {/*1*/{ 21,  1},{ 20, 62},{0,0}},  {/*1*/{ 21,  1},{ 20, 66},{1,0}},  {/*1*/{ 23,  1},{ 22, 70},{0,0}},
+  {/*1*/{ 23,  1},{ 22, 72},{1,0}},  {/*1*/{ 25,  1},{ 24, 76},{0,0}},  {/*1*/{ 25,  1},{ 24, 78},{1,0}},  {/*1*/{ 27,  1},{ 26, 82},{0,0}},
+  {/*1*/{ 27,  1},{ 26, 84},{1,0}},  {/*1*/{ 29,  1},{ 28, 88},{0,0}},  {/*1*/{ 29,  1},{ 28, 90},{1,0}},  {/*1*/{ 31,  1},{ 30, 94},{0,0}},
+  {/*1*/{ 31,  1},{ 30, 96},{1,0}},  {/*1*/{ 33,  1},{ 32,100},{0,0}},  {/*1*/{ 33,  1},{ 32,102},{1,0}},  {/*1*/{ 35,  1},{ 34,106},{0,0}},
+  {/*1*/{ 35,  1},{ 34,108},{1,0}},  {/*1*/{ 37,  1},{ 36,112},{0,0}},  {/*1*/{ 37,  1},{ 36,114},{1,0}},  {/*1*/{ 39,  1},{ 38,118},{0,0}},
+  {/*1*/{ 39,  1},{ 38,120},{1,0}},  {/*1*/{ 41,  1},{ 40,124},{0,0}},  {/*1*/{ 41,  1},{ 40,126},{1,0}},  {/*1*/{ 43,  1},{ 42,130},{0,0}},
+  {/*1*/{ 43,  1},{ 42,134},{1,0}},  {/*1*/{ 45,  1},{ 44,136},{0,0}},  {/*1*/{ 45,  1},{ 44,140},{1,0}},  {/*1*/{ 47,  1},{ 46,142},{0,0}},
+  {/*1*/{ 47,  1},{ 46,146},{1,0}},  {/*1*/{ 49,  1},{ 48,148},{0,0}},  {/*1*/{ 49,  1},{ 48,152},{1,0}},  {/*1*/{ 51,  1},{ 50,154},{0,0}},
+  {/*1*/{ 51,  1},{ 50,158},{1,0}},  {/*1*/{ 53,  1},{ 52,160},{0,0}},  {/*1*/{ 53,  1},{ 52,164},{1,0}},  {/*1*/{ 55,  1},{ 54,166},{0,0}},
+  {/*1*/{ 55,  1},{ 54,170},{1,0}},  {/*1*/{ 57,  1},{ 56,172},{0,0}},  {/*1*/{ 57,  1},{ 56,176},{1,0}},  {/*1*/{ 59,  1},{ 58,178},{0,0}},
+  {/*1*/{ 59,  1},{ 58,182},{1,0}},  {/*1*/{ 61,  1},{ 60,184},{0,0}},  {/*1*/{ 61,  1},{ 60,188},{1,0}},  {/*1*/{ 63,  1},{ 62,190},{0,0}},
+  {/*1*/{ 63,  1},{ 62,194},{1,0}},  {/*1*/{ 65,  1},{ 64,198},{0,0}},  {/*1*/{ 65,  1},{ 64,200},{1,0}},  {/*1*/{ 67,  1},{ 66,204},{0,0}},
+  {/*1*/{ 67,  1},{ 66,206},{1,0}},  {/*1*/{ 69,  1},{ 68,210},{0,0}},  {/*1*/{ 69,  1},{ 68,212},{1,0}},  {/*1*/{ 71,  1},{ 70,216},{0,0}},
+  {/*1*/{ 71,  1},{ 70,218},{1,0}},  {/*1*/{ 73,  1},{ 72,222},{0,0}},  {/*1*/{ 73,  1},{ 72,224},{1,0}},  {/*1*/{ 75,  1},{ 74,228},{0,0}},
+  {/*1*/{ 75,  1},{ 74,230},{1,0}},  {/*1*/{ 77,  1},{ 76,234},{0,0}},  {/*1*/{ 77,  1},{ 76,236},{1,0}},  {/*1*/{ 79,  1},{ 78,240},{0,0}},
+  {/*1*/{ 79,  1},{ 78,242},{1,0}},  {/*1*/{ 81,  1},{ 80,246},{0,0}},  {/*1*/{ 81,  1},{ 80,248},{1,0}},  {/*1*/{ 83,  1},{ 82,252},{0,0}},
+  {/*1*/{ 83,  1},{ 82,254},{1,0}},  {/*1*/{ 85,  3},{ 84,254},{0,0}},  {/*1*/{ 85,  5},{ 84,252},{1,0}},  {/*1*/{ 87,  7},{ 86,252},{0,0}},
+  {/*1*/{ 87,  7},{ 86,254},{1,0}},  {/*1*/{ 89,  9},{ 88,254},{0,0}},  {/*1*/{ 89, 11},{ 88,252},{1,0}},  {/*1*/{ 91, 13},{ 90,252},{0,0}},
+  {/*1*/{ 91, 13},{ 90,254},{1,0}},  {/*1*/{ 93, 15},{ 92,254},{0,0}},  {/*1*/{ 93, 17},{ 92,252},{1,0}},  {/*1*/{ 95, 19},{ 94,252},{0,0}},
+  {/*1*/{ 95, 19},{ 94,254},{1,0}},  {/*1*/{ 97, 21},{ 96,254},{0,0}},  {/*1*/{ 97, 23},{ 96,252},{1,0}},  {/*1*/{ 99, 25},{ 98,252},{0,0}},
+  {/*1*/{ 99, 25},{ 98,254},{1,0}},  {/*1*/{101, 27},{100,254},{0,0}},  {/*1*/{101, 29},{100,252},{1,0}},  {/*1*/{103, 31},{102,252},{0,0}},
+  {/*1*/{103, 31},{102,254},{1,0}},  {/*1*/{105, 33},{104,254},{0,0}},  {/*1*/{105, 35},{104,252},{1,0}},  {/*1*/{107, 37},{106,252},{0,0}},
+  {/*1*/{107, 37},{106,254},{1,0}},  {/*1*/{109, 39},{108,254},{0,0}},  {/*1*/{109, 41},{108,252},{1,0}},  {/*1*/{111, 43},{110,252},{0,0}},
+  {/*1*/{111, 43},{110,254},{1,0}},  {/*1*/{113, 45},{112,254},{0,0}},  {/*1*/{113, 47},{112,252},{1,0}},  {/*1*/{115, 49},{114,252},{0,0}},
+  {/*1*/{115, 49},{114,254},{1,0}},  {/*1*/{117, 51},{116,254},{0,0}},  {/*1*/{117, 53},{116,252},{1,0}},  {/*1*/{119, 55},{118,252},{0,0}},
+  {/*1*/{119, 55},{118,254},{1,0}},  {/*1*/{121, 57},{120,254},{0,0}},  {/*1*/{121, 59},{120,252},{1,0}},  {/*1*/{123, 61},{122,250},{0,0}},
+  {/*1*/{123, 61},{122,254},{1,0}},  {/*1*/{125, 63},{124,252},{0,0}},  {/*1*/{125, 65},{124,252},{1,0}},  {/*1*/{127, 65},{126,254},{0,0}},
+  {/*1*/{127, 67},{126,254},{1,0}},  {/*1*/{129, 69},{128,252},{0,0}},  {/*1*/{129, 71},{128,252},{1,0}},  {/*1*/{131, 71},{130,254},{0,0}},
+  {/*1*/{131, 73},{130,254},{1,0}},  {/*1*/{133, 75},{132,252},{0,0}},  {/*1*/{133, 77},{132,252},{1,0}},  {/*1*/{135, 77},{134,254},{0,0}},
+  {/*1*/{135, 79},{134,254},{1,0}},  {/*1*/{137, 81},{136,252},{0,0}},  {/*1*/{137, 83},{136,252},{1,0}},  {/*1*/{139, 83},{138,254},{0,0}},
+  {/*1*/{139, 85},{138,254},{1,0}},  {/*1*/{141, 87},{140,252},{0,0}},  {/*1*/{141, 89},{140,252},{1,0}},  {/*1*/{143, 89},{142,254},{0,0}},
+  {/*1*/{143, 91},{142,254},{1,0}},  {/*1*/{145, 93},{144,252},{0,0}},  {/*1*/{145, 95},{144,252},{1,0}},  {/*1*/{147, 95},{146,254},{0,0}},
+  {/*1*/{147, 97},{146,254},{1,0}},  {/*1*/{149, 99},{148,252},{0,0}},  {/*1*/{149,101},{148,252},{1,0}},  {/*1*/{151,101},{150,254},{0,0}},
+  {/*1*/{151,103},{150,254},{1,0}},  {/*1*/{153,105},{152,252},{0,0}},  {/*1*/{153,107},{152,252},{1,0}},  {/*1*/{155,107},{154,254},{0,0}},
+  {/*1*/{155,109},{154,254},{1,0}},  {/*1*/{157,111},{156,252},{0,0}},  {/*1*/{157,113},{156,252},{1,0}},  {/*1*/{159,113},{158,254},{0,0}},
+  {/*1*/{159,115},{158,254},{1,0}},  {/*1*/{161,117},{160,252},{0,0}},  {/*1*/{161,119},{160,252},{1,0}},  {/*1*/{163,119},{162,254},{0,0}},
+  {/*1*/{163,121},{162,254},{1,0}},  {/*1*/{165,123},{164,252},{0,0}},  {/*1*/{165,125},{164,250},{1,0}},  {/*1*/{167,125},{166,254},{0,0}},
+  {/*1*/{167,127},{166,252},{1,0}},  {/*1*/{169,129},{168,252},{0,0}},  {/*1*/{169,129},{168,254},{1,0}},  {/*1*/{171,131},{170,254},{0,0}},
+  {/*1*/{171,133},{170,252},{1,0}},  {/*1*/{173,135},{172,252},{0,0}},  {/*1*/{173,135},{172,254},{1,0}},  {/*1*/{175,137},{174,254},{0,0}},
+  {/*1*/{175,139},{174,252},{1,0}},  {/*1*/{177,141},{176,252},{0,0}},  {/*1*/{177,141},{176,254},{1,0}},  {/*1*/{179,143},{178,254},{0,0}},
+  {/*1*/{179,145},{178,252},{1,0}},  {/*1*/{181,147},{180,252},{0,0}},  {/*1*/{181,147},{180,254},{1,0}},  {/*1*/{183,149},{182,254},{0,0}},
+  {/*1*/{183,151},{182,252},{1,0}},  {/*1*/{185,153},{184,252},{0,0}},  {/*1*/{185,153},{184,254},{1,0}},  {/*1*/{187,155},{186,254},{0,0}},
+  {/*1*/{187,157},{186,252},{1,0}},  {/*1*/{189,159},{188,252},{0,0}},  {/*1*/{189,159},{188,254},{1,0}},  {/*1*/{191,161},{190,254},{0,0}},
+  {/*1*/{191,163},{190,252},{1,0}},  {/*1*/{193,165},{192,252},{0,0}},  {/*1*/{193,165},{192,254},{1,0}},  {/*1*/{195,167},{194,254},{0,0}},
+  {/*1*/{195,169},{194,252},{1,0}},  {/*1*/{197,171},{196,252},{0,0}},  {/*1*/{197,171},{196,254},{1,0}},  {/*1*/{199,173},{198,254},{0,0}},
+  {/*1*/{199,175},{198,252},{1,0}},  {/*1*/{201,177},{200,252},{0,0}},  {/*1*/{201,177},{200,254},{1,0}},  {/*1*/{203,179},{202,254},{0,0}},
+  {/*1*/{203,181},{202,252},{1,0}},  {/*1*/{205,183},{204,252},{0,0}},  {/*1*/{205,183},{204,254},{1,0}},  {/*1*/{207,185},{206,254},{0,0}},
+  {/*1*/{207,187},{206,252},{1,0}},  {/*1*/{209,189},{208,250},{0,0}},  {/*1*/{209,189},{208,254},{1,0}},  {/*1*/{211,191},{210,252},{0,0}},
+  {/*1*/{211,193},{210,252},{1,0}},  {/*1*/{213,193},{212,254},{0,0}},  {/*1*/{213,195},{212,254},{1,0}},  {/*1*/{215,197},{214,252},{0,0}},
+  {/*1*/{215,199},{214,252},{1,0}},  {/*1*/{217,199},{216,254},{0,0}},  {/*1*/{217,201},{216,254},{1,0}},  {/*1*/{219,203},{218,252},{0,0}},
+  {/*1*/{219,205},{218,252},{1,0}},  {/*1*/{221,205},{220,254},{0,0}},  {/*1*/{221,207},{220,254},{1,0}},  {/*1*/{223,209},{222,252},{0,0}},
+  {/*1*/{223,211},{222,252},{1,0}},  {/*1*/{225,211},{224,254},{0,0}},  {/*1*/{225,213},{224,254},{1,0}},  {/*1*/{227,215},{226,252},{0,0}},
+  {/*1*/{227,217},{226,252},{1,0}},  {/*1*/{229,217},{228,254},{0,0}},  {/*1*/{229,219},{228,254},{1,0}},  {/*1*/{231,221},{230,252},{0,0}},
+  {/*1*/{231,223},{230,252},{1,0}},  {/*1*/{233,223},{232,254},{0,0}},  {/*1*/{233,225},{232,254},{1,0}},  {/*1*/{235,227},{234,252},{0,0}},
+  {/*1*/{235,229},{234,252},{1,0}},  {/*1*/{237,229},{236,254},{0,0}},  {/*1*/{237,231},{236,254},{1,0}},  {/*1*/{239,233},{238,252},{0,0}},
+  {/*1*/{239,235},{238,252},{1,0}},  {/*1*/{241,235},{240,254},{0,0}},  {/*1*/{241,237},{240,254},{1,0}},  {/*1*/{243,239},{242,252},{0,0}},
+  {/*1*/{243,241},{242,252},{1,0}},  {/*1*/{245,241},{244,254},{0,0}},  {/*1*/{245,243},{244,254},{1,0}},  {/*1*/{247,245},{246,252},{0,0}},
+  {/*1*/{247,247},{246,252},{1,0}},  {/*1*/{249,247},{248,254},{0,0}},  {/*1*/{249,249},{248,254},{1,0}},  {/*1*/{251,251},{250,252},{0,0}},
+  {/*1*/{251,253},{250,252},{1,0}},  {/*1*/{253,253},{252,254},{0,0}},  {/*1*/{253,255},{252,254},{1,0}},  {/*0*/{255,255},{254,254},{0,1}}
 },{
-  {{/*1*/{  0,  1,0},{  0,  1,0}}},  {{/*1*/{  0,  1,1},{  0,  5,0}}},  {{/*1*/{  2,  1,0},{  0,  7,0}}},  {{/*1*/{  2,  1,1},{  0, 11,0}}},
-  {{/*1*/{  4,  3,0},{  0, 13,0}}},  {{/*1*/{  4,  3,1},{  0, 17,0}}},  {{/*1*/{  6,  5,0},{  0, 19,0}}},  {{/*1*/{  6,  5,1},{  0, 23,0}}},
-  {{/*1*/{  8,  7,0},{  0, 25,0}}},  {{/*1*/{  8,  7,1},{  0, 29,0}}},  {{/*1*/{ 10,  9,0},{  0, 31,0}}},  {{/*1*/{ 10,  9,1},{  0, 35,0}}},
-  {{/*1*/{ 12, 11,0},{  0, 37,0}}},  {{/*1*/{ 12, 11,1},{  0, 41,0}}},  {{/*1*/{ 14, 13,0},{  0, 43,0}}},  {{/*1*/{ 14, 13,1},{  0, 47,0}}},
-  {{/*1*/{ 16, 15,0},{  0, 49,0}}},  {{/*1*/{ 16, 15,1},{  0, 53,0}}},  {{/*1*/{ 18, 17,0},{  0, 55,0}}},  {{/*1*/{ 18, 17,1},{  0, 59,0}}},
-  {{/*1*/{ 20, 19,0},{  0, 61,0}}},  {{/*1*/{ 20, 19,1},{  0, 65,0}}},  {{/*1*/{ 22, 21,0},{  0, 69,0}}},  {{/*1*/{ 22, 21,1},{  0, 71,0}}},
-  {{/*1*/{ 24, 23,0},{  0, 75,0}}},  {{/*1*/{ 24, 23,1},{  0, 77,0}}},  {{/*1*/{ 26, 25,0},{  0, 81,0}}},  {{/*1*/{ 26, 25,1},{  0, 83,0}}},
-  {{/*1*/{ 28, 27,0},{  0, 87,0}}},  {{/*1*/{ 28, 27,1},{  0, 89,0}}},  {{/*1*/{ 30, 29,0},{  0, 93,0}}},  {{/*1*/{ 30, 29,1},{  0, 95,0}}},
-  {{/*1*/{ 32, 31,0},{  0, 99,0}}},  {{/*1*/{ 32, 31,1},{  0,101,0}}},  {{/*1*/{ 34, 33,0},{  0,105,0}}},  {{/*1*/{ 34, 33,1},{  0,107,0}}},
-  {{/*1*/{ 36, 35,0},{  0,111,0}}},  {{/*1*/{ 36, 35,1},{  0,113,0}}},  {{/*1*/{ 38, 37,0},{  0,117,0}}},  {{/*1*/{ 38, 37,1},{  0,119,0}}},
-  {{/*1*/{ 40, 39,0},{  0,123,0}}},  {{/*1*/{ 40, 39,1},{  0,125,0}}},  {{/*1*/{ 42, 41,0},{  0,129,0}}},  {{/*1*/{ 42, 41,1},{  0,133,0}}},
-  {{/*1*/{ 44, 43,0},{  0,135,0}}},  {{/*1*/{ 44, 43,1},{  0,139,0}}},  {{/*1*/{ 46, 45,0},{  0,141,0}}},  {{/*1*/{ 46, 45,1},{  0,145,0}}},
-  {{/*1*/{ 48, 47,0},{  0,147,0}}},  {{/*1*/{ 48, 47,1},{  0,151,0}}},  {{/*1*/{ 50, 49,0},{  0,153,0}}},  {{/*1*/{ 50, 49,1},{  0,157,0}}},
-  {{/*1*/{ 52, 51,0},{  0,159,0}}},  {{/*1*/{ 52, 51,1},{  0,163,0}}},  {{/*1*/{ 54, 53,0},{  0,165,0}}},  {{/*1*/{ 54, 53,1},{  0,169,0}}},
-  {{/*1*/{ 56, 55,0},{  0,171,0}}},  {{/*1*/{ 56, 55,1},{  0,175,0}}},  {{/*1*/{ 58, 57,0},{  0,177,0}}},  {{/*1*/{ 58, 57,1},{  0,181,0}}},
-  {{/*1*/{ 60, 59,0},{  0,183,0}}},  {{/*1*/{ 60, 59,1},{  0,187,0}}},  {{/*1*/{ 62, 61,0},{  0,189,0}}},  {{/*1*/{ 62, 61,1},{  0,193,0}}},
-  {{/*1*/{ 64, 63,0},{  0,197,0}}},  {{/*1*/{ 64, 63,1},{  0,199,0}}},  {{/*1*/{ 66, 65,0},{  0,203,0}}},  {{/*1*/{ 66, 65,1},{  0,205,0}}},
-  {{/*1*/{ 68, 67,0},{  0,209,0}}},  {{/*1*/{ 68, 67,1},{  0,211,0}}},  {{/*1*/{ 70, 69,0},{  0,215,0}}},  {{/*1*/{ 70, 69,1},{  0,217,0}}},
-  {{/*1*/{ 72, 71,0},{  0,221,0}}},  {{/*1*/{ 72, 71,1},{  0,223,0}}},  {{/*1*/{ 74, 73,0},{  0,227,0}}},  {{/*1*/{ 74, 73,1},{  0,229,0}}},
-  {{/*1*/{ 76, 75,0},{  0,233,0}}},  {{/*1*/{ 76, 75,1},{  0,235,0}}},  {{/*1*/{ 78, 77,0},{  0,239,0}}},  {{/*1*/{ 78, 77,1},{  0,241,0}}},
-  {{/*1*/{ 80, 79,0},{  0,245,0}}},  {{/*1*/{ 80, 79,1},{  0,247,0}}},  {{/*1*/{ 82, 81,0},{  0,251,0}}},  {{/*1*/{ 82, 81,1},{  0,253,0}}},
-  {{/*1*/{ 84, 83,0},{  2,253,0}}},  {{/*1*/{ 84, 83,1},{  2,255,0}}},  {{/*1*/{ 86, 85,0},{  4,255,0}}},  {{/*1*/{ 86, 85,1},{  6,253,0}}},
-  {{/*1*/{ 88, 87,0},{  8,253,0}}},  {{/*1*/{ 88, 87,1},{  8,255,0}}},  {{/*1*/{ 90, 89,0},{ 10,255,0}}},  {{/*1*/{ 90, 89,1},{ 12,253,0}}},
-  {{/*1*/{ 92, 91,0},{ 14,253,0}}},  {{/*1*/{ 92, 91,1},{ 14,255,0}}},  {{/*1*/{ 94, 93,0},{ 16,255,0}}},  {{/*1*/{ 94, 93,1},{ 18,253,0}}},
-  {{/*1*/{ 96, 95,0},{ 20,253,0}}},  {{/*1*/{ 96, 95,1},{ 20,255,0}}},  {{/*1*/{ 98, 97,0},{ 22,255,0}}},  {{/*1*/{ 98, 97,1},{ 24,253,0}}},
-  {{/*1*/{100, 99,0},{ 26,253,0}}},  {{/*1*/{100, 99,1},{ 26,255,0}}},  {{/*1*/{102,101,0},{ 28,255,0}}},  {{/*1*/{102,101,1},{ 30,253,0}}},
-  {{/*1*/{104,103,0},{ 32,253,0}}},  {{/*1*/{104,103,1},{ 32,255,0}}},  {{/*1*/{106,105,0},{ 34,255,0}}},  {{/*1*/{106,105,1},{ 36,253,0}}},
-  {{/*1*/{108,107,0},{ 38,253,0}}},  {{/*1*/{108,107,1},{ 38,255,0}}},  {{/*1*/{110,109,0},{ 40,255,0}}},  {{/*1*/{110,109,1},{ 42,253,0}}},
-  {{/*1*/{112,111,0},{ 44,253,0}}},  {{/*1*/{112,111,1},{ 44,255,0}}},  {{/*1*/{114,113,0},{ 46,255,0}}},  {{/*1*/{114,113,1},{ 48,253,0}}},
-  {{/*1*/{116,115,0},{ 50,253,0}}},  {{/*1*/{116,115,1},{ 50,255,0}}},  {{/*1*/{118,117,0},{ 52,255,0}}},  {{/*1*/{118,117,1},{ 54,253,0}}},
-  {{/*1*/{120,119,0},{ 56,253,0}}},  {{/*1*/{120,119,1},{ 56,255,0}}},  {{/*1*/{122,121,0},{ 58,255,0}}},  {{/*1*/{122,121,1},{ 60,253,0}}},
-  {{/*1*/{124,123,0},{ 62,251,0}}},  {{/*1*/{124,123,1},{ 62,255,0}}},  {{/*1*/{126,125,0},{ 64,253,0}}},  {{/*1*/{126,125,1},{ 66,253,0}}},
-  {{/*1*/{128,127,0},{ 66,255,0}}},  {{/*1*/{128,127,1},{ 68,255,0}}},  {{/*1*/{130,129,0},{ 70,253,0}}},  {{/*1*/{130,129,1},{ 72,253,0}}},
-  {{/*1*/{132,131,0},{ 72,255,0}}},  {{/*1*/{132,131,1},{ 74,255,0}}},  {{/*1*/{134,133,0},{ 76,253,0}}},  {{/*1*/{134,133,1},{ 78,253,0}}},
-  {{/*1*/{136,135,0},{ 78,255,0}}},  {{/*1*/{136,135,1},{ 80,255,0}}},  {{/*1*/{138,137,0},{ 82,253,0}}},  {{/*1*/{138,137,1},{ 84,253,0}}},
-  {{/*1*/{140,139,0},{ 84,255,0}}},  {{/*1*/{140,139,1},{ 86,255,0}}},  {{/*1*/{142,141,0},{ 88,253,0}}},  {{/*1*/{142,141,1},{ 90,253,0}}},
-  {{/*1*/{144,143,0},{ 90,255,0}}},  {{/*1*/{144,143,1},{ 92,255,0}}},  {{/*1*/{146,145,0},{ 94,253,0}}},  {{/*1*/{146,145,1},{ 96,253,0}}},
-  {{/*1*/{148,147,0},{ 96,255,0}}},  {{/*1*/{148,147,1},{ 98,255,0}}},  {{/*1*/{150,149,0},{100,253,0}}},  {{/*1*/{150,149,1},{102,253,0}}},
-  {{/*1*/{152,151,0},{102,255,0}}},  {{/*1*/{152,151,1},{104,255,0}}},  {{/*1*/{154,153,0},{106,253,0}}},  {{/*1*/{154,153,1},{108,253,0}}},
-  {{/*1*/{156,155,0},{108,255,0}}},  {{/*1*/{156,155,1},{110,255,0}}},  {{/*1*/{158,157,0},{112,253,0}}},  {{/*1*/{158,157,1},{114,253,0}}},
-  {{/*1*/{160,159,0},{114,255,0}}},  {{/*1*/{160,159,1},{116,255,0}}},  {{/*1*/{162,161,0},{118,253,0}}},  {{/*1*/{162,161,1},{120,253,0}}},
-  {{/*1*/{164,163,0},{120,255,0}}},  {{/*1*/{164,163,1},{122,255,0}}},  {{/*1*/{166,165,0},{124,253,0}}},  {{/*1*/{166,165,1},{126,251,0}}},
-  {{/*1*/{168,167,0},{126,255,0}}},  {{/*1*/{168,167,1},{128,253,0}}},  {{/*1*/{170,169,0},{130,253,0}}},  {{/*1*/{170,169,1},{130,255,0}}},
-  {{/*1*/{172,171,0},{132,255,0}}},  {{/*1*/{172,171,1},{134,253,0}}},  {{/*1*/{174,173,0},{136,253,0}}},  {{/*1*/{174,173,1},{136,255,0}}},
-  {{/*1*/{176,175,0},{138,255,0}}},  {{/*1*/{176,175,1},{140,253,0}}},  {{/*1*/{178,177,0},{142,253,0}}},  {{/*1*/{178,177,1},{142,255,0}}},
-  {{/*1*/{180,179,0},{144,255,0}}},  {{/*1*/{180,179,1},{146,253,0}}},  {{/*1*/{182,181,0},{148,253,0}}},  {{/*1*/{182,181,1},{148,255,0}}},
-  {{/*1*/{184,183,0},{150,255,0}}},  {{/*1*/{184,183,1},{152,253,0}}},  {{/*1*/{186,185,0},{154,253,0}}},  {{/*1*/{186,185,1},{154,255,0}}},
-  {{/*1*/{188,187,0},{156,255,0}}},  {{/*1*/{188,187,1},{158,253,0}}},  {{/*1*/{190,189,0},{160,253,0}}},  {{/*1*/{190,189,1},{160,255,0}}},
-  {{/*1*/{192,191,0},{162,255,0}}},  {{/*1*/{192,191,1},{164,253,0}}},  {{/*1*/{194,193,0},{166,253,0}}},  {{/*1*/{194,193,1},{166,255,0}}},
-  {{/*1*/{196,195,0},{168,255,0}}},  {{/*1*/{196,195,1},{170,253,0}}},  {{/*1*/{198,197,0},{172,253,0}}},  {{/*1*/{198,197,1},{172,255,0}}},
-  {{/*1*/{200,199,0},{174,255,0}}},  {{/*1*/{200,199,1},{176,253,0}}},  {{/*1*/{202,201,0},{178,253,0}}},  {{/*1*/{202,201,1},{178,255,0}}},
-  {{/*1*/{204,203,0},{180,255,0}}},  {{/*1*/{204,203,1},{182,253,0}}},  {{/*1*/{206,205,0},{184,253,0}}},  {{/*1*/{206,205,1},{184,255,0}}},
-  {{/*1*/{208,207,0},{186,255,0}}},  {{/*1*/{208,207,1},{188,253,0}}},  {{/*1*/{210,209,0},{190,251,0}}},  {{/*1*/{210,209,1},{190,255,0}}},
-  {{/*1*/{212,211,0},{192,253,0}}},  {{/*1*/{212,211,1},{194,253,0}}},  {{/*1*/{214,213,0},{194,255,0}}},  {{/*1*/{214,213,1},{196,255,0}}},
-  {{/*1*/{216,215,0},{198,253,0}}},  {{/*1*/{216,215,1},{200,253,0}}},  {{/*1*/{218,217,0},{200,255,0}}},  {{/*1*/{218,217,1},{202,255,0}}},
-  {{/*1*/{220,219,0},{204,253,0}}},  {{/*1*/{220,219,1},{206,253,0}}},  {{/*1*/{222,221,0},{206,255,0}}},  {{/*1*/{222,221,1},{208,255,0}}},
-  {{/*1*/{224,223,0},{210,253,0}}},  {{/*1*/{224,223,1},{212,253,0}}},  {{/*1*/{226,225,0},{212,255,0}}},  {{/*1*/{226,225,1},{214,255,0}}},
-  {{/*1*/{228,227,0},{216,253,0}}},  {{/*1*/{228,227,1},{218,253,0}}},  {{/*1*/{230,229,0},{218,255,0}}},  {{/*1*/{230,229,1},{220,255,0}}},
-  {{/*1*/{232,231,0},{222,253,0}}},  {{/*1*/{232,231,1},{224,253,0}}},  {{/*1*/{234,233,0},{224,255,0}}},  {{/*1*/{234,233,1},{226,255,0}}},
-  {{/*1*/{236,235,0},{228,253,0}}},  {{/*1*/{236,235,1},{230,253,0}}},  {{/*1*/{238,237,0},{230,255,0}}},  {{/*1*/{238,237,1},{232,255,0}}},
-  {{/*1*/{240,239,0},{234,253,0}}},  {{/*1*/{240,239,1},{236,253,0}}},  {{/*1*/{242,241,0},{236,255,0}}},  {{/*1*/{242,241,1},{238,255,0}}},
-  {{/*1*/{244,243,0},{240,253,0}}},  {{/*1*/{244,243,1},{242,253,0}}},  {{/*1*/{246,245,0},{242,255,0}}},  {{/*1*/{246,245,1},{244,255,0}}},
-  {{/*1*/{248,247,0},{246,253,0}}},  {{/*1*/{248,247,1},{248,253,0}}},  {{/*1*/{250,249,0},{248,255,0}}},  {{/*1*/{250,249,1},{250,255,0}}},
-  {{/*1*/{252,251,0},{252,253,0}}},  {{/*1*/{252,251,1},{254,253,0}}},  {{/*1*/{254,253,0},{254,255,0}}},  {{/*1*/{254,253,1},{254,255,1}}}
+  {/*1*/{  0,  0},{  1,  1},{0,0}},  {/*1*/{  0,  0},{  1,  5},{1,0}},  {/*1*/{  2,  0},{  1,  7},{0,0}},  {/*1*/{  2,  0},{  1, 11},{1,0}},
+  {/*1*/{  4,  0},{  3, 13},{0,0}},  {/*1*/{  4,  0},{  3, 17},{1,0}},  {/*1*/{  6,  0},{  5, 19},{0,0}},  {/*1*/{  6,  0},{  5, 23},{1,0}},
+  {/*1*/{  8,  0},{  7, 25},{0,0}},  {/*1*/{  8,  0},{  7, 29},{1,0}},  {/*1*/{ 10,  0},{  9, 31},{0,0}},  {/*1*/{ 10,  0},{  9, 35},{1,0}},
+  {/*1*/{ 12,  0},{ 11, 37},{0,0}},  {/*1*/{ 12,  0},{ 11, 41},{1,0}},  {/*1*/{ 14,  0},{ 13, 43},{0,0}},  {/*1*/{ 14,  0},{ 13, 47},{1,0}},
+  {/*1*/{ 16,  0},{ 15, 49},{0,0}},  {/*1*/{ 16,  0},{ 15, 53},{1,0}},  {/*1*/{ 18,  0},{ 17, 55},{0,0}},  {/*1*/{ 18,  0},{ 17, 59},{1,0}},
+  {/*1*/{ 20,  0},{ 19, 61},{0,0}},  {/*1*/{ 20,  0},{ 19, 65},{1,0}},  {/*1*/{ 22,  0},{ 21, 69},{0,0}},  {/*1*/{ 22,  0},{ 21, 71},{1,0}},
+  {/*1*/{ 24,  0},{ 23, 75},{0,0}},  {/*1*/{ 24,  0},{ 23, 77},{1,0}},  {/*1*/{ 26,  0},{ 25, 81},{0,0}},  {/*1*/{ 26,  0},{ 25, 83},{1,0}},
+  {/*1*/{ 28,  0},{ 27, 87},{0,0}},  {/*1*/{ 28,  0},{ 27, 89},{1,0}},  {/*1*/{ 30,  0},{ 29, 93},{0,0}},  {/*1*/{ 30,  0},{ 29, 95},{1,0}},
+  {/*1*/{ 32,  0},{ 31, 99},{0,0}},  {/*1*/{ 32,  0},{ 31,101},{1,0}},  {/*1*/{ 34,  0},{ 33,105},{0,0}},  {/*1*/{ 34,  0},{ 33,107},{1,0}},
+  {/*1*/{ 36,  0},{ 35,111},{0,0}},  {/*1*/{ 36,  0},{ 35,113},{1,0}},  {/*1*/{ 38,  0},{ 37,117},{0,0}},  {/*1*/{ 38,  0},{ 37,119},{1,0}},
+  {/*1*/{ 40,  0},{ 39,123},{0,0}},  {/*1*/{ 40,  0},{ 39,125},{1,0}},  {/*1*/{ 42,  0},{ 41,129},{0,0}},  {/*1*/{ 42,  0},{ 41,133},{1,0}},
+  {/*1*/{ 44,  0},{ 43,135},{0,0}},  {/*1*/{ 44,  0},{ 43,139},{1,0}},  {/*1*/{ 46,  0},{ 45,141},{0,0}},  {/*1*/{ 46,  0},{ 45,145},{1,0}},
+  {/*1*/{ 48,  0},{ 47,147},{0,0}},  {/*1*/{ 48,  0},{ 47,151},{1,0}},  {/*1*/{ 50,  0},{ 49,153},{0,0}},  {/*1*/{ 50,  0},{ 49,157},{1,0}},
+  {/*1*/{ 52,  0},{ 51,159},{0,0}},  {/*1*/{ 52,  0},{ 51,163},{1,0}},  {/*1*/{ 54,  0},{ 53,165},{0,0}},  {/*1*/{ 54,  0},{ 53,169},{1,0}},
+  {/*1*/{ 56,  0},{ 55,171},{0,0}},  {/*1*/{ 56,  0},{ 55,175},{1,0}},  {/*1*/{ 58,  0},{ 57,177},{0,0}},  {/*1*/{ 58,  0},{ 57,181},{1,0}},
+  {/*1*/{ 60,  0},{ 59,183},{0,0}},  {/*1*/{ 60,  0},{ 59,187},{1,0}},  {/*1*/{ 62,  0},{ 61,189},{0,0}},  {/*1*/{ 62,  0},{ 61,193},{1,0}},
+  {/*1*/{ 64,  0},{ 63,197},{0,0}},  {/*1*/{ 64,  0},{ 63,199},{1,0}},  {/*1*/{ 66,  0},{ 65,203},{0,0}},  {/*1*/{ 66,  0},{ 65,205},{1,0}},
+  {/*1*/{ 68,  0},{ 67,209},{0,0}},  {/*1*/{ 68,  0},{ 67,211},{1,0}},  {/*1*/{ 70,  0},{ 69,215},{0,0}},  {/*1*/{ 70,  0},{ 69,217},{1,0}},
+  {/*1*/{ 72,  0},{ 71,221},{0,0}},  {/*1*/{ 72,  0},{ 71,223},{1,0}},  {/*1*/{ 74,  0},{ 73,227},{0,0}},  {/*1*/{ 74,  0},{ 73,229},{1,0}},
+  {/*1*/{ 76,  0},{ 75,233},{0,0}},  {/*1*/{ 76,  0},{ 75,235},{1,0}},  {/*1*/{ 78,  0},{ 77,239},{0,0}},  {/*1*/{ 78,  0},{ 77,241},{1,0}},
+  {/*1*/{ 80,  0},{ 79,245},{0,0}},  {/*1*/{ 80,  0},{ 79,247},{1,0}},  {/*1*/{ 82,  0},{ 81,251},{0,0}},  {/*1*/{ 82,  0},{ 81,253},{1,0}},
+  {/*1*/{ 84,  2},{ 83,253},{0,0}},  {/*1*/{ 84,  2},{ 83,255},{1,0}},  {/*1*/{ 86,  4},{ 85,255},{0,0}},  {/*1*/{ 86,  6},{ 85,253},{1,0}},
+  {/*1*/{ 88,  8},{ 87,253},{0,0}},  {/*1*/{ 88,  8},{ 87,255},{1,0}},  {/*1*/{ 90, 10},{ 89,255},{0,0}},  {/*1*/{ 90, 12},{ 89,253},{1,0}},
+  {/*1*/{ 92, 14},{ 91,253},{0,0}},  {/*1*/{ 92, 14},{ 91,255},{1,0}},  {/*1*/{ 94, 16},{ 93,255},{0,0}},  {/*1*/{ 94, 18},{ 93,253},{1,0}},
+  {/*1*/{ 96, 20},{ 95,253},{0,0}},  {/*1*/{ 96, 20},{ 95,255},{1,0}},  {/*1*/{ 98, 22},{ 97,255},{0,0}},  {/*1*/{ 98, 24},{ 97,253},{1,0}},
+  {/*1*/{100, 26},{ 99,253},{0,0}},  {/*1*/{100, 26},{ 99,255},{1,0}},  {/*1*/{102, 28},{101,255},{0,0}},  {/*1*/{102, 30},{101,253},{1,0}},
+  {/*1*/{104, 32},{103,253},{0,0}},  {/*1*/{104, 32},{103,255},{1,0}},  {/*1*/{106, 34},{105,255},{0,0}},  {/*1*/{106, 36},{105,253},{1,0}},
+  {/*1*/{108, 38},{107,253},{0,0}},  {/*1*/{108, 38},{107,255},{1,0}},  {/*1*/{110, 40},{109,255},{0,0}},  {/*1*/{110, 42},{109,253},{1,0}},
+  {/*1*/{112, 44},{111,253},{0,0}},  {/*1*/{112, 44},{111,255},{1,0}},  {/*1*/{114, 46},{113,255},{0,0}},  {/*1*/{114, 48},{113,253},{1,0}},
+  {/*1*/{116, 50},{115,253},{0,0}},  {/*1*/{116, 50},{115,255},{1,0}},  {/*1*/{118, 52},{117,255},{0,0}},  {/*1*/{118, 54},{117,253},{1,0}},
+  {/*1*/{120, 56},{119,253},{0,0}},  {/*1*/{120, 56},{119,255},{1,0}},  {/*1*/{122, 58},{121,255},{0,0}},  {/*1*/{122, 60},{121,253},{1,0}},
+  {/*1*/{124, 62},{123,251},{0,0}},  {/*1*/{124, 62},{123,255},{1,0}},  {/*1*/{126, 64},{125,253},{0,0}},  {/*1*/{126, 66},{125,253},{1,0}},
+  {/*1*/{128, 66},{127,255},{0,0}},  {/*1*/{128, 68},{127,255},{1,0}},  {/*1*/{130, 70},{129,253},{0,0}},  {/*1*/{130, 72},{129,253},{1,0}},
+  {/*1*/{132, 72},{131,255},{0,0}},  {/*1*/{132, 74},{131,255},{1,0}},  {/*1*/{134, 76},{133,253},{0,0}},  {/*1*/{134, 78},{133,253},{1,0}},
+  {/*1*/{136, 78},{135,255},{0,0}},  {/*1*/{136, 80},{135,255},{1,0}},  {/*1*/{138, 82},{137,253},{0,0}},  {/*1*/{138, 84},{137,253},{1,0}},
+  {/*1*/{140, 84},{139,255},{0,0}},  {/*1*/{140, 86},{139,255},{1,0}},  {/*1*/{142, 88},{141,253},{0,0}},  {/*1*/{142, 90},{141,253},{1,0}},
+  {/*1*/{144, 90},{143,255},{0,0}},  {/*1*/{144, 92},{143,255},{1,0}},  {/*1*/{146, 94},{145,253},{0,0}},  {/*1*/{146, 96},{145,253},{1,0}},
+  {/*1*/{148, 96},{147,255},{0,0}},  {/*1*/{148, 98},{147,255},{1,0}},  {/*1*/{150,100},{149,253},{0,0}},  {/*1*/{150,102},{149,253},{1,0}},
+  {/*1*/{152,102},{151,255},{0,0}},  {/*1*/{152,104},{151,255},{1,0}},  {/*1*/{154,106},{153,253},{0,0}},  {/*1*/{154,108},{153,253},{1,0}},
+  {/*1*/{156,108},{155,255},{0,0}},  {/*1*/{156,110},{155,255},{1,0}},  {/*1*/{158,112},{157,253},{0,0}},  {/*1*/{158,114},{157,253},{1,0}},
+  {/*1*/{160,114},{159,255},{0,0}},  {/*1*/{160,116},{159,255},{1,0}},  {/*1*/{162,118},{161,253},{0,0}},  {/*1*/{162,120},{161,253},{1,0}},
+  {/*1*/{164,120},{163,255},{0,0}},  {/*1*/{164,122},{163,255},{1,0}},  {/*1*/{166,124},{165,253},{0,0}},  {/*1*/{166,126},{165,251},{1,0}},
+  {/*1*/{168,126},{167,255},{0,0}},  {/*1*/{168,128},{167,253},{1,0}},  {/*1*/{170,130},{169,253},{0,0}},  {/*1*/{170,130},{169,255},{1,0}},
+  {/*1*/{172,132},{171,255},{0,0}},  {/*1*/{172,134},{171,253},{1,0}},  {/*1*/{174,136},{173,253},{0,0}},  {/*1*/{174,136},{173,255},{1,0}},
+  {/*1*/{176,138},{175,255},{0,0}},  {/*1*/{176,140},{175,253},{1,0}},  {/*1*/{178,142},{177,253},{0,0}},  {/*1*/{178,142},{177,255},{1,0}},
+  {/*1*/{180,144},{179,255},{0,0}},  {/*1*/{180,146},{179,253},{1,0}},  {/*1*/{182,148},{181,253},{0,0}},  {/*1*/{182,148},{181,255},{1,0}},
+  {/*1*/{184,150},{183,255},{0,0}},  {/*1*/{184,152},{183,253},{1,0}},  {/*1*/{186,154},{185,253},{0,0}},  {/*1*/{186,154},{185,255},{1,0}},
+  {/*1*/{188,156},{187,255},{0,0}},  {/*1*/{188,158},{187,253},{1,0}},  {/*1*/{190,160},{189,253},{0,0}},  {/*1*/{190,160},{189,255},{1,0}},
+  {/*1*/{192,162},{191,255},{0,0}},  {/*1*/{192,164},{191,253},{1,0}},  {/*1*/{194,166},{193,253},{0,0}},  {/*1*/{194,166},{193,255},{1,0}},
+  {/*1*/{196,168},{195,255},{0,0}},  {/*1*/{196,170},{195,253},{1,0}},  {/*1*/{198,172},{197,253},{0,0}},  {/*1*/{198,172},{197,255},{1,0}},
+  {/*1*/{200,174},{199,255},{0,0}},  {/*1*/{200,176},{199,253},{1,0}},  {/*1*/{202,178},{201,253},{0,0}},  {/*1*/{202,178},{201,255},{1,0}},
+  {/*1*/{204,180},{203,255},{0,0}},  {/*1*/{204,182},{203,253},{1,0}},  {/*1*/{206,184},{205,253},{0,0}},  {/*1*/{206,184},{205,255},{1,0}},
+  {/*1*/{208,186},{207,255},{0,0}},  {/*1*/{208,188},{207,253},{1,0}},  {/*1*/{210,190},{209,251},{0,0}},  {/*1*/{210,190},{209,255},{1,0}},
+  {/*1*/{212,192},{211,253},{0,0}},  {/*1*/{212,194},{211,253},{1,0}},  {/*1*/{214,194},{213,255},{0,0}},  {/*1*/{214,196},{213,255},{1,0}},
+  {/*1*/{216,198},{215,253},{0,0}},  {/*1*/{216,200},{215,253},{1,0}},  {/*1*/{218,200},{217,255},{0,0}},  {/*1*/{218,202},{217,255},{1,0}},
+  {/*1*/{220,204},{219,253},{0,0}},  {/*1*/{220,206},{219,253},{1,0}},  {/*1*/{222,206},{221,255},{0,0}},  {/*1*/{222,208},{221,255},{1,0}},
+  {/*1*/{224,210},{223,253},{0,0}},  {/*1*/{224,212},{223,253},{1,0}},  {/*1*/{226,212},{225,255},{0,0}},  {/*1*/{226,214},{225,255},{1,0}},
+  {/*1*/{228,216},{227,253},{0,0}},  {/*1*/{228,218},{227,253},{1,0}},  {/*1*/{230,218},{229,255},{0,0}},  {/*1*/{230,220},{229,255},{1,0}},
+  {/*1*/{232,222},{231,253},{0,0}},  {/*1*/{232,224},{231,253},{1,0}},  {/*1*/{234,224},{233,255},{0,0}},  {/*1*/{234,226},{233,255},{1,0}},
+  {/*1*/{236,228},{235,253},{0,0}},  {/*1*/{236,230},{235,253},{1,0}},  {/*1*/{238,230},{237,255},{0,0}},  {/*1*/{238,232},{237,255},{1,0}},
+  {/*1*/{240,234},{239,253},{0,0}},  {/*1*/{240,236},{239,253},{1,0}},  {/*1*/{242,236},{241,255},{0,0}},  {/*1*/{242,238},{241,255},{1,0}},
+  {/*1*/{244,240},{243,253},{0,0}},  {/*1*/{244,242},{243,253},{1,0}},  {/*1*/{246,242},{245,255},{0,0}},  {/*1*/{246,244},{245,255},{1,0}},
+  {/*1*/{248,246},{247,253},{0,0}},  {/*1*/{248,248},{247,253},{1,0}},  {/*1*/{250,248},{249,255},{0,0}},  {/*1*/{250,250},{249,255},{1,0}},
+  {/*1*/{252,252},{251,253},{0,0}},  {/*1*/{252,254},{251,253},{1,0}},  {/*1*/{254,254},{253,255},{0,0}},  {/*1*/{254,254},{253,255},{1,1}}
 },{
-  {{/*1*/{  1,  1,1},{  1,  1,1}}},  {{/*1*/{  1,  1,0},{  1,  1,0}}},  {{/*1*/{  1,  1,1},{  1,  5,0}}},  {{/*1*/{  3,  3,0},{  1,  9,0}}},
-  {{/*1*/{  3,  3,1},{  1, 11,0}}},  {{/*1*/{  5,  5,0},{  1, 15,0}}},  {{/*1*/{  5,  5,1},{  1, 17,0}}},  {{/*1*/{  7,  7,0},{  1, 21,0}}},
-  {{/*1*/{  7,  7,1},{  1, 23,0}}},  {{/*1*/{  9,  9,0},{  1, 27,0}}},  {{/*1*/{  9,  9,1},{  1, 29,0}}},  {{/*1*/{ 11, 11,0},{  1, 33,0}}},
-  {{/*1*/{ 11, 11,1},{  1, 35,0}}},  {{/*1*/{ 13, 13,0},{  1, 39,0}}},  {{/*1*/{ 13, 13,1},{  1, 41,0}}},  {{/*1*/{ 15, 15,0},{  1, 45,0}}},
-  {{/*1*/{ 15, 15,1},{  1, 47,0}}},  {{/*1*/{ 17, 17,0},{  1, 51,0}}},  {{/*1*/{ 17, 17,1},{  1, 53,0}}},  {{/*1*/{ 19, 19,0},{  1, 57,0}}},
-  {{/*1*/{ 19, 19,1},{  1, 59,0}}},  {{/*1*/{ 21, 21,0},{  1, 63,0}}},  {{/*1*/{ 21, 21,1},{  1, 65,0}}},  {{/*1*/{ 23, 23,0},{  1, 69,0}}},
-  {{/*1*/{ 23, 23,1},{  1, 73,0}}},  {{/*1*/{ 25, 25,0},{  1, 75,0}}},  {{/*1*/{ 25, 25,1},{  1, 79,0}}},  {{/*1*/{ 27, 27,0},{  1, 81,0}}},
-  {{/*1*/{ 27, 27,1},{  1, 85,0}}},  {{/*1*/{ 29, 29,0},{  1, 87,0}}},  {{/*1*/{ 29, 29,1},{  1, 91,0}}},  {{/*1*/{ 31, 31,0},{  1, 93,0}}},
-  {{/*1*/{ 31, 31,1},{  1, 97,0}}},  {{/*1*/{ 33, 33,0},{  1, 99,0}}},  {{/*1*/{ 33, 33,1},{  1,103,0}}},  {{/*1*/{ 35, 35,0},{  1,105,0}}},
-  {{/*1*/{ 35, 35,1},{  1,109,0}}},  {{/*1*/{ 37, 37,0},{  1,111,0}}},  {{/*1*/{ 37, 37,1},{  1,115,0}}},  {{/*1*/{ 39, 39,0},{  1,117,0}}},
-  {{/*1*/{ 39, 39,1},{  1,121,0}}},  {{/*1*/{ 41, 41,0},{  1,123,0}}},  {{/*1*/{ 41, 41,1},{  1,127,0}}},  {{/*1*/{ 43, 43,0},{  1,129,0}}},
-  {{/*1*/{ 43, 43,1},{  1,133,0}}},  {{/*1*/{ 45, 45,0},{  1,137,0}}},  {{/*1*/{ 45, 45,1},{  1,139,0}}},  {{/*1*/{ 47, 47,0},{  1,143,0}}},
-  {{/*1*/{ 47, 47,1},{  1,145,0}}},  {{/*1*/{ 49, 49,0},{  1,149,0}}},  {{/*1*/{ 49, 49,1},{  1,151,0}}},  {{/*1*/{ 51, 51,0},{  1,155,0}}},
-  {{/*1*/{ 51, 51,1},{  1,157,0}}},  {{/*1*/{ 53, 53,0},{  1,161,0}}},  {{/*1*/{ 53, 53,1},{  1,163,0}}},  {{/*1*/{ 55, 55,0},{  1,167,0}}},
-  {{/*1*/{ 55, 55,1},{  1,169,0}}},  {{/*1*/{ 57, 57,0},{  1,173,0}}},  {{/*1*/{ 57, 57,1},{  1,175,0}}},  {{/*1*/{ 59, 59,0},{  1,179,0}}},
-  {{/*1*/{ 59, 59,1},{  1,181,0}}},  {{/*1*/{ 61, 61,0},{  1,185,0}}},  {{/*1*/{ 61, 61,1},{  1,187,0}}},  {{/*1*/{ 63, 63,0},{  1,191,0}}},
-  {{/*1*/{ 63, 63,1},{  1,193,0}}},  {{/*1*/{ 65, 65,0},{  1,197,0}}},  {{/*1*/{ 65, 65,1},{  1,201,0}}},  {{/*1*/{ 67, 67,0},{  1,203,0}}},
-  {{/*1*/{ 67, 67,1},{  1,207,0}}},  {{/*1*/{ 69, 69,0},{  1,209,0}}},  {{/*1*/{ 69, 69,1},{  1,213,0}}},  {{/*1*/{ 71, 71,0},{  1,215,0}}},
-  {{/*1*/{ 71, 71,1},{  1,219,0}}},  {{/*1*/{ 73, 73,0},{  1,221,0}}},  {{/*1*/{ 73, 73,1},{  1,225,0}}},  {{/*1*/{ 75, 75,0},{  1,227,0}}},
-  {{/*1*/{ 75, 75,1},{  1,231,0}}},  {{/*1*/{ 77, 77,0},{  1,233,0}}},  {{/*1*/{ 77, 77,1},{  1,237,0}}},  {{/*1*/{ 79, 79,0},{  1,239,0}}},
-  {{/*1*/{ 79, 79,1},{  1,243,0}}},  {{/*1*/{ 81, 81,0},{  1,245,0}}},  {{/*1*/{ 81, 81,1},{  1,249,0}}},  {{/*1*/{ 83, 83,0},{  1,251,0}}},
-  {{/*1*/{ 83, 83,1},{  1,255,0}}},  {{/*1*/{ 85, 85,0},{  3,253,0}}},  {{/*1*/{ 85, 85,1},{  5,253,0}}},  {{/*1*/{ 87, 87,0},{  5,255,0}}},
-  {{/*1*/{ 87, 87,1},{  7,255,0}}},  {{/*1*/{ 89, 89,0},{  9,253,0}}},  {{/*1*/{ 89, 89,1},{ 11,253,0}}},  {{/*1*/{ 91, 91,0},{ 11,255,0}}},
-  {{/*1*/{ 91, 91,1},{ 13,255,0}}},  {{/*1*/{ 93, 93,0},{ 15,253,0}}},  {{/*1*/{ 93, 93,1},{ 17,253,0}}},  {{/*1*/{ 95, 95,0},{ 17,255,0}}},
-  {{/*1*/{ 95, 95,1},{ 19,255,0}}},  {{/*1*/{ 97, 97,0},{ 21,253,0}}},  {{/*1*/{ 97, 97,1},{ 23,253,0}}},  {{/*1*/{ 99, 99,0},{ 23,255,0}}},
-  {{/*1*/{ 99, 99,1},{ 25,255,0}}},  {{/*1*/{101,101,0},{ 27,253,0}}},  {{/*1*/{101,101,1},{ 29,253,0}}},  {{/*1*/{103,103,0},{ 29,255,0}}},
-  {{/*1*/{103,103,1},{ 31,255,0}}},  {{/*1*/{105,105,0},{ 33,253,0}}},  {{/*1*/{105,105,1},{ 35,253,0}}},  {{/*1*/{107,107,0},{ 35,255,0}}},
-  {{/*1*/{107,107,1},{ 37,255,0}}},  {{/*1*/{109,109,0},{ 39,253,0}}},  {{/*1*/{109,109,1},{ 41,253,0}}},  {{/*1*/{111,111,0},{ 41,255,0}}},
-  {{/*1*/{111,111,1},{ 43,255,0}}},  {{/*1*/{113,113,0},{ 45,253,0}}},  {{/*1*/{113,113,1},{ 47,253,0}}},  {{/*1*/{115,115,0},{ 47,255,0}}},
-  {{/*1*/{115,115,1},{ 49,255,0}}},  {{/*1*/{117,117,0},{ 51,253,0}}},  {{/*1*/{117,117,1},{ 53,253,0}}},  {{/*1*/{119,119,0},{ 53,255,0}}},
-  {{/*1*/{119,119,1},{ 55,255,0}}},  {{/*1*/{121,121,0},{ 57,253,0}}},  {{/*1*/{121,121,1},{ 59,251,0}}},  {{/*1*/{123,123,0},{ 59,255,0}}},
-  {{/*1*/{123,123,1},{ 61,253,0}}},  {{/*1*/{125,125,0},{ 63,253,0}}},  {{/*1*/{125,125,1},{ 63,255,0}}},  {{/*1*/{127,127,0},{ 65,255,0}}},
-  {{/*1*/{127,127,1},{ 67,253,0}}},  {{/*1*/{129,129,0},{ 69,253,0}}},  {{/*1*/{129,129,1},{ 69,255,0}}},  {{/*1*/{131,131,0},{ 71,255,0}}},
-  {{/*1*/{131,131,1},{ 73,253,0}}},  {{/*1*/{133,133,0},{ 75,253,0}}},  {{/*1*/{133,133,1},{ 75,255,0}}},  {{/*1*/{135,135,0},{ 77,255,0}}},
-  {{/*1*/{135,135,1},{ 79,253,0}}},  {{/*1*/{137,137,0},{ 81,253,0}}},  {{/*1*/{137,137,1},{ 81,255,0}}},  {{/*1*/{139,139,0},{ 83,255,0}}},
-  {{/*1*/{139,139,1},{ 85,253,0}}},  {{/*1*/{141,141,0},{ 87,253,0}}},  {{/*1*/{141,141,1},{ 87,255,0}}},  {{/*1*/{143,143,0},{ 89,255,0}}},
-  {{/*1*/{143,143,1},{ 91,253,0}}},  {{/*1*/{145,145,0},{ 93,253,0}}},  {{/*1*/{145,145,1},{ 93,255,0}}},  {{/*1*/{147,147,0},{ 95,255,0}}},
-  {{/*1*/{147,147,1},{ 97,253,0}}},  {{/*1*/{149,149,0},{ 99,253,0}}},  {{/*1*/{149,149,1},{ 99,255,0}}},  {{/*1*/{151,151,0},{101,255,0}}},
-  {{/*1*/{151,151,1},{103,253,0}}},  {{/*1*/{153,153,0},{105,253,0}}},  {{/*1*/{153,153,1},{105,255,0}}},  {{/*1*/{155,155,0},{107,255,0}}},
-  {{/*1*/{155,155,1},{109,253,0}}},  {{/*1*/{157,157,0},{111,253,0}}},  {{/*1*/{157,157,1},{111,255,0}}},  {{/*1*/{159,159,0},{113,255,0}}},
-  {{/*1*/{159,159,1},{115,253,0}}},  {{/*1*/{161,161,0},{117,253,0}}},  {{/*1*/{161,161,1},{117,255,0}}},  {{/*1*/{163,163,0},{119,255,0}}},
-  {{/*1*/{163,163,1},{121,253,0}}},  {{/*1*/{165,165,0},{123,251,0}}},  {{/*1*/{165,165,1},{123,255,0}}},  {{/*1*/{167,167,0},{125,253,0}}},
-  {{/*1*/{167,167,1},{127,253,0}}},  {{/*1*/{169,169,0},{127,255,0}}},  {{/*1*/{169,169,1},{129,255,0}}},  {{/*1*/{171,171,0},{131,253,0}}},
-  {{/*1*/{171,171,1},{133,253,0}}},  {{/*1*/{173,173,0},{133,255,0}}},  {{/*1*/{173,173,1},{135,255,0}}},  {{/*1*/{175,175,0},{137,253,0}}},
-  {{/*1*/{175,175,1},{139,253,0}}},  {{/*1*/{177,177,0},{139,255,0}}},  {{/*1*/{177,177,1},{141,255,0}}},  {{/*1*/{179,179,0},{143,253,0}}},
-  {{/*1*/{179,179,1},{145,253,0}}},  {{/*1*/{181,181,0},{145,255,0}}},  {{/*1*/{181,181,1},{147,255,0}}},  {{/*1*/{183,183,0},{149,253,0}}},
-  {{/*1*/{183,183,1},{151,253,0}}},  {{/*1*/{185,185,0},{151,255,0}}},  {{/*1*/{185,185,1},{153,255,0}}},  {{/*1*/{187,187,0},{155,253,0}}},
-  {{/*1*/{187,187,1},{157,253,0}}},  {{/*1*/{189,189,0},{157,255,0}}},  {{/*1*/{189,189,1},{159,255,0}}},  {{/*1*/{191,191,0},{161,253,0}}},
-  {{/*1*/{191,191,1},{163,253,0}}},  {{/*1*/{193,193,0},{163,255,0}}},  {{/*1*/{193,193,1},{165,255,0}}},  {{/*1*/{195,195,0},{167,253,0}}},
-  {{/*1*/{195,195,1},{169,253,0}}},  {{/*1*/{197,197,0},{169,255,0}}},  {{/*1*/{197,197,1},{171,255,0}}},  {{/*1*/{199,199,0},{173,253,0}}},
-  {{/*1*/{199,199,1},{175,253,0}}},  {{/*1*/{201,201,0},{175,255,0}}},  {{/*1*/{201,201,1},{177,255,0}}},  {{/*1*/{203,203,0},{179,253,0}}},
-  {{/*1*/{203,203,1},{181,253,0}}},  {{/*1*/{205,205,0},{181,255,0}}},  {{/*1*/{205,205,1},{183,255,0}}},  {{/*1*/{207,207,0},{185,253,0}}},
-  {{/*1*/{207,207,1},{187,251,0}}},  {{/*1*/{209,209,0},{187,255,0}}},  {{/*1*/{209,209,1},{189,253,0}}},  {{/*1*/{211,211,0},{191,253,0}}},
-  {{/*1*/{211,211,1},{191,255,0}}},  {{/*1*/{213,213,0},{193,255,0}}},  {{/*1*/{213,213,1},{195,253,0}}},  {{/*1*/{215,215,0},{197,253,0}}},
-  {{/*1*/{215,215,1},{197,255,0}}},  {{/*1*/{217,217,0},{199,255,0}}},  {{/*1*/{217,217,1},{201,253,0}}},  {{/*1*/{219,219,0},{203,253,0}}},
-  {{/*1*/{219,219,1},{203,255,0}}},  {{/*1*/{221,221,0},{205,255,0}}},  {{/*1*/{221,221,1},{207,253,0}}},  {{/*1*/{223,223,0},{209,253,0}}},
-  {{/*1*/{223,223,1},{209,255,0}}},  {{/*1*/{225,225,0},{211,255,0}}},  {{/*1*/{225,225,1},{213,253,0}}},  {{/*1*/{227,227,0},{215,253,0}}},
-  {{/*1*/{227,227,1},{215,255,0}}},  {{/*1*/{229,229,0},{217,255,0}}},  {{/*1*/{229,229,1},{219,253,0}}},  {{/*1*/{231,231,0},{221,253,0}}},
-  {{/*1*/{231,231,1},{221,255,0}}},  {{/*1*/{233,233,0},{223,255,0}}},  {{/*1*/{233,233,1},{225,253,0}}},  {{/*1*/{235,235,0},{227,253,0}}},
-  {{/*1*/{235,235,1},{227,255,0}}},  {{/*1*/{237,237,0},{229,255,0}}},  {{/*1*/{237,237,1},{231,253,0}}},  {{/*1*/{239,239,0},{233,253,0}}},
-  {{/*1*/{239,239,1},{233,255,0}}},  {{/*1*/{241,241,0},{235,255,0}}},  {{/*1*/{241,241,1},{237,253,0}}},  {{/*1*/{243,243,0},{239,253,0}}},
-  {{/*1*/{243,243,1},{239,255,0}}},  {{/*1*/{245,245,0},{241,255,0}}},  {{/*1*/{245,245,1},{243,253,0}}},  {{/*1*/{247,247,0},{245,253,0}}},
-  {{/*1*/{247,247,1},{245,255,0}}},  {{/*1*/{249,249,0},{247,255,0}}},  {{/*1*/{249,249,1},{249,253,0}}},  {{/*1*/{251,251,0},{251,251,0}}},
-  {{/*1*/{251,251,1},{251,255,0}}},  {{/*1*/{253,253,0},{253,253,0}}},  {{/*1*/{253,253,1},{255,253,0}}},  {{/*1*/{255,255,0},{255,255,0}}}
+  {/*1*/{  1,  1},{  1,  1},{1,1}},  {/*1*/{  1,  1},{  1,  1},{0,0}},  {/*1*/{  1,  1},{  1,  5},{1,0}},  {/*1*/{  3,  1},{  3,  9},{0,0}},
+  {/*1*/{  3,  1},{  3, 11},{1,0}},  {/*1*/{  5,  1},{  5, 15},{0,0}},  {/*1*/{  5,  1},{  5, 17},{1,0}},  {/*1*/{  7,  1},{  7, 21},{0,0}},
+  {/*1*/{  7,  1},{  7, 23},{1,0}},  {/*1*/{  9,  1},{  9, 27},{0,0}},  {/*1*/{  9,  1},{  9, 29},{1,0}},  {/*1*/{ 11,  1},{ 11, 33},{0,0}},
+  {/*1*/{ 11,  1},{ 11, 35},{1,0}},  {/*1*/{ 13,  1},{ 13, 39},{0,0}},  {/*1*/{ 13,  1},{ 13, 41},{1,0}},  {/*1*/{ 15,  1},{ 15, 45},{0,0}},
+  {/*1*/{ 15,  1},{ 15, 47},{1,0}},  {/*1*/{ 17,  1},{ 17, 51},{0,0}},  {/*1*/{ 17,  1},{ 17, 53},{1,0}},  {/*1*/{ 19,  1},{ 19, 57},{0,0}},
+  {/*1*/{ 19,  1},{ 19, 59},{1,0}},  {/*1*/{ 21,  1},{ 21, 63},{0,0}},  {/*1*/{ 21,  1},{ 21, 65},{1,0}},  {/*1*/{ 23,  1},{ 23, 69},{0,0}},
+  {/*1*/{ 23,  1},{ 23, 73},{1,0}},  {/*1*/{ 25,  1},{ 25, 75},{0,0}},  {/*1*/{ 25,  1},{ 25, 79},{1,0}},  {/*1*/{ 27,  1},{ 27, 81},{0,0}},
+  {/*1*/{ 27,  1},{ 27, 85},{1,0}},  {/*1*/{ 29,  1},{ 29, 87},{0,0}},  {/*1*/{ 29,  1},{ 29, 91},{1,0}},  {/*1*/{ 31,  1},{ 31, 93},{0,0}},
+  {/*1*/{ 31,  1},{ 31, 97},{1,0}},  {/*1*/{ 33,  1},{ 33, 99},{0,0}},  {/*1*/{ 33,  1},{ 33,103},{1,0}},  {/*1*/{ 35,  1},{ 35,105},{0,0}},
+  {/*1*/{ 35,  1},{ 35,109},{1,0}},  {/*1*/{ 37,  1},{ 37,111},{0,0}},  {/*1*/{ 37,  1},{ 37,115},{1,0}},  {/*1*/{ 39,  1},{ 39,117},{0,0}},
+  {/*1*/{ 39,  1},{ 39,121},{1,0}},  {/*1*/{ 41,  1},{ 41,123},{0,0}},  {/*1*/{ 41,  1},{ 41,127},{1,0}},  {/*1*/{ 43,  1},{ 43,129},{0,0}},
+  {/*1*/{ 43,  1},{ 43,133},{1,0}},  {/*1*/{ 45,  1},{ 45,137},{0,0}},  {/*1*/{ 45,  1},{ 45,139},{1,0}},  {/*1*/{ 47,  1},{ 47,143},{0,0}},
+  {/*1*/{ 47,  1},{ 47,145},{1,0}},  {/*1*/{ 49,  1},{ 49,149},{0,0}},  {/*1*/{ 49,  1},{ 49,151},{1,0}},  {/*1*/{ 51,  1},{ 51,155},{0,0}},
+  {/*1*/{ 51,  1},{ 51,157},{1,0}},  {/*1*/{ 53,  1},{ 53,161},{0,0}},  {/*1*/{ 53,  1},{ 53,163},{1,0}},  {/*1*/{ 55,  1},{ 55,167},{0,0}},
+  {/*1*/{ 55,  1},{ 55,169},{1,0}},  {/*1*/{ 57,  1},{ 57,173},{0,0}},  {/*1*/{ 57,  1},{ 57,175},{1,0}},  {/*1*/{ 59,  1},{ 59,179},{0,0}},
+  {/*1*/{ 59,  1},{ 59,181},{1,0}},  {/*1*/{ 61,  1},{ 61,185},{0,0}},  {/*1*/{ 61,  1},{ 61,187},{1,0}},  {/*1*/{ 63,  1},{ 63,191},{0,0}},
+  {/*1*/{ 63,  1},{ 63,193},{1,0}},  {/*1*/{ 65,  1},{ 65,197},{0,0}},  {/*1*/{ 65,  1},{ 65,201},{1,0}},  {/*1*/{ 67,  1},{ 67,203},{0,0}},
+  {/*1*/{ 67,  1},{ 67,207},{1,0}},  {/*1*/{ 69,  1},{ 69,209},{0,0}},  {/*1*/{ 69,  1},{ 69,213},{1,0}},  {/*1*/{ 71,  1},{ 71,215},{0,0}},
+  {/*1*/{ 71,  1},{ 71,219},{1,0}},  {/*1*/{ 73,  1},{ 73,221},{0,0}},  {/*1*/{ 73,  1},{ 73,225},{1,0}},  {/*1*/{ 75,  1},{ 75,227},{0,0}},
+  {/*1*/{ 75,  1},{ 75,231},{1,0}},  {/*1*/{ 77,  1},{ 77,233},{0,0}},  {/*1*/{ 77,  1},{ 77,237},{1,0}},  {/*1*/{ 79,  1},{ 79,239},{0,0}},
+  {/*1*/{ 79,  1},{ 79,243},{1,0}},  {/*1*/{ 81,  1},{ 81,245},{0,0}},  {/*1*/{ 81,  1},{ 81,249},{1,0}},  {/*1*/{ 83,  1},{ 83,251},{0,0}},
+  {/*1*/{ 83,  1},{ 83,255},{1,0}},  {/*1*/{ 85,  3},{ 85,253},{0,0}},  {/*1*/{ 85,  5},{ 85,253},{1,0}},  {/*1*/{ 87,  5},{ 87,255},{0,0}},
+  {/*1*/{ 87,  7},{ 87,255},{1,0}},  {/*1*/{ 89,  9},{ 89,253},{0,0}},  {/*1*/{ 89, 11},{ 89,253},{1,0}},  {/*1*/{ 91, 11},{ 91,255},{0,0}},
+  {/*1*/{ 91, 13},{ 91,255},{1,0}},  {/*1*/{ 93, 15},{ 93,253},{0,0}},  {/*1*/{ 93, 17},{ 93,253},{1,0}},  {/*1*/{ 95, 17},{ 95,255},{0,0}},
+  {/*1*/{ 95, 19},{ 95,255},{1,0}},  {/*1*/{ 97, 21},{ 97,253},{0,0}},  {/*1*/{ 97, 23},{ 97,253},{1,0}},  {/*1*/{ 99, 23},{ 99,255},{0,0}},
+  {/*1*/{ 99, 25},{ 99,255},{1,0}},  {/*1*/{101, 27},{101,253},{0,0}},  {/*1*/{101, 29},{101,253},{1,0}},  {/*1*/{103, 29},{103,255},{0,0}},
+  {/*1*/{103, 31},{103,255},{1,0}},  {/*1*/{105, 33},{105,253},{0,0}},  {/*1*/{105, 35},{105,253},{1,0}},  {/*1*/{107, 35},{107,255},{0,0}},
+  {/*1*/{107, 37},{107,255},{1,0}},  {/*1*/{109, 39},{109,253},{0,0}},  {/*1*/{109, 41},{109,253},{1,0}},  {/*1*/{111, 41},{111,255},{0,0}},
+  {/*1*/{111, 43},{111,255},{1,0}},  {/*1*/{113, 45},{113,253},{0,0}},  {/*1*/{113, 47},{113,253},{1,0}},  {/*1*/{115, 47},{115,255},{0,0}},
+  {/*1*/{115, 49},{115,255},{1,0}},  {/*1*/{117, 51},{117,253},{0,0}},  {/*1*/{117, 53},{117,253},{1,0}},  {/*1*/{119, 53},{119,255},{0,0}},
+  {/*1*/{119, 55},{119,255},{1,0}},  {/*1*/{121, 57},{121,253},{0,0}},  {/*1*/{121, 59},{121,251},{1,0}},  {/*1*/{123, 59},{123,255},{0,0}},
+  {/*1*/{123, 61},{123,253},{1,0}},  {/*1*/{125, 63},{125,253},{0,0}},  {/*1*/{125, 63},{125,255},{1,0}},  {/*1*/{127, 65},{127,255},{0,0}},
+  {/*1*/{127, 67},{127,253},{1,0}},  {/*1*/{129, 69},{129,253},{0,0}},  {/*1*/{129, 69},{129,255},{1,0}},  {/*1*/{131, 71},{131,255},{0,0}},
+  {/*1*/{131, 73},{131,253},{1,0}},  {/*1*/{133, 75},{133,253},{0,0}},  {/*1*/{133, 75},{133,255},{1,0}},  {/*1*/{135, 77},{135,255},{0,0}},
+  {/*1*/{135, 79},{135,253},{1,0}},  {/*1*/{137, 81},{137,253},{0,0}},  {/*1*/{137, 81},{137,255},{1,0}},  {/*1*/{139, 83},{139,255},{0,0}},
+  {/*1*/{139, 85},{139,253},{1,0}},  {/*1*/{141, 87},{141,253},{0,0}},  {/*1*/{141, 87},{141,255},{1,0}},  {/*1*/{143, 89},{143,255},{0,0}},
+  {/*1*/{143, 91},{143,253},{1,0}},  {/*1*/{145, 93},{145,253},{0,0}},  {/*1*/{145, 93},{145,255},{1,0}},  {/*1*/{147, 95},{147,255},{0,0}},
+  {/*1*/{147, 97},{147,253},{1,0}},  {/*1*/{149, 99},{149,253},{0,0}},  {/*1*/{149, 99},{149,255},{1,0}},  {/*1*/{151,101},{151,255},{0,0}},
+  {/*1*/{151,103},{151,253},{1,0}},  {/*1*/{153,105},{153,253},{0,0}},  {/*1*/{153,105},{153,255},{1,0}},  {/*1*/{155,107},{155,255},{0,0}},
+  {/*1*/{155,109},{155,253},{1,0}},  {/*1*/{157,111},{157,253},{0,0}},  {/*1*/{157,111},{157,255},{1,0}},  {/*1*/{159,113},{159,255},{0,0}},
+  {/*1*/{159,115},{159,253},{1,0}},  {/*1*/{161,117},{161,253},{0,0}},  {/*1*/{161,117},{161,255},{1,0}},  {/*1*/{163,119},{163,255},{0,0}},
+  {/*1*/{163,121},{163,253},{1,0}},  {/*1*/{165,123},{165,251},{0,0}},  {/*1*/{165,123},{165,255},{1,0}},  {/*1*/{167,125},{167,253},{0,0}},
+  {/*1*/{167,127},{167,253},{1,0}},  {/*1*/{169,127},{169,255},{0,0}},  {/*1*/{169,129},{169,255},{1,0}},  {/*1*/{171,131},{171,253},{0,0}},
+  {/*1*/{171,133},{171,253},{1,0}},  {/*1*/{173,133},{173,255},{0,0}},  {/*1*/{173,135},{173,255},{1,0}},  {/*1*/{175,137},{175,253},{0,0}},
+  {/*1*/{175,139},{175,253},{1,0}},  {/*1*/{177,139},{177,255},{0,0}},  {/*1*/{177,141},{177,255},{1,0}},  {/*1*/{179,143},{179,253},{0,0}},
+  {/*1*/{179,145},{179,253},{1,0}},  {/*1*/{181,145},{181,255},{0,0}},  {/*1*/{181,147},{181,255},{1,0}},  {/*1*/{183,149},{183,253},{0,0}},
+  {/*1*/{183,151},{183,253},{1,0}},  {/*1*/{185,151},{185,255},{0,0}},  {/*1*/{185,153},{185,255},{1,0}},  {/*1*/{187,155},{187,253},{0,0}},
+  {/*1*/{187,157},{187,253},{1,0}},  {/*1*/{189,157},{189,255},{0,0}},  {/*1*/{189,159},{189,255},{1,0}},  {/*1*/{191,161},{191,253},{0,0}},
+  {/*1*/{191,163},{191,253},{1,0}},  {/*1*/{193,163},{193,255},{0,0}},  {/*1*/{193,165},{193,255},{1,0}},  {/*1*/{195,167},{195,253},{0,0}},
+  {/*1*/{195,169},{195,253},{1,0}},  {/*1*/{197,169},{197,255},{0,0}},  {/*1*/{197,171},{197,255},{1,0}},  {/*1*/{199,173},{199,253},{0,0}},
+  {/*1*/{199,175},{199,253},{1,0}},  {/*1*/{201,175},{201,255},{0,0}},  {/*1*/{201,177},{201,255},{1,0}},  {/*1*/{203,179},{203,253},{0,0}},
+  {/*1*/{203,181},{203,253},{1,0}},  {/*1*/{205,181},{205,255},{0,0}},  {/*1*/{205,183},{205,255},{1,0}},  {/*1*/{207,185},{207,253},{0,0}},
+  {/*1*/{207,187},{207,251},{1,0}},  {/*1*/{209,187},{209,255},{0,0}},  {/*1*/{209,189},{209,253},{1,0}},  {/*1*/{211,191},{211,253},{0,0}},
+  {/*1*/{211,191},{211,255},{1,0}},  {/*1*/{213,193},{213,255},{0,0}},  {/*1*/{213,195},{213,253},{1,0}},  {/*1*/{215,197},{215,253},{0,0}},
+  {/*1*/{215,197},{215,255},{1,0}},  {/*1*/{217,199},{217,255},{0,0}},  {/*1*/{217,201},{217,253},{1,0}},  {/*1*/{219,203},{219,253},{0,0}},
+  {/*1*/{219,203},{219,255},{1,0}},  {/*1*/{221,205},{221,255},{0,0}},  {/*1*/{221,207},{221,253},{1,0}},  {/*1*/{223,209},{223,253},{0,0}},
+  {/*1*/{223,209},{223,255},{1,0}},  {/*1*/{225,211},{225,255},{0,0}},  {/*1*/{225,213},{225,253},{1,0}},  {/*1*/{227,215},{227,253},{0,0}},
+  {/*1*/{227,215},{227,255},{1,0}},  {/*1*/{229,217},{229,255},{0,0}},  {/*1*/{229,219},{229,253},{1,0}},  {/*1*/{231,221},{231,253},{0,0}},
+  {/*1*/{231,221},{231,255},{1,0}},  {/*1*/{233,223},{233,255},{0,0}},  {/*1*/{233,225},{233,253},{1,0}},  {/*1*/{235,227},{235,253},{0,0}},
+  {/*1*/{235,227},{235,255},{1,0}},  {/*1*/{237,229},{237,255},{0,0}},  {/*1*/{237,231},{237,253},{1,0}},  {/*1*/{239,233},{239,253},{0,0}},
+  {/*1*/{239,233},{239,255},{1,0}},  {/*1*/{241,235},{241,255},{0,0}},  {/*1*/{241,237},{241,253},{1,0}},  {/*1*/{243,239},{243,253},{0,0}},
+  {/*1*/{243,239},{243,255},{1,0}},  {/*1*/{245,241},{245,255},{0,0}},  {/*1*/{245,243},{245,253},{1,0}},  {/*1*/{247,245},{247,253},{0,0}},
+  {/*1*/{247,245},{247,255},{1,0}},  {/*1*/{249,247},{249,255},{0,0}},  {/*1*/{249,249},{249,253},{1,0}},  {/*1*/{251,251},{251,251},{0,0}},
+  {/*1*/{251,251},{251,255},{1,0}},  {/*1*/{253,253},{253,253},{0,0}},  {/*1*/{253,255},{253,253},{1,0}},  {/*1*/{255,255},{255,255},{0,0}}
 }
 };
 
@@ -1087,265 +1087,265 @@ static PaletteSingleLookup2 const sp_lookup_7u1_4[4][256] =
 static PaletteSingleLookup4 const sp_lookup_4u1_8[4][256] =
 {
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  0,  0,1},{  0,  0,1},{  0,  0,1},{  0,  0,1}}},  {{/*1*/{  0,  0,2},{  0, 16,0},{  0,  0,2},{  0,  0,2}}},  {{/*1*/{  0,  0,3},{  0, 16,1},{  0, 16,1},{  0,  0,3}}},
-  {{/*1*/{  0,  0,4},{  0, 33,0},{  0, 16,0},{  0, 16,2}}},  {{/*1*/{  0,  0,5},{  0, 33,1},{  0, 16,1},{  0, 16,1}}},  {{/*1*/{  0,  0,6},{  0, 49,0},{  0, 16,2},{  0, 16,0}}},  {{/*1*/{  0,  0,7},{  0, 49,1},{  0, 33,2},{  0, 16,1}}},
-  {{/*1*/{  0,  0,8},{  0, 66,1},{  0, 33,1},{ 16,  0,1}}},  {{/*1*/{ 16, 16,7},{  0, 66,0},{  0, 33,0},{ 16,  0,0}}},  {{/*1*/{ 16, 16,6},{  0, 66,1},{  0, 33,1},{ 16,  0,1}}},  {{/*1*/{ 16, 16,5},{  0, 82,0},{ 16,  0,0},{  0, 33,2}}},
-  {{/*1*/{ 16, 16,4},{  0, 82,1},{  0, 49,1},{  0, 33,1}}},  {{/*1*/{ 16, 16,3},{  0, 99,0},{  0, 49,0},{  0, 33,0}}},  {{/*1*/{ 16, 16,2},{  0, 99,1},{  0, 49,1},{  0, 33,1}}},  {{/*1*/{ 16, 16,1},{  0,115,1},{ 16, 16,1},{ 16, 16,1}}},
-  {{/*1*/{ 16, 16,0},{  0,115,0},{ 16, 16,0},{ 16, 16,0}}},  {{/*1*/{ 16, 16,1},{  0,115,1},{  0, 66,1},{ 16, 16,1}}},  {{/*1*/{ 16, 16,2},{  0,132,0},{  0, 66,0},{ 33,  0,1}}},  {{/*3*/{ 16, 16,3},{  0,132,1},{  0, 66,1},{ 33,  0,0}}},
-  {{/*1*/{ 16, 16,4},{  0,148,0},{ 16, 33,0},{  0, 49,0}}},  {{/*1*/{ 16, 16,5},{  0,148,1},{ 16, 33,1},{  0, 49,1}}},  {{/*1*/{ 16, 16,6},{  0,165,1},{  0, 82,1},{ 16, 33,1}}},  {{/*1*/{ 16, 16,7},{  0,165,0},{  0, 82,0},{ 16, 33,0}}},
-  {{/*1*/{ 16, 16,8},{  0,165,1},{  0, 82,1},{ 16, 33,1}}},  {{/*1*/{ 33, 33,8},{  0,181,0},{ 16, 49,0},{ 33, 16,0}}},  {{/*1*/{ 33, 33,7},{  0,181,1},{  0, 99,1},{  0, 66,1}}},  {{/*1*/{ 33, 33,6},{  0,198,0},{  0, 99,0},{  0, 66,0}}},
-  {{/*1*/{ 33, 33,5},{ 33,  0,0},{ 33, 16,0},{ 49,  0,0}}},  {{/*1*/{ 33, 33,4},{ 16,115,0},{ 16, 66,1},{ 16, 49,0}}},  {{/*1*/{ 33, 33,3},{  0,214,0},{ 16, 66,0},{ 16, 49,1}}},  {{/*1*/{ 33, 33,2},{  0,214,1},{  0,115,1},{ 16, 49,2}}},
-  {{/*1*/{ 33, 33,1},{  0,231,0},{  0,115,0},{ 33, 33,1}}},  {{/*1*/{ 33, 33,0},{ 33, 33,0},{ 33, 33,0},{ 33, 33,0}}},  {{/*1*/{ 33, 33,1},{  0,247,0},{ 16, 82,0},{  0, 82,0}}},  {{/*1*/{ 33, 33,2},{ 33, 49,0},{ 49,  0,0},{ 49, 16,0}}},
-  {{/*1*/{ 33, 33,3},{ 16,165,0},{  0,132,1},{ 16, 66,1}}},  {{/*1*/{ 33, 33,4},{ 33, 66,0},{  0,132,0},{ 16, 66,0}}},  {{/*3*/{ 33, 33,5},{ 16,181,1},{  0,132,1},{ 66,  0,0}}},  {{/*1*/{ 33, 33,6},{ 16,181,0},{ 16, 99,0},{ 33, 49,0}}},
-  {{/*1*/{ 33, 33,7},{ 16,181,1},{  0,148,1},{  0, 99,1}}},  {{/*1*/{ 33, 33,8},{ 16,198,0},{  0,148,0},{  0, 99,0}}},  {{/*1*/{ 49, 49,7},{ 33, 99,0},{ 33, 66,0},{ 49, 33,0}}},  {{/*1*/{ 49, 49,6},{ 16,214,0},{ 16,115,0},{ 16, 82,0}}},
-  {{/*1*/{ 49, 49,5},{ 33,115,0},{ 49, 33,0},{ 66, 16,0}}},  {{/*1*/{ 49, 49,4},{ 16,231,1},{  0,165,1},{ 33, 66,1}}},  {{/*1*/{ 49, 49,3},{ 16,231,0},{  0,165,0},{ 33, 66,0}}},  {{/*2*/{ 49, 49,2},{ 16,231,1},{ 66,  0,0},{ 82,  0,0}}},
-  {{/*1*/{ 49, 49,1},{ 16,247,0},{ 16,132,0},{  0,115,0}}},  {{/*1*/{ 49, 49,0},{ 33,148,0},{ 49, 49,0},{ 49, 49,0}}},  {{/*2*/{ 49, 49,1},{ 33,148,1},{  0,181,0},{ 16, 99,1}}},  {{/*1*/{ 49, 49,2},{ 33,165,0},{ 33, 99,0},{ 16, 99,0}}},
-  {{/*3*/{ 49, 49,3},{ 33,165,1},{ 16,148,1},{ 66, 33,0}}},  {{/*1*/{ 49, 49,4},{ 33,181,0},{ 16,148,0},{ 33, 82,0}}},  {{/*3*/{ 49, 49,5},{ 33,181,1},{  0,198,1},{ 82, 16,0}}},  {{/*2*/{ 49, 49,6},{ 33,198,1},{  0,198,0},{  0,132,0}}},
-  {{/*1*/{ 49, 49,7},{ 33,198,0},{ 33,115,0},{ 49, 66,0}}},  {{/*2*/{ 49, 49,8},{ 33,198,1},{ 16,165,0},{ 16,115,0}}},  {{/*1*/{ 66, 66,8},{ 33,214,0},{ 49, 82,0},{ 66, 49,0}}},  {{/*1*/{ 66, 66,7},{ 33,214,1},{  0,214,1},{ 33, 99,1}}},
-  {{/*1*/{ 66, 66,6},{ 33,231,0},{  0,214,0},{ 33, 99,0}}},  {{/*1*/{ 66, 66,5},{ 66, 33,0},{ 66, 49,0},{ 82, 33,0}}},  {{/*1*/{ 66, 66,4},{ 49,148,0},{ 16,181,0},{  0,148,0}}},  {{/*1*/{ 66, 66,3},{ 33,247,0},{ 49, 99,0},{ 99, 16,0}}},
-  {{/*2*/{ 66, 66,2},{ 33,247,1},{  0,231,0},{ 16,132,0}}},  {{/*1*/{ 66, 66,1},{ 49,165,0},{ 33,148,0},{ 16,132,1}}},  {{/*1*/{ 66, 66,0},{ 66, 66,0},{ 66, 66,0},{ 66, 66,0}}},  {{/*1*/{ 66, 66,1},{ 49,181,0},{ 16,198,0},{ 33,115,0}}},
-  {{/*1*/{ 66, 66,2},{ 66, 82,0},{ 82, 33,0},{ 82, 49,0}}},  {{/*1*/{ 66, 66,3},{ 49,198,0},{  0,247,0},{  0,165,0}}},  {{/*1*/{ 66, 66,4},{ 66, 99,0},{ 33,165,0},{ 49, 99,0}}},  {{/*2*/{ 66, 66,5},{ 49,214,1},{ 16,214,0},{ 16,148,0}}},
-  {{/*1*/{ 66, 66,6},{ 49,214,0},{ 49,132,0},{ 66, 82,0}}},  {{/*3*/{ 66, 66,7},{ 49,214,1},{ 33,181,1},{115, 16,0}}},  {{/*1*/{ 66, 66,8},{ 49,231,0},{ 33,181,0},{ 33,132,0}}},  {{/*1*/{ 82, 82,7},{ 66,132,0},{ 66, 99,0},{ 82, 66,0}}},
-  {{/*1*/{ 82, 82,6},{ 49,247,0},{ 16,231,0},{  0,181,0}}},  {{/*1*/{ 82, 82,5},{ 66,148,0},{ 82, 66,0},{ 99, 49,0}}},  {{/*3*/{ 82, 82,4},{ 66,148,1},{ 33,198,1},{ 16,165,0}}},  {{/*1*/{ 82, 82,3},{ 66,165,0},{ 33,198,0},{ 66, 99,0}}},
-  {{/*2*/{ 82, 82,2},{ 66,165,1},{ 16,247,0},{115, 33,0}}},  {{/*2*/{ 82, 82,1},{ 66,181,1},{ 49,165,0},{ 33,148,0}}},  {{/*1*/{ 82, 82,0},{ 66,181,0},{ 82, 82,0},{ 82, 82,0}}},  {{/*2*/{ 82, 82,1},{ 66,181,1},{ 33,214,0},{  0,198,0}}},
-  {{/*1*/{ 82, 82,2},{ 66,198,0},{ 66,132,0},{ 49,132,0}}},  {{/*1*/{ 82, 82,3},{ 99,  0,0},{ 49,181,1},{ 16,181,0}}},  {{/*1*/{ 82, 82,4},{ 66,214,0},{ 49,181,0},{ 66,115,0}}},  {{/*1*/{ 82, 82,5},{ 99, 16,0},{115, 16,0},{115, 49,0}}},
-  {{/*2*/{ 82, 82,6},{ 66,231,1},{ 33,231,0},{ 33,165,0}}},  {{/*1*/{ 82, 82,7},{ 66,231,0},{ 66,148,0},{ 82, 99,0}}},  {{/*2*/{ 82, 82,8},{ 66,231,1},{ 49,198,0},{  0,214,0}}},  {{/*1*/{ 99, 99,8},{ 66,247,0},{ 82,115,0},{ 99, 82,0}}},
-  {{/*3*/{ 99, 99,7},{ 66,247,1},{ 33,247,1},{ 16,198,0}}},  {{/*1*/{ 99, 99,6},{ 82,165,0},{ 33,247,0},{ 66,132,0}}},  {{/*1*/{ 99, 99,5},{ 99, 66,0},{ 99, 82,0},{115, 66,0}}},  {{/*1*/{ 99, 99,4},{ 82,181,0},{ 49,214,0},{ 33,181,0}}},
-  {{/*1*/{ 99, 99,3},{ 99, 82,0},{ 82,132,0},{132, 49,0}}},  {{/*3*/{ 99, 99,2},{ 82,198,1},{ 66,181,1},{  0,231,0}}},  {{/*1*/{ 99, 99,1},{ 82,198,0},{ 66,181,0},{  0,231,1}}},  {{/*1*/{ 99, 99,0},{ 99, 99,0},{ 99, 99,0},{ 16,214,0}}},
-  {{/*1*/{ 99, 99,1},{ 82,214,0},{ 49,231,0},{ 66,148,0}}},  {{/*1*/{ 99, 99,2},{ 99,115,0},{115, 66,0},{115, 82,0}}},  {{/*1*/{ 99, 99,3},{ 82,231,0},{ 66,198,1},{ 33,198,0}}},  {{/*1*/{ 99, 99,4},{ 99,132,0},{ 66,198,0},{ 82,132,0}}},
-  {{/*2*/{ 99, 99,5},{ 82,247,1},{ 49,247,0},{  0,247,0}}},  {{/*1*/{ 99, 99,6},{ 82,247,0},{ 82,165,0},{ 99,115,0}}},  {{/*2*/{ 99, 99,7},{ 82,247,1},{148,  0,0},{ 16,231,0}}},  {{/*2*/{ 99, 99,8},{ 99,165,1},{ 66,214,0},{ 66,165,0}}},
-  {{/*1*/{115,115,7},{ 99,165,0},{ 99,132,0},{115, 99,0}}},  {{/*2*/{115,115,6},{ 99,165,1},{ 82,181,0},{ 33,214,0}}},  {{/*1*/{115,115,5},{ 99,181,0},{115, 99,0},{132, 82,0}}},  {{/*3*/{115,115,4},{ 99,181,1},{ 66,231,1},{ 49,198,0}}},
-  {{/*1*/{115,115,3},{ 99,198,0},{ 66,231,0},{ 99,132,0}}},  {{/*1*/{115,115,2},{132,  0,0},{132, 66,0},{ 16,247,0}}},  {{/*2*/{115,115,1},{ 99,214,1},{ 82,198,0},{ 66,181,0}}},  {{/*1*/{115,115,0},{ 99,214,0},{115,115,0},{115,115,0}}},
-  {{/*2*/{115,115,1},{ 99,214,1},{ 66,247,0},{ 33,231,0}}},  {{/*1*/{115,115,2},{ 99,231,0},{ 99,165,0},{ 82,165,0}}},  {{/*1*/{115,115,3},{132, 33,0},{165,  0,0},{ 49,214,0}}},  {{/*1*/{115,115,4},{ 99,247,0},{ 82,214,0},{ 99,148,0}}},
-  {{/*1*/{115,115,5},{132, 49,0},{148, 49,0},{148, 82,0}}},  {{/*3*/{115,115,6},{115,165,1},{ 99,181,1},{ 66,198,0}}},  {{/*1*/{115,115,7},{115,165,0},{ 99,181,0},{115,132,0}}},  {{/*2*/{115,115,8},{115,165,1},{ 82,231,0},{ 33,247,0}}},
-  {{/*1*/{132,132,8},{115,181,0},{115,148,0},{132,115,0}}},  {{/*3*/{132,132,7},{115,181,1},{ 99,198,1},{ 49,231,0}}},  {{/*1*/{132,132,6},{115,198,0},{ 99,198,0},{ 99,165,0}}},  {{/*1*/{132,132,5},{132, 99,0},{132,115,0},{148, 99,0}}},
-  {{/*1*/{132,132,4},{115,214,0},{ 82,247,0},{ 66,214,0}}},  {{/*1*/{132,132,3},{132,115,0},{115,165,0},{165, 82,0}}},  {{/*2*/{132,132,2},{115,231,1},{181,  0,0},{ 82,198,0}}},  {{/*1*/{132,132,1},{115,231,0},{ 99,214,0},{ 49,247,1}}},
-  {{/*1*/{132,132,0},{132,132,0},{132,132,0},{ 49,247,0}}},  {{/*1*/{132,132,1},{115,247,0},{115,181,0},{ 99,181,0}}},  {{/*1*/{132,132,2},{132,148,0},{148, 99,0},{148,115,0}}},  {{/*3*/{132,132,3},{132,148,1},{ 99,231,1},{ 66,231,0}}},
-  {{/*1*/{132,132,4},{132,165,0},{ 99,231,0},{115,165,0}}},  {{/*2*/{132,132,5},{132,165,1},{165, 66,0},{ 82,214,0}}},  {{/*1*/{132,132,6},{132,181,0},{115,198,0},{132,148,0}}},  {{/*2*/{132,132,7},{132,181,1},{181, 33,0},{181, 82,0}}},
-  {{/*2*/{132,132,8},{132,198,1},{ 99,247,0},{ 99,198,0}}},  {{/*1*/{148,148,7},{132,198,0},{132,165,0},{148,132,0}}},  {{/*2*/{148,148,6},{132,198,1},{115,214,0},{ 66,247,0}}},  {{/*1*/{148,148,5},{132,214,0},{148,132,0},{165,115,0}}},
-  {{/*1*/{148,148,4},{165, 16,0},{132,181,1},{ 82,231,0}}},  {{/*1*/{148,148,3},{132,231,0},{132,181,0},{132,165,0}}},  {{/*1*/{148,148,2},{165, 33,0},{165, 99,0},{181, 99,0}}},  {{/*2*/{148,148,1},{132,247,1},{115,231,0},{ 99,214,0}}},
-  {{/*1*/{148,148,0},{132,247,0},{148,148,0},{148,148,0}}},  {{/*3*/{148,148,1},{132,247,1},{132,198,1},{198, 82,0}}},  {{/*1*/{148,148,2},{148,165,0},{132,198,0},{115,198,0}}},  {{/*1*/{148,148,3},{165, 66,0},{198, 33,0},{ 82,247,0}}},
-  {{/*1*/{148,148,4},{148,181,0},{115,247,0},{132,181,0}}},  {{/*1*/{148,148,5},{165, 82,0},{181, 82,0},{181,115,0}}},  {{/*3*/{148,148,6},{148,198,1},{132,214,1},{ 99,231,0}}},  {{/*1*/{148,148,7},{148,198,0},{132,214,0},{148,165,0}}},
-  {{/*2*/{148,148,8},{148,198,1},{198, 49,0},{115,214,0}}},  {{/*1*/{165,165,8},{148,214,0},{148,181,0},{165,148,0}}},  {{/*2*/{165,165,7},{148,214,1},{214, 16,0},{214, 82,0}}},  {{/*1*/{165,165,6},{148,231,0},{132,231,0},{132,198,0}}},
-  {{/*1*/{165,165,5},{165,132,0},{165,148,0},{181,132,0}}},  {{/*1*/{165,165,4},{148,247,0},{148,198,1},{ 99,247,0}}},  {{/*1*/{165,165,3},{165,148,0},{148,198,0},{198,115,0}}},  {{/*2*/{165,165,2},{165,148,1},{214, 33,0},{115,231,0}}},
-  {{/*1*/{165,165,1},{181, 66,0},{132,247,0},{115,231,1}}},  {{/*1*/{165,165,0},{165,165,0},{165,165,0},{165,165,0}}},  {{/*2*/{165,165,1},{165,165,1},{148,214,0},{132,214,0}}},  {{/*1*/{165,165,2},{165,181,0},{181,132,0},{181,148,0}}},
-  {{/*3*/{165,165,3},{165,181,1},{165,181,1},{231, 82,0}}},  {{/*1*/{165,165,4},{165,198,0},{165,181,0},{148,198,0}}},  {{/*1*/{165,165,5},{198,  0,0},{198, 99,0},{115,247,0}}},  {{/*1*/{165,165,6},{165,214,0},{148,231,0},{165,181,0}}},
-  {{/*1*/{165,165,7},{198, 16,0},{214, 66,0},{214,115,0}}},  {{/*3*/{165,165,8},{165,231,1},{165,198,1},{132,231,0}}},  {{/*1*/{181,181,7},{165,231,0},{165,198,0},{181,165,0}}},  {{/*2*/{181,181,6},{165,231,1},{148,247,0},{148,214,0}}},
-  {{/*1*/{181,181,5},{165,247,0},{181,165,0},{198,148,0}}},  {{/*1*/{181,181,4},{198, 49,0},{247,  0,0},{247, 82,0}}},  {{/*1*/{181,181,3},{181,165,0},{165,214,0},{165,198,0}}},  {{/*1*/{181,181,2},{198, 66,0},{198,132,0},{214,132,0}}},
-  {{/*3*/{181,181,1},{181,181,1},{181,181,1},{132,247,0}}},  {{/*1*/{181,181,0},{181,181,0},{181,181,0},{181,181,0}}},  {{/*2*/{181,181,1},{181,181,1},{247, 16,0},{231,115,0}}},  {{/*1*/{181,181,2},{181,198,0},{165,231,0},{148,231,0}}},
-  {{/*1*/{181,181,3},{198, 99,0},{231, 66,0},{198,165,0}}},  {{/*1*/{181,181,4},{181,214,0},{181,198,0},{165,214,0}}},  {{/*1*/{181,181,5},{198,115,0},{214,115,0},{214,148,0}}},  {{/*1*/{181,181,6},{181,231,1},{165,247,1},{181,198,1}}},
-  {{/*1*/{181,181,7},{181,231,0},{165,247,0},{181,198,0}}},  {{/*2*/{181,181,8},{181,231,1},{231, 82,0},{148,247,0}}},  {{/*1*/{198,198,8},{181,247,0},{181,214,0},{198,181,0}}},  {{/*2*/{198,198,7},{181,247,1},{247, 49,0},{247,115,0}}},
-  {{/*3*/{198,198,6},{198,165,1},{198,181,1},{165,231,0}}},  {{/*1*/{198,198,5},{198,165,0},{198,181,0},{214,165,0}}},  {{/*3*/{198,198,4},{198,181,1},{181,231,1},{181,214,0}}},  {{/*1*/{198,198,3},{198,181,0},{181,231,0},{231,148,0}}},
-  {{/*2*/{198,198,2},{198,181,1},{247, 66,0},{231,148,1}}},  {{/*1*/{198,198,1},{214, 99,0},{198,198,1},{198,198,1}}},  {{/*1*/{198,198,0},{198,198,0},{198,198,0},{198,198,0}}},  {{/*2*/{198,198,1},{198,198,1},{181,247,0},{165,247,0}}},
-  {{/*1*/{198,198,2},{198,214,0},{214,165,0},{214,181,0}}},  {{/*1*/{198,198,3},{198,214,1},{198,214,1},{181,231,1}}},  {{/*1*/{198,198,4},{198,231,0},{198,214,0},{181,231,0}}},  {{/*1*/{198,198,5},{231, 33,0},{231,132,0},{231,165,0}}},
-  {{/*1*/{198,198,6},{198,247,0},{214,181,0},{198,214,0}}},  {{/*1*/{198,198,7},{231, 49,0},{247, 99,0},{247,148,0}}},  {{/*1*/{198,198,8},{214,165,1},{198,231,1},{214,198,1}}},  {{/*1*/{214,214,7},{214,165,0},{198,231,0},{214,198,0}}},
-  {{/*3*/{214,214,6},{214,181,1},{198,231,1},{181,247,0}}},  {{/*1*/{214,214,5},{214,181,0},{214,198,0},{231,181,0}}},  {{/*1*/{214,214,4},{231, 82,0},{198,247,1},{198,231,1}}},  {{/*1*/{214,214,3},{214,198,0},{198,247,0},{198,231,0}}},
-  {{/*1*/{214,214,2},{231, 99,0},{231,165,0},{247,165,0}}},  {{/*1*/{214,214,1},{214,214,1},{214,214,1},{214,214,1}}},  {{/*1*/{214,214,0},{214,214,0},{214,214,0},{214,214,0}}},  {{/*1*/{214,214,1},{214,214,1},{214,214,1},{214,214,1}}},
-  {{/*1*/{214,214,2},{214,231,0},{231,181,0},{231,198,1}}},  {{/*1*/{214,214,3},{231,132,0},{214,231,1},{231,198,0}}},  {{/*1*/{214,214,4},{214,247,0},{214,231,0},{198,247,0}}},  {{/*1*/{214,214,5},{231,148,0},{247,148,0},{247,181,0}}},
-  {{/*1*/{214,214,6},{231,165,1},{231,198,1},{214,231,1}}},  {{/*1*/{214,214,7},{231,165,0},{231,198,0},{214,231,0}}},  {{/*1*/{214,214,8},{231,181,1},{214,247,1},{214,231,1}}},  {{/*1*/{231,231,8},{231,181,0},{214,247,0},{231,214,0}}},
-  {{/*1*/{231,231,7},{231,181,1},{214,247,1},{231,214,1}}},  {{/*1*/{231,231,6},{231,198,1},{231,214,1},{247,198,1}}},  {{/*1*/{231,231,5},{231,198,0},{231,214,0},{247,198,0}}},  {{/*3*/{231,231,4},{231,214,1},{231,214,1},{214,247,0}}},
-  {{/*1*/{231,231,3},{231,214,0},{247,181,0},{214,247,1}}},  {{/*1*/{231,231,2},{231,214,1},{247,181,1},{214,247,2}}},  {{/*1*/{231,231,1},{247,132,0},{231,231,1},{231,231,1}}},  {{/*1*/{231,231,0},{231,231,0},{231,231,0},{231,231,0}}},
-  {{/*1*/{231,231,1},{231,231,1},{231,231,1},{231,231,1}}},  {{/*1*/{231,231,2},{231,247,0},{247,198,0},{247,214,0}}},  {{/*1*/{231,231,3},{231,247,1},{231,247,1},{247,214,1}}},  {{/*1*/{231,231,4},{247,165,0},{231,247,0},{231,247,2}}},
-  {{/*1*/{231,231,5},{247,181,1},{231,247,1},{231,247,1}}},  {{/*1*/{231,231,6},{247,181,0},{247,214,0},{231,247,0}}},  {{/*1*/{231,231,7},{247,181,1},{247,214,1},{231,247,1}}},  {{/*1*/{231,231,8},{247,198,1},{247,214,2},{247,231,1}}},
-  {{/*1*/{247,247,7},{247,198,0},{247,231,2},{247,231,0}}},  {{/*1*/{247,247,6},{247,214,1},{247,231,1},{247,231,1}}},  {{/*1*/{247,247,5},{247,214,0},{247,231,0},{247,231,2}}},  {{/*1*/{247,247,4},{247,231,1},{247,231,1},{247,231,3}}},
-  {{/*1*/{247,247,3},{247,231,0},{247,231,2},{247,247,3}}},  {{/*1*/{247,247,2},{247,231,1},{247,247,2},{247,247,2}}},  {{/*1*/{247,247,1},{247,247,1},{247,247,1},{247,247,1}}},  {{/*1*/{247,247,0},{247,247,0},{247,247,0},{247,247,0}}},
-  {{/*1*/{247,247,1},{247,247,1},{247,247,1},{247,247,1}}},  {{/*1*/{247,247,2},{247,247,2},{247,247,2},{247,247,2}}},  {{/*1*/{247,247,3},{247,247,3},{247,247,3},{247,247,3}}},  {{/*1*/{247,247,4},{247,247,4},{247,247,4},{247,247,4}}},
-  {{/*1*/{247,247,5},{247,247,5},{247,247,5},{247,247,5}}},  {{/*1*/{247,247,6},{247,247,6},{247,247,6},{247,247,6}}},  {{/*1*/{247,247,7},{247,247,7},{247,247,7},{247,247,7}}},  {{/*1*/{247,247,8},{247,247,8},{247,247,8},{247,247,8}}}
+  {/*1*/{  0,  0,  0,  0},{  0,  0,  0,  0},{0,0,0,0}},  {/*1*/{  0,  0,  0,  0},{  0,  0,  0,  0},{1,1,1,1}},  {/*1*/{  0,  0,  0,  0},{  0, 16,  0,  0},{2,0,2,2}},  {/*1*/{  0,  0,  0,  0},{  0, 16, 16,  0},{3,1,1,3}},
+  {/*1*/{  0,  0,  0,  0},{  0, 33, 16, 16},{4,0,0,2}},  {/*1*/{  0,  0,  0,  0},{  0, 33, 16, 16},{5,1,1,1}},  {/*1*/{  0,  0,  0,  0},{  0, 49, 16, 16},{6,0,2,0}},  {/*1*/{  0,  0,  0,  0},{  0, 49, 33, 16},{7,1,2,1}},
+  {/*1*/{  0,  0,  0, 16},{  0, 66, 33,  0},{8,1,1,1}},  {/*1*/{ 16,  0,  0, 16},{ 16, 66, 33,  0},{7,0,0,0}},  {/*1*/{ 16,  0,  0, 16},{ 16, 66, 33,  0},{6,1,1,1}},  {/*1*/{ 16,  0, 16,  0},{ 16, 82,  0, 33},{5,0,0,2}},
+  {/*1*/{ 16,  0,  0,  0},{ 16, 82, 49, 33},{4,1,1,1}},  {/*1*/{ 16,  0,  0,  0},{ 16, 99, 49, 33},{3,0,0,0}},  {/*1*/{ 16,  0,  0,  0},{ 16, 99, 49, 33},{2,1,1,1}},  {/*1*/{ 16,  0, 16, 16},{ 16,115, 16, 16},{1,1,1,1}},
+  {/*1*/{ 16,  0, 16, 16},{ 16,115, 16, 16},{0,0,0,0}},  {/*1*/{ 16,  0,  0, 16},{ 16,115, 66, 16},{1,1,1,1}},  {/*1*/{ 16,  0,  0, 33},{ 16,132, 66,  0},{2,0,0,1}},  {/*3*/{ 16,  0,  0, 33},{ 16,132, 66,  0},{3,1,1,0}},
+  {/*1*/{ 16,  0, 16,  0},{ 16,148, 33, 49},{4,0,0,0}},  {/*1*/{ 16,  0, 16,  0},{ 16,148, 33, 49},{5,1,1,1}},  {/*1*/{ 16,  0,  0, 16},{ 16,165, 82, 33},{6,1,1,1}},  {/*1*/{ 16,  0,  0, 16},{ 16,165, 82, 33},{7,0,0,0}},
+  {/*1*/{ 16,  0,  0, 16},{ 16,165, 82, 33},{8,1,1,1}},  {/*1*/{ 33,  0, 16, 33},{ 33,181, 49, 16},{8,0,0,0}},  {/*1*/{ 33,  0,  0,  0},{ 33,181, 99, 66},{7,1,1,1}},  {/*1*/{ 33,  0,  0,  0},{ 33,198, 99, 66},{6,0,0,0}},
+  {/*1*/{ 33, 33, 33, 49},{ 33,  0, 16,  0},{5,0,0,0}},  {/*1*/{ 33, 16, 16, 16},{ 33,115, 66, 49},{4,0,1,0}},  {/*1*/{ 33,  0, 16, 16},{ 33,214, 66, 49},{3,0,0,1}},  {/*1*/{ 33,  0,  0, 16},{ 33,214,115, 49},{2,1,1,2}},
+  {/*1*/{ 33,  0,  0, 33},{ 33,231,115, 33},{1,0,0,1}},  {/*1*/{ 33, 33, 33, 33},{ 33, 33, 33, 33},{0,0,0,0}},  {/*1*/{ 33,  0, 16,  0},{ 33,247, 82, 82},{1,0,0,0}},  {/*1*/{ 33, 33, 49, 49},{ 33, 49,  0, 16},{2,0,0,0}},
+  {/*1*/{ 33, 16,  0, 16},{ 33,165,132, 66},{3,0,1,1}},  {/*1*/{ 33, 33,  0, 16},{ 33, 66,132, 66},{4,0,0,0}},  {/*3*/{ 33, 16,  0, 66},{ 33,181,132,  0},{5,1,1,0}},  {/*1*/{ 33, 16, 16, 33},{ 33,181, 99, 49},{6,0,0,0}},
+  {/*1*/{ 33, 16,  0,  0},{ 33,181,148, 99},{7,1,1,1}},  {/*1*/{ 33, 16,  0,  0},{ 33,198,148, 99},{8,0,0,0}},  {/*1*/{ 49, 33, 33, 49},{ 49, 99, 66, 33},{7,0,0,0}},  {/*1*/{ 49, 16, 16, 16},{ 49,214,115, 82},{6,0,0,0}},
+  {/*1*/{ 49, 33, 49, 66},{ 49,115, 33, 16},{5,0,0,0}},  {/*1*/{ 49, 16,  0, 33},{ 49,231,165, 66},{4,1,1,1}},  {/*1*/{ 49, 16,  0, 33},{ 49,231,165, 66},{3,0,0,0}},  {/*2*/{ 49, 16, 66, 82},{ 49,231,  0,  0},{2,1,0,0}},
+  {/*1*/{ 49, 16, 16,  0},{ 49,247,132,115},{1,0,0,0}},  {/*1*/{ 49, 33, 49, 49},{ 49,148, 49, 49},{0,0,0,0}},  {/*2*/{ 49, 33,  0, 16},{ 49,148,181, 99},{1,1,0,1}},  {/*1*/{ 49, 33, 33, 16},{ 49,165, 99, 99},{2,0,0,0}},
+  {/*3*/{ 49, 33, 16, 66},{ 49,165,148, 33},{3,1,1,0}},  {/*1*/{ 49, 33, 16, 33},{ 49,181,148, 82},{4,0,0,0}},  {/*3*/{ 49, 33,  0, 82},{ 49,181,198, 16},{5,1,1,0}},  {/*2*/{ 49, 33,  0,  0},{ 49,198,198,132},{6,1,0,0}},
+  {/*1*/{ 49, 33, 33, 49},{ 49,198,115, 66},{7,0,0,0}},  {/*2*/{ 49, 33, 16, 16},{ 49,198,165,115},{8,1,0,0}},  {/*1*/{ 66, 33, 49, 66},{ 66,214, 82, 49},{8,0,0,0}},  {/*1*/{ 66, 33,  0, 33},{ 66,214,214, 99},{7,1,1,1}},
+  {/*1*/{ 66, 33,  0, 33},{ 66,231,214, 99},{6,0,0,0}},  {/*1*/{ 66, 66, 66, 82},{ 66, 33, 49, 33},{5,0,0,0}},  {/*1*/{ 66, 49, 16,  0},{ 66,148,181,148},{4,0,0,0}},  {/*1*/{ 66, 33, 49, 99},{ 66,247, 99, 16},{3,0,0,0}},
+  {/*2*/{ 66, 33,  0, 16},{ 66,247,231,132},{2,1,0,0}},  {/*1*/{ 66, 49, 33, 16},{ 66,165,148,132},{1,0,0,1}},  {/*1*/{ 66, 66, 66, 66},{ 66, 66, 66, 66},{0,0,0,0}},  {/*1*/{ 66, 49, 16, 33},{ 66,181,198,115},{1,0,0,0}},
+  {/*1*/{ 66, 66, 82, 82},{ 66, 82, 33, 49},{2,0,0,0}},  {/*1*/{ 66, 49,  0,  0},{ 66,198,247,165},{3,0,0,0}},  {/*1*/{ 66, 66, 33, 49},{ 66, 99,165, 99},{4,0,0,0}},  {/*2*/{ 66, 49, 16, 16},{ 66,214,214,148},{5,1,0,0}},
+  {/*1*/{ 66, 49, 49, 66},{ 66,214,132, 82},{6,0,0,0}},  {/*3*/{ 66, 49, 33,115},{ 66,214,181, 16},{7,1,1,0}},  {/*1*/{ 66, 49, 33, 33},{ 66,231,181,132},{8,0,0,0}},  {/*1*/{ 82, 66, 66, 82},{ 82,132, 99, 66},{7,0,0,0}},
+  {/*1*/{ 82, 49, 16,  0},{ 82,247,231,181},{6,0,0,0}},  {/*1*/{ 82, 66, 82, 99},{ 82,148, 66, 49},{5,0,0,0}},  {/*3*/{ 82, 66, 33, 16},{ 82,148,198,165},{4,1,1,0}},  {/*1*/{ 82, 66, 33, 66},{ 82,165,198, 99},{3,0,0,0}},
+  {/*2*/{ 82, 66, 16,115},{ 82,165,247, 33},{2,1,0,0}},  {/*2*/{ 82, 66, 49, 33},{ 82,181,165,148},{1,1,0,0}},  {/*1*/{ 82, 66, 82, 82},{ 82,181, 82, 82},{0,0,0,0}},  {/*2*/{ 82, 66, 33,  0},{ 82,181,214,198},{1,1,0,0}},
+  {/*1*/{ 82, 66, 66, 49},{ 82,198,132,132},{2,0,0,0}},  {/*1*/{ 82, 99, 49, 16},{ 82,  0,181,181},{3,0,1,0}},  {/*1*/{ 82, 66, 49, 66},{ 82,214,181,115},{4,0,0,0}},  {/*1*/{ 82, 99,115,115},{ 82, 16, 16, 49},{5,0,0,0}},
+  {/*2*/{ 82, 66, 33, 33},{ 82,231,231,165},{6,1,0,0}},  {/*1*/{ 82, 66, 66, 82},{ 82,231,148, 99},{7,0,0,0}},  {/*2*/{ 82, 66, 49,  0},{ 82,231,198,214},{8,1,0,0}},  {/*1*/{ 99, 66, 82, 99},{ 99,247,115, 82},{8,0,0,0}},
+  {/*3*/{ 99, 66, 33, 16},{ 99,247,247,198},{7,1,1,0}},  {/*1*/{ 99, 82, 33, 66},{ 99,165,247,132},{6,0,0,0}},  {/*1*/{ 99, 99, 99,115},{ 99, 66, 82, 66},{5,0,0,0}},  {/*1*/{ 99, 82, 49, 33},{ 99,181,214,181},{4,0,0,0}},
+  {/*1*/{ 99, 99, 82,132},{ 99, 82,132, 49},{3,0,0,0}},  {/*3*/{ 99, 82, 66,  0},{ 99,198,181,231},{2,1,1,0}},  {/*1*/{ 99, 82, 66,  0},{ 99,198,181,231},{1,0,0,1}},  {/*1*/{ 99, 99, 99, 16},{ 99, 99, 99,214},{0,0,0,0}},
+  {/*1*/{ 99, 82, 49, 66},{ 99,214,231,148},{1,0,0,0}},  {/*1*/{ 99, 99,115,115},{ 99,115, 66, 82},{2,0,0,0}},  {/*1*/{ 99, 82, 66, 33},{ 99,231,198,198},{3,0,1,0}},  {/*1*/{ 99, 99, 66, 82},{ 99,132,198,132},{4,0,0,0}},
+  {/*2*/{ 99, 82, 49,  0},{ 99,247,247,247},{5,1,0,0}},  {/*1*/{ 99, 82, 82, 99},{ 99,247,165,115},{6,0,0,0}},  {/*2*/{ 99, 82,148, 16},{ 99,247,  0,231},{7,1,0,0}},  {/*2*/{ 99, 99, 66, 66},{ 99,165,214,165},{8,1,0,0}},
+  {/*1*/{115, 99, 99,115},{115,165,132, 99},{7,0,0,0}},  {/*2*/{115, 99, 82, 33},{115,165,181,214},{6,1,0,0}},  {/*1*/{115, 99,115,132},{115,181, 99, 82},{5,0,0,0}},  {/*3*/{115, 99, 66, 49},{115,181,231,198},{4,1,1,0}},
+  {/*1*/{115, 99, 66, 99},{115,198,231,132},{3,0,0,0}},  {/*1*/{115,132,132, 16},{115,  0, 66,247},{2,0,0,0}},  {/*2*/{115, 99, 82, 66},{115,214,198,181},{1,1,0,0}},  {/*1*/{115, 99,115,115},{115,214,115,115},{0,0,0,0}},
+  {/*2*/{115, 99, 66, 33},{115,214,247,231},{1,1,0,0}},  {/*1*/{115, 99, 99, 82},{115,231,165,165},{2,0,0,0}},  {/*1*/{115,132,165, 49},{115, 33,  0,214},{3,0,0,0}},  {/*1*/{115, 99, 82, 99},{115,247,214,148},{4,0,0,0}},
+  {/*1*/{115,132,148,148},{115, 49, 49, 82},{5,0,0,0}},  {/*3*/{115,115, 99, 66},{115,165,181,198},{6,1,1,0}},  {/*1*/{115,115, 99,115},{115,165,181,132},{7,0,0,0}},  {/*2*/{115,115, 82, 33},{115,165,231,247},{8,1,0,0}},
+  {/*1*/{132,115,115,132},{132,181,148,115},{8,0,0,0}},  {/*3*/{132,115, 99, 49},{132,181,198,231},{7,1,1,0}},  {/*1*/{132,115, 99, 99},{132,198,198,165},{6,0,0,0}},  {/*1*/{132,132,132,148},{132, 99,115, 99},{5,0,0,0}},
+  {/*1*/{132,115, 82, 66},{132,214,247,214},{4,0,0,0}},  {/*1*/{132,132,115,165},{132,115,165, 82},{3,0,0,0}},  {/*2*/{132,115,181, 82},{132,231,  0,198},{2,1,0,0}},  {/*1*/{132,115, 99, 49},{132,231,214,247},{1,0,0,1}},
+  {/*1*/{132,132,132, 49},{132,132,132,247},{0,0,0,0}},  {/*1*/{132,115,115, 99},{132,247,181,181},{1,0,0,0}},  {/*1*/{132,132,148,148},{132,148, 99,115},{2,0,0,0}},  {/*3*/{132,132, 99, 66},{132,148,231,231},{3,1,1,0}},
+  {/*1*/{132,132, 99,115},{132,165,231,165},{4,0,0,0}},  {/*2*/{132,132,165, 82},{132,165, 66,214},{5,1,0,0}},  {/*1*/{132,132,115,132},{132,181,198,148},{6,0,0,0}},  {/*2*/{132,132,181,181},{132,181, 33, 82},{7,1,0,0}},
+  {/*2*/{132,132, 99, 99},{132,198,247,198},{8,1,0,0}},  {/*1*/{148,132,132,148},{148,198,165,132},{7,0,0,0}},  {/*2*/{148,132,115, 66},{148,198,214,247},{6,1,0,0}},  {/*1*/{148,132,148,165},{148,214,132,115},{5,0,0,0}},
+  {/*1*/{148,165,132, 82},{148, 16,181,231},{4,0,1,0}},  {/*1*/{148,132,132,132},{148,231,181,165},{3,0,0,0}},  {/*1*/{148,165,165,181},{148, 33, 99, 99},{2,0,0,0}},  {/*2*/{148,132,115, 99},{148,247,231,214},{1,1,0,0}},
+  {/*1*/{148,132,148,148},{148,247,148,148},{0,0,0,0}},  {/*3*/{148,132,132,198},{148,247,198, 82},{1,1,1,0}},  {/*1*/{148,148,132,115},{148,165,198,198},{2,0,0,0}},  {/*1*/{148,165,198, 82},{148, 66, 33,247},{3,0,0,0}},
+  {/*1*/{148,148,115,132},{148,181,247,181},{4,0,0,0}},  {/*1*/{148,165,181,181},{148, 82, 82,115},{5,0,0,0}},  {/*3*/{148,148,132, 99},{148,198,214,231},{6,1,1,0}},  {/*1*/{148,148,132,148},{148,198,214,165},{7,0,0,0}},
+  {/*2*/{148,148,198,115},{148,198, 49,214},{8,1,0,0}},  {/*1*/{165,148,148,165},{165,214,181,148},{8,0,0,0}},  {/*2*/{165,148,214,214},{165,214, 16, 82},{7,1,0,0}},  {/*1*/{165,148,132,132},{165,231,231,198},{6,0,0,0}},
+  {/*1*/{165,165,165,181},{165,132,148,132},{5,0,0,0}},  {/*1*/{165,148,148, 99},{165,247,198,247},{4,0,1,0}},  {/*1*/{165,165,148,198},{165,148,198,115},{3,0,0,0}},  {/*2*/{165,165,214,115},{165,148, 33,231},{2,1,0,0}},
+  {/*1*/{165,181,132,115},{165, 66,247,231},{1,0,0,1}},  {/*1*/{165,165,165,165},{165,165,165,165},{0,0,0,0}},  {/*2*/{165,165,148,132},{165,165,214,214},{1,1,0,0}},  {/*1*/{165,165,181,181},{165,181,132,148},{2,0,0,0}},
+  {/*3*/{165,165,165,231},{165,181,181, 82},{3,1,1,0}},  {/*1*/{165,165,165,148},{165,198,181,198},{4,0,0,0}},  {/*1*/{165,198,198,115},{165,  0, 99,247},{5,0,0,0}},  {/*1*/{165,165,148,165},{165,214,231,181},{6,0,0,0}},
+  {/*1*/{165,198,214,214},{165, 16, 66,115},{7,0,0,0}},  {/*3*/{165,165,165,132},{165,231,198,231},{8,1,1,0}},  {/*1*/{181,165,165,181},{181,231,198,165},{7,0,0,0}},  {/*2*/{181,165,148,148},{181,231,247,214},{6,1,0,0}},
+  {/*1*/{181,165,181,198},{181,247,165,148},{5,0,0,0}},  {/*1*/{181,198,247,247},{181, 49,  0, 82},{4,0,0,0}},  {/*1*/{181,181,165,165},{181,165,214,198},{3,0,0,0}},  {/*1*/{181,198,198,214},{181, 66,132,132},{2,0,0,0}},
+  {/*3*/{181,181,181,132},{181,181,181,247},{1,1,1,0}},  {/*1*/{181,181,181,181},{181,181,181,181},{0,0,0,0}},  {/*2*/{181,181,247,231},{181,181, 16,115},{1,1,0,0}},  {/*1*/{181,181,165,148},{181,198,231,231},{2,0,0,0}},
+  {/*1*/{181,198,231,198},{181, 99, 66,165},{3,0,0,0}},  {/*1*/{181,181,181,165},{181,214,198,214},{4,0,0,0}},  {/*1*/{181,198,214,214},{181,115,115,148},{5,0,0,0}},  {/*1*/{181,181,165,181},{181,231,247,198},{6,1,1,1}},
+  {/*1*/{181,181,165,181},{181,231,247,198},{7,0,0,0}},  {/*2*/{181,181,231,148},{181,231, 82,247},{8,1,0,0}},  {/*1*/{198,181,181,198},{198,247,214,181},{8,0,0,0}},  {/*2*/{198,181,247,247},{198,247, 49,115},{7,1,0,0}},
+  {/*3*/{198,198,198,165},{198,165,181,231},{6,1,1,0}},  {/*1*/{198,198,198,214},{198,165,181,165},{5,0,0,0}},  {/*3*/{198,198,181,181},{198,181,231,214},{4,1,1,0}},  {/*1*/{198,198,181,231},{198,181,231,148},{3,0,0,0}},
+  {/*2*/{198,198,247,231},{198,181, 66,148},{2,1,0,1}},  {/*1*/{198,214,198,198},{198, 99,198,198},{1,0,1,1}},  {/*1*/{198,198,198,198},{198,198,198,198},{0,0,0,0}},  {/*2*/{198,198,181,165},{198,198,247,247},{1,1,0,0}},
+  {/*1*/{198,198,214,214},{198,214,165,181},{2,0,0,0}},  {/*1*/{198,198,198,181},{198,214,214,231},{3,1,1,1}},  {/*1*/{198,198,198,181},{198,231,214,231},{4,0,0,0}},  {/*1*/{198,231,231,231},{198, 33,132,165},{5,0,0,0}},
+  {/*1*/{198,198,214,198},{198,247,181,214},{6,0,0,0}},  {/*1*/{198,231,247,247},{198, 49, 99,148},{7,0,0,0}},  {/*1*/{198,214,198,214},{198,165,231,198},{8,1,1,1}},  {/*1*/{214,214,198,214},{214,165,231,198},{7,0,0,0}},
+  {/*3*/{214,214,198,181},{214,181,231,247},{6,1,1,0}},  {/*1*/{214,214,214,231},{214,181,198,181},{5,0,0,0}},  {/*1*/{214,231,198,198},{214, 82,247,231},{4,0,1,1}},  {/*1*/{214,214,198,198},{214,198,247,231},{3,0,0,0}},
+  {/*1*/{214,231,231,247},{214, 99,165,165},{2,0,0,0}},  {/*1*/{214,214,214,214},{214,214,214,214},{1,1,1,1}},  {/*1*/{214,214,214,214},{214,214,214,214},{0,0,0,0}},  {/*1*/{214,214,214,214},{214,214,214,214},{1,1,1,1}},
+  {/*1*/{214,214,231,231},{214,231,181,198},{2,0,0,1}},  {/*1*/{214,231,214,231},{214,132,231,198},{3,0,1,0}},  {/*1*/{214,214,214,198},{214,247,231,247},{4,0,0,0}},  {/*1*/{214,231,247,247},{214,148,148,181},{5,0,0,0}},
+  {/*1*/{214,231,231,214},{214,165,198,231},{6,1,1,1}},  {/*1*/{214,231,231,214},{214,165,198,231},{7,0,0,0}},  {/*1*/{214,231,214,214},{214,181,247,231},{8,1,1,1}},  {/*1*/{231,231,214,231},{231,181,247,214},{8,0,0,0}},
+  {/*1*/{231,231,214,231},{231,181,247,214},{7,1,1,1}},  {/*1*/{231,231,231,247},{231,198,214,198},{6,1,1,1}},  {/*1*/{231,231,231,247},{231,198,214,198},{5,0,0,0}},  {/*3*/{231,231,231,214},{231,214,214,247},{4,1,1,0}},
+  {/*1*/{231,231,247,214},{231,214,181,247},{3,0,0,1}},  {/*1*/{231,231,247,214},{231,214,181,247},{2,1,1,2}},  {/*1*/{231,247,231,231},{231,132,231,231},{1,0,1,1}},  {/*1*/{231,231,231,231},{231,231,231,231},{0,0,0,0}},
+  {/*1*/{231,231,231,231},{231,231,231,231},{1,1,1,1}},  {/*1*/{231,231,247,247},{231,247,198,214},{2,0,0,0}},  {/*1*/{231,231,231,247},{231,247,247,214},{3,1,1,1}},  {/*1*/{231,247,231,231},{231,165,247,247},{4,0,0,2}},
+  {/*1*/{231,247,231,231},{231,181,247,247},{5,1,1,1}},  {/*1*/{231,247,247,231},{231,181,214,247},{6,0,0,0}},  {/*1*/{231,247,247,231},{231,181,214,247},{7,1,1,1}},  {/*1*/{231,247,247,247},{231,198,214,231},{8,1,2,1}},
+  {/*1*/{247,247,247,247},{247,198,231,231},{7,0,2,0}},  {/*1*/{247,247,247,247},{247,214,231,231},{6,1,1,1}},  {/*1*/{247,247,247,247},{247,214,231,231},{5,0,0,2}},  {/*1*/{247,247,247,247},{247,231,231,231},{4,1,1,3}},
+  {/*1*/{247,247,247,247},{247,231,231,247},{3,0,2,3}},  {/*1*/{247,247,247,247},{247,231,247,247},{2,1,2,2}},  {/*1*/{247,247,247,247},{247,247,247,247},{1,1,1,1}},  {/*1*/{247,247,247,247},{247,247,247,247},{0,0,0,0}},
+  {/*1*/{247,247,247,247},{247,247,247,247},{1,1,1,1}},  {/*1*/{247,247,247,247},{247,247,247,247},{2,2,2,2}},  {/*1*/{247,247,247,247},{247,247,247,247},{3,3,3,3}},  {/*1*/{247,247,247,247},{247,247,247,247},{4,4,4,4}},
+  {/*1*/{247,247,247,247},{247,247,247,247},{5,5,5,5}},  {/*1*/{247,247,247,247},{247,247,247,247},{6,6,6,6}},  {/*1*/{247,247,247,247},{247,247,247,247},{7,7,7,7}},  {/*1*/{247,247,247,247},{247,247,247,247},{8,8,8,8}}
 },{
-  {{/*3*/{  8,  0,8},{  8,  0,6},{  8,  0,5},{  8,  0,4}}},  {{/*3*/{  8,  0,7},{  8,  0,5},{  8,  0,4},{  8,  0,3}}},  {{/*3*/{  8,  0,6},{  8,  0,4},{  8,  0,3},{  8,  0,2}}},  {{/*3*/{  8,  0,5},{  8,  0,3},{  8,  0,2},{  8,  0,1}}},
-  {{/*3*/{  8,  0,4},{  8,  0,2},{  8,  0,1},{  8,  0,0}}},  {{/*2*/{  8,  0,3},{  8,  0,1},{  8,  0,0},{  8,  0,1}}},  {{/*1*/{  8,  0,2},{  8,  0,0},{  8,  0,1},{  8,  0,2}}},  {{/*1*/{  8,  0,1},{  8,  0,1},{  8,  0,2},{  8,  0,3}}},
-  {{/*0*/{  8,  0,0},{  8, 16,1},{  8, 16,2},{  8, 16,3}}},  {{/*1*/{  8,  0,1},{  8, 16,0},{  8, 16,1},{  8, 16,2}}},  {{/*2*/{  8,  0,2},{  8, 16,1},{  8, 16,0},{  8, 16,1}}},  {{/*1*/{  8,  0,3},{  8, 33,0},{  8, 16,1},{  8, 16,0}}},
-  {{/*1*/{  8,  0,4},{  8, 33,1},{  8, 16,2},{  8, 16,1}}},  {{/*1*/{  8,  0,5},{  8, 49,0},{  8, 33,2},{ 24,  0,0}}},  {{/*1*/{  8,  0,6},{  8, 49,1},{  8, 33,1},{ 24,  0,1}}},  {{/*2*/{  8,  0,7},{  8, 66,1},{  8, 33,0},{ 24,  0,2}}},
-  {{/*1*/{  8,  0,8},{  8, 66,0},{  8, 33,1},{  8, 33,2}}},  {{/*2*/{ 24, 16,7},{  8, 66,1},{ 24,  0,0},{  8, 33,1}}},  {{/*1*/{ 24, 16,6},{  8, 82,0},{  8, 49,1},{  8, 33,0}}},  {{/*2*/{ 24, 16,5},{  8, 82,1},{  8, 49,0},{  8, 33,1}}},
-  {{/*1*/{ 24, 16,4},{  8, 99,0},{  8, 49,1},{ 24, 16,0}}},  {{/*2*/{ 24, 16,3},{  8, 99,1},{ 24, 16,0},{ 24, 16,1}}},  {{/*1*/{ 24, 16,2},{ 24, 16,0},{ 24, 16,1},{ 41,  0,1}}},  {{/*1*/{ 24, 16,1},{  8,115,0},{  8, 66,1},{ 41,  0,0}}},
-  {{/*2*/{ 24, 16,0},{  8,115,1},{  8, 66,0},{  8, 49,1}}},  {{/*1*/{ 24, 16,1},{  8,132,0},{  8, 66,1},{  8, 49,0}}},  {{/*2*/{ 24, 16,2},{  8,132,1},{ 24, 33,0},{  8, 49,1}}},  {{/*1*/{ 24, 16,3},{  8,148,0},{  8, 82,1},{ 24, 33,0}}},
-  {{/*2*/{ 24, 16,4},{  8,148,1},{  8, 82,0},{ 24, 33,1}}},  {{/*1*/{ 24, 16,5},{ 24, 66,0},{ 41,  0,0},{ 41, 16,1}}},  {{/*1*/{ 24, 16,6},{  8,165,0},{ 24, 49,1},{ 41, 16,0}}},  {{/*2*/{ 24, 16,7},{  8,165,1},{ 24, 49,0},{  8, 66,1}}},
-  {{/*1*/{ 24, 16,8},{  8,181,0},{  8, 99,1},{  8, 66,0}}},  {{/*2*/{ 41, 33,8},{  8,181,1},{  8, 99,0},{  8, 66,1}}},  {{/*1*/{ 41, 33,7},{  8,198,0},{  8, 99,1},{ 24, 49,0}}},  {{/*1*/{ 41, 33,6},{ 41,  0,0},{ 24, 66,0},{ 24, 49,1}}},
-  {{/*1*/{ 41, 33,5},{  8,214,0},{ 24, 66,1},{ 41, 33,1}}},  {{/*1*/{ 41, 33,4},{ 41, 16,0},{  8,115,1},{ 41, 33,0}}},  {{/*2*/{ 41, 33,3},{  8,231,1},{  8,115,0},{  8, 82,1}}},  {{/*1*/{ 41, 33,2},{  8,231,0},{  8,115,1},{  8, 82,0}}},
-  {{/*2*/{ 41, 33,1},{  8,231,1},{ 24, 82,0},{  8, 82,1}}},  {{/*1*/{ 41, 33,0},{  8,247,0},{  8,132,1},{ 24, 66,0}}},  {{/*1*/{ 41, 33,1},{ 41, 49,0},{  8,132,0},{ 74,  0,0}}},  {{/*1*/{ 41, 33,2},{ 24,165,0},{ 41, 49,0},{ 41, 49,1}}},
-  {{/*1*/{ 41, 33,3},{ 41, 66,0},{ 24, 99,1},{ 41, 49,0}}},  {{/*2*/{ 41, 33,4},{ 24,181,1},{ 24, 99,0},{  8, 99,1}}},  {{/*1*/{ 41, 33,5},{ 24,181,0},{  8,148,1},{  8, 99,0}}},  {{/*2*/{ 41, 33,6},{ 24,181,1},{  8,148,0},{  8, 99,1}}},
-  {{/*1*/{ 41, 33,7},{ 24,198,0},{ 41, 66,0},{ 24, 82,0}}},  {{/*1*/{ 41, 33,8},{ 41, 99,0},{ 24,115,0},{ 74, 16,0}}},  {{/*1*/{ 57, 49,7},{ 24,214,0},{ 57, 33,0},{ 41, 66,1}}},  {{/*1*/{ 57, 49,6},{ 41,115,0},{  8,165,1},{ 41, 66,0}}},
-  {{/*2*/{ 57, 49,5},{ 24,231,1},{  8,165,0},{ 90,  0,0}}},  {{/*1*/{ 57, 49,4},{ 24,231,0},{ 74,  0,0},{  8,115,0}}},  {{/*2*/{ 57, 49,3},{ 24,231,1},{ 24,132,0},{  8,115,1}}},  {{/*1*/{ 57, 49,2},{ 24,247,0},{  8,181,1},{ 24, 99,0}}},
-  {{/*1*/{ 57, 49,1},{ 41,148,0},{  8,181,0},{ 74, 33,0}}},  {{/*2*/{ 57, 49,0},{ 41,148,1},{ 41, 99,0},{ 41, 82,1}}},  {{/*1*/{ 57, 49,1},{ 41,165,0},{ 24,148,0},{ 41, 82,0}}},  {{/*2*/{ 57, 49,2},{ 41,165,1},{ 57, 66,0},{  8,132,1}}},
-  {{/*1*/{ 57, 49,3},{ 41,181,0},{  8,198,1},{  8,132,0}}},  {{/*2*/{ 57, 49,4},{ 41,181,1},{  8,198,0},{107,  0,0}}},  {{/*1*/{ 57, 49,5},{ 57, 99,0},{ 74, 33,0},{ 24,115,0}}},  {{/*1*/{ 57, 49,6},{ 41,198,0},{ 24,165,0},{ 74, 49,0}}},
-  {{/*2*/{ 57, 49,7},{ 41,198,1},{ 57, 82,0},{ 41, 99,1}}},  {{/*1*/{ 57, 49,8},{ 41,214,0},{  8,214,0},{ 41, 99,0}}},  {{/*2*/{ 74, 66,8},{ 41,214,1},{ 41,132,0},{  8,148,1}}},  {{/*1*/{ 74, 66,7},{ 41,231,0},{ 24,181,1},{  8,148,0}}},
-  {{/*1*/{ 74, 66,6},{ 74, 33,0},{ 24,181,0},{107, 16,0}}},  {{/*1*/{ 74, 66,5},{ 41,247,0},{ 90, 16,0},{ 24,132,0}}},  {{/*1*/{ 74, 66,4},{ 74, 49,0},{  8,231,0},{ 74, 66,0}}},  {{/*2*/{ 74, 66,3},{ 57,165,1},{ 41,148,0},{123,  0,0}}},
-  {{/*1*/{ 74, 66,2},{ 57,165,0},{ 24,198,0},{ 41,115,0}}},  {{/*2*/{ 74, 66,1},{ 57,165,1},{ 57,115,0},{  8,165,1}}},  {{/*1*/{ 74, 66,0},{ 57,181,0},{  8,247,1},{  8,165,0}}},  {{/*1*/{ 74, 66,1},{ 74, 82,0},{  8,247,0},{107, 33,0}}},
-  {{/*1*/{ 74, 66,2},{ 57,198,0},{ 74, 82,0},{ 24,148,0}}},  {{/*1*/{ 74, 66,3},{ 74, 99,0},{ 24,214,0},{ 74, 82,0}}},  {{/*2*/{ 74, 66,4},{ 57,214,1},{ 57,132,0},{ 41,132,1}}},  {{/*1*/{ 74, 66,5},{ 57,214,0},{ 41,181,1},{ 41,132,0}}},
-  {{/*2*/{ 74, 66,6},{ 57,214,1},{ 41,181,0},{  8,181,0}}},  {{/*1*/{ 74, 66,7},{ 57,231,0},{ 74, 99,0},{ 57,115,0}}},  {{/*1*/{ 74, 66,8},{ 74,132,0},{ 24,231,0},{107, 49,0}}},  {{/*1*/{ 90, 82,7},{ 57,247,0},{ 90, 66,0},{ 24,165,0}}},
-  {{/*1*/{ 90, 82,6},{ 74,148,0},{ 41,198,1},{ 74, 99,0}}},  {{/*2*/{ 90, 82,5},{ 74,148,1},{ 41,198,0},{123, 33,0}}},  {{/*1*/{ 90, 82,4},{ 74,165,0},{ 24,247,0},{ 41,148,0}}},  {{/*2*/{ 90, 82,3},{ 74,165,1},{ 57,165,0},{140, 16,0}}},
-  {{/*1*/{ 90, 82,2},{ 90, 82,0},{123,  0,0},{  8,198,0}}},  {{/*1*/{ 90, 82,1},{ 74,181,0},{ 41,214,0},{107, 66,0}}},  {{/*2*/{ 90, 82,0},{ 74,181,1},{ 74,132,0},{ 24,181,0}}},  {{/*1*/{ 90, 82,1},{ 74,198,0},{ 57,181,0},{ 74,115,0}}},
-  {{/*2*/{ 90, 82,2},{ 74,198,1},{ 90, 99,0},{ 41,165,1}}},  {{/*1*/{ 90, 82,3},{ 74,214,0},{ 41,231,1},{ 41,165,0}}},  {{/*1*/{ 90, 82,4},{107, 16,0},{ 41,231,0},{  8,214,0}}},  {{/*1*/{ 90, 82,5},{ 90,132,0},{107, 66,0},{ 57,148,0}}},
-  {{/*1*/{ 90, 82,6},{ 74,231,0},{ 57,198,0},{107, 82,0}}},  {{/*2*/{ 90, 82,7},{ 74,231,1},{ 90,115,0},{ 24,198,0}}},  {{/*1*/{ 90, 82,8},{ 74,247,0},{ 41,247,0},{ 74,132,0}}},  {{/*2*/{107, 99,8},{ 74,247,1},{ 74,165,0},{ 41,181,1}}},
-  {{/*1*/{107, 99,7},{ 90,165,0},{140,  0,0},{ 41,181,0}}},  {{/*1*/{107, 99,6},{107, 66,0},{ 57,214,0},{140, 49,0}}},  {{/*1*/{107, 99,5},{ 90,181,0},{123, 49,0},{  8,231,0}}},  {{/*1*/{107, 99,4},{107, 82,0},{ 74,181,1},{107, 99,0}}},
-  {{/*2*/{107, 99,3},{ 90,198,1},{ 74,181,0},{ 24,214,0}}},  {{/*1*/{107, 99,2},{ 90,198,0},{ 57,231,0},{ 74,148,0}}},  {{/*2*/{107, 99,1},{ 90,198,1},{ 90,148,0},{173, 16,0}}},  {{/*1*/{107, 99,0},{ 90,214,0},{ 74,198,1},{ 41,198,0}}},
-  {{/*1*/{107, 99,1},{107,115,0},{ 74,198,0},{  8,247,0}}},  {{/*1*/{107, 99,2},{ 90,231,0},{107,115,0},{ 57,181,0}}},  {{/*1*/{107, 99,3},{107,132,0},{ 57,247,0},{107,115,0}}},  {{/*2*/{107, 99,4},{ 90,247,1},{ 90,165,0},{ 24,231,0}}},
-  {{/*1*/{107, 99,5},{ 90,247,0},{156,  0,0},{ 74,165,0}}},  {{/*2*/{107, 99,6},{ 90,247,1},{ 74,214,0},{ 41,214,0}}},  {{/*1*/{107, 99,7},{123, 66,0},{107,132,0},{ 90,148,0}}},  {{/*1*/{107, 99,8},{107,165,0},{ 90,181,0},{140, 82,0}}},
-  {{/*2*/{123,115,7},{107,165,1},{123, 99,0},{ 57,198,0}}},  {{/*1*/{123,115,6},{107,181,0},{ 74,231,1},{107,132,0}}},  {{/*2*/{123,115,5},{107,181,1},{ 74,231,0},{ 24,247,0}}},  {{/*1*/{123,115,4},{107,198,0},{140, 66,0},{ 74,181,0}}},
-  {{/*1*/{123,115,3},{140,  0,0},{ 90,198,0},{173, 49,0}}},  {{/*1*/{123,115,2},{123,115,0},{156, 33,0},{ 41,231,0}}},  {{/*1*/{123,115,1},{107,214,0},{ 74,247,0},{140, 99,0}}},  {{/*2*/{123,115,0},{107,214,1},{107,165,0},{ 57,214,0}}},
-  {{/*1*/{123,115,1},{107,231,0},{ 90,214,0},{107,148,0}}},  {{/*2*/{123,115,2},{107,231,1},{123,132,0},{206, 16,0}}},  {{/*1*/{123,115,3},{107,247,0},{107,181,1},{ 74,198,0}}},  {{/*1*/{123,115,4},{140, 49,0},{107,181,0},{ 41,247,0}}},
-  {{/*1*/{123,115,5},{123,165,0},{140, 99,0},{ 90,181,0}}},  {{/*1*/{123,115,6},{140, 66,0},{ 90,231,0},{140,115,0}}},  {{/*2*/{123,115,7},{123,181,1},{123,148,0},{ 57,231,0}}},  {{/*1*/{123,115,8},{123,181,0},{107,198,1},{107,165,0}}},
-  {{/*2*/{140,132,8},{123,181,1},{107,198,0},{ 74,214,1}}},  {{/*1*/{140,132,7},{123,198,0},{173, 33,0},{ 74,214,0}}},  {{/*1*/{140,132,6},{140, 99,0},{ 90,247,0},{173, 82,0}}},  {{/*1*/{140,132,5},{123,214,0},{156, 82,0},{ 90,198,0}}},
-  {{/*1*/{140,132,4},{140,115,0},{107,214,1},{140,132,0}}},  {{/*2*/{140,132,3},{123,231,1},{107,214,0},{ 57,247,0}}},  {{/*1*/{140,132,2},{123,231,0},{173, 49,0},{107,181,0}}},  {{/*2*/{140,132,1},{123,231,1},{123,181,0},{206, 49,0}}},
-  {{/*1*/{140,132,0},{123,247,0},{189, 16,0},{ 74,231,0}}},  {{/*1*/{140,132,1},{140,148,0},{107,231,0},{173, 99,0}}},  {{/*2*/{140,132,2},{140,148,1},{140,148,0},{ 90,214,0}}},  {{/*1*/{140,132,3},{140,165,0},{123,198,1},{140,148,0}}},
-  {{/*2*/{140,132,4},{140,165,1},{123,198,0},{239, 16,0}}},  {{/*1*/{140,132,5},{140,181,0},{189, 33,0},{107,198,0}}},  {{/*2*/{140,132,6},{140,181,1},{107,247,0},{ 74,247,0}}},  {{/*1*/{140,132,7},{156, 99,0},{140,165,0},{123,181,0}}},
-  {{/*1*/{140,132,8},{140,198,0},{123,214,0},{173,115,0}}},  {{/*2*/{156,148,7},{140,198,1},{156,132,0},{ 90,231,0}}},  {{/*1*/{156,148,6},{140,214,0},{140,181,1},{140,165,0}}},  {{/*2*/{156,148,5},{140,214,1},{140,181,0},{189, 99,0}}},
-  {{/*1*/{156,148,4},{140,231,0},{173, 99,0},{107,214,0}}},  {{/*1*/{156,148,3},{173, 33,0},{123,231,0},{206, 82,0}}},  {{/*1*/{156,148,2},{156,148,0},{189, 66,0},{123,198,0}}},  {{/*1*/{156,148,1},{140,247,0},{140,198,1},{173,132,0}}},
-  {{/*2*/{156,148,0},{140,247,1},{140,198,0},{ 90,247,0}}},  {{/*1*/{156,148,1},{156,165,0},{123,247,0},{140,181,0}}},  {{/*2*/{156,148,2},{156,165,1},{156,165,0},{239, 49,0}}},  {{/*1*/{156,148,3},{156,181,0},{222,  0,0},{107,231,0}}},
-  {{/*1*/{156,148,4},{173, 82,0},{140,214,0},{206, 99,0}}},  {{/*1*/{156,148,5},{156,198,0},{173,132,0},{123,214,0}}},  {{/*1*/{156,148,6},{173, 99,0},{156,181,1},{173,148,0}}},  {{/*2*/{156,148,7},{156,214,1},{156,181,0},{140,198,1}}},
-  {{/*1*/{156,148,8},{156,214,0},{222, 16,0},{140,198,0}}},  {{/*2*/{173,165,8},{156,214,1},{140,231,0},{107,247,1}}},  {{/*1*/{173,165,7},{156,231,0},{206, 66,0},{107,247,0}}},  {{/*1*/{173,165,6},{173,132,0},{156,198,0},{206,115,0}}},
-  {{/*1*/{173,165,5},{156,247,0},{189,115,0},{123,231,0}}},  {{/*1*/{173,165,4},{173,148,0},{140,247,1},{173,165,0}}},  {{/*2*/{173,165,3},{173,165,1},{140,247,0},{222, 99,0}}},  {{/*1*/{173,165,2},{173,165,0},{206, 82,0},{140,214,0}}},
-  {{/*2*/{173,165,1},{173,165,1},{156,214,0},{239, 82,0}}},  {{/*1*/{173,165,0},{189, 82,0},{222, 49,0},{156,198,0}}},  {{/*1*/{173,165,1},{173,181,0},{173,181,1},{206,132,0}}},  {{/*2*/{173,165,2},{173,181,1},{173,181,0},{123,247,0}}},
-  {{/*1*/{173,165,3},{173,198,0},{239, 16,0},{173,181,0}}},  {{/*1*/{173,165,4},{206,  0,0},{156,231,0},{140,231,1}}},  {{/*1*/{173,165,5},{173,214,0},{222, 66,0},{140,231,0}}},  {{/*1*/{173,165,6},{206, 16,0},{173,198,1},{239, 99,0}}},
-  {{/*1*/{173,165,7},{189,132,0},{173,198,0},{156,214,0}}},  {{/*1*/{173,165,8},{173,231,0},{156,247,0},{206,148,0}}},  {{/*2*/{189,181,7},{173,231,1},{189,165,0},{255, 82,0}}},  {{/*1*/{189,181,6},{173,247,0},{255,  0,0},{173,198,0}}},
-  {{/*2*/{189,181,5},{173,247,1},{173,214,0},{222,132,0}}},  {{/*1*/{189,181,4},{189,165,0},{206,132,0},{140,247,0}}},  {{/*1*/{189,181,3},{206, 66,0},{189,181,0},{239,115,0}}},  {{/*1*/{189,181,2},{189,181,0},{222, 99,0},{156,231,0}}},
-  {{/*1*/{189,181,1},{206, 82,0},{173,231,1},{206,165,0}}},  {{/*2*/{189,181,0},{189,198,1},{173,231,0},{255, 99,0}}},  {{/*1*/{189,181,1},{189,198,0},{239, 66,0},{173,214,0}}},  {{/*2*/{189,181,2},{189,198,1},{189,198,0},{173,214,1}}},
-  {{/*1*/{189,181,3},{189,214,0},{255, 33,0},{189,198,0}}},  {{/*1*/{189,181,4},{206,115,0},{173,247,0},{239,132,0}}},  {{/*1*/{189,181,5},{189,231,0},{206,165,0},{156,247,0}}},  {{/*1*/{189,181,6},{206,132,0},{189,214,1},{206,181,0}}},
-  {{/*2*/{189,181,7},{189,247,1},{189,214,0},{173,231,1}}},  {{/*1*/{189,181,8},{189,247,0},{255, 49,0},{173,231,0}}},  {{/*2*/{206,198,8},{189,247,1},{206,181,0},{173,231,1}}},  {{/*2*/{206,198,7},{206,165,1},{239, 99,0},{189,214,0}}},
-  {{/*1*/{206,198,6},{206,165,0},{189,231,0},{239,148,0}}},  {{/*2*/{206,198,5},{206,181,1},{222,148,0},{206,198,1}}},  {{/*1*/{206,198,4},{206,181,0},{206,198,1},{206,198,0}}},  {{/*2*/{206,198,3},{206,198,1},{206,198,0},{255,132,0}}},
-  {{/*1*/{206,198,2},{206,198,0},{239,115,0},{173,247,0}}},  {{/*1*/{206,198,1},{239,  0,0},{189,247,0},{173,247,1}}},  {{/*1*/{206,198,0},{222,115,0},{255, 82,0},{189,231,0}}},  {{/*1*/{206,198,1},{206,214,0},{206,214,1},{239,165,0}}},
-  {{/*2*/{206,198,2},{206,214,1},{206,214,0},{206,214,1}}},  {{/*1*/{206,198,3},{206,231,0},{206,214,1},{206,214,0}}},  {{/*1*/{206,198,4},{239, 33,0},{222,181,0},{206,214,1}}},  {{/*1*/{206,198,5},{206,247,0},{255, 99,0},{222,198,0}}},
-  {{/*1*/{206,198,6},{239, 49,0},{206,231,1},{189,247,1}}},  {{/*1*/{206,198,7},{222,165,0},{206,231,0},{189,247,0}}},  {{/*1*/{206,198,8},{239, 66,0},{206,231,1},{239,181,0}}},  {{/*2*/{222,214,7},{222,181,1},{222,198,0},{206,231,1}}},
-  {{/*1*/{222,214,6},{222,181,0},{206,247,1},{206,231,0}}},  {{/*2*/{222,214,5},{222,198,1},{206,247,0},{255,165,0}}},  {{/*1*/{222,214,4},{222,198,0},{239,165,0},{222,214,0}}},  {{/*1*/{222,214,3},{239, 99,0},{222,214,0},{222,214,1}}},
-  {{/*1*/{222,214,2},{222,214,0},{255,132,0},{239,198,1}}},  {{/*1*/{222,214,1},{239,115,0},{239,181,1},{239,198,0}}},  {{/*2*/{222,214,0},{222,231,1},{239,181,0},{206,247,1}}},  {{/*1*/{222,214,1},{222,231,0},{222,231,1},{206,247,0}}},
-  {{/*2*/{222,214,2},{222,231,1},{222,231,0},{206,247,1}}},  {{/*1*/{222,214,3},{222,247,0},{222,231,1},{222,231,0}}},  {{/*1*/{222,214,4},{239,148,0},{239,198,1},{222,231,1}}},  {{/*2*/{222,214,5},{239,165,1},{239,198,0},{239,214,1}}},
-  {{/*1*/{222,214,6},{239,165,0},{222,247,1},{239,214,0}}},  {{/*2*/{222,214,7},{239,181,1},{222,247,0},{239,214,1}}},  {{/*1*/{222,214,8},{239,181,0},{222,247,1},{255,198,0}}},  {{/*2*/{239,231,8},{239,181,1},{239,214,0},{222,247,1}}},
-  {{/*3*/{239,231,7},{239,198,1},{239,214,1},{222,247,0}}},  {{/*1*/{239,231,6},{239,198,0},{255,181,1},{222,247,1}}},  {{/*2*/{239,231,5},{239,214,1},{255,181,0},{239,231,1}}},  {{/*1*/{239,231,4},{239,214,0},{239,231,1},{239,231,0}}},
-  {{/*2*/{239,231,3},{239,231,1},{239,231,0},{239,231,1}}},  {{/*1*/{239,231,2},{239,231,0},{239,231,1},{255,214,0}}},  {{/*2*/{239,231,1},{239,231,1},{255,198,0},{255,214,1}}},  {{/*1*/{239,231,0},{255,148,0},{255,198,1},{255,214,2}}},
-  {{/*1*/{239,231,1},{239,247,0},{239,247,1},{239,247,2}}},  {{/*2*/{239,231,2},{239,247,1},{239,247,0},{239,247,1}}},  {{/*1*/{239,231,3},{255,165,0},{239,247,1},{239,247,0}}},  {{/*2*/{239,231,4},{255,181,1},{255,214,0},{239,247,1}}},
-  {{/*1*/{239,231,5},{255,181,0},{255,214,1},{255,231,0}}},  {{/*1*/{239,231,6},{255,198,1},{255,214,2},{255,231,1}}},  {{/*1*/{239,231,7},{255,198,0},{255,231,2},{255,231,2}}},  {{/*1*/{239,231,8},{255,198,1},{255,231,1},{255,231,3}}},
-  {{/*2*/{255,247,7},{255,214,1},{255,231,0},{255,247,3}}},  {{/*1*/{255,247,6},{255,214,0},{255,231,1},{255,247,2}}},  {{/*1*/{255,247,5},{255,231,1},{255,247,2},{255,247,1}}},  {{/*1*/{255,247,4},{255,231,0},{255,247,1},{255,247,0}}},
-  {{/*2*/{255,247,3},{255,247,1},{255,247,0},{255,247,1}}},  {{/*1*/{255,247,2},{255,247,0},{255,247,1},{255,247,2}}},  {{/*1*/{255,247,1},{255,247,1},{255,247,2},{255,247,3}}},  {{/*0*/{255,247,0},{255,247,2},{255,247,3},{255,247,4}}}
+  {/*3*/{  8,  8,  8,  8},{  0,  0,  0,  0},{8,6,5,4}},  {/*3*/{  8,  8,  8,  8},{  0,  0,  0,  0},{7,5,4,3}},  {/*3*/{  8,  8,  8,  8},{  0,  0,  0,  0},{6,4,3,2}},  {/*3*/{  8,  8,  8,  8},{  0,  0,  0,  0},{5,3,2,1}},
+  {/*3*/{  8,  8,  8,  8},{  0,  0,  0,  0},{4,2,1,0}},  {/*2*/{  8,  8,  8,  8},{  0,  0,  0,  0},{3,1,0,1}},  {/*1*/{  8,  8,  8,  8},{  0,  0,  0,  0},{2,0,1,2}},  {/*1*/{  8,  8,  8,  8},{  0,  0,  0,  0},{1,1,2,3}},
+  {/*0*/{  8,  8,  8,  8},{  0, 16, 16, 16},{0,1,2,3}},  {/*1*/{  8,  8,  8,  8},{  0, 16, 16, 16},{1,0,1,2}},  {/*2*/{  8,  8,  8,  8},{  0, 16, 16, 16},{2,1,0,1}},  {/*1*/{  8,  8,  8,  8},{  0, 33, 16, 16},{3,0,1,0}},
+  {/*1*/{  8,  8,  8,  8},{  0, 33, 16, 16},{4,1,2,1}},  {/*1*/{  8,  8,  8, 24},{  0, 49, 33,  0},{5,0,2,0}},  {/*1*/{  8,  8,  8, 24},{  0, 49, 33,  0},{6,1,1,1}},  {/*2*/{  8,  8,  8, 24},{  0, 66, 33,  0},{7,1,0,2}},
+  {/*1*/{  8,  8,  8,  8},{  0, 66, 33, 33},{8,0,1,2}},  {/*2*/{ 24,  8, 24,  8},{ 16, 66,  0, 33},{7,1,0,1}},  {/*1*/{ 24,  8,  8,  8},{ 16, 82, 49, 33},{6,0,1,0}},  {/*2*/{ 24,  8,  8,  8},{ 16, 82, 49, 33},{5,1,0,1}},
+  {/*1*/{ 24,  8,  8, 24},{ 16, 99, 49, 16},{4,0,1,0}},  {/*2*/{ 24,  8, 24, 24},{ 16, 99, 16, 16},{3,1,0,1}},  {/*1*/{ 24, 24, 24, 41},{ 16, 16, 16,  0},{2,0,1,1}},  {/*1*/{ 24,  8,  8, 41},{ 16,115, 66,  0},{1,0,1,0}},
+  {/*2*/{ 24,  8,  8,  8},{ 16,115, 66, 49},{0,1,0,1}},  {/*1*/{ 24,  8,  8,  8},{ 16,132, 66, 49},{1,0,1,0}},  {/*2*/{ 24,  8, 24,  8},{ 16,132, 33, 49},{2,1,0,1}},  {/*1*/{ 24,  8,  8, 24},{ 16,148, 82, 33},{3,0,1,0}},
+  {/*2*/{ 24,  8,  8, 24},{ 16,148, 82, 33},{4,1,0,1}},  {/*1*/{ 24, 24, 41, 41},{ 16, 66,  0, 16},{5,0,0,1}},  {/*1*/{ 24,  8, 24, 41},{ 16,165, 49, 16},{6,0,1,0}},  {/*2*/{ 24,  8, 24,  8},{ 16,165, 49, 66},{7,1,0,1}},
+  {/*1*/{ 24,  8,  8,  8},{ 16,181, 99, 66},{8,0,1,0}},  {/*2*/{ 41,  8,  8,  8},{ 33,181, 99, 66},{8,1,0,1}},  {/*1*/{ 41,  8,  8, 24},{ 33,198, 99, 49},{7,0,1,0}},  {/*1*/{ 41, 41, 24, 24},{ 33,  0, 66, 49},{6,0,0,1}},
+  {/*1*/{ 41,  8, 24, 41},{ 33,214, 66, 33},{5,0,1,1}},  {/*1*/{ 41, 41,  8, 41},{ 33, 16,115, 33},{4,0,1,0}},  {/*2*/{ 41,  8,  8,  8},{ 33,231,115, 82},{3,1,0,1}},  {/*1*/{ 41,  8,  8,  8},{ 33,231,115, 82},{2,0,1,0}},
+  {/*2*/{ 41,  8, 24,  8},{ 33,231, 82, 82},{1,1,0,1}},  {/*1*/{ 41,  8,  8, 24},{ 33,247,132, 66},{0,0,1,0}},  {/*1*/{ 41, 41,  8, 74},{ 33, 49,132,  0},{1,0,0,0}},  {/*1*/{ 41, 24, 41, 41},{ 33,165, 49, 49},{2,0,0,1}},
+  {/*1*/{ 41, 41, 24, 41},{ 33, 66, 99, 49},{3,0,1,0}},  {/*2*/{ 41, 24, 24,  8},{ 33,181, 99, 99},{4,1,0,1}},  {/*1*/{ 41, 24,  8,  8},{ 33,181,148, 99},{5,0,1,0}},  {/*2*/{ 41, 24,  8,  8},{ 33,181,148, 99},{6,1,0,1}},
+  {/*1*/{ 41, 24, 41, 24},{ 33,198, 66, 82},{7,0,0,0}},  {/*1*/{ 41, 41, 24, 74},{ 33, 99,115, 16},{8,0,0,0}},  {/*1*/{ 57, 24, 57, 41},{ 49,214, 33, 66},{7,0,0,1}},  {/*1*/{ 57, 41,  8, 41},{ 49,115,165, 66},{6,0,1,0}},
+  {/*2*/{ 57, 24,  8, 90},{ 49,231,165,  0},{5,1,0,0}},  {/*1*/{ 57, 24, 74,  8},{ 49,231,  0,115},{4,0,0,0}},  {/*2*/{ 57, 24, 24,  8},{ 49,231,132,115},{3,1,0,1}},  {/*1*/{ 57, 24,  8, 24},{ 49,247,181, 99},{2,0,1,0}},
+  {/*1*/{ 57, 41,  8, 74},{ 49,148,181, 33},{1,0,0,0}},  {/*2*/{ 57, 41, 41, 41},{ 49,148, 99, 82},{0,1,0,1}},  {/*1*/{ 57, 41, 24, 41},{ 49,165,148, 82},{1,0,0,0}},  {/*2*/{ 57, 41, 57,  8},{ 49,165, 66,132},{2,1,0,1}},
+  {/*1*/{ 57, 41,  8,  8},{ 49,181,198,132},{3,0,1,0}},  {/*2*/{ 57, 41,  8,107},{ 49,181,198,  0},{4,1,0,0}},  {/*1*/{ 57, 57, 74, 24},{ 49, 99, 33,115},{5,0,0,0}},  {/*1*/{ 57, 41, 24, 74},{ 49,198,165, 49},{6,0,0,0}},
+  {/*2*/{ 57, 41, 57, 41},{ 49,198, 82, 99},{7,1,0,1}},  {/*1*/{ 57, 41,  8, 41},{ 49,214,214, 99},{8,0,0,0}},  {/*2*/{ 74, 41, 41,  8},{ 66,214,132,148},{8,1,0,1}},  {/*1*/{ 74, 41, 24,  8},{ 66,231,181,148},{7,0,1,0}},
+  {/*1*/{ 74, 74, 24,107},{ 66, 33,181, 16},{6,0,0,0}},  {/*1*/{ 74, 41, 90, 24},{ 66,247, 16,132},{5,0,0,0}},  {/*1*/{ 74, 74,  8, 74},{ 66, 49,231, 66},{4,0,0,0}},  {/*2*/{ 74, 57, 41,123},{ 66,165,148,  0},{3,1,0,0}},
+  {/*1*/{ 74, 57, 24, 41},{ 66,165,198,115},{2,0,0,0}},  {/*2*/{ 74, 57, 57,  8},{ 66,165,115,165},{1,1,0,1}},  {/*1*/{ 74, 57,  8,  8},{ 66,181,247,165},{0,0,1,0}},  {/*1*/{ 74, 74,  8,107},{ 66, 82,247, 33},{1,0,0,0}},
+  {/*1*/{ 74, 57, 74, 24},{ 66,198, 82,148},{2,0,0,0}},  {/*1*/{ 74, 74, 24, 74},{ 66, 99,214, 82},{3,0,0,0}},  {/*2*/{ 74, 57, 57, 41},{ 66,214,132,132},{4,1,0,1}},  {/*1*/{ 74, 57, 41, 41},{ 66,214,181,132},{5,0,1,0}},
+  {/*2*/{ 74, 57, 41,  8},{ 66,214,181,181},{6,1,0,0}},  {/*1*/{ 74, 57, 74, 57},{ 66,231, 99,115},{7,0,0,0}},  {/*1*/{ 74, 74, 24,107},{ 66,132,231, 49},{8,0,0,0}},  {/*1*/{ 90, 57, 90, 24},{ 82,247, 66,165},{7,0,0,0}},
+  {/*1*/{ 90, 74, 41, 74},{ 82,148,198, 99},{6,0,1,0}},  {/*2*/{ 90, 74, 41,123},{ 82,148,198, 33},{5,1,0,0}},  {/*1*/{ 90, 74, 24, 41},{ 82,165,247,148},{4,0,0,0}},  {/*2*/{ 90, 74, 57,140},{ 82,165,165, 16},{3,1,0,0}},
+  {/*1*/{ 90, 90,123,  8},{ 82, 82,  0,198},{2,0,0,0}},  {/*1*/{ 90, 74, 41,107},{ 82,181,214, 66},{1,0,0,0}},  {/*2*/{ 90, 74, 74, 24},{ 82,181,132,181},{0,1,0,0}},  {/*1*/{ 90, 74, 57, 74},{ 82,198,181,115},{1,0,0,0}},
+  {/*2*/{ 90, 74, 90, 41},{ 82,198, 99,165},{2,1,0,1}},  {/*1*/{ 90, 74, 41, 41},{ 82,214,231,165},{3,0,1,0}},  {/*1*/{ 90,107, 41,  8},{ 82, 16,231,214},{4,0,0,0}},  {/*1*/{ 90, 90,107, 57},{ 82,132, 66,148},{5,0,0,0}},
+  {/*1*/{ 90, 74, 57,107},{ 82,231,198, 82},{6,0,0,0}},  {/*2*/{ 90, 74, 90, 24},{ 82,231,115,198},{7,1,0,0}},  {/*1*/{ 90, 74, 41, 74},{ 82,247,247,132},{8,0,0,0}},  {/*2*/{107, 74, 74, 41},{ 99,247,165,181},{8,1,0,1}},
+  {/*1*/{107, 90,140, 41},{ 99,165,  0,181},{7,0,0,0}},  {/*1*/{107,107, 57,140},{ 99, 66,214, 49},{6,0,0,0}},  {/*1*/{107, 90,123,  8},{ 99,181, 49,231},{5,0,0,0}},  {/*1*/{107,107, 74,107},{ 99, 82,181, 99},{4,0,1,0}},
+  {/*2*/{107, 90, 74, 24},{ 99,198,181,214},{3,1,0,0}},  {/*1*/{107, 90, 57, 74},{ 99,198,231,148},{2,0,0,0}},  {/*2*/{107, 90, 90,173},{ 99,198,148, 16},{1,1,0,0}},  {/*1*/{107, 90, 74, 41},{ 99,214,198,198},{0,0,1,0}},
+  {/*1*/{107,107, 74,  8},{ 99,115,198,247},{1,0,0,0}},  {/*1*/{107, 90,107, 57},{ 99,231,115,181},{2,0,0,0}},  {/*1*/{107,107, 57,107},{ 99,132,247,115},{3,0,0,0}},  {/*2*/{107, 90, 90, 24},{ 99,247,165,231},{4,1,0,0}},
+  {/*1*/{107, 90,156, 74},{ 99,247,  0,165},{5,0,0,0}},  {/*2*/{107, 90, 74, 41},{ 99,247,214,214},{6,1,0,0}},  {/*1*/{107,123,107, 90},{ 99, 66,132,148},{7,0,0,0}},  {/*1*/{107,107, 90,140},{ 99,165,181, 82},{8,0,0,0}},
+  {/*2*/{123,107,123, 57},{115,165, 99,198},{7,1,0,0}},  {/*1*/{123,107, 74,107},{115,181,231,132},{6,0,1,0}},  {/*2*/{123,107, 74, 24},{115,181,231,247},{5,1,0,0}},  {/*1*/{123,107,140, 74},{115,198, 66,181},{4,0,0,0}},
+  {/*1*/{123,140, 90,173},{115,  0,198, 49},{3,0,0,0}},  {/*1*/{123,123,156, 41},{115,115, 33,231},{2,0,0,0}},  {/*1*/{123,107, 74,140},{115,214,247, 99},{1,0,0,0}},  {/*2*/{123,107,107, 57},{115,214,165,214},{0,1,0,0}},
+  {/*1*/{123,107, 90,107},{115,231,214,148},{1,0,0,0}},  {/*2*/{123,107,123,206},{115,231,132, 16},{2,1,0,0}},  {/*1*/{123,107,107, 74},{115,247,181,198},{3,0,1,0}},  {/*1*/{123,140,107, 41},{115, 49,181,247},{4,0,0,0}},
+  {/*1*/{123,123,140, 90},{115,165, 99,181},{5,0,0,0}},  {/*1*/{123,140, 90,140},{115, 66,231,115},{6,0,0,0}},  {/*2*/{123,123,123, 57},{115,181,148,231},{7,1,0,0}},  {/*1*/{123,123,107,107},{115,181,198,165},{8,0,1,0}},
+  {/*2*/{140,123,107, 74},{132,181,198,214},{8,1,0,1}},  {/*1*/{140,123,173, 74},{132,198, 33,214},{7,0,0,0}},  {/*1*/{140,140, 90,173},{132, 99,247, 82},{6,0,0,0}},  {/*1*/{140,123,156, 90},{132,214, 82,198},{5,0,0,0}},
+  {/*1*/{140,140,107,140},{132,115,214,132},{4,0,1,0}},  {/*2*/{140,123,107, 57},{132,231,214,247},{3,1,0,0}},  {/*1*/{140,123,173,107},{132,231, 49,181},{2,0,0,0}},  {/*2*/{140,123,123,206},{132,231,181, 49},{1,1,0,0}},
+  {/*1*/{140,123,189, 74},{132,247, 16,231},{0,0,0,0}},  {/*1*/{140,140,107,173},{132,148,231, 99},{1,0,0,0}},  {/*2*/{140,140,140, 90},{132,148,148,214},{2,1,0,0}},  {/*1*/{140,140,123,140},{132,165,198,148},{3,0,1,0}},
+  {/*2*/{140,140,123,239},{132,165,198, 16},{4,1,0,0}},  {/*1*/{140,140,189,107},{132,181, 33,198},{5,0,0,0}},  {/*2*/{140,140,107, 74},{132,181,247,247},{6,1,0,0}},  {/*1*/{140,156,140,123},{132, 99,165,181},{7,0,0,0}},
+  {/*1*/{140,140,123,173},{132,198,214,115},{8,0,0,0}},  {/*2*/{156,140,156, 90},{148,198,132,231},{7,1,0,0}},  {/*1*/{156,140,140,140},{148,214,181,165},{6,0,1,0}},  {/*2*/{156,140,140,189},{148,214,181, 99},{5,1,0,0}},
+  {/*1*/{156,140,173,107},{148,231, 99,214},{4,0,0,0}},  {/*1*/{156,173,123,206},{148, 33,231, 82},{3,0,0,0}},  {/*1*/{156,156,189,123},{148,148, 66,198},{2,0,0,0}},  {/*1*/{156,140,140,173},{148,247,198,132},{1,0,1,0}},
+  {/*2*/{156,140,140, 90},{148,247,198,247},{0,1,0,0}},  {/*1*/{156,156,123,140},{148,165,247,181},{1,0,0,0}},  {/*2*/{156,156,156,239},{148,165,165, 49},{2,1,0,0}},  {/*1*/{156,156,222,107},{148,181,  0,231},{3,0,0,0}},
+  {/*1*/{156,173,140,206},{148, 82,214, 99},{4,0,0,0}},  {/*1*/{156,156,173,123},{148,198,132,214},{5,0,0,0}},  {/*1*/{156,173,156,173},{148, 99,181,148},{6,0,1,0}},  {/*2*/{156,156,156,140},{148,214,181,198},{7,1,0,1}},
+  {/*1*/{156,156,222,140},{148,214, 16,198},{8,0,0,0}},  {/*2*/{173,156,140,107},{165,214,231,247},{8,1,0,1}},  {/*1*/{173,156,206,107},{165,231, 66,247},{7,0,0,0}},  {/*1*/{173,173,156,206},{165,132,198,115},{6,0,0,0}},
+  {/*1*/{173,156,189,123},{165,247,115,231},{5,0,0,0}},  {/*1*/{173,173,140,173},{165,148,247,165},{4,0,1,0}},  {/*2*/{173,173,140,222},{165,165,247, 99},{3,1,0,0}},  {/*1*/{173,173,206,140},{165,165, 82,214},{2,0,0,0}},
+  {/*2*/{173,173,156,239},{165,165,214, 82},{1,1,0,0}},  {/*1*/{173,189,222,156},{165, 82, 49,198},{0,0,0,0}},  {/*1*/{173,173,173,206},{165,181,181,132},{1,0,1,0}},  {/*2*/{173,173,173,123},{165,181,181,247},{2,1,0,0}},
+  {/*1*/{173,173,239,173},{165,198, 16,181},{3,0,0,0}},  {/*1*/{173,206,156,140},{165,  0,231,231},{4,0,0,1}},  {/*1*/{173,173,222,140},{165,214, 66,231},{5,0,0,0}},  {/*1*/{173,206,173,239},{165, 16,198, 99},{6,0,1,0}},
+  {/*1*/{173,189,173,156},{165,132,198,214},{7,0,0,0}},  {/*1*/{173,173,156,206},{165,231,247,148},{8,0,0,0}},  {/*2*/{189,173,189,255},{181,231,165, 82},{7,1,0,0}},  {/*1*/{189,173,255,173},{181,247,  0,198},{6,0,0,0}},
+  {/*2*/{189,173,173,222},{181,247,214,132},{5,1,0,0}},  {/*1*/{189,189,206,140},{181,165,132,247},{4,0,0,0}},  {/*1*/{189,206,189,239},{181, 66,181,115},{3,0,0,0}},  {/*1*/{189,189,222,156},{181,181, 99,231},{2,0,0,0}},
+  {/*1*/{189,206,173,206},{181, 82,231,165},{1,0,1,0}},  {/*2*/{189,189,173,255},{181,198,231, 99},{0,1,0,0}},  {/*1*/{189,189,239,173},{181,198, 66,214},{1,0,0,0}},  {/*2*/{189,189,189,173},{181,198,198,214},{2,1,0,1}},
+  {/*1*/{189,189,255,189},{181,214, 33,198},{3,0,0,0}},  {/*1*/{189,206,173,239},{181,115,247,132},{4,0,0,0}},  {/*1*/{189,189,206,156},{181,231,165,247},{5,0,0,0}},  {/*1*/{189,206,189,206},{181,132,214,181},{6,0,1,0}},
+  {/*2*/{189,189,189,173},{181,247,214,231},{7,1,0,1}},  {/*1*/{189,189,255,173},{181,247, 49,231},{8,0,0,0}},  {/*2*/{206,189,206,173},{198,247,181,231},{8,1,0,1}},  {/*2*/{206,206,239,189},{198,165, 99,214},{7,1,0,0}},
+  {/*1*/{206,206,189,239},{198,165,231,148},{6,0,0,0}},  {/*2*/{206,206,222,206},{198,181,148,198},{5,1,0,1}},  {/*1*/{206,206,206,206},{198,181,198,198},{4,0,1,0}},  {/*2*/{206,206,206,255},{198,198,198,132},{3,1,0,0}},
+  {/*1*/{206,206,239,173},{198,198,115,247},{2,0,0,0}},  {/*1*/{206,239,189,173},{198,  0,247,247},{1,0,0,1}},  {/*1*/{206,222,255,189},{198,115, 82,231},{0,0,0,0}},  {/*1*/{206,206,206,239},{198,214,214,165},{1,0,1,0}},
+  {/*2*/{206,206,206,206},{198,214,214,214},{2,1,0,1}},  {/*1*/{206,206,206,206},{198,231,214,214},{3,0,1,0}},  {/*1*/{206,239,222,206},{198, 33,181,214},{4,0,0,1}},  {/*1*/{206,206,255,222},{198,247, 99,198},{5,0,0,0}},
+  {/*1*/{206,239,206,189},{198, 49,231,247},{6,0,1,1}},  {/*1*/{206,222,206,189},{198,165,231,247},{7,0,0,0}},  {/*1*/{206,239,206,239},{198, 66,231,181},{8,0,1,0}},  {/*2*/{222,222,222,206},{214,181,198,231},{7,1,0,1}},
+  {/*1*/{222,222,206,206},{214,181,247,231},{6,0,1,0}},  {/*2*/{222,222,206,255},{214,198,247,165},{5,1,0,0}},  {/*1*/{222,222,239,222},{214,198,165,214},{4,0,0,0}},  {/*1*/{222,239,222,222},{214, 99,214,214},{3,0,0,1}},
+  {/*1*/{222,222,255,239},{214,214,132,198},{2,0,0,1}},  {/*1*/{222,239,239,239},{214,115,181,198},{1,0,1,0}},  {/*2*/{222,222,239,206},{214,231,181,247},{0,1,0,1}},  {/*1*/{222,222,222,206},{214,231,231,247},{1,0,1,0}},
+  {/*2*/{222,222,222,206},{214,231,231,247},{2,1,0,1}},  {/*1*/{222,222,222,222},{214,247,231,231},{3,0,1,0}},  {/*1*/{222,239,239,222},{214,148,198,231},{4,0,1,1}},  {/*2*/{222,239,239,239},{214,165,198,214},{5,1,0,1}},
+  {/*1*/{222,239,222,239},{214,165,247,214},{6,0,1,0}},  {/*2*/{222,239,222,239},{214,181,247,214},{7,1,0,1}},  {/*1*/{222,239,222,255},{214,181,247,198},{8,0,1,0}},  {/*2*/{239,239,239,222},{231,181,214,247},{8,1,0,1}},
+  {/*3*/{239,239,239,222},{231,198,214,247},{7,1,1,0}},  {/*1*/{239,239,255,222},{231,198,181,247},{6,0,1,1}},  {/*2*/{239,239,255,239},{231,214,181,231},{5,1,0,1}},  {/*1*/{239,239,239,239},{231,214,231,231},{4,0,1,0}},
+  {/*2*/{239,239,239,239},{231,231,231,231},{3,1,0,1}},  {/*1*/{239,239,239,255},{231,231,231,214},{2,0,1,0}},  {/*2*/{239,239,255,255},{231,231,198,214},{1,1,0,1}},  {/*1*/{239,255,255,255},{231,148,198,214},{0,0,1,2}},
+  {/*1*/{239,239,239,239},{231,247,247,247},{1,0,1,2}},  {/*2*/{239,239,239,239},{231,247,247,247},{2,1,0,1}},  {/*1*/{239,255,239,239},{231,165,247,247},{3,0,1,0}},  {/*2*/{239,255,255,239},{231,181,214,247},{4,1,0,1}},
+  {/*1*/{239,255,255,255},{231,181,214,231},{5,0,1,0}},  {/*1*/{239,255,255,255},{231,198,214,231},{6,1,2,1}},  {/*1*/{239,255,255,255},{231,198,231,231},{7,0,2,2}},  {/*1*/{239,255,255,255},{231,198,231,231},{8,1,1,3}},
+  {/*2*/{255,255,255,255},{247,214,231,247},{7,1,0,3}},  {/*1*/{255,255,255,255},{247,214,231,247},{6,0,1,2}},  {/*1*/{255,255,255,255},{247,231,247,247},{5,1,2,1}},  {/*1*/{255,255,255,255},{247,231,247,247},{4,0,1,0}},
+  {/*2*/{255,255,255,255},{247,247,247,247},{3,1,0,1}},  {/*1*/{255,255,255,255},{247,247,247,247},{2,0,1,2}},  {/*1*/{255,255,255,255},{247,247,247,247},{1,1,2,3}},  {/*0*/{255,255,255,255},{247,247,247,247},{0,2,3,4}}
 },{
-  {{/*0*/{  0,  8,0},{  0,  8,1},{  0,  8,2},{  0,  8,3}}},  {{/*1*/{  0,  8,1},{  0,  8,0},{  0,  8,1},{  0,  8,2}}},  {{/*2*/{  0,  8,2},{  0,  8,1},{  0,  8,0},{  0,  8,1}}},  {{/*1*/{  0,  8,3},{  0, 24,0},{  0,  8,1},{  0,  8,0}}},
-  {{/*1*/{  0,  8,4},{  0, 24,1},{  0,  8,2},{  0,  8,1}}},  {{/*1*/{  0,  8,5},{  0, 41,0},{  0, 24,1},{  0,  8,2}}},  {{/*2*/{  0,  8,6},{  0, 41,1},{  0, 24,0},{  0,  8,3}}},  {{/*1*/{  0,  8,7},{  0, 57,1},{  0, 24,1},{  0, 24,3}}},
-  {{/*1*/{  0,  8,8},{  0, 57,0},{  0, 24,2},{  0, 24,2}}},  {{/*1*/{ 16,  8,7},{  0, 57,1},{  0, 41,2},{  0, 24,1}}},  {{/*1*/{ 16,  8,6},{  0, 74,0},{  0, 41,1},{  0, 24,0}}},  {{/*2*/{ 16,  8,5},{  0, 74,1},{  0, 41,0},{  0, 24,1}}},
-  {{/*1*/{ 16,  8,4},{  0, 90,0},{  0, 41,1},{ 16,  8,0}}},  {{/*2*/{ 16,  8,3},{  0, 90,1},{ 16,  8,0},{ 16,  8,1}}},  {{/*1*/{ 16,  8,2},{ 16,  8,0},{ 16,  8,1},{ 16,  8,2}}},  {{/*1*/{ 16,  8,1},{  0,107,0},{  0, 57,1},{  0, 41,2}}},
-  {{/*2*/{ 16,  8,0},{  0,107,1},{  0, 57,0},{  0, 41,1}}},  {{/*1*/{ 16,  8,1},{  0,123,0},{  0, 57,1},{  0, 41,0}}},  {{/*2*/{ 16,  8,2},{  0,123,1},{ 16, 24,0},{  0, 41,1}}},  {{/*1*/{ 16,  8,3},{  0,140,0},{  0, 74,1},{ 16, 24,0}}},
-  {{/*2*/{ 16,  8,4},{  0,140,1},{  0, 74,0},{ 16, 24,1}}},  {{/*1*/{ 16,  8,5},{  0,156,0},{  0, 74,1},{ 33,  8,1}}},  {{/*3*/{ 16,  8,6},{  0,156,1},{ 16, 41,1},{ 33,  8,0}}},  {{/*2*/{ 16,  8,7},{  0,173,1},{ 16, 41,0},{  0, 57,1}}},
-  {{/*1*/{ 16,  8,8},{  0,173,0},{  0, 90,1},{  0, 57,0}}},  {{/*2*/{ 33, 41,8},{  0,173,1},{  0, 90,0},{  0, 57,1}}},  {{/*1*/{ 33, 41,7},{  0,189,0},{  0, 90,1},{ 16, 41,0}}},  {{/*2*/{ 33, 41,6},{  0,189,1},{ 16, 57,0},{ 16, 41,1}}},
-  {{/*1*/{ 33, 41,5},{  0,206,0},{ 16, 57,1},{ 33, 24,1}}},  {{/*1*/{ 33, 41,4},{ 33,  8,0},{  0,107,1},{ 33, 24,0}}},  {{/*2*/{ 33, 41,3},{  0,222,1},{  0,107,0},{  0, 74,1}}},  {{/*1*/{ 33, 41,2},{  0,222,0},{  0,107,1},{  0, 74,0}}},
-  {{/*2*/{ 33, 41,1},{  0,222,1},{ 16, 74,0},{  0, 74,1}}},  {{/*1*/{ 33, 41,0},{  0,239,0},{  0,123,1},{ 16, 57,0}}},  {{/*1*/{ 33, 41,1},{ 33, 41,0},{  0,123,0},{ 16, 57,1}}},  {{/*1*/{ 33, 41,2},{  0,255,0},{ 33, 41,0},{ 33, 41,1}}},
-  {{/*1*/{ 33, 41,3},{ 33, 57,0},{ 16, 90,0},{ 33, 41,0}}},  {{/*2*/{ 33, 41,4},{ 16,173,1},{ 49,  8,0},{  0, 90,0}}},  {{/*1*/{ 33, 41,5},{ 16,173,0},{  0,140,1},{ 49, 24,0}}},  {{/*2*/{ 33, 41,6},{ 16,173,1},{  0,140,0},{ 16, 74,1}}},
-  {{/*1*/{ 33, 41,7},{ 16,189,0},{  0,140,1},{ 16, 74,0}}},  {{/*1*/{ 33, 41,8},{ 33, 90,0},{ 16,107,0},{ 66,  8,0}}},  {{/*1*/{ 49, 41,7},{ 16,206,0},{  0,156,1},{ 33, 57,1}}},  {{/*1*/{ 49, 41,6},{ 33,107,0},{  0,156,0},{ 33, 57,0}}},
-  {{/*1*/{ 49, 41,5},{ 16,222,0},{ 33, 74,0},{  0,107,1}}},  {{/*1*/{ 49, 41,4},{ 33,123,0},{ 16,123,1},{  0,107,0}}},  {{/*2*/{ 49, 41,3},{ 16,239,1},{ 16,123,0},{  0,107,1}}},  {{/*1*/{ 49, 41,2},{ 16,239,0},{  0,173,1},{ 16, 90,0}}},
-  {{/*1*/{ 49, 41,1},{ 33,140,0},{  0,173,0},{ 66, 24,0}}},  {{/*1*/{ 49, 41,0},{ 16,255,0},{ 33, 90,0},{ 33, 74,1}}},  {{/*1*/{ 49, 41,1},{ 33,156,0},{ 16,140,0},{ 33, 74,0}}},  {{/*2*/{ 49, 41,2},{ 33,156,1},{ 49, 57,0},{  0,123,0}}},
-  {{/*1*/{ 49, 41,3},{ 33,173,0},{  0,189,1},{ 49, 57,0}}},  {{/*2*/{ 49, 41,4},{ 33,173,1},{  0,189,0},{ 16,107,1}}},  {{/*1*/{ 49, 41,5},{ 33,189,0},{ 66, 24,0},{ 16,107,0}}},  {{/*2*/{ 49, 41,6},{ 33,189,1},{ 16,156,0},{ 66, 41,0}}},
-  {{/*2*/{ 49, 41,7},{ 33,206,1},{ 49, 74,0},{ 33, 90,1}}},  {{/*1*/{ 49, 41,8},{ 33,206,0},{  0,206,0},{ 33, 90,0}}},  {{/*2*/{ 66, 74,8},{ 33,206,1},{ 33,123,0},{  0,140,1}}},  {{/*1*/{ 66, 74,7},{ 33,222,0},{ 16,173,1},{  0,140,0}}},
-  {{/*1*/{ 66, 74,6},{ 66, 24,0},{ 16,173,0},{ 99,  8,0}}},  {{/*1*/{ 66, 74,5},{ 33,239,0},{ 82,  8,0},{ 16,123,0}}},  {{/*1*/{ 66, 74,4},{ 66, 41,0},{  0,222,0},{ 66, 57,0}}},  {{/*2*/{ 66, 74,3},{ 33,255,1},{ 33,140,0},{ 33,107,1}}},
-  {{/*1*/{ 66, 74,2},{ 33,255,0},{ 16,189,0},{ 33,107,0}}},  {{/*2*/{ 66, 74,1},{ 33,255,1},{ 49,107,0},{  0,156,0}}},  {{/*1*/{ 66, 74,0},{ 49,173,0},{  0,239,1},{ 49, 90,0}}},  {{/*1*/{ 66, 74,1},{ 66, 74,0},{  0,239,0},{ 99, 24,0}}},
-  {{/*1*/{ 66, 74,2},{ 49,189,0},{ 66, 74,0},{ 16,140,0}}},  {{/*1*/{ 66, 74,3},{ 66, 90,0},{ 16,206,0},{ 66, 74,0}}},  {{/*2*/{ 66, 74,4},{ 49,206,1},{ 82, 41,0},{ 33,123,0}}},  {{/*1*/{ 66, 74,5},{ 49,206,0},{  0,255,0},{ 82, 57,0}}},
-  {{/*2*/{ 66, 74,6},{ 49,206,1},{ 33,173,0},{  0,173,0}}},  {{/*1*/{ 66, 74,7},{ 49,222,0},{ 16,222,0},{ 49,107,0}}},  {{/*1*/{ 66, 74,8},{ 66,123,0},{ 49,140,0},{ 99, 41,0}}},  {{/*1*/{ 82, 74,7},{ 49,239,0},{ 33,189,1},{ 16,156,0}}},
-  {{/*1*/{ 82, 74,6},{ 66,140,0},{ 33,189,0},{ 66, 90,0}}},  {{/*1*/{ 82, 74,5},{ 49,255,0},{ 66,107,0},{ 33,140,1}}},  {{/*1*/{ 82, 74,4},{ 66,156,0},{ 16,239,0},{ 33,140,0}}},  {{/*2*/{ 82, 74,3},{ 66,156,1},{ 49,156,0},{  0,189,0}}},
-  {{/*1*/{ 82, 74,2},{ 82, 74,0},{ 33,206,1},{ 49,123,0}}},  {{/*1*/{ 82, 74,1},{ 66,173,0},{ 33,206,0},{ 99, 57,0}}},  {{/*2*/{ 82, 74,0},{ 66,173,1},{ 66,123,0},{ 16,173,0}}},  {{/*1*/{ 82, 74,1},{ 66,189,0},{ 16,255,0},{ 66,107,0}}},
-  {{/*2*/{ 82, 74,2},{ 66,189,1},{ 82, 90,0},{ 33,156,0}}},  {{/*1*/{ 82, 74,3},{ 66,206,0},{ 33,222,1},{ 82, 90,0}}},  {{/*1*/{ 82, 74,4},{ 99,  8,0},{ 33,222,0},{  0,206,0}}},  {{/*1*/{ 82, 74,5},{ 66,222,0},{ 99, 57,0},{ 49,140,0}}},
-  {{/*1*/{ 82, 74,6},{ 99, 24,0},{ 49,189,0},{ 16,189,0}}},  {{/*2*/{ 82, 74,7},{ 66,239,1},{ 82,107,0},{ 16,189,1}}},  {{/*1*/{ 82, 74,8},{ 66,239,0},{ 33,239,0},{ 66,123,0}}},  {{/*2*/{ 99,107,8},{ 66,239,1},{ 66,156,0},{ 33,173,1}}},
-  {{/*1*/{ 99,107,7},{ 66,255,0},{ 49,206,1},{ 33,173,0}}},  {{/*1*/{ 99,107,6},{ 99, 57,0},{ 49,206,0},{  0,222,0}}},  {{/*1*/{ 99,107,5},{ 82,173,0},{115, 41,0},{ 49,156,0}}},  {{/*1*/{ 99,107,4},{ 99, 74,0},{ 33,255,0},{ 99, 90,0}}},
-  {{/*2*/{ 99,107,3},{ 82,189,1},{ 66,173,0},{ 16,206,0}}},  {{/*1*/{ 99,107,2},{ 82,189,0},{ 49,222,0},{ 66,140,0}}},  {{/*2*/{ 99,107,1},{ 82,189,1},{ 82,140,0},{ 33,189,0}}},  {{/*1*/{ 99,107,0},{ 82,206,0},{ 66,189,1},{ 82,123,0}}},
-  {{/*1*/{ 99,107,1},{ 99,107,0},{ 66,189,0},{  0,239,0}}},  {{/*1*/{ 99,107,2},{ 82,222,0},{ 99,107,0},{ 49,173,0}}},  {{/*1*/{ 99,107,3},{ 99,123,0},{ 49,239,0},{ 16,222,0}}},  {{/*2*/{ 99,107,4},{ 82,239,1},{115, 74,0},{ 66,156,0}}},
-  {{/*1*/{ 99,107,5},{ 82,239,0},{ 66,206,1},{115, 90,0}}},  {{/*2*/{ 99,107,6},{ 82,239,1},{ 66,206,0},{ 33,206,0}}},  {{/*1*/{ 99,107,7},{ 82,255,0},{ 49,255,0},{ 82,140,0}}},  {{/*1*/{ 99,107,8},{ 99,156,0},{ 82,173,0},{  0,255,0}}},
-  {{/*2*/{115,107,7},{ 99,156,1},{148,  8,0},{ 49,189,0}}},  {{/*1*/{115,107,6},{ 99,173,0},{ 66,222,0},{ 99,123,0}}},  {{/*2*/{115,107,5},{ 99,173,1},{ 99,140,0},{ 16,239,0}}},  {{/*1*/{115,107,4},{ 99,189,0},{ 82,189,1},{ 66,173,0}}},
-  {{/*2*/{115,107,3},{ 99,189,1},{ 82,189,0},{ 33,222,0}}},  {{/*1*/{115,107,2},{115,107,0},{148, 24,0},{ 82,156,0}}},  {{/*1*/{115,107,1},{ 99,206,0},{ 66,239,0},{132, 90,0}}},  {{/*2*/{115,107,0},{ 99,206,1},{ 99,156,0},{ 49,206,0}}},
-  {{/*1*/{115,107,1},{ 99,222,0},{ 82,206,0},{ 16,255,0}}},  {{/*2*/{115,107,2},{ 99,222,1},{115,123,0},{ 66,189,0}}},  {{/*1*/{115,107,3},{ 99,239,0},{ 66,255,1},{115,123,0}}},  {{/*1*/{115,107,4},{132, 41,0},{ 66,255,0},{ 33,239,0}}},
-  {{/*1*/{115,107,5},{ 99,255,0},{132, 90,0},{ 82,173,0}}},  {{/*1*/{115,107,6},{132, 57,0},{ 82,222,0},{ 49,222,0}}},  {{/*2*/{115,107,7},{115,173,1},{115,140,0},{ 49,222,1}}},  {{/*1*/{115,107,8},{115,173,0},{ 99,189,1},{ 99,156,0}}},
-  {{/*2*/{132,140,8},{115,173,1},{ 99,189,0},{198, 24,0}}},  {{/*1*/{132,140,7},{115,189,0},{165, 24,0},{ 66,206,0}}},  {{/*1*/{132,140,6},{132, 90,0},{ 82,239,0},{ 33,255,0}}},  {{/*1*/{132,140,5},{115,206,0},{148, 74,0},{ 82,189,0}}},
-  {{/*1*/{132,140,4},{132,107,0},{ 99,206,1},{132,123,0}}},  {{/*2*/{132,140,3},{115,222,1},{ 99,206,0},{ 49,239,0}}},  {{/*1*/{132,140,2},{115,222,0},{ 82,255,0},{ 99,173,0}}},  {{/*2*/{132,140,1},{115,222,1},{115,173,0},{ 66,222,0}}},
-  {{/*1*/{132,140,0},{115,239,0},{181,  8,0},{115,156,0}}},  {{/*1*/{132,140,1},{132,140,0},{ 99,222,0},{165, 90,0}}},  {{/*1*/{132,140,2},{115,255,0},{132,140,0},{ 82,206,0}}},  {{/*1*/{132,140,3},{132,156,0},{115,189,0},{ 49,255,0}}},
-  {{/*2*/{132,140,4},{132,156,1},{148,107,0},{ 99,189,0}}},  {{/*1*/{132,140,5},{132,173,0},{ 99,239,1},{148,123,0}}},  {{/*2*/{132,140,6},{132,173,1},{ 99,239,0},{ 66,239,0}}},  {{/*1*/{132,140,7},{148, 90,0},{165, 74,0},{115,173,0}}},
-  {{/*1*/{132,140,8},{132,189,0},{115,206,0},{165,107,0}}},  {{/*2*/{148,140,7},{132,189,1},{181, 41,0},{ 82,222,0}}},  {{/*1*/{148,140,6},{132,206,0},{ 99,255,0},{132,156,0}}},  {{/*2*/{148,140,5},{132,206,1},{132,173,0},{231, 24,0}}},
-  {{/*1*/{148,140,4},{132,222,0},{198,  8,0},{ 99,206,0}}},  {{/*1*/{148,140,3},{165, 24,0},{115,222,0},{ 66,255,0}}},  {{/*1*/{148,140,2},{148,140,0},{181, 57,0},{115,189,0}}},  {{/*1*/{148,140,1},{132,239,0},{132,189,1},{165,123,0}}},
-  {{/*2*/{148,140,0},{132,239,1},{132,189,0},{ 82,239,0}}},  {{/*1*/{148,140,1},{132,255,0},{115,239,0},{132,173,0}}},  {{/*2*/{148,140,2},{132,255,1},{148,156,0},{ 99,222,0}}},  {{/*1*/{148,140,3},{148,173,0},{132,206,1},{148,156,0}}},
-  {{/*1*/{148,140,4},{165, 74,0},{132,206,0},{198, 90,0}}},  {{/*1*/{148,140,5},{148,189,0},{165,123,0},{115,206,0}}},  {{/*1*/{148,140,6},{165, 90,0},{115,255,0},{ 82,255,0}}},  {{/*2*/{148,140,7},{148,206,1},{148,173,0},{ 82,255,1}}},
-  {{/*1*/{148,140,8},{148,206,0},{214,  8,0},{132,189,0}}},  {{/*2*/{165,173,8},{148,206,1},{132,222,0},{231, 57,0}}},  {{/*1*/{165,173,7},{148,222,0},{198, 57,0},{ 99,239,0}}},  {{/*1*/{165,173,6},{165,123,0},{148,189,0},{198,107,0}}},
-  {{/*1*/{165,173,5},{148,239,0},{181,107,0},{115,222,0}}},  {{/*1*/{165,173,4},{165,140,0},{132,239,1},{165,156,0}}},  {{/*2*/{165,173,3},{148,255,1},{132,239,0},{132,206,1}}},  {{/*1*/{165,173,2},{148,255,0},{198, 74,0},{132,206,0}}},
-  {{/*2*/{165,173,1},{148,255,1},{148,206,0},{ 99,255,0}}},  {{/*1*/{165,173,0},{181, 74,0},{214, 41,0},{148,189,0}}},  {{/*1*/{165,173,1},{165,173,0},{132,255,0},{198,123,0}}},  {{/*2*/{165,173,2},{165,173,1},{165,173,0},{115,239,0}}},
-  {{/*1*/{165,173,3},{165,189,0},{148,222,0},{165,173,0}}},  {{/*2*/{165,173,4},{165,189,1},{181,140,0},{132,222,0}}},  {{/*1*/{165,173,5},{165,206,0},{165,189,1},{181,156,0}}},  {{/*1*/{165,173,6},{198,  8,0},{165,189,0},{231, 90,0}}},
-  {{/*1*/{165,173,7},{181,123,0},{198,107,0},{148,206,0}}},  {{/*1*/{165,173,8},{165,222,0},{148,239,0},{198,140,0}}},  {{/*2*/{181,173,7},{165,222,1},{214, 74,0},{115,255,0}}},  {{/*1*/{181,173,6},{165,239,0},{165,206,1},{165,189,0}}},
-  {{/*2*/{181,173,5},{165,239,1},{165,206,0},{132,239,1}}},  {{/*1*/{181,173,4},{165,255,0},{231, 41,0},{132,239,0}}},  {{/*1*/{181,173,3},{198, 57,0},{148,255,0},{231,107,0}}},  {{/*1*/{181,173,2},{181,173,0},{214, 90,0},{148,222,0}}},
-  {{/*1*/{181,173,1},{198, 74,0},{165,222,1},{198,156,0}}},  {{/*2*/{181,173,0},{181,189,1},{165,222,0},{165,206,1}}},  {{/*1*/{181,173,1},{181,189,0},{231, 57,0},{165,206,0}}},  {{/*2*/{181,173,2},{181,189,1},{181,189,0},{132,255,0}}},
-  {{/*1*/{181,173,3},{181,206,0},{247, 24,0},{181,189,0}}},  {{/*1*/{181,173,4},{198,107,0},{165,239,0},{231,123,0}}},  {{/*1*/{181,173,5},{181,222,0},{198,156,0},{148,239,0}}},  {{/*1*/{181,173,6},{198,123,0},{181,206,1},{198,173,0}}},
-  {{/*2*/{181,173,7},{181,239,1},{181,206,0},{165,222,1}}},  {{/*1*/{181,173,8},{181,239,0},{247, 41,0},{165,222,0}}},  {{/*2*/{198,206,8},{181,239,1},{165,255,0},{165,222,1}}},  {{/*1*/{198,206,7},{181,255,0},{231, 90,0},{181,206,0}}},
-  {{/*1*/{198,206,6},{198,156,0},{181,222,0},{231,140,0}}},  {{/*2*/{198,206,5},{198,173,1},{214,140,0},{148,255,0}}},  {{/*1*/{198,206,4},{198,173,0},{198,189,1},{198,189,0}}},  {{/*2*/{198,206,3},{198,189,1},{198,189,0},{165,239,1}}},
-  {{/*1*/{198,206,2},{198,189,0},{231,107,0},{165,239,0}}},  {{/*2*/{198,206,1},{198,189,1},{181,239,0},{165,239,1}}},  {{/*1*/{198,206,0},{214,107,0},{247, 74,0},{181,222,0}}},  {{/*1*/{198,206,1},{198,206,0},{198,206,1},{231,156,0}}},
-  {{/*2*/{198,206,2},{198,206,1},{198,206,0},{198,206,1}}},  {{/*1*/{198,206,3},{198,222,0},{181,255,0},{198,206,0}}},  {{/*2*/{198,206,4},{198,222,1},{214,173,0},{165,255,0}}},  {{/*1*/{198,206,5},{198,239,0},{198,222,1},{214,189,0}}},
-  {{/*1*/{198,206,6},{231, 41,0},{198,222,0},{181,239,1}}},  {{/*1*/{198,206,7},{214,156,0},{231,140,0},{181,239,0}}},  {{/*1*/{198,206,8},{198,255,0},{214,189,0},{231,173,0}}},  {{/*2*/{214,206,7},{198,255,1},{247,107,0},{198,222,1}}},
-  {{/*1*/{214,206,6},{214,173,0},{198,239,1},{198,222,0}}},  {{/*2*/{214,206,5},{214,189,1},{198,239,0},{198,222,1}}},  {{/*1*/{214,206,4},{214,189,0},{198,239,1},{214,206,0}}},  {{/*1*/{214,206,3},{231, 90,0},{214,206,0},{181,255,1}}},
-  {{/*1*/{214,206,2},{214,206,0},{247,123,0},{181,255,0}}},  {{/*1*/{214,206,1},{231,107,0},{198,255,1},{231,189,0}}},  {{/*2*/{214,206,0},{214,222,1},{198,255,0},{198,239,1}}},  {{/*1*/{214,206,1},{214,222,0},{198,255,1},{198,239,0}}},
-  {{/*2*/{214,206,2},{214,222,1},{214,222,0},{198,239,1}}},  {{/*1*/{214,206,3},{214,239,0},{214,222,1},{214,222,0}}},  {{/*1*/{214,206,4},{231,140,0},{231,189,1},{214,222,1}}},  {{/*1*/{214,206,5},{214,255,0},{231,189,0},{231,206,1}}},
-  {{/*1*/{214,206,6},{231,156,0},{214,239,1},{231,206,0}}},  {{/*2*/{214,206,7},{231,173,1},{214,239,0},{198,255,1}}},  {{/*1*/{214,206,8},{231,173,0},{214,239,1},{198,255,0}}},  {{/*2*/{231,239,8},{231,173,1},{231,206,0},{198,255,1}}},
-  {{/*1*/{231,239,7},{247, 90,0},{214,255,1},{214,239,0}}},  {{/*1*/{231,239,6},{231,189,0},{214,255,0},{214,239,1}}},  {{/*2*/{231,239,5},{231,206,1},{247,173,0},{231,222,1}}},  {{/*1*/{231,239,4},{231,206,0},{231,222,1},{231,222,0}}},
-  {{/*2*/{231,239,3},{231,222,1},{231,222,0},{231,222,1}}},  {{/*1*/{231,239,2},{231,222,0},{231,222,1},{247,206,0}}},  {{/*2*/{231,239,1},{231,222,1},{247,189,0},{214,255,1}}},  {{/*1*/{231,239,0},{247,140,0},{247,189,1},{214,255,0}}},
-  {{/*1*/{231,239,1},{231,239,0},{231,239,1},{214,255,1}}},  {{/*2*/{231,239,2},{231,239,1},{231,239,0},{231,239,1}}},  {{/*1*/{231,239,3},{231,255,0},{231,239,1},{231,239,0}}},  {{/*2*/{231,239,4},{231,255,1},{247,206,0},{231,239,1}}},
-  {{/*1*/{231,239,5},{247,173,0},{231,255,1},{247,222,0}}},  {{/*2*/{231,239,6},{247,189,1},{231,255,0},{247,222,1}}},  {{/*1*/{231,239,7},{247,189,0},{231,255,1},{247,222,2}}},  {{/*2*/{231,239,8},{247,189,1},{247,222,0},{231,255,2}}},
-  {{/*1*/{247,239,7},{247,206,1},{247,222,1},{231,255,1}}},  {{/*1*/{247,239,6},{247,206,0},{247,222,2},{231,255,0}}},  {{/*1*/{247,239,5},{247,222,1},{247,239,2},{231,255,1}}},  {{/*1*/{247,239,4},{247,222,0},{247,239,1},{247,239,0}}},
-  {{/*2*/{247,239,3},{247,239,1},{247,239,0},{247,239,1}}},  {{/*1*/{247,239,2},{247,239,0},{247,239,1},{247,239,2}}},  {{/*1*/{247,239,1},{247,239,1},{247,239,2},{247,239,3}}},  {{/*0*/{247,239,0},{247,255,1},{247,255,2},{247,255,3}}},
-  {{/*1*/{247,239,1},{247,255,0},{247,255,1},{247,255,2}}},  {{/*2*/{247,239,2},{247,255,1},{247,255,0},{247,255,1}}},  {{/*3*/{247,239,3},{247,255,2},{247,255,1},{247,255,0}}},  {{/*3*/{247,239,4},{247,255,3},{247,255,2},{247,255,1}}},
-  {{/*3*/{247,239,5},{247,255,4},{247,255,3},{247,255,2}}},  {{/*3*/{247,239,6},{247,255,5},{247,255,4},{247,255,3}}},  {{/*3*/{247,239,7},{247,255,6},{247,255,5},{247,255,4}}},  {{/*3*/{247,239,8},{247,255,7},{247,255,6},{247,255,5}}}
+  {/*0*/{  0,  0,  0,  0},{  8,  8,  8,  8},{0,1,2,3}},  {/*1*/{  0,  0,  0,  0},{  8,  8,  8,  8},{1,0,1,2}},  {/*2*/{  0,  0,  0,  0},{  8,  8,  8,  8},{2,1,0,1}},  {/*1*/{  0,  0,  0,  0},{  8, 24,  8,  8},{3,0,1,0}},
+  {/*1*/{  0,  0,  0,  0},{  8, 24,  8,  8},{4,1,2,1}},  {/*1*/{  0,  0,  0,  0},{  8, 41, 24,  8},{5,0,1,2}},  {/*2*/{  0,  0,  0,  0},{  8, 41, 24,  8},{6,1,0,3}},  {/*1*/{  0,  0,  0,  0},{  8, 57, 24, 24},{7,1,1,3}},
+  {/*1*/{  0,  0,  0,  0},{  8, 57, 24, 24},{8,0,2,2}},  {/*1*/{ 16,  0,  0,  0},{  8, 57, 41, 24},{7,1,2,1}},  {/*1*/{ 16,  0,  0,  0},{  8, 74, 41, 24},{6,0,1,0}},  {/*2*/{ 16,  0,  0,  0},{  8, 74, 41, 24},{5,1,0,1}},
+  {/*1*/{ 16,  0,  0, 16},{  8, 90, 41,  8},{4,0,1,0}},  {/*2*/{ 16,  0, 16, 16},{  8, 90,  8,  8},{3,1,0,1}},  {/*1*/{ 16, 16, 16, 16},{  8,  8,  8,  8},{2,0,1,2}},  {/*1*/{ 16,  0,  0,  0},{  8,107, 57, 41},{1,0,1,2}},
+  {/*2*/{ 16,  0,  0,  0},{  8,107, 57, 41},{0,1,0,1}},  {/*1*/{ 16,  0,  0,  0},{  8,123, 57, 41},{1,0,1,0}},  {/*2*/{ 16,  0, 16,  0},{  8,123, 24, 41},{2,1,0,1}},  {/*1*/{ 16,  0,  0, 16},{  8,140, 74, 24},{3,0,1,0}},
+  {/*2*/{ 16,  0,  0, 16},{  8,140, 74, 24},{4,1,0,1}},  {/*1*/{ 16,  0,  0, 33},{  8,156, 74,  8},{5,0,1,1}},  {/*3*/{ 16,  0, 16, 33},{  8,156, 41,  8},{6,1,1,0}},  {/*2*/{ 16,  0, 16,  0},{  8,173, 41, 57},{7,1,0,1}},
+  {/*1*/{ 16,  0,  0,  0},{  8,173, 90, 57},{8,0,1,0}},  {/*2*/{ 33,  0,  0,  0},{ 41,173, 90, 57},{8,1,0,1}},  {/*1*/{ 33,  0,  0, 16},{ 41,189, 90, 41},{7,0,1,0}},  {/*2*/{ 33,  0, 16, 16},{ 41,189, 57, 41},{6,1,0,1}},
+  {/*1*/{ 33,  0, 16, 33},{ 41,206, 57, 24},{5,0,1,1}},  {/*1*/{ 33, 33,  0, 33},{ 41,  8,107, 24},{4,0,1,0}},  {/*2*/{ 33,  0,  0,  0},{ 41,222,107, 74},{3,1,0,1}},  {/*1*/{ 33,  0,  0,  0},{ 41,222,107, 74},{2,0,1,0}},
+  {/*2*/{ 33,  0, 16,  0},{ 41,222, 74, 74},{1,1,0,1}},  {/*1*/{ 33,  0,  0, 16},{ 41,239,123, 57},{0,0,1,0}},  {/*1*/{ 33, 33,  0, 16},{ 41, 41,123, 57},{1,0,0,1}},  {/*1*/{ 33,  0, 33, 33},{ 41,255, 41, 41},{2,0,0,1}},
+  {/*1*/{ 33, 33, 16, 33},{ 41, 57, 90, 41},{3,0,0,0}},  {/*2*/{ 33, 16, 49,  0},{ 41,173,  8, 90},{4,1,0,0}},  {/*1*/{ 33, 16,  0, 49},{ 41,173,140, 24},{5,0,1,0}},  {/*2*/{ 33, 16,  0, 16},{ 41,173,140, 74},{6,1,0,1}},
+  {/*1*/{ 33, 16,  0, 16},{ 41,189,140, 74},{7,0,1,0}},  {/*1*/{ 33, 33, 16, 66},{ 41, 90,107,  8},{8,0,0,0}},  {/*1*/{ 49, 16,  0, 33},{ 41,206,156, 57},{7,0,1,1}},  {/*1*/{ 49, 33,  0, 33},{ 41,107,156, 57},{6,0,0,0}},
+  {/*1*/{ 49, 16, 33,  0},{ 41,222, 74,107},{5,0,0,1}},  {/*1*/{ 49, 33, 16,  0},{ 41,123,123,107},{4,0,1,0}},  {/*2*/{ 49, 16, 16,  0},{ 41,239,123,107},{3,1,0,1}},  {/*1*/{ 49, 16,  0, 16},{ 41,239,173, 90},{2,0,1,0}},
+  {/*1*/{ 49, 33,  0, 66},{ 41,140,173, 24},{1,0,0,0}},  {/*1*/{ 49, 16, 33, 33},{ 41,255, 90, 74},{0,0,0,1}},  {/*1*/{ 49, 33, 16, 33},{ 41,156,140, 74},{1,0,0,0}},  {/*2*/{ 49, 33, 49,  0},{ 41,156, 57,123},{2,1,0,0}},
+  {/*1*/{ 49, 33,  0, 49},{ 41,173,189, 57},{3,0,1,0}},  {/*2*/{ 49, 33,  0, 16},{ 41,173,189,107},{4,1,0,1}},  {/*1*/{ 49, 33, 66, 16},{ 41,189, 24,107},{5,0,0,0}},  {/*2*/{ 49, 33, 16, 66},{ 41,189,156, 41},{6,1,0,0}},
+  {/*2*/{ 49, 33, 49, 33},{ 41,206, 74, 90},{7,1,0,1}},  {/*1*/{ 49, 33,  0, 33},{ 41,206,206, 90},{8,0,0,0}},  {/*2*/{ 66, 33, 33,  0},{ 74,206,123,140},{8,1,0,1}},  {/*1*/{ 66, 33, 16,  0},{ 74,222,173,140},{7,0,1,0}},
+  {/*1*/{ 66, 66, 16, 99},{ 74, 24,173,  8},{6,0,0,0}},  {/*1*/{ 66, 33, 82, 16},{ 74,239,  8,123},{5,0,0,0}},  {/*1*/{ 66, 66,  0, 66},{ 74, 41,222, 57},{4,0,0,0}},  {/*2*/{ 66, 33, 33, 33},{ 74,255,140,107},{3,1,0,1}},
+  {/*1*/{ 66, 33, 16, 33},{ 74,255,189,107},{2,0,0,0}},  {/*2*/{ 66, 33, 49,  0},{ 74,255,107,156},{1,1,0,0}},  {/*1*/{ 66, 49,  0, 49},{ 74,173,239, 90},{0,0,1,0}},  {/*1*/{ 66, 66,  0, 99},{ 74, 74,239, 24},{1,0,0,0}},
+  {/*1*/{ 66, 49, 66, 16},{ 74,189, 74,140},{2,0,0,0}},  {/*1*/{ 66, 66, 16, 66},{ 74, 90,206, 74},{3,0,0,0}},  {/*2*/{ 66, 49, 82, 33},{ 74,206, 41,123},{4,1,0,0}},  {/*1*/{ 66, 49,  0, 82},{ 74,206,255, 57},{5,0,0,0}},
+  {/*2*/{ 66, 49, 33,  0},{ 74,206,173,173},{6,1,0,0}},  {/*1*/{ 66, 49, 16, 49},{ 74,222,222,107},{7,0,0,0}},  {/*1*/{ 66, 66, 49, 99},{ 74,123,140, 41},{8,0,0,0}},  {/*1*/{ 82, 49, 33, 16},{ 74,239,189,156},{7,0,1,0}},
+  {/*1*/{ 82, 66, 33, 66},{ 74,140,189, 90},{6,0,0,0}},  {/*1*/{ 82, 49, 66, 33},{ 74,255,107,140},{5,0,0,1}},  {/*1*/{ 82, 66, 16, 33},{ 74,156,239,140},{4,0,0,0}},  {/*2*/{ 82, 66, 49,  0},{ 74,156,156,189},{3,1,0,0}},
+  {/*1*/{ 82, 82, 33, 49},{ 74, 74,206,123},{2,0,1,0}},  {/*1*/{ 82, 66, 33, 99},{ 74,173,206, 57},{1,0,0,0}},  {/*2*/{ 82, 66, 66, 16},{ 74,173,123,173},{0,1,0,0}},  {/*1*/{ 82, 66, 16, 66},{ 74,189,255,107},{1,0,0,0}},
+  {/*2*/{ 82, 66, 82, 33},{ 74,189, 90,156},{2,1,0,0}},  {/*1*/{ 82, 66, 33, 82},{ 74,206,222, 90},{3,0,1,0}},  {/*1*/{ 82, 99, 33,  0},{ 74,  8,222,206},{4,0,0,0}},  {/*1*/{ 82, 66, 99, 49},{ 74,222, 57,140},{5,0,0,0}},
+  {/*1*/{ 82, 99, 49, 16},{ 74, 24,189,189},{6,0,0,0}},  {/*2*/{ 82, 66, 82, 16},{ 74,239,107,189},{7,1,0,1}},  {/*1*/{ 82, 66, 33, 66},{ 74,239,239,123},{8,0,0,0}},  {/*2*/{ 99, 66, 66, 33},{107,239,156,173},{8,1,0,1}},
+  {/*1*/{ 99, 66, 49, 33},{107,255,206,173},{7,0,1,0}},  {/*1*/{ 99, 99, 49,  0},{107, 57,206,222},{6,0,0,0}},  {/*1*/{ 99, 82,115, 49},{107,173, 41,156},{5,0,0,0}},  {/*1*/{ 99, 99, 33, 99},{107, 74,255, 90},{4,0,0,0}},
+  {/*2*/{ 99, 82, 66, 16},{107,189,173,206},{3,1,0,0}},  {/*1*/{ 99, 82, 49, 66},{107,189,222,140},{2,0,0,0}},  {/*2*/{ 99, 82, 82, 33},{107,189,140,189},{1,1,0,0}},  {/*1*/{ 99, 82, 66, 82},{107,206,189,123},{0,0,1,0}},
+  {/*1*/{ 99, 99, 66,  0},{107,107,189,239},{1,0,0,0}},  {/*1*/{ 99, 82, 99, 49},{107,222,107,173},{2,0,0,0}},  {/*1*/{ 99, 99, 49, 16},{107,123,239,222},{3,0,0,0}},  {/*2*/{ 99, 82,115, 66},{107,239, 74,156},{4,1,0,0}},
+  {/*1*/{ 99, 82, 66,115},{107,239,206, 90},{5,0,1,0}},  {/*2*/{ 99, 82, 66, 33},{107,239,206,206},{6,1,0,0}},  {/*1*/{ 99, 82, 49, 82},{107,255,255,140},{7,0,0,0}},  {/*1*/{ 99, 99, 82,  0},{107,156,173,255},{8,0,0,0}},
+  {/*2*/{115, 99,148, 49},{107,156,  8,189},{7,1,0,0}},  {/*1*/{115, 99, 66, 99},{107,173,222,123},{6,0,0,0}},  {/*2*/{115, 99, 99, 16},{107,173,140,239},{5,1,0,0}},  {/*1*/{115, 99, 82, 66},{107,189,189,173},{4,0,1,0}},
+  {/*2*/{115, 99, 82, 33},{107,189,189,222},{3,1,0,0}},  {/*1*/{115,115,148, 82},{107,107, 24,156},{2,0,0,0}},  {/*1*/{115, 99, 66,132},{107,206,239, 90},{1,0,0,0}},  {/*2*/{115, 99, 99, 49},{107,206,156,206},{0,1,0,0}},
+  {/*1*/{115, 99, 82, 16},{107,222,206,255},{1,0,0,0}},  {/*2*/{115, 99,115, 66},{107,222,123,189},{2,1,0,0}},  {/*1*/{115, 99, 66,115},{107,239,255,123},{3,0,1,0}},  {/*1*/{115,132, 66, 33},{107, 41,255,239},{4,0,0,0}},
+  {/*1*/{115, 99,132, 82},{107,255, 90,173},{5,0,0,0}},  {/*1*/{115,132, 82, 49},{107, 57,222,222},{6,0,0,0}},  {/*2*/{115,115,115, 49},{107,173,140,222},{7,1,0,1}},  {/*1*/{115,115, 99, 99},{107,173,189,156},{8,0,1,0}},
+  {/*2*/{132,115, 99,198},{140,173,189, 24},{8,1,0,0}},  {/*1*/{132,115,165, 66},{140,189, 24,206},{7,0,0,0}},  {/*1*/{132,132, 82, 33},{140, 90,239,255},{6,0,0,0}},  {/*1*/{132,115,148, 82},{140,206, 74,189},{5,0,0,0}},
+  {/*1*/{132,132, 99,132},{140,107,206,123},{4,0,1,0}},  {/*2*/{132,115, 99, 49},{140,222,206,239},{3,1,0,0}},  {/*1*/{132,115, 82, 99},{140,222,255,173},{2,0,0,0}},  {/*2*/{132,115,115, 66},{140,222,173,222},{1,1,0,0}},
+  {/*1*/{132,115,181,115},{140,239,  8,156},{0,0,0,0}},  {/*1*/{132,132, 99,165},{140,140,222, 90},{1,0,0,0}},  {/*1*/{132,115,132, 82},{140,255,140,206},{2,0,0,0}},  {/*1*/{132,132,115, 49},{140,156,189,255},{3,0,0,0}},
+  {/*2*/{132,132,148, 99},{140,156,107,189},{4,1,0,0}},  {/*1*/{132,132, 99,148},{140,173,239,123},{5,0,1,0}},  {/*2*/{132,132, 99, 66},{140,173,239,239},{6,1,0,0}},  {/*1*/{132,148,165,115},{140, 90, 74,173},{7,0,0,0}},
+  {/*1*/{132,132,115,165},{140,189,206,107},{8,0,0,0}},  {/*2*/{148,132,181, 82},{140,189, 41,222},{7,1,0,0}},  {/*1*/{148,132, 99,132},{140,206,255,156},{6,0,0,0}},  {/*2*/{148,132,132,231},{140,206,173, 24},{5,1,0,0}},
+  {/*1*/{148,132,198, 99},{140,222,  8,206},{4,0,0,0}},  {/*1*/{148,165,115, 66},{140, 24,222,255},{3,0,0,0}},  {/*1*/{148,148,181,115},{140,140, 57,189},{2,0,0,0}},  {/*1*/{148,132,132,165},{140,239,189,123},{1,0,1,0}},
+  {/*2*/{148,132,132, 82},{140,239,189,239},{0,1,0,0}},  {/*1*/{148,132,115,132},{140,255,239,173},{1,0,0,0}},  {/*2*/{148,132,148, 99},{140,255,156,222},{2,1,0,0}},  {/*1*/{148,148,132,148},{140,173,206,156},{3,0,1,0}},
+  {/*1*/{148,165,132,198},{140, 74,206, 90},{4,0,0,0}},  {/*1*/{148,148,165,115},{140,189,123,206},{5,0,0,0}},  {/*1*/{148,165,115, 82},{140, 90,255,255},{6,0,0,0}},  {/*2*/{148,148,148, 82},{140,206,173,255},{7,1,0,1}},
+  {/*1*/{148,148,214,132},{140,206,  8,189},{8,0,0,0}},  {/*2*/{165,148,132,231},{173,206,222, 57},{8,1,0,0}},  {/*1*/{165,148,198, 99},{173,222, 57,239},{7,0,0,0}},  {/*1*/{165,165,148,198},{173,123,189,107},{6,0,0,0}},
+  {/*1*/{165,148,181,115},{173,239,107,222},{5,0,0,0}},  {/*1*/{165,165,132,165},{173,140,239,156},{4,0,1,0}},  {/*2*/{165,148,132,132},{173,255,239,206},{3,1,0,1}},  {/*1*/{165,148,198,132},{173,255, 74,206},{2,0,0,0}},
+  {/*2*/{165,148,148, 99},{173,255,206,255},{1,1,0,0}},  {/*1*/{165,181,214,148},{173, 74, 41,189},{0,0,0,0}},  {/*1*/{165,165,132,198},{173,173,255,123},{1,0,0,0}},  {/*2*/{165,165,165,115},{173,173,173,239},{2,1,0,0}},
+  {/*1*/{165,165,148,165},{173,189,222,173},{3,0,0,0}},  {/*2*/{165,165,181,132},{173,189,140,222},{4,1,0,0}},  {/*1*/{165,165,165,181},{173,206,189,156},{5,0,1,0}},  {/*1*/{165,198,165,231},{173,  8,189, 90},{6,0,0,0}},
+  {/*1*/{165,181,198,148},{173,123,107,206},{7,0,0,0}},  {/*1*/{165,165,148,198},{173,222,239,140},{8,0,0,0}},  {/*2*/{181,165,214,115},{173,222, 74,255},{7,1,0,0}},  {/*1*/{181,165,165,165},{173,239,206,189},{6,0,1,0}},
+  {/*2*/{181,165,165,132},{173,239,206,239},{5,1,0,1}},  {/*1*/{181,165,231,132},{173,255, 41,239},{4,0,0,0}},  {/*1*/{181,198,148,231},{173, 57,255,107},{3,0,0,0}},  {/*1*/{181,181,214,148},{173,173, 90,222},{2,0,0,0}},
+  {/*1*/{181,198,165,198},{173, 74,222,156},{1,0,1,0}},  {/*2*/{181,181,165,165},{173,189,222,206},{0,1,0,1}},  {/*1*/{181,181,231,165},{173,189, 57,206},{1,0,0,0}},  {/*2*/{181,181,181,132},{173,189,189,255},{2,1,0,0}},
+  {/*1*/{181,181,247,181},{173,206, 24,189},{3,0,0,0}},  {/*1*/{181,198,165,231},{173,107,239,123},{4,0,0,0}},  {/*1*/{181,181,198,148},{173,222,156,239},{5,0,0,0}},  {/*1*/{181,198,181,198},{173,123,206,173},{6,0,1,0}},
+  {/*2*/{181,181,181,165},{173,239,206,222},{7,1,0,1}},  {/*1*/{181,181,247,165},{173,239, 41,222},{8,0,0,0}},  {/*2*/{198,181,165,165},{206,239,255,222},{8,1,0,1}},  {/*1*/{198,181,231,181},{206,255, 90,206},{7,0,0,0}},
+  {/*1*/{198,198,181,231},{206,156,222,140},{6,0,0,0}},  {/*2*/{198,198,214,148},{206,173,140,255},{5,1,0,0}},  {/*1*/{198,198,198,198},{206,173,189,189},{4,0,1,0}},  {/*2*/{198,198,198,165},{206,189,189,239},{3,1,0,1}},
+  {/*1*/{198,198,231,165},{206,189,107,239},{2,0,0,0}},  {/*2*/{198,198,181,165},{206,189,239,239},{1,1,0,1}},  {/*1*/{198,214,247,181},{206,107, 74,222},{0,0,0,0}},  {/*1*/{198,198,198,231},{206,206,206,156},{1,0,1,0}},
+  {/*2*/{198,198,198,198},{206,206,206,206},{2,1,0,1}},  {/*1*/{198,198,181,198},{206,222,255,206},{3,0,0,0}},  {/*2*/{198,198,214,165},{206,222,173,255},{4,1,0,0}},  {/*1*/{198,198,198,214},{206,239,222,189},{5,0,1,0}},
+  {/*1*/{198,231,198,181},{206, 41,222,239},{6,0,0,1}},  {/*1*/{198,214,231,181},{206,156,140,239},{7,0,0,0}},  {/*1*/{198,198,214,231},{206,255,189,173},{8,0,0,0}},  {/*2*/{214,198,247,198},{206,255,107,222},{7,1,0,1}},
+  {/*1*/{214,214,198,198},{206,173,239,222},{6,0,1,0}},  {/*2*/{214,214,198,198},{206,189,239,222},{5,1,0,1}},  {/*1*/{214,214,198,214},{206,189,239,206},{4,0,1,0}},  {/*1*/{214,231,214,181},{206, 90,206,255},{3,0,0,1}},
+  {/*1*/{214,214,247,181},{206,206,123,255},{2,0,0,0}},  {/*1*/{214,231,198,231},{206,107,255,189},{1,0,1,0}},  {/*2*/{214,214,198,198},{206,222,255,239},{0,1,0,1}},  {/*1*/{214,214,198,198},{206,222,255,239},{1,0,1,0}},
+  {/*2*/{214,214,214,198},{206,222,222,239},{2,1,0,1}},  {/*1*/{214,214,214,214},{206,239,222,222},{3,0,1,0}},  {/*1*/{214,231,231,214},{206,140,189,222},{4,0,1,1}},  {/*1*/{214,214,231,231},{206,255,189,206},{5,0,0,1}},
+  {/*1*/{214,231,214,231},{206,156,239,206},{6,0,1,0}},  {/*2*/{214,231,214,198},{206,173,239,255},{7,1,0,1}},  {/*1*/{214,231,214,198},{206,173,239,255},{8,0,1,0}},  {/*2*/{231,231,231,198},{239,173,206,255},{8,1,0,1}},
+  {/*1*/{231,247,214,214},{239, 90,255,239},{7,0,1,0}},  {/*1*/{231,231,214,214},{239,189,255,239},{6,0,0,1}},  {/*2*/{231,231,247,231},{239,206,173,222},{5,1,0,1}},  {/*1*/{231,231,231,231},{239,206,222,222},{4,0,1,0}},
+  {/*2*/{231,231,231,231},{239,222,222,222},{3,1,0,1}},  {/*1*/{231,231,231,247},{239,222,222,206},{2,0,1,0}},  {/*2*/{231,231,247,214},{239,222,189,255},{1,1,0,1}},  {/*1*/{231,247,247,214},{239,140,189,255},{0,0,1,0}},
+  {/*1*/{231,231,231,214},{239,239,239,255},{1,0,1,1}},  {/*2*/{231,231,231,231},{239,239,239,239},{2,1,0,1}},  {/*1*/{231,231,231,231},{239,255,239,239},{3,0,1,0}},  {/*2*/{231,231,247,231},{239,255,206,239},{4,1,0,1}},
+  {/*1*/{231,247,231,247},{239,173,255,222},{5,0,1,0}},  {/*2*/{231,247,231,247},{239,189,255,222},{6,1,0,1}},  {/*1*/{231,247,231,247},{239,189,255,222},{7,0,1,2}},  {/*2*/{231,247,247,231},{239,189,222,255},{8,1,0,2}},
+  {/*1*/{247,247,247,231},{239,206,222,255},{7,1,1,1}},  {/*1*/{247,247,247,231},{239,206,222,255},{6,0,2,0}},  {/*1*/{247,247,247,231},{239,222,239,255},{5,1,2,1}},  {/*1*/{247,247,247,247},{239,222,239,239},{4,0,1,0}},
+  {/*2*/{247,247,247,247},{239,239,239,239},{3,1,0,1}},  {/*1*/{247,247,247,247},{239,239,239,239},{2,0,1,2}},  {/*1*/{247,247,247,247},{239,239,239,239},{1,1,2,3}},  {/*0*/{247,247,247,247},{239,255,255,255},{0,1,2,3}},
+  {/*1*/{247,247,247,247},{239,255,255,255},{1,0,1,2}},  {/*2*/{247,247,247,247},{239,255,255,255},{2,1,0,1}},  {/*3*/{247,247,247,247},{239,255,255,255},{3,2,1,0}},  {/*3*/{247,247,247,247},{239,255,255,255},{4,3,2,1}},
+  {/*3*/{247,247,247,247},{239,255,255,255},{5,4,3,2}},  {/*3*/{247,247,247,247},{239,255,255,255},{6,5,4,3}},  {/*3*/{247,247,247,247},{239,255,255,255},{7,6,5,4}},  {/*3*/{247,247,247,247},{239,255,255,255},{8,7,6,5}}
 },{
-  {{/*1*/{  8,  8,8},{  8,  8,8},{  8,  8,8},{  8,  8,8}}},  {{/*1*/{  8,  8,7},{  8,  8,7},{  8,  8,7},{  8,  8,7}}},  {{/*1*/{  8,  8,6},{  8,  8,6},{  8,  8,6},{  8,  8,6}}},  {{/*1*/{  8,  8,5},{  8,  8,5},{  8,  8,5},{  8,  8,5}}},
-  {{/*1*/{  8,  8,4},{  8,  8,4},{  8,  8,4},{  8,  8,4}}},  {{/*1*/{  8,  8,3},{  8,  8,3},{  8,  8,3},{  8,  8,3}}},  {{/*1*/{  8,  8,2},{  8,  8,2},{  8,  8,2},{  8,  8,2}}},  {{/*1*/{  8,  8,1},{  8,  8,1},{  8,  8,1},{  8,  8,1}}},
-  {{/*1*/{  8,  8,0},{  8,  8,0},{  8,  8,0},{  8,  8,0}}},  {{/*1*/{  8,  8,1},{  8,  8,1},{  8,  8,1},{  8,  8,1}}},  {{/*1*/{  8,  8,2},{  8, 24,0},{  8,  8,2},{  8,  8,2}}},  {{/*1*/{  8,  8,3},{  8, 24,1},{  8, 24,1},{  8,  8,3}}},
-  {{/*1*/{  8,  8,4},{  8, 41,0},{  8, 24,0},{  8, 24,2}}},  {{/*1*/{  8,  8,5},{  8, 41,1},{  8, 24,1},{  8, 24,1}}},  {{/*1*/{  8,  8,6},{  8, 57,0},{  8, 24,2},{  8, 24,0}}},  {{/*1*/{  8,  8,7},{  8, 57,1},{  8, 41,2},{  8, 24,1}}},
-  {{/*1*/{  8,  8,8},{  8, 74,1},{  8, 41,1},{ 24,  8,1}}},  {{/*1*/{ 24, 24,7},{  8, 74,0},{  8, 41,0},{ 24,  8,0}}},  {{/*1*/{ 24, 24,6},{  8, 74,1},{  8, 41,1},{ 24,  8,1}}},  {{/*1*/{ 24, 24,5},{  8, 90,0},{ 24,  8,0},{  8, 41,2}}},
-  {{/*1*/{ 24, 24,4},{  8, 90,1},{  8, 57,1},{  8, 41,1}}},  {{/*1*/{ 24, 24,3},{  8,107,0},{  8, 57,0},{  8, 41,0}}},  {{/*1*/{ 24, 24,2},{  8,107,1},{  8, 57,1},{  8, 41,1}}},  {{/*1*/{ 24, 24,1},{  8,123,1},{ 24, 24,1},{ 24, 24,1}}},
-  {{/*1*/{ 24, 24,0},{  8,123,0},{ 24, 24,0},{ 24, 24,0}}},  {{/*1*/{ 24, 24,1},{  8,123,1},{  8, 74,1},{ 24, 24,1}}},  {{/*1*/{ 24, 24,2},{  8,140,0},{  8, 74,0},{ 41,  8,1}}},  {{/*3*/{ 24, 24,3},{  8,140,1},{  8, 74,1},{ 41,  8,0}}},
-  {{/*1*/{ 24, 24,4},{  8,156,0},{ 24, 41,0},{  8, 57,0}}},  {{/*1*/{ 24, 24,5},{  8,156,1},{ 24, 41,1},{  8, 57,1}}},  {{/*1*/{ 24, 24,6},{  8,173,1},{  8, 90,1},{ 24, 41,1}}},  {{/*1*/{ 24, 24,7},{  8,173,0},{  8, 90,0},{ 24, 41,0}}},
-  {{/*1*/{ 24, 24,8},{  8,173,1},{  8, 90,1},{ 24, 41,1}}},  {{/*1*/{ 41, 41,8},{  8,189,0},{ 24, 57,0},{ 41, 24,0}}},  {{/*1*/{ 41, 41,7},{  8,189,1},{  8,107,1},{  8, 74,1}}},  {{/*1*/{ 41, 41,6},{  8,206,0},{  8,107,0},{  8, 74,0}}},
-  {{/*1*/{ 41, 41,5},{ 41,  8,0},{ 41, 24,0},{ 57,  8,0}}},  {{/*1*/{ 41, 41,4},{ 24,123,0},{ 24, 74,1},{ 24, 57,0}}},  {{/*1*/{ 41, 41,3},{  8,222,0},{ 24, 74,0},{ 24, 57,1}}},  {{/*1*/{ 41, 41,2},{  8,222,1},{  8,123,1},{ 24, 57,2}}},
-  {{/*1*/{ 41, 41,1},{  8,239,0},{  8,123,0},{ 41, 41,1}}},  {{/*1*/{ 41, 41,0},{ 41, 41,0},{ 41, 41,0},{ 41, 41,0}}},  {{/*1*/{ 41, 41,1},{  8,255,0},{ 24, 90,0},{  8, 90,0}}},  {{/*1*/{ 41, 41,2},{ 41, 57,0},{ 57,  8,0},{ 57, 24,0}}},
-  {{/*1*/{ 41, 41,3},{ 24,173,0},{  8,140,1},{ 24, 74,1}}},  {{/*1*/{ 41, 41,4},{ 41, 74,0},{  8,140,0},{ 24, 74,0}}},  {{/*3*/{ 41, 41,5},{ 24,189,1},{  8,140,1},{ 74,  8,0}}},  {{/*1*/{ 41, 41,6},{ 24,189,0},{ 24,107,0},{ 41, 57,0}}},
-  {{/*1*/{ 41, 41,7},{ 24,189,1},{  8,156,1},{  8,107,1}}},  {{/*1*/{ 41, 41,8},{ 24,206,0},{  8,156,0},{  8,107,0}}},  {{/*1*/{ 57, 57,7},{ 41,107,0},{ 41, 74,0},{ 57, 41,0}}},  {{/*1*/{ 57, 57,6},{ 24,222,0},{ 24,123,0},{ 24, 90,0}}},
-  {{/*1*/{ 57, 57,5},{ 41,123,0},{ 57, 41,0},{ 74, 24,0}}},  {{/*1*/{ 57, 57,4},{ 24,239,1},{  8,173,1},{ 41, 74,1}}},  {{/*1*/{ 57, 57,3},{ 24,239,0},{  8,173,0},{ 41, 74,0}}},  {{/*2*/{ 57, 57,2},{ 24,239,1},{ 74,  8,0},{ 90,  8,0}}},
-  {{/*1*/{ 57, 57,1},{ 24,255,0},{ 24,140,0},{  8,123,0}}},  {{/*1*/{ 57, 57,0},{ 41,156,0},{ 57, 57,0},{ 57, 57,0}}},  {{/*2*/{ 57, 57,1},{ 41,156,1},{  8,189,0},{ 24,107,1}}},  {{/*1*/{ 57, 57,2},{ 41,173,0},{ 41,107,0},{ 24,107,0}}},
-  {{/*3*/{ 57, 57,3},{ 41,173,1},{ 24,156,1},{ 74, 41,0}}},  {{/*1*/{ 57, 57,4},{ 41,189,0},{ 24,156,0},{ 41, 90,0}}},  {{/*3*/{ 57, 57,5},{ 41,189,1},{  8,206,1},{ 90, 24,0}}},  {{/*2*/{ 57, 57,6},{ 41,206,1},{  8,206,0},{  8,140,0}}},
-  {{/*1*/{ 57, 57,7},{ 41,206,0},{ 41,123,0},{ 57, 74,0}}},  {{/*2*/{ 57, 57,8},{ 41,206,1},{ 24,173,0},{ 24,123,0}}},  {{/*1*/{ 74, 74,8},{ 41,222,0},{ 57, 90,0},{ 74, 57,0}}},  {{/*1*/{ 74, 74,7},{ 41,222,1},{  8,222,1},{ 41,107,1}}},
-  {{/*1*/{ 74, 74,6},{ 41,239,0},{  8,222,0},{ 41,107,0}}},  {{/*1*/{ 74, 74,5},{ 74, 41,0},{ 74, 57,0},{ 90, 41,0}}},  {{/*1*/{ 74, 74,4},{ 57,156,0},{ 24,189,0},{  8,156,0}}},  {{/*1*/{ 74, 74,3},{ 41,255,0},{ 57,107,0},{107, 24,0}}},
-  {{/*2*/{ 74, 74,2},{ 41,255,1},{  8,239,0},{ 24,140,0}}},  {{/*1*/{ 74, 74,1},{ 57,173,0},{ 41,156,0},{ 24,140,1}}},  {{/*1*/{ 74, 74,0},{ 74, 74,0},{ 74, 74,0},{ 74, 74,0}}},  {{/*1*/{ 74, 74,1},{ 57,189,0},{ 24,206,0},{ 41,123,0}}},
-  {{/*1*/{ 74, 74,2},{ 74, 90,0},{ 90, 41,0},{ 90, 57,0}}},  {{/*1*/{ 74, 74,3},{ 57,206,0},{  8,255,0},{  8,173,0}}},  {{/*1*/{ 74, 74,4},{ 74,107,0},{ 41,173,0},{ 57,107,0}}},  {{/*2*/{ 74, 74,5},{ 57,222,1},{ 24,222,0},{ 24,156,0}}},
-  {{/*1*/{ 74, 74,6},{ 57,222,0},{ 57,140,0},{ 74, 90,0}}},  {{/*3*/{ 74, 74,7},{ 57,222,1},{ 41,189,1},{123, 24,0}}},  {{/*1*/{ 74, 74,8},{ 57,239,0},{ 41,189,0},{ 41,140,0}}},  {{/*1*/{ 90, 90,7},{ 74,140,0},{ 74,107,0},{ 90, 74,0}}},
-  {{/*1*/{ 90, 90,6},{ 57,255,0},{ 24,239,0},{  8,189,0}}},  {{/*1*/{ 90, 90,5},{ 74,156,0},{ 90, 74,0},{107, 57,0}}},  {{/*3*/{ 90, 90,4},{ 74,156,1},{ 41,206,1},{ 24,173,0}}},  {{/*1*/{ 90, 90,3},{ 74,173,0},{ 41,206,0},{ 74,107,0}}},
-  {{/*2*/{ 90, 90,2},{ 74,173,1},{ 24,255,0},{123, 41,0}}},  {{/*2*/{ 90, 90,1},{ 74,189,1},{ 57,173,0},{ 41,156,0}}},  {{/*1*/{ 90, 90,0},{ 74,189,0},{ 90, 90,0},{ 90, 90,0}}},  {{/*2*/{ 90, 90,1},{ 74,189,1},{ 41,222,0},{  8,206,0}}},
-  {{/*1*/{ 90, 90,2},{ 74,206,0},{ 74,140,0},{ 57,140,0}}},  {{/*1*/{ 90, 90,3},{107,  8,0},{ 57,189,1},{ 24,189,0}}},  {{/*1*/{ 90, 90,4},{ 74,222,0},{ 57,189,0},{ 74,123,0}}},  {{/*1*/{ 90, 90,5},{107, 24,0},{123, 24,0},{123, 57,0}}},
-  {{/*2*/{ 90, 90,6},{ 74,239,1},{ 41,239,0},{ 41,173,0}}},  {{/*1*/{ 90, 90,7},{ 74,239,0},{ 74,156,0},{ 90,107,0}}},  {{/*2*/{ 90, 90,8},{ 74,239,1},{ 57,206,0},{  8,222,0}}},  {{/*1*/{107,107,8},{ 74,255,0},{ 90,123,0},{107, 90,0}}},
-  {{/*3*/{107,107,7},{ 74,255,1},{ 41,255,1},{ 24,206,0}}},  {{/*1*/{107,107,6},{ 90,173,0},{ 41,255,0},{ 74,140,0}}},  {{/*1*/{107,107,5},{107, 74,0},{107, 90,0},{123, 74,0}}},  {{/*1*/{107,107,4},{ 90,189,0},{ 57,222,0},{ 41,189,0}}},
-  {{/*1*/{107,107,3},{107, 90,0},{ 90,140,0},{140, 57,0}}},  {{/*3*/{107,107,2},{ 90,206,1},{ 74,189,1},{  8,239,0}}},  {{/*1*/{107,107,1},{ 90,206,0},{ 74,189,0},{  8,239,1}}},  {{/*1*/{107,107,0},{107,107,0},{107,107,0},{ 24,222,0}}},
-  {{/*1*/{107,107,1},{ 90,222,0},{ 57,239,0},{ 74,156,0}}},  {{/*1*/{107,107,2},{107,123,0},{123, 74,0},{123, 90,0}}},  {{/*1*/{107,107,3},{ 90,239,0},{ 74,206,1},{ 41,206,0}}},  {{/*1*/{107,107,4},{107,140,0},{ 74,206,0},{ 90,140,0}}},
-  {{/*2*/{107,107,5},{ 90,255,1},{ 57,255,0},{  8,255,0}}},  {{/*1*/{107,107,6},{ 90,255,0},{ 90,173,0},{107,123,0}}},  {{/*2*/{107,107,7},{ 90,255,1},{156,  8,0},{ 24,239,0}}},  {{/*2*/{107,107,8},{107,173,1},{ 74,222,0},{ 74,173,0}}},
-  {{/*1*/{123,123,7},{107,173,0},{107,140,0},{123,107,0}}},  {{/*2*/{123,123,6},{107,173,1},{ 90,189,0},{ 41,222,0}}},  {{/*1*/{123,123,5},{107,189,0},{123,107,0},{140, 90,0}}},  {{/*3*/{123,123,4},{107,189,1},{ 74,239,1},{ 57,206,0}}},
-  {{/*1*/{123,123,3},{107,206,0},{ 74,239,0},{107,140,0}}},  {{/*1*/{123,123,2},{140,  8,0},{140, 74,0},{ 24,255,0}}},  {{/*2*/{123,123,1},{107,222,1},{ 90,206,0},{ 74,189,0}}},  {{/*1*/{123,123,0},{107,222,0},{123,123,0},{123,123,0}}},
-  {{/*2*/{123,123,1},{107,222,1},{ 74,255,0},{ 41,239,0}}},  {{/*1*/{123,123,2},{107,239,0},{107,173,0},{ 90,173,0}}},  {{/*1*/{123,123,3},{140, 41,0},{173,  8,0},{ 57,222,0}}},  {{/*1*/{123,123,4},{107,255,0},{ 90,222,0},{107,156,0}}},
-  {{/*1*/{123,123,5},{140, 57,0},{156, 57,0},{156, 90,0}}},  {{/*3*/{123,123,6},{123,173,1},{107,189,1},{ 74,206,0}}},  {{/*1*/{123,123,7},{123,173,0},{107,189,0},{123,140,0}}},  {{/*2*/{123,123,8},{123,173,1},{ 90,239,0},{ 41,255,0}}},
-  {{/*1*/{140,140,8},{123,189,0},{123,156,0},{140,123,0}}},  {{/*3*/{140,140,7},{123,189,1},{107,206,1},{ 57,239,0}}},  {{/*1*/{140,140,6},{123,206,0},{107,206,0},{107,173,0}}},  {{/*1*/{140,140,5},{140,107,0},{140,123,0},{156,107,0}}},
-  {{/*1*/{140,140,4},{123,222,0},{ 90,255,0},{ 74,222,0}}},  {{/*1*/{140,140,3},{140,123,0},{123,173,0},{173, 90,0}}},  {{/*2*/{140,140,2},{123,239,1},{189,  8,0},{ 90,206,0}}},  {{/*1*/{140,140,1},{123,239,0},{107,222,0},{ 57,255,1}}},
-  {{/*1*/{140,140,0},{140,140,0},{140,140,0},{ 57,255,0}}},  {{/*1*/{140,140,1},{123,255,0},{123,189,0},{107,189,0}}},  {{/*1*/{140,140,2},{140,156,0},{156,107,0},{156,123,0}}},  {{/*3*/{140,140,3},{140,156,1},{107,239,1},{ 74,239,0}}},
-  {{/*1*/{140,140,4},{140,173,0},{107,239,0},{123,173,0}}},  {{/*2*/{140,140,5},{140,173,1},{173, 74,0},{ 90,222,0}}},  {{/*1*/{140,140,6},{140,189,0},{123,206,0},{140,156,0}}},  {{/*2*/{140,140,7},{140,189,1},{189, 41,0},{189, 90,0}}},
-  {{/*2*/{140,140,8},{140,206,1},{107,255,0},{107,206,0}}},  {{/*1*/{156,156,7},{140,206,0},{140,173,0},{156,140,0}}},  {{/*2*/{156,156,6},{140,206,1},{123,222,0},{ 74,255,0}}},  {{/*1*/{156,156,5},{140,222,0},{156,140,0},{173,123,0}}},
-  {{/*1*/{156,156,4},{173, 24,0},{140,189,1},{ 90,239,0}}},  {{/*1*/{156,156,3},{140,239,0},{140,189,0},{140,173,0}}},  {{/*1*/{156,156,2},{173, 41,0},{173,107,0},{189,107,0}}},  {{/*2*/{156,156,1},{140,255,1},{123,239,0},{107,222,0}}},
-  {{/*1*/{156,156,0},{140,255,0},{156,156,0},{156,156,0}}},  {{/*3*/{156,156,1},{140,255,1},{140,206,1},{206, 90,0}}},  {{/*1*/{156,156,2},{156,173,0},{140,206,0},{123,206,0}}},  {{/*1*/{156,156,3},{173, 74,0},{206, 41,0},{ 90,255,0}}},
-  {{/*1*/{156,156,4},{156,189,0},{123,255,0},{140,189,0}}},  {{/*1*/{156,156,5},{173, 90,0},{189, 90,0},{189,123,0}}},  {{/*3*/{156,156,6},{156,206,1},{140,222,1},{107,239,0}}},  {{/*1*/{156,156,7},{156,206,0},{140,222,0},{156,173,0}}},
-  {{/*2*/{156,156,8},{156,206,1},{206, 57,0},{123,222,0}}},  {{/*1*/{173,173,8},{156,222,0},{156,189,0},{173,156,0}}},  {{/*2*/{173,173,7},{156,222,1},{222, 24,0},{222, 90,0}}},  {{/*1*/{173,173,6},{156,239,0},{140,239,0},{140,206,0}}},
-  {{/*1*/{173,173,5},{173,140,0},{173,156,0},{189,140,0}}},  {{/*1*/{173,173,4},{156,255,0},{156,206,1},{107,255,0}}},  {{/*1*/{173,173,3},{173,156,0},{156,206,0},{206,123,0}}},  {{/*2*/{173,173,2},{173,156,1},{222, 41,0},{123,239,0}}},
-  {{/*1*/{173,173,1},{189, 74,0},{140,255,0},{123,239,1}}},  {{/*1*/{173,173,0},{173,173,0},{173,173,0},{173,173,0}}},  {{/*2*/{173,173,1},{173,173,1},{156,222,0},{140,222,0}}},  {{/*1*/{173,173,2},{173,189,0},{189,140,0},{189,156,0}}},
-  {{/*3*/{173,173,3},{173,189,1},{173,189,1},{239, 90,0}}},  {{/*1*/{173,173,4},{173,206,0},{173,189,0},{156,206,0}}},  {{/*1*/{173,173,5},{206,  8,0},{206,107,0},{123,255,0}}},  {{/*1*/{173,173,6},{173,222,0},{156,239,0},{173,189,0}}},
-  {{/*1*/{173,173,7},{206, 24,0},{222, 74,0},{222,123,0}}},  {{/*3*/{173,173,8},{173,239,1},{173,206,1},{140,239,0}}},  {{/*1*/{189,189,7},{173,239,0},{173,206,0},{189,173,0}}},  {{/*2*/{189,189,6},{173,239,1},{156,255,0},{156,222,0}}},
-  {{/*1*/{189,189,5},{173,255,0},{189,173,0},{206,156,0}}},  {{/*1*/{189,189,4},{206, 57,0},{255,  8,0},{255, 90,0}}},  {{/*1*/{189,189,3},{189,173,0},{173,222,0},{173,206,0}}},  {{/*1*/{189,189,2},{206, 74,0},{206,140,0},{222,140,0}}},
-  {{/*3*/{189,189,1},{189,189,1},{189,189,1},{140,255,0}}},  {{/*1*/{189,189,0},{189,189,0},{189,189,0},{189,189,0}}},  {{/*2*/{189,189,1},{189,189,1},{255, 24,0},{239,123,0}}},  {{/*1*/{189,189,2},{189,206,0},{173,239,0},{156,239,0}}},
-  {{/*1*/{189,189,3},{206,107,0},{239, 74,0},{206,173,0}}},  {{/*1*/{189,189,4},{189,222,0},{189,206,0},{173,222,0}}},  {{/*1*/{189,189,5},{206,123,0},{222,123,0},{222,156,0}}},  {{/*1*/{189,189,6},{189,239,1},{173,255,1},{189,206,1}}},
-  {{/*1*/{189,189,7},{189,239,0},{173,255,0},{189,206,0}}},  {{/*2*/{189,189,8},{189,239,1},{239, 90,0},{156,255,0}}},  {{/*1*/{206,206,8},{189,255,0},{189,222,0},{206,189,0}}},  {{/*2*/{206,206,7},{189,255,1},{255, 57,0},{255,123,0}}},
-  {{/*3*/{206,206,6},{206,173,1},{206,189,1},{173,239,0}}},  {{/*1*/{206,206,5},{206,173,0},{206,189,0},{222,173,0}}},  {{/*3*/{206,206,4},{206,189,1},{189,239,1},{189,222,0}}},  {{/*1*/{206,206,3},{206,189,0},{189,239,0},{239,156,0}}},
-  {{/*2*/{206,206,2},{206,189,1},{255, 74,0},{239,156,1}}},  {{/*1*/{206,206,1},{222,107,0},{206,206,1},{206,206,1}}},  {{/*1*/{206,206,0},{206,206,0},{206,206,0},{206,206,0}}},  {{/*2*/{206,206,1},{206,206,1},{189,255,0},{173,255,0}}},
-  {{/*1*/{206,206,2},{206,222,0},{222,173,0},{222,189,0}}},  {{/*1*/{206,206,3},{206,222,1},{206,222,1},{189,239,1}}},  {{/*1*/{206,206,4},{206,239,0},{206,222,0},{189,239,0}}},  {{/*1*/{206,206,5},{239, 41,0},{239,140,0},{239,173,0}}},
-  {{/*1*/{206,206,6},{206,255,0},{222,189,0},{206,222,0}}},  {{/*1*/{206,206,7},{239, 57,0},{255,107,0},{255,156,0}}},  {{/*1*/{206,206,8},{222,173,1},{206,239,1},{222,206,1}}},  {{/*1*/{222,222,7},{222,173,0},{206,239,0},{222,206,0}}},
-  {{/*3*/{222,222,6},{222,189,1},{206,239,1},{189,255,0}}},  {{/*1*/{222,222,5},{222,189,0},{222,206,0},{239,189,0}}},  {{/*1*/{222,222,4},{239, 90,0},{206,255,1},{206,239,1}}},  {{/*1*/{222,222,3},{222,206,0},{206,255,0},{206,239,0}}},
-  {{/*1*/{222,222,2},{239,107,0},{239,173,0},{255,173,0}}},  {{/*1*/{222,222,1},{222,222,1},{222,222,1},{222,222,1}}},  {{/*1*/{222,222,0},{222,222,0},{222,222,0},{222,222,0}}},  {{/*1*/{222,222,1},{222,222,1},{222,222,1},{222,222,1}}},
-  {{/*1*/{222,222,2},{222,239,0},{239,189,0},{239,206,1}}},  {{/*1*/{222,222,3},{239,140,0},{222,239,1},{239,206,0}}},  {{/*1*/{222,222,4},{222,255,0},{222,239,0},{206,255,0}}},  {{/*1*/{222,222,5},{239,156,0},{255,156,0},{255,189,0}}},
-  {{/*1*/{222,222,6},{239,173,1},{239,206,1},{222,239,1}}},  {{/*1*/{222,222,7},{239,173,0},{239,206,0},{222,239,0}}},  {{/*1*/{222,222,8},{239,189,1},{222,255,1},{222,239,1}}},  {{/*1*/{239,239,8},{239,189,0},{222,255,0},{239,222,0}}},
-  {{/*1*/{239,239,7},{239,189,1},{222,255,1},{239,222,1}}},  {{/*1*/{239,239,6},{239,206,1},{239,222,1},{255,206,1}}},  {{/*1*/{239,239,5},{239,206,0},{239,222,0},{255,206,0}}},  {{/*3*/{239,239,4},{239,222,1},{239,222,1},{222,255,0}}},
-  {{/*1*/{239,239,3},{239,222,0},{255,189,0},{222,255,1}}},  {{/*1*/{239,239,2},{239,222,1},{255,189,1},{222,255,2}}},  {{/*1*/{239,239,1},{255,140,0},{239,239,1},{239,239,1}}},  {{/*1*/{239,239,0},{239,239,0},{239,239,0},{239,239,0}}},
-  {{/*1*/{239,239,1},{239,239,1},{239,239,1},{239,239,1}}},  {{/*1*/{239,239,2},{239,255,0},{255,206,0},{255,222,0}}},  {{/*1*/{239,239,3},{239,255,1},{239,255,1},{255,222,1}}},  {{/*1*/{239,239,4},{255,173,0},{239,255,0},{239,255,2}}},
-  {{/*1*/{239,239,5},{255,189,1},{239,255,1},{239,255,1}}},  {{/*1*/{239,239,6},{255,189,0},{255,222,0},{239,255,0}}},  {{/*1*/{239,239,7},{255,189,1},{255,222,1},{239,255,1}}},  {{/*1*/{239,239,8},{255,206,1},{255,222,2},{255,239,1}}},
-  {{/*1*/{255,255,7},{255,206,0},{255,239,2},{255,239,0}}},  {{/*1*/{255,255,6},{255,222,1},{255,239,1},{255,239,1}}},  {{/*1*/{255,255,5},{255,222,0},{255,239,0},{255,239,2}}},  {{/*1*/{255,255,4},{255,239,1},{255,239,1},{255,239,3}}},
-  {{/*1*/{255,255,3},{255,239,0},{255,239,2},{255,255,3}}},  {{/*1*/{255,255,2},{255,239,1},{255,255,2},{255,255,2}}},  {{/*1*/{255,255,1},{255,255,1},{255,255,1},{255,255,1}}},  {{/*1*/{255,255,0},{255,255,0},{255,255,0},{255,255,0}}}
+  {/*1*/{  8,  8,  8,  8},{  8,  8,  8,  8},{8,8,8,8}},  {/*1*/{  8,  8,  8,  8},{  8,  8,  8,  8},{7,7,7,7}},  {/*1*/{  8,  8,  8,  8},{  8,  8,  8,  8},{6,6,6,6}},  {/*1*/{  8,  8,  8,  8},{  8,  8,  8,  8},{5,5,5,5}},
+  {/*1*/{  8,  8,  8,  8},{  8,  8,  8,  8},{4,4,4,4}},  {/*1*/{  8,  8,  8,  8},{  8,  8,  8,  8},{3,3,3,3}},  {/*1*/{  8,  8,  8,  8},{  8,  8,  8,  8},{2,2,2,2}},  {/*1*/{  8,  8,  8,  8},{  8,  8,  8,  8},{1,1,1,1}},
+  {/*1*/{  8,  8,  8,  8},{  8,  8,  8,  8},{0,0,0,0}},  {/*1*/{  8,  8,  8,  8},{  8,  8,  8,  8},{1,1,1,1}},  {/*1*/{  8,  8,  8,  8},{  8, 24,  8,  8},{2,0,2,2}},  {/*1*/{  8,  8,  8,  8},{  8, 24, 24,  8},{3,1,1,3}},
+  {/*1*/{  8,  8,  8,  8},{  8, 41, 24, 24},{4,0,0,2}},  {/*1*/{  8,  8,  8,  8},{  8, 41, 24, 24},{5,1,1,1}},  {/*1*/{  8,  8,  8,  8},{  8, 57, 24, 24},{6,0,2,0}},  {/*1*/{  8,  8,  8,  8},{  8, 57, 41, 24},{7,1,2,1}},
+  {/*1*/{  8,  8,  8, 24},{  8, 74, 41,  8},{8,1,1,1}},  {/*1*/{ 24,  8,  8, 24},{ 24, 74, 41,  8},{7,0,0,0}},  {/*1*/{ 24,  8,  8, 24},{ 24, 74, 41,  8},{6,1,1,1}},  {/*1*/{ 24,  8, 24,  8},{ 24, 90,  8, 41},{5,0,0,2}},
+  {/*1*/{ 24,  8,  8,  8},{ 24, 90, 57, 41},{4,1,1,1}},  {/*1*/{ 24,  8,  8,  8},{ 24,107, 57, 41},{3,0,0,0}},  {/*1*/{ 24,  8,  8,  8},{ 24,107, 57, 41},{2,1,1,1}},  {/*1*/{ 24,  8, 24, 24},{ 24,123, 24, 24},{1,1,1,1}},
+  {/*1*/{ 24,  8, 24, 24},{ 24,123, 24, 24},{0,0,0,0}},  {/*1*/{ 24,  8,  8, 24},{ 24,123, 74, 24},{1,1,1,1}},  {/*1*/{ 24,  8,  8, 41},{ 24,140, 74,  8},{2,0,0,1}},  {/*3*/{ 24,  8,  8, 41},{ 24,140, 74,  8},{3,1,1,0}},
+  {/*1*/{ 24,  8, 24,  8},{ 24,156, 41, 57},{4,0,0,0}},  {/*1*/{ 24,  8, 24,  8},{ 24,156, 41, 57},{5,1,1,1}},  {/*1*/{ 24,  8,  8, 24},{ 24,173, 90, 41},{6,1,1,1}},  {/*1*/{ 24,  8,  8, 24},{ 24,173, 90, 41},{7,0,0,0}},
+  {/*1*/{ 24,  8,  8, 24},{ 24,173, 90, 41},{8,1,1,1}},  {/*1*/{ 41,  8, 24, 41},{ 41,189, 57, 24},{8,0,0,0}},  {/*1*/{ 41,  8,  8,  8},{ 41,189,107, 74},{7,1,1,1}},  {/*1*/{ 41,  8,  8,  8},{ 41,206,107, 74},{6,0,0,0}},
+  {/*1*/{ 41, 41, 41, 57},{ 41,  8, 24,  8},{5,0,0,0}},  {/*1*/{ 41, 24, 24, 24},{ 41,123, 74, 57},{4,0,1,0}},  {/*1*/{ 41,  8, 24, 24},{ 41,222, 74, 57},{3,0,0,1}},  {/*1*/{ 41,  8,  8, 24},{ 41,222,123, 57},{2,1,1,2}},
+  {/*1*/{ 41,  8,  8, 41},{ 41,239,123, 41},{1,0,0,1}},  {/*1*/{ 41, 41, 41, 41},{ 41, 41, 41, 41},{0,0,0,0}},  {/*1*/{ 41,  8, 24,  8},{ 41,255, 90, 90},{1,0,0,0}},  {/*1*/{ 41, 41, 57, 57},{ 41, 57,  8, 24},{2,0,0,0}},
+  {/*1*/{ 41, 24,  8, 24},{ 41,173,140, 74},{3,0,1,1}},  {/*1*/{ 41, 41,  8, 24},{ 41, 74,140, 74},{4,0,0,0}},  {/*3*/{ 41, 24,  8, 74},{ 41,189,140,  8},{5,1,1,0}},  {/*1*/{ 41, 24, 24, 41},{ 41,189,107, 57},{6,0,0,0}},
+  {/*1*/{ 41, 24,  8,  8},{ 41,189,156,107},{7,1,1,1}},  {/*1*/{ 41, 24,  8,  8},{ 41,206,156,107},{8,0,0,0}},  {/*1*/{ 57, 41, 41, 57},{ 57,107, 74, 41},{7,0,0,0}},  {/*1*/{ 57, 24, 24, 24},{ 57,222,123, 90},{6,0,0,0}},
+  {/*1*/{ 57, 41, 57, 74},{ 57,123, 41, 24},{5,0,0,0}},  {/*1*/{ 57, 24,  8, 41},{ 57,239,173, 74},{4,1,1,1}},  {/*1*/{ 57, 24,  8, 41},{ 57,239,173, 74},{3,0,0,0}},  {/*2*/{ 57, 24, 74, 90},{ 57,239,  8,  8},{2,1,0,0}},
+  {/*1*/{ 57, 24, 24,  8},{ 57,255,140,123},{1,0,0,0}},  {/*1*/{ 57, 41, 57, 57},{ 57,156, 57, 57},{0,0,0,0}},  {/*2*/{ 57, 41,  8, 24},{ 57,156,189,107},{1,1,0,1}},  {/*1*/{ 57, 41, 41, 24},{ 57,173,107,107},{2,0,0,0}},
+  {/*3*/{ 57, 41, 24, 74},{ 57,173,156, 41},{3,1,1,0}},  {/*1*/{ 57, 41, 24, 41},{ 57,189,156, 90},{4,0,0,0}},  {/*3*/{ 57, 41,  8, 90},{ 57,189,206, 24},{5,1,1,0}},  {/*2*/{ 57, 41,  8,  8},{ 57,206,206,140},{6,1,0,0}},
+  {/*1*/{ 57, 41, 41, 57},{ 57,206,123, 74},{7,0,0,0}},  {/*2*/{ 57, 41, 24, 24},{ 57,206,173,123},{8,1,0,0}},  {/*1*/{ 74, 41, 57, 74},{ 74,222, 90, 57},{8,0,0,0}},  {/*1*/{ 74, 41,  8, 41},{ 74,222,222,107},{7,1,1,1}},
+  {/*1*/{ 74, 41,  8, 41},{ 74,239,222,107},{6,0,0,0}},  {/*1*/{ 74, 74, 74, 90},{ 74, 41, 57, 41},{5,0,0,0}},  {/*1*/{ 74, 57, 24,  8},{ 74,156,189,156},{4,0,0,0}},  {/*1*/{ 74, 41, 57,107},{ 74,255,107, 24},{3,0,0,0}},
+  {/*2*/{ 74, 41,  8, 24},{ 74,255,239,140},{2,1,0,0}},  {/*1*/{ 74, 57, 41, 24},{ 74,173,156,140},{1,0,0,1}},  {/*1*/{ 74, 74, 74, 74},{ 74, 74, 74, 74},{0,0,0,0}},  {/*1*/{ 74, 57, 24, 41},{ 74,189,206,123},{1,0,0,0}},
+  {/*1*/{ 74, 74, 90, 90},{ 74, 90, 41, 57},{2,0,0,0}},  {/*1*/{ 74, 57,  8,  8},{ 74,206,255,173},{3,0,0,0}},  {/*1*/{ 74, 74, 41, 57},{ 74,107,173,107},{4,0,0,0}},  {/*2*/{ 74, 57, 24, 24},{ 74,222,222,156},{5,1,0,0}},
+  {/*1*/{ 74, 57, 57, 74},{ 74,222,140, 90},{6,0,0,0}},  {/*3*/{ 74, 57, 41,123},{ 74,222,189, 24},{7,1,1,0}},  {/*1*/{ 74, 57, 41, 41},{ 74,239,189,140},{8,0,0,0}},  {/*1*/{ 90, 74, 74, 90},{ 90,140,107, 74},{7,0,0,0}},
+  {/*1*/{ 90, 57, 24,  8},{ 90,255,239,189},{6,0,0,0}},  {/*1*/{ 90, 74, 90,107},{ 90,156, 74, 57},{5,0,0,0}},  {/*3*/{ 90, 74, 41, 24},{ 90,156,206,173},{4,1,1,0}},  {/*1*/{ 90, 74, 41, 74},{ 90,173,206,107},{3,0,0,0}},
+  {/*2*/{ 90, 74, 24,123},{ 90,173,255, 41},{2,1,0,0}},  {/*2*/{ 90, 74, 57, 41},{ 90,189,173,156},{1,1,0,0}},  {/*1*/{ 90, 74, 90, 90},{ 90,189, 90, 90},{0,0,0,0}},  {/*2*/{ 90, 74, 41,  8},{ 90,189,222,206},{1,1,0,0}},
+  {/*1*/{ 90, 74, 74, 57},{ 90,206,140,140},{2,0,0,0}},  {/*1*/{ 90,107, 57, 24},{ 90,  8,189,189},{3,0,1,0}},  {/*1*/{ 90, 74, 57, 74},{ 90,222,189,123},{4,0,0,0}},  {/*1*/{ 90,107,123,123},{ 90, 24, 24, 57},{5,0,0,0}},
+  {/*2*/{ 90, 74, 41, 41},{ 90,239,239,173},{6,1,0,0}},  {/*1*/{ 90, 74, 74, 90},{ 90,239,156,107},{7,0,0,0}},  {/*2*/{ 90, 74, 57,  8},{ 90,239,206,222},{8,1,0,0}},  {/*1*/{107, 74, 90,107},{107,255,123, 90},{8,0,0,0}},
+  {/*3*/{107, 74, 41, 24},{107,255,255,206},{7,1,1,0}},  {/*1*/{107, 90, 41, 74},{107,173,255,140},{6,0,0,0}},  {/*1*/{107,107,107,123},{107, 74, 90, 74},{5,0,0,0}},  {/*1*/{107, 90, 57, 41},{107,189,222,189},{4,0,0,0}},
+  {/*1*/{107,107, 90,140},{107, 90,140, 57},{3,0,0,0}},  {/*3*/{107, 90, 74,  8},{107,206,189,239},{2,1,1,0}},  {/*1*/{107, 90, 74,  8},{107,206,189,239},{1,0,0,1}},  {/*1*/{107,107,107, 24},{107,107,107,222},{0,0,0,0}},
+  {/*1*/{107, 90, 57, 74},{107,222,239,156},{1,0,0,0}},  {/*1*/{107,107,123,123},{107,123, 74, 90},{2,0,0,0}},  {/*1*/{107, 90, 74, 41},{107,239,206,206},{3,0,1,0}},  {/*1*/{107,107, 74, 90},{107,140,206,140},{4,0,0,0}},
+  {/*2*/{107, 90, 57,  8},{107,255,255,255},{5,1,0,0}},  {/*1*/{107, 90, 90,107},{107,255,173,123},{6,0,0,0}},  {/*2*/{107, 90,156, 24},{107,255,  8,239},{7,1,0,0}},  {/*2*/{107,107, 74, 74},{107,173,222,173},{8,1,0,0}},
+  {/*1*/{123,107,107,123},{123,173,140,107},{7,0,0,0}},  {/*2*/{123,107, 90, 41},{123,173,189,222},{6,1,0,0}},  {/*1*/{123,107,123,140},{123,189,107, 90},{5,0,0,0}},  {/*3*/{123,107, 74, 57},{123,189,239,206},{4,1,1,0}},
+  {/*1*/{123,107, 74,107},{123,206,239,140},{3,0,0,0}},  {/*1*/{123,140,140, 24},{123,  8, 74,255},{2,0,0,0}},  {/*2*/{123,107, 90, 74},{123,222,206,189},{1,1,0,0}},  {/*1*/{123,107,123,123},{123,222,123,123},{0,0,0,0}},
+  {/*2*/{123,107, 74, 41},{123,222,255,239},{1,1,0,0}},  {/*1*/{123,107,107, 90},{123,239,173,173},{2,0,0,0}},  {/*1*/{123,140,173, 57},{123, 41,  8,222},{3,0,0,0}},  {/*1*/{123,107, 90,107},{123,255,222,156},{4,0,0,0}},
+  {/*1*/{123,140,156,156},{123, 57, 57, 90},{5,0,0,0}},  {/*3*/{123,123,107, 74},{123,173,189,206},{6,1,1,0}},  {/*1*/{123,123,107,123},{123,173,189,140},{7,0,0,0}},  {/*2*/{123,123, 90, 41},{123,173,239,255},{8,1,0,0}},
+  {/*1*/{140,123,123,140},{140,189,156,123},{8,0,0,0}},  {/*3*/{140,123,107, 57},{140,189,206,239},{7,1,1,0}},  {/*1*/{140,123,107,107},{140,206,206,173},{6,0,0,0}},  {/*1*/{140,140,140,156},{140,107,123,107},{5,0,0,0}},
+  {/*1*/{140,123, 90, 74},{140,222,255,222},{4,0,0,0}},  {/*1*/{140,140,123,173},{140,123,173, 90},{3,0,0,0}},  {/*2*/{140,123,189, 90},{140,239,  8,206},{2,1,0,0}},  {/*1*/{140,123,107, 57},{140,239,222,255},{1,0,0,1}},
+  {/*1*/{140,140,140, 57},{140,140,140,255},{0,0,0,0}},  {/*1*/{140,123,123,107},{140,255,189,189},{1,0,0,0}},  {/*1*/{140,140,156,156},{140,156,107,123},{2,0,0,0}},  {/*3*/{140,140,107, 74},{140,156,239,239},{3,1,1,0}},
+  {/*1*/{140,140,107,123},{140,173,239,173},{4,0,0,0}},  {/*2*/{140,140,173, 90},{140,173, 74,222},{5,1,0,0}},  {/*1*/{140,140,123,140},{140,189,206,156},{6,0,0,0}},  {/*2*/{140,140,189,189},{140,189, 41, 90},{7,1,0,0}},
+  {/*2*/{140,140,107,107},{140,206,255,206},{8,1,0,0}},  {/*1*/{156,140,140,156},{156,206,173,140},{7,0,0,0}},  {/*2*/{156,140,123, 74},{156,206,222,255},{6,1,0,0}},  {/*1*/{156,140,156,173},{156,222,140,123},{5,0,0,0}},
+  {/*1*/{156,173,140, 90},{156, 24,189,239},{4,0,1,0}},  {/*1*/{156,140,140,140},{156,239,189,173},{3,0,0,0}},  {/*1*/{156,173,173,189},{156, 41,107,107},{2,0,0,0}},  {/*2*/{156,140,123,107},{156,255,239,222},{1,1,0,0}},
+  {/*1*/{156,140,156,156},{156,255,156,156},{0,0,0,0}},  {/*3*/{156,140,140,206},{156,255,206, 90},{1,1,1,0}},  {/*1*/{156,156,140,123},{156,173,206,206},{2,0,0,0}},  {/*1*/{156,173,206, 90},{156, 74, 41,255},{3,0,0,0}},
+  {/*1*/{156,156,123,140},{156,189,255,189},{4,0,0,0}},  {/*1*/{156,173,189,189},{156, 90, 90,123},{5,0,0,0}},  {/*3*/{156,156,140,107},{156,206,222,239},{6,1,1,0}},  {/*1*/{156,156,140,156},{156,206,222,173},{7,0,0,0}},
+  {/*2*/{156,156,206,123},{156,206, 57,222},{8,1,0,0}},  {/*1*/{173,156,156,173},{173,222,189,156},{8,0,0,0}},  {/*2*/{173,156,222,222},{173,222, 24, 90},{7,1,0,0}},  {/*1*/{173,156,140,140},{173,239,239,206},{6,0,0,0}},
+  {/*1*/{173,173,173,189},{173,140,156,140},{5,0,0,0}},  {/*1*/{173,156,156,107},{173,255,206,255},{4,0,1,0}},  {/*1*/{173,173,156,206},{173,156,206,123},{3,0,0,0}},  {/*2*/{173,173,222,123},{173,156, 41,239},{2,1,0,0}},
+  {/*1*/{173,189,140,123},{173, 74,255,239},{1,0,0,1}},  {/*1*/{173,173,173,173},{173,173,173,173},{0,0,0,0}},  {/*2*/{173,173,156,140},{173,173,222,222},{1,1,0,0}},  {/*1*/{173,173,189,189},{173,189,140,156},{2,0,0,0}},
+  {/*3*/{173,173,173,239},{173,189,189, 90},{3,1,1,0}},  {/*1*/{173,173,173,156},{173,206,189,206},{4,0,0,0}},  {/*1*/{173,206,206,123},{173,  8,107,255},{5,0,0,0}},  {/*1*/{173,173,156,173},{173,222,239,189},{6,0,0,0}},
+  {/*1*/{173,206,222,222},{173, 24, 74,123},{7,0,0,0}},  {/*3*/{173,173,173,140},{173,239,206,239},{8,1,1,0}},  {/*1*/{189,173,173,189},{189,239,206,173},{7,0,0,0}},  {/*2*/{189,173,156,156},{189,239,255,222},{6,1,0,0}},
+  {/*1*/{189,173,189,206},{189,255,173,156},{5,0,0,0}},  {/*1*/{189,206,255,255},{189, 57,  8, 90},{4,0,0,0}},  {/*1*/{189,189,173,173},{189,173,222,206},{3,0,0,0}},  {/*1*/{189,206,206,222},{189, 74,140,140},{2,0,0,0}},
+  {/*3*/{189,189,189,140},{189,189,189,255},{1,1,1,0}},  {/*1*/{189,189,189,189},{189,189,189,189},{0,0,0,0}},  {/*2*/{189,189,255,239},{189,189, 24,123},{1,1,0,0}},  {/*1*/{189,189,173,156},{189,206,239,239},{2,0,0,0}},
+  {/*1*/{189,206,239,206},{189,107, 74,173},{3,0,0,0}},  {/*1*/{189,189,189,173},{189,222,206,222},{4,0,0,0}},  {/*1*/{189,206,222,222},{189,123,123,156},{5,0,0,0}},  {/*1*/{189,189,173,189},{189,239,255,206},{6,1,1,1}},
+  {/*1*/{189,189,173,189},{189,239,255,206},{7,0,0,0}},  {/*2*/{189,189,239,156},{189,239, 90,255},{8,1,0,0}},  {/*1*/{206,189,189,206},{206,255,222,189},{8,0,0,0}},  {/*2*/{206,189,255,255},{206,255, 57,123},{7,1,0,0}},
+  {/*3*/{206,206,206,173},{206,173,189,239},{6,1,1,0}},  {/*1*/{206,206,206,222},{206,173,189,173},{5,0,0,0}},  {/*3*/{206,206,189,189},{206,189,239,222},{4,1,1,0}},  {/*1*/{206,206,189,239},{206,189,239,156},{3,0,0,0}},
+  {/*2*/{206,206,255,239},{206,189, 74,156},{2,1,0,1}},  {/*1*/{206,222,206,206},{206,107,206,206},{1,0,1,1}},  {/*1*/{206,206,206,206},{206,206,206,206},{0,0,0,0}},  {/*2*/{206,206,189,173},{206,206,255,255},{1,1,0,0}},
+  {/*1*/{206,206,222,222},{206,222,173,189},{2,0,0,0}},  {/*1*/{206,206,206,189},{206,222,222,239},{3,1,1,1}},  {/*1*/{206,206,206,189},{206,239,222,239},{4,0,0,0}},  {/*1*/{206,239,239,239},{206, 41,140,173},{5,0,0,0}},
+  {/*1*/{206,206,222,206},{206,255,189,222},{6,0,0,0}},  {/*1*/{206,239,255,255},{206, 57,107,156},{7,0,0,0}},  {/*1*/{206,222,206,222},{206,173,239,206},{8,1,1,1}},  {/*1*/{222,222,206,222},{222,173,239,206},{7,0,0,0}},
+  {/*3*/{222,222,206,189},{222,189,239,255},{6,1,1,0}},  {/*1*/{222,222,222,239},{222,189,206,189},{5,0,0,0}},  {/*1*/{222,239,206,206},{222, 90,255,239},{4,0,1,1}},  {/*1*/{222,222,206,206},{222,206,255,239},{3,0,0,0}},
+  {/*1*/{222,239,239,255},{222,107,173,173},{2,0,0,0}},  {/*1*/{222,222,222,222},{222,222,222,222},{1,1,1,1}},  {/*1*/{222,222,222,222},{222,222,222,222},{0,0,0,0}},  {/*1*/{222,222,222,222},{222,222,222,222},{1,1,1,1}},
+  {/*1*/{222,222,239,239},{222,239,189,206},{2,0,0,1}},  {/*1*/{222,239,222,239},{222,140,239,206},{3,0,1,0}},  {/*1*/{222,222,222,206},{222,255,239,255},{4,0,0,0}},  {/*1*/{222,239,255,255},{222,156,156,189},{5,0,0,0}},
+  {/*1*/{222,239,239,222},{222,173,206,239},{6,1,1,1}},  {/*1*/{222,239,239,222},{222,173,206,239},{7,0,0,0}},  {/*1*/{222,239,222,222},{222,189,255,239},{8,1,1,1}},  {/*1*/{239,239,222,239},{239,189,255,222},{8,0,0,0}},
+  {/*1*/{239,239,222,239},{239,189,255,222},{7,1,1,1}},  {/*1*/{239,239,239,255},{239,206,222,206},{6,1,1,1}},  {/*1*/{239,239,239,255},{239,206,222,206},{5,0,0,0}},  {/*3*/{239,239,239,222},{239,222,222,255},{4,1,1,0}},
+  {/*1*/{239,239,255,222},{239,222,189,255},{3,0,0,1}},  {/*1*/{239,239,255,222},{239,222,189,255},{2,1,1,2}},  {/*1*/{239,255,239,239},{239,140,239,239},{1,0,1,1}},  {/*1*/{239,239,239,239},{239,239,239,239},{0,0,0,0}},
+  {/*1*/{239,239,239,239},{239,239,239,239},{1,1,1,1}},  {/*1*/{239,239,255,255},{239,255,206,222},{2,0,0,0}},  {/*1*/{239,239,239,255},{239,255,255,222},{3,1,1,1}},  {/*1*/{239,255,239,239},{239,173,255,255},{4,0,0,2}},
+  {/*1*/{239,255,239,239},{239,189,255,255},{5,1,1,1}},  {/*1*/{239,255,255,239},{239,189,222,255},{6,0,0,0}},  {/*1*/{239,255,255,239},{239,189,222,255},{7,1,1,1}},  {/*1*/{239,255,255,255},{239,206,222,239},{8,1,2,1}},
+  {/*1*/{255,255,255,255},{255,206,239,239},{7,0,2,0}},  {/*1*/{255,255,255,255},{255,222,239,239},{6,1,1,1}},  {/*1*/{255,255,255,255},{255,222,239,239},{5,0,0,2}},  {/*1*/{255,255,255,255},{255,239,239,239},{4,1,1,3}},
+  {/*1*/{255,255,255,255},{255,239,239,255},{3,0,2,3}},  {/*1*/{255,255,255,255},{255,239,255,255},{2,1,2,2}},  {/*1*/{255,255,255,255},{255,255,255,255},{1,1,1,1}},  {/*1*/{255,255,255,255},{255,255,255,255},{0,0,0,0}}
 }
 };
 
@@ -1353,135 +1353,135 @@ static PaletteSingleLookup4 const sp_lookup_4u1_8[4][256] =
 static PaletteSingleLookup4 const sp_lookup_6s1_8[2][256] =
 {
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  0,  0,1},{  0,  8,0},{  0,  4,0},{  0,  4,0}}},  {{/*1*/{  0,  0,2},{  0, 16,0},{  0,  8,0},{  4,  0,0}}},  {{/*1*/{  4,  4,1},{  0, 24,0},{  0, 12,0},{  0,  8,0}}},
-  {{/*1*/{  4,  4,0},{  0, 32,0},{  0, 16,0},{  4,  4,0}}},  {{/*1*/{  4,  4,1},{  0, 36,0},{  0, 20,0},{  0, 12,0}}},  {{/*1*/{  4,  4,2},{  0, 44,0},{  0, 24,0},{  0, 16,0}}},  {{/*1*/{  8,  8,1},{  0, 52,0},{  0, 28,0},{  4, 12,0}}},
-  {{/*1*/{  8,  8,0},{  0, 60,0},{  4, 20,0},{  0, 20,0}}},  {{/*1*/{  8,  8,1},{  0, 64,0},{  0, 32,0},{  4, 16,0}}},  {{/*1*/{  8,  8,2},{  0, 72,0},{  0, 36,0},{  0, 24,0}}},  {{/*1*/{ 12, 12,1},{  0, 80,0},{  0, 40,0},{  0, 28,0}}},
-  {{/*1*/{ 12, 12,0},{  0, 88,0},{  0, 44,0},{  4, 24,0}}},  {{/*1*/{ 12, 12,1},{  0, 96,0},{  0, 48,0},{  0, 32,0}}},  {{/*1*/{ 12, 12,2},{  0,100,0},{  0, 52,0},{  4, 28,0}}},  {{/*1*/{ 16, 16,1},{  0,108,0},{  0, 56,0},{  0, 36,0}}},
-  {{/*1*/{ 16, 16,0},{  0,116,0},{  0, 60,0},{  0, 40,0}}},  {{/*1*/{ 16, 16,1},{  0,124,0},{  4, 52,0},{  4, 36,0}}},  {{/*1*/{ 16, 16,2},{  0,129,0},{  0, 64,0},{  0, 44,0}}},  {{/*1*/{ 20, 20,1},{  0,137,0},{  0, 68,0},{  4, 40,0}}},
-  {{/*1*/{ 20, 20,0},{  0,145,0},{  0, 72,0},{  0, 48,0}}},  {{/*1*/{ 20, 20,1},{  0,153,0},{  0, 76,0},{  0, 52,0}}},  {{/*1*/{ 20, 20,2},{  0,157,0},{  0, 80,0},{  4, 48,0}}},  {{/*1*/{ 24, 24,1},{  0,165,0},{  0, 84,0},{  0, 56,0}}},
-  {{/*1*/{ 24, 24,0},{  0,173,0},{  0, 88,0},{  4, 52,0}}},  {{/*1*/{ 24, 24,1},{  0,181,0},{  0, 92,0},{  0, 60,0}}},  {{/*1*/{ 24, 24,2},{  0,185,0},{  4, 84,0},{  8, 52,0}}},  {{/*1*/{ 28, 28,1},{  0,193,0},{  0, 96,0},{  0, 64,0}}},
-  {{/*1*/{ 28, 28,0},{  0,201,0},{  0,100,0},{  0, 68,0}}},  {{/*1*/{ 28, 28,1},{  0,209,0},{  0,104,0},{  4, 64,0}}},  {{/*1*/{ 28, 28,2},{  0,217,0},{  0,108,0},{  0, 72,0}}},  {{/*1*/{ 32, 32,1},{  0,221,0},{  0,112,0},{  4, 68,0}}},
-  {{/*1*/{ 32, 32,0},{  0,229,0},{  0,116,0},{  0, 76,0}}},  {{/*1*/{ 32, 32,1},{  0,237,0},{  0,120,0},{  0, 80,0}}},  {{/*1*/{ 32, 32,2},{  0,245,0},{  0,124,0},{  4, 76,0}}},  {{/*1*/{ 36, 36,1},{  0,249,0},{  4,116,0},{  0, 84,0}}},
-  {{/*1*/{ 36, 36,0},{  4,233,0},{  0,129,0},{  4, 80,0}}},  {{/*1*/{ 36, 36,1},{  4,241,0},{  0,133,0},{  0, 88,0}}},  {{/*1*/{ 36, 36,2},{  4,249,0},{  0,137,0},{  0, 92,0}}},  {{/*1*/{ 40, 40,1},{  4,253,0},{  0,141,0},{  4, 88,0}}},
-  {{/*1*/{ 40, 40,0},{  8,237,0},{  0,145,0},{  0, 96,0}}},  {{/*1*/{ 40, 40,1},{  8,245,0},{  0,149,0},{  4, 92,0}}},  {{/*1*/{ 40, 40,2},{  8,253,0},{  4,141,0},{  0,100,0}}},  {{/*1*/{ 44, 44,1},{ 12,233,0},{  0,153,0},{  0,104,0}}},
-  {{/*1*/{ 44, 44,0},{ 12,241,0},{  0,157,0},{  4,100,0}}},  {{/*1*/{ 44, 44,1},{ 12,249,0},{  0,161,0},{  0,108,0}}},  {{/*1*/{ 44, 44,2},{ 16,233,0},{  0,165,0},{  4,104,0}}},  {{/*1*/{ 48, 48,1},{ 16,237,0},{  0,169,0},{  0,112,0}}},
-  {{/*1*/{ 48, 48,0},{ 16,245,0},{  0,173,0},{  0,116,0}}},  {{/*1*/{ 48, 48,1},{ 16,253,0},{  0,177,0},{  4,112,0}}},  {{/*1*/{ 48, 48,2},{ 20,237,0},{  0,181,0},{  0,120,0}}},  {{/*1*/{ 52, 52,1},{ 20,241,0},{  4,173,0},{  4,116,0}}},
-  {{/*1*/{ 52, 52,0},{ 20,249,0},{  0,185,0},{  0,124,0}}},  {{/*1*/{ 52, 52,1},{ 24,233,0},{  0,189,0},{  8,116,0}}},  {{/*1*/{ 52, 52,2},{ 24,241,0},{  0,193,0},{  0,129,0}}},  {{/*1*/{ 56, 56,1},{ 24,245,0},{  0,197,0},{  8,120,0}}},
-  {{/*1*/{ 56, 56,0},{ 24,253,0},{  0,201,0},{  0,133,0}}},  {{/*1*/{ 56, 56,1},{ 28,237,0},{  0,205,0},{  0,137,0}}},  {{/*1*/{ 56, 56,2},{ 28,245,0},{  0,209,0},{  4,133,0}}},  {{/*1*/{ 60, 60,1},{ 28,249,0},{  0,213,0},{  0,141,0}}},
-  {{/*1*/{ 60, 60,0},{ 32,233,0},{  4,205,0},{  4,137,0}}},  {{/*1*/{ 60, 60,1},{ 32,241,0},{  0,217,0},{  0,145,0}}},  {{/*1*/{ 60, 60,2},{ 32,249,0},{  0,221,0},{  0,149,0}}},  {{/*1*/{ 64, 64,1},{ 32,253,0},{  0,225,0},{  4,145,0}}},
-  {{/*1*/{ 64, 64,0},{ 36,237,0},{  0,229,0},{  0,153,0}}},  {{/*1*/{ 64, 64,1},{ 36,245,0},{  0,233,0},{  4,149,0}}},  {{/*1*/{ 64, 64,2},{ 36,253,0},{  0,237,0},{  0,157,0}}},  {{/*1*/{ 68, 68,1},{ 40,233,0},{  0,241,0},{  0,161,0}}},
-  {{/*1*/{ 68, 68,0},{ 40,241,0},{  0,245,0},{  4,157,0}}},  {{/*1*/{ 68, 68,1},{ 40,249,0},{  4,237,0},{  0,165,0}}},  {{/*1*/{ 68, 68,2},{ 44,229,0},{  0,249,0},{  4,161,0}}},  {{/*1*/{ 72, 72,1},{ 44,237,0},{  0,253,0},{  0,169,0}}},
-  {{/*1*/{ 72, 72,0},{ 44,245,0},{  4,249,0},{  0,173,0}}},  {{/*1*/{ 72, 72,1},{ 44,253,0},{  8,241,0},{  4,169,0}}},  {{/*1*/{ 72, 72,2},{ 48,233,0},{  4,253,0},{  0,177,0}}},  {{/*1*/{ 76, 76,1},{ 48,241,0},{  8,249,0},{  4,173,0}}},
-  {{/*1*/{ 76, 76,0},{ 48,249,0},{  8,253,0},{  0,181,0}}},  {{/*1*/{ 76, 76,1},{ 52,233,0},{ 12,245,0},{  8,173,0}}},  {{/*1*/{ 76, 76,2},{ 52,237,0},{ 12,249,0},{  0,185,0}}},  {{/*1*/{ 80, 80,1},{ 52,245,0},{ 12,253,0},{  0,189,0}}},
-  {{/*1*/{ 80, 80,0},{ 52,253,0},{ 16,245,0},{  4,185,0}}},  {{/*1*/{ 80, 80,1},{ 56,237,0},{ 16,249,0},{  0,193,0}}},  {{/*1*/{ 80, 80,2},{ 56,241,0},{ 16,253,0},{  4,189,0}}},  {{/*1*/{ 84, 84,1},{ 56,249,0},{ 20,245,0},{  0,197,0}}},
-  {{/*1*/{ 84, 84,0},{ 60,233,0},{ 20,249,0},{  0,201,0}}},  {{/*1*/{ 84, 84,1},{ 60,241,0},{ 20,253,0},{  4,197,0}}},  {{/*1*/{ 84, 84,2},{ 60,245,0},{ 24,245,0},{  0,205,0}}},  {{/*1*/{ 88, 88,1},{ 60,253,0},{ 24,249,0},{  4,201,0}}},
-  {{/*1*/{ 88, 88,0},{ 64,237,0},{ 24,253,0},{  0,209,0}}},  {{/*1*/{ 88, 88,1},{ 64,245,0},{ 28,245,0},{  0,213,0}}},  {{/*1*/{ 88, 88,2},{ 64,249,0},{ 28,249,0},{  4,209,0}}},  {{/*1*/{ 92, 92,1},{ 68,233,0},{ 28,253,0},{  0,217,0}}},
-  {{/*1*/{ 92, 92,0},{ 68,241,0},{ 36,237,0},{  4,213,0}}},  {{/*1*/{ 92, 92,1},{ 68,249,0},{ 32,249,0},{  0,221,0}}},  {{/*1*/{ 92, 92,2},{ 68,253,0},{ 32,253,0},{  0,225,0}}},  {{/*1*/{ 96, 96,1},{ 72,237,0},{ 36,249,0},{  4,221,0}}},
-  {{/*1*/{ 96, 96,0},{ 72,245,0},{ 40,241,0},{  0,229,0}}},  {{/*1*/{ 96, 96,1},{ 72,253,0},{ 36,253,0},{  4,225,0}}},  {{/*1*/{ 96, 96,2},{ 76,233,0},{ 40,249,0},{  0,233,0}}},  {{/*1*/{100,100,1},{ 76,241,0},{ 40,253,0},{  0,237,0}}},
-  {{/*1*/{100,100,0},{ 76,249,0},{ 44,245,0},{  4,233,0}}},  {{/*1*/{100,100,1},{ 80,233,0},{ 44,249,0},{  0,241,0}}},  {{/*1*/{100,100,2},{ 80,237,0},{ 44,253,0},{  4,237,0}}},  {{/*1*/{104,104,1},{ 80,245,0},{ 48,245,0},{  0,245,0}}},
-  {{/*1*/{104,104,0},{ 80,253,0},{ 48,249,0},{  8,237,0}}},  {{/*1*/{104,104,1},{ 84,237,0},{ 48,253,0},{  0,249,0}}},  {{/*1*/{104,104,2},{ 84,241,0},{ 52,245,0},{  0,253,0}}},  {{/*1*/{108,108,1},{ 84,249,0},{ 52,249,0},{  4,249,0}}},
-  {{/*1*/{108,108,0},{ 88,233,0},{ 52,253,0},{ 12,241,0}}},  {{/*1*/{108,108,1},{ 88,241,0},{ 56,245,0},{  4,253,0}}},  {{/*1*/{108,108,2},{ 88,245,0},{ 56,249,0},{ 12,245,0}}},  {{/*1*/{112,112,1},{ 88,253,0},{ 56,253,0},{  8,253,0}}},
-  {{/*1*/{112,112,0},{ 92,237,0},{ 60,245,0},{ 16,245,0}}},  {{/*1*/{112,112,1},{ 92,245,0},{ 60,249,0},{ 12,253,0}}},  {{/*1*/{112,112,2},{ 92,249,0},{ 60,253,0},{ 16,249,0}}},  {{/*1*/{116,116,1},{ 96,233,0},{ 68,237,0},{ 16,253,0}}},
-  {{/*1*/{116,116,0},{ 96,241,0},{ 64,249,0},{ 20,249,0}}},  {{/*1*/{116,116,1},{ 96,249,0},{ 64,253,0},{ 24,245,0}}},  {{/*1*/{116,116,2},{ 96,253,0},{ 68,249,0},{ 20,253,0}}},  {{/*1*/{120,120,1},{100,237,0},{ 72,241,0},{ 28,245,0}}},
-  {{/*1*/{120,120,0},{100,245,0},{ 68,253,0},{ 24,253,0}}},  {{/*1*/{120,120,1},{100,253,0},{ 72,249,0},{ 28,249,0}}},  {{/*1*/{120,120,2},{104,233,0},{ 72,253,0},{ 28,253,0}}},  {{/*1*/{124,124,1},{104,241,0},{ 76,245,0},{ 32,249,0}}},
-  {{/*1*/{124,124,0},{104,249,0},{ 76,249,0},{ 36,245,0}}},  {{/*1*/{124,124,1},{108,229,0},{ 76,253,0},{ 32,253,0}}},  {{/*1*/{124,124,2},{108,237,0},{ 80,245,0},{ 40,245,0}}},  {{/*1*/{129,129,2},{108,245,0},{ 80,249,0},{ 36,253,0}}},
-  {{/*1*/{129,129,1},{108,253,0},{ 80,253,0},{ 40,249,0}}},  {{/*1*/{129,129,0},{112,233,0},{ 84,245,0},{ 40,253,0}}},  {{/*1*/{129,129,1},{112,241,0},{ 84,249,0},{ 44,249,0}}},  {{/*1*/{129,129,2},{112,249,0},{ 84,253,0},{ 48,245,0}}},
-  {{/*1*/{133,133,1},{116,233,0},{ 88,245,0},{ 44,253,0}}},  {{/*1*/{133,133,0},{116,237,0},{ 88,249,0},{ 52,245,0}}},  {{/*1*/{133,133,1},{116,245,0},{ 88,253,0},{ 48,253,0}}},  {{/*1*/{133,133,2},{116,253,0},{ 92,245,0},{ 52,249,0}}},
-  {{/*1*/{137,137,1},{120,237,0},{ 92,249,0},{ 52,253,0}}},  {{/*1*/{137,137,0},{120,241,0},{ 92,253,0},{ 56,249,0}}},  {{/*1*/{137,137,1},{120,249,0},{100,237,0},{ 60,245,0}}},  {{/*1*/{137,137,2},{124,233,0},{ 96,249,0},{ 56,253,0}}},
-  {{/*1*/{141,141,1},{124,241,0},{ 96,253,0},{ 64,245,0}}},  {{/*1*/{141,141,0},{124,245,0},{100,249,0},{ 60,253,0}}},  {{/*1*/{141,141,1},{124,253,0},{104,241,0},{ 64,249,0}}},  {{/*1*/{141,141,2},{129,229,0},{100,253,0},{ 64,253,0}}},
-  {{/*1*/{145,145,1},{129,237,0},{104,249,0},{ 68,249,0}}},  {{/*1*/{145,145,0},{129,245,0},{104,253,0},{ 76,241,0}}},  {{/*1*/{145,145,1},{129,253,0},{108,245,0},{ 68,253,0}}},  {{/*1*/{145,145,2},{133,233,0},{108,249,0},{ 76,245,0}}},
-  {{/*1*/{149,149,1},{133,241,0},{108,253,0},{ 72,253,0}}},  {{/*1*/{149,149,0},{133,249,0},{112,245,0},{ 80,245,0}}},  {{/*1*/{149,149,1},{137,233,0},{112,249,0},{ 76,253,0}}},  {{/*1*/{149,149,2},{137,237,0},{112,253,0},{ 80,249,0}}},
-  {{/*1*/{153,153,1},{137,245,0},{116,245,0},{ 80,253,0}}},  {{/*1*/{153,153,0},{137,253,0},{116,249,0},{ 84,249,0}}},  {{/*1*/{153,153,1},{141,237,0},{116,253,0},{ 88,245,0}}},  {{/*1*/{153,153,2},{141,241,0},{120,245,0},{ 84,253,0}}},
-  {{/*1*/{157,157,1},{141,249,0},{120,249,0},{ 92,245,0}}},  {{/*1*/{157,157,0},{145,233,0},{120,253,0},{ 88,253,0}}},  {{/*1*/{157,157,1},{145,241,0},{124,245,0},{ 92,249,0}}},  {{/*1*/{157,157,2},{145,245,0},{124,249,0},{ 92,253,0}}},
-  {{/*1*/{161,161,1},{145,253,0},{124,253,0},{ 96,249,0}}},  {{/*1*/{161,161,0},{149,237,0},{129,245,0},{100,245,0}}},  {{/*1*/{161,161,1},{149,245,0},{129,249,0},{ 96,253,0}}},  {{/*1*/{161,161,2},{149,249,0},{129,253,0},{104,245,0}}},
-  {{/*1*/{165,165,1},{153,233,0},{133,245,0},{100,253,0}}},  {{/*1*/{165,165,0},{153,241,0},{133,249,0},{104,249,0}}},  {{/*1*/{165,165,1},{153,249,0},{133,253,0},{104,253,0}}},  {{/*1*/{165,165,2},{153,253,0},{137,245,0},{108,249,0}}},
-  {{/*1*/{169,169,1},{157,237,0},{137,249,0},{112,245,0}}},  {{/*1*/{169,169,0},{157,245,0},{137,253,0},{108,253,0}}},  {{/*1*/{169,169,1},{157,253,0},{141,245,0},{116,245,0}}},  {{/*1*/{169,169,2},{161,233,0},{141,249,0},{112,253,0}}},
-  {{/*1*/{173,173,1},{161,241,0},{141,253,0},{116,249,0}}},  {{/*1*/{173,173,0},{161,249,0},{145,245,0},{116,253,0}}},  {{/*1*/{173,173,1},{165,229,0},{145,249,0},{120,249,0}}},  {{/*1*/{173,173,2},{165,237,0},{145,253,0},{124,245,0}}},
-  {{/*1*/{177,177,1},{165,245,0},{149,245,0},{120,253,0}}},  {{/*1*/{177,177,0},{165,253,0},{149,249,0},{129,245,0}}},  {{/*1*/{177,177,1},{169,233,0},{149,253,0},{124,253,0}}},  {{/*1*/{177,177,2},{169,241,0},{157,237,0},{129,249,0}}},
-  {{/*1*/{181,181,1},{169,249,0},{153,249,0},{133,245,0}}},  {{/*1*/{181,181,0},{173,233,0},{153,253,0},{129,253,0}}},  {{/*1*/{181,181,1},{173,237,0},{157,249,0},{137,245,0}}},  {{/*1*/{181,181,2},{173,245,0},{161,241,0},{133,253,0}}},
-  {{/*1*/{185,185,1},{173,253,0},{157,253,0},{137,249,0}}},  {{/*1*/{185,185,0},{177,237,0},{161,249,0},{137,253,0}}},  {{/*1*/{185,185,1},{177,241,0},{161,253,0},{141,249,0}}},  {{/*1*/{185,185,2},{177,249,0},{165,245,0},{145,245,0}}},
-  {{/*1*/{189,189,1},{181,233,0},{165,249,0},{141,253,0}}},  {{/*1*/{189,189,0},{181,241,0},{165,253,0},{149,245,0}}},  {{/*1*/{189,189,1},{181,245,0},{169,245,0},{145,253,0}}},  {{/*1*/{189,189,2},{181,253,0},{169,249,0},{149,249,0}}},
-  {{/*1*/{193,193,1},{185,237,0},{169,253,0},{149,253,0}}},  {{/*1*/{193,193,0},{185,245,0},{173,245,0},{153,249,0}}},  {{/*1*/{193,193,1},{185,249,0},{173,249,0},{157,245,0}}},  {{/*1*/{193,193,2},{189,233,0},{173,253,0},{153,253,0}}},
-  {{/*1*/{197,197,1},{189,241,0},{177,245,0},{161,245,0}}},  {{/*1*/{197,197,0},{189,249,0},{177,249,0},{157,253,0}}},  {{/*1*/{197,197,1},{189,253,0},{177,253,0},{161,249,0}}},  {{/*1*/{197,197,2},{193,237,0},{181,245,0},{161,253,0}}},
-  {{/*1*/{201,201,1},{193,245,0},{181,249,0},{165,249,0}}},  {{/*1*/{201,201,0},{193,253,0},{181,253,0},{169,245,0}}},  {{/*1*/{201,201,1},{197,233,0},{189,237,0},{165,253,0}}},  {{/*1*/{201,201,2},{197,241,0},{185,249,0},{173,245,0}}},
-  {{/*1*/{205,205,1},{197,249,0},{185,253,0},{169,253,0}}},  {{/*1*/{205,205,0},{201,233,0},{189,249,0},{173,249,0}}},  {{/*1*/{205,205,1},{201,237,0},{193,241,0},{173,253,0}}},  {{/*1*/{205,205,2},{201,245,0},{189,253,0},{177,249,0}}},
-  {{/*1*/{209,209,1},{201,253,0},{193,249,0},{181,245,0}}},  {{/*1*/{209,209,0},{205,237,0},{193,253,0},{177,253,0}}},  {{/*1*/{209,209,1},{205,241,0},{197,245,0},{185,245,0}}},  {{/*1*/{209,209,2},{205,249,0},{197,249,0},{181,253,0}}},
-  {{/*1*/{213,213,1},{209,233,0},{197,253,0},{185,249,0}}},  {{/*1*/{213,213,0},{209,241,0},{201,245,0},{185,253,0}}},  {{/*1*/{213,213,1},{209,245,0},{201,249,0},{189,249,0}}},  {{/*1*/{213,213,2},{209,253,0},{201,253,0},{197,241,0}}},
-  {{/*1*/{217,217,1},{213,237,0},{205,245,0},{189,253,0}}},  {{/*1*/{217,217,0},{213,245,0},{205,249,0},{197,245,0}}},  {{/*1*/{217,217,1},{213,249,0},{205,253,0},{193,253,0}}},  {{/*1*/{217,217,2},{217,233,0},{209,245,0},{201,245,0}}},
-  {{/*1*/{221,221,1},{217,241,0},{209,249,0},{197,253,0}}},  {{/*1*/{221,221,0},{217,249,0},{209,253,0},{201,249,0}}},  {{/*1*/{221,221,1},{217,253,0},{213,245,0},{201,253,0}}},  {{/*1*/{221,221,2},{221,237,0},{213,249,0},{205,249,0}}},
-  {{/*1*/{225,225,1},{221,245,0},{213,253,0},{209,245,0}}},  {{/*1*/{225,225,0},{221,253,0},{221,237,0},{205,253,0}}},  {{/*1*/{225,225,1},{225,233,0},{217,249,0},{213,245,0}}},  {{/*1*/{225,225,2},{225,241,0},{217,253,0},{209,253,0}}},
-  {{/*1*/{229,229,1},{225,249,0},{221,249,0},{213,249,0}}},  {{/*1*/{229,229,0},{229,229,0},{225,241,0},{213,253,0}}},  {{/*1*/{229,229,1},{229,237,0},{221,253,0},{217,249,0}}},  {{/*1*/{229,229,2},{229,245,0},{225,249,0},{221,245,0}}},
-  {{/*1*/{233,233,1},{229,253,0},{225,253,0},{217,253,0}}},  {{/*1*/{233,233,0},{233,233,0},{229,245,0},{225,245,0}}},  {{/*1*/{233,233,1},{233,241,0},{229,249,0},{221,253,0}}},  {{/*1*/{233,233,2},{233,249,0},{229,253,0},{225,249,0}}},
-  {{/*1*/{237,237,1},{237,233,0},{233,245,0},{225,253,0}}},  {{/*1*/{237,237,0},{237,237,0},{233,249,0},{229,249,0}}},  {{/*1*/{237,237,1},{237,245,0},{233,253,0},{233,245,0}}},  {{/*1*/{237,237,2},{237,253,0},{237,245,0},{229,253,0}}},
-  {{/*1*/{241,241,1},{241,237,0},{237,249,0},{237,245,0}}},  {{/*1*/{241,241,0},{241,241,0},{237,253,0},{233,253,0}}},  {{/*1*/{241,241,1},{241,249,0},{241,245,0},{237,249,0}}},  {{/*1*/{241,241,2},{245,237,0},{241,249,0},{237,253,0}}},
-  {{/*1*/{245,245,1},{245,241,0},{241,253,0},{241,249,0}}},  {{/*1*/{245,245,0},{245,245,0},{245,245,0},{245,245,0}}},  {{/*1*/{245,245,1},{245,253,0},{245,249,0},{241,253,0}}},  {{/*1*/{245,245,2},{249,241,0},{245,253,0},{249,245,0}}},
-  {{/*1*/{249,249,1},{249,245,0},{253,237,0},{245,253,0}}},  {{/*1*/{249,249,0},{249,249,0},{249,249,0},{249,249,0}}},  {{/*1*/{249,249,1},{253,237,0},{249,253,0},{249,253,0}}},  {{/*1*/{249,249,2},{253,245,0},{253,249,0},{253,249,0}}},
-  {{/*1*/{253,253,1},{253,249,0},{253,253,1},{253,253,1}}},  {{/*1*/{253,253,0},{253,253,0},{253,253,0},{253,253,0}}},  {{/*1*/{253,253,1},{253,253,1},{253,253,1},{253,253,1}}},  {{/*1*/{253,253,2},{253,253,2},{253,253,2},{253,253,2}}}
+  {/*1*/{  0,  0,  0,  0},{  0,  0,  0,  0},{0,0,0,0}},  {/*1*/{  0,  0,  0,  0},{  0,  8,  4,  4},{1,0,0,0}},  {/*1*/{  0,  0,  0,  4},{  0, 16,  8,  0},{2,0,0,0}},  {/*1*/{  4,  0,  0,  0},{  4, 24, 12,  8},{1,0,0,0}},
+  {/*1*/{  4,  0,  0,  4},{  4, 32, 16,  4},{0,0,0,0}},  {/*1*/{  4,  0,  0,  0},{  4, 36, 20, 12},{1,0,0,0}},  {/*1*/{  4,  0,  0,  0},{  4, 44, 24, 16},{2,0,0,0}},  {/*1*/{  8,  0,  0,  4},{  8, 52, 28, 12},{1,0,0,0}},
+  {/*1*/{  8,  0,  4,  0},{  8, 60, 20, 20},{0,0,0,0}},  {/*1*/{  8,  0,  0,  4},{  8, 64, 32, 16},{1,0,0,0}},  {/*1*/{  8,  0,  0,  0},{  8, 72, 36, 24},{2,0,0,0}},  {/*1*/{ 12,  0,  0,  0},{ 12, 80, 40, 28},{1,0,0,0}},
+  {/*1*/{ 12,  0,  0,  4},{ 12, 88, 44, 24},{0,0,0,0}},  {/*1*/{ 12,  0,  0,  0},{ 12, 96, 48, 32},{1,0,0,0}},  {/*1*/{ 12,  0,  0,  4},{ 12,100, 52, 28},{2,0,0,0}},  {/*1*/{ 16,  0,  0,  0},{ 16,108, 56, 36},{1,0,0,0}},
+  {/*1*/{ 16,  0,  0,  0},{ 16,116, 60, 40},{0,0,0,0}},  {/*1*/{ 16,  0,  4,  4},{ 16,124, 52, 36},{1,0,0,0}},  {/*1*/{ 16,  0,  0,  0},{ 16,129, 64, 44},{2,0,0,0}},  {/*1*/{ 20,  0,  0,  4},{ 20,137, 68, 40},{1,0,0,0}},
+  {/*1*/{ 20,  0,  0,  0},{ 20,145, 72, 48},{0,0,0,0}},  {/*1*/{ 20,  0,  0,  0},{ 20,153, 76, 52},{1,0,0,0}},  {/*1*/{ 20,  0,  0,  4},{ 20,157, 80, 48},{2,0,0,0}},  {/*1*/{ 24,  0,  0,  0},{ 24,165, 84, 56},{1,0,0,0}},
+  {/*1*/{ 24,  0,  0,  4},{ 24,173, 88, 52},{0,0,0,0}},  {/*1*/{ 24,  0,  0,  0},{ 24,181, 92, 60},{1,0,0,0}},  {/*1*/{ 24,  0,  4,  8},{ 24,185, 84, 52},{2,0,0,0}},  {/*1*/{ 28,  0,  0,  0},{ 28,193, 96, 64},{1,0,0,0}},
+  {/*1*/{ 28,  0,  0,  0},{ 28,201,100, 68},{0,0,0,0}},  {/*1*/{ 28,  0,  0,  4},{ 28,209,104, 64},{1,0,0,0}},  {/*1*/{ 28,  0,  0,  0},{ 28,217,108, 72},{2,0,0,0}},  {/*1*/{ 32,  0,  0,  4},{ 32,221,112, 68},{1,0,0,0}},
+  {/*1*/{ 32,  0,  0,  0},{ 32,229,116, 76},{0,0,0,0}},  {/*1*/{ 32,  0,  0,  0},{ 32,237,120, 80},{1,0,0,0}},  {/*1*/{ 32,  0,  0,  4},{ 32,245,124, 76},{2,0,0,0}},  {/*1*/{ 36,  0,  4,  0},{ 36,249,116, 84},{1,0,0,0}},
+  {/*1*/{ 36,  4,  0,  4},{ 36,233,129, 80},{0,0,0,0}},  {/*1*/{ 36,  4,  0,  0},{ 36,241,133, 88},{1,0,0,0}},  {/*1*/{ 36,  4,  0,  0},{ 36,249,137, 92},{2,0,0,0}},  {/*1*/{ 40,  4,  0,  4},{ 40,253,141, 88},{1,0,0,0}},
+  {/*1*/{ 40,  8,  0,  0},{ 40,237,145, 96},{0,0,0,0}},  {/*1*/{ 40,  8,  0,  4},{ 40,245,149, 92},{1,0,0,0}},  {/*1*/{ 40,  8,  4,  0},{ 40,253,141,100},{2,0,0,0}},  {/*1*/{ 44, 12,  0,  0},{ 44,233,153,104},{1,0,0,0}},
+  {/*1*/{ 44, 12,  0,  4},{ 44,241,157,100},{0,0,0,0}},  {/*1*/{ 44, 12,  0,  0},{ 44,249,161,108},{1,0,0,0}},  {/*1*/{ 44, 16,  0,  4},{ 44,233,165,104},{2,0,0,0}},  {/*1*/{ 48, 16,  0,  0},{ 48,237,169,112},{1,0,0,0}},
+  {/*1*/{ 48, 16,  0,  0},{ 48,245,173,116},{0,0,0,0}},  {/*1*/{ 48, 16,  0,  4},{ 48,253,177,112},{1,0,0,0}},  {/*1*/{ 48, 20,  0,  0},{ 48,237,181,120},{2,0,0,0}},  {/*1*/{ 52, 20,  4,  4},{ 52,241,173,116},{1,0,0,0}},
+  {/*1*/{ 52, 20,  0,  0},{ 52,249,185,124},{0,0,0,0}},  {/*1*/{ 52, 24,  0,  8},{ 52,233,189,116},{1,0,0,0}},  {/*1*/{ 52, 24,  0,  0},{ 52,241,193,129},{2,0,0,0}},  {/*1*/{ 56, 24,  0,  8},{ 56,245,197,120},{1,0,0,0}},
+  {/*1*/{ 56, 24,  0,  0},{ 56,253,201,133},{0,0,0,0}},  {/*1*/{ 56, 28,  0,  0},{ 56,237,205,137},{1,0,0,0}},  {/*1*/{ 56, 28,  0,  4},{ 56,245,209,133},{2,0,0,0}},  {/*1*/{ 60, 28,  0,  0},{ 60,249,213,141},{1,0,0,0}},
+  {/*1*/{ 60, 32,  4,  4},{ 60,233,205,137},{0,0,0,0}},  {/*1*/{ 60, 32,  0,  0},{ 60,241,217,145},{1,0,0,0}},  {/*1*/{ 60, 32,  0,  0},{ 60,249,221,149},{2,0,0,0}},  {/*1*/{ 64, 32,  0,  4},{ 64,253,225,145},{1,0,0,0}},
+  {/*1*/{ 64, 36,  0,  0},{ 64,237,229,153},{0,0,0,0}},  {/*1*/{ 64, 36,  0,  4},{ 64,245,233,149},{1,0,0,0}},  {/*1*/{ 64, 36,  0,  0},{ 64,253,237,157},{2,0,0,0}},  {/*1*/{ 68, 40,  0,  0},{ 68,233,241,161},{1,0,0,0}},
+  {/*1*/{ 68, 40,  0,  4},{ 68,241,245,157},{0,0,0,0}},  {/*1*/{ 68, 40,  4,  0},{ 68,249,237,165},{1,0,0,0}},  {/*1*/{ 68, 44,  0,  4},{ 68,229,249,161},{2,0,0,0}},  {/*1*/{ 72, 44,  0,  0},{ 72,237,253,169},{1,0,0,0}},
+  {/*1*/{ 72, 44,  4,  0},{ 72,245,249,173},{0,0,0,0}},  {/*1*/{ 72, 44,  8,  4},{ 72,253,241,169},{1,0,0,0}},  {/*1*/{ 72, 48,  4,  0},{ 72,233,253,177},{2,0,0,0}},  {/*1*/{ 76, 48,  8,  4},{ 76,241,249,173},{1,0,0,0}},
+  {/*1*/{ 76, 48,  8,  0},{ 76,249,253,181},{0,0,0,0}},  {/*1*/{ 76, 52, 12,  8},{ 76,233,245,173},{1,0,0,0}},  {/*1*/{ 76, 52, 12,  0},{ 76,237,249,185},{2,0,0,0}},  {/*1*/{ 80, 52, 12,  0},{ 80,245,253,189},{1,0,0,0}},
+  {/*1*/{ 80, 52, 16,  4},{ 80,253,245,185},{0,0,0,0}},  {/*1*/{ 80, 56, 16,  0},{ 80,237,249,193},{1,0,0,0}},  {/*1*/{ 80, 56, 16,  4},{ 80,241,253,189},{2,0,0,0}},  {/*1*/{ 84, 56, 20,  0},{ 84,249,245,197},{1,0,0,0}},
+  {/*1*/{ 84, 60, 20,  0},{ 84,233,249,201},{0,0,0,0}},  {/*1*/{ 84, 60, 20,  4},{ 84,241,253,197},{1,0,0,0}},  {/*1*/{ 84, 60, 24,  0},{ 84,245,245,205},{2,0,0,0}},  {/*1*/{ 88, 60, 24,  4},{ 88,253,249,201},{1,0,0,0}},
+  {/*1*/{ 88, 64, 24,  0},{ 88,237,253,209},{0,0,0,0}},  {/*1*/{ 88, 64, 28,  0},{ 88,245,245,213},{1,0,0,0}},  {/*1*/{ 88, 64, 28,  4},{ 88,249,249,209},{2,0,0,0}},  {/*1*/{ 92, 68, 28,  0},{ 92,233,253,217},{1,0,0,0}},
+  {/*1*/{ 92, 68, 36,  4},{ 92,241,237,213},{0,0,0,0}},  {/*1*/{ 92, 68, 32,  0},{ 92,249,249,221},{1,0,0,0}},  {/*1*/{ 92, 68, 32,  0},{ 92,253,253,225},{2,0,0,0}},  {/*1*/{ 96, 72, 36,  4},{ 96,237,249,221},{1,0,0,0}},
+  {/*1*/{ 96, 72, 40,  0},{ 96,245,241,229},{0,0,0,0}},  {/*1*/{ 96, 72, 36,  4},{ 96,253,253,225},{1,0,0,0}},  {/*1*/{ 96, 76, 40,  0},{ 96,233,249,233},{2,0,0,0}},  {/*1*/{100, 76, 40,  0},{100,241,253,237},{1,0,0,0}},
+  {/*1*/{100, 76, 44,  4},{100,249,245,233},{0,0,0,0}},  {/*1*/{100, 80, 44,  0},{100,233,249,241},{1,0,0,0}},  {/*1*/{100, 80, 44,  4},{100,237,253,237},{2,0,0,0}},  {/*1*/{104, 80, 48,  0},{104,245,245,245},{1,0,0,0}},
+  {/*1*/{104, 80, 48,  8},{104,253,249,237},{0,0,0,0}},  {/*1*/{104, 84, 48,  0},{104,237,253,249},{1,0,0,0}},  {/*1*/{104, 84, 52,  0},{104,241,245,253},{2,0,0,0}},  {/*1*/{108, 84, 52,  4},{108,249,249,249},{1,0,0,0}},
+  {/*1*/{108, 88, 52, 12},{108,233,253,241},{0,0,0,0}},  {/*1*/{108, 88, 56,  4},{108,241,245,253},{1,0,0,0}},  {/*1*/{108, 88, 56, 12},{108,245,249,245},{2,0,0,0}},  {/*1*/{112, 88, 56,  8},{112,253,253,253},{1,0,0,0}},
+  {/*1*/{112, 92, 60, 16},{112,237,245,245},{0,0,0,0}},  {/*1*/{112, 92, 60, 12},{112,245,249,253},{1,0,0,0}},  {/*1*/{112, 92, 60, 16},{112,249,253,249},{2,0,0,0}},  {/*1*/{116, 96, 68, 16},{116,233,237,253},{1,0,0,0}},
+  {/*1*/{116, 96, 64, 20},{116,241,249,249},{0,0,0,0}},  {/*1*/{116, 96, 64, 24},{116,249,253,245},{1,0,0,0}},  {/*1*/{116, 96, 68, 20},{116,253,249,253},{2,0,0,0}},  {/*1*/{120,100, 72, 28},{120,237,241,245},{1,0,0,0}},
+  {/*1*/{120,100, 68, 24},{120,245,253,253},{0,0,0,0}},  {/*1*/{120,100, 72, 28},{120,253,249,249},{1,0,0,0}},  {/*1*/{120,104, 72, 28},{120,233,253,253},{2,0,0,0}},  {/*1*/{124,104, 76, 32},{124,241,245,249},{1,0,0,0}},
+  {/*1*/{124,104, 76, 36},{124,249,249,245},{0,0,0,0}},  {/*1*/{124,108, 76, 32},{124,229,253,253},{1,0,0,0}},  {/*1*/{124,108, 80, 40},{124,237,245,245},{2,0,0,0}},  {/*1*/{129,108, 80, 36},{129,245,249,253},{2,0,0,0}},
+  {/*1*/{129,108, 80, 40},{129,253,253,249},{1,0,0,0}},  {/*1*/{129,112, 84, 40},{129,233,245,253},{0,0,0,0}},  {/*1*/{129,112, 84, 44},{129,241,249,249},{1,0,0,0}},  {/*1*/{129,112, 84, 48},{129,249,253,245},{2,0,0,0}},
+  {/*1*/{133,116, 88, 44},{133,233,245,253},{1,0,0,0}},  {/*1*/{133,116, 88, 52},{133,237,249,245},{0,0,0,0}},  {/*1*/{133,116, 88, 48},{133,245,253,253},{1,0,0,0}},  {/*1*/{133,116, 92, 52},{133,253,245,249},{2,0,0,0}},
+  {/*1*/{137,120, 92, 52},{137,237,249,253},{1,0,0,0}},  {/*1*/{137,120, 92, 56},{137,241,253,249},{0,0,0,0}},  {/*1*/{137,120,100, 60},{137,249,237,245},{1,0,0,0}},  {/*1*/{137,124, 96, 56},{137,233,249,253},{2,0,0,0}},
+  {/*1*/{141,124, 96, 64},{141,241,253,245},{1,0,0,0}},  {/*1*/{141,124,100, 60},{141,245,249,253},{0,0,0,0}},  {/*1*/{141,124,104, 64},{141,253,241,249},{1,0,0,0}},  {/*1*/{141,129,100, 64},{141,229,253,253},{2,0,0,0}},
+  {/*1*/{145,129,104, 68},{145,237,249,249},{1,0,0,0}},  {/*1*/{145,129,104, 76},{145,245,253,241},{0,0,0,0}},  {/*1*/{145,129,108, 68},{145,253,245,253},{1,0,0,0}},  {/*1*/{145,133,108, 76},{145,233,249,245},{2,0,0,0}},
+  {/*1*/{149,133,108, 72},{149,241,253,253},{1,0,0,0}},  {/*1*/{149,133,112, 80},{149,249,245,245},{0,0,0,0}},  {/*1*/{149,137,112, 76},{149,233,249,253},{1,0,0,0}},  {/*1*/{149,137,112, 80},{149,237,253,249},{2,0,0,0}},
+  {/*1*/{153,137,116, 80},{153,245,245,253},{1,0,0,0}},  {/*1*/{153,137,116, 84},{153,253,249,249},{0,0,0,0}},  {/*1*/{153,141,116, 88},{153,237,253,245},{1,0,0,0}},  {/*1*/{153,141,120, 84},{153,241,245,253},{2,0,0,0}},
+  {/*1*/{157,141,120, 92},{157,249,249,245},{1,0,0,0}},  {/*1*/{157,145,120, 88},{157,233,253,253},{0,0,0,0}},  {/*1*/{157,145,124, 92},{157,241,245,249},{1,0,0,0}},  {/*1*/{157,145,124, 92},{157,245,249,253},{2,0,0,0}},
+  {/*1*/{161,145,124, 96},{161,253,253,249},{1,0,0,0}},  {/*1*/{161,149,129,100},{161,237,245,245},{0,0,0,0}},  {/*1*/{161,149,129, 96},{161,245,249,253},{1,0,0,0}},  {/*1*/{161,149,129,104},{161,249,253,245},{2,0,0,0}},
+  {/*1*/{165,153,133,100},{165,233,245,253},{1,0,0,0}},  {/*1*/{165,153,133,104},{165,241,249,249},{0,0,0,0}},  {/*1*/{165,153,133,104},{165,249,253,253},{1,0,0,0}},  {/*1*/{165,153,137,108},{165,253,245,249},{2,0,0,0}},
+  {/*1*/{169,157,137,112},{169,237,249,245},{1,0,0,0}},  {/*1*/{169,157,137,108},{169,245,253,253},{0,0,0,0}},  {/*1*/{169,157,141,116},{169,253,245,245},{1,0,0,0}},  {/*1*/{169,161,141,112},{169,233,249,253},{2,0,0,0}},
+  {/*1*/{173,161,141,116},{173,241,253,249},{1,0,0,0}},  {/*1*/{173,161,145,116},{173,249,245,253},{0,0,0,0}},  {/*1*/{173,165,145,120},{173,229,249,249},{1,0,0,0}},  {/*1*/{173,165,145,124},{173,237,253,245},{2,0,0,0}},
+  {/*1*/{177,165,149,120},{177,245,245,253},{1,0,0,0}},  {/*1*/{177,165,149,129},{177,253,249,245},{0,0,0,0}},  {/*1*/{177,169,149,124},{177,233,253,253},{1,0,0,0}},  {/*1*/{177,169,157,129},{177,241,237,249},{2,0,0,0}},
+  {/*1*/{181,169,153,133},{181,249,249,245},{1,0,0,0}},  {/*1*/{181,173,153,129},{181,233,253,253},{0,0,0,0}},  {/*1*/{181,173,157,137},{181,237,249,245},{1,0,0,0}},  {/*1*/{181,173,161,133},{181,245,241,253},{2,0,0,0}},
+  {/*1*/{185,173,157,137},{185,253,253,249},{1,0,0,0}},  {/*1*/{185,177,161,137},{185,237,249,253},{0,0,0,0}},  {/*1*/{185,177,161,141},{185,241,253,249},{1,0,0,0}},  {/*1*/{185,177,165,145},{185,249,245,245},{2,0,0,0}},
+  {/*1*/{189,181,165,141},{189,233,249,253},{1,0,0,0}},  {/*1*/{189,181,165,149},{189,241,253,245},{0,0,0,0}},  {/*1*/{189,181,169,145},{189,245,245,253},{1,0,0,0}},  {/*1*/{189,181,169,149},{189,253,249,249},{2,0,0,0}},
+  {/*1*/{193,185,169,149},{193,237,253,253},{1,0,0,0}},  {/*1*/{193,185,173,153},{193,245,245,249},{0,0,0,0}},  {/*1*/{193,185,173,157},{193,249,249,245},{1,0,0,0}},  {/*1*/{193,189,173,153},{193,233,253,253},{2,0,0,0}},
+  {/*1*/{197,189,177,161},{197,241,245,245},{1,0,0,0}},  {/*1*/{197,189,177,157},{197,249,249,253},{0,0,0,0}},  {/*1*/{197,189,177,161},{197,253,253,249},{1,0,0,0}},  {/*1*/{197,193,181,161},{197,237,245,253},{2,0,0,0}},
+  {/*1*/{201,193,181,165},{201,245,249,249},{1,0,0,0}},  {/*1*/{201,193,181,169},{201,253,253,245},{0,0,0,0}},  {/*1*/{201,197,189,165},{201,233,237,253},{1,0,0,0}},  {/*1*/{201,197,185,173},{201,241,249,245},{2,0,0,0}},
+  {/*1*/{205,197,185,169},{205,249,253,253},{1,0,0,0}},  {/*1*/{205,201,189,173},{205,233,249,249},{0,0,0,0}},  {/*1*/{205,201,193,173},{205,237,241,253},{1,0,0,0}},  {/*1*/{205,201,189,177},{205,245,253,249},{2,0,0,0}},
+  {/*1*/{209,201,193,181},{209,253,249,245},{1,0,0,0}},  {/*1*/{209,205,193,177},{209,237,253,253},{0,0,0,0}},  {/*1*/{209,205,197,185},{209,241,245,245},{1,0,0,0}},  {/*1*/{209,205,197,181},{209,249,249,253},{2,0,0,0}},
+  {/*1*/{213,209,197,185},{213,233,253,249},{1,0,0,0}},  {/*1*/{213,209,201,185},{213,241,245,253},{0,0,0,0}},  {/*1*/{213,209,201,189},{213,245,249,249},{1,0,0,0}},  {/*1*/{213,209,201,197},{213,253,253,241},{2,0,0,0}},
+  {/*1*/{217,213,205,189},{217,237,245,253},{1,0,0,0}},  {/*1*/{217,213,205,197},{217,245,249,245},{0,0,0,0}},  {/*1*/{217,213,205,193},{217,249,253,253},{1,0,0,0}},  {/*1*/{217,217,209,201},{217,233,245,245},{2,0,0,0}},
+  {/*1*/{221,217,209,197},{221,241,249,253},{1,0,0,0}},  {/*1*/{221,217,209,201},{221,249,253,249},{0,0,0,0}},  {/*1*/{221,217,213,201},{221,253,245,253},{1,0,0,0}},  {/*1*/{221,221,213,205},{221,237,249,249},{2,0,0,0}},
+  {/*1*/{225,221,213,209},{225,245,253,245},{1,0,0,0}},  {/*1*/{225,221,221,205},{225,253,237,253},{0,0,0,0}},  {/*1*/{225,225,217,213},{225,233,249,245},{1,0,0,0}},  {/*1*/{225,225,217,209},{225,241,253,253},{2,0,0,0}},
+  {/*1*/{229,225,221,213},{229,249,249,249},{1,0,0,0}},  {/*1*/{229,229,225,213},{229,229,241,253},{0,0,0,0}},  {/*1*/{229,229,221,217},{229,237,253,249},{1,0,0,0}},  {/*1*/{229,229,225,221},{229,245,249,245},{2,0,0,0}},
+  {/*1*/{233,229,225,217},{233,253,253,253},{1,0,0,0}},  {/*1*/{233,233,229,225},{233,233,245,245},{0,0,0,0}},  {/*1*/{233,233,229,221},{233,241,249,253},{1,0,0,0}},  {/*1*/{233,233,229,225},{233,249,253,249},{2,0,0,0}},
+  {/*1*/{237,237,233,225},{237,233,245,253},{1,0,0,0}},  {/*1*/{237,237,233,229},{237,237,249,249},{0,0,0,0}},  {/*1*/{237,237,233,233},{237,245,253,245},{1,0,0,0}},  {/*1*/{237,237,237,229},{237,253,245,253},{2,0,0,0}},
+  {/*1*/{241,241,237,237},{241,237,249,245},{1,0,0,0}},  {/*1*/{241,241,237,233},{241,241,253,253},{0,0,0,0}},  {/*1*/{241,241,241,237},{241,249,245,249},{1,0,0,0}},  {/*1*/{241,245,241,237},{241,237,249,253},{2,0,0,0}},
+  {/*1*/{245,245,241,241},{245,241,253,249},{1,0,0,0}},  {/*1*/{245,245,245,245},{245,245,245,245},{0,0,0,0}},  {/*1*/{245,245,245,241},{245,253,249,253},{1,0,0,0}},  {/*1*/{245,249,245,249},{245,241,253,245},{2,0,0,0}},
+  {/*1*/{249,249,253,245},{249,245,237,253},{1,0,0,0}},  {/*1*/{249,249,249,249},{249,249,249,249},{0,0,0,0}},  {/*1*/{249,253,249,249},{249,237,253,253},{1,0,0,0}},  {/*1*/{249,253,253,253},{249,245,249,249},{2,0,0,0}},
+  {/*1*/{253,253,253,253},{253,249,253,253},{1,0,1,1}},  {/*1*/{253,253,253,253},{253,253,253,253},{0,0,0,0}},  {/*1*/{253,253,253,253},{253,253,253,253},{1,1,1,1}},  {/*1*/{253,253,253,253},{253,253,253,253},{2,2,2,2}}
 },{
-  {{/*1*/{  2,  2,2},{  2,  2,2},{  2,  2,2},{  2,  2,2}}},  {{/*1*/{  2,  2,1},{  2,  2,1},{  2,  2,1},{  2,  2,1}}},  {{/*1*/{  2,  2,0},{  2,  2,0},{  2,  2,0},{  2,  2,0}}},  {{/*1*/{  2,  2,1},{  2, 10,0},{  2,  6,0},{  2,  6,0}}},
-  {{/*1*/{  2,  2,2},{  2, 18,0},{  2, 10,0},{  6,  2,0}}},  {{/*1*/{  6,  6,1},{  2, 26,0},{  2, 14,0},{  2, 10,0}}},  {{/*1*/{  6,  6,0},{  2, 34,0},{  2, 18,0},{  6,  6,0}}},  {{/*1*/{  6,  6,1},{  2, 38,0},{  2, 22,0},{  2, 14,0}}},
-  {{/*1*/{  6,  6,2},{  2, 46,0},{  2, 26,0},{  2, 18,0}}},  {{/*1*/{ 10, 10,1},{  2, 54,0},{  2, 30,0},{  6, 14,0}}},  {{/*1*/{ 10, 10,0},{  2, 62,0},{  6, 22,0},{  2, 22,0}}},  {{/*1*/{ 10, 10,1},{  2, 66,0},{  2, 34,0},{  6, 18,0}}},
-  {{/*1*/{ 10, 10,2},{  2, 74,0},{  2, 38,0},{  2, 26,0}}},  {{/*1*/{ 14, 14,1},{  2, 82,0},{  2, 42,0},{  2, 30,0}}},  {{/*1*/{ 14, 14,0},{  2, 90,0},{  2, 46,0},{  6, 26,0}}},  {{/*1*/{ 14, 14,1},{  2, 98,0},{  2, 50,0},{  2, 34,0}}},
-  {{/*1*/{ 14, 14,2},{  2,102,0},{  2, 54,0},{  6, 30,0}}},  {{/*1*/{ 18, 18,1},{  2,110,0},{  2, 58,0},{  2, 38,0}}},  {{/*1*/{ 18, 18,0},{  2,118,0},{  2, 62,0},{  2, 42,0}}},  {{/*1*/{ 18, 18,1},{  2,126,0},{  6, 54,0},{  6, 38,0}}},
-  {{/*1*/{ 18, 18,2},{  2,131,0},{  2, 66,0},{  2, 46,0}}},  {{/*1*/{ 22, 22,1},{  2,139,0},{  2, 70,0},{  6, 42,0}}},  {{/*1*/{ 22, 22,0},{  2,147,0},{  2, 74,0},{  2, 50,0}}},  {{/*1*/{ 22, 22,1},{  2,155,0},{  2, 78,0},{  2, 54,0}}},
-  {{/*1*/{ 22, 22,2},{  2,159,0},{  2, 82,0},{  6, 50,0}}},  {{/*1*/{ 26, 26,1},{  2,167,0},{  2, 86,0},{  2, 58,0}}},  {{/*1*/{ 26, 26,0},{  2,175,0},{  2, 90,0},{  6, 54,0}}},  {{/*1*/{ 26, 26,1},{  2,183,0},{  2, 94,0},{  2, 62,0}}},
-  {{/*1*/{ 26, 26,2},{  2,187,0},{  6, 86,0},{ 10, 54,0}}},  {{/*1*/{ 30, 30,1},{  2,195,0},{  2, 98,0},{  2, 66,0}}},  {{/*1*/{ 30, 30,0},{  2,203,0},{  2,102,0},{  2, 70,0}}},  {{/*1*/{ 30, 30,1},{  2,211,0},{  2,106,0},{  6, 66,0}}},
-  {{/*1*/{ 30, 30,2},{  2,219,0},{  2,110,0},{  2, 74,0}}},  {{/*1*/{ 34, 34,1},{  2,223,0},{  2,114,0},{  6, 70,0}}},  {{/*1*/{ 34, 34,0},{  2,231,0},{  2,118,0},{  2, 78,0}}},  {{/*1*/{ 34, 34,1},{  2,239,0},{  2,122,0},{  2, 82,0}}},
-  {{/*1*/{ 34, 34,2},{  2,247,0},{  2,126,0},{  6, 78,0}}},  {{/*1*/{ 38, 38,1},{  2,251,0},{  6,118,0},{  2, 86,0}}},  {{/*1*/{ 38, 38,0},{  6,235,0},{  2,131,0},{  6, 82,0}}},  {{/*1*/{ 38, 38,1},{  6,243,0},{  2,135,0},{  2, 90,0}}},
-  {{/*1*/{ 38, 38,2},{  6,251,0},{  2,139,0},{  2, 94,0}}},  {{/*1*/{ 42, 42,1},{  6,255,0},{  2,143,0},{  6, 90,0}}},  {{/*1*/{ 42, 42,0},{ 10,239,0},{  2,147,0},{  2, 98,0}}},  {{/*1*/{ 42, 42,1},{ 10,247,0},{  2,151,0},{  6, 94,0}}},
-  {{/*1*/{ 42, 42,2},{ 10,255,0},{  6,143,0},{  2,102,0}}},  {{/*1*/{ 46, 46,1},{ 14,235,0},{  2,155,0},{  2,106,0}}},  {{/*1*/{ 46, 46,0},{ 14,243,0},{  2,159,0},{  6,102,0}}},  {{/*1*/{ 46, 46,1},{ 14,251,0},{  2,163,0},{  2,110,0}}},
-  {{/*1*/{ 46, 46,2},{ 18,235,0},{  2,167,0},{  6,106,0}}},  {{/*1*/{ 50, 50,1},{ 18,239,0},{  2,171,0},{  2,114,0}}},  {{/*1*/{ 50, 50,0},{ 18,247,0},{  2,175,0},{  2,118,0}}},  {{/*1*/{ 50, 50,1},{ 18,255,0},{  2,179,0},{  6,114,0}}},
-  {{/*1*/{ 50, 50,2},{ 22,239,0},{  2,183,0},{  2,122,0}}},  {{/*1*/{ 54, 54,1},{ 22,243,0},{  6,175,0},{  6,118,0}}},  {{/*1*/{ 54, 54,0},{ 22,251,0},{  2,187,0},{  2,126,0}}},  {{/*1*/{ 54, 54,1},{ 26,235,0},{  2,191,0},{ 10,118,0}}},
-  {{/*1*/{ 54, 54,2},{ 26,243,0},{  2,195,0},{  2,131,0}}},  {{/*1*/{ 58, 58,1},{ 26,247,0},{  2,199,0},{ 10,122,0}}},  {{/*1*/{ 58, 58,0},{ 26,255,0},{  2,203,0},{  2,135,0}}},  {{/*1*/{ 58, 58,1},{ 30,239,0},{  2,207,0},{  2,139,0}}},
-  {{/*1*/{ 58, 58,2},{ 30,247,0},{  2,211,0},{  6,135,0}}},  {{/*1*/{ 62, 62,1},{ 30,251,0},{  2,215,0},{  2,143,0}}},  {{/*1*/{ 62, 62,0},{ 34,235,0},{  6,207,0},{  6,139,0}}},  {{/*1*/{ 62, 62,1},{ 34,243,0},{  2,219,0},{  2,147,0}}},
-  {{/*1*/{ 62, 62,2},{ 34,251,0},{  2,223,0},{  2,151,0}}},  {{/*1*/{ 66, 66,1},{ 34,255,0},{  2,227,0},{  6,147,0}}},  {{/*1*/{ 66, 66,0},{ 38,239,0},{  2,231,0},{  2,155,0}}},  {{/*1*/{ 66, 66,1},{ 38,247,0},{  2,235,0},{  6,151,0}}},
-  {{/*1*/{ 66, 66,2},{ 38,255,0},{  2,239,0},{  2,159,0}}},  {{/*1*/{ 70, 70,1},{ 42,235,0},{  2,243,0},{  2,163,0}}},  {{/*1*/{ 70, 70,0},{ 42,243,0},{  2,247,0},{  6,159,0}}},  {{/*1*/{ 70, 70,1},{ 42,251,0},{  6,239,0},{  2,167,0}}},
-  {{/*1*/{ 70, 70,2},{ 46,231,0},{  2,251,0},{  6,163,0}}},  {{/*1*/{ 74, 74,1},{ 46,239,0},{  2,255,0},{  2,171,0}}},  {{/*1*/{ 74, 74,0},{ 46,247,0},{  6,251,0},{  2,175,0}}},  {{/*1*/{ 74, 74,1},{ 46,255,0},{ 10,243,0},{  6,171,0}}},
-  {{/*1*/{ 74, 74,2},{ 50,235,0},{  6,255,0},{  2,179,0}}},  {{/*1*/{ 78, 78,1},{ 50,243,0},{ 10,251,0},{  6,175,0}}},  {{/*1*/{ 78, 78,0},{ 50,251,0},{ 10,255,0},{  2,183,0}}},  {{/*1*/{ 78, 78,1},{ 54,235,0},{ 14,247,0},{ 10,175,0}}},
-  {{/*1*/{ 78, 78,2},{ 54,239,0},{ 14,251,0},{  2,187,0}}},  {{/*1*/{ 82, 82,1},{ 54,247,0},{ 14,255,0},{  2,191,0}}},  {{/*1*/{ 82, 82,0},{ 54,255,0},{ 18,247,0},{  6,187,0}}},  {{/*1*/{ 82, 82,1},{ 58,239,0},{ 18,251,0},{  2,195,0}}},
-  {{/*1*/{ 82, 82,2},{ 58,243,0},{ 18,255,0},{  6,191,0}}},  {{/*1*/{ 86, 86,1},{ 58,251,0},{ 22,247,0},{  2,199,0}}},  {{/*1*/{ 86, 86,0},{ 62,235,0},{ 22,251,0},{  2,203,0}}},  {{/*1*/{ 86, 86,1},{ 62,243,0},{ 22,255,0},{  6,199,0}}},
-  {{/*1*/{ 86, 86,2},{ 62,247,0},{ 26,247,0},{  2,207,0}}},  {{/*1*/{ 90, 90,1},{ 62,255,0},{ 26,251,0},{  6,203,0}}},  {{/*1*/{ 90, 90,0},{ 66,239,0},{ 26,255,0},{  2,211,0}}},  {{/*1*/{ 90, 90,1},{ 66,247,0},{ 30,247,0},{  2,215,0}}},
-  {{/*1*/{ 90, 90,2},{ 66,251,0},{ 30,251,0},{  6,211,0}}},  {{/*1*/{ 94, 94,1},{ 70,235,0},{ 30,255,0},{  2,219,0}}},  {{/*1*/{ 94, 94,0},{ 70,243,0},{ 38,239,0},{  6,215,0}}},  {{/*1*/{ 94, 94,1},{ 70,251,0},{ 34,251,0},{  2,223,0}}},
-  {{/*1*/{ 94, 94,2},{ 70,255,0},{ 34,255,0},{  2,227,0}}},  {{/*1*/{ 98, 98,1},{ 74,239,0},{ 38,251,0},{  6,223,0}}},  {{/*1*/{ 98, 98,0},{ 74,247,0},{ 42,243,0},{  2,231,0}}},  {{/*1*/{ 98, 98,1},{ 74,255,0},{ 38,255,0},{  6,227,0}}},
-  {{/*1*/{ 98, 98,2},{ 78,235,0},{ 42,251,0},{  2,235,0}}},  {{/*1*/{102,102,1},{ 78,243,0},{ 42,255,0},{  2,239,0}}},  {{/*1*/{102,102,0},{ 78,251,0},{ 46,247,0},{  6,235,0}}},  {{/*1*/{102,102,1},{ 82,235,0},{ 46,251,0},{  2,243,0}}},
-  {{/*1*/{102,102,2},{ 82,239,0},{ 46,255,0},{  6,239,0}}},  {{/*1*/{106,106,1},{ 82,247,0},{ 50,247,0},{  2,247,0}}},  {{/*1*/{106,106,0},{ 82,255,0},{ 50,251,0},{ 10,239,0}}},  {{/*1*/{106,106,1},{ 86,239,0},{ 50,255,0},{  2,251,0}}},
-  {{/*1*/{106,106,2},{ 86,243,0},{ 54,247,0},{  2,255,0}}},  {{/*1*/{110,110,1},{ 86,251,0},{ 54,251,0},{  6,251,0}}},  {{/*1*/{110,110,0},{ 90,235,0},{ 54,255,0},{ 14,243,0}}},  {{/*1*/{110,110,1},{ 90,243,0},{ 58,247,0},{  6,255,0}}},
-  {{/*1*/{110,110,2},{ 90,247,0},{ 58,251,0},{ 14,247,0}}},  {{/*1*/{114,114,1},{ 90,255,0},{ 58,255,0},{ 10,255,0}}},  {{/*1*/{114,114,0},{ 94,239,0},{ 62,247,0},{ 18,247,0}}},  {{/*1*/{114,114,1},{ 94,247,0},{ 62,251,0},{ 14,255,0}}},
-  {{/*1*/{114,114,2},{ 94,251,0},{ 62,255,0},{ 18,251,0}}},  {{/*1*/{118,118,1},{ 98,235,0},{ 70,239,0},{ 18,255,0}}},  {{/*1*/{118,118,0},{ 98,243,0},{ 66,251,0},{ 22,251,0}}},  {{/*1*/{118,118,1},{ 98,251,0},{ 66,255,0},{ 26,247,0}}},
-  {{/*1*/{118,118,2},{ 98,255,0},{ 70,251,0},{ 22,255,0}}},  {{/*1*/{122,122,1},{102,239,0},{ 74,243,0},{ 30,247,0}}},  {{/*1*/{122,122,0},{102,247,0},{ 70,255,0},{ 26,255,0}}},  {{/*1*/{122,122,1},{102,255,0},{ 74,251,0},{ 30,251,0}}},
-  {{/*1*/{122,122,2},{106,235,0},{ 74,255,0},{ 30,255,0}}},  {{/*1*/{126,126,1},{106,243,0},{ 78,247,0},{ 34,251,0}}},  {{/*1*/{126,126,0},{106,251,0},{ 78,251,0},{ 38,247,0}}},  {{/*1*/{126,126,1},{110,231,0},{ 78,255,0},{ 34,255,0}}},
-  {{/*1*/{126,126,2},{110,239,0},{ 82,247,0},{ 42,247,0}}},  {{/*1*/{131,131,2},{110,247,0},{ 82,251,0},{ 38,255,0}}},  {{/*1*/{131,131,1},{110,255,0},{ 82,255,0},{ 42,251,0}}},  {{/*1*/{131,131,0},{114,235,0},{ 86,247,0},{ 42,255,0}}},
-  {{/*1*/{131,131,1},{114,243,0},{ 86,251,0},{ 46,251,0}}},  {{/*1*/{131,131,2},{114,251,0},{ 86,255,0},{ 50,247,0}}},  {{/*1*/{135,135,1},{118,235,0},{ 90,247,0},{ 46,255,0}}},  {{/*1*/{135,135,0},{118,239,0},{ 90,251,0},{ 54,247,0}}},
-  {{/*1*/{135,135,1},{118,247,0},{ 90,255,0},{ 50,255,0}}},  {{/*1*/{135,135,2},{118,255,0},{ 94,247,0},{ 54,251,0}}},  {{/*1*/{139,139,1},{122,239,0},{ 94,251,0},{ 54,255,0}}},  {{/*1*/{139,139,0},{122,243,0},{ 94,255,0},{ 58,251,0}}},
-  {{/*1*/{139,139,1},{122,251,0},{102,239,0},{ 62,247,0}}},  {{/*1*/{139,139,2},{126,235,0},{ 98,251,0},{ 58,255,0}}},  {{/*1*/{143,143,1},{126,243,0},{ 98,255,0},{ 66,247,0}}},  {{/*1*/{143,143,0},{126,247,0},{102,251,0},{ 62,255,0}}},
-  {{/*1*/{143,143,1},{126,255,0},{106,243,0},{ 66,251,0}}},  {{/*1*/{143,143,2},{131,231,0},{102,255,0},{ 66,255,0}}},  {{/*1*/{147,147,1},{131,239,0},{106,251,0},{ 70,251,0}}},  {{/*1*/{147,147,0},{131,247,0},{106,255,0},{ 78,243,0}}},
-  {{/*1*/{147,147,1},{131,255,0},{110,247,0},{ 70,255,0}}},  {{/*1*/{147,147,2},{135,235,0},{110,251,0},{ 78,247,0}}},  {{/*1*/{151,151,1},{135,243,0},{110,255,0},{ 74,255,0}}},  {{/*1*/{151,151,0},{135,251,0},{114,247,0},{ 82,247,0}}},
-  {{/*1*/{151,151,1},{139,235,0},{114,251,0},{ 78,255,0}}},  {{/*1*/{151,151,2},{139,239,0},{114,255,0},{ 82,251,0}}},  {{/*1*/{155,155,1},{139,247,0},{118,247,0},{ 82,255,0}}},  {{/*1*/{155,155,0},{139,255,0},{118,251,0},{ 86,251,0}}},
-  {{/*1*/{155,155,1},{143,239,0},{118,255,0},{ 90,247,0}}},  {{/*1*/{155,155,2},{143,243,0},{122,247,0},{ 86,255,0}}},  {{/*1*/{159,159,1},{143,251,0},{122,251,0},{ 94,247,0}}},  {{/*1*/{159,159,0},{147,235,0},{122,255,0},{ 90,255,0}}},
-  {{/*1*/{159,159,1},{147,243,0},{126,247,0},{ 94,251,0}}},  {{/*1*/{159,159,2},{147,247,0},{126,251,0},{ 94,255,0}}},  {{/*1*/{163,163,1},{147,255,0},{126,255,0},{ 98,251,0}}},  {{/*1*/{163,163,0},{151,239,0},{131,247,0},{102,247,0}}},
-  {{/*1*/{163,163,1},{151,247,0},{131,251,0},{ 98,255,0}}},  {{/*1*/{163,163,2},{151,251,0},{131,255,0},{106,247,0}}},  {{/*1*/{167,167,1},{155,235,0},{135,247,0},{102,255,0}}},  {{/*1*/{167,167,0},{155,243,0},{135,251,0},{106,251,0}}},
-  {{/*1*/{167,167,1},{155,251,0},{135,255,0},{106,255,0}}},  {{/*1*/{167,167,2},{155,255,0},{139,247,0},{110,251,0}}},  {{/*1*/{171,171,1},{159,239,0},{139,251,0},{114,247,0}}},  {{/*1*/{171,171,0},{159,247,0},{139,255,0},{110,255,0}}},
-  {{/*1*/{171,171,1},{159,255,0},{143,247,0},{118,247,0}}},  {{/*1*/{171,171,2},{163,235,0},{143,251,0},{114,255,0}}},  {{/*1*/{175,175,1},{163,243,0},{143,255,0},{118,251,0}}},  {{/*1*/{175,175,0},{163,251,0},{147,247,0},{118,255,0}}},
-  {{/*1*/{175,175,1},{167,231,0},{147,251,0},{122,251,0}}},  {{/*1*/{175,175,2},{167,239,0},{147,255,0},{126,247,0}}},  {{/*1*/{179,179,1},{167,247,0},{151,247,0},{122,255,0}}},  {{/*1*/{179,179,0},{167,255,0},{151,251,0},{131,247,0}}},
-  {{/*1*/{179,179,1},{171,235,0},{151,255,0},{126,255,0}}},  {{/*1*/{179,179,2},{171,243,0},{159,239,0},{131,251,0}}},  {{/*1*/{183,183,1},{171,251,0},{155,251,0},{135,247,0}}},  {{/*1*/{183,183,0},{175,235,0},{155,255,0},{131,255,0}}},
-  {{/*1*/{183,183,1},{175,239,0},{159,251,0},{139,247,0}}},  {{/*1*/{183,183,2},{175,247,0},{163,243,0},{135,255,0}}},  {{/*1*/{187,187,1},{175,255,0},{159,255,0},{139,251,0}}},  {{/*1*/{187,187,0},{179,239,0},{163,251,0},{139,255,0}}},
-  {{/*1*/{187,187,1},{179,243,0},{163,255,0},{143,251,0}}},  {{/*1*/{187,187,2},{179,251,0},{167,247,0},{147,247,0}}},  {{/*1*/{191,191,1},{183,235,0},{167,251,0},{143,255,0}}},  {{/*1*/{191,191,0},{183,243,0},{167,255,0},{151,247,0}}},
-  {{/*1*/{191,191,1},{183,247,0},{171,247,0},{147,255,0}}},  {{/*1*/{191,191,2},{183,255,0},{171,251,0},{151,251,0}}},  {{/*1*/{195,195,1},{187,239,0},{171,255,0},{151,255,0}}},  {{/*1*/{195,195,0},{187,247,0},{175,247,0},{155,251,0}}},
-  {{/*1*/{195,195,1},{187,251,0},{175,251,0},{159,247,0}}},  {{/*1*/{195,195,2},{191,235,0},{175,255,0},{155,255,0}}},  {{/*1*/{199,199,1},{191,243,0},{179,247,0},{163,247,0}}},  {{/*1*/{199,199,0},{191,251,0},{179,251,0},{159,255,0}}},
-  {{/*1*/{199,199,1},{191,255,0},{179,255,0},{163,251,0}}},  {{/*1*/{199,199,2},{195,239,0},{183,247,0},{163,255,0}}},  {{/*1*/{203,203,1},{195,247,0},{183,251,0},{167,251,0}}},  {{/*1*/{203,203,0},{195,255,0},{183,255,0},{171,247,0}}},
-  {{/*1*/{203,203,1},{199,235,0},{191,239,0},{167,255,0}}},  {{/*1*/{203,203,2},{199,243,0},{187,251,0},{175,247,0}}},  {{/*1*/{207,207,1},{199,251,0},{187,255,0},{171,255,0}}},  {{/*1*/{207,207,0},{203,235,0},{191,251,0},{175,251,0}}},
-  {{/*1*/{207,207,1},{203,239,0},{195,243,0},{175,255,0}}},  {{/*1*/{207,207,2},{203,247,0},{191,255,0},{179,251,0}}},  {{/*1*/{211,211,1},{203,255,0},{195,251,0},{183,247,0}}},  {{/*1*/{211,211,0},{207,239,0},{195,255,0},{179,255,0}}},
-  {{/*1*/{211,211,1},{207,243,0},{199,247,0},{187,247,0}}},  {{/*1*/{211,211,2},{207,251,0},{199,251,0},{183,255,0}}},  {{/*1*/{215,215,1},{211,235,0},{199,255,0},{187,251,0}}},  {{/*1*/{215,215,0},{211,243,0},{203,247,0},{187,255,0}}},
-  {{/*1*/{215,215,1},{211,247,0},{203,251,0},{191,251,0}}},  {{/*1*/{215,215,2},{211,255,0},{203,255,0},{199,243,0}}},  {{/*1*/{219,219,1},{215,239,0},{207,247,0},{191,255,0}}},  {{/*1*/{219,219,0},{215,247,0},{207,251,0},{199,247,0}}},
-  {{/*1*/{219,219,1},{215,251,0},{207,255,0},{195,255,0}}},  {{/*1*/{219,219,2},{219,235,0},{211,247,0},{203,247,0}}},  {{/*1*/{223,223,1},{219,243,0},{211,251,0},{199,255,0}}},  {{/*1*/{223,223,0},{219,251,0},{211,255,0},{203,251,0}}},
-  {{/*1*/{223,223,1},{219,255,0},{215,247,0},{203,255,0}}},  {{/*1*/{223,223,2},{223,239,0},{215,251,0},{207,251,0}}},  {{/*1*/{227,227,1},{223,247,0},{215,255,0},{211,247,0}}},  {{/*1*/{227,227,0},{223,255,0},{223,239,0},{207,255,0}}},
-  {{/*1*/{227,227,1},{227,235,0},{219,251,0},{215,247,0}}},  {{/*1*/{227,227,2},{227,243,0},{219,255,0},{211,255,0}}},  {{/*1*/{231,231,1},{227,251,0},{223,251,0},{215,251,0}}},  {{/*1*/{231,231,0},{231,231,0},{227,243,0},{215,255,0}}},
-  {{/*1*/{231,231,1},{231,239,0},{223,255,0},{219,251,0}}},  {{/*1*/{231,231,2},{231,247,0},{227,251,0},{223,247,0}}},  {{/*1*/{235,235,1},{231,255,0},{227,255,0},{219,255,0}}},  {{/*1*/{235,235,0},{235,235,0},{231,247,0},{227,247,0}}},
-  {{/*1*/{235,235,1},{235,243,0},{231,251,0},{223,255,0}}},  {{/*1*/{235,235,2},{235,251,0},{231,255,0},{227,251,0}}},  {{/*1*/{239,239,1},{239,235,0},{235,247,0},{227,255,0}}},  {{/*1*/{239,239,0},{239,239,0},{235,251,0},{231,251,0}}},
-  {{/*1*/{239,239,1},{239,247,0},{235,255,0},{235,247,0}}},  {{/*1*/{239,239,2},{239,255,0},{239,247,0},{231,255,0}}},  {{/*1*/{243,243,1},{243,239,0},{239,251,0},{239,247,0}}},  {{/*1*/{243,243,0},{243,243,0},{239,255,0},{235,255,0}}},
-  {{/*1*/{243,243,1},{243,251,0},{243,247,0},{239,251,0}}},  {{/*1*/{243,243,2},{247,239,0},{243,251,0},{239,255,0}}},  {{/*1*/{247,247,1},{247,243,0},{243,255,0},{243,251,0}}},  {{/*1*/{247,247,0},{247,247,0},{247,247,0},{247,247,0}}},
-  {{/*1*/{247,247,1},{247,255,0},{247,251,0},{243,255,0}}},  {{/*1*/{247,247,2},{251,243,0},{247,255,0},{251,247,0}}},  {{/*1*/{251,251,1},{251,247,0},{255,239,0},{247,255,0}}},  {{/*1*/{251,251,0},{251,251,0},{251,251,0},{251,251,0}}},
-  {{/*1*/{251,251,1},{255,239,0},{251,255,0},{251,255,0}}},  {{/*1*/{251,251,2},{255,247,0},{255,251,0},{255,251,0}}},  {{/*1*/{255,255,1},{255,251,0},{255,255,1},{255,255,1}}},  {{/*1*/{255,255,0},{255,255,0},{255,255,0},{255,255,0}}}
+  {/*1*/{  2,  2,  2,  2},{  2,  2,  2,  2},{2,2,2,2}},  {/*1*/{  2,  2,  2,  2},{  2,  2,  2,  2},{1,1,1,1}},  {/*1*/{  2,  2,  2,  2},{  2,  2,  2,  2},{0,0,0,0}},  {/*1*/{  2,  2,  2,  2},{  2, 10,  6,  6},{1,0,0,0}},
+  {/*1*/{  2,  2,  2,  6},{  2, 18, 10,  2},{2,0,0,0}},  {/*1*/{  6,  2,  2,  2},{  6, 26, 14, 10},{1,0,0,0}},  {/*1*/{  6,  2,  2,  6},{  6, 34, 18,  6},{0,0,0,0}},  {/*1*/{  6,  2,  2,  2},{  6, 38, 22, 14},{1,0,0,0}},
+  {/*1*/{  6,  2,  2,  2},{  6, 46, 26, 18},{2,0,0,0}},  {/*1*/{ 10,  2,  2,  6},{ 10, 54, 30, 14},{1,0,0,0}},  {/*1*/{ 10,  2,  6,  2},{ 10, 62, 22, 22},{0,0,0,0}},  {/*1*/{ 10,  2,  2,  6},{ 10, 66, 34, 18},{1,0,0,0}},
+  {/*1*/{ 10,  2,  2,  2},{ 10, 74, 38, 26},{2,0,0,0}},  {/*1*/{ 14,  2,  2,  2},{ 14, 82, 42, 30},{1,0,0,0}},  {/*1*/{ 14,  2,  2,  6},{ 14, 90, 46, 26},{0,0,0,0}},  {/*1*/{ 14,  2,  2,  2},{ 14, 98, 50, 34},{1,0,0,0}},
+  {/*1*/{ 14,  2,  2,  6},{ 14,102, 54, 30},{2,0,0,0}},  {/*1*/{ 18,  2,  2,  2},{ 18,110, 58, 38},{1,0,0,0}},  {/*1*/{ 18,  2,  2,  2},{ 18,118, 62, 42},{0,0,0,0}},  {/*1*/{ 18,  2,  6,  6},{ 18,126, 54, 38},{1,0,0,0}},
+  {/*1*/{ 18,  2,  2,  2},{ 18,131, 66, 46},{2,0,0,0}},  {/*1*/{ 22,  2,  2,  6},{ 22,139, 70, 42},{1,0,0,0}},  {/*1*/{ 22,  2,  2,  2},{ 22,147, 74, 50},{0,0,0,0}},  {/*1*/{ 22,  2,  2,  2},{ 22,155, 78, 54},{1,0,0,0}},
+  {/*1*/{ 22,  2,  2,  6},{ 22,159, 82, 50},{2,0,0,0}},  {/*1*/{ 26,  2,  2,  2},{ 26,167, 86, 58},{1,0,0,0}},  {/*1*/{ 26,  2,  2,  6},{ 26,175, 90, 54},{0,0,0,0}},  {/*1*/{ 26,  2,  2,  2},{ 26,183, 94, 62},{1,0,0,0}},
+  {/*1*/{ 26,  2,  6, 10},{ 26,187, 86, 54},{2,0,0,0}},  {/*1*/{ 30,  2,  2,  2},{ 30,195, 98, 66},{1,0,0,0}},  {/*1*/{ 30,  2,  2,  2},{ 30,203,102, 70},{0,0,0,0}},  {/*1*/{ 30,  2,  2,  6},{ 30,211,106, 66},{1,0,0,0}},
+  {/*1*/{ 30,  2,  2,  2},{ 30,219,110, 74},{2,0,0,0}},  {/*1*/{ 34,  2,  2,  6},{ 34,223,114, 70},{1,0,0,0}},  {/*1*/{ 34,  2,  2,  2},{ 34,231,118, 78},{0,0,0,0}},  {/*1*/{ 34,  2,  2,  2},{ 34,239,122, 82},{1,0,0,0}},
+  {/*1*/{ 34,  2,  2,  6},{ 34,247,126, 78},{2,0,0,0}},  {/*1*/{ 38,  2,  6,  2},{ 38,251,118, 86},{1,0,0,0}},  {/*1*/{ 38,  6,  2,  6},{ 38,235,131, 82},{0,0,0,0}},  {/*1*/{ 38,  6,  2,  2},{ 38,243,135, 90},{1,0,0,0}},
+  {/*1*/{ 38,  6,  2,  2},{ 38,251,139, 94},{2,0,0,0}},  {/*1*/{ 42,  6,  2,  6},{ 42,255,143, 90},{1,0,0,0}},  {/*1*/{ 42, 10,  2,  2},{ 42,239,147, 98},{0,0,0,0}},  {/*1*/{ 42, 10,  2,  6},{ 42,247,151, 94},{1,0,0,0}},
+  {/*1*/{ 42, 10,  6,  2},{ 42,255,143,102},{2,0,0,0}},  {/*1*/{ 46, 14,  2,  2},{ 46,235,155,106},{1,0,0,0}},  {/*1*/{ 46, 14,  2,  6},{ 46,243,159,102},{0,0,0,0}},  {/*1*/{ 46, 14,  2,  2},{ 46,251,163,110},{1,0,0,0}},
+  {/*1*/{ 46, 18,  2,  6},{ 46,235,167,106},{2,0,0,0}},  {/*1*/{ 50, 18,  2,  2},{ 50,239,171,114},{1,0,0,0}},  {/*1*/{ 50, 18,  2,  2},{ 50,247,175,118},{0,0,0,0}},  {/*1*/{ 50, 18,  2,  6},{ 50,255,179,114},{1,0,0,0}},
+  {/*1*/{ 50, 22,  2,  2},{ 50,239,183,122},{2,0,0,0}},  {/*1*/{ 54, 22,  6,  6},{ 54,243,175,118},{1,0,0,0}},  {/*1*/{ 54, 22,  2,  2},{ 54,251,187,126},{0,0,0,0}},  {/*1*/{ 54, 26,  2, 10},{ 54,235,191,118},{1,0,0,0}},
+  {/*1*/{ 54, 26,  2,  2},{ 54,243,195,131},{2,0,0,0}},  {/*1*/{ 58, 26,  2, 10},{ 58,247,199,122},{1,0,0,0}},  {/*1*/{ 58, 26,  2,  2},{ 58,255,203,135},{0,0,0,0}},  {/*1*/{ 58, 30,  2,  2},{ 58,239,207,139},{1,0,0,0}},
+  {/*1*/{ 58, 30,  2,  6},{ 58,247,211,135},{2,0,0,0}},  {/*1*/{ 62, 30,  2,  2},{ 62,251,215,143},{1,0,0,0}},  {/*1*/{ 62, 34,  6,  6},{ 62,235,207,139},{0,0,0,0}},  {/*1*/{ 62, 34,  2,  2},{ 62,243,219,147},{1,0,0,0}},
+  {/*1*/{ 62, 34,  2,  2},{ 62,251,223,151},{2,0,0,0}},  {/*1*/{ 66, 34,  2,  6},{ 66,255,227,147},{1,0,0,0}},  {/*1*/{ 66, 38,  2,  2},{ 66,239,231,155},{0,0,0,0}},  {/*1*/{ 66, 38,  2,  6},{ 66,247,235,151},{1,0,0,0}},
+  {/*1*/{ 66, 38,  2,  2},{ 66,255,239,159},{2,0,0,0}},  {/*1*/{ 70, 42,  2,  2},{ 70,235,243,163},{1,0,0,0}},  {/*1*/{ 70, 42,  2,  6},{ 70,243,247,159},{0,0,0,0}},  {/*1*/{ 70, 42,  6,  2},{ 70,251,239,167},{1,0,0,0}},
+  {/*1*/{ 70, 46,  2,  6},{ 70,231,251,163},{2,0,0,0}},  {/*1*/{ 74, 46,  2,  2},{ 74,239,255,171},{1,0,0,0}},  {/*1*/{ 74, 46,  6,  2},{ 74,247,251,175},{0,0,0,0}},  {/*1*/{ 74, 46, 10,  6},{ 74,255,243,171},{1,0,0,0}},
+  {/*1*/{ 74, 50,  6,  2},{ 74,235,255,179},{2,0,0,0}},  {/*1*/{ 78, 50, 10,  6},{ 78,243,251,175},{1,0,0,0}},  {/*1*/{ 78, 50, 10,  2},{ 78,251,255,183},{0,0,0,0}},  {/*1*/{ 78, 54, 14, 10},{ 78,235,247,175},{1,0,0,0}},
+  {/*1*/{ 78, 54, 14,  2},{ 78,239,251,187},{2,0,0,0}},  {/*1*/{ 82, 54, 14,  2},{ 82,247,255,191},{1,0,0,0}},  {/*1*/{ 82, 54, 18,  6},{ 82,255,247,187},{0,0,0,0}},  {/*1*/{ 82, 58, 18,  2},{ 82,239,251,195},{1,0,0,0}},
+  {/*1*/{ 82, 58, 18,  6},{ 82,243,255,191},{2,0,0,0}},  {/*1*/{ 86, 58, 22,  2},{ 86,251,247,199},{1,0,0,0}},  {/*1*/{ 86, 62, 22,  2},{ 86,235,251,203},{0,0,0,0}},  {/*1*/{ 86, 62, 22,  6},{ 86,243,255,199},{1,0,0,0}},
+  {/*1*/{ 86, 62, 26,  2},{ 86,247,247,207},{2,0,0,0}},  {/*1*/{ 90, 62, 26,  6},{ 90,255,251,203},{1,0,0,0}},  {/*1*/{ 90, 66, 26,  2},{ 90,239,255,211},{0,0,0,0}},  {/*1*/{ 90, 66, 30,  2},{ 90,247,247,215},{1,0,0,0}},
+  {/*1*/{ 90, 66, 30,  6},{ 90,251,251,211},{2,0,0,0}},  {/*1*/{ 94, 70, 30,  2},{ 94,235,255,219},{1,0,0,0}},  {/*1*/{ 94, 70, 38,  6},{ 94,243,239,215},{0,0,0,0}},  {/*1*/{ 94, 70, 34,  2},{ 94,251,251,223},{1,0,0,0}},
+  {/*1*/{ 94, 70, 34,  2},{ 94,255,255,227},{2,0,0,0}},  {/*1*/{ 98, 74, 38,  6},{ 98,239,251,223},{1,0,0,0}},  {/*1*/{ 98, 74, 42,  2},{ 98,247,243,231},{0,0,0,0}},  {/*1*/{ 98, 74, 38,  6},{ 98,255,255,227},{1,0,0,0}},
+  {/*1*/{ 98, 78, 42,  2},{ 98,235,251,235},{2,0,0,0}},  {/*1*/{102, 78, 42,  2},{102,243,255,239},{1,0,0,0}},  {/*1*/{102, 78, 46,  6},{102,251,247,235},{0,0,0,0}},  {/*1*/{102, 82, 46,  2},{102,235,251,243},{1,0,0,0}},
+  {/*1*/{102, 82, 46,  6},{102,239,255,239},{2,0,0,0}},  {/*1*/{106, 82, 50,  2},{106,247,247,247},{1,0,0,0}},  {/*1*/{106, 82, 50, 10},{106,255,251,239},{0,0,0,0}},  {/*1*/{106, 86, 50,  2},{106,239,255,251},{1,0,0,0}},
+  {/*1*/{106, 86, 54,  2},{106,243,247,255},{2,0,0,0}},  {/*1*/{110, 86, 54,  6},{110,251,251,251},{1,0,0,0}},  {/*1*/{110, 90, 54, 14},{110,235,255,243},{0,0,0,0}},  {/*1*/{110, 90, 58,  6},{110,243,247,255},{1,0,0,0}},
+  {/*1*/{110, 90, 58, 14},{110,247,251,247},{2,0,0,0}},  {/*1*/{114, 90, 58, 10},{114,255,255,255},{1,0,0,0}},  {/*1*/{114, 94, 62, 18},{114,239,247,247},{0,0,0,0}},  {/*1*/{114, 94, 62, 14},{114,247,251,255},{1,0,0,0}},
+  {/*1*/{114, 94, 62, 18},{114,251,255,251},{2,0,0,0}},  {/*1*/{118, 98, 70, 18},{118,235,239,255},{1,0,0,0}},  {/*1*/{118, 98, 66, 22},{118,243,251,251},{0,0,0,0}},  {/*1*/{118, 98, 66, 26},{118,251,255,247},{1,0,0,0}},
+  {/*1*/{118, 98, 70, 22},{118,255,251,255},{2,0,0,0}},  {/*1*/{122,102, 74, 30},{122,239,243,247},{1,0,0,0}},  {/*1*/{122,102, 70, 26},{122,247,255,255},{0,0,0,0}},  {/*1*/{122,102, 74, 30},{122,255,251,251},{1,0,0,0}},
+  {/*1*/{122,106, 74, 30},{122,235,255,255},{2,0,0,0}},  {/*1*/{126,106, 78, 34},{126,243,247,251},{1,0,0,0}},  {/*1*/{126,106, 78, 38},{126,251,251,247},{0,0,0,0}},  {/*1*/{126,110, 78, 34},{126,231,255,255},{1,0,0,0}},
+  {/*1*/{126,110, 82, 42},{126,239,247,247},{2,0,0,0}},  {/*1*/{131,110, 82, 38},{131,247,251,255},{2,0,0,0}},  {/*1*/{131,110, 82, 42},{131,255,255,251},{1,0,0,0}},  {/*1*/{131,114, 86, 42},{131,235,247,255},{0,0,0,0}},
+  {/*1*/{131,114, 86, 46},{131,243,251,251},{1,0,0,0}},  {/*1*/{131,114, 86, 50},{131,251,255,247},{2,0,0,0}},  {/*1*/{135,118, 90, 46},{135,235,247,255},{1,0,0,0}},  {/*1*/{135,118, 90, 54},{135,239,251,247},{0,0,0,0}},
+  {/*1*/{135,118, 90, 50},{135,247,255,255},{1,0,0,0}},  {/*1*/{135,118, 94, 54},{135,255,247,251},{2,0,0,0}},  {/*1*/{139,122, 94, 54},{139,239,251,255},{1,0,0,0}},  {/*1*/{139,122, 94, 58},{139,243,255,251},{0,0,0,0}},
+  {/*1*/{139,122,102, 62},{139,251,239,247},{1,0,0,0}},  {/*1*/{139,126, 98, 58},{139,235,251,255},{2,0,0,0}},  {/*1*/{143,126, 98, 66},{143,243,255,247},{1,0,0,0}},  {/*1*/{143,126,102, 62},{143,247,251,255},{0,0,0,0}},
+  {/*1*/{143,126,106, 66},{143,255,243,251},{1,0,0,0}},  {/*1*/{143,131,102, 66},{143,231,255,255},{2,0,0,0}},  {/*1*/{147,131,106, 70},{147,239,251,251},{1,0,0,0}},  {/*1*/{147,131,106, 78},{147,247,255,243},{0,0,0,0}},
+  {/*1*/{147,131,110, 70},{147,255,247,255},{1,0,0,0}},  {/*1*/{147,135,110, 78},{147,235,251,247},{2,0,0,0}},  {/*1*/{151,135,110, 74},{151,243,255,255},{1,0,0,0}},  {/*1*/{151,135,114, 82},{151,251,247,247},{0,0,0,0}},
+  {/*1*/{151,139,114, 78},{151,235,251,255},{1,0,0,0}},  {/*1*/{151,139,114, 82},{151,239,255,251},{2,0,0,0}},  {/*1*/{155,139,118, 82},{155,247,247,255},{1,0,0,0}},  {/*1*/{155,139,118, 86},{155,255,251,251},{0,0,0,0}},
+  {/*1*/{155,143,118, 90},{155,239,255,247},{1,0,0,0}},  {/*1*/{155,143,122, 86},{155,243,247,255},{2,0,0,0}},  {/*1*/{159,143,122, 94},{159,251,251,247},{1,0,0,0}},  {/*1*/{159,147,122, 90},{159,235,255,255},{0,0,0,0}},
+  {/*1*/{159,147,126, 94},{159,243,247,251},{1,0,0,0}},  {/*1*/{159,147,126, 94},{159,247,251,255},{2,0,0,0}},  {/*1*/{163,147,126, 98},{163,255,255,251},{1,0,0,0}},  {/*1*/{163,151,131,102},{163,239,247,247},{0,0,0,0}},
+  {/*1*/{163,151,131, 98},{163,247,251,255},{1,0,0,0}},  {/*1*/{163,151,131,106},{163,251,255,247},{2,0,0,0}},  {/*1*/{167,155,135,102},{167,235,247,255},{1,0,0,0}},  {/*1*/{167,155,135,106},{167,243,251,251},{0,0,0,0}},
+  {/*1*/{167,155,135,106},{167,251,255,255},{1,0,0,0}},  {/*1*/{167,155,139,110},{167,255,247,251},{2,0,0,0}},  {/*1*/{171,159,139,114},{171,239,251,247},{1,0,0,0}},  {/*1*/{171,159,139,110},{171,247,255,255},{0,0,0,0}},
+  {/*1*/{171,159,143,118},{171,255,247,247},{1,0,0,0}},  {/*1*/{171,163,143,114},{171,235,251,255},{2,0,0,0}},  {/*1*/{175,163,143,118},{175,243,255,251},{1,0,0,0}},  {/*1*/{175,163,147,118},{175,251,247,255},{0,0,0,0}},
+  {/*1*/{175,167,147,122},{175,231,251,251},{1,0,0,0}},  {/*1*/{175,167,147,126},{175,239,255,247},{2,0,0,0}},  {/*1*/{179,167,151,122},{179,247,247,255},{1,0,0,0}},  {/*1*/{179,167,151,131},{179,255,251,247},{0,0,0,0}},
+  {/*1*/{179,171,151,126},{179,235,255,255},{1,0,0,0}},  {/*1*/{179,171,159,131},{179,243,239,251},{2,0,0,0}},  {/*1*/{183,171,155,135},{183,251,251,247},{1,0,0,0}},  {/*1*/{183,175,155,131},{183,235,255,255},{0,0,0,0}},
+  {/*1*/{183,175,159,139},{183,239,251,247},{1,0,0,0}},  {/*1*/{183,175,163,135},{183,247,243,255},{2,0,0,0}},  {/*1*/{187,175,159,139},{187,255,255,251},{1,0,0,0}},  {/*1*/{187,179,163,139},{187,239,251,255},{0,0,0,0}},
+  {/*1*/{187,179,163,143},{187,243,255,251},{1,0,0,0}},  {/*1*/{187,179,167,147},{187,251,247,247},{2,0,0,0}},  {/*1*/{191,183,167,143},{191,235,251,255},{1,0,0,0}},  {/*1*/{191,183,167,151},{191,243,255,247},{0,0,0,0}},
+  {/*1*/{191,183,171,147},{191,247,247,255},{1,0,0,0}},  {/*1*/{191,183,171,151},{191,255,251,251},{2,0,0,0}},  {/*1*/{195,187,171,151},{195,239,255,255},{1,0,0,0}},  {/*1*/{195,187,175,155},{195,247,247,251},{0,0,0,0}},
+  {/*1*/{195,187,175,159},{195,251,251,247},{1,0,0,0}},  {/*1*/{195,191,175,155},{195,235,255,255},{2,0,0,0}},  {/*1*/{199,191,179,163},{199,243,247,247},{1,0,0,0}},  {/*1*/{199,191,179,159},{199,251,251,255},{0,0,0,0}},
+  {/*1*/{199,191,179,163},{199,255,255,251},{1,0,0,0}},  {/*1*/{199,195,183,163},{199,239,247,255},{2,0,0,0}},  {/*1*/{203,195,183,167},{203,247,251,251},{1,0,0,0}},  {/*1*/{203,195,183,171},{203,255,255,247},{0,0,0,0}},
+  {/*1*/{203,199,191,167},{203,235,239,255},{1,0,0,0}},  {/*1*/{203,199,187,175},{203,243,251,247},{2,0,0,0}},  {/*1*/{207,199,187,171},{207,251,255,255},{1,0,0,0}},  {/*1*/{207,203,191,175},{207,235,251,251},{0,0,0,0}},
+  {/*1*/{207,203,195,175},{207,239,243,255},{1,0,0,0}},  {/*1*/{207,203,191,179},{207,247,255,251},{2,0,0,0}},  {/*1*/{211,203,195,183},{211,255,251,247},{1,0,0,0}},  {/*1*/{211,207,195,179},{211,239,255,255},{0,0,0,0}},
+  {/*1*/{211,207,199,187},{211,243,247,247},{1,0,0,0}},  {/*1*/{211,207,199,183},{211,251,251,255},{2,0,0,0}},  {/*1*/{215,211,199,187},{215,235,255,251},{1,0,0,0}},  {/*1*/{215,211,203,187},{215,243,247,255},{0,0,0,0}},
+  {/*1*/{215,211,203,191},{215,247,251,251},{1,0,0,0}},  {/*1*/{215,211,203,199},{215,255,255,243},{2,0,0,0}},  {/*1*/{219,215,207,191},{219,239,247,255},{1,0,0,0}},  {/*1*/{219,215,207,199},{219,247,251,247},{0,0,0,0}},
+  {/*1*/{219,215,207,195},{219,251,255,255},{1,0,0,0}},  {/*1*/{219,219,211,203},{219,235,247,247},{2,0,0,0}},  {/*1*/{223,219,211,199},{223,243,251,255},{1,0,0,0}},  {/*1*/{223,219,211,203},{223,251,255,251},{0,0,0,0}},
+  {/*1*/{223,219,215,203},{223,255,247,255},{1,0,0,0}},  {/*1*/{223,223,215,207},{223,239,251,251},{2,0,0,0}},  {/*1*/{227,223,215,211},{227,247,255,247},{1,0,0,0}},  {/*1*/{227,223,223,207},{227,255,239,255},{0,0,0,0}},
+  {/*1*/{227,227,219,215},{227,235,251,247},{1,0,0,0}},  {/*1*/{227,227,219,211},{227,243,255,255},{2,0,0,0}},  {/*1*/{231,227,223,215},{231,251,251,251},{1,0,0,0}},  {/*1*/{231,231,227,215},{231,231,243,255},{0,0,0,0}},
+  {/*1*/{231,231,223,219},{231,239,255,251},{1,0,0,0}},  {/*1*/{231,231,227,223},{231,247,251,247},{2,0,0,0}},  {/*1*/{235,231,227,219},{235,255,255,255},{1,0,0,0}},  {/*1*/{235,235,231,227},{235,235,247,247},{0,0,0,0}},
+  {/*1*/{235,235,231,223},{235,243,251,255},{1,0,0,0}},  {/*1*/{235,235,231,227},{235,251,255,251},{2,0,0,0}},  {/*1*/{239,239,235,227},{239,235,247,255},{1,0,0,0}},  {/*1*/{239,239,235,231},{239,239,251,251},{0,0,0,0}},
+  {/*1*/{239,239,235,235},{239,247,255,247},{1,0,0,0}},  {/*1*/{239,239,239,231},{239,255,247,255},{2,0,0,0}},  {/*1*/{243,243,239,239},{243,239,251,247},{1,0,0,0}},  {/*1*/{243,243,239,235},{243,243,255,255},{0,0,0,0}},
+  {/*1*/{243,243,243,239},{243,251,247,251},{1,0,0,0}},  {/*1*/{243,247,243,239},{243,239,251,255},{2,0,0,0}},  {/*1*/{247,247,243,243},{247,243,255,251},{1,0,0,0}},  {/*1*/{247,247,247,247},{247,247,247,247},{0,0,0,0}},
+  {/*1*/{247,247,247,243},{247,255,251,255},{1,0,0,0}},  {/*1*/{247,251,247,251},{247,243,255,247},{2,0,0,0}},  {/*1*/{251,251,255,247},{251,247,239,255},{1,0,0,0}},  {/*1*/{251,251,251,251},{251,251,251,251},{0,0,0,0}},
+  {/*1*/{251,255,251,251},{251,239,255,255},{1,0,0,0}},  {/*1*/{251,255,255,255},{251,247,251,251},{2,0,0,0}},  {/*1*/{255,255,255,255},{255,251,255,255},{1,0,1,1}},  {/*1*/{255,255,255,255},{255,255,255,255},{0,0,0,0}}
 }
 };
 
@@ -1489,699 +1489,699 @@ static PaletteSingleLookup4 const sp_lookup_6s1_8[2][256] =
 static PaletteSingleLookup8 const sp_lookup_7u1_16[4][256] =
 {
 {
-  {{/*1*/{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0},{  0,  0,0}}},  {{/*1*/{  0,  0,1},{  0, 16,0},{  0,  8,0},{  0,  6,0},{  0,  4,0},{  0,  4,0},{  0,  4,0},{  0,  4,0}}},  {{/*1*/{  2,  2,0},{  0, 32,0},{  0, 16,0},{  0, 10,0},{  0,  8,0},{  0,  8,0},{  0,  6,0},{  0,  6,0}}},  {{/*1*/{  2,  2,1},{  0, 48,0},{  0, 22,0},{  0, 16,0},{  0, 12,0},{  0, 10,0},{  0,  8,0},{  0,  8,0}}},
-  {{/*1*/{  4,  4,0},{  0, 64,0},{  0, 30,0},{  0, 20,0},{  0, 16,0},{  0, 14,0},{  0, 10,0},{  0, 10,0}}},  {{/*1*/{  4,  4,1},{  0, 80,0},{  0, 36,0},{  0, 26,0},{  0, 20,0},{  0, 16,0},{  0, 14,0},{  0, 12,0}}},  {{/*1*/{  6,  6,0},{  0, 96,0},{  0, 44,0},{  0, 30,0},{  0, 24,0},{  0, 20,0},{  0, 16,0},{  0, 14,0}}},  {{/*1*/{  6,  6,1},{  0,112,0},{  0, 50,0},{  0, 36,0},{  0, 28,0},{  0, 22,0},{  0, 18,0},{  0, 16,0}}},
-  {{/*1*/{  8,  8,0},{  0,128,0},{  0, 58,0},{  0, 40,0},{  0, 32,0},{  0, 26,0},{  0, 20,0},{  0, 18,0}}},  {{/*1*/{  8,  8,1},{  0,144,0},{  0, 64,0},{  0, 46,0},{  0, 34,0},{  0, 28,0},{  0, 24,0},{  0, 20,0}}},  {{/*1*/{ 10, 10,0},{  0,160,0},{  0, 72,0},{  0, 50,0},{  0, 38,0},{  0, 32,0},{  0, 26,0},{  0, 22,0}}},  {{/*1*/{ 10, 10,1},{  0,176,0},{  0, 80,0},{  0, 56,0},{  0, 42,0},{  0, 34,0},{  0, 28,0},{  0, 24,0}}},
-  {{/*1*/{ 12, 12,0},{  0,192,0},{  0, 86,0},{  0, 60,0},{  0, 46,0},{  0, 38,0},{  0, 30,0},{  0, 26,0}}},  {{/*1*/{ 12, 12,1},{  0,208,0},{  0, 94,0},{  0, 64,0},{  0, 50,0},{  0, 40,0},{  0, 32,0},{  0, 28,0}}},  {{/*1*/{ 14, 14,0},{  0,224,0},{  0,100,0},{  0, 70,0},{  0, 54,0},{  0, 44,0},{  0, 36,0},{  0, 30,0}}},  {{/*1*/{ 14, 14,1},{  0,240,0},{  0,108,0},{  0, 74,0},{  0, 58,0},{  0, 46,0},{  0, 38,0},{  0, 32,0}}},
-  {{/*1*/{ 16, 16,0},{  2,226,0},{  0,114,0},{  0, 80,0},{  0, 62,0},{  0, 50,0},{  0, 40,0},{  0, 36,0}}},  {{/*1*/{ 16, 16,1},{  2,242,0},{  0,122,0},{  0, 84,0},{  0, 64,0},{  0, 52,0},{  0, 42,0},{  0, 38,0}}},  {{/*1*/{ 18, 18,0},{  4,228,0},{  0,128,0},{  0, 90,0},{  0, 68,0},{  0, 56,0},{  0, 46,0},{  0, 40,0}}},  {{/*1*/{ 18, 18,1},{  4,244,0},{  0,136,0},{  0, 94,0},{  0, 72,0},{  0, 58,0},{  0, 48,0},{  0, 42,0}}},
-  {{/*1*/{ 20, 20,0},{  6,230,0},{  0,144,0},{  0,100,0},{  0, 76,0},{  0, 62,0},{  0, 50,0},{  0, 44,0}}},  {{/*1*/{ 20, 20,1},{  6,246,0},{  0,150,0},{  0,104,0},{  0, 80,0},{  0, 64,0},{  0, 52,0},{  0, 46,0}}},  {{/*1*/{ 22, 22,0},{  8,232,0},{  0,158,0},{  0,110,0},{  0, 84,0},{  0, 68,0},{  0, 56,0},{  0, 48,0}}},  {{/*1*/{ 22, 22,1},{  8,248,0},{  0,164,0},{  0,114,0},{  0, 88,0},{  0, 72,0},{  0, 58,0},{  0, 50,0}}},
-  {{/*1*/{ 24, 24,0},{ 10,234,0},{  0,172,0},{  0,120,0},{  0, 92,0},{  0, 74,0},{  0, 60,0},{  0, 52,0}}},  {{/*1*/{ 24, 24,1},{ 10,250,0},{  0,178,0},{  0,124,0},{  0, 96,0},{  0, 78,0},{  0, 62,0},{  0, 54,0}}},  {{/*1*/{ 26, 26,0},{ 12,236,0},{  0,186,0},{  0,128,0},{  0, 98,0},{  0, 80,0},{  0, 64,0},{  0, 56,0}}},  {{/*1*/{ 26, 26,1},{ 12,252,0},{  0,192,0},{  0,134,0},{  0,102,0},{  0, 84,0},{  0, 68,0},{  0, 58,0}}},
-  {{/*1*/{ 28, 28,0},{ 14,238,0},{  0,200,0},{  0,138,0},{  0,106,0},{  0, 86,0},{  0, 70,0},{  0, 60,0}}},  {{/*1*/{ 28, 28,1},{ 14,254,0},{  0,208,0},{  0,144,0},{  0,110,0},{  0, 90,0},{  0, 72,0},{  0, 62,0}}},  {{/*1*/{ 30, 30,0},{ 16,240,0},{  0,214,0},{  0,148,0},{  0,114,0},{  0, 92,0},{  0, 74,0},{  0, 64,0}}},  {{/*1*/{ 30, 30,1},{ 18,226,0},{  0,222,0},{  0,154,0},{  0,118,0},{  0, 96,0},{  0, 78,0},{  0, 68,0}}},
-  {{/*1*/{ 32, 32,0},{ 18,242,0},{  0,228,0},{  0,158,0},{  0,122,0},{  0, 98,0},{  0, 80,0},{  0, 70,0}}},  {{/*1*/{ 32, 32,1},{ 20,228,0},{  0,236,0},{  0,164,0},{  0,126,0},{  0,102,0},{  0, 82,0},{  0, 72,0}}},  {{/*1*/{ 34, 34,0},{ 20,244,0},{  0,242,0},{  0,168,0},{  0,128,0},{  0,104,0},{  0, 84,0},{  0, 74,0}}},  {{/*1*/{ 34, 34,1},{ 22,230,0},{  0,250,0},{  0,174,0},{  0,132,0},{  0,108,0},{  0, 88,0},{  0, 76,0}}},
-  {{/*1*/{ 36, 36,0},{ 22,246,0},{  2,244,0},{  0,178,0},{  0,136,0},{  0,110,0},{  0, 90,0},{  0, 78,0}}},  {{/*1*/{ 36, 36,1},{ 24,232,0},{  2,252,0},{  0,184,0},{  0,140,0},{  0,114,0},{  0, 92,0},{  0, 80,0}}},  {{/*1*/{ 38, 38,0},{ 24,248,0},{  4,246,0},{  0,188,0},{  0,144,0},{  0,116,0},{  0, 94,0},{  0, 82,0}}},  {{/*1*/{ 38, 38,1},{ 26,234,0},{  4,254,0},{  0,192,0},{  0,148,0},{  0,120,0},{  0, 96,0},{  0, 84,0}}},
-  {{/*1*/{ 40, 40,0},{ 26,250,0},{  6,248,0},{  0,198,0},{  0,152,0},{  0,122,0},{  0,100,0},{  0, 86,0}}},  {{/*1*/{ 40, 40,1},{ 28,236,0},{  8,244,0},{  0,202,0},{  0,156,0},{  0,126,0},{  0,102,0},{  0, 88,0}}},  {{/*1*/{ 42, 42,0},{ 28,252,0},{  8,250,0},{  0,208,0},{  0,160,0},{  0,128,0},{  0,104,0},{  0, 90,0}}},  {{/*1*/{ 42, 42,1},{ 30,238,0},{ 10,246,0},{  0,212,0},{  0,162,0},{  0,132,0},{  0,106,0},{  0, 92,0}}},
-  {{/*1*/{ 44, 44,0},{ 30,254,0},{ 10,252,0},{  0,218,0},{  0,166,0},{  0,136,0},{  0,110,0},{  0, 94,0}}},  {{/*1*/{ 44, 44,1},{ 32,240,0},{ 12,248,0},{  0,222,0},{  0,170,0},{  0,138,0},{  0,112,0},{  0, 96,0}}},  {{/*1*/{ 46, 46,0},{ 34,226,0},{ 12,254,0},{  0,228,0},{  0,174,0},{  0,142,0},{  0,114,0},{  0,100,0}}},  {{/*1*/{ 46, 46,1},{ 34,242,0},{ 14,250,0},{  0,232,0},{  0,178,0},{  0,144,0},{  0,116,0},{  0,102,0}}},
-  {{/*1*/{ 48, 48,0},{ 36,228,0},{ 16,244,0},{  0,238,0},{  0,182,0},{  0,148,0},{  0,120,0},{  0,104,0}}},  {{/*1*/{ 48, 48,1},{ 36,244,0},{ 16,252,0},{  0,242,0},{  0,186,0},{  0,150,0},{  0,122,0},{  0,106,0}}},  {{/*1*/{ 50, 50,0},{ 38,230,0},{ 18,246,0},{  0,248,0},{  0,190,0},{  0,154,0},{  0,124,0},{  0,108,0}}},  {{/*1*/{ 50, 50,1},{ 38,246,0},{ 18,254,0},{  0,252,0},{  0,192,0},{  0,156,0},{  0,126,0},{  0,110,0}}},
-  {{/*1*/{ 52, 52,0},{ 40,232,0},{ 20,248,0},{  2,250,0},{  0,196,0},{  0,160,0},{  0,128,0},{  0,112,0}}},  {{/*1*/{ 52, 52,1},{ 40,248,0},{ 22,244,0},{  2,254,0},{  0,200,0},{  0,162,0},{  0,132,0},{  0,114,0}}},  {{/*1*/{ 54, 54,0},{ 42,234,0},{ 22,250,0},{  4,252,0},{  0,204,0},{  0,166,0},{  0,134,0},{  0,116,0}}},  {{/*1*/{ 54, 54,1},{ 42,250,0},{ 24,246,0},{  6,248,0},{  0,208,0},{  0,168,0},{  0,136,0},{  0,118,0}}},
-  {{/*1*/{ 56, 56,0},{ 44,236,0},{ 24,252,0},{  6,254,0},{  0,212,0},{  0,172,0},{  0,138,0},{  0,120,0}}},  {{/*1*/{ 56, 56,1},{ 44,252,0},{ 26,248,0},{  8,250,0},{  0,216,0},{  0,174,0},{  0,142,0},{  0,122,0}}},  {{/*1*/{ 58, 58,0},{ 46,238,0},{ 26,254,0},{ 10,248,0},{  0,220,0},{  0,178,0},{  0,144,0},{  0,124,0}}},  {{/*1*/{ 58, 58,1},{ 46,254,0},{ 28,250,0},{ 10,252,0},{  0,224,0},{  0,180,0},{  0,146,0},{  0,126,0}}},
-  {{/*1*/{ 60, 60,0},{ 48,240,0},{ 30,244,0},{ 12,250,0},{  0,226,0},{  0,184,0},{  0,148,0},{  0,128,0}}},  {{/*1*/{ 60, 60,1},{ 50,226,0},{ 30,252,0},{ 12,254,0},{  0,230,0},{  0,186,0},{  0,152,0},{  0,132,0}}},  {{/*1*/{ 62, 62,0},{ 50,242,0},{ 32,246,0},{ 14,252,0},{  0,234,0},{  0,190,0},{  0,154,0},{  0,134,0}}},  {{/*1*/{ 62, 62,1},{ 52,228,0},{ 32,254,0},{ 16,248,0},{  0,238,0},{  0,192,0},{  0,156,0},{  0,136,0}}},
-  {{/*1*/{ 64, 64,0},{ 52,244,0},{ 34,248,0},{ 16,254,0},{  0,242,0},{  0,196,0},{  0,158,0},{  0,138,0}}},  {{/*1*/{ 64, 64,1},{ 54,230,0},{ 36,244,0},{ 18,250,0},{  0,246,0},{  0,200,0},{  0,160,0},{  0,140,0}}},  {{/*1*/{ 66, 66,0},{ 54,246,0},{ 36,250,0},{ 20,248,0},{  0,250,0},{  0,202,0},{  0,164,0},{  0,142,0}}},  {{/*1*/{ 66, 66,1},{ 56,232,0},{ 38,246,0},{ 20,252,0},{  0,254,0},{  0,206,0},{  0,166,0},{  0,144,0}}},
-  {{/*1*/{ 68, 68,0},{ 56,248,0},{ 38,252,0},{ 22,250,0},{  2,252,0},{  0,208,0},{  0,168,0},{  0,146,0}}},  {{/*1*/{ 68, 68,1},{ 58,234,0},{ 40,248,0},{ 22,254,0},{  4,250,0},{  0,212,0},{  0,170,0},{  0,148,0}}},  {{/*1*/{ 70, 70,0},{ 58,250,0},{ 40,254,0},{ 24,252,0},{  4,254,0},{  0,214,0},{  0,174,0},{  0,150,0}}},  {{/*1*/{ 70, 70,1},{ 60,236,0},{ 42,250,0},{ 26,248,0},{  6,252,0},{  0,218,0},{  0,176,0},{  0,152,0}}},
-  {{/*1*/{ 72, 72,0},{ 60,252,0},{ 44,244,0},{ 26,254,0},{  8,250,0},{  0,220,0},{  0,178,0},{  0,154,0}}},  {{/*1*/{ 72, 72,1},{ 62,238,0},{ 44,252,0},{ 28,250,0},{  8,254,0},{  0,224,0},{  0,180,0},{  0,156,0}}},  {{/*1*/{ 74, 74,0},{ 62,254,0},{ 46,246,0},{ 30,248,0},{ 10,252,0},{  0,226,0},{  0,184,0},{  0,158,0}}},  {{/*1*/{ 74, 74,1},{ 64,240,0},{ 46,254,0},{ 30,252,0},{ 12,250,0},{  0,230,0},{  0,186,0},{  0,160,0}}},
-  {{/*1*/{ 76, 76,0},{ 66,226,0},{ 48,248,0},{ 32,250,0},{ 12,254,0},{  0,232,0},{  0,188,0},{  0,164,0}}},  {{/*1*/{ 76, 76,1},{ 66,242,0},{ 50,242,0},{ 32,254,0},{ 14,252,0},{  0,236,0},{  0,190,0},{  0,166,0}}},  {{/*1*/{ 78, 78,0},{ 68,228,0},{ 50,250,0},{ 34,252,0},{ 16,250,0},{  0,238,0},{  0,192,0},{  0,168,0}}},  {{/*1*/{ 78, 78,1},{ 68,244,0},{ 52,244,0},{ 36,248,0},{ 16,254,0},{  0,242,0},{  0,196,0},{  0,170,0}}},
-  {{/*1*/{ 80, 80,0},{ 70,230,0},{ 52,252,0},{ 36,254,0},{ 18,252,0},{  0,244,0},{  0,198,0},{  0,172,0}}},  {{/*1*/{ 80, 80,1},{ 70,246,0},{ 54,246,0},{ 38,250,0},{ 20,250,0},{  0,248,0},{  0,200,0},{  0,174,0}}},  {{/*1*/{ 82, 82,0},{ 72,232,0},{ 54,254,0},{ 40,248,0},{ 20,254,0},{  0,250,0},{  0,202,0},{  0,176,0}}},  {{/*1*/{ 82, 82,1},{ 72,248,0},{ 56,248,0},{ 40,252,0},{ 22,252,0},{  0,254,0},{  0,206,0},{  0,178,0}}},
-  {{/*1*/{ 84, 84,0},{ 74,234,0},{ 58,244,0},{ 42,250,0},{ 24,250,0},{  2,252,0},{  0,208,0},{  0,180,0}}},  {{/*1*/{ 84, 84,1},{ 74,250,0},{ 58,250,0},{ 42,254,0},{ 24,254,0},{  4,252,0},{  0,210,0},{  0,182,0}}},  {{/*1*/{ 86, 86,0},{ 76,236,0},{ 60,246,0},{ 44,252,0},{ 26,252,0},{  4,254,0},{  0,212,0},{  0,184,0}}},  {{/*1*/{ 86, 86,1},{ 76,252,0},{ 60,252,0},{ 46,248,0},{ 28,252,0},{  6,254,0},{  0,216,0},{  0,186,0}}},
-  {{/*1*/{ 88, 88,0},{ 78,238,0},{ 62,248,0},{ 46,254,0},{ 28,254,0},{  8,252,0},{  0,218,0},{  0,188,0}}},  {{/*1*/{ 88, 88,1},{ 78,254,0},{ 62,254,0},{ 48,250,0},{ 30,254,0},{ 10,252,0},{  0,220,0},{  0,190,0}}},  {{/*1*/{ 90, 90,0},{ 80,240,0},{ 64,250,0},{ 50,248,0},{ 32,252,0},{ 10,254,0},{  0,222,0},{  0,192,0}}},  {{/*1*/{ 90, 90,1},{ 82,226,0},{ 66,244,0},{ 50,252,0},{ 34,250,0},{ 12,254,0},{  0,224,0},{  0,196,0}}},
-  {{/*1*/{ 92, 92,0},{ 82,242,0},{ 66,252,0},{ 52,250,0},{ 34,254,0},{ 14,252,0},{  0,228,0},{  0,198,0}}},  {{/*1*/{ 92, 92,1},{ 84,228,0},{ 68,246,0},{ 52,254,0},{ 36,252,0},{ 16,252,0},{  0,230,0},{  0,200,0}}},  {{/*1*/{ 94, 94,0},{ 84,244,0},{ 68,254,0},{ 54,252,0},{ 38,250,0},{ 16,254,0},{  0,232,0},{  0,202,0}}},  {{/*1*/{ 94, 94,1},{ 86,230,0},{ 70,248,0},{ 56,248,0},{ 38,254,0},{ 18,254,0},{  0,234,0},{  0,204,0}}},
-  {{/*1*/{ 96, 96,0},{ 86,246,0},{ 72,244,0},{ 56,254,0},{ 40,252,0},{ 20,252,0},{  0,238,0},{  0,206,0}}},  {{/*1*/{ 96, 96,1},{ 88,232,0},{ 72,250,0},{ 58,250,0},{ 42,250,0},{ 22,252,0},{  0,240,0},{  0,208,0}}},  {{/*1*/{ 98, 98,0},{ 88,248,0},{ 74,246,0},{ 60,248,0},{ 42,254,0},{ 22,254,0},{  0,242,0},{  0,210,0}}},  {{/*1*/{ 98, 98,1},{ 90,234,0},{ 74,252,0},{ 60,252,0},{ 44,252,0},{ 24,254,0},{  0,244,0},{  0,212,0}}},
-  {{/*1*/{100,100,0},{ 90,250,0},{ 76,248,0},{ 62,250,0},{ 46,250,0},{ 26,252,0},{  0,248,0},{  0,214,0}}},  {{/*1*/{100,100,1},{ 92,236,0},{ 76,254,0},{ 62,254,0},{ 46,254,0},{ 28,252,0},{  0,250,0},{  0,216,0}}},  {{/*1*/{102,102,0},{ 92,252,0},{ 78,250,0},{ 64,252,0},{ 48,252,0},{ 28,254,0},{  0,252,0},{  0,218,0}}},  {{/*1*/{102,102,1},{ 94,238,0},{ 80,244,0},{ 66,250,0},{ 50,250,0},{ 30,254,0},{  0,254,0},{  0,220,0}}},
-  {{/*1*/{104,104,0},{ 94,254,0},{ 80,252,0},{ 66,254,0},{ 50,254,0},{ 32,252,0},{  2,254,0},{  0,222,0}}},  {{/*1*/{104,104,1},{ 96,240,0},{ 82,246,0},{ 68,252,0},{ 52,252,0},{ 34,252,0},{  4,254,0},{  0,224,0}}},  {{/*1*/{106,106,0},{ 98,226,0},{ 82,254,0},{ 70,248,0},{ 54,250,0},{ 34,254,0},{  6,254,0},{  0,228,0}}},  {{/*1*/{106,106,1},{ 98,242,0},{ 84,248,0},{ 70,254,0},{ 54,254,0},{ 36,254,0},{  8,252,0},{  0,230,0}}},
-  {{/*1*/{108,108,0},{100,228,0},{ 86,244,0},{ 72,250,0},{ 56,252,0},{ 38,252,0},{ 10,252,0},{  0,232,0}}},  {{/*1*/{108,108,1},{100,244,0},{ 86,250,0},{ 74,248,0},{ 58,250,0},{ 40,252,0},{ 10,254,0},{  0,234,0}}},  {{/*1*/{110,110,0},{102,230,0},{ 88,246,0},{ 74,252,0},{ 58,254,0},{ 40,254,0},{ 12,254,0},{  0,236,0}}},  {{/*1*/{110,110,1},{102,246,0},{ 88,252,0},{ 76,250,0},{ 60,252,0},{ 42,254,0},{ 14,254,0},{  0,238,0}}},
-  {{/*1*/{112,112,0},{104,232,0},{ 90,248,0},{ 76,254,0},{ 62,252,0},{ 44,252,0},{ 16,254,0},{  0,240,0}}},  {{/*1*/{112,112,1},{104,248,0},{ 90,254,0},{ 78,252,0},{ 62,254,0},{ 46,252,0},{ 18,252,0},{  0,242,0}}},  {{/*1*/{114,114,0},{106,234,0},{ 92,250,0},{ 80,248,0},{ 64,254,0},{ 46,254,0},{ 20,252,0},{  0,244,0}}},  {{/*1*/{114,114,1},{106,250,0},{ 94,244,0},{ 80,254,0},{ 66,252,0},{ 48,254,0},{ 20,254,0},{  0,246,0}}},
-  {{/*1*/{116,116,0},{108,236,0},{ 94,252,0},{ 82,250,0},{ 68,250,0},{ 50,252,0},{ 22,254,0},{  0,248,0}}},  {{/*1*/{116,116,1},{108,252,0},{ 96,246,0},{ 84,248,0},{ 68,254,0},{ 52,252,0},{ 24,254,0},{  0,250,0}}},  {{/*1*/{118,118,0},{110,238,0},{ 96,254,0},{ 84,252,0},{ 70,252,0},{ 52,254,0},{ 26,254,0},{  0,252,0}}},  {{/*1*/{118,118,1},{110,254,0},{ 98,248,0},{ 86,250,0},{ 72,250,0},{ 54,254,0},{ 28,252,0},{  0,254,0}}},
-  {{/*1*/{120,120,0},{112,240,0},{100,244,0},{ 86,254,0},{ 72,254,0},{ 56,252,0},{ 30,252,0},{  2,254,0}}},  {{/*1*/{120,120,1},{114,226,0},{100,250,0},{ 88,252,0},{ 74,252,0},{ 58,250,0},{ 30,254,0},{  4,254,0}}},  {{/*1*/{122,122,0},{114,242,0},{102,246,0},{ 90,248,0},{ 76,250,0},{ 58,254,0},{ 32,254,0},{  6,254,0}}},  {{/*1*/{122,122,1},{116,228,0},{102,252,0},{ 90,254,0},{ 76,254,0},{ 60,252,0},{ 34,254,0},{  8,254,0}}},
-  {{/*1*/{124,124,0},{116,244,0},{104,248,0},{ 92,250,0},{ 78,252,0},{ 62,252,0},{ 36,254,0},{ 10,254,0}}},  {{/*1*/{124,124,1},{118,230,0},{104,254,0},{ 94,248,0},{ 80,250,0},{ 62,254,0},{ 38,254,0},{ 12,254,0}}},  {{/*1*/{126,126,0},{118,246,0},{106,250,0},{ 94,252,0},{ 80,254,0},{ 64,254,0},{ 40,252,0},{ 14,254,0}}},  {{/*1*/{126,126,1},{120,232,0},{108,244,0},{ 96,250,0},{ 82,252,0},{ 66,252,0},{ 42,252,0},{ 16,254,0}}},
-  {{/*1*/{128,128,0},{120,248,0},{108,252,0},{ 96,254,0},{ 84,250,0},{ 68,252,0},{ 42,254,0},{ 18,254,0}}},  {{/*1*/{128,128,1},{122,234,0},{110,246,0},{ 98,252,0},{ 84,254,0},{ 68,254,0},{ 44,254,0},{ 20,254,0}}},  {{/*1*/{130,130,0},{122,250,0},{110,254,0},{100,248,0},{ 86,252,0},{ 70,254,0},{ 46,254,0},{ 22,254,0}}},  {{/*1*/{130,130,1},{124,236,0},{112,248,0},{100,254,0},{ 88,250,0},{ 72,252,0},{ 48,254,0},{ 24,254,0}}},
-  {{/*1*/{132,132,0},{124,252,0},{114,242,0},{102,250,0},{ 88,254,0},{ 74,252,0},{ 50,252,0},{ 26,254,0}}},  {{/*1*/{132,132,1},{126,238,0},{114,250,0},{104,248,0},{ 90,252,0},{ 74,254,0},{ 52,252,0},{ 28,252,0}}},  {{/*1*/{134,134,0},{126,254,0},{116,244,0},{104,252,0},{ 92,252,0},{ 76,254,0},{ 52,254,0},{ 30,252,0}}},  {{/*1*/{134,134,1},{128,240,0},{116,252,0},{106,250,0},{ 92,254,0},{ 78,252,0},{ 54,254,0},{ 30,254,0}}},
-  {{/*1*/{136,136,0},{130,226,0},{118,246,0},{106,254,0},{ 94,254,0},{ 80,252,0},{ 56,254,0},{ 32,254,0}}},  {{/*1*/{136,136,1},{130,242,0},{118,254,0},{108,252,0},{ 96,252,0},{ 80,254,0},{ 58,254,0},{ 34,254,0}}},  {{/*1*/{138,138,0},{132,228,0},{120,248,0},{110,248,0},{ 98,250,0},{ 82,254,0},{ 60,252,0},{ 36,254,0}}},  {{/*1*/{138,138,1},{132,244,0},{122,244,0},{110,254,0},{ 98,254,0},{ 84,252,0},{ 62,252,0},{ 38,254,0}}},
-  {{/*1*/{140,140,0},{134,230,0},{122,250,0},{112,250,0},{100,252,0},{ 86,252,0},{ 62,254,0},{ 40,254,0}}},  {{/*1*/{140,140,1},{134,246,0},{124,246,0},{114,248,0},{102,250,0},{ 86,254,0},{ 64,254,0},{ 42,254,0}}},  {{/*1*/{142,142,0},{136,232,0},{124,252,0},{114,252,0},{102,254,0},{ 88,254,0},{ 66,254,0},{ 44,254,0}}},  {{/*1*/{142,142,1},{136,248,0},{126,248,0},{116,250,0},{104,252,0},{ 90,252,0},{ 68,254,0},{ 46,254,0}}},
-  {{/*1*/{144,144,0},{138,234,0},{126,254,0},{116,254,0},{106,250,0},{ 92,252,0},{ 70,254,0},{ 48,254,0}}},  {{/*1*/{144,144,1},{138,250,0},{128,250,0},{118,252,0},{106,254,0},{ 92,254,0},{ 72,252,0},{ 50,254,0}}},  {{/*1*/{146,146,0},{140,236,0},{130,244,0},{120,248,0},{108,252,0},{ 94,254,0},{ 74,252,0},{ 52,254,0}}},  {{/*1*/{146,146,1},{140,252,0},{130,252,0},{120,254,0},{110,250,0},{ 96,252,0},{ 74,254,0},{ 54,254,0}}},
-  {{/*1*/{148,148,0},{142,238,0},{132,246,0},{122,250,0},{110,254,0},{ 98,252,0},{ 76,254,0},{ 56,254,0}}},  {{/*1*/{148,148,1},{142,254,0},{132,254,0},{124,248,0},{112,252,0},{ 98,254,0},{ 78,254,0},{ 58,254,0}}},  {{/*1*/{150,150,0},{144,240,0},{134,248,0},{124,252,0},{114,250,0},{100,254,0},{ 80,254,0},{ 60,252,0}}},  {{/*1*/{150,150,1},{146,226,0},{136,244,0},{126,250,0},{114,254,0},{102,252,0},{ 82,252,0},{ 62,252,0}}},
-  {{/*1*/{152,152,0},{146,242,0},{136,250,0},{126,254,0},{116,252,0},{104,252,0},{ 84,252,0},{ 62,254,0}}},  {{/*1*/{152,152,1},{148,228,0},{138,246,0},{128,252,0},{118,250,0},{104,254,0},{ 84,254,0},{ 64,254,0}}},  {{/*1*/{154,154,0},{148,244,0},{138,252,0},{130,250,0},{118,254,0},{106,254,0},{ 86,254,0},{ 66,254,0}}},  {{/*1*/{154,154,1},{150,230,0},{140,248,0},{130,254,0},{120,252,0},{108,252,0},{ 88,254,0},{ 68,254,0}}},
-  {{/*1*/{156,156,0},{150,246,0},{140,254,0},{132,252,0},{122,250,0},{110,252,0},{ 90,254,0},{ 70,254,0}}},  {{/*1*/{156,156,1},{152,232,0},{142,250,0},{134,248,0},{122,254,0},{110,254,0},{ 92,252,0},{ 72,254,0}}},  {{/*1*/{158,158,0},{152,248,0},{144,244,0},{134,254,0},{124,252,0},{112,254,0},{ 94,252,0},{ 74,254,0}}},  {{/*1*/{158,158,1},{154,234,0},{144,252,0},{136,250,0},{126,252,0},{114,252,0},{ 94,254,0},{ 76,254,0}}},
-  {{/*1*/{160,160,0},{154,250,0},{146,246,0},{138,248,0},{126,254,0},{116,252,0},{ 96,254,0},{ 78,254,0}}},  {{/*1*/{160,160,1},{156,236,0},{146,254,0},{138,252,0},{128,254,0},{116,254,0},{ 98,254,0},{ 80,254,0}}},  {{/*1*/{162,162,0},{156,252,0},{148,248,0},{140,250,0},{130,252,0},{118,254,0},{100,254,0},{ 82,254,0}}},  {{/*1*/{162,162,1},{158,238,0},{150,244,0},{140,254,0},{132,250,0},{120,252,0},{102,254,0},{ 84,254,0}}},
-  {{/*1*/{164,164,0},{158,254,0},{150,250,0},{142,252,0},{132,254,0},{122,250,0},{104,252,0},{ 86,254,0}}},  {{/*1*/{164,164,1},{160,240,0},{152,246,0},{144,248,0},{134,252,0},{122,254,0},{106,252,0},{ 88,254,0}}},  {{/*1*/{166,166,0},{162,226,0},{152,252,0},{144,254,0},{136,250,0},{124,252,0},{106,254,0},{ 90,254,0}}},  {{/*1*/{166,166,1},{162,242,0},{154,248,0},{146,250,0},{136,254,0},{126,252,0},{108,254,0},{ 92,252,0}}},
-  {{/*1*/{168,168,0},{164,228,0},{154,254,0},{148,248,0},{138,252,0},{126,254,0},{110,254,0},{ 94,252,0}}},  {{/*1*/{168,168,1},{164,244,0},{156,250,0},{148,252,0},{140,250,0},{128,254,0},{112,254,0},{ 94,254,0}}},  {{/*1*/{170,170,0},{166,230,0},{158,244,0},{150,250,0},{140,254,0},{130,252,0},{114,252,0},{ 96,254,0}}},  {{/*1*/{170,170,1},{166,246,0},{158,252,0},{150,254,0},{142,252,0},{132,252,0},{116,252,0},{ 98,254,0}}},
-  {{/*1*/{172,172,0},{168,232,0},{160,246,0},{152,252,0},{144,250,0},{132,254,0},{116,254,0},{100,254,0}}},  {{/*1*/{172,172,1},{168,248,0},{160,254,0},{154,248,0},{144,254,0},{134,254,0},{118,254,0},{102,254,0}}},  {{/*1*/{174,174,0},{170,234,0},{162,248,0},{154,254,0},{146,252,0},{136,252,0},{120,254,0},{104,254,0}}},  {{/*1*/{174,174,1},{170,250,0},{164,244,0},{156,250,0},{148,250,0},{138,252,0},{122,254,0},{106,254,0}}},
-  {{/*1*/{176,176,0},{172,236,0},{164,250,0},{158,248,0},{148,254,0},{138,254,0},{124,252,0},{108,254,0}}},  {{/*1*/{176,176,1},{172,252,0},{166,246,0},{158,252,0},{150,252,0},{140,254,0},{126,252,0},{110,254,0}}},  {{/*1*/{178,178,0},{174,238,0},{166,252,0},{160,250,0},{152,250,0},{142,252,0},{126,254,0},{112,254,0}}},  {{/*1*/{178,178,1},{174,254,0},{168,248,0},{160,254,0},{152,254,0},{144,252,0},{128,254,0},{114,254,0}}},
-  {{/*1*/{180,180,0},{176,240,0},{168,254,0},{162,252,0},{154,252,0},{144,254,0},{130,254,0},{116,254,0}}},  {{/*1*/{180,180,1},{178,226,0},{170,250,0},{164,248,0},{156,252,0},{146,254,0},{132,254,0},{118,254,0}}},  {{/*1*/{182,182,0},{178,242,0},{172,244,0},{164,254,0},{156,254,0},{148,252,0},{134,254,0},{120,254,0}}},  {{/*1*/{182,182,1},{180,228,0},{172,252,0},{166,250,0},{158,254,0},{150,252,0},{136,252,0},{122,254,0}}},
-  {{/*1*/{184,184,0},{180,244,0},{174,246,0},{168,248,0},{160,252,0},{150,254,0},{138,252,0},{124,252,0}}},  {{/*1*/{184,184,1},{182,230,0},{174,254,0},{168,252,0},{162,250,0},{152,254,0},{138,254,0},{126,252,0}}},  {{/*1*/{186,186,0},{182,246,0},{176,248,0},{170,250,0},{162,254,0},{154,252,0},{140,254,0},{126,254,0}}},  {{/*1*/{186,186,1},{184,232,0},{178,242,0},{170,254,0},{164,252,0},{156,252,0},{142,254,0},{128,254,0}}},
-  {{/*1*/{188,188,0},{184,248,0},{178,250,0},{172,252,0},{166,250,0},{156,254,0},{144,254,0},{130,254,0}}},  {{/*1*/{188,188,1},{186,234,0},{180,244,0},{174,248,0},{166,254,0},{158,254,0},{146,252,0},{132,254,0}}},  {{/*1*/{190,190,0},{186,250,0},{180,252,0},{174,254,0},{168,252,0},{160,252,0},{148,252,0},{134,254,0}}},  {{/*1*/{190,190,1},{188,236,0},{182,246,0},{176,250,0},{170,250,0},{162,252,0},{148,254,0},{136,254,0}}},
-  {{/*1*/{192,192,0},{188,252,0},{182,254,0},{178,248,0},{170,254,0},{162,254,0},{150,254,0},{138,254,0}}},  {{/*1*/{192,192,1},{190,238,0},{184,248,0},{178,252,0},{172,252,0},{164,254,0},{152,254,0},{140,254,0}}},  {{/*1*/{194,194,0},{190,254,0},{186,244,0},{180,250,0},{174,250,0},{166,252,0},{154,254,0},{142,254,0}}},  {{/*1*/{194,194,1},{192,240,0},{186,250,0},{180,254,0},{174,254,0},{168,252,0},{156,252,0},{144,254,0}}},
-  {{/*1*/{196,196,0},{194,226,0},{188,246,0},{182,252,0},{176,252,0},{168,254,0},{158,252,0},{146,254,0}}},  {{/*1*/{196,196,1},{194,242,0},{188,252,0},{184,248,0},{178,250,0},{170,254,0},{158,254,0},{148,254,0}}},  {{/*1*/{198,198,0},{196,228,0},{190,248,0},{184,254,0},{178,254,0},{172,252,0},{160,254,0},{150,254,0}}},  {{/*1*/{198,198,1},{196,244,0},{190,254,0},{186,250,0},{180,252,0},{174,252,0},{162,254,0},{152,254,0}}},
-  {{/*1*/{200,200,0},{198,230,0},{192,250,0},{188,248,0},{182,250,0},{174,254,0},{164,254,0},{154,254,0}}},  {{/*1*/{200,200,1},{198,246,0},{194,244,0},{188,252,0},{182,254,0},{176,254,0},{166,254,0},{156,252,0}}},  {{/*1*/{202,202,0},{200,232,0},{194,252,0},{190,250,0},{184,252,0},{178,252,0},{168,252,0},{158,252,0}}},  {{/*1*/{202,202,1},{200,248,0},{196,246,0},{190,254,0},{186,250,0},{180,252,0},{170,252,0},{158,254,0}}},
-  {{/*1*/{204,204,0},{202,234,0},{196,254,0},{192,252,0},{186,254,0},{180,254,0},{170,254,0},{160,254,0}}},  {{/*1*/{204,204,1},{202,250,0},{198,248,0},{194,250,0},{188,252,0},{182,254,0},{172,254,0},{162,254,0}}},  {{/*1*/{206,206,0},{204,236,0},{200,244,0},{194,254,0},{190,252,0},{184,252,0},{174,254,0},{164,254,0}}},  {{/*1*/{206,206,1},{204,252,0},{200,250,0},{196,252,0},{190,254,0},{186,250,0},{176,254,0},{166,254,0}}},
-  {{/*1*/{208,208,0},{206,238,0},{202,246,0},{198,248,0},{192,254,0},{186,254,0},{178,252,0},{168,254,0}}},  {{/*1*/{208,208,1},{206,254,0},{202,252,0},{198,254,0},{194,252,0},{188,252,0},{180,252,0},{170,254,0}}},  {{/*1*/{210,210,0},{208,240,0},{204,248,0},{200,250,0},{196,250,0},{190,252,0},{180,254,0},{172,254,0}}},  {{/*1*/{210,210,1},{210,226,0},{204,254,0},{202,248,0},{196,254,0},{190,254,0},{182,254,0},{174,254,0}}},
-  {{/*1*/{212,212,0},{210,242,0},{206,250,0},{202,252,0},{198,252,0},{192,254,0},{184,254,0},{176,254,0}}},  {{/*1*/{212,212,1},{212,228,0},{208,244,0},{204,250,0},{200,250,0},{194,252,0},{186,254,0},{178,254,0}}},  {{/*1*/{214,214,0},{212,244,0},{208,252,0},{204,254,0},{200,254,0},{196,252,0},{188,252,0},{180,254,0}}},  {{/*1*/{214,214,1},{214,230,0},{210,246,0},{206,252,0},{202,252,0},{196,254,0},{190,252,0},{182,254,0}}},
-  {{/*1*/{216,216,0},{214,246,0},{210,254,0},{208,248,0},{204,250,0},{198,254,0},{190,254,0},{184,254,0}}},  {{/*1*/{216,216,1},{216,232,0},{212,248,0},{208,254,0},{204,254,0},{200,252,0},{192,254,0},{186,254,0}}},  {{/*1*/{218,218,0},{216,248,0},{214,244,0},{210,250,0},{206,252,0},{202,252,0},{194,254,0},{188,252,0}}},  {{/*1*/{218,218,1},{218,234,0},{214,250,0},{212,248,0},{208,250,0},{202,254,0},{196,254,0},{190,252,0}}},
-  {{/*1*/{220,220,0},{218,250,0},{216,246,0},{212,252,0},{208,254,0},{204,254,0},{198,254,0},{190,254,0}}},  {{/*1*/{220,220,1},{220,236,0},{216,252,0},{214,250,0},{210,252,0},{206,252,0},{200,252,0},{192,254,0}}},  {{/*1*/{222,222,0},{220,252,0},{218,248,0},{214,254,0},{212,250,0},{208,252,0},{202,252,0},{194,254,0}}},  {{/*1*/{222,222,1},{222,238,0},{218,254,0},{216,252,0},{212,254,0},{208,254,0},{202,254,0},{196,254,0}}},
-  {{/*1*/{224,224,0},{222,254,0},{220,250,0},{218,248,0},{214,252,0},{210,254,0},{204,254,0},{198,254,0}}},  {{/*1*/{224,224,1},{224,240,0},{222,244,0},{218,254,0},{216,250,0},{212,252,0},{206,254,0},{200,254,0}}},  {{/*1*/{226,226,0},{226,226,0},{222,252,0},{220,250,0},{216,254,0},{214,252,0},{208,254,0},{202,254,0}}},  {{/*1*/{226,226,1},{226,242,0},{224,246,0},{222,248,0},{218,252,0},{214,254,0},{210,252,0},{204,254,0}}},
-  {{/*1*/{228,228,0},{228,228,0},{224,254,0},{222,252,0},{220,252,0},{216,254,0},{212,252,0},{206,254,0}}},  {{/*1*/{228,228,1},{228,244,0},{226,248,0},{224,250,0},{220,254,0},{218,252,0},{212,254,0},{208,254,0}}},  {{/*1*/{230,230,0},{230,230,0},{228,244,0},{224,254,0},{222,254,0},{220,252,0},{214,254,0},{210,254,0}}},  {{/*1*/{230,230,1},{230,246,0},{228,250,0},{226,252,0},{224,252,0},{220,254,0},{216,254,0},{212,254,0}}},
-  {{/*1*/{232,232,0},{232,232,0},{230,246,0},{228,248,0},{226,250,0},{222,254,0},{218,254,0},{214,254,0}}},  {{/*1*/{232,232,1},{232,248,0},{230,252,0},{228,254,0},{226,254,0},{224,252,0},{220,252,0},{216,254,0}}},  {{/*1*/{234,234,0},{234,234,0},{232,248,0},{230,250,0},{228,252,0},{226,252,0},{222,252,0},{218,254,0}}},  {{/*1*/{234,234,1},{234,250,0},{232,254,0},{232,248,0},{230,250,0},{226,254,0},{222,254,0},{220,252,0}}},
-  {{/*1*/{236,236,0},{236,236,0},{234,250,0},{232,252,0},{230,254,0},{228,254,0},{224,254,0},{222,252,0}}},  {{/*1*/{236,236,1},{236,252,0},{236,244,0},{234,250,0},{232,252,0},{230,252,0},{226,254,0},{222,254,0}}},  {{/*1*/{238,238,0},{238,238,0},{236,252,0},{234,254,0},{234,250,0},{232,252,0},{228,254,0},{224,254,0}}},  {{/*1*/{238,238,1},{238,254,0},{238,246,0},{236,252,0},{234,254,0},{232,254,0},{230,254,0},{226,254,0}}},
-  {{/*1*/{240,240,0},{240,240,0},{238,254,0},{238,248,0},{236,252,0},{234,254,0},{232,252,0},{228,254,0}}},  {{/*1*/{240,240,1},{242,240,0},{240,248,0},{238,254,0},{238,250,0},{236,252,0},{234,252,0},{230,254,0}}},  {{/*1*/{242,242,0},{242,242,0},{242,242,0},{240,250,0},{238,254,0},{238,252,0},{234,254,0},{232,254,0}}},  {{/*1*/{242,242,1},{244,242,0},{242,250,0},{242,248,0},{240,252,0},{238,254,0},{236,254,0},{234,254,0}}},
-  {{/*1*/{244,244,0},{244,244,0},{244,244,0},{242,252,0},{242,250,0},{240,254,0},{238,254,0},{236,254,0}}},  {{/*1*/{244,244,1},{246,244,0},{244,252,0},{244,250,0},{242,254,0},{242,252,0},{240,254,0},{238,254,0}}},  {{/*1*/{246,246,0},{246,246,0},{246,246,0},{244,254,0},{244,252,0},{244,252,0},{242,252,0},{240,254,0}}},  {{/*1*/{246,246,1},{248,246,0},{246,254,0},{246,252,0},{246,250,0},{244,254,0},{244,252,0},{242,254,0}}},
-  {{/*1*/{248,248,0},{248,248,0},{248,248,0},{248,248,0},{246,254,0},{246,254,0},{244,254,0},{244,254,0}}},  {{/*1*/{248,248,1},{250,248,0},{250,248,0},{248,254,0},{248,252,0},{248,252,0},{246,254,0},{246,254,0}}},  {{/*1*/{250,250,0},{250,250,0},{250,250,0},{250,250,0},{250,250,0},{250,250,0},{248,254,0},{248,254,0}}},  {{/*1*/{250,250,1},{252,250,0},{252,250,0},{252,250,0},{250,254,0},{250,254,0},{250,254,0},{250,254,0}}},
-  {{/*1*/{252,252,0},{252,252,0},{252,252,0},{252,252,0},{252,252,0},{252,252,0},{252,252,0},{252,252,0}}},  {{/*1*/{252,252,1},{254,252,0},{254,252,0},{254,252,0},{254,252,0},{254,252,0},{254,252,0},{254,252,0}}},  {{/*1*/{254,254,0},{254,254,0},{254,254,0},{254,254,0},{254,254,0},{254,254,0},{254,254,0},{254,254,0}}},  {{/*1*/{254,254,1},{254,254,1},{254,254,1},{254,254,1},{254,254,1},{254,254,1},{254,254,1},{254,254,1}}}
+  {/*1*/{  0,  0,  0,  0,  0,  0,  0,  0},{  0,  0,  0,  0,  0,  0,  0,  0},{0,0,0,0,0,0,0,0}},  {/*1*/{  0,  0,  0,  0,  0,  0,  0,  0},{  0, 16,  8,  6,  4,  4,  4,  4},{1,0,0,0,0,0,0,0}},  {/*1*/{  2,  0,  0,  0,  0,  0,  0,  0},{  2, 32, 16, 10,  8,  8,  6,  6},{0,0,0,0,0,0,0,0}},  {/*1*/{  2,  0,  0,  0,  0,  0,  0,  0},{  2, 48, 22, 16, 12, 10,  8,  8},{1,0,0,0,0,0,0,0}},
+  {/*1*/{  4,  0,  0,  0,  0,  0,  0,  0},{  4, 64, 30, 20, 16, 14, 10, 10},{0,0,0,0,0,0,0,0}},  {/*1*/{  4,  0,  0,  0,  0,  0,  0,  0},{  4, 80, 36, 26, 20, 16, 14, 12},{1,0,0,0,0,0,0,0}},  {/*1*/{  6,  0,  0,  0,  0,  0,  0,  0},{  6, 96, 44, 30, 24, 20, 16, 14},{0,0,0,0,0,0,0,0}},  {/*1*/{  6,  0,  0,  0,  0,  0,  0,  0},{  6,112, 50, 36, 28, 22, 18, 16},{1,0,0,0,0,0,0,0}},
+  {/*1*/{  8,  0,  0,  0,  0,  0,  0,  0},{  8,128, 58, 40, 32, 26, 20, 18},{0,0,0,0,0,0,0,0}},  {/*1*/{  8,  0,  0,  0,  0,  0,  0,  0},{  8,144, 64, 46, 34, 28, 24, 20},{1,0,0,0,0,0,0,0}},  {/*1*/{ 10,  0,  0,  0,  0,  0,  0,  0},{ 10,160, 72, 50, 38, 32, 26, 22},{0,0,0,0,0,0,0,0}},  {/*1*/{ 10,  0,  0,  0,  0,  0,  0,  0},{ 10,176, 80, 56, 42, 34, 28, 24},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 12,  0,  0,  0,  0,  0,  0,  0},{ 12,192, 86, 60, 46, 38, 30, 26},{0,0,0,0,0,0,0,0}},  {/*1*/{ 12,  0,  0,  0,  0,  0,  0,  0},{ 12,208, 94, 64, 50, 40, 32, 28},{1,0,0,0,0,0,0,0}},  {/*1*/{ 14,  0,  0,  0,  0,  0,  0,  0},{ 14,224,100, 70, 54, 44, 36, 30},{0,0,0,0,0,0,0,0}},  {/*1*/{ 14,  0,  0,  0,  0,  0,  0,  0},{ 14,240,108, 74, 58, 46, 38, 32},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 16,  2,  0,  0,  0,  0,  0,  0},{ 16,226,114, 80, 62, 50, 40, 36},{0,0,0,0,0,0,0,0}},  {/*1*/{ 16,  2,  0,  0,  0,  0,  0,  0},{ 16,242,122, 84, 64, 52, 42, 38},{1,0,0,0,0,0,0,0}},  {/*1*/{ 18,  4,  0,  0,  0,  0,  0,  0},{ 18,228,128, 90, 68, 56, 46, 40},{0,0,0,0,0,0,0,0}},  {/*1*/{ 18,  4,  0,  0,  0,  0,  0,  0},{ 18,244,136, 94, 72, 58, 48, 42},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 20,  6,  0,  0,  0,  0,  0,  0},{ 20,230,144,100, 76, 62, 50, 44},{0,0,0,0,0,0,0,0}},  {/*1*/{ 20,  6,  0,  0,  0,  0,  0,  0},{ 20,246,150,104, 80, 64, 52, 46},{1,0,0,0,0,0,0,0}},  {/*1*/{ 22,  8,  0,  0,  0,  0,  0,  0},{ 22,232,158,110, 84, 68, 56, 48},{0,0,0,0,0,0,0,0}},  {/*1*/{ 22,  8,  0,  0,  0,  0,  0,  0},{ 22,248,164,114, 88, 72, 58, 50},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 24, 10,  0,  0,  0,  0,  0,  0},{ 24,234,172,120, 92, 74, 60, 52},{0,0,0,0,0,0,0,0}},  {/*1*/{ 24, 10,  0,  0,  0,  0,  0,  0},{ 24,250,178,124, 96, 78, 62, 54},{1,0,0,0,0,0,0,0}},  {/*1*/{ 26, 12,  0,  0,  0,  0,  0,  0},{ 26,236,186,128, 98, 80, 64, 56},{0,0,0,0,0,0,0,0}},  {/*1*/{ 26, 12,  0,  0,  0,  0,  0,  0},{ 26,252,192,134,102, 84, 68, 58},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 28, 14,  0,  0,  0,  0,  0,  0},{ 28,238,200,138,106, 86, 70, 60},{0,0,0,0,0,0,0,0}},  {/*1*/{ 28, 14,  0,  0,  0,  0,  0,  0},{ 28,254,208,144,110, 90, 72, 62},{1,0,0,0,0,0,0,0}},  {/*1*/{ 30, 16,  0,  0,  0,  0,  0,  0},{ 30,240,214,148,114, 92, 74, 64},{0,0,0,0,0,0,0,0}},  {/*1*/{ 30, 18,  0,  0,  0,  0,  0,  0},{ 30,226,222,154,118, 96, 78, 68},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 32, 18,  0,  0,  0,  0,  0,  0},{ 32,242,228,158,122, 98, 80, 70},{0,0,0,0,0,0,0,0}},  {/*1*/{ 32, 20,  0,  0,  0,  0,  0,  0},{ 32,228,236,164,126,102, 82, 72},{1,0,0,0,0,0,0,0}},  {/*1*/{ 34, 20,  0,  0,  0,  0,  0,  0},{ 34,244,242,168,128,104, 84, 74},{0,0,0,0,0,0,0,0}},  {/*1*/{ 34, 22,  0,  0,  0,  0,  0,  0},{ 34,230,250,174,132,108, 88, 76},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 36, 22,  2,  0,  0,  0,  0,  0},{ 36,246,244,178,136,110, 90, 78},{0,0,0,0,0,0,0,0}},  {/*1*/{ 36, 24,  2,  0,  0,  0,  0,  0},{ 36,232,252,184,140,114, 92, 80},{1,0,0,0,0,0,0,0}},  {/*1*/{ 38, 24,  4,  0,  0,  0,  0,  0},{ 38,248,246,188,144,116, 94, 82},{0,0,0,0,0,0,0,0}},  {/*1*/{ 38, 26,  4,  0,  0,  0,  0,  0},{ 38,234,254,192,148,120, 96, 84},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 40, 26,  6,  0,  0,  0,  0,  0},{ 40,250,248,198,152,122,100, 86},{0,0,0,0,0,0,0,0}},  {/*1*/{ 40, 28,  8,  0,  0,  0,  0,  0},{ 40,236,244,202,156,126,102, 88},{1,0,0,0,0,0,0,0}},  {/*1*/{ 42, 28,  8,  0,  0,  0,  0,  0},{ 42,252,250,208,160,128,104, 90},{0,0,0,0,0,0,0,0}},  {/*1*/{ 42, 30, 10,  0,  0,  0,  0,  0},{ 42,238,246,212,162,132,106, 92},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 44, 30, 10,  0,  0,  0,  0,  0},{ 44,254,252,218,166,136,110, 94},{0,0,0,0,0,0,0,0}},  {/*1*/{ 44, 32, 12,  0,  0,  0,  0,  0},{ 44,240,248,222,170,138,112, 96},{1,0,0,0,0,0,0,0}},  {/*1*/{ 46, 34, 12,  0,  0,  0,  0,  0},{ 46,226,254,228,174,142,114,100},{0,0,0,0,0,0,0,0}},  {/*1*/{ 46, 34, 14,  0,  0,  0,  0,  0},{ 46,242,250,232,178,144,116,102},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 48, 36, 16,  0,  0,  0,  0,  0},{ 48,228,244,238,182,148,120,104},{0,0,0,0,0,0,0,0}},  {/*1*/{ 48, 36, 16,  0,  0,  0,  0,  0},{ 48,244,252,242,186,150,122,106},{1,0,0,0,0,0,0,0}},  {/*1*/{ 50, 38, 18,  0,  0,  0,  0,  0},{ 50,230,246,248,190,154,124,108},{0,0,0,0,0,0,0,0}},  {/*1*/{ 50, 38, 18,  0,  0,  0,  0,  0},{ 50,246,254,252,192,156,126,110},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 52, 40, 20,  2,  0,  0,  0,  0},{ 52,232,248,250,196,160,128,112},{0,0,0,0,0,0,0,0}},  {/*1*/{ 52, 40, 22,  2,  0,  0,  0,  0},{ 52,248,244,254,200,162,132,114},{1,0,0,0,0,0,0,0}},  {/*1*/{ 54, 42, 22,  4,  0,  0,  0,  0},{ 54,234,250,252,204,166,134,116},{0,0,0,0,0,0,0,0}},  {/*1*/{ 54, 42, 24,  6,  0,  0,  0,  0},{ 54,250,246,248,208,168,136,118},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 56, 44, 24,  6,  0,  0,  0,  0},{ 56,236,252,254,212,172,138,120},{0,0,0,0,0,0,0,0}},  {/*1*/{ 56, 44, 26,  8,  0,  0,  0,  0},{ 56,252,248,250,216,174,142,122},{1,0,0,0,0,0,0,0}},  {/*1*/{ 58, 46, 26, 10,  0,  0,  0,  0},{ 58,238,254,248,220,178,144,124},{0,0,0,0,0,0,0,0}},  {/*1*/{ 58, 46, 28, 10,  0,  0,  0,  0},{ 58,254,250,252,224,180,146,126},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 60, 48, 30, 12,  0,  0,  0,  0},{ 60,240,244,250,226,184,148,128},{0,0,0,0,0,0,0,0}},  {/*1*/{ 60, 50, 30, 12,  0,  0,  0,  0},{ 60,226,252,254,230,186,152,132},{1,0,0,0,0,0,0,0}},  {/*1*/{ 62, 50, 32, 14,  0,  0,  0,  0},{ 62,242,246,252,234,190,154,134},{0,0,0,0,0,0,0,0}},  {/*1*/{ 62, 52, 32, 16,  0,  0,  0,  0},{ 62,228,254,248,238,192,156,136},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 64, 52, 34, 16,  0,  0,  0,  0},{ 64,244,248,254,242,196,158,138},{0,0,0,0,0,0,0,0}},  {/*1*/{ 64, 54, 36, 18,  0,  0,  0,  0},{ 64,230,244,250,246,200,160,140},{1,0,0,0,0,0,0,0}},  {/*1*/{ 66, 54, 36, 20,  0,  0,  0,  0},{ 66,246,250,248,250,202,164,142},{0,0,0,0,0,0,0,0}},  {/*1*/{ 66, 56, 38, 20,  0,  0,  0,  0},{ 66,232,246,252,254,206,166,144},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 68, 56, 38, 22,  2,  0,  0,  0},{ 68,248,252,250,252,208,168,146},{0,0,0,0,0,0,0,0}},  {/*1*/{ 68, 58, 40, 22,  4,  0,  0,  0},{ 68,234,248,254,250,212,170,148},{1,0,0,0,0,0,0,0}},  {/*1*/{ 70, 58, 40, 24,  4,  0,  0,  0},{ 70,250,254,252,254,214,174,150},{0,0,0,0,0,0,0,0}},  {/*1*/{ 70, 60, 42, 26,  6,  0,  0,  0},{ 70,236,250,248,252,218,176,152},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 72, 60, 44, 26,  8,  0,  0,  0},{ 72,252,244,254,250,220,178,154},{0,0,0,0,0,0,0,0}},  {/*1*/{ 72, 62, 44, 28,  8,  0,  0,  0},{ 72,238,252,250,254,224,180,156},{1,0,0,0,0,0,0,0}},  {/*1*/{ 74, 62, 46, 30, 10,  0,  0,  0},{ 74,254,246,248,252,226,184,158},{0,0,0,0,0,0,0,0}},  {/*1*/{ 74, 64, 46, 30, 12,  0,  0,  0},{ 74,240,254,252,250,230,186,160},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 76, 66, 48, 32, 12,  0,  0,  0},{ 76,226,248,250,254,232,188,164},{0,0,0,0,0,0,0,0}},  {/*1*/{ 76, 66, 50, 32, 14,  0,  0,  0},{ 76,242,242,254,252,236,190,166},{1,0,0,0,0,0,0,0}},  {/*1*/{ 78, 68, 50, 34, 16,  0,  0,  0},{ 78,228,250,252,250,238,192,168},{0,0,0,0,0,0,0,0}},  {/*1*/{ 78, 68, 52, 36, 16,  0,  0,  0},{ 78,244,244,248,254,242,196,170},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 80, 70, 52, 36, 18,  0,  0,  0},{ 80,230,252,254,252,244,198,172},{0,0,0,0,0,0,0,0}},  {/*1*/{ 80, 70, 54, 38, 20,  0,  0,  0},{ 80,246,246,250,250,248,200,174},{1,0,0,0,0,0,0,0}},  {/*1*/{ 82, 72, 54, 40, 20,  0,  0,  0},{ 82,232,254,248,254,250,202,176},{0,0,0,0,0,0,0,0}},  {/*1*/{ 82, 72, 56, 40, 22,  0,  0,  0},{ 82,248,248,252,252,254,206,178},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 84, 74, 58, 42, 24,  2,  0,  0},{ 84,234,244,250,250,252,208,180},{0,0,0,0,0,0,0,0}},  {/*1*/{ 84, 74, 58, 42, 24,  4,  0,  0},{ 84,250,250,254,254,252,210,182},{1,0,0,0,0,0,0,0}},  {/*1*/{ 86, 76, 60, 44, 26,  4,  0,  0},{ 86,236,246,252,252,254,212,184},{0,0,0,0,0,0,0,0}},  {/*1*/{ 86, 76, 60, 46, 28,  6,  0,  0},{ 86,252,252,248,252,254,216,186},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 88, 78, 62, 46, 28,  8,  0,  0},{ 88,238,248,254,254,252,218,188},{0,0,0,0,0,0,0,0}},  {/*1*/{ 88, 78, 62, 48, 30, 10,  0,  0},{ 88,254,254,250,254,252,220,190},{1,0,0,0,0,0,0,0}},  {/*1*/{ 90, 80, 64, 50, 32, 10,  0,  0},{ 90,240,250,248,252,254,222,192},{0,0,0,0,0,0,0,0}},  {/*1*/{ 90, 82, 66, 50, 34, 12,  0,  0},{ 90,226,244,252,250,254,224,196},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 92, 82, 66, 52, 34, 14,  0,  0},{ 92,242,252,250,254,252,228,198},{0,0,0,0,0,0,0,0}},  {/*1*/{ 92, 84, 68, 52, 36, 16,  0,  0},{ 92,228,246,254,252,252,230,200},{1,0,0,0,0,0,0,0}},  {/*1*/{ 94, 84, 68, 54, 38, 16,  0,  0},{ 94,244,254,252,250,254,232,202},{0,0,0,0,0,0,0,0}},  {/*1*/{ 94, 86, 70, 56, 38, 18,  0,  0},{ 94,230,248,248,254,254,234,204},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 96, 86, 72, 56, 40, 20,  0,  0},{ 96,246,244,254,252,252,238,206},{0,0,0,0,0,0,0,0}},  {/*1*/{ 96, 88, 72, 58, 42, 22,  0,  0},{ 96,232,250,250,250,252,240,208},{1,0,0,0,0,0,0,0}},  {/*1*/{ 98, 88, 74, 60, 42, 22,  0,  0},{ 98,248,246,248,254,254,242,210},{0,0,0,0,0,0,0,0}},  {/*1*/{ 98, 90, 74, 60, 44, 24,  0,  0},{ 98,234,252,252,252,254,244,212},{1,0,0,0,0,0,0,0}},
+  {/*1*/{100, 90, 76, 62, 46, 26,  0,  0},{100,250,248,250,250,252,248,214},{0,0,0,0,0,0,0,0}},  {/*1*/{100, 92, 76, 62, 46, 28,  0,  0},{100,236,254,254,254,252,250,216},{1,0,0,0,0,0,0,0}},  {/*1*/{102, 92, 78, 64, 48, 28,  0,  0},{102,252,250,252,252,254,252,218},{0,0,0,0,0,0,0,0}},  {/*1*/{102, 94, 80, 66, 50, 30,  0,  0},{102,238,244,250,250,254,254,220},{1,0,0,0,0,0,0,0}},
+  {/*1*/{104, 94, 80, 66, 50, 32,  2,  0},{104,254,252,254,254,252,254,222},{0,0,0,0,0,0,0,0}},  {/*1*/{104, 96, 82, 68, 52, 34,  4,  0},{104,240,246,252,252,252,254,224},{1,0,0,0,0,0,0,0}},  {/*1*/{106, 98, 82, 70, 54, 34,  6,  0},{106,226,254,248,250,254,254,228},{0,0,0,0,0,0,0,0}},  {/*1*/{106, 98, 84, 70, 54, 36,  8,  0},{106,242,248,254,254,254,252,230},{1,0,0,0,0,0,0,0}},
+  {/*1*/{108,100, 86, 72, 56, 38, 10,  0},{108,228,244,250,252,252,252,232},{0,0,0,0,0,0,0,0}},  {/*1*/{108,100, 86, 74, 58, 40, 10,  0},{108,244,250,248,250,252,254,234},{1,0,0,0,0,0,0,0}},  {/*1*/{110,102, 88, 74, 58, 40, 12,  0},{110,230,246,252,254,254,254,236},{0,0,0,0,0,0,0,0}},  {/*1*/{110,102, 88, 76, 60, 42, 14,  0},{110,246,252,250,252,254,254,238},{1,0,0,0,0,0,0,0}},
+  {/*1*/{112,104, 90, 76, 62, 44, 16,  0},{112,232,248,254,252,252,254,240},{0,0,0,0,0,0,0,0}},  {/*1*/{112,104, 90, 78, 62, 46, 18,  0},{112,248,254,252,254,252,252,242},{1,0,0,0,0,0,0,0}},  {/*1*/{114,106, 92, 80, 64, 46, 20,  0},{114,234,250,248,254,254,252,244},{0,0,0,0,0,0,0,0}},  {/*1*/{114,106, 94, 80, 66, 48, 20,  0},{114,250,244,254,252,254,254,246},{1,0,0,0,0,0,0,0}},
+  {/*1*/{116,108, 94, 82, 68, 50, 22,  0},{116,236,252,250,250,252,254,248},{0,0,0,0,0,0,0,0}},  {/*1*/{116,108, 96, 84, 68, 52, 24,  0},{116,252,246,248,254,252,254,250},{1,0,0,0,0,0,0,0}},  {/*1*/{118,110, 96, 84, 70, 52, 26,  0},{118,238,254,252,252,254,254,252},{0,0,0,0,0,0,0,0}},  {/*1*/{118,110, 98, 86, 72, 54, 28,  0},{118,254,248,250,250,254,252,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{120,112,100, 86, 72, 56, 30,  2},{120,240,244,254,254,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{120,114,100, 88, 74, 58, 30,  4},{120,226,250,252,252,250,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{122,114,102, 90, 76, 58, 32,  6},{122,242,246,248,250,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{122,116,102, 90, 76, 60, 34,  8},{122,228,252,254,254,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{124,116,104, 92, 78, 62, 36, 10},{124,244,248,250,252,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{124,118,104, 94, 80, 62, 38, 12},{124,230,254,248,250,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{126,118,106, 94, 80, 64, 40, 14},{126,246,250,252,254,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{126,120,108, 96, 82, 66, 42, 16},{126,232,244,250,252,252,252,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{128,120,108, 96, 84, 68, 42, 18},{128,248,252,254,250,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{128,122,110, 98, 84, 68, 44, 20},{128,234,246,252,254,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{130,122,110,100, 86, 70, 46, 22},{130,250,254,248,252,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{130,124,112,100, 88, 72, 48, 24},{130,236,248,254,250,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{132,124,114,102, 88, 74, 50, 26},{132,252,242,250,254,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{132,126,114,104, 90, 74, 52, 28},{132,238,250,248,252,254,252,252},{1,0,0,0,0,0,0,0}},  {/*1*/{134,126,116,104, 92, 76, 52, 30},{134,254,244,252,252,254,254,252},{0,0,0,0,0,0,0,0}},  {/*1*/{134,128,116,106, 92, 78, 54, 30},{134,240,252,250,254,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{136,130,118,106, 94, 80, 56, 32},{136,226,246,254,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{136,130,118,108, 96, 80, 58, 34},{136,242,254,252,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{138,132,120,110, 98, 82, 60, 36},{138,228,248,248,250,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{138,132,122,110, 98, 84, 62, 38},{138,244,244,254,254,252,252,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{140,134,122,112,100, 86, 62, 40},{140,230,250,250,252,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{140,134,124,114,102, 86, 64, 42},{140,246,246,248,250,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{142,136,124,114,102, 88, 66, 44},{142,232,252,252,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{142,136,126,116,104, 90, 68, 46},{142,248,248,250,252,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{144,138,126,116,106, 92, 70, 48},{144,234,254,254,250,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{144,138,128,118,106, 92, 72, 50},{144,250,250,252,254,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{146,140,130,120,108, 94, 74, 52},{146,236,244,248,252,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{146,140,130,120,110, 96, 74, 54},{146,252,252,254,250,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{148,142,132,122,110, 98, 76, 56},{148,238,246,250,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{148,142,132,124,112, 98, 78, 58},{148,254,254,248,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{150,144,134,124,114,100, 80, 60},{150,240,248,252,250,254,254,252},{0,0,0,0,0,0,0,0}},  {/*1*/{150,146,136,126,114,102, 82, 62},{150,226,244,250,254,252,252,252},{1,0,0,0,0,0,0,0}},
+  {/*1*/{152,146,136,126,116,104, 84, 62},{152,242,250,254,252,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{152,148,138,128,118,104, 84, 64},{152,228,246,252,250,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{154,148,138,130,118,106, 86, 66},{154,244,252,250,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{154,150,140,130,120,108, 88, 68},{154,230,248,254,252,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{156,150,140,132,122,110, 90, 70},{156,246,254,252,250,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{156,152,142,134,122,110, 92, 72},{156,232,250,248,254,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{158,152,144,134,124,112, 94, 74},{158,248,244,254,252,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{158,154,144,136,126,114, 94, 76},{158,234,252,250,252,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{160,154,146,138,126,116, 96, 78},{160,250,246,248,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{160,156,146,138,128,116, 98, 80},{160,236,254,252,254,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{162,156,148,140,130,118,100, 82},{162,252,248,250,252,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{162,158,150,140,132,120,102, 84},{162,238,244,254,250,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{164,158,150,142,132,122,104, 86},{164,254,250,252,254,250,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{164,160,152,144,134,122,106, 88},{164,240,246,248,252,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{166,162,152,144,136,124,106, 90},{166,226,252,254,250,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{166,162,154,146,136,126,108, 92},{166,242,248,250,254,252,254,252},{1,0,0,0,0,0,0,0}},
+  {/*1*/{168,164,154,148,138,126,110, 94},{168,228,254,248,252,254,254,252},{0,0,0,0,0,0,0,0}},  {/*1*/{168,164,156,148,140,128,112, 94},{168,244,250,252,250,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{170,166,158,150,140,130,114, 96},{170,230,244,250,254,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{170,166,158,150,142,132,116, 98},{170,246,252,254,252,252,252,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{172,168,160,152,144,132,116,100},{172,232,246,252,250,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{172,168,160,154,144,134,118,102},{172,248,254,248,254,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{174,170,162,154,146,136,120,104},{174,234,248,254,252,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{174,170,164,156,148,138,122,106},{174,250,244,250,250,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{176,172,164,158,148,138,124,108},{176,236,250,248,254,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{176,172,166,158,150,140,126,110},{176,252,246,252,252,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{178,174,166,160,152,142,126,112},{178,238,252,250,250,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{178,174,168,160,152,144,128,114},{178,254,248,254,254,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{180,176,168,162,154,144,130,116},{180,240,254,252,252,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{180,178,170,164,156,146,132,118},{180,226,250,248,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{182,178,172,164,156,148,134,120},{182,242,244,254,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{182,180,172,166,158,150,136,122},{182,228,252,250,254,252,252,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{184,180,174,168,160,150,138,124},{184,244,246,248,252,254,252,252},{0,0,0,0,0,0,0,0}},  {/*1*/{184,182,174,168,162,152,138,126},{184,230,254,252,250,254,254,252},{1,0,0,0,0,0,0,0}},  {/*1*/{186,182,176,170,162,154,140,126},{186,246,248,250,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{186,184,178,170,164,156,142,128},{186,232,242,254,252,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{188,184,178,172,166,156,144,130},{188,248,250,252,250,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{188,186,180,174,166,158,146,132},{188,234,244,248,254,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{190,186,180,174,168,160,148,134},{190,250,252,254,252,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{190,188,182,176,170,162,148,136},{190,236,246,250,250,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{192,188,182,178,170,162,150,138},{192,252,254,248,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{192,190,184,178,172,164,152,140},{192,238,248,252,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{194,190,186,180,174,166,154,142},{194,254,244,250,250,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{194,192,186,180,174,168,156,144},{194,240,250,254,254,252,252,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{196,194,188,182,176,168,158,146},{196,226,246,252,252,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{196,194,188,184,178,170,158,148},{196,242,252,248,250,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{198,196,190,184,178,172,160,150},{198,228,248,254,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{198,196,190,186,180,174,162,152},{198,244,254,250,252,252,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{200,198,192,188,182,174,164,154},{200,230,250,248,250,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{200,198,194,188,182,176,166,156},{200,246,244,252,254,254,254,252},{1,0,0,0,0,0,0,0}},  {/*1*/{202,200,194,190,184,178,168,158},{202,232,252,250,252,252,252,252},{0,0,0,0,0,0,0,0}},  {/*1*/{202,200,196,190,186,180,170,158},{202,248,246,254,250,252,252,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{204,202,196,192,186,180,170,160},{204,234,254,252,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{204,202,198,194,188,182,172,162},{204,250,248,250,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{206,204,200,194,190,184,174,164},{206,236,244,254,252,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{206,204,200,196,190,186,176,166},{206,252,250,252,254,250,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{208,206,202,198,192,186,178,168},{208,238,246,248,254,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{208,206,202,198,194,188,180,170},{208,254,252,254,252,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{210,208,204,200,196,190,180,172},{210,240,248,250,250,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{210,210,204,202,196,190,182,174},{210,226,254,248,254,254,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{212,210,206,202,198,192,184,176},{212,242,250,252,252,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{212,212,208,204,200,194,186,178},{212,228,244,250,250,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{214,212,208,204,200,196,188,180},{214,244,252,254,254,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{214,214,210,206,202,196,190,182},{214,230,246,252,252,254,252,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{216,214,210,208,204,198,190,184},{216,246,254,248,250,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{216,216,212,208,204,200,192,186},{216,232,248,254,254,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{218,216,214,210,206,202,194,188},{218,248,244,250,252,252,254,252},{0,0,0,0,0,0,0,0}},  {/*1*/{218,218,214,212,208,202,196,190},{218,234,250,248,250,254,254,252},{1,0,0,0,0,0,0,0}},
+  {/*1*/{220,218,216,212,208,204,198,190},{220,250,246,252,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{220,220,216,214,210,206,200,192},{220,236,252,250,252,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{222,220,218,214,212,208,202,194},{222,252,248,254,250,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{222,222,218,216,212,208,202,196},{222,238,254,252,254,254,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{224,222,220,218,214,210,204,198},{224,254,250,248,252,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{224,224,222,218,216,212,206,200},{224,240,244,254,250,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{226,226,222,220,216,214,208,202},{226,226,252,250,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{226,226,224,222,218,214,210,204},{226,242,246,248,252,254,252,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{228,228,224,222,220,216,212,206},{228,228,254,252,252,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{228,228,226,224,220,218,212,208},{228,244,248,250,254,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{230,230,228,224,222,220,214,210},{230,230,244,254,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{230,230,228,226,224,220,216,212},{230,246,250,252,252,254,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{232,232,230,228,226,222,218,214},{232,232,246,248,250,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{232,232,230,228,226,224,220,216},{232,248,252,254,254,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{234,234,232,230,228,226,222,218},{234,234,248,250,252,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{234,234,232,232,230,226,222,220},{234,250,254,248,250,254,254,252},{1,0,0,0,0,0,0,0}},
+  {/*1*/{236,236,234,232,230,228,224,222},{236,236,250,252,254,254,254,252},{0,0,0,0,0,0,0,0}},  {/*1*/{236,236,236,234,232,230,226,222},{236,252,244,250,252,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{238,238,236,234,234,232,228,224},{238,238,252,254,250,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{238,238,238,236,234,232,230,226},{238,254,246,252,254,254,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{240,240,238,238,236,234,232,228},{240,240,254,248,252,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{240,242,240,238,238,236,234,230},{240,240,248,254,250,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{242,242,242,240,238,238,234,232},{242,242,242,250,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{242,244,242,242,240,238,236,234},{242,242,250,248,252,254,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{244,244,244,242,242,240,238,236},{244,244,244,252,250,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{244,246,244,244,242,242,240,238},{244,244,252,250,254,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{246,246,246,244,244,244,242,240},{246,246,246,254,252,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{246,248,246,246,246,244,244,242},{246,246,254,252,250,254,252,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{248,248,248,248,246,246,244,244},{248,248,248,248,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{248,250,250,248,248,248,246,246},{248,248,248,254,252,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{250,250,250,250,250,250,248,248},{250,250,250,250,250,250,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{250,252,252,252,250,250,250,250},{250,250,250,250,254,254,254,254},{1,0,0,0,0,0,0,0}},
+  {/*1*/{252,252,252,252,252,252,252,252},{252,252,252,252,252,252,252,252},{0,0,0,0,0,0,0,0}},  {/*1*/{252,254,254,254,254,254,254,254},{252,252,252,252,252,252,252,252},{1,0,0,0,0,0,0,0}},  {/*1*/{254,254,254,254,254,254,254,254},{254,254,254,254,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{254,254,254,254,254,254,254,254},{254,254,254,254,254,254,254,254},{1,1,1,1,1,1,1,1}}
 },{
-  {{/*1*/{  1,  0,1},{  1,  0,0},{  1,  0,0},{  1,  0,0},{  1,  0,0},{  1,  0,0},{  1,  0,0},{  1,  0,0}}},  {{/*1*/{  1,  0,0},{  1,  2,0},{  1,  2,0},{  1,  2,0},{  1,  2,0},{  1,  2,0},{  1,  2,0},{  1,  2,0}}},  {{/*1*/{  1,  0,1},{  1, 18,0},{  1, 10,0},{  1,  6,0},{  1,  6,0},{  1,  6,0},{  1,  4,0},{  1,  4,0}}},  {{/*1*/{  3,  2,0},{  1, 34,0},{  1, 16,0},{  1, 12,0},{  1, 10,0},{  1,  8,0},{  1,  6,0},{  1,  6,0}}},
-  {{/*1*/{  3,  2,1},{  1, 50,0},{  1, 24,0},{  1, 16,0},{  1, 14,0},{  1, 12,0},{  1, 10,0},{  1,  8,0}}},  {{/*1*/{  5,  4,0},{  1, 66,0},{  1, 30,0},{  1, 22,0},{  1, 18,0},{  1, 14,0},{  1, 12,0},{  1, 10,0}}},  {{/*1*/{  5,  4,1},{  1, 82,0},{  1, 38,0},{  1, 26,0},{  1, 20,0},{  1, 18,0},{  1, 14,0},{  1, 12,0}}},  {{/*1*/{  7,  6,0},{  1, 98,0},{  1, 44,0},{  1, 32,0},{  1, 24,0},{  1, 20,0},{  1, 16,0},{  1, 14,0}}},
-  {{/*1*/{  7,  6,1},{  1,114,0},{  1, 52,0},{  1, 36,0},{  1, 28,0},{  1, 24,0},{  1, 20,0},{  1, 16,0}}},  {{/*1*/{  9,  8,0},{  1,130,0},{  1, 58,0},{  1, 42,0},{  1, 32,0},{  1, 26,0},{  1, 22,0},{  1, 20,0}}},  {{/*1*/{  9,  8,1},{  1,146,0},{  1, 66,0},{  1, 46,0},{  1, 36,0},{  1, 30,0},{  1, 24,0},{  1, 22,0}}},  {{/*1*/{ 11, 10,0},{  1,162,0},{  1, 74,0},{  1, 52,0},{  1, 40,0},{  1, 32,0},{  1, 26,0},{  1, 24,0}}},
-  {{/*1*/{ 11, 10,1},{  1,178,0},{  1, 80,0},{  1, 56,0},{  1, 44,0},{  1, 36,0},{  1, 30,0},{  1, 26,0}}},  {{/*1*/{ 13, 12,0},{  1,194,0},{  1, 88,0},{  1, 62,0},{  1, 48,0},{  1, 38,0},{  1, 32,0},{  1, 28,0}}},  {{/*1*/{ 13, 12,1},{  1,210,0},{  1, 94,0},{  1, 66,0},{  1, 50,0},{  1, 42,0},{  1, 34,0},{  1, 30,0}}},  {{/*1*/{ 15, 14,0},{  1,226,0},{  1,102,0},{  1, 70,0},{  1, 54,0},{  1, 44,0},{  1, 36,0},{  1, 32,0}}},
-  {{/*1*/{ 15, 14,1},{  1,242,0},{  1,108,0},{  1, 76,0},{  1, 58,0},{  1, 48,0},{  1, 38,0},{  1, 34,0}}},  {{/*1*/{ 17, 16,0},{  3,228,0},{  1,116,0},{  1, 80,0},{  1, 62,0},{  1, 50,0},{  1, 42,0},{  1, 36,0}}},  {{/*1*/{ 17, 16,1},{  3,244,0},{  1,122,0},{  1, 86,0},{  1, 66,0},{  1, 54,0},{  1, 44,0},{  1, 38,0}}},  {{/*1*/{ 19, 18,0},{  5,230,0},{  1,130,0},{  1, 90,0},{  1, 70,0},{  1, 56,0},{  1, 46,0},{  1, 40,0}}},
-  {{/*1*/{ 19, 18,1},{  5,246,0},{  1,138,0},{  1, 96,0},{  1, 74,0},{  1, 60,0},{  1, 48,0},{  1, 42,0}}},  {{/*1*/{ 21, 20,0},{  7,232,0},{  1,144,0},{  1,100,0},{  1, 78,0},{  1, 62,0},{  1, 52,0},{  1, 44,0}}},  {{/*1*/{ 21, 20,1},{  7,248,0},{  1,152,0},{  1,106,0},{  1, 82,0},{  1, 66,0},{  1, 54,0},{  1, 46,0}}},  {{/*1*/{ 23, 22,0},{  9,234,0},{  1,158,0},{  1,110,0},{  1, 84,0},{  1, 70,0},{  1, 56,0},{  1, 48,0}}},
-  {{/*1*/{ 23, 22,1},{  9,250,0},{  1,166,0},{  1,116,0},{  1, 88,0},{  1, 72,0},{  1, 58,0},{  1, 52,0}}},  {{/*1*/{ 25, 24,0},{ 11,236,0},{  1,172,0},{  1,120,0},{  1, 92,0},{  1, 76,0},{  1, 62,0},{  1, 54,0}}},  {{/*1*/{ 25, 24,1},{ 11,252,0},{  1,180,0},{  1,126,0},{  1, 96,0},{  1, 78,0},{  1, 64,0},{  1, 56,0}}},  {{/*1*/{ 27, 26,0},{ 13,238,0},{  1,186,0},{  1,130,0},{  1,100,0},{  1, 82,0},{  1, 66,0},{  1, 58,0}}},
-  {{/*1*/{ 27, 26,1},{ 13,254,0},{  1,194,0},{  1,134,0},{  1,104,0},{  1, 84,0},{  1, 68,0},{  1, 60,0}}},  {{/*1*/{ 29, 28,0},{ 15,240,0},{  1,202,0},{  1,140,0},{  1,108,0},{  1, 88,0},{  1, 70,0},{  1, 62,0}}},  {{/*1*/{ 29, 28,1},{ 17,226,0},{  1,208,0},{  1,144,0},{  1,112,0},{  1, 90,0},{  1, 74,0},{  1, 64,0}}},  {{/*1*/{ 31, 30,0},{ 17,242,0},{  1,216,0},{  1,150,0},{  1,114,0},{  1, 94,0},{  1, 76,0},{  1, 66,0}}},
-  {{/*1*/{ 31, 30,1},{ 19,228,0},{  1,222,0},{  1,154,0},{  1,118,0},{  1, 96,0},{  1, 78,0},{  1, 68,0}}},  {{/*1*/{ 33, 32,0},{ 19,244,0},{  1,230,0},{  1,160,0},{  1,122,0},{  1,100,0},{  1, 80,0},{  1, 70,0}}},  {{/*1*/{ 33, 32,1},{ 21,230,0},{  1,236,0},{  1,164,0},{  1,126,0},{  1,102,0},{  1, 84,0},{  1, 72,0}}},  {{/*1*/{ 35, 34,0},{ 21,246,0},{  1,244,0},{  1,170,0},{  1,130,0},{  1,106,0},{  1, 86,0},{  1, 74,0}}},
-  {{/*1*/{ 35, 34,1},{ 23,232,0},{  1,250,0},{  1,174,0},{  1,134,0},{  1,108,0},{  1, 88,0},{  1, 76,0}}},  {{/*1*/{ 37, 36,0},{ 23,248,0},{  3,246,0},{  1,180,0},{  1,138,0},{  1,112,0},{  1, 90,0},{  1, 78,0}}},  {{/*1*/{ 37, 36,1},{ 25,234,0},{  3,252,0},{  1,184,0},{  1,142,0},{  1,114,0},{  1, 94,0},{  1, 80,0}}},  {{/*1*/{ 39, 38,0},{ 25,250,0},{  5,248,0},{  1,190,0},{  1,146,0},{  1,118,0},{  1, 96,0},{  1, 84,0}}},
-  {{/*1*/{ 39, 38,1},{ 27,236,0},{  5,254,0},{  1,194,0},{  1,148,0},{  1,120,0},{  1, 98,0},{  1, 86,0}}},  {{/*1*/{ 41, 40,0},{ 27,252,0},{  7,250,0},{  1,198,0},{  1,152,0},{  1,124,0},{  1,100,0},{  1, 88,0}}},  {{/*1*/{ 41, 40,1},{ 29,238,0},{  9,244,0},{  1,204,0},{  1,156,0},{  1,126,0},{  1,102,0},{  1, 90,0}}},  {{/*1*/{ 43, 42,0},{ 29,254,0},{  9,252,0},{  1,208,0},{  1,160,0},{  1,130,0},{  1,106,0},{  1, 92,0}}},
-  {{/*1*/{ 43, 42,1},{ 31,240,0},{ 11,246,0},{  1,214,0},{  1,164,0},{  1,134,0},{  1,108,0},{  1, 94,0}}},  {{/*1*/{ 45, 44,0},{ 33,226,0},{ 11,254,0},{  1,218,0},{  1,168,0},{  1,136,0},{  1,110,0},{  1, 96,0}}},  {{/*1*/{ 45, 44,1},{ 33,242,0},{ 13,248,0},{  1,224,0},{  1,172,0},{  1,140,0},{  1,112,0},{  1, 98,0}}},  {{/*1*/{ 47, 46,0},{ 35,228,0},{ 15,244,0},{  1,228,0},{  1,176,0},{  1,142,0},{  1,116,0},{  1,100,0}}},
-  {{/*1*/{ 47, 46,1},{ 35,244,0},{ 15,250,0},{  1,234,0},{  1,178,0},{  1,146,0},{  1,118,0},{  1,102,0}}},  {{/*1*/{ 49, 48,0},{ 37,230,0},{ 17,246,0},{  1,238,0},{  1,182,0},{  1,148,0},{  1,120,0},{  1,104,0}}},  {{/*1*/{ 49, 48,1},{ 37,246,0},{ 17,252,0},{  1,244,0},{  1,186,0},{  1,152,0},{  1,122,0},{  1,106,0}}},  {{/*1*/{ 51, 50,0},{ 39,232,0},{ 19,248,0},{  1,248,0},{  1,190,0},{  1,154,0},{  1,126,0},{  1,108,0}}},
-  {{/*1*/{ 51, 50,1},{ 39,248,0},{ 19,254,0},{  1,254,0},{  1,194,0},{  1,158,0},{  1,128,0},{  1,110,0}}},  {{/*1*/{ 53, 52,0},{ 41,234,0},{ 21,250,0},{  3,250,0},{  1,198,0},{  1,160,0},{  1,130,0},{  1,112,0}}},  {{/*1*/{ 53, 52,1},{ 41,250,0},{ 23,244,0},{  5,248,0},{  1,202,0},{  1,164,0},{  1,132,0},{  1,116,0}}},  {{/*1*/{ 55, 54,0},{ 43,236,0},{ 23,252,0},{  5,252,0},{  1,206,0},{  1,166,0},{  1,134,0},{  1,118,0}}},
-  {{/*1*/{ 55, 54,1},{ 43,252,0},{ 25,246,0},{  7,250,0},{  1,210,0},{  1,170,0},{  1,138,0},{  1,120,0}}},  {{/*1*/{ 57, 56,0},{ 45,238,0},{ 25,254,0},{  7,254,0},{  1,212,0},{  1,172,0},{  1,140,0},{  1,122,0}}},  {{/*1*/{ 57, 56,1},{ 45,254,0},{ 27,248,0},{  9,252,0},{  1,216,0},{  1,176,0},{  1,142,0},{  1,124,0}}},  {{/*1*/{ 59, 58,0},{ 47,240,0},{ 29,244,0},{ 11,248,0},{  1,220,0},{  1,178,0},{  1,144,0},{  1,126,0}}},
-  {{/*1*/{ 59, 58,1},{ 49,226,0},{ 29,250,0},{ 11,254,0},{  1,224,0},{  1,182,0},{  1,148,0},{  1,128,0}}},  {{/*1*/{ 61, 60,0},{ 49,242,0},{ 31,246,0},{ 13,250,0},{  1,228,0},{  1,184,0},{  1,150,0},{  1,130,0}}},  {{/*1*/{ 61, 60,1},{ 51,228,0},{ 31,252,0},{ 15,248,0},{  1,232,0},{  1,188,0},{  1,152,0},{  1,132,0}}},  {{/*1*/{ 63, 62,0},{ 51,244,0},{ 33,248,0},{ 15,252,0},{  1,236,0},{  1,190,0},{  1,154,0},{  1,134,0}}},
-  {{/*1*/{ 63, 62,1},{ 53,230,0},{ 33,254,0},{ 17,250,0},{  1,240,0},{  1,194,0},{  1,158,0},{  1,136,0}}},  {{/*1*/{ 65, 64,0},{ 53,246,0},{ 35,250,0},{ 17,254,0},{  1,242,0},{  1,198,0},{  1,160,0},{  1,138,0}}},  {{/*1*/{ 65, 64,1},{ 55,232,0},{ 37,244,0},{ 19,252,0},{  1,246,0},{  1,200,0},{  1,162,0},{  1,140,0}}},  {{/*1*/{ 67, 66,0},{ 55,248,0},{ 37,252,0},{ 21,248,0},{  1,250,0},{  1,204,0},{  1,164,0},{  1,142,0}}},
-  {{/*1*/{ 67, 66,1},{ 57,234,0},{ 39,246,0},{ 21,254,0},{  1,254,0},{  1,206,0},{  1,166,0},{  1,144,0}}},  {{/*1*/{ 69, 68,0},{ 57,250,0},{ 39,254,0},{ 23,250,0},{  3,252,0},{  1,210,0},{  1,170,0},{  1,148,0}}},  {{/*1*/{ 69, 68,1},{ 59,236,0},{ 41,248,0},{ 25,248,0},{  5,250,0},{  1,212,0},{  1,172,0},{  1,150,0}}},  {{/*1*/{ 71, 70,0},{ 59,252,0},{ 43,244,0},{ 25,252,0},{  5,254,0},{  1,216,0},{  1,174,0},{  1,152,0}}},
-  {{/*1*/{ 71, 70,1},{ 61,238,0},{ 43,250,0},{ 27,250,0},{  7,252,0},{  1,218,0},{  1,176,0},{  1,154,0}}},  {{/*1*/{ 73, 72,0},{ 61,254,0},{ 45,246,0},{ 27,254,0},{  9,250,0},{  1,222,0},{  1,180,0},{  1,156,0}}},  {{/*1*/{ 73, 72,1},{ 63,240,0},{ 45,252,0},{ 29,252,0},{  9,254,0},{  1,224,0},{  1,182,0},{  1,158,0}}},  {{/*1*/{ 75, 74,0},{ 65,226,0},{ 47,248,0},{ 31,248,0},{ 11,252,0},{  1,228,0},{  1,184,0},{  1,160,0}}},
-  {{/*1*/{ 75, 74,1},{ 65,242,0},{ 47,254,0},{ 31,254,0},{ 13,252,0},{  1,230,0},{  1,186,0},{  1,162,0}}},  {{/*1*/{ 77, 76,0},{ 67,228,0},{ 49,250,0},{ 33,250,0},{ 13,254,0},{  1,234,0},{  1,190,0},{  1,164,0}}},  {{/*1*/{ 77, 76,1},{ 67,244,0},{ 51,244,0},{ 35,248,0},{ 15,254,0},{  1,236,0},{  1,192,0},{  1,166,0}}},  {{/*1*/{ 79, 78,0},{ 69,230,0},{ 51,252,0},{ 35,252,0},{ 17,252,0},{  1,240,0},{  1,194,0},{  1,168,0}}},
-  {{/*1*/{ 79, 78,1},{ 69,246,0},{ 53,246,0},{ 37,250,0},{ 19,250,0},{  1,242,0},{  1,196,0},{  1,170,0}}},  {{/*1*/{ 81, 80,0},{ 71,232,0},{ 53,254,0},{ 37,254,0},{ 19,254,0},{  1,246,0},{  1,198,0},{  1,172,0}}},  {{/*1*/{ 81, 80,1},{ 71,248,0},{ 55,248,0},{ 39,252,0},{ 21,252,0},{  1,248,0},{  1,202,0},{  1,174,0}}},  {{/*1*/{ 83, 82,0},{ 73,234,0},{ 57,242,0},{ 41,248,0},{ 23,250,0},{  1,252,0},{  1,204,0},{  1,176,0}}},
-  {{/*1*/{ 83, 82,1},{ 73,250,0},{ 57,250,0},{ 41,254,0},{ 23,254,0},{  1,254,0},{  1,206,0},{  1,180,0}}},  {{/*1*/{ 85, 84,0},{ 75,236,0},{ 59,244,0},{ 43,250,0},{ 25,252,0},{  3,254,0},{  1,208,0},{  1,182,0}}},  {{/*1*/{ 85, 84,1},{ 75,252,0},{ 59,252,0},{ 45,248,0},{ 27,250,0},{  5,252,0},{  1,212,0},{  1,184,0}}},  {{/*1*/{ 87, 86,0},{ 77,238,0},{ 61,246,0},{ 45,252,0},{ 27,254,0},{  7,252,0},{  1,214,0},{  1,186,0}}},
-  {{/*1*/{ 87, 86,1},{ 77,254,0},{ 61,254,0},{ 47,250,0},{ 29,252,0},{  7,254,0},{  1,216,0},{  1,188,0}}},  {{/*1*/{ 89, 88,0},{ 79,240,0},{ 63,248,0},{ 47,254,0},{ 31,250,0},{  9,254,0},{  1,218,0},{  1,190,0}}},  {{/*1*/{ 89, 88,1},{ 81,226,0},{ 65,244,0},{ 49,252,0},{ 31,254,0},{ 11,252,0},{  1,222,0},{  1,192,0}}},  {{/*1*/{ 91, 90,0},{ 81,242,0},{ 65,250,0},{ 51,248,0},{ 33,252,0},{ 13,252,0},{  1,224,0},{  1,194,0}}},
-  {{/*1*/{ 91, 90,1},{ 83,228,0},{ 67,246,0},{ 51,254,0},{ 35,250,0},{ 13,254,0},{  1,226,0},{  1,196,0}}},  {{/*1*/{ 93, 92,0},{ 83,244,0},{ 67,252,0},{ 53,250,0},{ 35,254,0},{ 15,254,0},{  1,228,0},{  1,198,0}}},  {{/*1*/{ 93, 92,1},{ 85,230,0},{ 69,248,0},{ 55,248,0},{ 37,252,0},{ 17,252,0},{  1,230,0},{  1,200,0}}},  {{/*1*/{ 95, 94,0},{ 85,246,0},{ 69,254,0},{ 55,252,0},{ 39,250,0},{ 19,252,0},{  1,234,0},{  1,202,0}}},
-  {{/*1*/{ 95, 94,1},{ 87,232,0},{ 71,250,0},{ 57,250,0},{ 39,254,0},{ 19,254,0},{  1,236,0},{  1,204,0}}},  {{/*1*/{ 97, 96,0},{ 87,248,0},{ 73,244,0},{ 57,254,0},{ 41,252,0},{ 21,254,0},{  1,238,0},{  1,206,0}}},  {{/*1*/{ 97, 96,1},{ 89,234,0},{ 73,252,0},{ 59,252,0},{ 43,252,0},{ 23,252,0},{  1,240,0},{  1,208,0}}},  {{/*1*/{ 99, 98,0},{ 89,250,0},{ 75,246,0},{ 61,250,0},{ 43,254,0},{ 25,252,0},{  1,244,0},{  1,212,0}}},
-  {{/*1*/{ 99, 98,1},{ 91,236,0},{ 75,254,0},{ 61,254,0},{ 45,254,0},{ 25,254,0},{  1,246,0},{  1,214,0}}},  {{/*1*/{101,100,0},{ 91,252,0},{ 77,248,0},{ 63,252,0},{ 47,252,0},{ 27,254,0},{  1,248,0},{  1,216,0}}},  {{/*1*/{101,100,1},{ 93,238,0},{ 79,244,0},{ 65,248,0},{ 49,250,0},{ 29,252,0},{  1,250,0},{  1,218,0}}},  {{/*1*/{103,102,0},{ 93,254,0},{ 79,250,0},{ 65,254,0},{ 49,254,0},{ 31,252,0},{  1,254,0},{  1,220,0}}},
-  {{/*1*/{103,102,1},{ 95,240,0},{ 81,246,0},{ 67,250,0},{ 51,252,0},{ 31,254,0},{  3,252,0},{  1,222,0}}},  {{/*1*/{105,104,0},{ 97,226,0},{ 81,252,0},{ 69,248,0},{ 53,250,0},{ 33,254,0},{  5,252,0},{  1,224,0}}},  {{/*1*/{105,104,1},{ 97,242,0},{ 83,248,0},{ 69,252,0},{ 53,254,0},{ 35,252,0},{  5,254,0},{  1,226,0}}},  {{/*1*/{107,106,0},{ 99,228,0},{ 83,254,0},{ 71,250,0},{ 55,252,0},{ 37,252,0},{  7,254,0},{  1,228,0}}},
-  {{/*1*/{107,106,1},{ 99,244,0},{ 85,250,0},{ 71,254,0},{ 57,250,0},{ 37,254,0},{  9,254,0},{  1,230,0}}},  {{/*1*/{109,108,0},{101,230,0},{ 87,244,0},{ 73,252,0},{ 57,254,0},{ 39,254,0},{ 11,254,0},{  1,232,0}}},  {{/*1*/{109,108,1},{101,246,0},{ 87,252,0},{ 75,248,0},{ 59,252,0},{ 41,252,0},{ 13,252,0},{  1,234,0}}},  {{/*1*/{111,110,0},{103,232,0},{ 89,246,0},{ 75,254,0},{ 61,250,0},{ 43,252,0},{ 15,252,0},{  1,236,0}}},
-  {{/*1*/{111,110,1},{103,248,0},{ 89,254,0},{ 77,250,0},{ 61,254,0},{ 43,254,0},{ 15,254,0},{  1,238,0}}},  {{/*1*/{113,112,0},{105,234,0},{ 91,248,0},{ 79,248,0},{ 63,252,0},{ 45,254,0},{ 17,254,0},{  1,240,0}}},  {{/*1*/{113,112,1},{105,250,0},{ 93,244,0},{ 79,252,0},{ 65,250,0},{ 47,252,0},{ 19,254,0},{  1,244,0}}},  {{/*1*/{115,114,0},{107,236,0},{ 93,250,0},{ 81,250,0},{ 65,254,0},{ 49,252,0},{ 21,254,0},{  1,246,0}}},
-  {{/*1*/{115,114,1},{107,252,0},{ 95,246,0},{ 81,254,0},{ 67,252,0},{ 49,254,0},{ 23,252,0},{  1,248,0}}},  {{/*1*/{117,116,0},{109,238,0},{ 95,252,0},{ 83,252,0},{ 69,250,0},{ 51,254,0},{ 25,252,0},{  1,250,0}}},  {{/*1*/{117,116,1},{109,254,0},{ 97,248,0},{ 85,248,0},{ 69,254,0},{ 53,252,0},{ 25,254,0},{  1,252,0}}},  {{/*1*/{119,118,0},{111,240,0},{ 97,254,0},{ 85,254,0},{ 71,252,0},{ 55,252,0},{ 27,254,0},{  1,254,0}}},
-  {{/*1*/{119,118,1},{113,226,0},{ 99,250,0},{ 87,250,0},{ 73,250,0},{ 55,254,0},{ 29,254,0},{  3,254,0}}},  {{/*1*/{121,120,0},{113,242,0},{101,244,0},{ 89,248,0},{ 73,254,0},{ 57,254,0},{ 31,254,0},{  5,254,0}}},  {{/*1*/{121,120,1},{115,228,0},{101,252,0},{ 89,252,0},{ 75,252,0},{ 59,252,0},{ 33,254,0},{  7,254,0}}},  {{/*1*/{123,122,0},{115,244,0},{103,246,0},{ 91,250,0},{ 77,252,0},{ 61,250,0},{ 35,252,0},{  9,254,0}}},
-  {{/*1*/{123,122,1},{117,230,0},{103,254,0},{ 91,254,0},{ 77,254,0},{ 61,254,0},{ 37,252,0},{ 11,254,0}}},  {{/*1*/{125,124,0},{117,246,0},{105,248,0},{ 93,252,0},{ 79,254,0},{ 63,252,0},{ 37,254,0},{ 13,252,0}}},  {{/*1*/{125,124,1},{119,232,0},{107,244,0},{ 95,248,0},{ 81,252,0},{ 65,252,0},{ 39,254,0},{ 15,252,0}}},  {{/*1*/{127,126,0},{119,248,0},{107,250,0},{ 95,254,0},{ 83,250,0},{ 65,254,0},{ 41,254,0},{ 15,254,0}}},
-  {{/*1*/{127,126,1},{121,234,0},{109,246,0},{ 97,250,0},{ 83,254,0},{ 67,254,0},{ 43,254,0},{ 17,254,0}}},  {{/*1*/{129,128,0},{121,250,0},{109,252,0},{ 99,248,0},{ 85,252,0},{ 69,252,0},{ 45,252,0},{ 19,254,0}}},  {{/*1*/{129,128,1},{123,236,0},{111,248,0},{ 99,252,0},{ 87,250,0},{ 71,252,0},{ 47,252,0},{ 21,254,0}}},  {{/*1*/{131,130,0},{123,252,0},{111,254,0},{101,250,0},{ 87,254,0},{ 71,254,0},{ 47,254,0},{ 23,254,0}}},
-  {{/*1*/{131,130,1},{125,238,0},{113,250,0},{101,254,0},{ 89,252,0},{ 73,254,0},{ 49,254,0},{ 25,254,0}}},  {{/*1*/{133,132,0},{125,254,0},{115,244,0},{103,252,0},{ 91,250,0},{ 75,252,0},{ 51,254,0},{ 27,254,0}}},  {{/*1*/{133,132,1},{127,240,0},{115,252,0},{105,248,0},{ 91,254,0},{ 77,252,0},{ 53,254,0},{ 29,254,0}}},  {{/*1*/{135,134,0},{129,226,0},{117,246,0},{105,254,0},{ 93,252,0},{ 77,254,0},{ 55,252,0},{ 31,254,0}}},
-  {{/*1*/{135,134,1},{129,242,0},{117,254,0},{107,250,0},{ 95,250,0},{ 79,254,0},{ 57,252,0},{ 33,254,0}}},  {{/*1*/{137,136,0},{131,228,0},{119,248,0},{109,248,0},{ 95,254,0},{ 81,252,0},{ 57,254,0},{ 35,254,0}}},  {{/*1*/{137,136,1},{131,244,0},{121,242,0},{109,252,0},{ 97,252,0},{ 83,252,0},{ 59,254,0},{ 37,254,0}}},  {{/*1*/{139,138,0},{133,230,0},{121,250,0},{111,250,0},{ 99,250,0},{ 83,254,0},{ 61,254,0},{ 39,254,0}}},
-  {{/*1*/{139,138,1},{133,246,0},{123,244,0},{111,254,0},{ 99,254,0},{ 85,254,0},{ 63,254,0},{ 41,254,0}}},  {{/*1*/{141,140,0},{135,232,0},{123,252,0},{113,252,0},{101,252,0},{ 87,252,0},{ 65,254,0},{ 43,254,0}}},  {{/*1*/{141,140,1},{135,248,0},{125,246,0},{115,248,0},{103,250,0},{ 89,252,0},{ 67,252,0},{ 45,252,0}}},  {{/*1*/{143,142,0},{137,234,0},{125,254,0},{115,254,0},{103,254,0},{ 89,254,0},{ 69,252,0},{ 47,252,0}}},
-  {{/*1*/{143,142,1},{137,250,0},{127,248,0},{117,250,0},{105,252,0},{ 91,254,0},{ 69,254,0},{ 47,254,0}}},  {{/*1*/{145,144,0},{139,236,0},{129,244,0},{119,248,0},{107,252,0},{ 93,252,0},{ 71,254,0},{ 49,254,0}}},  {{/*1*/{145,144,1},{139,252,0},{129,250,0},{119,252,0},{107,254,0},{ 95,252,0},{ 73,254,0},{ 51,254,0}}},  {{/*1*/{147,146,0},{141,238,0},{131,246,0},{121,250,0},{109,254,0},{ 95,254,0},{ 75,254,0},{ 53,254,0}}},
-  {{/*1*/{147,146,1},{141,254,0},{131,252,0},{121,254,0},{111,252,0},{ 97,254,0},{ 77,252,0},{ 55,254,0}}},  {{/*1*/{149,148,0},{143,240,0},{133,248,0},{123,252,0},{113,250,0},{ 99,252,0},{ 79,252,0},{ 57,254,0}}},  {{/*1*/{149,148,1},{145,226,0},{133,254,0},{125,250,0},{113,254,0},{101,252,0},{ 79,254,0},{ 59,254,0}}},  {{/*1*/{151,150,0},{145,242,0},{135,250,0},{125,254,0},{115,252,0},{101,254,0},{ 81,254,0},{ 61,254,0}}},
-  {{/*1*/{151,150,1},{147,228,0},{137,244,0},{127,252,0},{117,250,0},{103,254,0},{ 83,254,0},{ 63,254,0}}},  {{/*1*/{153,152,0},{147,244,0},{137,252,0},{129,248,0},{117,254,0},{105,252,0},{ 85,254,0},{ 65,254,0}}},  {{/*1*/{153,152,1},{149,230,0},{139,246,0},{129,254,0},{119,252,0},{107,252,0},{ 87,252,0},{ 67,254,0}}},  {{/*1*/{155,154,0},{149,246,0},{139,254,0},{131,250,0},{121,250,0},{107,254,0},{ 89,252,0},{ 69,254,0}}},
-  {{/*1*/{155,154,1},{151,232,0},{141,248,0},{133,248,0},{121,254,0},{109,254,0},{ 89,254,0},{ 71,254,0}}},  {{/*1*/{157,156,0},{151,248,0},{143,244,0},{133,252,0},{123,252,0},{111,252,0},{ 91,254,0},{ 73,254,0}}},  {{/*1*/{157,156,1},{153,234,0},{143,250,0},{135,250,0},{125,250,0},{113,252,0},{ 93,254,0},{ 75,254,0}}},  {{/*1*/{159,158,0},{153,250,0},{145,246,0},{135,254,0},{125,254,0},{113,254,0},{ 95,254,0},{ 77,252,0}}},
-  {{/*1*/{159,158,1},{155,236,0},{145,252,0},{137,252,0},{127,252,0},{115,254,0},{ 97,254,0},{ 79,252,0}}},  {{/*1*/{161,160,0},{155,252,0},{147,248,0},{139,248,0},{129,250,0},{117,252,0},{ 99,252,0},{ 79,254,0}}},  {{/*1*/{161,160,1},{157,238,0},{147,254,0},{139,254,0},{129,254,0},{119,252,0},{101,252,0},{ 81,254,0}}},  {{/*1*/{163,162,0},{157,254,0},{149,250,0},{141,250,0},{131,252,0},{119,254,0},{101,254,0},{ 83,254,0}}},
-  {{/*1*/{163,162,1},{159,240,0},{151,244,0},{143,248,0},{133,250,0},{121,254,0},{103,254,0},{ 85,254,0}}},  {{/*1*/{165,164,0},{161,226,0},{151,252,0},{143,252,0},{133,254,0},{123,252,0},{105,254,0},{ 87,254,0}}},  {{/*1*/{165,164,1},{161,242,0},{153,246,0},{145,250,0},{135,252,0},{125,250,0},{107,254,0},{ 89,254,0}}},  {{/*1*/{167,166,0},{163,228,0},{153,254,0},{145,254,0},{137,250,0},{125,254,0},{109,252,0},{ 91,254,0}}},
-  {{/*1*/{167,166,1},{163,244,0},{155,248,0},{147,252,0},{137,254,0},{127,252,0},{111,252,0},{ 93,254,0}}},  {{/*1*/{169,168,0},{165,230,0},{157,244,0},{149,248,0},{139,252,0},{129,252,0},{111,254,0},{ 95,254,0}}},  {{/*1*/{169,168,1},{165,246,0},{157,250,0},{149,254,0},{141,252,0},{129,254,0},{113,254,0},{ 97,254,0}}},  {{/*1*/{171,170,0},{167,232,0},{159,246,0},{151,250,0},{141,254,0},{131,254,0},{115,254,0},{ 99,254,0}}},
-  {{/*1*/{171,170,1},{167,248,0},{159,252,0},{153,248,0},{143,254,0},{133,252,0},{117,254,0},{101,254,0}}},  {{/*1*/{173,172,0},{169,234,0},{161,248,0},{153,252,0},{145,252,0},{135,252,0},{119,252,0},{103,254,0}}},  {{/*1*/{173,172,1},{169,250,0},{161,254,0},{155,250,0},{147,250,0},{135,254,0},{121,252,0},{105,254,0}}},  {{/*1*/{175,174,0},{171,236,0},{163,250,0},{155,254,0},{147,254,0},{137,254,0},{121,254,0},{107,254,0}}},
-  {{/*1*/{175,174,1},{171,252,0},{165,244,0},{157,252,0},{149,252,0},{139,252,0},{123,254,0},{109,252,0}}},  {{/*1*/{177,176,0},{173,238,0},{165,252,0},{159,248,0},{151,250,0},{141,252,0},{125,254,0},{111,252,0}}},  {{/*1*/{177,176,1},{173,254,0},{167,246,0},{159,254,0},{151,254,0},{141,254,0},{127,254,0},{111,254,0}}},  {{/*1*/{179,178,0},{175,240,0},{167,254,0},{161,250,0},{153,252,0},{143,254,0},{129,254,0},{113,254,0}}},
-  {{/*1*/{179,178,1},{177,226,0},{169,248,0},{163,248,0},{155,250,0},{145,252,0},{131,252,0},{115,254,0}}},  {{/*1*/{181,180,0},{177,242,0},{171,244,0},{163,252,0},{155,254,0},{147,252,0},{133,252,0},{117,254,0}}},  {{/*1*/{181,180,1},{179,228,0},{171,250,0},{165,250,0},{157,252,0},{147,254,0},{133,254,0},{119,254,0}}},  {{/*1*/{183,182,0},{179,244,0},{173,246,0},{165,254,0},{159,250,0},{149,254,0},{135,254,0},{121,254,0}}},
-  {{/*1*/{183,182,1},{181,230,0},{173,252,0},{167,252,0},{159,254,0},{151,252,0},{137,254,0},{123,254,0}}},  {{/*1*/{185,184,0},{181,246,0},{175,248,0},{169,248,0},{161,252,0},{153,252,0},{139,254,0},{125,254,0}}},  {{/*1*/{185,184,1},{183,232,0},{175,254,0},{169,254,0},{163,250,0},{153,254,0},{141,252,0},{127,254,0}}},  {{/*1*/{187,186,0},{183,248,0},{177,250,0},{171,250,0},{163,254,0},{155,254,0},{143,252,0},{129,254,0}}},
-  {{/*1*/{187,186,1},{185,234,0},{179,244,0},{173,248,0},{165,252,0},{157,252,0},{143,254,0},{131,254,0}}},  {{/*1*/{189,188,0},{185,250,0},{179,252,0},{173,252,0},{167,250,0},{159,252,0},{145,254,0},{133,254,0}}},  {{/*1*/{189,188,1},{187,236,0},{181,246,0},{175,250,0},{167,254,0},{159,254,0},{147,254,0},{135,254,0}}},  {{/*1*/{191,190,0},{187,252,0},{181,254,0},{175,254,0},{169,252,0},{161,254,0},{149,254,0},{137,254,0}}},
-  {{/*1*/{191,190,1},{189,238,0},{183,248,0},{177,252,0},{171,252,0},{163,252,0},{151,252,0},{139,254,0}}},  {{/*1*/{193,192,0},{189,254,0},{185,242,0},{179,248,0},{171,254,0},{165,252,0},{153,252,0},{141,252,0}}},  {{/*1*/{193,192,1},{191,240,0},{185,250,0},{179,254,0},{173,254,0},{165,254,0},{153,254,0},{143,252,0}}},  {{/*1*/{195,194,0},{193,226,0},{187,244,0},{181,250,0},{175,252,0},{167,254,0},{155,254,0},{143,254,0}}},
-  {{/*1*/{195,194,1},{193,242,0},{187,252,0},{183,248,0},{177,250,0},{169,252,0},{157,254,0},{145,254,0}}},  {{/*1*/{197,196,0},{195,228,0},{189,246,0},{183,252,0},{177,254,0},{171,252,0},{159,254,0},{147,254,0}}},  {{/*1*/{197,196,1},{195,244,0},{189,254,0},{185,250,0},{179,252,0},{171,254,0},{161,254,0},{149,254,0}}},  {{/*1*/{199,198,0},{197,230,0},{191,248,0},{185,254,0},{181,250,0},{173,254,0},{163,252,0},{151,254,0}}},
-  {{/*1*/{199,198,1},{197,246,0},{193,244,0},{187,252,0},{181,254,0},{175,252,0},{165,252,0},{153,254,0}}},  {{/*1*/{201,200,0},{199,232,0},{193,250,0},{189,250,0},{183,252,0},{177,252,0},{165,254,0},{155,254,0}}},  {{/*1*/{201,200,1},{199,248,0},{195,246,0},{189,254,0},{185,250,0},{177,254,0},{167,254,0},{157,254,0}}},  {{/*1*/{203,202,0},{201,234,0},{195,252,0},{191,252,0},{185,254,0},{179,254,0},{169,254,0},{159,254,0}}},
-  {{/*1*/{203,202,1},{201,250,0},{197,248,0},{193,248,0},{187,252,0},{181,252,0},{171,254,0},{161,254,0}}},  {{/*1*/{205,204,0},{203,236,0},{197,254,0},{193,254,0},{189,250,0},{183,252,0},{173,252,0},{163,254,0}}},  {{/*1*/{205,204,1},{203,252,0},{199,250,0},{195,250,0},{189,254,0},{183,254,0},{175,252,0},{165,254,0}}},  {{/*1*/{207,206,0},{205,238,0},{201,244,0},{197,248,0},{191,252,0},{185,254,0},{175,254,0},{167,254,0}}},
-  {{/*1*/{207,206,1},{205,254,0},{201,252,0},{197,252,0},{193,250,0},{187,252,0},{177,254,0},{169,254,0}}},  {{/*1*/{209,208,0},{207,240,0},{203,246,0},{199,250,0},{193,254,0},{189,250,0},{179,254,0},{171,254,0}}},  {{/*1*/{209,208,1},{209,226,0},{203,254,0},{199,254,0},{195,252,0},{189,254,0},{181,254,0},{173,252,0}}},  {{/*1*/{211,210,0},{209,242,0},{205,248,0},{201,252,0},{197,250,0},{191,252,0},{183,252,0},{175,252,0}}},
-  {{/*1*/{211,210,1},{211,228,0},{207,244,0},{203,248,0},{197,254,0},{193,252,0},{185,252,0},{175,254,0}}},  {{/*1*/{213,212,0},{211,244,0},{207,250,0},{203,254,0},{199,252,0},{193,254,0},{185,254,0},{177,254,0}}},  {{/*1*/{213,212,1},{213,230,0},{209,246,0},{205,250,0},{201,250,0},{195,254,0},{187,254,0},{179,254,0}}},  {{/*1*/{215,214,0},{213,246,0},{209,252,0},{207,248,0},{201,254,0},{197,252,0},{189,254,0},{181,254,0}}},
-  {{/*1*/{215,214,1},{215,232,0},{211,248,0},{207,252,0},{203,252,0},{199,252,0},{191,254,0},{183,254,0}}},  {{/*1*/{217,216,0},{215,248,0},{211,254,0},{209,250,0},{205,252,0},{199,254,0},{193,254,0},{185,254,0}}},  {{/*1*/{217,216,1},{217,234,0},{213,250,0},{209,254,0},{205,254,0},{201,254,0},{195,252,0},{187,254,0}}},  {{/*1*/{219,218,0},{217,250,0},{215,244,0},{211,252,0},{207,254,0},{203,252,0},{197,252,0},{189,254,0}}},
-  {{/*1*/{219,218,1},{219,236,0},{215,252,0},{213,248,0},{209,252,0},{205,252,0},{197,254,0},{191,254,0}}},  {{/*1*/{221,220,0},{219,252,0},{217,246,0},{213,254,0},{211,250,0},{205,254,0},{199,254,0},{193,254,0}}},  {{/*1*/{221,220,1},{221,238,0},{217,254,0},{215,250,0},{211,254,0},{207,254,0},{201,254,0},{195,254,0}}},  {{/*1*/{223,222,0},{221,254,0},{219,248,0},{217,248,0},{213,252,0},{209,252,0},{203,254,0},{197,254,0}}},
-  {{/*1*/{223,222,1},{223,240,0},{221,244,0},{217,252,0},{215,250,0},{211,252,0},{205,252,0},{199,254,0}}},  {{/*1*/{225,224,0},{225,226,0},{221,250,0},{219,250,0},{215,254,0},{211,254,0},{207,252,0},{201,254,0}}},  {{/*1*/{225,224,1},{225,242,0},{223,246,0},{219,254,0},{217,252,0},{213,254,0},{207,254,0},{203,254,0}}},  {{/*1*/{227,226,0},{227,228,0},{223,252,0},{221,252,0},{219,250,0},{215,252,0},{209,254,0},{205,252,0}}},
-  {{/*1*/{227,226,1},{227,244,0},{225,248,0},{223,248,0},{219,254,0},{217,252,0},{211,254,0},{207,252,0}}},  {{/*1*/{229,228,0},{229,230,0},{225,254,0},{223,254,0},{221,252,0},{217,254,0},{213,254,0},{207,254,0}}},  {{/*1*/{229,228,1},{229,246,0},{227,250,0},{225,250,0},{223,250,0},{219,254,0},{215,252,0},{209,254,0}}},  {{/*1*/{231,230,0},{231,232,0},{229,244,0},{227,248,0},{223,254,0},{221,252,0},{217,252,0},{211,254,0}}},
-  {{/*1*/{231,230,1},{231,248,0},{229,252,0},{227,252,0},{225,252,0},{223,252,0},{217,254,0},{213,254,0}}},  {{/*1*/{233,232,0},{233,234,0},{231,246,0},{229,250,0},{227,250,0},{223,254,0},{219,254,0},{215,254,0}}},  {{/*1*/{233,232,1},{233,250,0},{231,254,0},{229,254,0},{227,254,0},{225,254,0},{221,254,0},{217,254,0}}},  {{/*1*/{235,234,0},{235,236,0},{233,248,0},{231,252,0},{229,252,0},{227,252,0},{223,254,0},{219,254,0}}},
-  {{/*1*/{235,234,1},{235,252,0},{235,244,0},{233,248,0},{231,250,0},{229,252,0},{225,254,0},{221,254,0}}},  {{/*1*/{237,236,0},{237,238,0},{235,250,0},{233,254,0},{231,254,0},{229,254,0},{227,252,0},{223,254,0}}},  {{/*1*/{237,236,1},{237,254,0},{237,246,0},{235,250,0},{233,252,0},{231,254,0},{229,252,0},{225,254,0}}},  {{/*1*/{239,238,0},{239,240,0},{237,252,0},{237,248,0},{235,252,0},{233,252,0},{229,254,0},{227,254,0}}},
-  {{/*1*/{239,238,1},{241,240,0},{239,248,0},{237,252,0},{235,254,0},{235,252,0},{231,254,0},{229,254,0}}},  {{/*1*/{241,240,0},{241,242,0},{239,254,0},{239,250,0},{237,254,0},{235,254,0},{233,254,0},{231,254,0}}},  {{/*1*/{241,240,1},{243,242,0},{241,250,0},{239,254,0},{239,252,0},{237,254,0},{235,254,0},{233,254,0}}},  {{/*1*/{243,242,0},{243,244,0},{243,244,0},{241,252,0},{241,250,0},{239,252,0},{237,252,0},{235,254,0}}},
-  {{/*1*/{243,242,1},{245,244,0},{243,252,0},{243,248,0},{241,254,0},{241,252,0},{239,252,0},{237,252,0}}},  {{/*1*/{245,244,0},{245,246,0},{245,246,0},{243,254,0},{243,252,0},{241,254,0},{239,254,0},{239,252,0}}},  {{/*1*/{245,244,1},{247,246,0},{245,254,0},{245,250,0},{245,250,0},{243,254,0},{241,254,0},{239,254,0}}},  {{/*1*/{247,246,0},{247,248,0},{247,248,0},{247,248,0},{245,254,0},{245,252,0},{243,254,0},{241,254,0}}},
-  {{/*1*/{247,246,1},{249,248,0},{249,248,0},{247,252,0},{247,252,0},{247,252,0},{245,254,0},{243,254,0}}},  {{/*1*/{249,248,0},{249,250,0},{249,250,0},{249,250,0},{249,250,0},{247,254,0},{247,252,0},{245,254,0}}},  {{/*1*/{249,248,1},{251,250,0},{251,250,0},{249,254,0},{249,254,0},{249,254,0},{249,252,0},{247,254,0}}},  {{/*1*/{251,250,0},{251,252,0},{251,252,0},{251,252,0},{251,252,0},{251,252,0},{249,254,0},{249,254,0}}},
-  {{/*1*/{251,250,1},{253,252,0},{253,252,0},{253,252,0},{253,252,0},{253,252,0},{251,254,0},{251,254,0}}},  {{/*1*/{253,252,0},{253,254,0},{253,254,0},{253,254,0},{253,254,0},{253,254,0},{253,254,0},{253,254,0}}},  {{/*1*/{253,252,1},{255,254,0},{255,254,0},{255,254,0},{255,254,0},{255,254,0},{255,254,0},{255,254,0}}},  {{/*0*/{255,254,0},{255,254,1},{255,254,1},{255,254,1},{255,254,1},{255,254,1},{255,254,1},{255,254,1}}}
+  {/*1*/{  1,  1,  1,  1,  1,  1,  1,  1},{  0,  0,  0,  0,  0,  0,  0,  0},{1,0,0,0,0,0,0,0}},  {/*1*/{  1,  1,  1,  1,  1,  1,  1,  1},{  0,  2,  2,  2,  2,  2,  2,  2},{0,0,0,0,0,0,0,0}},  {/*1*/{  1,  1,  1,  1,  1,  1,  1,  1},{  0, 18, 10,  6,  6,  6,  4,  4},{1,0,0,0,0,0,0,0}},  {/*1*/{  3,  1,  1,  1,  1,  1,  1,  1},{  2, 34, 16, 12, 10,  8,  6,  6},{0,0,0,0,0,0,0,0}},
+  {/*1*/{  3,  1,  1,  1,  1,  1,  1,  1},{  2, 50, 24, 16, 14, 12, 10,  8},{1,0,0,0,0,0,0,0}},  {/*1*/{  5,  1,  1,  1,  1,  1,  1,  1},{  4, 66, 30, 22, 18, 14, 12, 10},{0,0,0,0,0,0,0,0}},  {/*1*/{  5,  1,  1,  1,  1,  1,  1,  1},{  4, 82, 38, 26, 20, 18, 14, 12},{1,0,0,0,0,0,0,0}},  {/*1*/{  7,  1,  1,  1,  1,  1,  1,  1},{  6, 98, 44, 32, 24, 20, 16, 14},{0,0,0,0,0,0,0,0}},
+  {/*1*/{  7,  1,  1,  1,  1,  1,  1,  1},{  6,114, 52, 36, 28, 24, 20, 16},{1,0,0,0,0,0,0,0}},  {/*1*/{  9,  1,  1,  1,  1,  1,  1,  1},{  8,130, 58, 42, 32, 26, 22, 20},{0,0,0,0,0,0,0,0}},  {/*1*/{  9,  1,  1,  1,  1,  1,  1,  1},{  8,146, 66, 46, 36, 30, 24, 22},{1,0,0,0,0,0,0,0}},  {/*1*/{ 11,  1,  1,  1,  1,  1,  1,  1},{ 10,162, 74, 52, 40, 32, 26, 24},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 11,  1,  1,  1,  1,  1,  1,  1},{ 10,178, 80, 56, 44, 36, 30, 26},{1,0,0,0,0,0,0,0}},  {/*1*/{ 13,  1,  1,  1,  1,  1,  1,  1},{ 12,194, 88, 62, 48, 38, 32, 28},{0,0,0,0,0,0,0,0}},  {/*1*/{ 13,  1,  1,  1,  1,  1,  1,  1},{ 12,210, 94, 66, 50, 42, 34, 30},{1,0,0,0,0,0,0,0}},  {/*1*/{ 15,  1,  1,  1,  1,  1,  1,  1},{ 14,226,102, 70, 54, 44, 36, 32},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 15,  1,  1,  1,  1,  1,  1,  1},{ 14,242,108, 76, 58, 48, 38, 34},{1,0,0,0,0,0,0,0}},  {/*1*/{ 17,  3,  1,  1,  1,  1,  1,  1},{ 16,228,116, 80, 62, 50, 42, 36},{0,0,0,0,0,0,0,0}},  {/*1*/{ 17,  3,  1,  1,  1,  1,  1,  1},{ 16,244,122, 86, 66, 54, 44, 38},{1,0,0,0,0,0,0,0}},  {/*1*/{ 19,  5,  1,  1,  1,  1,  1,  1},{ 18,230,130, 90, 70, 56, 46, 40},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 19,  5,  1,  1,  1,  1,  1,  1},{ 18,246,138, 96, 74, 60, 48, 42},{1,0,0,0,0,0,0,0}},  {/*1*/{ 21,  7,  1,  1,  1,  1,  1,  1},{ 20,232,144,100, 78, 62, 52, 44},{0,0,0,0,0,0,0,0}},  {/*1*/{ 21,  7,  1,  1,  1,  1,  1,  1},{ 20,248,152,106, 82, 66, 54, 46},{1,0,0,0,0,0,0,0}},  {/*1*/{ 23,  9,  1,  1,  1,  1,  1,  1},{ 22,234,158,110, 84, 70, 56, 48},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 23,  9,  1,  1,  1,  1,  1,  1},{ 22,250,166,116, 88, 72, 58, 52},{1,0,0,0,0,0,0,0}},  {/*1*/{ 25, 11,  1,  1,  1,  1,  1,  1},{ 24,236,172,120, 92, 76, 62, 54},{0,0,0,0,0,0,0,0}},  {/*1*/{ 25, 11,  1,  1,  1,  1,  1,  1},{ 24,252,180,126, 96, 78, 64, 56},{1,0,0,0,0,0,0,0}},  {/*1*/{ 27, 13,  1,  1,  1,  1,  1,  1},{ 26,238,186,130,100, 82, 66, 58},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 27, 13,  1,  1,  1,  1,  1,  1},{ 26,254,194,134,104, 84, 68, 60},{1,0,0,0,0,0,0,0}},  {/*1*/{ 29, 15,  1,  1,  1,  1,  1,  1},{ 28,240,202,140,108, 88, 70, 62},{0,0,0,0,0,0,0,0}},  {/*1*/{ 29, 17,  1,  1,  1,  1,  1,  1},{ 28,226,208,144,112, 90, 74, 64},{1,0,0,0,0,0,0,0}},  {/*1*/{ 31, 17,  1,  1,  1,  1,  1,  1},{ 30,242,216,150,114, 94, 76, 66},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 31, 19,  1,  1,  1,  1,  1,  1},{ 30,228,222,154,118, 96, 78, 68},{1,0,0,0,0,0,0,0}},  {/*1*/{ 33, 19,  1,  1,  1,  1,  1,  1},{ 32,244,230,160,122,100, 80, 70},{0,0,0,0,0,0,0,0}},  {/*1*/{ 33, 21,  1,  1,  1,  1,  1,  1},{ 32,230,236,164,126,102, 84, 72},{1,0,0,0,0,0,0,0}},  {/*1*/{ 35, 21,  1,  1,  1,  1,  1,  1},{ 34,246,244,170,130,106, 86, 74},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 35, 23,  1,  1,  1,  1,  1,  1},{ 34,232,250,174,134,108, 88, 76},{1,0,0,0,0,0,0,0}},  {/*1*/{ 37, 23,  3,  1,  1,  1,  1,  1},{ 36,248,246,180,138,112, 90, 78},{0,0,0,0,0,0,0,0}},  {/*1*/{ 37, 25,  3,  1,  1,  1,  1,  1},{ 36,234,252,184,142,114, 94, 80},{1,0,0,0,0,0,0,0}},  {/*1*/{ 39, 25,  5,  1,  1,  1,  1,  1},{ 38,250,248,190,146,118, 96, 84},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 39, 27,  5,  1,  1,  1,  1,  1},{ 38,236,254,194,148,120, 98, 86},{1,0,0,0,0,0,0,0}},  {/*1*/{ 41, 27,  7,  1,  1,  1,  1,  1},{ 40,252,250,198,152,124,100, 88},{0,0,0,0,0,0,0,0}},  {/*1*/{ 41, 29,  9,  1,  1,  1,  1,  1},{ 40,238,244,204,156,126,102, 90},{1,0,0,0,0,0,0,0}},  {/*1*/{ 43, 29,  9,  1,  1,  1,  1,  1},{ 42,254,252,208,160,130,106, 92},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 43, 31, 11,  1,  1,  1,  1,  1},{ 42,240,246,214,164,134,108, 94},{1,0,0,0,0,0,0,0}},  {/*1*/{ 45, 33, 11,  1,  1,  1,  1,  1},{ 44,226,254,218,168,136,110, 96},{0,0,0,0,0,0,0,0}},  {/*1*/{ 45, 33, 13,  1,  1,  1,  1,  1},{ 44,242,248,224,172,140,112, 98},{1,0,0,0,0,0,0,0}},  {/*1*/{ 47, 35, 15,  1,  1,  1,  1,  1},{ 46,228,244,228,176,142,116,100},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 47, 35, 15,  1,  1,  1,  1,  1},{ 46,244,250,234,178,146,118,102},{1,0,0,0,0,0,0,0}},  {/*1*/{ 49, 37, 17,  1,  1,  1,  1,  1},{ 48,230,246,238,182,148,120,104},{0,0,0,0,0,0,0,0}},  {/*1*/{ 49, 37, 17,  1,  1,  1,  1,  1},{ 48,246,252,244,186,152,122,106},{1,0,0,0,0,0,0,0}},  {/*1*/{ 51, 39, 19,  1,  1,  1,  1,  1},{ 50,232,248,248,190,154,126,108},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 51, 39, 19,  1,  1,  1,  1,  1},{ 50,248,254,254,194,158,128,110},{1,0,0,0,0,0,0,0}},  {/*1*/{ 53, 41, 21,  3,  1,  1,  1,  1},{ 52,234,250,250,198,160,130,112},{0,0,0,0,0,0,0,0}},  {/*1*/{ 53, 41, 23,  5,  1,  1,  1,  1},{ 52,250,244,248,202,164,132,116},{1,0,0,0,0,0,0,0}},  {/*1*/{ 55, 43, 23,  5,  1,  1,  1,  1},{ 54,236,252,252,206,166,134,118},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 55, 43, 25,  7,  1,  1,  1,  1},{ 54,252,246,250,210,170,138,120},{1,0,0,0,0,0,0,0}},  {/*1*/{ 57, 45, 25,  7,  1,  1,  1,  1},{ 56,238,254,254,212,172,140,122},{0,0,0,0,0,0,0,0}},  {/*1*/{ 57, 45, 27,  9,  1,  1,  1,  1},{ 56,254,248,252,216,176,142,124},{1,0,0,0,0,0,0,0}},  {/*1*/{ 59, 47, 29, 11,  1,  1,  1,  1},{ 58,240,244,248,220,178,144,126},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 59, 49, 29, 11,  1,  1,  1,  1},{ 58,226,250,254,224,182,148,128},{1,0,0,0,0,0,0,0}},  {/*1*/{ 61, 49, 31, 13,  1,  1,  1,  1},{ 60,242,246,250,228,184,150,130},{0,0,0,0,0,0,0,0}},  {/*1*/{ 61, 51, 31, 15,  1,  1,  1,  1},{ 60,228,252,248,232,188,152,132},{1,0,0,0,0,0,0,0}},  {/*1*/{ 63, 51, 33, 15,  1,  1,  1,  1},{ 62,244,248,252,236,190,154,134},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 63, 53, 33, 17,  1,  1,  1,  1},{ 62,230,254,250,240,194,158,136},{1,0,0,0,0,0,0,0}},  {/*1*/{ 65, 53, 35, 17,  1,  1,  1,  1},{ 64,246,250,254,242,198,160,138},{0,0,0,0,0,0,0,0}},  {/*1*/{ 65, 55, 37, 19,  1,  1,  1,  1},{ 64,232,244,252,246,200,162,140},{1,0,0,0,0,0,0,0}},  {/*1*/{ 67, 55, 37, 21,  1,  1,  1,  1},{ 66,248,252,248,250,204,164,142},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 67, 57, 39, 21,  1,  1,  1,  1},{ 66,234,246,254,254,206,166,144},{1,0,0,0,0,0,0,0}},  {/*1*/{ 69, 57, 39, 23,  3,  1,  1,  1},{ 68,250,254,250,252,210,170,148},{0,0,0,0,0,0,0,0}},  {/*1*/{ 69, 59, 41, 25,  5,  1,  1,  1},{ 68,236,248,248,250,212,172,150},{1,0,0,0,0,0,0,0}},  {/*1*/{ 71, 59, 43, 25,  5,  1,  1,  1},{ 70,252,244,252,254,216,174,152},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 71, 61, 43, 27,  7,  1,  1,  1},{ 70,238,250,250,252,218,176,154},{1,0,0,0,0,0,0,0}},  {/*1*/{ 73, 61, 45, 27,  9,  1,  1,  1},{ 72,254,246,254,250,222,180,156},{0,0,0,0,0,0,0,0}},  {/*1*/{ 73, 63, 45, 29,  9,  1,  1,  1},{ 72,240,252,252,254,224,182,158},{1,0,0,0,0,0,0,0}},  {/*1*/{ 75, 65, 47, 31, 11,  1,  1,  1},{ 74,226,248,248,252,228,184,160},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 75, 65, 47, 31, 13,  1,  1,  1},{ 74,242,254,254,252,230,186,162},{1,0,0,0,0,0,0,0}},  {/*1*/{ 77, 67, 49, 33, 13,  1,  1,  1},{ 76,228,250,250,254,234,190,164},{0,0,0,0,0,0,0,0}},  {/*1*/{ 77, 67, 51, 35, 15,  1,  1,  1},{ 76,244,244,248,254,236,192,166},{1,0,0,0,0,0,0,0}},  {/*1*/{ 79, 69, 51, 35, 17,  1,  1,  1},{ 78,230,252,252,252,240,194,168},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 79, 69, 53, 37, 19,  1,  1,  1},{ 78,246,246,250,250,242,196,170},{1,0,0,0,0,0,0,0}},  {/*1*/{ 81, 71, 53, 37, 19,  1,  1,  1},{ 80,232,254,254,254,246,198,172},{0,0,0,0,0,0,0,0}},  {/*1*/{ 81, 71, 55, 39, 21,  1,  1,  1},{ 80,248,248,252,252,248,202,174},{1,0,0,0,0,0,0,0}},  {/*1*/{ 83, 73, 57, 41, 23,  1,  1,  1},{ 82,234,242,248,250,252,204,176},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 83, 73, 57, 41, 23,  1,  1,  1},{ 82,250,250,254,254,254,206,180},{1,0,0,0,0,0,0,0}},  {/*1*/{ 85, 75, 59, 43, 25,  3,  1,  1},{ 84,236,244,250,252,254,208,182},{0,0,0,0,0,0,0,0}},  {/*1*/{ 85, 75, 59, 45, 27,  5,  1,  1},{ 84,252,252,248,250,252,212,184},{1,0,0,0,0,0,0,0}},  {/*1*/{ 87, 77, 61, 45, 27,  7,  1,  1},{ 86,238,246,252,254,252,214,186},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 87, 77, 61, 47, 29,  7,  1,  1},{ 86,254,254,250,252,254,216,188},{1,0,0,0,0,0,0,0}},  {/*1*/{ 89, 79, 63, 47, 31,  9,  1,  1},{ 88,240,248,254,250,254,218,190},{0,0,0,0,0,0,0,0}},  {/*1*/{ 89, 81, 65, 49, 31, 11,  1,  1},{ 88,226,244,252,254,252,222,192},{1,0,0,0,0,0,0,0}},  {/*1*/{ 91, 81, 65, 51, 33, 13,  1,  1},{ 90,242,250,248,252,252,224,194},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 91, 83, 67, 51, 35, 13,  1,  1},{ 90,228,246,254,250,254,226,196},{1,0,0,0,0,0,0,0}},  {/*1*/{ 93, 83, 67, 53, 35, 15,  1,  1},{ 92,244,252,250,254,254,228,198},{0,0,0,0,0,0,0,0}},  {/*1*/{ 93, 85, 69, 55, 37, 17,  1,  1},{ 92,230,248,248,252,252,230,200},{1,0,0,0,0,0,0,0}},  {/*1*/{ 95, 85, 69, 55, 39, 19,  1,  1},{ 94,246,254,252,250,252,234,202},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 95, 87, 71, 57, 39, 19,  1,  1},{ 94,232,250,250,254,254,236,204},{1,0,0,0,0,0,0,0}},  {/*1*/{ 97, 87, 73, 57, 41, 21,  1,  1},{ 96,248,244,254,252,254,238,206},{0,0,0,0,0,0,0,0}},  {/*1*/{ 97, 89, 73, 59, 43, 23,  1,  1},{ 96,234,252,252,252,252,240,208},{1,0,0,0,0,0,0,0}},  {/*1*/{ 99, 89, 75, 61, 43, 25,  1,  1},{ 98,250,246,250,254,252,244,212},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 99, 91, 75, 61, 45, 25,  1,  1},{ 98,236,254,254,254,254,246,214},{1,0,0,0,0,0,0,0}},  {/*1*/{101, 91, 77, 63, 47, 27,  1,  1},{100,252,248,252,252,254,248,216},{0,0,0,0,0,0,0,0}},  {/*1*/{101, 93, 79, 65, 49, 29,  1,  1},{100,238,244,248,250,252,250,218},{1,0,0,0,0,0,0,0}},  {/*1*/{103, 93, 79, 65, 49, 31,  1,  1},{102,254,250,254,254,252,254,220},{0,0,0,0,0,0,0,0}},
+  {/*1*/{103, 95, 81, 67, 51, 31,  3,  1},{102,240,246,250,252,254,252,222},{1,0,0,0,0,0,0,0}},  {/*1*/{105, 97, 81, 69, 53, 33,  5,  1},{104,226,252,248,250,254,252,224},{0,0,0,0,0,0,0,0}},  {/*1*/{105, 97, 83, 69, 53, 35,  5,  1},{104,242,248,252,254,252,254,226},{1,0,0,0,0,0,0,0}},  {/*1*/{107, 99, 83, 71, 55, 37,  7,  1},{106,228,254,250,252,252,254,228},{0,0,0,0,0,0,0,0}},
+  {/*1*/{107, 99, 85, 71, 57, 37,  9,  1},{106,244,250,254,250,254,254,230},{1,0,0,0,0,0,0,0}},  {/*1*/{109,101, 87, 73, 57, 39, 11,  1},{108,230,244,252,254,254,254,232},{0,0,0,0,0,0,0,0}},  {/*1*/{109,101, 87, 75, 59, 41, 13,  1},{108,246,252,248,252,252,252,234},{1,0,0,0,0,0,0,0}},  {/*1*/{111,103, 89, 75, 61, 43, 15,  1},{110,232,246,254,250,252,252,236},{0,0,0,0,0,0,0,0}},
+  {/*1*/{111,103, 89, 77, 61, 43, 15,  1},{110,248,254,250,254,254,254,238},{1,0,0,0,0,0,0,0}},  {/*1*/{113,105, 91, 79, 63, 45, 17,  1},{112,234,248,248,252,254,254,240},{0,0,0,0,0,0,0,0}},  {/*1*/{113,105, 93, 79, 65, 47, 19,  1},{112,250,244,252,250,252,254,244},{1,0,0,0,0,0,0,0}},  {/*1*/{115,107, 93, 81, 65, 49, 21,  1},{114,236,250,250,254,252,254,246},{0,0,0,0,0,0,0,0}},
+  {/*1*/{115,107, 95, 81, 67, 49, 23,  1},{114,252,246,254,252,254,252,248},{1,0,0,0,0,0,0,0}},  {/*1*/{117,109, 95, 83, 69, 51, 25,  1},{116,238,252,252,250,254,252,250},{0,0,0,0,0,0,0,0}},  {/*1*/{117,109, 97, 85, 69, 53, 25,  1},{116,254,248,248,254,252,254,252},{1,0,0,0,0,0,0,0}},  {/*1*/{119,111, 97, 85, 71, 55, 27,  1},{118,240,254,254,252,252,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{119,113, 99, 87, 73, 55, 29,  3},{118,226,250,250,250,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{121,113,101, 89, 73, 57, 31,  5},{120,242,244,248,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{121,115,101, 89, 75, 59, 33,  7},{120,228,252,252,252,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{123,115,103, 91, 77, 61, 35,  9},{122,244,246,250,252,250,252,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{123,117,103, 91, 77, 61, 37, 11},{122,230,254,254,254,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{125,117,105, 93, 79, 63, 37, 13},{124,246,248,252,254,252,254,252},{0,0,0,0,0,0,0,0}},  {/*1*/{125,119,107, 95, 81, 65, 39, 15},{124,232,244,248,252,252,254,252},{1,0,0,0,0,0,0,0}},  {/*1*/{127,119,107, 95, 83, 65, 41, 15},{126,248,250,254,250,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{127,121,109, 97, 83, 67, 43, 17},{126,234,246,250,254,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{129,121,109, 99, 85, 69, 45, 19},{128,250,252,248,252,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{129,123,111, 99, 87, 71, 47, 21},{128,236,248,252,250,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{131,123,111,101, 87, 71, 47, 23},{130,252,254,250,254,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{131,125,113,101, 89, 73, 49, 25},{130,238,250,254,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{133,125,115,103, 91, 75, 51, 27},{132,254,244,252,250,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{133,127,115,105, 91, 77, 53, 29},{132,240,252,248,254,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{135,129,117,105, 93, 77, 55, 31},{134,226,246,254,252,254,252,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{135,129,117,107, 95, 79, 57, 33},{134,242,254,250,250,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{137,131,119,109, 95, 81, 57, 35},{136,228,248,248,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{137,131,121,109, 97, 83, 59, 37},{136,244,242,252,252,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{139,133,121,111, 99, 83, 61, 39},{138,230,250,250,250,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{139,133,123,111, 99, 85, 63, 41},{138,246,244,254,254,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{141,135,123,113,101, 87, 65, 43},{140,232,252,252,252,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{141,135,125,115,103, 89, 67, 45},{140,248,246,248,250,252,252,252},{1,0,0,0,0,0,0,0}},  {/*1*/{143,137,125,115,103, 89, 69, 47},{142,234,254,254,254,254,252,252},{0,0,0,0,0,0,0,0}},
+  {/*1*/{143,137,127,117,105, 91, 69, 47},{142,250,248,250,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{145,139,129,119,107, 93, 71, 49},{144,236,244,248,252,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{145,139,129,119,107, 95, 73, 51},{144,252,250,252,254,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{147,141,131,121,109, 95, 75, 53},{146,238,246,250,254,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{147,141,131,121,111, 97, 77, 55},{146,254,252,254,252,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{149,143,133,123,113, 99, 79, 57},{148,240,248,252,250,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{149,145,133,125,113,101, 79, 59},{148,226,254,250,254,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{151,145,135,125,115,101, 81, 61},{150,242,250,254,252,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{151,147,137,127,117,103, 83, 63},{150,228,244,252,250,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{153,147,137,129,117,105, 85, 65},{152,244,252,248,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{153,149,139,129,119,107, 87, 67},{152,230,246,254,252,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{155,149,139,131,121,107, 89, 69},{154,246,254,250,250,254,252,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{155,151,141,133,121,109, 89, 71},{154,232,248,248,254,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{157,151,143,133,123,111, 91, 73},{156,248,244,252,252,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{157,153,143,135,125,113, 93, 75},{156,234,250,250,250,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{159,153,145,135,125,113, 95, 77},{158,250,246,254,254,254,254,252},{0,0,0,0,0,0,0,0}},
+  {/*1*/{159,155,145,137,127,115, 97, 79},{158,236,252,252,252,254,254,252},{1,0,0,0,0,0,0,0}},  {/*1*/{161,155,147,139,129,117, 99, 79},{160,252,248,248,250,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{161,157,147,139,129,119,101, 81},{160,238,254,254,254,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{163,157,149,141,131,119,101, 83},{162,254,250,250,252,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{163,159,151,143,133,121,103, 85},{162,240,244,248,250,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{165,161,151,143,133,123,105, 87},{164,226,252,252,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{165,161,153,145,135,125,107, 89},{164,242,246,250,252,250,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{167,163,153,145,137,125,109, 91},{166,228,254,254,250,254,252,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{167,163,155,147,137,127,111, 93},{166,244,248,252,254,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{169,165,157,149,139,129,111, 95},{168,230,244,248,252,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{169,165,157,149,141,129,113, 97},{168,246,250,254,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{171,167,159,151,141,131,115, 99},{170,232,246,250,254,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{171,167,159,153,143,133,117,101},{170,248,252,248,254,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{173,169,161,153,145,135,119,103},{172,234,248,252,252,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{173,169,161,155,147,135,121,105},{172,250,254,250,250,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{175,171,163,155,147,137,121,107},{174,236,250,254,254,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{175,171,165,157,149,139,123,109},{174,252,244,252,252,252,254,252},{1,0,0,0,0,0,0,0}},  {/*1*/{177,173,165,159,151,141,125,111},{176,238,252,248,250,252,254,252},{0,0,0,0,0,0,0,0}},  {/*1*/{177,173,167,159,151,141,127,111},{176,254,246,254,254,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{179,175,167,161,153,143,129,113},{178,240,254,250,252,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{179,177,169,163,155,145,131,115},{178,226,248,248,250,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{181,177,171,163,155,147,133,117},{180,242,244,252,254,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{181,179,171,165,157,147,133,119},{180,228,250,250,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{183,179,173,165,159,149,135,121},{182,244,246,254,250,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{183,181,173,167,159,151,137,123},{182,230,252,252,254,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{185,181,175,169,161,153,139,125},{184,246,248,248,252,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{185,183,175,169,163,153,141,127},{184,232,254,254,250,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{187,183,177,171,163,155,143,129},{186,248,250,250,254,254,252,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{187,185,179,173,165,157,143,131},{186,234,244,248,252,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{189,185,179,173,167,159,145,133},{188,250,252,252,250,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{189,187,181,175,167,159,147,135},{188,236,246,250,254,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{191,187,181,175,169,161,149,137},{190,252,254,254,252,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{191,189,183,177,171,163,151,139},{190,238,248,252,252,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{193,189,185,179,171,165,153,141},{192,254,242,248,254,252,252,252},{0,0,0,0,0,0,0,0}},  {/*1*/{193,191,185,179,173,165,153,143},{192,240,250,254,254,254,254,252},{1,0,0,0,0,0,0,0}},  {/*1*/{195,193,187,181,175,167,155,143},{194,226,244,250,252,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{195,193,187,183,177,169,157,145},{194,242,252,248,250,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{197,195,189,183,177,171,159,147},{196,228,246,252,254,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{197,195,189,185,179,171,161,149},{196,244,254,250,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{199,197,191,185,181,173,163,151},{198,230,248,254,250,254,252,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{199,197,193,187,181,175,165,153},{198,246,244,252,254,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{201,199,193,189,183,177,165,155},{200,232,250,250,252,252,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{201,199,195,189,185,177,167,157},{200,248,246,254,250,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{203,201,195,191,185,179,169,159},{202,234,252,252,254,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{203,201,197,193,187,181,171,161},{202,250,248,248,252,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{205,203,197,193,189,183,173,163},{204,236,254,254,250,252,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{205,203,199,195,189,183,175,165},{204,252,250,250,254,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{207,205,201,197,191,185,175,167},{206,238,244,248,252,254,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{207,205,201,197,193,187,177,169},{206,254,252,252,250,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{209,207,203,199,193,189,179,171},{208,240,246,250,254,250,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{209,209,203,199,195,189,181,173},{208,226,254,254,252,254,254,252},{1,0,0,0,0,0,0,0}},  {/*1*/{211,209,205,201,197,191,183,175},{210,242,248,252,250,252,252,252},{0,0,0,0,0,0,0,0}},
+  {/*1*/{211,211,207,203,197,193,185,175},{210,228,244,248,254,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{213,211,207,203,199,193,185,177},{212,244,250,254,252,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{213,213,209,205,201,195,187,179},{212,230,246,250,250,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{215,213,209,207,201,197,189,181},{214,246,252,248,254,252,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{215,215,211,207,203,199,191,183},{214,232,248,252,252,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{217,215,211,209,205,199,193,185},{216,248,254,250,252,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{217,217,213,209,205,201,195,187},{216,234,250,254,254,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{219,217,215,211,207,203,197,189},{218,250,244,252,254,252,252,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{219,219,215,213,209,205,197,191},{218,236,252,248,252,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{221,219,217,213,211,205,199,193},{220,252,246,254,250,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{221,221,217,215,211,207,201,195},{220,238,254,250,254,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{223,221,219,217,213,209,203,197},{222,254,248,248,252,252,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{223,223,221,217,215,211,205,199},{222,240,244,252,250,252,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{225,225,221,219,215,211,207,201},{224,226,250,250,254,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{225,225,223,219,217,213,207,203},{224,242,246,254,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{227,227,223,221,219,215,209,205},{226,228,252,252,250,252,254,252},{0,0,0,0,0,0,0,0}},
+  {/*1*/{227,227,225,223,219,217,211,207},{226,244,248,248,254,252,254,252},{1,0,0,0,0,0,0,0}},  {/*1*/{229,229,225,223,221,217,213,207},{228,230,254,254,252,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{229,229,227,225,223,219,215,209},{228,246,250,250,250,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{231,231,229,227,223,221,217,211},{230,232,244,248,254,252,252,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{231,231,229,227,225,223,217,213},{230,248,252,252,252,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{233,233,231,229,227,223,219,215},{232,234,246,250,250,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{233,233,231,229,227,225,221,217},{232,250,254,254,254,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{235,235,233,231,229,227,223,219},{234,236,248,252,252,252,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{235,235,235,233,231,229,225,221},{234,252,244,248,250,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{237,237,235,233,231,229,227,223},{236,238,250,254,254,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{237,237,237,235,233,231,229,225},{236,254,246,250,252,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{239,239,237,237,235,233,229,227},{238,240,252,248,252,252,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{239,241,239,237,235,235,231,229},{238,240,248,252,254,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{241,241,239,239,237,235,233,231},{240,242,254,250,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{241,243,241,239,239,237,235,233},{240,242,250,254,252,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{243,243,243,241,241,239,237,235},{242,244,244,252,250,252,252,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{243,245,243,243,241,241,239,237},{242,244,252,248,254,252,252,252},{1,0,0,0,0,0,0,0}},  {/*1*/{245,245,245,243,243,241,239,239},{244,246,246,254,252,254,254,252},{0,0,0,0,0,0,0,0}},  {/*1*/{245,247,245,245,245,243,241,239},{244,246,254,250,250,254,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{247,247,247,247,245,245,243,241},{246,248,248,248,254,252,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{247,249,249,247,247,247,245,243},{246,248,248,252,252,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{249,249,249,249,249,247,247,245},{248,250,250,250,250,254,252,254},{0,0,0,0,0,0,0,0}},  {/*1*/{249,251,251,249,249,249,249,247},{248,250,250,254,254,254,252,254},{1,0,0,0,0,0,0,0}},  {/*1*/{251,251,251,251,251,251,249,249},{250,252,252,252,252,252,254,254},{0,0,0,0,0,0,0,0}},
+  {/*1*/{251,253,253,253,253,253,251,251},{250,252,252,252,252,252,254,254},{1,0,0,0,0,0,0,0}},  {/*1*/{253,253,253,253,253,253,253,253},{252,254,254,254,254,254,254,254},{0,0,0,0,0,0,0,0}},  {/*1*/{253,255,255,255,255,255,255,255},{252,254,254,254,254,254,254,254},{1,0,0,0,0,0,0,0}},  {/*0*/{255,255,255,255,255,255,255,255},{254,254,254,254,254,254,254,254},{0,1,1,1,1,1,1,1}}
 },{
-  {{/*1*/{  0,  1,0},{  0,  1,0},{  0,  1,0},{  0,  1,0},{  0,  1,0},{  0,  1,0},{  0,  1,0},{  0,  1,0}}},  {{/*1*/{  0,  1,1},{  0, 17,0},{  0,  9,0},{  0,  5,0},{  0,  5,0},{  0,  5,0},{  0,  3,0},{  0,  3,0}}},  {{/*1*/{  2,  1,0},{  0, 33,0},{  0, 15,0},{  0, 11,0},{  0,  9,0},{  0,  7,0},{  0,  5,0},{  0,  5,0}}},  {{/*1*/{  2,  1,1},{  0, 49,0},{  0, 23,0},{  0, 15,0},{  0, 13,0},{  0, 11,0},{  0,  9,0},{  0,  7,0}}},
-  {{/*1*/{  4,  3,0},{  0, 65,0},{  0, 29,0},{  0, 21,0},{  0, 17,0},{  0, 13,0},{  0, 11,0},{  0,  9,0}}},  {{/*1*/{  4,  3,1},{  0, 81,0},{  0, 37,0},{  0, 25,0},{  0, 19,0},{  0, 17,0},{  0, 13,0},{  0, 11,0}}},  {{/*1*/{  6,  5,0},{  0, 97,0},{  0, 43,0},{  0, 31,0},{  0, 23,0},{  0, 19,0},{  0, 15,0},{  0, 13,0}}},  {{/*1*/{  6,  5,1},{  0,113,0},{  0, 51,0},{  0, 35,0},{  0, 27,0},{  0, 23,0},{  0, 19,0},{  0, 15,0}}},
-  {{/*1*/{  8,  7,0},{  0,129,0},{  0, 57,0},{  0, 41,0},{  0, 31,0},{  0, 25,0},{  0, 21,0},{  0, 19,0}}},  {{/*1*/{  8,  7,1},{  0,145,0},{  0, 65,0},{  0, 45,0},{  0, 35,0},{  0, 29,0},{  0, 23,0},{  0, 21,0}}},  {{/*1*/{ 10,  9,0},{  0,161,0},{  0, 73,0},{  0, 51,0},{  0, 39,0},{  0, 31,0},{  0, 25,0},{  0, 23,0}}},  {{/*1*/{ 10,  9,1},{  0,177,0},{  0, 79,0},{  0, 55,0},{  0, 43,0},{  0, 35,0},{  0, 29,0},{  0, 25,0}}},
-  {{/*1*/{ 12, 11,0},{  0,193,0},{  0, 87,0},{  0, 61,0},{  0, 47,0},{  0, 37,0},{  0, 31,0},{  0, 27,0}}},  {{/*1*/{ 12, 11,1},{  0,209,0},{  0, 93,0},{  0, 65,0},{  0, 49,0},{  0, 41,0},{  0, 33,0},{  0, 29,0}}},  {{/*1*/{ 14, 13,0},{  0,225,0},{  0,101,0},{  0, 69,0},{  0, 53,0},{  0, 43,0},{  0, 35,0},{  0, 31,0}}},  {{/*1*/{ 14, 13,1},{  0,241,0},{  0,107,0},{  0, 75,0},{  0, 57,0},{  0, 47,0},{  0, 37,0},{  0, 33,0}}},
-  {{/*1*/{ 16, 15,0},{  2,227,0},{  0,115,0},{  0, 79,0},{  0, 61,0},{  0, 49,0},{  0, 41,0},{  0, 35,0}}},  {{/*1*/{ 16, 15,1},{  2,243,0},{  0,121,0},{  0, 85,0},{  0, 65,0},{  0, 53,0},{  0, 43,0},{  0, 37,0}}},  {{/*1*/{ 18, 17,0},{  4,229,0},{  0,129,0},{  0, 89,0},{  0, 69,0},{  0, 55,0},{  0, 45,0},{  0, 39,0}}},  {{/*1*/{ 18, 17,1},{  4,245,0},{  0,137,0},{  0, 95,0},{  0, 73,0},{  0, 59,0},{  0, 47,0},{  0, 41,0}}},
-  {{/*1*/{ 20, 19,0},{  6,231,0},{  0,143,0},{  0, 99,0},{  0, 77,0},{  0, 61,0},{  0, 51,0},{  0, 43,0}}},  {{/*1*/{ 20, 19,1},{  6,247,0},{  0,151,0},{  0,105,0},{  0, 81,0},{  0, 65,0},{  0, 53,0},{  0, 45,0}}},  {{/*1*/{ 22, 21,0},{  8,233,0},{  0,157,0},{  0,109,0},{  0, 83,0},{  0, 69,0},{  0, 55,0},{  0, 47,0}}},  {{/*1*/{ 22, 21,1},{  8,249,0},{  0,165,0},{  0,115,0},{  0, 87,0},{  0, 71,0},{  0, 57,0},{  0, 51,0}}},
-  {{/*1*/{ 24, 23,0},{ 10,235,0},{  0,171,0},{  0,119,0},{  0, 91,0},{  0, 75,0},{  0, 61,0},{  0, 53,0}}},  {{/*1*/{ 24, 23,1},{ 10,251,0},{  0,179,0},{  0,125,0},{  0, 95,0},{  0, 77,0},{  0, 63,0},{  0, 55,0}}},  {{/*1*/{ 26, 25,0},{ 12,237,0},{  0,185,0},{  0,129,0},{  0, 99,0},{  0, 81,0},{  0, 65,0},{  0, 57,0}}},  {{/*1*/{ 26, 25,1},{ 12,253,0},{  0,193,0},{  0,133,0},{  0,103,0},{  0, 83,0},{  0, 67,0},{  0, 59,0}}},
-  {{/*1*/{ 28, 27,0},{ 14,239,0},{  0,201,0},{  0,139,0},{  0,107,0},{  0, 87,0},{  0, 69,0},{  0, 61,0}}},  {{/*1*/{ 28, 27,1},{ 14,255,0},{  0,207,0},{  0,143,0},{  0,111,0},{  0, 89,0},{  0, 73,0},{  0, 63,0}}},  {{/*1*/{ 30, 29,0},{ 16,241,0},{  0,215,0},{  0,149,0},{  0,113,0},{  0, 93,0},{  0, 75,0},{  0, 65,0}}},  {{/*1*/{ 30, 29,1},{ 18,227,0},{  0,221,0},{  0,153,0},{  0,117,0},{  0, 95,0},{  0, 77,0},{  0, 67,0}}},
-  {{/*1*/{ 32, 31,0},{ 18,243,0},{  0,229,0},{  0,159,0},{  0,121,0},{  0, 99,0},{  0, 79,0},{  0, 69,0}}},  {{/*1*/{ 32, 31,1},{ 20,229,0},{  0,235,0},{  0,163,0},{  0,125,0},{  0,101,0},{  0, 83,0},{  0, 71,0}}},  {{/*1*/{ 34, 33,0},{ 20,245,0},{  0,243,0},{  0,169,0},{  0,129,0},{  0,105,0},{  0, 85,0},{  0, 73,0}}},  {{/*1*/{ 34, 33,1},{ 22,231,0},{  0,249,0},{  0,173,0},{  0,133,0},{  0,107,0},{  0, 87,0},{  0, 75,0}}},
-  {{/*1*/{ 36, 35,0},{ 22,247,0},{  2,245,0},{  0,179,0},{  0,137,0},{  0,111,0},{  0, 89,0},{  0, 77,0}}},  {{/*1*/{ 36, 35,1},{ 24,233,0},{  2,251,0},{  0,183,0},{  0,141,0},{  0,113,0},{  0, 93,0},{  0, 79,0}}},  {{/*1*/{ 38, 37,0},{ 24,249,0},{  4,247,0},{  0,189,0},{  0,145,0},{  0,117,0},{  0, 95,0},{  0, 83,0}}},  {{/*1*/{ 38, 37,1},{ 26,235,0},{  4,253,0},{  0,193,0},{  0,147,0},{  0,119,0},{  0, 97,0},{  0, 85,0}}},
-  {{/*1*/{ 40, 39,0},{ 26,251,0},{  6,249,0},{  0,197,0},{  0,151,0},{  0,123,0},{  0, 99,0},{  0, 87,0}}},  {{/*1*/{ 40, 39,1},{ 28,237,0},{  6,255,0},{  0,203,0},{  0,155,0},{  0,125,0},{  0,101,0},{  0, 89,0}}},  {{/*1*/{ 42, 41,0},{ 28,253,0},{  8,251,0},{  0,207,0},{  0,159,0},{  0,129,0},{  0,105,0},{  0, 91,0}}},  {{/*1*/{ 42, 41,1},{ 30,239,0},{ 10,245,0},{  0,213,0},{  0,163,0},{  0,133,0},{  0,107,0},{  0, 93,0}}},
-  {{/*1*/{ 44, 43,0},{ 30,255,0},{ 10,253,0},{  0,217,0},{  0,167,0},{  0,135,0},{  0,109,0},{  0, 95,0}}},  {{/*1*/{ 44, 43,1},{ 32,241,0},{ 12,247,0},{  0,223,0},{  0,171,0},{  0,139,0},{  0,111,0},{  0, 97,0}}},  {{/*1*/{ 46, 45,0},{ 34,227,0},{ 12,255,0},{  0,227,0},{  0,175,0},{  0,141,0},{  0,115,0},{  0, 99,0}}},  {{/*1*/{ 46, 45,1},{ 34,243,0},{ 14,249,0},{  0,233,0},{  0,177,0},{  0,145,0},{  0,117,0},{  0,101,0}}},
-  {{/*1*/{ 48, 47,0},{ 36,229,0},{ 16,245,0},{  0,237,0},{  0,181,0},{  0,147,0},{  0,119,0},{  0,103,0}}},  {{/*1*/{ 48, 47,1},{ 36,245,0},{ 16,251,0},{  0,243,0},{  0,185,0},{  0,151,0},{  0,121,0},{  0,105,0}}},  {{/*1*/{ 50, 49,0},{ 38,231,0},{ 18,247,0},{  0,247,0},{  0,189,0},{  0,153,0},{  0,125,0},{  0,107,0}}},  {{/*1*/{ 50, 49,1},{ 38,247,0},{ 18,253,0},{  0,253,0},{  0,193,0},{  0,157,0},{  0,127,0},{  0,109,0}}},
-  {{/*1*/{ 52, 51,0},{ 40,233,0},{ 20,249,0},{  2,249,0},{  0,197,0},{  0,159,0},{  0,129,0},{  0,111,0}}},  {{/*1*/{ 52, 51,1},{ 40,249,0},{ 20,255,0},{  2,255,0},{  0,201,0},{  0,163,0},{  0,131,0},{  0,115,0}}},  {{/*1*/{ 54, 53,0},{ 42,235,0},{ 22,251,0},{  4,251,0},{  0,205,0},{  0,165,0},{  0,133,0},{  0,117,0}}},  {{/*1*/{ 54, 53,1},{ 42,251,0},{ 24,245,0},{  6,249,0},{  0,209,0},{  0,169,0},{  0,137,0},{  0,119,0}}},
-  {{/*1*/{ 56, 55,0},{ 44,237,0},{ 24,253,0},{  6,253,0},{  0,211,0},{  0,171,0},{  0,139,0},{  0,121,0}}},  {{/*1*/{ 56, 55,1},{ 44,253,0},{ 26,247,0},{  8,251,0},{  0,215,0},{  0,175,0},{  0,141,0},{  0,123,0}}},  {{/*1*/{ 58, 57,0},{ 46,239,0},{ 26,255,0},{  8,255,0},{  0,219,0},{  0,177,0},{  0,143,0},{  0,125,0}}},  {{/*1*/{ 58, 57,1},{ 46,255,0},{ 28,249,0},{ 10,253,0},{  0,223,0},{  0,181,0},{  0,147,0},{  0,127,0}}},
-  {{/*1*/{ 60, 59,0},{ 48,241,0},{ 30,245,0},{ 12,249,0},{  0,227,0},{  0,183,0},{  0,149,0},{  0,129,0}}},  {{/*1*/{ 60, 59,1},{ 50,227,0},{ 30,251,0},{ 12,255,0},{  0,231,0},{  0,187,0},{  0,151,0},{  0,131,0}}},  {{/*1*/{ 62, 61,0},{ 50,243,0},{ 32,247,0},{ 14,251,0},{  0,235,0},{  0,189,0},{  0,153,0},{  0,133,0}}},  {{/*1*/{ 62, 61,1},{ 52,229,0},{ 32,253,0},{ 16,249,0},{  0,239,0},{  0,193,0},{  0,157,0},{  0,135,0}}},
-  {{/*1*/{ 64, 63,0},{ 52,245,0},{ 34,249,0},{ 16,253,0},{  0,241,0},{  0,197,0},{  0,159,0},{  0,137,0}}},  {{/*1*/{ 64, 63,1},{ 54,231,0},{ 34,255,0},{ 18,251,0},{  0,245,0},{  0,199,0},{  0,161,0},{  0,139,0}}},  {{/*1*/{ 66, 65,0},{ 54,247,0},{ 36,251,0},{ 18,255,0},{  0,249,0},{  0,203,0},{  0,163,0},{  0,141,0}}},  {{/*1*/{ 66, 65,1},{ 56,233,0},{ 38,245,0},{ 20,253,0},{  0,253,0},{  0,205,0},{  0,165,0},{  0,143,0}}},
-  {{/*1*/{ 68, 67,0},{ 56,249,0},{ 38,253,0},{ 22,249,0},{  2,251,0},{  0,209,0},{  0,169,0},{  0,147,0}}},  {{/*1*/{ 68, 67,1},{ 58,235,0},{ 40,247,0},{ 22,255,0},{  2,255,0},{  0,211,0},{  0,171,0},{  0,149,0}}},  {{/*1*/{ 70, 69,0},{ 58,251,0},{ 40,255,0},{ 24,251,0},{  4,253,0},{  0,215,0},{  0,173,0},{  0,151,0}}},  {{/*1*/{ 70, 69,1},{ 60,237,0},{ 42,249,0},{ 26,249,0},{  6,251,0},{  0,217,0},{  0,175,0},{  0,153,0}}},
-  {{/*1*/{ 72, 71,0},{ 60,253,0},{ 44,245,0},{ 26,253,0},{  6,255,0},{  0,221,0},{  0,179,0},{  0,155,0}}},  {{/*1*/{ 72, 71,1},{ 62,239,0},{ 44,251,0},{ 28,251,0},{  8,253,0},{  0,223,0},{  0,181,0},{  0,157,0}}},  {{/*1*/{ 74, 73,0},{ 62,255,0},{ 46,247,0},{ 28,255,0},{ 10,251,0},{  0,227,0},{  0,183,0},{  0,159,0}}},  {{/*1*/{ 74, 73,1},{ 64,241,0},{ 46,253,0},{ 30,253,0},{ 10,255,0},{  0,229,0},{  0,185,0},{  0,161,0}}},
-  {{/*1*/{ 76, 75,0},{ 66,227,0},{ 48,249,0},{ 32,249,0},{ 12,253,0},{  0,233,0},{  0,189,0},{  0,163,0}}},  {{/*1*/{ 76, 75,1},{ 66,243,0},{ 48,255,0},{ 32,255,0},{ 14,253,0},{  0,235,0},{  0,191,0},{  0,165,0}}},  {{/*1*/{ 78, 77,0},{ 68,229,0},{ 50,251,0},{ 34,251,0},{ 14,255,0},{  0,239,0},{  0,193,0},{  0,167,0}}},  {{/*1*/{ 78, 77,1},{ 68,245,0},{ 52,245,0},{ 36,249,0},{ 16,255,0},{  0,241,0},{  0,195,0},{  0,169,0}}},
-  {{/*1*/{ 80, 79,0},{ 70,231,0},{ 52,253,0},{ 36,253,0},{ 18,253,0},{  0,245,0},{  0,197,0},{  0,171,0}}},  {{/*1*/{ 80, 79,1},{ 70,247,0},{ 54,247,0},{ 38,251,0},{ 20,251,0},{  0,247,0},{  0,201,0},{  0,173,0}}},  {{/*1*/{ 82, 81,0},{ 72,233,0},{ 54,255,0},{ 38,255,0},{ 20,255,0},{  0,251,0},{  0,203,0},{  0,175,0}}},  {{/*1*/{ 82, 81,1},{ 72,249,0},{ 56,249,0},{ 40,253,0},{ 22,253,0},{  0,253,0},{  0,205,0},{  0,179,0}}},
-  {{/*1*/{ 84, 83,0},{ 74,235,0},{ 58,243,0},{ 42,249,0},{ 24,251,0},{  2,253,0},{  0,207,0},{  0,181,0}}},  {{/*1*/{ 84, 83,1},{ 74,251,0},{ 58,251,0},{ 42,255,0},{ 24,255,0},{  2,255,0},{  0,211,0},{  0,183,0}}},  {{/*1*/{ 86, 85,0},{ 76,237,0},{ 60,245,0},{ 44,251,0},{ 26,253,0},{  4,255,0},{  0,213,0},{  0,185,0}}},  {{/*1*/{ 86, 85,1},{ 76,253,0},{ 60,253,0},{ 46,249,0},{ 28,251,0},{  6,253,0},{  0,215,0},{  0,187,0}}},
-  {{/*1*/{ 88, 87,0},{ 78,239,0},{ 62,247,0},{ 46,253,0},{ 28,255,0},{  8,253,0},{  0,217,0},{  0,189,0}}},  {{/*1*/{ 88, 87,1},{ 78,255,0},{ 62,255,0},{ 48,251,0},{ 30,253,0},{  8,255,0},{  0,221,0},{  0,191,0}}},  {{/*1*/{ 90, 89,0},{ 80,241,0},{ 64,249,0},{ 48,255,0},{ 32,251,0},{ 10,255,0},{  0,223,0},{  0,193,0}}},  {{/*1*/{ 90, 89,1},{ 82,227,0},{ 66,245,0},{ 50,253,0},{ 32,255,0},{ 12,253,0},{  0,225,0},{  0,195,0}}},
-  {{/*1*/{ 92, 91,0},{ 82,243,0},{ 66,251,0},{ 52,249,0},{ 34,253,0},{ 14,253,0},{  0,227,0},{  0,197,0}}},  {{/*1*/{ 92, 91,1},{ 84,229,0},{ 68,247,0},{ 52,255,0},{ 36,251,0},{ 14,255,0},{  0,229,0},{  0,199,0}}},  {{/*1*/{ 94, 93,0},{ 84,245,0},{ 68,253,0},{ 54,251,0},{ 36,255,0},{ 16,255,0},{  0,233,0},{  0,201,0}}},  {{/*1*/{ 94, 93,1},{ 86,231,0},{ 70,249,0},{ 56,249,0},{ 38,253,0},{ 18,253,0},{  0,235,0},{  0,203,0}}},
-  {{/*1*/{ 96, 95,0},{ 86,247,0},{ 70,255,0},{ 56,253,0},{ 40,251,0},{ 20,253,0},{  0,237,0},{  0,205,0}}},  {{/*1*/{ 96, 95,1},{ 88,233,0},{ 72,251,0},{ 58,251,0},{ 40,255,0},{ 20,255,0},{  0,239,0},{  0,207,0}}},  {{/*1*/{ 98, 97,0},{ 88,249,0},{ 74,245,0},{ 58,255,0},{ 42,253,0},{ 22,255,0},{  0,243,0},{  0,211,0}}},  {{/*1*/{ 98, 97,1},{ 90,235,0},{ 74,253,0},{ 60,253,0},{ 44,253,0},{ 24,253,0},{  0,245,0},{  0,213,0}}},
-  {{/*1*/{100, 99,0},{ 90,251,0},{ 76,247,0},{ 62,251,0},{ 44,255,0},{ 26,253,0},{  0,247,0},{  0,215,0}}},  {{/*1*/{100, 99,1},{ 92,237,0},{ 76,255,0},{ 62,255,0},{ 46,255,0},{ 26,255,0},{  0,249,0},{  0,217,0}}},  {{/*1*/{102,101,0},{ 92,253,0},{ 78,249,0},{ 64,253,0},{ 48,253,0},{ 28,255,0},{  0,253,0},{  0,219,0}}},  {{/*1*/{102,101,1},{ 94,239,0},{ 80,245,0},{ 66,249,0},{ 50,251,0},{ 30,253,0},{  0,255,0},{  0,221,0}}},
-  {{/*1*/{104,103,0},{ 94,255,0},{ 80,251,0},{ 66,255,0},{ 50,255,0},{ 32,253,0},{  2,255,0},{  0,223,0}}},  {{/*1*/{104,103,1},{ 96,241,0},{ 82,247,0},{ 68,251,0},{ 52,253,0},{ 32,255,0},{  4,253,0},{  0,225,0}}},  {{/*1*/{106,105,0},{ 98,227,0},{ 82,253,0},{ 70,249,0},{ 54,251,0},{ 34,255,0},{  6,253,0},{  0,227,0}}},  {{/*1*/{106,105,1},{ 98,243,0},{ 84,249,0},{ 70,253,0},{ 54,255,0},{ 36,253,0},{  6,255,0},{  0,229,0}}},
-  {{/*1*/{108,107,0},{100,229,0},{ 84,255,0},{ 72,251,0},{ 56,253,0},{ 38,253,0},{  8,255,0},{  0,231,0}}},  {{/*1*/{108,107,1},{100,245,0},{ 86,251,0},{ 72,255,0},{ 58,251,0},{ 38,255,0},{ 10,255,0},{  0,233,0}}},  {{/*1*/{110,109,0},{102,231,0},{ 88,245,0},{ 74,253,0},{ 58,255,0},{ 40,255,0},{ 12,255,0},{  0,235,0}}},  {{/*1*/{110,109,1},{102,247,0},{ 88,253,0},{ 76,249,0},{ 60,253,0},{ 42,253,0},{ 14,253,0},{  0,237,0}}},
-  {{/*1*/{112,111,0},{104,233,0},{ 90,247,0},{ 76,255,0},{ 62,251,0},{ 44,253,0},{ 16,253,0},{  0,239,0}}},  {{/*1*/{112,111,1},{104,249,0},{ 90,255,0},{ 78,251,0},{ 62,255,0},{ 44,255,0},{ 16,255,0},{  0,243,0}}},  {{/*1*/{114,113,0},{106,235,0},{ 92,249,0},{ 80,249,0},{ 64,253,0},{ 46,255,0},{ 18,255,0},{  0,245,0}}},  {{/*1*/{114,113,1},{106,251,0},{ 94,245,0},{ 80,253,0},{ 66,251,0},{ 48,253,0},{ 20,255,0},{  0,247,0}}},
-  {{/*1*/{116,115,0},{108,237,0},{ 94,251,0},{ 82,251,0},{ 66,255,0},{ 50,253,0},{ 22,255,0},{  0,249,0}}},  {{/*1*/{116,115,1},{108,253,0},{ 96,247,0},{ 82,255,0},{ 68,253,0},{ 50,255,0},{ 24,253,0},{  0,251,0}}},  {{/*1*/{118,117,0},{110,239,0},{ 96,253,0},{ 84,253,0},{ 70,251,0},{ 52,255,0},{ 26,253,0},{  0,253,0}}},  {{/*1*/{118,117,1},{110,255,0},{ 98,249,0},{ 86,249,0},{ 70,255,0},{ 54,253,0},{ 26,255,0},{  0,255,0}}},
-  {{/*1*/{120,119,0},{112,241,0},{ 98,255,0},{ 86,255,0},{ 72,253,0},{ 56,253,0},{ 28,255,0},{  2,255,0}}},  {{/*1*/{120,119,1},{114,227,0},{100,251,0},{ 88,251,0},{ 74,251,0},{ 56,255,0},{ 30,255,0},{  4,255,0}}},  {{/*1*/{122,121,0},{114,243,0},{102,245,0},{ 90,249,0},{ 74,255,0},{ 58,255,0},{ 32,255,0},{  6,255,0}}},  {{/*1*/{122,121,1},{116,229,0},{102,253,0},{ 90,253,0},{ 76,253,0},{ 60,253,0},{ 34,255,0},{  8,255,0}}},
-  {{/*1*/{124,123,0},{116,245,0},{104,247,0},{ 92,251,0},{ 78,253,0},{ 62,251,0},{ 36,253,0},{ 10,255,0}}},  {{/*1*/{124,123,1},{118,231,0},{104,255,0},{ 92,255,0},{ 78,255,0},{ 62,255,0},{ 38,253,0},{ 12,255,0}}},  {{/*1*/{126,125,0},{118,247,0},{106,249,0},{ 94,253,0},{ 80,255,0},{ 64,253,0},{ 38,255,0},{ 14,253,0}}},  {{/*1*/{126,125,1},{120,233,0},{108,245,0},{ 96,249,0},{ 82,253,0},{ 66,253,0},{ 40,255,0},{ 16,253,0}}},
-  {{/*1*/{128,127,0},{120,249,0},{108,251,0},{ 96,255,0},{ 84,251,0},{ 66,255,0},{ 42,255,0},{ 16,255,0}}},  {{/*1*/{128,127,1},{122,235,0},{110,247,0},{ 98,251,0},{ 84,255,0},{ 68,255,0},{ 44,255,0},{ 18,255,0}}},  {{/*1*/{130,129,0},{122,251,0},{110,253,0},{100,249,0},{ 86,253,0},{ 70,253,0},{ 46,253,0},{ 20,255,0}}},  {{/*1*/{130,129,1},{124,237,0},{112,249,0},{100,253,0},{ 88,251,0},{ 72,253,0},{ 48,253,0},{ 22,255,0}}},
-  {{/*1*/{132,131,0},{124,253,0},{112,255,0},{102,251,0},{ 88,255,0},{ 72,255,0},{ 48,255,0},{ 24,255,0}}},  {{/*1*/{132,131,1},{126,239,0},{114,251,0},{102,255,0},{ 90,253,0},{ 74,255,0},{ 50,255,0},{ 26,255,0}}},  {{/*1*/{134,133,0},{126,255,0},{116,245,0},{104,253,0},{ 92,251,0},{ 76,253,0},{ 52,255,0},{ 28,255,0}}},  {{/*1*/{134,133,1},{128,241,0},{116,253,0},{106,249,0},{ 92,255,0},{ 78,253,0},{ 54,255,0},{ 30,255,0}}},
-  {{/*1*/{136,135,0},{130,227,0},{118,247,0},{106,255,0},{ 94,253,0},{ 78,255,0},{ 56,253,0},{ 32,255,0}}},  {{/*1*/{136,135,1},{130,243,0},{118,255,0},{108,251,0},{ 96,251,0},{ 80,255,0},{ 58,253,0},{ 34,255,0}}},  {{/*1*/{138,137,0},{132,229,0},{120,249,0},{110,249,0},{ 96,255,0},{ 82,253,0},{ 58,255,0},{ 36,255,0}}},  {{/*1*/{138,137,1},{132,245,0},{122,243,0},{110,253,0},{ 98,253,0},{ 84,253,0},{ 60,255,0},{ 38,255,0}}},
-  {{/*1*/{140,139,0},{134,231,0},{122,251,0},{112,251,0},{100,251,0},{ 84,255,0},{ 62,255,0},{ 40,255,0}}},  {{/*1*/{140,139,1},{134,247,0},{124,245,0},{112,255,0},{100,255,0},{ 86,255,0},{ 64,255,0},{ 42,255,0}}},  {{/*1*/{142,141,0},{136,233,0},{124,253,0},{114,253,0},{102,253,0},{ 88,253,0},{ 66,255,0},{ 44,255,0}}},  {{/*1*/{142,141,1},{136,249,0},{126,247,0},{116,249,0},{104,251,0},{ 90,253,0},{ 68,253,0},{ 46,253,0}}},
-  {{/*1*/{144,143,0},{138,235,0},{126,255,0},{116,255,0},{104,255,0},{ 90,255,0},{ 70,253,0},{ 48,253,0}}},  {{/*1*/{144,143,1},{138,251,0},{128,249,0},{118,251,0},{106,253,0},{ 92,255,0},{ 70,255,0},{ 48,255,0}}},  {{/*1*/{146,145,0},{140,237,0},{130,245,0},{120,249,0},{108,253,0},{ 94,253,0},{ 72,255,0},{ 50,255,0}}},  {{/*1*/{146,145,1},{140,253,0},{130,251,0},{120,253,0},{108,255,0},{ 96,253,0},{ 74,255,0},{ 52,255,0}}},
-  {{/*1*/{148,147,0},{142,239,0},{132,247,0},{122,251,0},{110,255,0},{ 96,255,0},{ 76,255,0},{ 54,255,0}}},  {{/*1*/{148,147,1},{142,255,0},{132,253,0},{122,255,0},{112,253,0},{ 98,255,0},{ 78,253,0},{ 56,255,0}}},  {{/*1*/{150,149,0},{144,241,0},{134,249,0},{124,253,0},{114,251,0},{100,253,0},{ 80,253,0},{ 58,255,0}}},  {{/*1*/{150,149,1},{146,227,0},{134,255,0},{126,251,0},{114,255,0},{102,253,0},{ 80,255,0},{ 60,255,0}}},
-  {{/*1*/{152,151,0},{146,243,0},{136,251,0},{126,255,0},{116,253,0},{102,255,0},{ 82,255,0},{ 62,255,0}}},  {{/*1*/{152,151,1},{148,229,0},{138,245,0},{128,253,0},{118,251,0},{104,255,0},{ 84,255,0},{ 64,255,0}}},  {{/*1*/{154,153,0},{148,245,0},{138,253,0},{130,249,0},{118,255,0},{106,253,0},{ 86,255,0},{ 66,255,0}}},  {{/*1*/{154,153,1},{150,231,0},{140,247,0},{130,255,0},{120,253,0},{108,253,0},{ 88,253,0},{ 68,255,0}}},
-  {{/*1*/{156,155,0},{150,247,0},{140,255,0},{132,251,0},{122,251,0},{108,255,0},{ 90,253,0},{ 70,255,0}}},  {{/*1*/{156,155,1},{152,233,0},{142,249,0},{134,249,0},{122,255,0},{110,255,0},{ 90,255,0},{ 72,255,0}}},  {{/*1*/{158,157,0},{152,249,0},{144,245,0},{134,253,0},{124,253,0},{112,253,0},{ 92,255,0},{ 74,255,0}}},  {{/*1*/{158,157,1},{154,235,0},{144,251,0},{136,251,0},{126,251,0},{114,253,0},{ 94,255,0},{ 76,255,0}}},
-  {{/*1*/{160,159,0},{154,251,0},{146,247,0},{136,255,0},{126,255,0},{114,255,0},{ 96,255,0},{ 78,253,0}}},  {{/*1*/{160,159,1},{156,237,0},{146,253,0},{138,253,0},{128,253,0},{116,255,0},{ 98,255,0},{ 80,253,0}}},  {{/*1*/{162,161,0},{156,253,0},{148,249,0},{140,249,0},{130,251,0},{118,253,0},{100,253,0},{ 80,255,0}}},  {{/*1*/{162,161,1},{158,239,0},{148,255,0},{140,255,0},{130,255,0},{120,253,0},{102,253,0},{ 82,255,0}}},
-  {{/*1*/{164,163,0},{158,255,0},{150,251,0},{142,251,0},{132,253,0},{120,255,0},{102,255,0},{ 84,255,0}}},  {{/*1*/{164,163,1},{160,241,0},{152,245,0},{144,249,0},{134,251,0},{122,255,0},{104,255,0},{ 86,255,0}}},  {{/*1*/{166,165,0},{162,227,0},{152,253,0},{144,253,0},{134,255,0},{124,253,0},{106,255,0},{ 88,255,0}}},  {{/*1*/{166,165,1},{162,243,0},{154,247,0},{146,251,0},{136,253,0},{126,251,0},{108,255,0},{ 90,255,0}}},
-  {{/*1*/{168,167,0},{164,229,0},{154,255,0},{146,255,0},{138,251,0},{126,255,0},{110,253,0},{ 92,255,0}}},  {{/*1*/{168,167,1},{164,245,0},{156,249,0},{148,253,0},{138,255,0},{128,253,0},{112,253,0},{ 94,255,0}}},  {{/*1*/{170,169,0},{166,231,0},{158,245,0},{150,249,0},{140,253,0},{130,253,0},{112,255,0},{ 96,255,0}}},  {{/*1*/{170,169,1},{166,247,0},{158,251,0},{150,255,0},{142,253,0},{130,255,0},{114,255,0},{ 98,255,0}}},
-  {{/*1*/{172,171,0},{168,233,0},{160,247,0},{152,251,0},{142,255,0},{132,255,0},{116,255,0},{100,255,0}}},  {{/*1*/{172,171,1},{168,249,0},{160,253,0},{154,249,0},{144,255,0},{134,253,0},{118,255,0},{102,255,0}}},  {{/*1*/{174,173,0},{170,235,0},{162,249,0},{154,253,0},{146,253,0},{136,253,0},{120,253,0},{104,255,0}}},  {{/*1*/{174,173,1},{170,251,0},{162,255,0},{156,251,0},{148,251,0},{136,255,0},{122,253,0},{106,255,0}}},
-  {{/*1*/{176,175,0},{172,237,0},{164,251,0},{156,255,0},{148,255,0},{138,255,0},{122,255,0},{108,255,0}}},  {{/*1*/{176,175,1},{172,253,0},{166,245,0},{158,253,0},{150,253,0},{140,253,0},{124,255,0},{110,253,0}}},  {{/*1*/{178,177,0},{174,239,0},{166,253,0},{160,249,0},{152,251,0},{142,253,0},{126,255,0},{112,253,0}}},  {{/*1*/{178,177,1},{174,255,0},{168,247,0},{160,255,0},{152,255,0},{142,255,0},{128,255,0},{112,255,0}}},
-  {{/*1*/{180,179,0},{176,241,0},{168,255,0},{162,251,0},{154,253,0},{144,255,0},{130,255,0},{114,255,0}}},  {{/*1*/{180,179,1},{178,227,0},{170,249,0},{164,249,0},{156,251,0},{146,253,0},{132,253,0},{116,255,0}}},  {{/*1*/{182,181,0},{178,243,0},{172,245,0},{164,253,0},{156,255,0},{148,253,0},{134,253,0},{118,255,0}}},  {{/*1*/{182,181,1},{180,229,0},{172,251,0},{166,251,0},{158,253,0},{148,255,0},{134,255,0},{120,255,0}}},
-  {{/*1*/{184,183,0},{180,245,0},{174,247,0},{166,255,0},{160,251,0},{150,255,0},{136,255,0},{122,255,0}}},  {{/*1*/{184,183,1},{182,231,0},{174,253,0},{168,253,0},{160,255,0},{152,253,0},{138,255,0},{124,255,0}}},  {{/*1*/{186,185,0},{182,247,0},{176,249,0},{170,249,0},{162,253,0},{154,253,0},{140,255,0},{126,255,0}}},  {{/*1*/{186,185,1},{184,233,0},{176,255,0},{170,255,0},{164,251,0},{154,255,0},{142,253,0},{128,255,0}}},
-  {{/*1*/{188,187,0},{184,249,0},{178,251,0},{172,251,0},{164,255,0},{156,255,0},{144,253,0},{130,255,0}}},  {{/*1*/{188,187,1},{186,235,0},{180,245,0},{174,249,0},{166,253,0},{158,253,0},{144,255,0},{132,255,0}}},  {{/*1*/{190,189,0},{186,251,0},{180,253,0},{174,253,0},{168,251,0},{160,253,0},{146,255,0},{134,255,0}}},  {{/*1*/{190,189,1},{188,237,0},{182,247,0},{176,251,0},{168,255,0},{160,255,0},{148,255,0},{136,255,0}}},
-  {{/*1*/{192,191,0},{188,253,0},{182,255,0},{176,255,0},{170,253,0},{162,255,0},{150,255,0},{138,255,0}}},  {{/*1*/{192,191,1},{190,239,0},{184,249,0},{178,253,0},{172,253,0},{164,253,0},{152,253,0},{140,255,0}}},  {{/*1*/{194,193,0},{190,255,0},{186,243,0},{180,249,0},{172,255,0},{166,253,0},{154,253,0},{142,253,0}}},  {{/*1*/{194,193,1},{192,241,0},{186,251,0},{180,255,0},{174,255,0},{166,255,0},{154,255,0},{144,253,0}}},
-  {{/*1*/{196,195,0},{194,227,0},{188,245,0},{182,251,0},{176,253,0},{168,255,0},{156,255,0},{144,255,0}}},  {{/*1*/{196,195,1},{194,243,0},{188,253,0},{184,249,0},{178,251,0},{170,253,0},{158,255,0},{146,255,0}}},  {{/*1*/{198,197,0},{196,229,0},{190,247,0},{184,253,0},{178,255,0},{172,253,0},{160,255,0},{148,255,0}}},  {{/*1*/{198,197,1},{196,245,0},{190,255,0},{186,251,0},{180,253,0},{172,255,0},{162,255,0},{150,255,0}}},
-  {{/*1*/{200,199,0},{198,231,0},{192,249,0},{186,255,0},{182,251,0},{174,255,0},{164,253,0},{152,255,0}}},  {{/*1*/{200,199,1},{198,247,0},{194,245,0},{188,253,0},{182,255,0},{176,253,0},{166,253,0},{154,255,0}}},  {{/*1*/{202,201,0},{200,233,0},{194,251,0},{190,251,0},{184,253,0},{178,253,0},{166,255,0},{156,255,0}}},  {{/*1*/{202,201,1},{200,249,0},{196,247,0},{190,255,0},{186,251,0},{178,255,0},{168,255,0},{158,255,0}}},
-  {{/*1*/{204,203,0},{202,235,0},{196,253,0},{192,253,0},{186,255,0},{180,255,0},{170,255,0},{160,255,0}}},  {{/*1*/{204,203,1},{202,251,0},{198,249,0},{194,249,0},{188,253,0},{182,253,0},{172,255,0},{162,255,0}}},  {{/*1*/{206,205,0},{204,237,0},{198,255,0},{194,255,0},{190,251,0},{184,253,0},{174,253,0},{164,255,0}}},  {{/*1*/{206,205,1},{204,253,0},{200,251,0},{196,251,0},{190,255,0},{184,255,0},{176,253,0},{166,255,0}}},
-  {{/*1*/{208,207,0},{206,239,0},{202,245,0},{198,249,0},{192,253,0},{186,255,0},{176,255,0},{168,255,0}}},  {{/*1*/{208,207,1},{206,255,0},{202,253,0},{198,253,0},{194,251,0},{188,253,0},{178,255,0},{170,255,0}}},  {{/*1*/{210,209,0},{208,241,0},{204,247,0},{200,251,0},{194,255,0},{190,251,0},{180,255,0},{172,255,0}}},  {{/*1*/{210,209,1},{210,227,0},{204,255,0},{200,255,0},{196,253,0},{190,255,0},{182,255,0},{174,253,0}}},
-  {{/*1*/{212,211,0},{210,243,0},{206,249,0},{202,253,0},{198,251,0},{192,253,0},{184,253,0},{176,253,0}}},  {{/*1*/{212,211,1},{212,229,0},{208,245,0},{204,249,0},{198,255,0},{194,253,0},{186,253,0},{176,255,0}}},  {{/*1*/{214,213,0},{212,245,0},{208,251,0},{204,255,0},{200,253,0},{194,255,0},{186,255,0},{178,255,0}}},  {{/*1*/{214,213,1},{214,231,0},{210,247,0},{206,251,0},{202,251,0},{196,255,0},{188,255,0},{180,255,0}}},
-  {{/*1*/{216,215,0},{214,247,0},{210,253,0},{208,249,0},{202,255,0},{198,253,0},{190,255,0},{182,255,0}}},  {{/*1*/{216,215,1},{216,233,0},{212,249,0},{208,253,0},{204,253,0},{200,253,0},{192,255,0},{184,255,0}}},  {{/*1*/{218,217,0},{216,249,0},{212,255,0},{210,251,0},{206,253,0},{200,255,0},{194,255,0},{186,255,0}}},  {{/*1*/{218,217,1},{218,235,0},{214,251,0},{210,255,0},{206,255,0},{202,255,0},{196,253,0},{188,255,0}}},
-  {{/*1*/{220,219,0},{218,251,0},{216,245,0},{212,253,0},{208,255,0},{204,253,0},{198,253,0},{190,255,0}}},  {{/*1*/{220,219,1},{220,237,0},{216,253,0},{214,249,0},{210,253,0},{206,253,0},{198,255,0},{192,255,0}}},  {{/*1*/{222,221,0},{220,253,0},{218,247,0},{214,255,0},{212,251,0},{206,255,0},{200,255,0},{194,255,0}}},  {{/*1*/{222,221,1},{222,239,0},{218,255,0},{216,251,0},{212,255,0},{208,255,0},{202,255,0},{196,255,0}}},
-  {{/*1*/{224,223,0},{222,255,0},{220,249,0},{218,249,0},{214,253,0},{210,253,0},{204,255,0},{198,255,0}}},  {{/*1*/{224,223,1},{224,241,0},{222,245,0},{218,253,0},{216,251,0},{212,253,0},{206,253,0},{200,255,0}}},  {{/*1*/{226,225,0},{226,227,0},{222,251,0},{220,251,0},{216,255,0},{212,255,0},{208,253,0},{202,255,0}}},  {{/*1*/{226,225,1},{226,243,0},{224,247,0},{220,255,0},{218,253,0},{214,255,0},{208,255,0},{204,255,0}}},
-  {{/*1*/{228,227,0},{228,229,0},{224,253,0},{222,253,0},{220,251,0},{216,253,0},{210,255,0},{206,253,0}}},  {{/*1*/{228,227,1},{228,245,0},{226,249,0},{224,249,0},{220,255,0},{218,253,0},{212,255,0},{208,253,0}}},  {{/*1*/{230,229,0},{230,231,0},{226,255,0},{224,255,0},{222,253,0},{218,255,0},{214,255,0},{208,255,0}}},  {{/*1*/{230,229,1},{230,247,0},{228,251,0},{226,251,0},{224,251,0},{220,255,0},{216,253,0},{210,255,0}}},
-  {{/*1*/{232,231,0},{232,233,0},{230,245,0},{228,249,0},{224,255,0},{222,253,0},{218,253,0},{212,255,0}}},  {{/*1*/{232,231,1},{232,249,0},{230,253,0},{228,253,0},{226,253,0},{224,253,0},{218,255,0},{214,255,0}}},  {{/*1*/{234,233,0},{234,235,0},{232,247,0},{230,251,0},{228,251,0},{224,255,0},{220,255,0},{216,255,0}}},  {{/*1*/{234,233,1},{234,251,0},{232,255,0},{230,255,0},{228,255,0},{226,255,0},{222,255,0},{218,255,0}}},
-  {{/*1*/{236,235,0},{236,237,0},{234,249,0},{232,253,0},{230,253,0},{228,253,0},{224,255,0},{220,255,0}}},  {{/*1*/{236,235,1},{236,253,0},{236,245,0},{234,249,0},{232,251,0},{230,253,0},{226,255,0},{222,255,0}}},  {{/*1*/{238,237,0},{238,239,0},{236,251,0},{234,255,0},{232,255,0},{230,255,0},{228,253,0},{224,255,0}}},  {{/*1*/{238,237,1},{238,255,0},{238,247,0},{236,251,0},{234,253,0},{232,255,0},{230,253,0},{226,255,0}}},
-  {{/*1*/{240,239,0},{240,241,0},{238,253,0},{238,249,0},{236,253,0},{234,253,0},{230,255,0},{228,255,0}}},  {{/*1*/{240,239,1},{242,241,0},{240,249,0},{238,253,0},{236,255,0},{236,253,0},{232,255,0},{230,255,0}}},  {{/*1*/{242,241,0},{242,243,0},{240,255,0},{240,251,0},{238,255,0},{236,255,0},{234,255,0},{232,255,0}}},  {{/*1*/{242,241,1},{244,243,0},{242,251,0},{240,255,0},{240,253,0},{238,255,0},{236,255,0},{234,255,0}}},
-  {{/*1*/{244,243,0},{244,245,0},{244,245,0},{242,253,0},{242,251,0},{240,253,0},{238,253,0},{236,255,0}}},  {{/*1*/{244,243,1},{246,245,0},{244,253,0},{244,249,0},{242,255,0},{242,253,0},{240,253,0},{238,253,0}}},  {{/*1*/{246,245,0},{246,247,0},{246,247,0},{244,255,0},{244,253,0},{242,255,0},{240,255,0},{240,253,0}}},  {{/*1*/{246,245,1},{248,247,0},{246,255,0},{246,251,0},{246,251,0},{244,255,0},{242,255,0},{240,255,0}}},
-  {{/*1*/{248,247,0},{248,249,0},{248,249,0},{248,249,0},{246,255,0},{246,253,0},{244,255,0},{242,255,0}}},  {{/*1*/{248,247,1},{250,249,0},{250,249,0},{248,253,0},{248,253,0},{248,253,0},{246,255,0},{244,255,0}}},  {{/*1*/{250,249,0},{250,251,0},{250,251,0},{250,251,0},{250,251,0},{248,255,0},{248,253,0},{246,255,0}}},  {{/*1*/{250,249,1},{252,251,0},{252,251,0},{250,255,0},{250,255,0},{250,255,0},{250,253,0},{248,255,0}}},
-  {{/*1*/{252,251,0},{252,253,0},{252,253,0},{252,253,0},{252,253,0},{252,253,0},{250,255,0},{250,255,0}}},  {{/*1*/{252,251,1},{254,253,0},{254,253,0},{254,253,0},{254,253,0},{254,253,0},{252,255,0},{252,255,0}}},  {{/*1*/{254,253,0},{254,255,0},{254,255,0},{254,255,0},{254,255,0},{254,255,0},{254,255,0},{254,255,0}}},  {{/*1*/{254,253,1},{254,255,1},{254,255,1},{254,255,1},{254,255,1},{254,255,1},{254,255,1},{254,255,1}}}
+  {/*1*/{  0,  0,  0,  0,  0,  0,  0,  0},{  1,  1,  1,  1,  1,  1,  1,  1},{0,0,0,0,0,0,0,0}},  {/*1*/{  0,  0,  0,  0,  0,  0,  0,  0},{  1, 17,  9,  5,  5,  5,  3,  3},{1,0,0,0,0,0,0,0}},  {/*1*/{  2,  0,  0,  0,  0,  0,  0,  0},{  1, 33, 15, 11,  9,  7,  5,  5},{0,0,0,0,0,0,0,0}},  {/*1*/{  2,  0,  0,  0,  0,  0,  0,  0},{  1, 49, 23, 15, 13, 11,  9,  7},{1,0,0,0,0,0,0,0}},
+  {/*1*/{  4,  0,  0,  0,  0,  0,  0,  0},{  3, 65, 29, 21, 17, 13, 11,  9},{0,0,0,0,0,0,0,0}},  {/*1*/{  4,  0,  0,  0,  0,  0,  0,  0},{  3, 81, 37, 25, 19, 17, 13, 11},{1,0,0,0,0,0,0,0}},  {/*1*/{  6,  0,  0,  0,  0,  0,  0,  0},{  5, 97, 43, 31, 23, 19, 15, 13},{0,0,0,0,0,0,0,0}},  {/*1*/{  6,  0,  0,  0,  0,  0,  0,  0},{  5,113, 51, 35, 27, 23, 19, 15},{1,0,0,0,0,0,0,0}},
+  {/*1*/{  8,  0,  0,  0,  0,  0,  0,  0},{  7,129, 57, 41, 31, 25, 21, 19},{0,0,0,0,0,0,0,0}},  {/*1*/{  8,  0,  0,  0,  0,  0,  0,  0},{  7,145, 65, 45, 35, 29, 23, 21},{1,0,0,0,0,0,0,0}},  {/*1*/{ 10,  0,  0,  0,  0,  0,  0,  0},{  9,161, 73, 51, 39, 31, 25, 23},{0,0,0,0,0,0,0,0}},  {/*1*/{ 10,  0,  0,  0,  0,  0,  0,  0},{  9,177, 79, 55, 43, 35, 29, 25},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 12,  0,  0,  0,  0,  0,  0,  0},{ 11,193, 87, 61, 47, 37, 31, 27},{0,0,0,0,0,0,0,0}},  {/*1*/{ 12,  0,  0,  0,  0,  0,  0,  0},{ 11,209, 93, 65, 49, 41, 33, 29},{1,0,0,0,0,0,0,0}},  {/*1*/{ 14,  0,  0,  0,  0,  0,  0,  0},{ 13,225,101, 69, 53, 43, 35, 31},{0,0,0,0,0,0,0,0}},  {/*1*/{ 14,  0,  0,  0,  0,  0,  0,  0},{ 13,241,107, 75, 57, 47, 37, 33},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 16,  2,  0,  0,  0,  0,  0,  0},{ 15,227,115, 79, 61, 49, 41, 35},{0,0,0,0,0,0,0,0}},  {/*1*/{ 16,  2,  0,  0,  0,  0,  0,  0},{ 15,243,121, 85, 65, 53, 43, 37},{1,0,0,0,0,0,0,0}},  {/*1*/{ 18,  4,  0,  0,  0,  0,  0,  0},{ 17,229,129, 89, 69, 55, 45, 39},{0,0,0,0,0,0,0,0}},  {/*1*/{ 18,  4,  0,  0,  0,  0,  0,  0},{ 17,245,137, 95, 73, 59, 47, 41},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 20,  6,  0,  0,  0,  0,  0,  0},{ 19,231,143, 99, 77, 61, 51, 43},{0,0,0,0,0,0,0,0}},  {/*1*/{ 20,  6,  0,  0,  0,  0,  0,  0},{ 19,247,151,105, 81, 65, 53, 45},{1,0,0,0,0,0,0,0}},  {/*1*/{ 22,  8,  0,  0,  0,  0,  0,  0},{ 21,233,157,109, 83, 69, 55, 47},{0,0,0,0,0,0,0,0}},  {/*1*/{ 22,  8,  0,  0,  0,  0,  0,  0},{ 21,249,165,115, 87, 71, 57, 51},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 24, 10,  0,  0,  0,  0,  0,  0},{ 23,235,171,119, 91, 75, 61, 53},{0,0,0,0,0,0,0,0}},  {/*1*/{ 24, 10,  0,  0,  0,  0,  0,  0},{ 23,251,179,125, 95, 77, 63, 55},{1,0,0,0,0,0,0,0}},  {/*1*/{ 26, 12,  0,  0,  0,  0,  0,  0},{ 25,237,185,129, 99, 81, 65, 57},{0,0,0,0,0,0,0,0}},  {/*1*/{ 26, 12,  0,  0,  0,  0,  0,  0},{ 25,253,193,133,103, 83, 67, 59},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 28, 14,  0,  0,  0,  0,  0,  0},{ 27,239,201,139,107, 87, 69, 61},{0,0,0,0,0,0,0,0}},  {/*1*/{ 28, 14,  0,  0,  0,  0,  0,  0},{ 27,255,207,143,111, 89, 73, 63},{1,0,0,0,0,0,0,0}},  {/*1*/{ 30, 16,  0,  0,  0,  0,  0,  0},{ 29,241,215,149,113, 93, 75, 65},{0,0,0,0,0,0,0,0}},  {/*1*/{ 30, 18,  0,  0,  0,  0,  0,  0},{ 29,227,221,153,117, 95, 77, 67},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 32, 18,  0,  0,  0,  0,  0,  0},{ 31,243,229,159,121, 99, 79, 69},{0,0,0,0,0,0,0,0}},  {/*1*/{ 32, 20,  0,  0,  0,  0,  0,  0},{ 31,229,235,163,125,101, 83, 71},{1,0,0,0,0,0,0,0}},  {/*1*/{ 34, 20,  0,  0,  0,  0,  0,  0},{ 33,245,243,169,129,105, 85, 73},{0,0,0,0,0,0,0,0}},  {/*1*/{ 34, 22,  0,  0,  0,  0,  0,  0},{ 33,231,249,173,133,107, 87, 75},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 36, 22,  2,  0,  0,  0,  0,  0},{ 35,247,245,179,137,111, 89, 77},{0,0,0,0,0,0,0,0}},  {/*1*/{ 36, 24,  2,  0,  0,  0,  0,  0},{ 35,233,251,183,141,113, 93, 79},{1,0,0,0,0,0,0,0}},  {/*1*/{ 38, 24,  4,  0,  0,  0,  0,  0},{ 37,249,247,189,145,117, 95, 83},{0,0,0,0,0,0,0,0}},  {/*1*/{ 38, 26,  4,  0,  0,  0,  0,  0},{ 37,235,253,193,147,119, 97, 85},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 40, 26,  6,  0,  0,  0,  0,  0},{ 39,251,249,197,151,123, 99, 87},{0,0,0,0,0,0,0,0}},  {/*1*/{ 40, 28,  6,  0,  0,  0,  0,  0},{ 39,237,255,203,155,125,101, 89},{1,0,0,0,0,0,0,0}},  {/*1*/{ 42, 28,  8,  0,  0,  0,  0,  0},{ 41,253,251,207,159,129,105, 91},{0,0,0,0,0,0,0,0}},  {/*1*/{ 42, 30, 10,  0,  0,  0,  0,  0},{ 41,239,245,213,163,133,107, 93},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 44, 30, 10,  0,  0,  0,  0,  0},{ 43,255,253,217,167,135,109, 95},{0,0,0,0,0,0,0,0}},  {/*1*/{ 44, 32, 12,  0,  0,  0,  0,  0},{ 43,241,247,223,171,139,111, 97},{1,0,0,0,0,0,0,0}},  {/*1*/{ 46, 34, 12,  0,  0,  0,  0,  0},{ 45,227,255,227,175,141,115, 99},{0,0,0,0,0,0,0,0}},  {/*1*/{ 46, 34, 14,  0,  0,  0,  0,  0},{ 45,243,249,233,177,145,117,101},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 48, 36, 16,  0,  0,  0,  0,  0},{ 47,229,245,237,181,147,119,103},{0,0,0,0,0,0,0,0}},  {/*1*/{ 48, 36, 16,  0,  0,  0,  0,  0},{ 47,245,251,243,185,151,121,105},{1,0,0,0,0,0,0,0}},  {/*1*/{ 50, 38, 18,  0,  0,  0,  0,  0},{ 49,231,247,247,189,153,125,107},{0,0,0,0,0,0,0,0}},  {/*1*/{ 50, 38, 18,  0,  0,  0,  0,  0},{ 49,247,253,253,193,157,127,109},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 52, 40, 20,  2,  0,  0,  0,  0},{ 51,233,249,249,197,159,129,111},{0,0,0,0,0,0,0,0}},  {/*1*/{ 52, 40, 20,  2,  0,  0,  0,  0},{ 51,249,255,255,201,163,131,115},{1,0,0,0,0,0,0,0}},  {/*1*/{ 54, 42, 22,  4,  0,  0,  0,  0},{ 53,235,251,251,205,165,133,117},{0,0,0,0,0,0,0,0}},  {/*1*/{ 54, 42, 24,  6,  0,  0,  0,  0},{ 53,251,245,249,209,169,137,119},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 56, 44, 24,  6,  0,  0,  0,  0},{ 55,237,253,253,211,171,139,121},{0,0,0,0,0,0,0,0}},  {/*1*/{ 56, 44, 26,  8,  0,  0,  0,  0},{ 55,253,247,251,215,175,141,123},{1,0,0,0,0,0,0,0}},  {/*1*/{ 58, 46, 26,  8,  0,  0,  0,  0},{ 57,239,255,255,219,177,143,125},{0,0,0,0,0,0,0,0}},  {/*1*/{ 58, 46, 28, 10,  0,  0,  0,  0},{ 57,255,249,253,223,181,147,127},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 60, 48, 30, 12,  0,  0,  0,  0},{ 59,241,245,249,227,183,149,129},{0,0,0,0,0,0,0,0}},  {/*1*/{ 60, 50, 30, 12,  0,  0,  0,  0},{ 59,227,251,255,231,187,151,131},{1,0,0,0,0,0,0,0}},  {/*1*/{ 62, 50, 32, 14,  0,  0,  0,  0},{ 61,243,247,251,235,189,153,133},{0,0,0,0,0,0,0,0}},  {/*1*/{ 62, 52, 32, 16,  0,  0,  0,  0},{ 61,229,253,249,239,193,157,135},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 64, 52, 34, 16,  0,  0,  0,  0},{ 63,245,249,253,241,197,159,137},{0,0,0,0,0,0,0,0}},  {/*1*/{ 64, 54, 34, 18,  0,  0,  0,  0},{ 63,231,255,251,245,199,161,139},{1,0,0,0,0,0,0,0}},  {/*1*/{ 66, 54, 36, 18,  0,  0,  0,  0},{ 65,247,251,255,249,203,163,141},{0,0,0,0,0,0,0,0}},  {/*1*/{ 66, 56, 38, 20,  0,  0,  0,  0},{ 65,233,245,253,253,205,165,143},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 68, 56, 38, 22,  2,  0,  0,  0},{ 67,249,253,249,251,209,169,147},{0,0,0,0,0,0,0,0}},  {/*1*/{ 68, 58, 40, 22,  2,  0,  0,  0},{ 67,235,247,255,255,211,171,149},{1,0,0,0,0,0,0,0}},  {/*1*/{ 70, 58, 40, 24,  4,  0,  0,  0},{ 69,251,255,251,253,215,173,151},{0,0,0,0,0,0,0,0}},  {/*1*/{ 70, 60, 42, 26,  6,  0,  0,  0},{ 69,237,249,249,251,217,175,153},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 72, 60, 44, 26,  6,  0,  0,  0},{ 71,253,245,253,255,221,179,155},{0,0,0,0,0,0,0,0}},  {/*1*/{ 72, 62, 44, 28,  8,  0,  0,  0},{ 71,239,251,251,253,223,181,157},{1,0,0,0,0,0,0,0}},  {/*1*/{ 74, 62, 46, 28, 10,  0,  0,  0},{ 73,255,247,255,251,227,183,159},{0,0,0,0,0,0,0,0}},  {/*1*/{ 74, 64, 46, 30, 10,  0,  0,  0},{ 73,241,253,253,255,229,185,161},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 76, 66, 48, 32, 12,  0,  0,  0},{ 75,227,249,249,253,233,189,163},{0,0,0,0,0,0,0,0}},  {/*1*/{ 76, 66, 48, 32, 14,  0,  0,  0},{ 75,243,255,255,253,235,191,165},{1,0,0,0,0,0,0,0}},  {/*1*/{ 78, 68, 50, 34, 14,  0,  0,  0},{ 77,229,251,251,255,239,193,167},{0,0,0,0,0,0,0,0}},  {/*1*/{ 78, 68, 52, 36, 16,  0,  0,  0},{ 77,245,245,249,255,241,195,169},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 80, 70, 52, 36, 18,  0,  0,  0},{ 79,231,253,253,253,245,197,171},{0,0,0,0,0,0,0,0}},  {/*1*/{ 80, 70, 54, 38, 20,  0,  0,  0},{ 79,247,247,251,251,247,201,173},{1,0,0,0,0,0,0,0}},  {/*1*/{ 82, 72, 54, 38, 20,  0,  0,  0},{ 81,233,255,255,255,251,203,175},{0,0,0,0,0,0,0,0}},  {/*1*/{ 82, 72, 56, 40, 22,  0,  0,  0},{ 81,249,249,253,253,253,205,179},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 84, 74, 58, 42, 24,  2,  0,  0},{ 83,235,243,249,251,253,207,181},{0,0,0,0,0,0,0,0}},  {/*1*/{ 84, 74, 58, 42, 24,  2,  0,  0},{ 83,251,251,255,255,255,211,183},{1,0,0,0,0,0,0,0}},  {/*1*/{ 86, 76, 60, 44, 26,  4,  0,  0},{ 85,237,245,251,253,255,213,185},{0,0,0,0,0,0,0,0}},  {/*1*/{ 86, 76, 60, 46, 28,  6,  0,  0},{ 85,253,253,249,251,253,215,187},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 88, 78, 62, 46, 28,  8,  0,  0},{ 87,239,247,253,255,253,217,189},{0,0,0,0,0,0,0,0}},  {/*1*/{ 88, 78, 62, 48, 30,  8,  0,  0},{ 87,255,255,251,253,255,221,191},{1,0,0,0,0,0,0,0}},  {/*1*/{ 90, 80, 64, 48, 32, 10,  0,  0},{ 89,241,249,255,251,255,223,193},{0,0,0,0,0,0,0,0}},  {/*1*/{ 90, 82, 66, 50, 32, 12,  0,  0},{ 89,227,245,253,255,253,225,195},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 92, 82, 66, 52, 34, 14,  0,  0},{ 91,243,251,249,253,253,227,197},{0,0,0,0,0,0,0,0}},  {/*1*/{ 92, 84, 68, 52, 36, 14,  0,  0},{ 91,229,247,255,251,255,229,199},{1,0,0,0,0,0,0,0}},  {/*1*/{ 94, 84, 68, 54, 36, 16,  0,  0},{ 93,245,253,251,255,255,233,201},{0,0,0,0,0,0,0,0}},  {/*1*/{ 94, 86, 70, 56, 38, 18,  0,  0},{ 93,231,249,249,253,253,235,203},{1,0,0,0,0,0,0,0}},
+  {/*1*/{ 96, 86, 70, 56, 40, 20,  0,  0},{ 95,247,255,253,251,253,237,205},{0,0,0,0,0,0,0,0}},  {/*1*/{ 96, 88, 72, 58, 40, 20,  0,  0},{ 95,233,251,251,255,255,239,207},{1,0,0,0,0,0,0,0}},  {/*1*/{ 98, 88, 74, 58, 42, 22,  0,  0},{ 97,249,245,255,253,255,243,211},{0,0,0,0,0,0,0,0}},  {/*1*/{ 98, 90, 74, 60, 44, 24,  0,  0},{ 97,235,253,253,253,253,245,213},{1,0,0,0,0,0,0,0}},
+  {/*1*/{100, 90, 76, 62, 44, 26,  0,  0},{ 99,251,247,251,255,253,247,215},{0,0,0,0,0,0,0,0}},  {/*1*/{100, 92, 76, 62, 46, 26,  0,  0},{ 99,237,255,255,255,255,249,217},{1,0,0,0,0,0,0,0}},  {/*1*/{102, 92, 78, 64, 48, 28,  0,  0},{101,253,249,253,253,255,253,219},{0,0,0,0,0,0,0,0}},  {/*1*/{102, 94, 80, 66, 50, 30,  0,  0},{101,239,245,249,251,253,255,221},{1,0,0,0,0,0,0,0}},
+  {/*1*/{104, 94, 80, 66, 50, 32,  2,  0},{103,255,251,255,255,253,255,223},{0,0,0,0,0,0,0,0}},  {/*1*/{104, 96, 82, 68, 52, 32,  4,  0},{103,241,247,251,253,255,253,225},{1,0,0,0,0,0,0,0}},  {/*1*/{106, 98, 82, 70, 54, 34,  6,  0},{105,227,253,249,251,255,253,227},{0,0,0,0,0,0,0,0}},  {/*1*/{106, 98, 84, 70, 54, 36,  6,  0},{105,243,249,253,255,253,255,229},{1,0,0,0,0,0,0,0}},
+  {/*1*/{108,100, 84, 72, 56, 38,  8,  0},{107,229,255,251,253,253,255,231},{0,0,0,0,0,0,0,0}},  {/*1*/{108,100, 86, 72, 58, 38, 10,  0},{107,245,251,255,251,255,255,233},{1,0,0,0,0,0,0,0}},  {/*1*/{110,102, 88, 74, 58, 40, 12,  0},{109,231,245,253,255,255,255,235},{0,0,0,0,0,0,0,0}},  {/*1*/{110,102, 88, 76, 60, 42, 14,  0},{109,247,253,249,253,253,253,237},{1,0,0,0,0,0,0,0}},
+  {/*1*/{112,104, 90, 76, 62, 44, 16,  0},{111,233,247,255,251,253,253,239},{0,0,0,0,0,0,0,0}},  {/*1*/{112,104, 90, 78, 62, 44, 16,  0},{111,249,255,251,255,255,255,243},{1,0,0,0,0,0,0,0}},  {/*1*/{114,106, 92, 80, 64, 46, 18,  0},{113,235,249,249,253,255,255,245},{0,0,0,0,0,0,0,0}},  {/*1*/{114,106, 94, 80, 66, 48, 20,  0},{113,251,245,253,251,253,255,247},{1,0,0,0,0,0,0,0}},
+  {/*1*/{116,108, 94, 82, 66, 50, 22,  0},{115,237,251,251,255,253,255,249},{0,0,0,0,0,0,0,0}},  {/*1*/{116,108, 96, 82, 68, 50, 24,  0},{115,253,247,255,253,255,253,251},{1,0,0,0,0,0,0,0}},  {/*1*/{118,110, 96, 84, 70, 52, 26,  0},{117,239,253,253,251,255,253,253},{0,0,0,0,0,0,0,0}},  {/*1*/{118,110, 98, 86, 70, 54, 26,  0},{117,255,249,249,255,253,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{120,112, 98, 86, 72, 56, 28,  2},{119,241,255,255,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{120,114,100, 88, 74, 56, 30,  4},{119,227,251,251,251,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{122,114,102, 90, 74, 58, 32,  6},{121,243,245,249,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{122,116,102, 90, 76, 60, 34,  8},{121,229,253,253,253,253,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{124,116,104, 92, 78, 62, 36, 10},{123,245,247,251,253,251,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{124,118,104, 92, 78, 62, 38, 12},{123,231,255,255,255,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{126,118,106, 94, 80, 64, 38, 14},{125,247,249,253,255,253,255,253},{0,0,0,0,0,0,0,0}},  {/*1*/{126,120,108, 96, 82, 66, 40, 16},{125,233,245,249,253,253,255,253},{1,0,0,0,0,0,0,0}},
+  {/*1*/{128,120,108, 96, 84, 66, 42, 16},{127,249,251,255,251,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{128,122,110, 98, 84, 68, 44, 18},{127,235,247,251,255,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{130,122,110,100, 86, 70, 46, 20},{129,251,253,249,253,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{130,124,112,100, 88, 72, 48, 22},{129,237,249,253,251,253,253,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{132,124,112,102, 88, 72, 48, 24},{131,253,255,251,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{132,126,114,102, 90, 74, 50, 26},{131,239,251,255,253,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{134,126,116,104, 92, 76, 52, 28},{133,255,245,253,251,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{134,128,116,106, 92, 78, 54, 30},{133,241,253,249,255,253,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{136,130,118,106, 94, 78, 56, 32},{135,227,247,255,253,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{136,130,118,108, 96, 80, 58, 34},{135,243,255,251,251,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{138,132,120,110, 96, 82, 58, 36},{137,229,249,249,255,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{138,132,122,110, 98, 84, 60, 38},{137,245,243,253,253,253,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{140,134,122,112,100, 84, 62, 40},{139,231,251,251,251,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{140,134,124,112,100, 86, 64, 42},{139,247,245,255,255,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{142,136,124,114,102, 88, 66, 44},{141,233,253,253,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{142,136,126,116,104, 90, 68, 46},{141,249,247,249,251,253,253,253},{1,0,0,0,0,0,0,0}},
+  {/*1*/{144,138,126,116,104, 90, 70, 48},{143,235,255,255,255,255,253,253},{0,0,0,0,0,0,0,0}},  {/*1*/{144,138,128,118,106, 92, 70, 48},{143,251,249,251,253,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{146,140,130,120,108, 94, 72, 50},{145,237,245,249,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{146,140,130,120,108, 96, 74, 52},{145,253,251,253,255,253,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{148,142,132,122,110, 96, 76, 54},{147,239,247,251,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{148,142,132,122,112, 98, 78, 56},{147,255,253,255,253,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{150,144,134,124,114,100, 80, 58},{149,241,249,253,251,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{150,146,134,126,114,102, 80, 60},{149,227,255,251,255,253,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{152,146,136,126,116,102, 82, 62},{151,243,251,255,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{152,148,138,128,118,104, 84, 64},{151,229,245,253,251,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{154,148,138,130,118,106, 86, 66},{153,245,253,249,255,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{154,150,140,130,120,108, 88, 68},{153,231,247,255,253,253,253,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{156,150,140,132,122,108, 90, 70},{155,247,255,251,251,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{156,152,142,134,122,110, 90, 72},{155,233,249,249,255,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{158,152,144,134,124,112, 92, 74},{157,249,245,253,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{158,154,144,136,126,114, 94, 76},{157,235,251,251,251,253,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{160,154,146,136,126,114, 96, 78},{159,251,247,255,255,255,255,253},{0,0,0,0,0,0,0,0}},  {/*1*/{160,156,146,138,128,116, 98, 80},{159,237,253,253,253,255,255,253},{1,0,0,0,0,0,0,0}},  {/*1*/{162,156,148,140,130,118,100, 80},{161,253,249,249,251,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{162,158,148,140,130,120,102, 82},{161,239,255,255,255,253,253,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{164,158,150,142,132,120,102, 84},{163,255,251,251,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{164,160,152,144,134,122,104, 86},{163,241,245,249,251,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{166,162,152,144,134,124,106, 88},{165,227,253,253,255,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{166,162,154,146,136,126,108, 90},{165,243,247,251,253,251,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{168,164,154,146,138,126,110, 92},{167,229,255,255,251,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{168,164,156,148,138,128,112, 94},{167,245,249,253,255,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{170,166,158,150,140,130,112, 96},{169,231,245,249,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{170,166,158,150,142,130,114, 98},{169,247,251,255,253,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{172,168,160,152,142,132,116,100},{171,233,247,251,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{172,168,160,154,144,134,118,102},{171,249,253,249,255,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{174,170,162,154,146,136,120,104},{173,235,249,253,253,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{174,170,162,156,148,136,122,106},{173,251,255,251,251,255,253,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{176,172,164,156,148,138,122,108},{175,237,251,255,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{176,172,166,158,150,140,124,110},{175,253,245,253,253,253,255,253},{1,0,0,0,0,0,0,0}},  {/*1*/{178,174,166,160,152,142,126,112},{177,239,253,249,251,253,255,253},{0,0,0,0,0,0,0,0}},  {/*1*/{178,174,168,160,152,142,128,112},{177,255,247,255,255,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{180,176,168,162,154,144,130,114},{179,241,255,251,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{180,178,170,164,156,146,132,116},{179,227,249,249,251,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{182,178,172,164,156,148,134,118},{181,243,245,253,255,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{182,180,172,166,158,148,134,120},{181,229,251,251,253,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{184,180,174,166,160,150,136,122},{183,245,247,255,251,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{184,182,174,168,160,152,138,124},{183,231,253,253,255,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{186,182,176,170,162,154,140,126},{185,247,249,249,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{186,184,176,170,164,154,142,128},{185,233,255,255,251,255,253,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{188,184,178,172,164,156,144,130},{187,249,251,251,255,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{188,186,180,174,166,158,144,132},{187,235,245,249,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{190,186,180,174,168,160,146,134},{189,251,253,253,251,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{190,188,182,176,168,160,148,136},{189,237,247,251,255,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{192,188,182,176,170,162,150,138},{191,253,255,255,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{192,190,184,178,172,164,152,140},{191,239,249,253,253,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{194,190,186,180,172,166,154,142},{193,255,243,249,255,253,253,253},{0,0,0,0,0,0,0,0}},  {/*1*/{194,192,186,180,174,166,154,144},{193,241,251,255,255,255,255,253},{1,0,0,0,0,0,0,0}},
+  {/*1*/{196,194,188,182,176,168,156,144},{195,227,245,251,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{196,194,188,184,178,170,158,146},{195,243,253,249,251,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{198,196,190,184,178,172,160,148},{197,229,247,253,255,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{198,196,190,186,180,172,162,150},{197,245,255,251,253,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{200,198,192,186,182,174,164,152},{199,231,249,255,251,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{200,198,194,188,182,176,166,154},{199,247,245,253,255,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{202,200,194,190,184,178,166,156},{201,233,251,251,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{202,200,196,190,186,178,168,158},{201,249,247,255,251,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{204,202,196,192,186,180,170,160},{203,235,253,253,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{204,202,198,194,188,182,172,162},{203,251,249,249,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{206,204,198,194,190,184,174,164},{205,237,255,255,251,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{206,204,200,196,190,184,176,166},{205,253,251,251,255,255,253,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{208,206,202,198,192,186,176,168},{207,239,245,249,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{208,206,202,198,194,188,178,170},{207,255,253,253,251,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{210,208,204,200,194,190,180,172},{209,241,247,251,255,251,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{210,210,204,200,196,190,182,174},{209,227,255,255,253,255,255,253},{1,0,0,0,0,0,0,0}},
+  {/*1*/{212,210,206,202,198,192,184,176},{211,243,249,253,251,253,253,253},{0,0,0,0,0,0,0,0}},  {/*1*/{212,212,208,204,198,194,186,176},{211,229,245,249,255,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{214,212,208,204,200,194,186,178},{213,245,251,255,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{214,214,210,206,202,196,188,180},{213,231,247,251,251,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{216,214,210,208,202,198,190,182},{215,247,253,249,255,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{216,216,212,208,204,200,192,184},{215,233,249,253,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{218,216,212,210,206,200,194,186},{217,249,255,251,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{218,218,214,210,206,202,196,188},{217,235,251,255,255,255,253,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{220,218,216,212,208,204,198,190},{219,251,245,253,255,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{220,220,216,214,210,206,198,192},{219,237,253,249,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{222,220,218,214,212,206,200,194},{221,253,247,255,251,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{222,222,218,216,212,208,202,196},{221,239,255,251,255,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{224,222,220,218,214,210,204,198},{223,255,249,249,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{224,224,222,218,216,212,206,200},{223,241,245,253,251,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{226,226,222,220,216,212,208,202},{225,227,251,251,255,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{226,226,224,220,218,214,208,204},{225,243,247,255,253,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{228,228,224,222,220,216,210,206},{227,229,253,253,251,253,255,253},{0,0,0,0,0,0,0,0}},  {/*1*/{228,228,226,224,220,218,212,208},{227,245,249,249,255,253,255,253},{1,0,0,0,0,0,0,0}},  {/*1*/{230,230,226,224,222,218,214,208},{229,231,255,255,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{230,230,228,226,224,220,216,210},{229,247,251,251,251,255,253,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{232,232,230,228,224,222,218,212},{231,233,245,249,255,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{232,232,230,228,226,224,218,214},{231,249,253,253,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{234,234,232,230,228,224,220,216},{233,235,247,251,251,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{234,234,232,230,228,226,222,218},{233,251,255,255,255,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{236,236,234,232,230,228,224,220},{235,237,249,253,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{236,236,236,234,232,230,226,222},{235,253,245,249,251,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{238,238,236,234,232,230,228,224},{237,239,251,255,255,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{238,238,238,236,234,232,230,226},{237,255,247,251,253,255,253,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{240,240,238,238,236,234,230,228},{239,241,253,249,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{240,242,240,238,236,236,232,230},{239,241,249,253,255,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{242,242,240,240,238,236,234,232},{241,243,255,251,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{242,244,242,240,240,238,236,234},{241,243,251,255,253,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{244,244,244,242,242,240,238,236},{243,245,245,253,251,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{244,246,244,244,242,242,240,238},{243,245,253,249,255,253,253,253},{1,0,0,0,0,0,0,0}},  {/*1*/{246,246,246,244,244,242,240,240},{245,247,247,255,253,255,255,253},{0,0,0,0,0,0,0,0}},  {/*1*/{246,248,246,246,246,244,242,240},{245,247,255,251,251,255,255,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{248,248,248,248,246,246,244,242},{247,249,249,249,255,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{248,250,250,248,248,248,246,244},{247,249,249,253,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{250,250,250,250,250,248,248,246},{249,251,251,251,251,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{250,252,252,250,250,250,250,248},{249,251,251,255,255,255,253,255},{1,0,0,0,0,0,0,0}},
+  {/*1*/{252,252,252,252,252,252,250,250},{251,253,253,253,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{252,254,254,254,254,254,252,252},{251,253,253,253,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{254,254,254,254,254,254,254,254},{253,255,255,255,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{254,254,254,254,254,254,254,254},{253,255,255,255,255,255,255,255},{1,1,1,1,1,1,1,1}}
 },{
-  {{/*1*/{  1,  1,1},{  1,  1,1},{  1,  1,1},{  1,  1,1},{  1,  1,1},{  1,  1,1},{  1,  1,1},{  1,  1,1}}},  {{/*1*/{  1,  1,0},{  1,  1,0},{  1,  1,0},{  1,  1,0},{  1,  1,0},{  1,  1,0},{  1,  1,0},{  1,  1,0}}},  {{/*1*/{  1,  1,1},{  1, 17,0},{  1,  9,0},{  1,  7,0},{  1,  5,0},{  1,  5,0},{  1,  5,0},{  1,  5,0}}},  {{/*1*/{  3,  3,0},{  1, 33,0},{  1, 17,0},{  1, 11,0},{  1,  9,0},{  1,  9,0},{  1,  7,0},{  1,  7,0}}},
-  {{/*1*/{  3,  3,1},{  1, 49,0},{  1, 23,0},{  1, 17,0},{  1, 13,0},{  1, 11,0},{  1,  9,0},{  1,  9,0}}},  {{/*1*/{  5,  5,0},{  1, 65,0},{  1, 31,0},{  1, 21,0},{  1, 17,0},{  1, 15,0},{  1, 11,0},{  1, 11,0}}},  {{/*1*/{  5,  5,1},{  1, 81,0},{  1, 37,0},{  1, 27,0},{  1, 21,0},{  1, 17,0},{  1, 15,0},{  1, 13,0}}},  {{/*1*/{  7,  7,0},{  1, 97,0},{  1, 45,0},{  1, 31,0},{  1, 25,0},{  1, 21,0},{  1, 17,0},{  1, 15,0}}},
-  {{/*1*/{  7,  7,1},{  1,113,0},{  1, 51,0},{  1, 37,0},{  1, 29,0},{  1, 23,0},{  1, 19,0},{  1, 17,0}}},  {{/*1*/{  9,  9,0},{  1,129,0},{  1, 59,0},{  1, 41,0},{  1, 33,0},{  1, 27,0},{  1, 21,0},{  1, 19,0}}},  {{/*1*/{  9,  9,1},{  1,145,0},{  1, 65,0},{  1, 47,0},{  1, 35,0},{  1, 29,0},{  1, 25,0},{  1, 21,0}}},  {{/*1*/{ 11, 11,0},{  1,161,0},{  1, 73,0},{  1, 51,0},{  1, 39,0},{  1, 33,0},{  1, 27,0},{  1, 23,0}}},
-  {{/*1*/{ 11, 11,1},{  1,177,0},{  1, 81,0},{  1, 57,0},{  1, 43,0},{  1, 35,0},{  1, 29,0},{  1, 25,0}}},  {{/*1*/{ 13, 13,0},{  1,193,0},{  1, 87,0},{  1, 61,0},{  1, 47,0},{  1, 39,0},{  1, 31,0},{  1, 27,0}}},  {{/*1*/{ 13, 13,1},{  1,209,0},{  1, 95,0},{  1, 65,0},{  1, 51,0},{  1, 41,0},{  1, 33,0},{  1, 29,0}}},  {{/*1*/{ 15, 15,0},{  1,225,0},{  1,101,0},{  1, 71,0},{  1, 55,0},{  1, 45,0},{  1, 37,0},{  1, 31,0}}},
-  {{/*1*/{ 15, 15,1},{  1,241,0},{  1,109,0},{  1, 75,0},{  1, 59,0},{  1, 47,0},{  1, 39,0},{  1, 33,0}}},  {{/*1*/{ 17, 17,0},{  3,227,0},{  1,115,0},{  1, 81,0},{  1, 63,0},{  1, 51,0},{  1, 41,0},{  1, 37,0}}},  {{/*1*/{ 17, 17,1},{  3,243,0},{  1,123,0},{  1, 85,0},{  1, 65,0},{  1, 53,0},{  1, 43,0},{  1, 39,0}}},  {{/*1*/{ 19, 19,0},{  5,229,0},{  1,129,0},{  1, 91,0},{  1, 69,0},{  1, 57,0},{  1, 47,0},{  1, 41,0}}},
-  {{/*1*/{ 19, 19,1},{  5,245,0},{  1,137,0},{  1, 95,0},{  1, 73,0},{  1, 59,0},{  1, 49,0},{  1, 43,0}}},  {{/*1*/{ 21, 21,0},{  7,231,0},{  1,145,0},{  1,101,0},{  1, 77,0},{  1, 63,0},{  1, 51,0},{  1, 45,0}}},  {{/*1*/{ 21, 21,1},{  7,247,0},{  1,151,0},{  1,105,0},{  1, 81,0},{  1, 65,0},{  1, 53,0},{  1, 47,0}}},  {{/*1*/{ 23, 23,0},{  9,233,0},{  1,159,0},{  1,111,0},{  1, 85,0},{  1, 69,0},{  1, 57,0},{  1, 49,0}}},
-  {{/*1*/{ 23, 23,1},{  9,249,0},{  1,165,0},{  1,115,0},{  1, 89,0},{  1, 73,0},{  1, 59,0},{  1, 51,0}}},  {{/*1*/{ 25, 25,0},{ 11,235,0},{  1,173,0},{  1,121,0},{  1, 93,0},{  1, 75,0},{  1, 61,0},{  1, 53,0}}},  {{/*1*/{ 25, 25,1},{ 11,251,0},{  1,179,0},{  1,125,0},{  1, 97,0},{  1, 79,0},{  1, 63,0},{  1, 55,0}}},  {{/*1*/{ 27, 27,0},{ 13,237,0},{  1,187,0},{  1,129,0},{  1, 99,0},{  1, 81,0},{  1, 65,0},{  1, 57,0}}},
-  {{/*1*/{ 27, 27,1},{ 13,253,0},{  1,193,0},{  1,135,0},{  1,103,0},{  1, 85,0},{  1, 69,0},{  1, 59,0}}},  {{/*1*/{ 29, 29,0},{ 15,239,0},{  1,201,0},{  1,139,0},{  1,107,0},{  1, 87,0},{  1, 71,0},{  1, 61,0}}},  {{/*1*/{ 29, 29,1},{ 15,255,0},{  1,209,0},{  1,145,0},{  1,111,0},{  1, 91,0},{  1, 73,0},{  1, 63,0}}},  {{/*1*/{ 31, 31,0},{ 17,241,0},{  1,215,0},{  1,149,0},{  1,115,0},{  1, 93,0},{  1, 75,0},{  1, 65,0}}},
-  {{/*1*/{ 31, 31,1},{ 19,227,0},{  1,223,0},{  1,155,0},{  1,119,0},{  1, 97,0},{  1, 79,0},{  1, 69,0}}},  {{/*1*/{ 33, 33,0},{ 19,243,0},{  1,229,0},{  1,159,0},{  1,123,0},{  1, 99,0},{  1, 81,0},{  1, 71,0}}},  {{/*1*/{ 33, 33,1},{ 21,229,0},{  1,237,0},{  1,165,0},{  1,127,0},{  1,103,0},{  1, 83,0},{  1, 73,0}}},  {{/*1*/{ 35, 35,0},{ 21,245,0},{  1,243,0},{  1,169,0},{  1,129,0},{  1,105,0},{  1, 85,0},{  1, 75,0}}},
-  {{/*1*/{ 35, 35,1},{ 23,231,0},{  1,251,0},{  1,175,0},{  1,133,0},{  1,109,0},{  1, 89,0},{  1, 77,0}}},  {{/*1*/{ 37, 37,0},{ 23,247,0},{  3,245,0},{  1,179,0},{  1,137,0},{  1,111,0},{  1, 91,0},{  1, 79,0}}},  {{/*1*/{ 37, 37,1},{ 25,233,0},{  3,253,0},{  1,185,0},{  1,141,0},{  1,115,0},{  1, 93,0},{  1, 81,0}}},  {{/*1*/{ 39, 39,0},{ 25,249,0},{  5,247,0},{  1,189,0},{  1,145,0},{  1,117,0},{  1, 95,0},{  1, 83,0}}},
-  {{/*1*/{ 39, 39,1},{ 27,235,0},{  5,255,0},{  1,193,0},{  1,149,0},{  1,121,0},{  1, 97,0},{  1, 85,0}}},  {{/*1*/{ 41, 41,0},{ 27,251,0},{  7,249,0},{  1,199,0},{  1,153,0},{  1,123,0},{  1,101,0},{  1, 87,0}}},  {{/*1*/{ 41, 41,1},{ 29,237,0},{  9,245,0},{  1,203,0},{  1,157,0},{  1,127,0},{  1,103,0},{  1, 89,0}}},  {{/*1*/{ 43, 43,0},{ 29,253,0},{  9,251,0},{  1,209,0},{  1,161,0},{  1,129,0},{  1,105,0},{  1, 91,0}}},
-  {{/*1*/{ 43, 43,1},{ 31,239,0},{ 11,247,0},{  1,213,0},{  1,163,0},{  1,133,0},{  1,107,0},{  1, 93,0}}},  {{/*1*/{ 45, 45,0},{ 31,255,0},{ 11,253,0},{  1,219,0},{  1,167,0},{  1,137,0},{  1,111,0},{  1, 95,0}}},  {{/*1*/{ 45, 45,1},{ 33,241,0},{ 13,249,0},{  1,223,0},{  1,171,0},{  1,139,0},{  1,113,0},{  1, 97,0}}},  {{/*1*/{ 47, 47,0},{ 35,227,0},{ 13,255,0},{  1,229,0},{  1,175,0},{  1,143,0},{  1,115,0},{  1,101,0}}},
-  {{/*1*/{ 47, 47,1},{ 35,243,0},{ 15,251,0},{  1,233,0},{  1,179,0},{  1,145,0},{  1,117,0},{  1,103,0}}},  {{/*1*/{ 49, 49,0},{ 37,229,0},{ 17,245,0},{  1,239,0},{  1,183,0},{  1,149,0},{  1,121,0},{  1,105,0}}},  {{/*1*/{ 49, 49,1},{ 37,245,0},{ 17,253,0},{  1,243,0},{  1,187,0},{  1,151,0},{  1,123,0},{  1,107,0}}},  {{/*1*/{ 51, 51,0},{ 39,231,0},{ 19,247,0},{  1,249,0},{  1,191,0},{  1,155,0},{  1,125,0},{  1,109,0}}},
-  {{/*1*/{ 51, 51,1},{ 39,247,0},{ 19,255,0},{  1,253,0},{  1,193,0},{  1,157,0},{  1,127,0},{  1,111,0}}},  {{/*1*/{ 53, 53,0},{ 41,233,0},{ 21,249,0},{  3,251,0},{  1,197,0},{  1,161,0},{  1,129,0},{  1,113,0}}},  {{/*1*/{ 53, 53,1},{ 41,249,0},{ 23,245,0},{  3,255,0},{  1,201,0},{  1,163,0},{  1,133,0},{  1,115,0}}},  {{/*1*/{ 55, 55,0},{ 43,235,0},{ 23,251,0},{  5,253,0},{  1,205,0},{  1,167,0},{  1,135,0},{  1,117,0}}},
-  {{/*1*/{ 55, 55,1},{ 43,251,0},{ 25,247,0},{  7,249,0},{  1,209,0},{  1,169,0},{  1,137,0},{  1,119,0}}},  {{/*1*/{ 57, 57,0},{ 45,237,0},{ 25,253,0},{  7,255,0},{  1,213,0},{  1,173,0},{  1,139,0},{  1,121,0}}},  {{/*1*/{ 57, 57,1},{ 45,253,0},{ 27,249,0},{  9,251,0},{  1,217,0},{  1,175,0},{  1,143,0},{  1,123,0}}},  {{/*1*/{ 59, 59,0},{ 47,239,0},{ 27,255,0},{ 11,249,0},{  1,221,0},{  1,179,0},{  1,145,0},{  1,125,0}}},
-  {{/*1*/{ 59, 59,1},{ 47,255,0},{ 29,251,0},{ 11,253,0},{  1,225,0},{  1,181,0},{  1,147,0},{  1,127,0}}},  {{/*1*/{ 61, 61,0},{ 49,241,0},{ 31,245,0},{ 13,251,0},{  1,227,0},{  1,185,0},{  1,149,0},{  1,129,0}}},  {{/*1*/{ 61, 61,1},{ 51,227,0},{ 31,253,0},{ 13,255,0},{  1,231,0},{  1,187,0},{  1,153,0},{  1,133,0}}},  {{/*1*/{ 63, 63,0},{ 51,243,0},{ 33,247,0},{ 15,253,0},{  1,235,0},{  1,191,0},{  1,155,0},{  1,135,0}}},
-  {{/*1*/{ 63, 63,1},{ 53,229,0},{ 33,255,0},{ 17,249,0},{  1,239,0},{  1,193,0},{  1,157,0},{  1,137,0}}},  {{/*1*/{ 65, 65,0},{ 53,245,0},{ 35,249,0},{ 17,255,0},{  1,243,0},{  1,197,0},{  1,159,0},{  1,139,0}}},  {{/*1*/{ 65, 65,1},{ 55,231,0},{ 37,245,0},{ 19,251,0},{  1,247,0},{  1,201,0},{  1,161,0},{  1,141,0}}},  {{/*1*/{ 67, 67,0},{ 55,247,0},{ 37,251,0},{ 21,249,0},{  1,251,0},{  1,203,0},{  1,165,0},{  1,143,0}}},
-  {{/*1*/{ 67, 67,1},{ 57,233,0},{ 39,247,0},{ 21,253,0},{  1,255,0},{  1,207,0},{  1,167,0},{  1,145,0}}},  {{/*1*/{ 69, 69,0},{ 57,249,0},{ 39,253,0},{ 23,251,0},{  3,253,0},{  1,209,0},{  1,169,0},{  1,147,0}}},  {{/*1*/{ 69, 69,1},{ 59,235,0},{ 41,249,0},{ 23,255,0},{  5,251,0},{  1,213,0},{  1,171,0},{  1,149,0}}},  {{/*1*/{ 71, 71,0},{ 59,251,0},{ 41,255,0},{ 25,253,0},{  5,255,0},{  1,215,0},{  1,175,0},{  1,151,0}}},
-  {{/*1*/{ 71, 71,1},{ 61,237,0},{ 43,251,0},{ 27,249,0},{  7,253,0},{  1,219,0},{  1,177,0},{  1,153,0}}},  {{/*1*/{ 73, 73,0},{ 61,253,0},{ 45,245,0},{ 27,255,0},{  9,251,0},{  1,221,0},{  1,179,0},{  1,155,0}}},  {{/*1*/{ 73, 73,1},{ 63,239,0},{ 45,253,0},{ 29,251,0},{  9,255,0},{  1,225,0},{  1,181,0},{  1,157,0}}},  {{/*1*/{ 75, 75,0},{ 63,255,0},{ 47,247,0},{ 31,249,0},{ 11,253,0},{  1,227,0},{  1,185,0},{  1,159,0}}},
-  {{/*1*/{ 75, 75,1},{ 65,241,0},{ 47,255,0},{ 31,253,0},{ 13,251,0},{  1,231,0},{  1,187,0},{  1,161,0}}},  {{/*1*/{ 77, 77,0},{ 67,227,0},{ 49,249,0},{ 33,251,0},{ 13,255,0},{  1,233,0},{  1,189,0},{  1,165,0}}},  {{/*1*/{ 77, 77,1},{ 67,243,0},{ 51,243,0},{ 33,255,0},{ 15,253,0},{  1,237,0},{  1,191,0},{  1,167,0}}},  {{/*1*/{ 79, 79,0},{ 69,229,0},{ 51,251,0},{ 35,253,0},{ 17,251,0},{  1,239,0},{  1,193,0},{  1,169,0}}},
-  {{/*1*/{ 79, 79,1},{ 69,245,0},{ 53,245,0},{ 37,249,0},{ 17,255,0},{  1,243,0},{  1,197,0},{  1,171,0}}},  {{/*1*/{ 81, 81,0},{ 71,231,0},{ 53,253,0},{ 37,255,0},{ 19,253,0},{  1,245,0},{  1,199,0},{  1,173,0}}},  {{/*1*/{ 81, 81,1},{ 71,247,0},{ 55,247,0},{ 39,251,0},{ 21,251,0},{  1,249,0},{  1,201,0},{  1,175,0}}},  {{/*1*/{ 83, 83,0},{ 73,233,0},{ 55,255,0},{ 41,249,0},{ 21,255,0},{  1,251,0},{  1,203,0},{  1,177,0}}},
-  {{/*1*/{ 83, 83,1},{ 73,249,0},{ 57,249,0},{ 41,253,0},{ 23,253,0},{  1,255,0},{  1,207,0},{  1,179,0}}},  {{/*1*/{ 85, 85,0},{ 75,235,0},{ 59,245,0},{ 43,251,0},{ 25,251,0},{  3,253,0},{  1,209,0},{  1,181,0}}},  {{/*1*/{ 85, 85,1},{ 75,251,0},{ 59,251,0},{ 43,255,0},{ 25,255,0},{  5,253,0},{  1,211,0},{  1,183,0}}},  {{/*1*/{ 87, 87,0},{ 77,237,0},{ 61,247,0},{ 45,253,0},{ 27,253,0},{  5,255,0},{  1,213,0},{  1,185,0}}},
-  {{/*1*/{ 87, 87,1},{ 77,253,0},{ 61,253,0},{ 47,249,0},{ 29,253,0},{  7,255,0},{  1,217,0},{  1,187,0}}},  {{/*1*/{ 89, 89,0},{ 79,239,0},{ 63,249,0},{ 47,255,0},{ 29,255,0},{  9,253,0},{  1,219,0},{  1,189,0}}},  {{/*1*/{ 89, 89,1},{ 79,255,0},{ 63,255,0},{ 49,251,0},{ 31,255,0},{ 11,253,0},{  1,221,0},{  1,191,0}}},  {{/*1*/{ 91, 91,0},{ 81,241,0},{ 65,251,0},{ 51,249,0},{ 33,253,0},{ 11,255,0},{  1,223,0},{  1,193,0}}},
-  {{/*1*/{ 91, 91,1},{ 83,227,0},{ 67,245,0},{ 51,253,0},{ 35,251,0},{ 13,255,0},{  1,225,0},{  1,197,0}}},  {{/*1*/{ 93, 93,0},{ 83,243,0},{ 67,253,0},{ 53,251,0},{ 35,255,0},{ 15,253,0},{  1,229,0},{  1,199,0}}},  {{/*1*/{ 93, 93,1},{ 85,229,0},{ 69,247,0},{ 53,255,0},{ 37,253,0},{ 17,253,0},{  1,231,0},{  1,201,0}}},  {{/*1*/{ 95, 95,0},{ 85,245,0},{ 69,255,0},{ 55,253,0},{ 39,251,0},{ 17,255,0},{  1,233,0},{  1,203,0}}},
-  {{/*1*/{ 95, 95,1},{ 87,231,0},{ 71,249,0},{ 57,249,0},{ 39,255,0},{ 19,255,0},{  1,235,0},{  1,205,0}}},  {{/*1*/{ 97, 97,0},{ 87,247,0},{ 73,245,0},{ 57,255,0},{ 41,253,0},{ 21,253,0},{  1,239,0},{  1,207,0}}},  {{/*1*/{ 97, 97,1},{ 89,233,0},{ 73,251,0},{ 59,251,0},{ 43,251,0},{ 23,253,0},{  1,241,0},{  1,209,0}}},  {{/*1*/{ 99, 99,0},{ 89,249,0},{ 75,247,0},{ 61,249,0},{ 43,255,0},{ 23,255,0},{  1,243,0},{  1,211,0}}},
-  {{/*1*/{ 99, 99,1},{ 91,235,0},{ 75,253,0},{ 61,253,0},{ 45,253,0},{ 25,255,0},{  1,245,0},{  1,213,0}}},  {{/*1*/{101,101,0},{ 91,251,0},{ 77,249,0},{ 63,251,0},{ 47,251,0},{ 27,253,0},{  1,249,0},{  1,215,0}}},  {{/*1*/{101,101,1},{ 93,237,0},{ 77,255,0},{ 63,255,0},{ 47,255,0},{ 29,253,0},{  1,251,0},{  1,217,0}}},  {{/*1*/{103,103,0},{ 93,253,0},{ 79,251,0},{ 65,253,0},{ 49,253,0},{ 29,255,0},{  1,253,0},{  1,219,0}}},
-  {{/*1*/{103,103,1},{ 95,239,0},{ 81,245,0},{ 67,251,0},{ 51,251,0},{ 31,255,0},{  1,255,0},{  1,221,0}}},  {{/*1*/{105,105,0},{ 95,255,0},{ 81,253,0},{ 67,255,0},{ 51,255,0},{ 33,253,0},{  3,255,0},{  1,223,0}}},  {{/*1*/{105,105,1},{ 97,241,0},{ 83,247,0},{ 69,253,0},{ 53,253,0},{ 35,253,0},{  5,255,0},{  1,225,0}}},  {{/*1*/{107,107,0},{ 99,227,0},{ 83,255,0},{ 71,249,0},{ 55,251,0},{ 35,255,0},{  7,255,0},{  1,229,0}}},
-  {{/*1*/{107,107,1},{ 99,243,0},{ 85,249,0},{ 71,255,0},{ 55,255,0},{ 37,255,0},{  9,253,0},{  1,231,0}}},  {{/*1*/{109,109,0},{101,229,0},{ 87,245,0},{ 73,251,0},{ 57,253,0},{ 39,253,0},{ 11,253,0},{  1,233,0}}},  {{/*1*/{109,109,1},{101,245,0},{ 87,251,0},{ 75,249,0},{ 59,251,0},{ 41,253,0},{ 11,255,0},{  1,235,0}}},  {{/*1*/{111,111,0},{103,231,0},{ 89,247,0},{ 75,253,0},{ 59,255,0},{ 41,255,0},{ 13,255,0},{  1,237,0}}},
-  {{/*1*/{111,111,1},{103,247,0},{ 89,253,0},{ 77,251,0},{ 61,253,0},{ 43,255,0},{ 15,255,0},{  1,239,0}}},  {{/*1*/{113,113,0},{105,233,0},{ 91,249,0},{ 77,255,0},{ 63,253,0},{ 45,253,0},{ 17,255,0},{  1,241,0}}},  {{/*1*/{113,113,1},{105,249,0},{ 91,255,0},{ 79,253,0},{ 63,255,0},{ 47,253,0},{ 19,253,0},{  1,243,0}}},  {{/*1*/{115,115,0},{107,235,0},{ 93,251,0},{ 81,249,0},{ 65,255,0},{ 47,255,0},{ 21,253,0},{  1,245,0}}},
-  {{/*1*/{115,115,1},{107,251,0},{ 95,245,0},{ 81,255,0},{ 67,253,0},{ 49,255,0},{ 21,255,0},{  1,247,0}}},  {{/*1*/{117,117,0},{109,237,0},{ 95,253,0},{ 83,251,0},{ 69,251,0},{ 51,253,0},{ 23,255,0},{  1,249,0}}},  {{/*1*/{117,117,1},{109,253,0},{ 97,247,0},{ 85,249,0},{ 69,255,0},{ 53,253,0},{ 25,255,0},{  1,251,0}}},  {{/*1*/{119,119,0},{111,239,0},{ 97,255,0},{ 85,253,0},{ 71,253,0},{ 53,255,0},{ 27,255,0},{  1,253,0}}},
-  {{/*1*/{119,119,1},{111,255,0},{ 99,249,0},{ 87,251,0},{ 73,251,0},{ 55,255,0},{ 29,253,0},{  1,255,0}}},  {{/*1*/{121,121,0},{113,241,0},{101,245,0},{ 87,255,0},{ 73,255,0},{ 57,253,0},{ 31,253,0},{  3,255,0}}},  {{/*1*/{121,121,1},{115,227,0},{101,251,0},{ 89,253,0},{ 75,253,0},{ 59,251,0},{ 31,255,0},{  5,255,0}}},  {{/*1*/{123,123,0},{115,243,0},{103,247,0},{ 91,249,0},{ 77,251,0},{ 59,255,0},{ 33,255,0},{  7,255,0}}},
-  {{/*1*/{123,123,1},{117,229,0},{103,253,0},{ 91,255,0},{ 77,255,0},{ 61,253,0},{ 35,255,0},{  9,255,0}}},  {{/*1*/{125,125,0},{117,245,0},{105,249,0},{ 93,251,0},{ 79,253,0},{ 63,253,0},{ 37,255,0},{ 11,255,0}}},  {{/*1*/{125,125,1},{119,231,0},{105,255,0},{ 95,249,0},{ 81,251,0},{ 63,255,0},{ 39,255,0},{ 13,255,0}}},  {{/*1*/{127,127,0},{119,247,0},{107,251,0},{ 95,253,0},{ 81,255,0},{ 65,255,0},{ 41,253,0},{ 15,255,0}}},
-  {{/*1*/{127,127,1},{121,233,0},{109,245,0},{ 97,251,0},{ 83,253,0},{ 67,253,0},{ 43,253,0},{ 17,255,0}}},  {{/*1*/{129,129,0},{121,249,0},{109,253,0},{ 97,255,0},{ 85,251,0},{ 69,253,0},{ 43,255,0},{ 19,255,0}}},  {{/*1*/{129,129,1},{123,235,0},{111,247,0},{ 99,253,0},{ 85,255,0},{ 69,255,0},{ 45,255,0},{ 21,255,0}}},  {{/*1*/{131,131,0},{123,251,0},{111,255,0},{101,249,0},{ 87,253,0},{ 71,255,0},{ 47,255,0},{ 23,255,0}}},
-  {{/*1*/{131,131,1},{125,237,0},{113,249,0},{101,255,0},{ 89,251,0},{ 73,253,0},{ 49,255,0},{ 25,255,0}}},  {{/*1*/{133,133,0},{125,253,0},{115,243,0},{103,251,0},{ 89,255,0},{ 75,253,0},{ 51,253,0},{ 27,255,0}}},  {{/*1*/{133,133,1},{127,239,0},{115,251,0},{105,249,0},{ 91,253,0},{ 75,255,0},{ 53,253,0},{ 29,253,0}}},  {{/*1*/{135,135,0},{127,255,0},{117,245,0},{105,253,0},{ 93,253,0},{ 77,255,0},{ 53,255,0},{ 31,253,0}}},
-  {{/*1*/{135,135,1},{129,241,0},{117,253,0},{107,251,0},{ 93,255,0},{ 79,253,0},{ 55,255,0},{ 31,255,0}}},  {{/*1*/{137,137,0},{131,227,0},{119,247,0},{107,255,0},{ 95,255,0},{ 81,253,0},{ 57,255,0},{ 33,255,0}}},  {{/*1*/{137,137,1},{131,243,0},{119,255,0},{109,253,0},{ 97,253,0},{ 81,255,0},{ 59,255,0},{ 35,255,0}}},  {{/*1*/{139,139,0},{133,229,0},{121,249,0},{111,249,0},{ 99,251,0},{ 83,255,0},{ 61,253,0},{ 37,255,0}}},
-  {{/*1*/{139,139,1},{133,245,0},{123,245,0},{111,255,0},{ 99,255,0},{ 85,253,0},{ 63,253,0},{ 39,255,0}}},  {{/*1*/{141,141,0},{135,231,0},{123,251,0},{113,251,0},{101,253,0},{ 87,253,0},{ 63,255,0},{ 41,255,0}}},  {{/*1*/{141,141,1},{135,247,0},{125,247,0},{115,249,0},{103,251,0},{ 87,255,0},{ 65,255,0},{ 43,255,0}}},  {{/*1*/{143,143,0},{137,233,0},{125,253,0},{115,253,0},{103,255,0},{ 89,255,0},{ 67,255,0},{ 45,255,0}}},
-  {{/*1*/{143,143,1},{137,249,0},{127,249,0},{117,251,0},{105,253,0},{ 91,253,0},{ 69,255,0},{ 47,255,0}}},  {{/*1*/{145,145,0},{139,235,0},{127,255,0},{117,255,0},{107,251,0},{ 93,253,0},{ 71,255,0},{ 49,255,0}}},  {{/*1*/{145,145,1},{139,251,0},{129,251,0},{119,253,0},{107,255,0},{ 93,255,0},{ 73,253,0},{ 51,255,0}}},  {{/*1*/{147,147,0},{141,237,0},{131,245,0},{121,249,0},{109,253,0},{ 95,255,0},{ 75,253,0},{ 53,255,0}}},
-  {{/*1*/{147,147,1},{141,253,0},{131,253,0},{121,255,0},{111,251,0},{ 97,253,0},{ 75,255,0},{ 55,255,0}}},  {{/*1*/{149,149,0},{143,239,0},{133,247,0},{123,251,0},{111,255,0},{ 99,253,0},{ 77,255,0},{ 57,255,0}}},  {{/*1*/{149,149,1},{143,255,0},{133,255,0},{125,249,0},{113,253,0},{ 99,255,0},{ 79,255,0},{ 59,255,0}}},  {{/*1*/{151,151,0},{145,241,0},{135,249,0},{125,253,0},{115,251,0},{101,255,0},{ 81,255,0},{ 61,253,0}}},
-  {{/*1*/{151,151,1},{147,227,0},{137,245,0},{127,251,0},{115,255,0},{103,253,0},{ 83,253,0},{ 63,253,0}}},  {{/*1*/{153,153,0},{147,243,0},{137,251,0},{127,255,0},{117,253,0},{105,253,0},{ 85,253,0},{ 63,255,0}}},  {{/*1*/{153,153,1},{149,229,0},{139,247,0},{129,253,0},{119,251,0},{105,255,0},{ 85,255,0},{ 65,255,0}}},  {{/*1*/{155,155,0},{149,245,0},{139,253,0},{131,251,0},{119,255,0},{107,255,0},{ 87,255,0},{ 67,255,0}}},
-  {{/*1*/{155,155,1},{151,231,0},{141,249,0},{131,255,0},{121,253,0},{109,253,0},{ 89,255,0},{ 69,255,0}}},  {{/*1*/{157,157,0},{151,247,0},{141,255,0},{133,253,0},{123,251,0},{111,253,0},{ 91,255,0},{ 71,255,0}}},  {{/*1*/{157,157,1},{153,233,0},{143,251,0},{135,249,0},{123,255,0},{111,255,0},{ 93,253,0},{ 73,255,0}}},  {{/*1*/{159,159,0},{153,249,0},{145,245,0},{135,255,0},{125,253,0},{113,255,0},{ 95,253,0},{ 75,255,0}}},
-  {{/*1*/{159,159,1},{155,235,0},{145,253,0},{137,251,0},{127,253,0},{115,253,0},{ 95,255,0},{ 77,255,0}}},  {{/*1*/{161,161,0},{155,251,0},{147,247,0},{139,249,0},{127,255,0},{117,253,0},{ 97,255,0},{ 79,255,0}}},  {{/*1*/{161,161,1},{157,237,0},{147,255,0},{139,253,0},{129,255,0},{117,255,0},{ 99,255,0},{ 81,255,0}}},  {{/*1*/{163,163,0},{157,253,0},{149,249,0},{141,251,0},{131,253,0},{119,255,0},{101,255,0},{ 83,255,0}}},
-  {{/*1*/{163,163,1},{159,239,0},{151,245,0},{141,255,0},{133,251,0},{121,253,0},{103,255,0},{ 85,255,0}}},  {{/*1*/{165,165,0},{159,255,0},{151,251,0},{143,253,0},{133,255,0},{123,251,0},{105,253,0},{ 87,255,0}}},  {{/*1*/{165,165,1},{161,241,0},{153,247,0},{145,249,0},{135,253,0},{123,255,0},{107,253,0},{ 89,255,0}}},  {{/*1*/{167,167,0},{163,227,0},{153,253,0},{145,255,0},{137,251,0},{125,253,0},{107,255,0},{ 91,255,0}}},
-  {{/*1*/{167,167,1},{163,243,0},{155,249,0},{147,251,0},{137,255,0},{127,253,0},{109,255,0},{ 93,253,0}}},  {{/*1*/{169,169,0},{165,229,0},{155,255,0},{149,249,0},{139,253,0},{127,255,0},{111,255,0},{ 95,253,0}}},  {{/*1*/{169,169,1},{165,245,0},{157,251,0},{149,253,0},{141,251,0},{129,255,0},{113,255,0},{ 95,255,0}}},  {{/*1*/{171,171,0},{167,231,0},{159,245,0},{151,251,0},{141,255,0},{131,253,0},{115,253,0},{ 97,255,0}}},
-  {{/*1*/{171,171,1},{167,247,0},{159,253,0},{151,255,0},{143,253,0},{133,253,0},{117,253,0},{ 99,255,0}}},  {{/*1*/{173,173,0},{169,233,0},{161,247,0},{153,253,0},{145,251,0},{133,255,0},{117,255,0},{101,255,0}}},  {{/*1*/{173,173,1},{169,249,0},{161,255,0},{155,249,0},{145,255,0},{135,255,0},{119,255,0},{103,255,0}}},  {{/*1*/{175,175,0},{171,235,0},{163,249,0},{155,255,0},{147,253,0},{137,253,0},{121,255,0},{105,255,0}}},
-  {{/*1*/{175,175,1},{171,251,0},{165,245,0},{157,251,0},{149,251,0},{139,253,0},{123,255,0},{107,255,0}}},  {{/*1*/{177,177,0},{173,237,0},{165,251,0},{159,249,0},{149,255,0},{139,255,0},{125,253,0},{109,255,0}}},  {{/*1*/{177,177,1},{173,253,0},{167,247,0},{159,253,0},{151,253,0},{141,255,0},{127,253,0},{111,255,0}}},  {{/*1*/{179,179,0},{175,239,0},{167,253,0},{161,251,0},{153,251,0},{143,253,0},{127,255,0},{113,255,0}}},
-  {{/*1*/{179,179,1},{175,255,0},{169,249,0},{161,255,0},{153,255,0},{145,253,0},{129,255,0},{115,255,0}}},  {{/*1*/{181,181,0},{177,241,0},{169,255,0},{163,253,0},{155,253,0},{145,255,0},{131,255,0},{117,255,0}}},  {{/*1*/{181,181,1},{179,227,0},{171,251,0},{165,249,0},{157,253,0},{147,255,0},{133,255,0},{119,255,0}}},  {{/*1*/{183,183,0},{179,243,0},{173,245,0},{165,255,0},{157,255,0},{149,253,0},{135,255,0},{121,255,0}}},
-  {{/*1*/{183,183,1},{181,229,0},{173,253,0},{167,251,0},{159,255,0},{151,253,0},{137,253,0},{123,255,0}}},  {{/*1*/{185,185,0},{181,245,0},{175,247,0},{169,249,0},{161,253,0},{151,255,0},{139,253,0},{125,253,0}}},  {{/*1*/{185,185,1},{183,231,0},{175,255,0},{169,253,0},{163,251,0},{153,255,0},{139,255,0},{127,253,0}}},  {{/*1*/{187,187,0},{183,247,0},{177,249,0},{171,251,0},{163,255,0},{155,253,0},{141,255,0},{127,255,0}}},
-  {{/*1*/{187,187,1},{185,233,0},{179,243,0},{171,255,0},{165,253,0},{157,253,0},{143,255,0},{129,255,0}}},  {{/*1*/{189,189,0},{185,249,0},{179,251,0},{173,253,0},{167,251,0},{157,255,0},{145,255,0},{131,255,0}}},  {{/*1*/{189,189,1},{187,235,0},{181,245,0},{175,249,0},{167,255,0},{159,255,0},{147,253,0},{133,255,0}}},  {{/*1*/{191,191,0},{187,251,0},{181,253,0},{175,255,0},{169,253,0},{161,253,0},{149,253,0},{135,255,0}}},
-  {{/*1*/{191,191,1},{189,237,0},{183,247,0},{177,251,0},{171,251,0},{163,253,0},{149,255,0},{137,255,0}}},  {{/*1*/{193,193,0},{189,253,0},{183,255,0},{179,249,0},{171,255,0},{163,255,0},{151,255,0},{139,255,0}}},  {{/*1*/{193,193,1},{191,239,0},{185,249,0},{179,253,0},{173,253,0},{165,255,0},{153,255,0},{141,255,0}}},  {{/*1*/{195,195,0},{191,255,0},{187,245,0},{181,251,0},{175,251,0},{167,253,0},{155,255,0},{143,255,0}}},
-  {{/*1*/{195,195,1},{193,241,0},{187,251,0},{181,255,0},{175,255,0},{169,253,0},{157,253,0},{145,255,0}}},  {{/*1*/{197,197,0},{195,227,0},{189,247,0},{183,253,0},{177,253,0},{169,255,0},{159,253,0},{147,255,0}}},  {{/*1*/{197,197,1},{195,243,0},{189,253,0},{185,249,0},{179,251,0},{171,255,0},{159,255,0},{149,255,0}}},  {{/*1*/{199,199,0},{197,229,0},{191,249,0},{185,255,0},{179,255,0},{173,253,0},{161,255,0},{151,255,0}}},
-  {{/*1*/{199,199,1},{197,245,0},{191,255,0},{187,251,0},{181,253,0},{175,253,0},{163,255,0},{153,255,0}}},  {{/*1*/{201,201,0},{199,231,0},{193,251,0},{189,249,0},{183,251,0},{175,255,0},{165,255,0},{155,255,0}}},  {{/*1*/{201,201,1},{199,247,0},{195,245,0},{189,253,0},{183,255,0},{177,255,0},{167,255,0},{157,253,0}}},  {{/*1*/{203,203,0},{201,233,0},{195,253,0},{191,251,0},{185,253,0},{179,253,0},{169,253,0},{159,253,0}}},
-  {{/*1*/{203,203,1},{201,249,0},{197,247,0},{191,255,0},{187,251,0},{181,253,0},{171,253,0},{159,255,0}}},  {{/*1*/{205,205,0},{203,235,0},{197,255,0},{193,253,0},{187,255,0},{181,255,0},{171,255,0},{161,255,0}}},  {{/*1*/{205,205,1},{203,251,0},{199,249,0},{195,251,0},{189,253,0},{183,255,0},{173,255,0},{163,255,0}}},  {{/*1*/{207,207,0},{205,237,0},{201,245,0},{195,255,0},{191,253,0},{185,253,0},{175,255,0},{165,255,0}}},
-  {{/*1*/{207,207,1},{205,253,0},{201,251,0},{197,253,0},{191,255,0},{187,251,0},{177,255,0},{167,255,0}}},  {{/*1*/{209,209,0},{207,239,0},{203,247,0},{199,249,0},{193,255,0},{187,255,0},{179,253,0},{169,255,0}}},  {{/*1*/{209,209,1},{207,255,0},{203,253,0},{199,255,0},{195,253,0},{189,253,0},{181,253,0},{171,255,0}}},  {{/*1*/{211,211,0},{209,241,0},{205,249,0},{201,251,0},{197,251,0},{191,253,0},{181,255,0},{173,255,0}}},
-  {{/*1*/{211,211,1},{211,227,0},{205,255,0},{203,249,0},{197,255,0},{191,255,0},{183,255,0},{175,255,0}}},  {{/*1*/{213,213,0},{211,243,0},{207,251,0},{203,253,0},{199,253,0},{193,255,0},{185,255,0},{177,255,0}}},  {{/*1*/{213,213,1},{213,229,0},{209,245,0},{205,251,0},{201,251,0},{195,253,0},{187,255,0},{179,255,0}}},  {{/*1*/{215,215,0},{213,245,0},{209,253,0},{205,255,0},{201,255,0},{197,253,0},{189,253,0},{181,255,0}}},
-  {{/*1*/{215,215,1},{215,231,0},{211,247,0},{207,253,0},{203,253,0},{197,255,0},{191,253,0},{183,255,0}}},  {{/*1*/{217,217,0},{215,247,0},{211,255,0},{209,249,0},{205,251,0},{199,255,0},{191,255,0},{185,255,0}}},  {{/*1*/{217,217,1},{217,233,0},{213,249,0},{209,255,0},{205,255,0},{201,253,0},{193,255,0},{187,255,0}}},  {{/*1*/{219,219,0},{217,249,0},{215,245,0},{211,251,0},{207,253,0},{203,253,0},{195,255,0},{189,253,0}}},
-  {{/*1*/{219,219,1},{219,235,0},{215,251,0},{213,249,0},{209,251,0},{203,255,0},{197,255,0},{191,253,0}}},  {{/*1*/{221,221,0},{219,251,0},{217,247,0},{213,253,0},{209,255,0},{205,255,0},{199,255,0},{191,255,0}}},  {{/*1*/{221,221,1},{221,237,0},{217,253,0},{215,251,0},{211,253,0},{207,253,0},{201,253,0},{193,255,0}}},  {{/*1*/{223,223,0},{221,253,0},{219,249,0},{215,255,0},{213,251,0},{209,253,0},{203,253,0},{195,255,0}}},
-  {{/*1*/{223,223,1},{223,239,0},{219,255,0},{217,253,0},{213,255,0},{209,255,0},{203,255,0},{197,255,0}}},  {{/*1*/{225,225,0},{223,255,0},{221,251,0},{219,249,0},{215,253,0},{211,255,0},{205,255,0},{199,255,0}}},  {{/*1*/{225,225,1},{225,241,0},{223,245,0},{219,255,0},{217,251,0},{213,253,0},{207,255,0},{201,255,0}}},  {{/*1*/{227,227,0},{227,227,0},{223,253,0},{221,251,0},{217,255,0},{215,253,0},{209,255,0},{203,255,0}}},
-  {{/*1*/{227,227,1},{227,243,0},{225,247,0},{223,249,0},{219,253,0},{215,255,0},{211,253,0},{205,255,0}}},  {{/*1*/{229,229,0},{229,229,0},{225,255,0},{223,253,0},{221,253,0},{217,255,0},{213,253,0},{207,255,0}}},  {{/*1*/{229,229,1},{229,245,0},{227,249,0},{225,251,0},{221,255,0},{219,253,0},{213,255,0},{209,255,0}}},  {{/*1*/{231,231,0},{231,231,0},{229,245,0},{225,255,0},{223,255,0},{221,253,0},{215,255,0},{211,255,0}}},
-  {{/*1*/{231,231,1},{231,247,0},{229,251,0},{227,253,0},{225,253,0},{221,255,0},{217,255,0},{213,255,0}}},  {{/*1*/{233,233,0},{233,233,0},{231,247,0},{229,249,0},{227,251,0},{223,255,0},{219,255,0},{215,255,0}}},  {{/*1*/{233,233,1},{233,249,0},{231,253,0},{229,255,0},{227,255,0},{225,253,0},{221,253,0},{217,255,0}}},  {{/*1*/{235,235,0},{235,235,0},{233,249,0},{231,251,0},{229,253,0},{227,253,0},{223,253,0},{219,255,0}}},
-  {{/*1*/{235,235,1},{235,251,0},{233,255,0},{233,249,0},{231,251,0},{227,255,0},{223,255,0},{221,253,0}}},  {{/*1*/{237,237,0},{237,237,0},{235,251,0},{233,253,0},{231,255,0},{229,255,0},{225,255,0},{223,253,0}}},  {{/*1*/{237,237,1},{237,253,0},{237,245,0},{235,251,0},{233,253,0},{231,253,0},{227,255,0},{223,255,0}}},  {{/*1*/{239,239,0},{239,239,0},{237,253,0},{235,255,0},{235,251,0},{233,253,0},{229,255,0},{225,255,0}}},
-  {{/*1*/{239,239,1},{239,255,0},{239,247,0},{237,253,0},{235,255,0},{233,255,0},{231,255,0},{227,255,0}}},  {{/*1*/{241,241,0},{241,241,0},{239,255,0},{239,249,0},{237,253,0},{235,255,0},{233,253,0},{229,255,0}}},  {{/*1*/{241,241,1},{243,241,0},{241,249,0},{239,255,0},{239,251,0},{237,253,0},{235,253,0},{231,255,0}}},  {{/*1*/{243,243,0},{243,243,0},{243,243,0},{241,251,0},{239,255,0},{239,253,0},{235,255,0},{233,255,0}}},
-  {{/*1*/{243,243,1},{245,243,0},{243,251,0},{243,249,0},{241,253,0},{239,255,0},{237,255,0},{235,255,0}}},  {{/*1*/{245,245,0},{245,245,0},{245,245,0},{243,253,0},{243,251,0},{241,255,0},{239,255,0},{237,255,0}}},  {{/*1*/{245,245,1},{247,245,0},{245,253,0},{245,251,0},{243,255,0},{243,253,0},{241,255,0},{239,255,0}}},  {{/*1*/{247,247,0},{247,247,0},{247,247,0},{245,255,0},{245,253,0},{245,253,0},{243,253,0},{241,255,0}}},
-  {{/*1*/{247,247,1},{249,247,0},{247,255,0},{247,253,0},{247,251,0},{245,255,0},{245,253,0},{243,255,0}}},  {{/*1*/{249,249,0},{249,249,0},{249,249,0},{249,249,0},{247,255,0},{247,255,0},{245,255,0},{245,255,0}}},  {{/*1*/{249,249,1},{251,249,0},{251,249,0},{249,255,0},{249,253,0},{249,253,0},{247,255,0},{247,255,0}}},  {{/*1*/{251,251,0},{251,251,0},{251,251,0},{251,251,0},{251,251,0},{251,251,0},{249,255,0},{249,255,0}}},
-  {{/*1*/{251,251,1},{253,251,0},{253,251,0},{253,251,0},{251,255,0},{251,255,0},{251,255,0},{251,255,0}}},  {{/*1*/{253,253,0},{253,253,0},{253,253,0},{253,253,0},{253,253,0},{253,253,0},{253,253,0},{253,253,0}}},  {{/*1*/{253,253,1},{255,253,0},{255,253,0},{255,253,0},{255,253,0},{255,253,0},{255,253,0},{255,253,0}}},  {{/*1*/{255,255,0},{255,255,0},{255,255,0},{255,255,0},{255,255,0},{255,255,0},{255,255,0},{255,255,0}}}
+  {/*1*/{  1,  1,  1,  1,  1,  1,  1,  1},{  1,  1,  1,  1,  1,  1,  1,  1},{1,1,1,1,1,1,1,1}},  {/*1*/{  1,  1,  1,  1,  1,  1,  1,  1},{  1,  1,  1,  1,  1,  1,  1,  1},{0,0,0,0,0,0,0,0}},  {/*1*/{  1,  1,  1,  1,  1,  1,  1,  1},{  1, 17,  9,  7,  5,  5,  5,  5},{1,0,0,0,0,0,0,0}},  {/*1*/{  3,  1,  1,  1,  1,  1,  1,  1},{  3, 33, 17, 11,  9,  9,  7,  7},{0,0,0,0,0,0,0,0}},
+  {/*1*/{  3,  1,  1,  1,  1,  1,  1,  1},{  3, 49, 23, 17, 13, 11,  9,  9},{1,0,0,0,0,0,0,0}},  {/*1*/{  5,  1,  1,  1,  1,  1,  1,  1},{  5, 65, 31, 21, 17, 15, 11, 11},{0,0,0,0,0,0,0,0}},  {/*1*/{  5,  1,  1,  1,  1,  1,  1,  1},{  5, 81, 37, 27, 21, 17, 15, 13},{1,0,0,0,0,0,0,0}},  {/*1*/{  7,  1,  1,  1,  1,  1,  1,  1},{  7, 97, 45, 31, 25, 21, 17, 15},{0,0,0,0,0,0,0,0}},
+  {/*1*/{  7,  1,  1,  1,  1,  1,  1,  1},{  7,113, 51, 37, 29, 23, 19, 17},{1,0,0,0,0,0,0,0}},  {/*1*/{  9,  1,  1,  1,  1,  1,  1,  1},{  9,129, 59, 41, 33, 27, 21, 19},{0,0,0,0,0,0,0,0}},  {/*1*/{  9,  1,  1,  1,  1,  1,  1,  1},{  9,145, 65, 47, 35, 29, 25, 21},{1,0,0,0,0,0,0,0}},  {/*1*/{ 11,  1,  1,  1,  1,  1,  1,  1},{ 11,161, 73, 51, 39, 33, 27, 23},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 11,  1,  1,  1,  1,  1,  1,  1},{ 11,177, 81, 57, 43, 35, 29, 25},{1,0,0,0,0,0,0,0}},  {/*1*/{ 13,  1,  1,  1,  1,  1,  1,  1},{ 13,193, 87, 61, 47, 39, 31, 27},{0,0,0,0,0,0,0,0}},  {/*1*/{ 13,  1,  1,  1,  1,  1,  1,  1},{ 13,209, 95, 65, 51, 41, 33, 29},{1,0,0,0,0,0,0,0}},  {/*1*/{ 15,  1,  1,  1,  1,  1,  1,  1},{ 15,225,101, 71, 55, 45, 37, 31},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 15,  1,  1,  1,  1,  1,  1,  1},{ 15,241,109, 75, 59, 47, 39, 33},{1,0,0,0,0,0,0,0}},  {/*1*/{ 17,  3,  1,  1,  1,  1,  1,  1},{ 17,227,115, 81, 63, 51, 41, 37},{0,0,0,0,0,0,0,0}},  {/*1*/{ 17,  3,  1,  1,  1,  1,  1,  1},{ 17,243,123, 85, 65, 53, 43, 39},{1,0,0,0,0,0,0,0}},  {/*1*/{ 19,  5,  1,  1,  1,  1,  1,  1},{ 19,229,129, 91, 69, 57, 47, 41},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 19,  5,  1,  1,  1,  1,  1,  1},{ 19,245,137, 95, 73, 59, 49, 43},{1,0,0,0,0,0,0,0}},  {/*1*/{ 21,  7,  1,  1,  1,  1,  1,  1},{ 21,231,145,101, 77, 63, 51, 45},{0,0,0,0,0,0,0,0}},  {/*1*/{ 21,  7,  1,  1,  1,  1,  1,  1},{ 21,247,151,105, 81, 65, 53, 47},{1,0,0,0,0,0,0,0}},  {/*1*/{ 23,  9,  1,  1,  1,  1,  1,  1},{ 23,233,159,111, 85, 69, 57, 49},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 23,  9,  1,  1,  1,  1,  1,  1},{ 23,249,165,115, 89, 73, 59, 51},{1,0,0,0,0,0,0,0}},  {/*1*/{ 25, 11,  1,  1,  1,  1,  1,  1},{ 25,235,173,121, 93, 75, 61, 53},{0,0,0,0,0,0,0,0}},  {/*1*/{ 25, 11,  1,  1,  1,  1,  1,  1},{ 25,251,179,125, 97, 79, 63, 55},{1,0,0,0,0,0,0,0}},  {/*1*/{ 27, 13,  1,  1,  1,  1,  1,  1},{ 27,237,187,129, 99, 81, 65, 57},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 27, 13,  1,  1,  1,  1,  1,  1},{ 27,253,193,135,103, 85, 69, 59},{1,0,0,0,0,0,0,0}},  {/*1*/{ 29, 15,  1,  1,  1,  1,  1,  1},{ 29,239,201,139,107, 87, 71, 61},{0,0,0,0,0,0,0,0}},  {/*1*/{ 29, 15,  1,  1,  1,  1,  1,  1},{ 29,255,209,145,111, 91, 73, 63},{1,0,0,0,0,0,0,0}},  {/*1*/{ 31, 17,  1,  1,  1,  1,  1,  1},{ 31,241,215,149,115, 93, 75, 65},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 31, 19,  1,  1,  1,  1,  1,  1},{ 31,227,223,155,119, 97, 79, 69},{1,0,0,0,0,0,0,0}},  {/*1*/{ 33, 19,  1,  1,  1,  1,  1,  1},{ 33,243,229,159,123, 99, 81, 71},{0,0,0,0,0,0,0,0}},  {/*1*/{ 33, 21,  1,  1,  1,  1,  1,  1},{ 33,229,237,165,127,103, 83, 73},{1,0,0,0,0,0,0,0}},  {/*1*/{ 35, 21,  1,  1,  1,  1,  1,  1},{ 35,245,243,169,129,105, 85, 75},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 35, 23,  1,  1,  1,  1,  1,  1},{ 35,231,251,175,133,109, 89, 77},{1,0,0,0,0,0,0,0}},  {/*1*/{ 37, 23,  3,  1,  1,  1,  1,  1},{ 37,247,245,179,137,111, 91, 79},{0,0,0,0,0,0,0,0}},  {/*1*/{ 37, 25,  3,  1,  1,  1,  1,  1},{ 37,233,253,185,141,115, 93, 81},{1,0,0,0,0,0,0,0}},  {/*1*/{ 39, 25,  5,  1,  1,  1,  1,  1},{ 39,249,247,189,145,117, 95, 83},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 39, 27,  5,  1,  1,  1,  1,  1},{ 39,235,255,193,149,121, 97, 85},{1,0,0,0,0,0,0,0}},  {/*1*/{ 41, 27,  7,  1,  1,  1,  1,  1},{ 41,251,249,199,153,123,101, 87},{0,0,0,0,0,0,0,0}},  {/*1*/{ 41, 29,  9,  1,  1,  1,  1,  1},{ 41,237,245,203,157,127,103, 89},{1,0,0,0,0,0,0,0}},  {/*1*/{ 43, 29,  9,  1,  1,  1,  1,  1},{ 43,253,251,209,161,129,105, 91},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 43, 31, 11,  1,  1,  1,  1,  1},{ 43,239,247,213,163,133,107, 93},{1,0,0,0,0,0,0,0}},  {/*1*/{ 45, 31, 11,  1,  1,  1,  1,  1},{ 45,255,253,219,167,137,111, 95},{0,0,0,0,0,0,0,0}},  {/*1*/{ 45, 33, 13,  1,  1,  1,  1,  1},{ 45,241,249,223,171,139,113, 97},{1,0,0,0,0,0,0,0}},  {/*1*/{ 47, 35, 13,  1,  1,  1,  1,  1},{ 47,227,255,229,175,143,115,101},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 47, 35, 15,  1,  1,  1,  1,  1},{ 47,243,251,233,179,145,117,103},{1,0,0,0,0,0,0,0}},  {/*1*/{ 49, 37, 17,  1,  1,  1,  1,  1},{ 49,229,245,239,183,149,121,105},{0,0,0,0,0,0,0,0}},  {/*1*/{ 49, 37, 17,  1,  1,  1,  1,  1},{ 49,245,253,243,187,151,123,107},{1,0,0,0,0,0,0,0}},  {/*1*/{ 51, 39, 19,  1,  1,  1,  1,  1},{ 51,231,247,249,191,155,125,109},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 51, 39, 19,  1,  1,  1,  1,  1},{ 51,247,255,253,193,157,127,111},{1,0,0,0,0,0,0,0}},  {/*1*/{ 53, 41, 21,  3,  1,  1,  1,  1},{ 53,233,249,251,197,161,129,113},{0,0,0,0,0,0,0,0}},  {/*1*/{ 53, 41, 23,  3,  1,  1,  1,  1},{ 53,249,245,255,201,163,133,115},{1,0,0,0,0,0,0,0}},  {/*1*/{ 55, 43, 23,  5,  1,  1,  1,  1},{ 55,235,251,253,205,167,135,117},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 55, 43, 25,  7,  1,  1,  1,  1},{ 55,251,247,249,209,169,137,119},{1,0,0,0,0,0,0,0}},  {/*1*/{ 57, 45, 25,  7,  1,  1,  1,  1},{ 57,237,253,255,213,173,139,121},{0,0,0,0,0,0,0,0}},  {/*1*/{ 57, 45, 27,  9,  1,  1,  1,  1},{ 57,253,249,251,217,175,143,123},{1,0,0,0,0,0,0,0}},  {/*1*/{ 59, 47, 27, 11,  1,  1,  1,  1},{ 59,239,255,249,221,179,145,125},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 59, 47, 29, 11,  1,  1,  1,  1},{ 59,255,251,253,225,181,147,127},{1,0,0,0,0,0,0,0}},  {/*1*/{ 61, 49, 31, 13,  1,  1,  1,  1},{ 61,241,245,251,227,185,149,129},{0,0,0,0,0,0,0,0}},  {/*1*/{ 61, 51, 31, 13,  1,  1,  1,  1},{ 61,227,253,255,231,187,153,133},{1,0,0,0,0,0,0,0}},  {/*1*/{ 63, 51, 33, 15,  1,  1,  1,  1},{ 63,243,247,253,235,191,155,135},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 63, 53, 33, 17,  1,  1,  1,  1},{ 63,229,255,249,239,193,157,137},{1,0,0,0,0,0,0,0}},  {/*1*/{ 65, 53, 35, 17,  1,  1,  1,  1},{ 65,245,249,255,243,197,159,139},{0,0,0,0,0,0,0,0}},  {/*1*/{ 65, 55, 37, 19,  1,  1,  1,  1},{ 65,231,245,251,247,201,161,141},{1,0,0,0,0,0,0,0}},  {/*1*/{ 67, 55, 37, 21,  1,  1,  1,  1},{ 67,247,251,249,251,203,165,143},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 67, 57, 39, 21,  1,  1,  1,  1},{ 67,233,247,253,255,207,167,145},{1,0,0,0,0,0,0,0}},  {/*1*/{ 69, 57, 39, 23,  3,  1,  1,  1},{ 69,249,253,251,253,209,169,147},{0,0,0,0,0,0,0,0}},  {/*1*/{ 69, 59, 41, 23,  5,  1,  1,  1},{ 69,235,249,255,251,213,171,149},{1,0,0,0,0,0,0,0}},  {/*1*/{ 71, 59, 41, 25,  5,  1,  1,  1},{ 71,251,255,253,255,215,175,151},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 71, 61, 43, 27,  7,  1,  1,  1},{ 71,237,251,249,253,219,177,153},{1,0,0,0,0,0,0,0}},  {/*1*/{ 73, 61, 45, 27,  9,  1,  1,  1},{ 73,253,245,255,251,221,179,155},{0,0,0,0,0,0,0,0}},  {/*1*/{ 73, 63, 45, 29,  9,  1,  1,  1},{ 73,239,253,251,255,225,181,157},{1,0,0,0,0,0,0,0}},  {/*1*/{ 75, 63, 47, 31, 11,  1,  1,  1},{ 75,255,247,249,253,227,185,159},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 75, 65, 47, 31, 13,  1,  1,  1},{ 75,241,255,253,251,231,187,161},{1,0,0,0,0,0,0,0}},  {/*1*/{ 77, 67, 49, 33, 13,  1,  1,  1},{ 77,227,249,251,255,233,189,165},{0,0,0,0,0,0,0,0}},  {/*1*/{ 77, 67, 51, 33, 15,  1,  1,  1},{ 77,243,243,255,253,237,191,167},{1,0,0,0,0,0,0,0}},  {/*1*/{ 79, 69, 51, 35, 17,  1,  1,  1},{ 79,229,251,253,251,239,193,169},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 79, 69, 53, 37, 17,  1,  1,  1},{ 79,245,245,249,255,243,197,171},{1,0,0,0,0,0,0,0}},  {/*1*/{ 81, 71, 53, 37, 19,  1,  1,  1},{ 81,231,253,255,253,245,199,173},{0,0,0,0,0,0,0,0}},  {/*1*/{ 81, 71, 55, 39, 21,  1,  1,  1},{ 81,247,247,251,251,249,201,175},{1,0,0,0,0,0,0,0}},  {/*1*/{ 83, 73, 55, 41, 21,  1,  1,  1},{ 83,233,255,249,255,251,203,177},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 83, 73, 57, 41, 23,  1,  1,  1},{ 83,249,249,253,253,255,207,179},{1,0,0,0,0,0,0,0}},  {/*1*/{ 85, 75, 59, 43, 25,  3,  1,  1},{ 85,235,245,251,251,253,209,181},{0,0,0,0,0,0,0,0}},  {/*1*/{ 85, 75, 59, 43, 25,  5,  1,  1},{ 85,251,251,255,255,253,211,183},{1,0,0,0,0,0,0,0}},  {/*1*/{ 87, 77, 61, 45, 27,  5,  1,  1},{ 87,237,247,253,253,255,213,185},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 87, 77, 61, 47, 29,  7,  1,  1},{ 87,253,253,249,253,255,217,187},{1,0,0,0,0,0,0,0}},  {/*1*/{ 89, 79, 63, 47, 29,  9,  1,  1},{ 89,239,249,255,255,253,219,189},{0,0,0,0,0,0,0,0}},  {/*1*/{ 89, 79, 63, 49, 31, 11,  1,  1},{ 89,255,255,251,255,253,221,191},{1,0,0,0,0,0,0,0}},  {/*1*/{ 91, 81, 65, 51, 33, 11,  1,  1},{ 91,241,251,249,253,255,223,193},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 91, 83, 67, 51, 35, 13,  1,  1},{ 91,227,245,253,251,255,225,197},{1,0,0,0,0,0,0,0}},  {/*1*/{ 93, 83, 67, 53, 35, 15,  1,  1},{ 93,243,253,251,255,253,229,199},{0,0,0,0,0,0,0,0}},  {/*1*/{ 93, 85, 69, 53, 37, 17,  1,  1},{ 93,229,247,255,253,253,231,201},{1,0,0,0,0,0,0,0}},  {/*1*/{ 95, 85, 69, 55, 39, 17,  1,  1},{ 95,245,255,253,251,255,233,203},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 95, 87, 71, 57, 39, 19,  1,  1},{ 95,231,249,249,255,255,235,205},{1,0,0,0,0,0,0,0}},  {/*1*/{ 97, 87, 73, 57, 41, 21,  1,  1},{ 97,247,245,255,253,253,239,207},{0,0,0,0,0,0,0,0}},  {/*1*/{ 97, 89, 73, 59, 43, 23,  1,  1},{ 97,233,251,251,251,253,241,209},{1,0,0,0,0,0,0,0}},  {/*1*/{ 99, 89, 75, 61, 43, 23,  1,  1},{ 99,249,247,249,255,255,243,211},{0,0,0,0,0,0,0,0}},
+  {/*1*/{ 99, 91, 75, 61, 45, 25,  1,  1},{ 99,235,253,253,253,255,245,213},{1,0,0,0,0,0,0,0}},  {/*1*/{101, 91, 77, 63, 47, 27,  1,  1},{101,251,249,251,251,253,249,215},{0,0,0,0,0,0,0,0}},  {/*1*/{101, 93, 77, 63, 47, 29,  1,  1},{101,237,255,255,255,253,251,217},{1,0,0,0,0,0,0,0}},  {/*1*/{103, 93, 79, 65, 49, 29,  1,  1},{103,253,251,253,253,255,253,219},{0,0,0,0,0,0,0,0}},
+  {/*1*/{103, 95, 81, 67, 51, 31,  1,  1},{103,239,245,251,251,255,255,221},{1,0,0,0,0,0,0,0}},  {/*1*/{105, 95, 81, 67, 51, 33,  3,  1},{105,255,253,255,255,253,255,223},{0,0,0,0,0,0,0,0}},  {/*1*/{105, 97, 83, 69, 53, 35,  5,  1},{105,241,247,253,253,253,255,225},{1,0,0,0,0,0,0,0}},  {/*1*/{107, 99, 83, 71, 55, 35,  7,  1},{107,227,255,249,251,255,255,229},{0,0,0,0,0,0,0,0}},
+  {/*1*/{107, 99, 85, 71, 55, 37,  9,  1},{107,243,249,255,255,255,253,231},{1,0,0,0,0,0,0,0}},  {/*1*/{109,101, 87, 73, 57, 39, 11,  1},{109,229,245,251,253,253,253,233},{0,0,0,0,0,0,0,0}},  {/*1*/{109,101, 87, 75, 59, 41, 11,  1},{109,245,251,249,251,253,255,235},{1,0,0,0,0,0,0,0}},  {/*1*/{111,103, 89, 75, 59, 41, 13,  1},{111,231,247,253,255,255,255,237},{0,0,0,0,0,0,0,0}},
+  {/*1*/{111,103, 89, 77, 61, 43, 15,  1},{111,247,253,251,253,255,255,239},{1,0,0,0,0,0,0,0}},  {/*1*/{113,105, 91, 77, 63, 45, 17,  1},{113,233,249,255,253,253,255,241},{0,0,0,0,0,0,0,0}},  {/*1*/{113,105, 91, 79, 63, 47, 19,  1},{113,249,255,253,255,253,253,243},{1,0,0,0,0,0,0,0}},  {/*1*/{115,107, 93, 81, 65, 47, 21,  1},{115,235,251,249,255,255,253,245},{0,0,0,0,0,0,0,0}},
+  {/*1*/{115,107, 95, 81, 67, 49, 21,  1},{115,251,245,255,253,255,255,247},{1,0,0,0,0,0,0,0}},  {/*1*/{117,109, 95, 83, 69, 51, 23,  1},{117,237,253,251,251,253,255,249},{0,0,0,0,0,0,0,0}},  {/*1*/{117,109, 97, 85, 69, 53, 25,  1},{117,253,247,249,255,253,255,251},{1,0,0,0,0,0,0,0}},  {/*1*/{119,111, 97, 85, 71, 53, 27,  1},{119,239,255,253,253,255,255,253},{0,0,0,0,0,0,0,0}},
+  {/*1*/{119,111, 99, 87, 73, 55, 29,  1},{119,255,249,251,251,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{121,113,101, 87, 73, 57, 31,  3},{121,241,245,255,255,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{121,115,101, 89, 75, 59, 31,  5},{121,227,251,253,253,251,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{123,115,103, 91, 77, 59, 33,  7},{123,243,247,249,251,255,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{123,117,103, 91, 77, 61, 35,  9},{123,229,253,255,255,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{125,117,105, 93, 79, 63, 37, 11},{125,245,249,251,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{125,119,105, 95, 81, 63, 39, 13},{125,231,255,249,251,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{127,119,107, 95, 81, 65, 41, 15},{127,247,251,253,255,255,253,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{127,121,109, 97, 83, 67, 43, 17},{127,233,245,251,253,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{129,121,109, 97, 85, 69, 43, 19},{129,249,253,255,251,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{129,123,111, 99, 85, 69, 45, 21},{129,235,247,253,255,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{131,123,111,101, 87, 71, 47, 23},{131,251,255,249,253,255,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{131,125,113,101, 89, 73, 49, 25},{131,237,249,255,251,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{133,125,115,103, 89, 75, 51, 27},{133,253,243,251,255,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{133,127,115,105, 91, 75, 53, 29},{133,239,251,249,253,255,253,253},{1,0,0,0,0,0,0,0}},  {/*1*/{135,127,117,105, 93, 77, 53, 31},{135,255,245,253,253,255,255,253},{0,0,0,0,0,0,0,0}},
+  {/*1*/{135,129,117,107, 93, 79, 55, 31},{135,241,253,251,255,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{137,131,119,107, 95, 81, 57, 33},{137,227,247,255,255,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{137,131,119,109, 97, 81, 59, 35},{137,243,255,253,253,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{139,133,121,111, 99, 83, 61, 37},{139,229,249,249,251,255,253,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{139,133,123,111, 99, 85, 63, 39},{139,245,245,255,255,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{141,135,123,113,101, 87, 63, 41},{141,231,251,251,253,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{141,135,125,115,103, 87, 65, 43},{141,247,247,249,251,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{143,137,125,115,103, 89, 67, 45},{143,233,253,253,255,255,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{143,137,127,117,105, 91, 69, 47},{143,249,249,251,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{145,139,127,117,107, 93, 71, 49},{145,235,255,255,251,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{145,139,129,119,107, 93, 73, 51},{145,251,251,253,255,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{147,141,131,121,109, 95, 75, 53},{147,237,245,249,253,255,253,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{147,141,131,121,111, 97, 75, 55},{147,253,253,255,251,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{149,143,133,123,111, 99, 77, 57},{149,239,247,251,255,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{149,143,133,125,113, 99, 79, 59},{149,255,255,249,253,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{151,145,135,125,115,101, 81, 61},{151,241,249,253,251,255,255,253},{0,0,0,0,0,0,0,0}},
+  {/*1*/{151,147,137,127,115,103, 83, 63},{151,227,245,251,255,253,253,253},{1,0,0,0,0,0,0,0}},  {/*1*/{153,147,137,127,117,105, 85, 63},{153,243,251,255,253,253,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{153,149,139,129,119,105, 85, 65},{153,229,247,253,251,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{155,149,139,131,119,107, 87, 67},{155,245,253,251,255,255,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{155,151,141,131,121,109, 89, 69},{155,231,249,255,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{157,151,141,133,123,111, 91, 71},{157,247,255,253,251,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{157,153,143,135,123,111, 93, 73},{157,233,251,249,255,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{159,153,145,135,125,113, 95, 75},{159,249,245,255,253,255,253,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{159,155,145,137,127,115, 95, 77},{159,235,253,251,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{161,155,147,139,127,117, 97, 79},{161,251,247,249,255,253,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{161,157,147,139,129,117, 99, 81},{161,237,255,253,255,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{163,157,149,141,131,119,101, 83},{163,253,249,251,253,255,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{163,159,151,141,133,121,103, 85},{163,239,245,255,251,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{165,159,151,143,133,123,105, 87},{165,255,251,253,255,251,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{165,161,153,145,135,123,107, 89},{165,241,247,249,253,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{167,163,153,145,137,125,107, 91},{167,227,253,255,251,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{167,163,155,147,137,127,109, 93},{167,243,249,251,255,253,255,253},{1,0,0,0,0,0,0,0}},  {/*1*/{169,165,155,149,139,127,111, 95},{169,229,255,249,253,255,255,253},{0,0,0,0,0,0,0,0}},  {/*1*/{169,165,157,149,141,129,113, 95},{169,245,251,253,251,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{171,167,159,151,141,131,115, 97},{171,231,245,251,255,253,253,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{171,167,159,151,143,133,117, 99},{171,247,253,255,253,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{173,169,161,153,145,133,117,101},{173,233,247,253,251,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{173,169,161,155,145,135,119,103},{173,249,255,249,255,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{175,171,163,155,147,137,121,105},{175,235,249,255,253,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{175,171,165,157,149,139,123,107},{175,251,245,251,251,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{177,173,165,159,149,139,125,109},{177,237,251,249,255,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{177,173,167,159,151,141,127,111},{177,253,247,253,253,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{179,175,167,161,153,143,127,113},{179,239,253,251,251,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{179,175,169,161,153,145,129,115},{179,255,249,255,255,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{181,177,169,163,155,145,131,117},{181,241,255,253,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{181,179,171,165,157,147,133,119},{181,227,251,249,253,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{183,179,173,165,157,149,135,121},{183,243,245,255,255,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{183,181,173,167,159,151,137,123},{183,229,253,251,255,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{185,181,175,169,161,151,139,125},{185,245,247,249,253,255,253,253},{0,0,0,0,0,0,0,0}},  {/*1*/{185,183,175,169,163,153,139,127},{185,231,255,253,251,255,255,253},{1,0,0,0,0,0,0,0}},  {/*1*/{187,183,177,171,163,155,141,127},{187,247,249,251,255,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{187,185,179,171,165,157,143,129},{187,233,243,255,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{189,185,179,173,167,157,145,131},{189,249,251,253,251,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{189,187,181,175,167,159,147,133},{189,235,245,249,255,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{191,187,181,175,169,161,149,135},{191,251,253,255,253,253,253,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{191,189,183,177,171,163,149,137},{191,237,247,251,251,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{193,189,183,179,171,163,151,139},{193,253,255,249,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{193,191,185,179,173,165,153,141},{193,239,249,253,253,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{195,191,187,181,175,167,155,143},{195,255,245,251,251,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{195,193,187,181,175,169,157,145},{195,241,251,255,255,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{197,195,189,183,177,169,159,147},{197,227,247,253,253,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{197,195,189,185,179,171,159,149},{197,243,253,249,251,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{199,197,191,185,179,173,161,151},{199,229,249,255,255,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{199,197,191,187,181,175,163,153},{199,245,255,251,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{201,199,193,189,183,175,165,155},{201,231,251,249,251,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{201,199,195,189,183,177,167,157},{201,247,245,253,255,255,255,253},{1,0,0,0,0,0,0,0}},  {/*1*/{203,201,195,191,185,179,169,159},{203,233,253,251,253,253,253,253},{0,0,0,0,0,0,0,0}},
+  {/*1*/{203,201,197,191,187,181,171,159},{203,249,247,255,251,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{205,203,197,193,187,181,171,161},{205,235,255,253,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{205,203,199,195,189,183,173,163},{205,251,249,251,253,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{207,205,201,195,191,185,175,165},{207,237,245,255,253,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{207,205,201,197,191,187,177,167},{207,253,251,253,255,251,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{209,207,203,199,193,187,179,169},{209,239,247,249,255,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{209,207,203,199,195,189,181,171},{209,255,253,255,253,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{211,209,205,201,197,191,181,173},{211,241,249,251,251,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{211,211,205,203,197,191,183,175},{211,227,255,249,255,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{213,211,207,203,199,193,185,177},{213,243,251,253,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{213,213,209,205,201,195,187,179},{213,229,245,251,251,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{215,213,209,205,201,197,189,181},{215,245,253,255,255,253,253,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{215,215,211,207,203,197,191,183},{215,231,247,253,253,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{217,215,211,209,205,199,191,185},{217,247,255,249,251,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{217,217,213,209,205,201,193,187},{217,233,249,255,255,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{219,217,215,211,207,203,195,189},{219,249,245,251,253,253,255,253},{0,0,0,0,0,0,0,0}},
+  {/*1*/{219,219,215,213,209,203,197,191},{219,235,251,249,251,255,255,253},{1,0,0,0,0,0,0,0}},  {/*1*/{221,219,217,213,209,205,199,191},{221,251,247,253,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{221,221,217,215,211,207,201,193},{221,237,253,251,253,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{223,221,219,215,213,209,203,195},{223,253,249,255,251,253,253,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{223,223,219,217,213,209,203,197},{223,239,255,253,255,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{225,223,221,219,215,211,205,199},{225,255,251,249,253,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{225,225,223,219,217,213,207,201},{225,241,245,255,251,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{227,227,223,221,217,215,209,203},{227,227,253,251,255,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{227,227,225,223,219,215,211,205},{227,243,247,249,253,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{229,229,225,223,221,217,213,207},{229,229,255,253,253,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{229,229,227,225,221,219,213,209},{229,245,249,251,255,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{231,231,229,225,223,221,215,211},{231,231,245,255,255,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{231,231,229,227,225,221,217,213},{231,247,251,253,253,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{233,233,231,229,227,223,219,215},{233,233,247,249,251,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{233,233,231,229,227,225,221,217},{233,249,253,255,255,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{235,235,233,231,229,227,223,219},{235,235,249,251,253,253,253,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{235,235,233,233,231,227,223,221},{235,251,255,249,251,255,255,253},{1,0,0,0,0,0,0,0}},  {/*1*/{237,237,235,233,231,229,225,223},{237,237,251,253,255,255,255,253},{0,0,0,0,0,0,0,0}},  {/*1*/{237,237,237,235,233,231,227,223},{237,253,245,251,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{239,239,237,235,235,233,229,225},{239,239,253,255,251,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{239,239,239,237,235,233,231,227},{239,255,247,253,255,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{241,241,239,239,237,235,233,229},{241,241,255,249,253,255,253,255},{0,0,0,0,0,0,0,0}},  {/*1*/{241,243,241,239,239,237,235,231},{241,241,249,255,251,253,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{243,243,243,241,239,239,235,233},{243,243,243,251,255,253,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{243,245,243,243,241,239,237,235},{243,243,251,249,253,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{245,245,245,243,243,241,239,237},{245,245,245,253,251,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{245,247,245,245,243,243,241,239},{245,245,253,251,255,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{247,247,247,245,245,245,243,241},{247,247,247,255,253,253,253,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{247,249,247,247,247,245,245,243},{247,247,255,253,251,255,253,255},{1,0,0,0,0,0,0,0}},  {/*1*/{249,249,249,249,247,247,245,245},{249,249,249,249,255,255,255,255},{0,0,0,0,0,0,0,0}},  {/*1*/{249,251,251,249,249,249,247,247},{249,249,249,255,253,253,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{251,251,251,251,251,251,249,249},{251,251,251,251,251,251,255,255},{0,0,0,0,0,0,0,0}},
+  {/*1*/{251,253,253,253,251,251,251,251},{251,251,251,251,255,255,255,255},{1,0,0,0,0,0,0,0}},  {/*1*/{253,253,253,253,253,253,253,253},{253,253,253,253,253,253,253,253},{0,0,0,0,0,0,0,0}},  {/*1*/{253,255,255,255,255,255,255,255},{253,253,253,253,253,253,253,253},{1,0,0,0,0,0,0,0}},  {/*1*/{255,255,255,255,255,255,255,255},{255,255,255,255,255,255,255,255},{0,0,0,0,0,0,0,0}}
 }
 };
 #else
 /* 256 * 2 * 1 = 512 */
 static PaletteSingleLookup2 const sp_lookup_5_4[256] =
 {
-  {  0,  0},  {  0,  0},  {  0,  8},  {  0,  8},  {  0, 16},  {  0, 16},  {  0, 16},  {  0, 24},
-  {  8,  8},  {  0, 33},  {  0, 33},  {  0, 33},  {  0, 41},  {  0, 41},  {  0, 41},  {  0, 49},
-  {  0, 49},  {  0, 49},  {  0, 57},  {  0, 57},  {  0, 66},  {  0, 66},  { 33,  0},  {  0, 74},
-  {  0, 74},  {  0, 74},  {  0, 82},  {  8, 66},  {  0, 90},  {  0, 90},  { 33, 24},  {  0, 99},
-  {  0, 99},  { 33, 33},  {  8, 90},  {  0,107},  {  0,107},  {  0,115},  { 33, 49},  {  0,123},
-  {  0,123},  { 41, 41},  {  0,132},  {  0,132},  { 66,  0},  {  0,140},  { 33, 74},  {  0,148},
-  {  0,148},  { 33, 82},  {  0,156},  {  0,156},  { 66, 24},  {  8,148},  {  0,165},  { 66, 33},
-  {  0,173},  { 33,107},  {  0,181},  {  0,181},  { 41, 99},  { 16,156},  {  0,189},  { 66, 57},
-  {  0,198},  { 33,132},  { 66, 66},  {  0,206},  { 33,140},  { 99,  8},  {  0,214},  { 66, 82},
-  {  0,222},  { 33,156},  { 74, 74},  {  0,231},  { 33,165},  { 99, 33},  {  0,239},  { 66,107},
-  { 16,214},  {  0,247},  { 66,115},  {  0,255},  { 33,189},  { 99, 57},  {  8,247},  { 33,198},
-  { 24,222},  {  8,255},  { 66,140},  { 16,247},  { 33,214},  { 74,132},  { 16,255},  { 33,222},
-  { 99, 90},  { 24,247},  { 66,165},  { 24,255},  { 33,239},  { 66,173},  {132, 41},  { 33,247},
-  { 99,115},  { 33,255},  { 66,189},  {107,107},  { 41,247},  { 66,198},  {132, 66},  { 41,255},
-  { 99,140},  { 49,247},  { 57,231},  { 99,148},  { 49,255},  { 66,222},  {132, 90},  { 57,247},
-  { 66,231},  { 57,255},  { 66,239},  { 99,173},  {165, 41},  { 66,247},  {107,165},  { 82,222},
-  { 66,255},  {132,123},  { 74,247},  { 99,198},  {132,132},  { 74,255},  { 99,206},  {165, 74},
-  { 82,247},  {132,148},  { 82,255},  { 99,222},  {140,140},  { 90,247},  { 99,231},  {165, 99},
-  { 90,255},  {132,173},  {198, 41},  { 99,247},  {132,181},  {198, 49},  { 99,255},  {165,123},
-  {107,247},  {115,231},  {165,132},  {107,255},  {132,206},  {198, 74},  {115,247},  {140,198},
-  {115,255},  {123,239},  {165,156},  {123,247},  {132,231},  {165,165},  {123,255},  {132,239},
-  {198,107},  {132,247},  {165,181},  {231, 49},  {132,255},  {173,173},  {239, 41},  {140,247},
-  {198,132},  {140,255},  {165,206},  {231, 74},  {148,247},  {165,214},  {231, 82},  {148,255},
-  {198,156},  {156,247},  {165,231},  {198,165},  {156,255},  {165,239},  {231,107},  {165,247},
-  {173,231},  {239, 99},  {165,255},  {198,189},  {173,247},  {173,247},  {198,198},  {173,255},
-  {181,239},  {231,140},  {181,247},  {198,214},  {181,255},  {181,255},  {206,206},  {189,247},
-  {189,247},  {231,165},  {189,255},  {198,239},  {198,239},  {198,247},  {198,247},  {198,247},
-  {198,255},  {231,189},  {206,247},  {206,247},  {231,198},  {206,255},  {206,255},  {206,255},
-  {214,247},  {231,214},  {214,255},  {214,255},  {231,222},  {222,247},  {222,247},  {231,231},
-  {222,255},  {231,239},  {231,239},  {231,247},  {231,247},  {231,247},  {231,255},  {239,239},
-  {239,239},  {239,247},  {239,247},  {239,255},  {239,255},  {239,255},  {247,247},  {247,247},
-  {247,247},  {247,255},  {247,255},  {255,247},  {255,247},  {255,247},  {255,255},  {255,255}
+  SPL(  0,  0),  SPL(  0,  0),  SPL(  0,  8),  SPL(  0,  8),  SPL(  0, 16),  SPL(  0, 16),  SPL(  0, 16),  SPL(  0, 24),
+  SPL(  8,  8),  SPL(  0, 33),  SPL(  0, 33),  SPL(  0, 33),  SPL(  0, 41),  SPL(  0, 41),  SPL(  0, 41),  SPL(  0, 49),
+  SPL(  0, 49),  SPL(  0, 49),  SPL(  0, 57),  SPL(  0, 57),  SPL(  0, 66),  SPL(  0, 66),  SPL( 33,  0),  SPL(  0, 74),
+  SPL(  0, 74),  SPL(  0, 74),  SPL(  0, 82),  SPL(  8, 66),  SPL(  0, 90),  SPL(  0, 90),  SPL( 33, 24),  SPL(  0, 99),
+  SPL(  0, 99),  SPL( 33, 33),  SPL(  8, 90),  SPL(  0,107),  SPL(  0,107),  SPL(  0,115),  SPL( 33, 49),  SPL(  0,123),
+  SPL(  0,123),  SPL( 41, 41),  SPL(  0,132),  SPL(  0,132),  SPL( 66,  0),  SPL(  0,140),  SPL( 33, 74),  SPL(  0,148),
+  SPL(  0,148),  SPL( 33, 82),  SPL(  0,156),  SPL(  0,156),  SPL( 66, 24),  SPL(  8,148),  SPL(  0,165),  SPL( 66, 33),
+  SPL(  0,173),  SPL( 33,107),  SPL(  0,181),  SPL(  0,181),  SPL( 41, 99),  SPL( 16,156),  SPL(  0,189),  SPL( 66, 57),
+  SPL(  0,198),  SPL( 33,132),  SPL( 66, 66),  SPL(  0,206),  SPL( 33,140),  SPL( 99,  8),  SPL(  0,214),  SPL( 66, 82),
+  SPL(  0,222),  SPL( 33,156),  SPL( 74, 74),  SPL(  0,231),  SPL( 33,165),  SPL( 99, 33),  SPL(  0,239),  SPL( 66,107),
+  SPL( 16,214),  SPL(  0,247),  SPL( 66,115),  SPL(  0,255),  SPL( 33,189),  SPL( 99, 57),  SPL(  8,247),  SPL( 33,198),
+  SPL( 24,222),  SPL(  8,255),  SPL( 66,140),  SPL( 16,247),  SPL( 33,214),  SPL( 74,132),  SPL( 16,255),  SPL( 33,222),
+  SPL( 99, 90),  SPL( 24,247),  SPL( 66,165),  SPL( 24,255),  SPL( 33,239),  SPL( 66,173),  SPL(132, 41),  SPL( 33,247),
+  SPL( 99,115),  SPL( 33,255),  SPL( 66,189),  SPL(107,107),  SPL( 41,247),  SPL( 66,198),  SPL(132, 66),  SPL( 41,255),
+  SPL( 99,140),  SPL( 49,247),  SPL( 57,231),  SPL( 99,148),  SPL( 49,255),  SPL( 66,222),  SPL(132, 90),  SPL( 57,247),
+  SPL( 66,231),  SPL( 57,255),  SPL( 66,239),  SPL( 99,173),  SPL(165, 41),  SPL( 66,247),  SPL(107,165),  SPL( 82,222),
+  SPL( 66,255),  SPL(132,123),  SPL( 74,247),  SPL( 99,198),  SPL(132,132),  SPL( 74,255),  SPL( 99,206),  SPL(165, 74),
+  SPL( 82,247),  SPL(132,148),  SPL( 82,255),  SPL( 99,222),  SPL(140,140),  SPL( 90,247),  SPL( 99,231),  SPL(165, 99),
+  SPL( 90,255),  SPL(132,173),  SPL(198, 41),  SPL( 99,247),  SPL(132,181),  SPL(198, 49),  SPL( 99,255),  SPL(165,123),
+  SPL(107,247),  SPL(115,231),  SPL(165,132),  SPL(107,255),  SPL(132,206),  SPL(198, 74),  SPL(115,247),  SPL(140,198),
+  SPL(115,255),  SPL(123,239),  SPL(165,156),  SPL(123,247),  SPL(132,231),  SPL(165,165),  SPL(123,255),  SPL(132,239),
+  SPL(198,107),  SPL(132,247),  SPL(165,181),  SPL(231, 49),  SPL(132,255),  SPL(173,173),  SPL(239, 41),  SPL(140,247),
+  SPL(198,132),  SPL(140,255),  SPL(165,206),  SPL(231, 74),  SPL(148,247),  SPL(165,214),  SPL(231, 82),  SPL(148,255),
+  SPL(198,156),  SPL(156,247),  SPL(165,231),  SPL(198,165),  SPL(156,255),  SPL(165,239),  SPL(231,107),  SPL(165,247),
+  SPL(173,231),  SPL(239, 99),  SPL(165,255),  SPL(198,189),  SPL(173,247),  SPL(173,247),  SPL(198,198),  SPL(173,255),
+  SPL(181,239),  SPL(231,140),  SPL(181,247),  SPL(198,214),  SPL(181,255),  SPL(181,255),  SPL(206,206),  SPL(189,247),
+  SPL(189,247),  SPL(231,165),  SPL(189,255),  SPL(198,239),  SPL(198,239),  SPL(198,247),  SPL(198,247),  SPL(198,247),
+  SPL(198,255),  SPL(231,189),  SPL(206,247),  SPL(206,247),  SPL(231,198),  SPL(206,255),  SPL(206,255),  SPL(206,255),
+  SPL(214,247),  SPL(231,214),  SPL(214,255),  SPL(214,255),  SPL(231,222),  SPL(222,247),  SPL(222,247),  SPL(231,231),
+  SPL(222,255),  SPL(231,239),  SPL(231,239),  SPL(231,247),  SPL(231,247),  SPL(231,247),  SPL(231,255),  SPL(239,239),
+  SPL(239,239),  SPL(239,247),  SPL(239,247),  SPL(239,255),  SPL(239,255),  SPL(239,255),  SPL(247,247),  SPL(247,247),
+  SPL(247,247),  SPL(247,255),  SPL(247,255),  SPL(255,247),  SPL(255,247),  SPL(255,247),  SPL(255,255),  SPL(255,255)
 };
 
 /* 256 * 2 * 1 = 512 */
 static PaletteSingleLookup2 const sp_lookup_6_4[256] =
 {
-  {  0,  0},  {  0,  4},  {  0,  8},  {  0, 12},  {  4,  4},  {  0, 16},  {  0, 20},  {  0, 24},
-  {  8,  8},  {  0, 28},  {  0, 32},  {  0, 36},  { 12, 12},  {  0, 40},  {  0, 44},  {  0, 48},
-  { 16, 16},  {  0, 52},  {  0, 56},  {  0, 60},  { 20, 20},  {  0, 65},  {  0, 69},  {  0, 73},
-  {  4, 65},  {  0, 77},  {  0, 81},  {  0, 85},  {  8, 69},  {  0, 89},  {  0, 93},  {  0, 97},
-  { 12, 73},  {  0,101},  {  0,105},  {  0,109},  { 16, 77},  {  0,113},  {  0,117},  {  0,121},
-  { 20, 81},  {  0,125},  {  0,130},  {  0,134},  { 24, 85},  {  0,138},  {  0,142},  {  0,146},
-  {  8,130},  {  0,150},  {  0,154},  {  0,158},  { 12,134},  {  0,162},  {  0,166},  {  0,170},
-  { 16,138},  {  0,174},  {  0,178},  {  0,182},  { 20,142},  {  0,186},  {  0,190},  {  0,195},
-  { 24,146},  {  0,199},  {  0,203},  {  0,207},  { 28,150},  {  0,211},  {  0,215},  {  0,219},
-  { 12,195},  {  0,223},  {  0,227},  {  0,231},  { 16,199},  {  0,235},  {  0,239},  {  0,243},
-  { 20,203},  {  0,247},  {  0,251},  {  0,255},  { 24,207},  {  4,251},  {  4,255},  {  8,251},
-  { 28,211},  {  8,255},  { 12,251},  { 12,255},  { 32,215},  { 16,251},  { 16,255},  { 20,251},
-  { 36,219},  { 20,255},  { 24,251},  { 24,255},  { 40,223},  { 28,251},  { 28,255},  { 32,251},
-  { 44,227},  { 32,255},  { 36,251},  { 36,255},  { 48,231},  { 40,251},  { 40,255},  { 44,251},
-  { 52,235},  { 44,255},  { 48,251},  { 48,255},  { 56,239},  { 52,251},  { 52,255},  { 56,251},
-  { 60,243},  { 56,255},  { 60,251},  { 60,255},  { 65,247},  { 85,207},  { 65,251},  { 65,255},
-  { 69,251},  { 89,211},  { 69,255},  { 73,251},  { 73,255},  { 93,215},  { 77,251},  { 77,255},
-  { 81,251},  { 97,219},  { 81,255},  { 85,251},  { 85,255},  {101,223},  { 89,251},  { 89,255},
-  { 93,251},  {105,227},  { 93,255},  { 97,251},  { 97,255},  {109,231},  {101,251},  {101,255},
-  {105,251},  {113,235},  {105,255},  {109,251},  {109,255},  {117,239},  {113,251},  {113,255},
-  {117,251},  {121,243},  {117,255},  {121,251},  {121,255},  {125,247},  {125,251},  {125,255},
-  {130,247},  {130,251},  {150,211},  {130,255},  {134,251},  {134,255},  {154,215},  {138,251},
-  {138,255},  {142,251},  {158,219},  {142,255},  {146,251},  {146,255},  {162,223},  {150,251},
-  {150,255},  {154,251},  {166,227},  {154,255},  {158,251},  {158,255},  {170,231},  {162,251},
-  {162,255},  {166,251},  {174,235},  {166,255},  {170,251},  {170,255},  {178,239},  {174,251},
-  {174,255},  {178,251},  {182,243},  {178,255},  {182,251},  {182,255},  {186,247},  {186,251},
-  {186,255},  {195,239},  {190,251},  {190,255},  {195,247},  {195,251},  {195,255},  {215,215},
-  {199,251},  {199,255},  {203,251},  {219,219},  {203,255},  {207,251},  {207,255},  {223,223},
-  {211,251},  {211,255},  {215,251},  {227,227},  {215,255},  {219,251},  {219,255},  {231,231},
-  {223,251},  {223,255},  {227,251},  {235,235},  {227,255},  {231,251},  {231,255},  {239,239},
-  {235,251},  {235,255},  {239,251},  {243,243},  {239,255},  {243,251},  {243,255},  {247,247},
-  {247,251},  {247,255},  {247,255},  {251,251},  {251,255},  {255,251},  {255,255},  {255,255}
+  SPL(  0,  0),  SPL(  0,  4),  SPL(  0,  8),  SPL(  0, 12),  SPL(  4,  4),  SPL(  0, 16),  SPL(  0, 20),  SPL(  0, 24),
+  SPL(  8,  8),  SPL(  0, 28),  SPL(  0, 32),  SPL(  0, 36),  SPL( 12, 12),  SPL(  0, 40),  SPL(  0, 44),  SPL(  0, 48),
+  SPL( 16, 16),  SPL(  0, 52),  SPL(  0, 56),  SPL(  0, 60),  SPL( 20, 20),  SPL(  0, 65),  SPL(  0, 69),  SPL(  0, 73),
+  SPL(  4, 65),  SPL(  0, 77),  SPL(  0, 81),  SPL(  0, 85),  SPL(  8, 69),  SPL(  0, 89),  SPL(  0, 93),  SPL(  0, 97),
+  SPL( 12, 73),  SPL(  0,101),  SPL(  0,105),  SPL(  0,109),  SPL( 16, 77),  SPL(  0,113),  SPL(  0,117),  SPL(  0,121),
+  SPL( 20, 81),  SPL(  0,125),  SPL(  0,130),  SPL(  0,134),  SPL( 24, 85),  SPL(  0,138),  SPL(  0,142),  SPL(  0,146),
+  SPL(  8,130),  SPL(  0,150),  SPL(  0,154),  SPL(  0,158),  SPL( 12,134),  SPL(  0,162),  SPL(  0,166),  SPL(  0,170),
+  SPL( 16,138),  SPL(  0,174),  SPL(  0,178),  SPL(  0,182),  SPL( 20,142),  SPL(  0,186),  SPL(  0,190),  SPL(  0,195),
+  SPL( 24,146),  SPL(  0,199),  SPL(  0,203),  SPL(  0,207),  SPL( 28,150),  SPL(  0,211),  SPL(  0,215),  SPL(  0,219),
+  SPL( 12,195),  SPL(  0,223),  SPL(  0,227),  SPL(  0,231),  SPL( 16,199),  SPL(  0,235),  SPL(  0,239),  SPL(  0,243),
+  SPL( 20,203),  SPL(  0,247),  SPL(  0,251),  SPL(  0,255),  SPL( 24,207),  SPL(  4,251),  SPL(  4,255),  SPL(  8,251),
+  SPL( 28,211),  SPL(  8,255),  SPL( 12,251),  SPL( 12,255),  SPL( 32,215),  SPL( 16,251),  SPL( 16,255),  SPL( 20,251),
+  SPL( 36,219),  SPL( 20,255),  SPL( 24,251),  SPL( 24,255),  SPL( 40,223),  SPL( 28,251),  SPL( 28,255),  SPL( 32,251),
+  SPL( 44,227),  SPL( 32,255),  SPL( 36,251),  SPL( 36,255),  SPL( 48,231),  SPL( 40,251),  SPL( 40,255),  SPL( 44,251),
+  SPL( 52,235),  SPL( 44,255),  SPL( 48,251),  SPL( 48,255),  SPL( 56,239),  SPL( 52,251),  SPL( 52,255),  SPL( 56,251),
+  SPL( 60,243),  SPL( 56,255),  SPL( 60,251),  SPL( 60,255),  SPL( 65,247),  SPL( 85,207),  SPL( 65,251),  SPL( 65,255),
+  SPL( 69,251),  SPL( 89,211),  SPL( 69,255),  SPL( 73,251),  SPL( 73,255),  SPL( 93,215),  SPL( 77,251),  SPL( 77,255),
+  SPL( 81,251),  SPL( 97,219),  SPL( 81,255),  SPL( 85,251),  SPL( 85,255),  SPL(101,223),  SPL( 89,251),  SPL( 89,255),
+  SPL( 93,251),  SPL(105,227),  SPL( 93,255),  SPL( 97,251),  SPL( 97,255),  SPL(109,231),  SPL(101,251),  SPL(101,255),
+  SPL(105,251),  SPL(113,235),  SPL(105,255),  SPL(109,251),  SPL(109,255),  SPL(117,239),  SPL(113,251),  SPL(113,255),
+  SPL(117,251),  SPL(121,243),  SPL(117,255),  SPL(121,251),  SPL(121,255),  SPL(125,247),  SPL(125,251),  SPL(125,255),
+  SPL(130,247),  SPL(130,251),  SPL(150,211),  SPL(130,255),  SPL(134,251),  SPL(134,255),  SPL(154,215),  SPL(138,251),
+  SPL(138,255),  SPL(142,251),  SPL(158,219),  SPL(142,255),  SPL(146,251),  SPL(146,255),  SPL(162,223),  SPL(150,251),
+  SPL(150,255),  SPL(154,251),  SPL(166,227),  SPL(154,255),  SPL(158,251),  SPL(158,255),  SPL(170,231),  SPL(162,251),
+  SPL(162,255),  SPL(166,251),  SPL(174,235),  SPL(166,255),  SPL(170,251),  SPL(170,255),  SPL(178,239),  SPL(174,251),
+  SPL(174,255),  SPL(178,251),  SPL(182,243),  SPL(178,255),  SPL(182,251),  SPL(182,255),  SPL(186,247),  SPL(186,251),
+  SPL(186,255),  SPL(195,239),  SPL(190,251),  SPL(190,255),  SPL(195,247),  SPL(195,251),  SPL(195,255),  SPL(215,215),
+  SPL(199,251),  SPL(199,255),  SPL(203,251),  SPL(219,219),  SPL(203,255),  SPL(207,251),  SPL(207,255),  SPL(223,223),
+  SPL(211,251),  SPL(211,255),  SPL(215,251),  SPL(227,227),  SPL(215,255),  SPL(219,251),  SPL(219,255),  SPL(231,231),
+  SPL(223,251),  SPL(223,255),  SPL(227,251),  SPL(235,235),  SPL(227,255),  SPL(231,251),  SPL(231,255),  SPL(239,239),
+  SPL(235,251),  SPL(235,255),  SPL(239,251),  SPL(243,243),  SPL(239,255),  SPL(243,251),  SPL(243,255),  SPL(247,247),
+  SPL(247,251),  SPL(247,255),  SPL(247,255),  SPL(251,251),  SPL(251,255),  SPL(255,251),  SPL(255,255),  SPL(255,255)
 };
 
 /* 256 * 2 * 1 = 512 */
 static PaletteSingleLookup2 const sp_lookup_7_4[256] =
 {
-  {  0,  0},  {  0,  4},  {  0,  8},  {  0, 10},  {  0, 14},  {  0, 16},  {  0, 20},  {  0, 22},
-  {  0, 26},  {  0, 28},  {  0, 32},  {  0, 34},  {  0, 38},  {  0, 40},  {  0, 44},  {  0, 46},
-  {  0, 50},  {  0, 52},  {  0, 56},  {  0, 58},  {  0, 62},  {  0, 64},  {  0, 68},  {  0, 72},
-  {  0, 74},  {  0, 78},  {  0, 80},  {  0, 84},  {  0, 86},  {  0, 90},  {  0, 92},  {  0, 96},
-  {  0, 98},  {  0,102},  {  0,104},  {  0,108},  {  0,110},  {  0,114},  {  0,116},  {  0,120},
-  {  0,122},  {  0,126},  {  0,129},  {  0,133},  {  0,135},  {  0,139},  {  0,141},  {  0,145},
-  {  0,147},  {  0,151},  {  0,153},  {  0,157},  {  0,159},  {  0,163},  {  0,165},  {  0,169},
-  {  0,171},  {  0,175},  {  0,177},  {  0,181},  {  0,183},  {  0,187},  {  0,189},  {  0,193},
-  {  0,197},  {  0,199},  {  0,203},  {  0,205},  {  0,209},  {  0,211},  {  0,215},  {  0,217},
-  {  0,221},  {  0,223},  {  0,227},  {  0,229},  {  0,233},  {  0,235},  {  0,239},  {  0,241},
-  {  0,245},  {  0,247},  {  0,251},  {  0,253},  {  2,253},  {  2,255},  {  4,255},  {  6,253},
-  {  8,253},  {  8,255},  { 10,255},  { 12,253},  { 14,253},  { 14,255},  { 16,255},  { 18,253},
-  { 20,253},  { 20,255},  { 22,255},  { 24,253},  { 26,253},  { 26,255},  { 28,255},  { 30,253},
-  { 32,253},  { 32,255},  { 34,255},  { 36,253},  { 38,253},  { 38,255},  { 40,255},  { 42,253},
-  { 44,253},  { 44,255},  { 46,255},  { 48,253},  { 50,253},  { 50,255},  { 52,255},  { 54,253},
-  { 56,253},  { 56,255},  { 58,255},  { 60,253},  { 62,251},  { 62,255},  { 64,253},  { 66,253},
-  { 66,255},  { 68,255},  { 70,253},  { 72,253},  { 72,255},  { 74,255},  { 76,253},  { 78,253},
-  { 78,255},  { 80,255},  { 82,253},  { 84,253},  { 84,255},  { 86,255},  { 88,253},  { 90,253},
-  { 90,255},  { 92,255},  { 94,253},  { 96,253},  { 96,255},  { 98,255},  {100,253},  {102,253},
-  {102,255},  {104,255},  {106,253},  {108,253},  {108,255},  {110,255},  {112,253},  {114,253},
-  {114,255},  {116,255},  {118,253},  {120,253},  {120,255},  {122,255},  {124,253},  {126,251},
-  {126,255},  {129,251},  {129,255},  {131,253},  {133,253},  {133,255},  {135,255},  {137,253},
-  {139,253},  {139,255},  {141,255},  {143,253},  {145,253},  {145,255},  {147,255},  {149,253},
-  {151,253},  {151,255},  {153,255},  {155,253},  {157,253},  {157,255},  {159,255},  {161,253},
-  {163,253},  {163,255},  {165,255},  {167,253},  {169,253},  {169,255},  {171,255},  {173,253},
-  {175,253},  {175,255},  {177,255},  {179,253},  {181,253},  {181,255},  {183,255},  {185,253},
-  {187,251},  {187,255},  {189,253},  {191,253},  {191,255},  {193,255},  {195,253},  {197,253},
-  {197,255},  {199,255},  {201,253},  {203,253},  {203,255},  {205,255},  {207,253},  {209,253},
-  {209,255},  {211,255},  {213,253},  {215,253},  {215,255},  {217,255},  {219,253},  {221,253},
-  {221,255},  {223,255},  {225,253},  {227,253},  {227,255},  {229,255},  {231,253},  {233,253},
-  {233,255},  {235,255},  {237,253},  {239,253},  {239,255},  {241,255},  {243,253},  {245,253},
-  {245,255},  {247,255},  {249,253},  {251,251},  {251,255},  {253,253},  {255,253},  {255,255}
+  SPL(  0,  0),  SPL(  0,  4),  SPL(  0,  8),  SPL(  0, 10),  SPL(  0, 14),  SPL(  0, 16),  SPL(  0, 20),  SPL(  0, 22),
+  SPL(  0, 26),  SPL(  0, 28),  SPL(  0, 32),  SPL(  0, 34),  SPL(  0, 38),  SPL(  0, 40),  SPL(  0, 44),  SPL(  0, 46),
+  SPL(  0, 50),  SPL(  0, 52),  SPL(  0, 56),  SPL(  0, 58),  SPL(  0, 62),  SPL(  0, 64),  SPL(  0, 68),  SPL(  0, 72),
+  SPL(  0, 74),  SPL(  0, 78),  SPL(  0, 80),  SPL(  0, 84),  SPL(  0, 86),  SPL(  0, 90),  SPL(  0, 92),  SPL(  0, 96),
+  SPL(  0, 98),  SPL(  0,102),  SPL(  0,104),  SPL(  0,108),  SPL(  0,110),  SPL(  0,114),  SPL(  0,116),  SPL(  0,120),
+  SPL(  0,122),  SPL(  0,126),  SPL(  0,129),  SPL(  0,133),  SPL(  0,135),  SPL(  0,139),  SPL(  0,141),  SPL(  0,145),
+  SPL(  0,147),  SPL(  0,151),  SPL(  0,153),  SPL(  0,157),  SPL(  0,159),  SPL(  0,163),  SPL(  0,165),  SPL(  0,169),
+  SPL(  0,171),  SPL(  0,175),  SPL(  0,177),  SPL(  0,181),  SPL(  0,183),  SPL(  0,187),  SPL(  0,189),  SPL(  0,193),
+  SPL(  0,197),  SPL(  0,199),  SPL(  0,203),  SPL(  0,205),  SPL(  0,209),  SPL(  0,211),  SPL(  0,215),  SPL(  0,217),
+  SPL(  0,221),  SPL(  0,223),  SPL(  0,227),  SPL(  0,229),  SPL(  0,233),  SPL(  0,235),  SPL(  0,239),  SPL(  0,241),
+  SPL(  0,245),  SPL(  0,247),  SPL(  0,251),  SPL(  0,253),  SPL(  2,253),  SPL(  2,255),  SPL(  4,255),  SPL(  6,253),
+  SPL(  8,253),  SPL(  8,255),  SPL( 10,255),  SPL( 12,253),  SPL( 14,253),  SPL( 14,255),  SPL( 16,255),  SPL( 18,253),
+  SPL( 20,253),  SPL( 20,255),  SPL( 22,255),  SPL( 24,253),  SPL( 26,253),  SPL( 26,255),  SPL( 28,255),  SPL( 30,253),
+  SPL( 32,253),  SPL( 32,255),  SPL( 34,255),  SPL( 36,253),  SPL( 38,253),  SPL( 38,255),  SPL( 40,255),  SPL( 42,253),
+  SPL( 44,253),  SPL( 44,255),  SPL( 46,255),  SPL( 48,253),  SPL( 50,253),  SPL( 50,255),  SPL( 52,255),  SPL( 54,253),
+  SPL( 56,253),  SPL( 56,255),  SPL( 58,255),  SPL( 60,253),  SPL( 62,251),  SPL( 62,255),  SPL( 64,253),  SPL( 66,253),
+  SPL( 66,255),  SPL( 68,255),  SPL( 70,253),  SPL( 72,253),  SPL( 72,255),  SPL( 74,255),  SPL( 76,253),  SPL( 78,253),
+  SPL( 78,255),  SPL( 80,255),  SPL( 82,253),  SPL( 84,253),  SPL( 84,255),  SPL( 86,255),  SPL( 88,253),  SPL( 90,253),
+  SPL( 90,255),  SPL( 92,255),  SPL( 94,253),  SPL( 96,253),  SPL( 96,255),  SPL( 98,255),  SPL(100,253),  SPL(102,253),
+  SPL(102,255),  SPL(104,255),  SPL(106,253),  SPL(108,253),  SPL(108,255),  SPL(110,255),  SPL(112,253),  SPL(114,253),
+  SPL(114,255),  SPL(116,255),  SPL(118,253),  SPL(120,253),  SPL(120,255),  SPL(122,255),  SPL(124,253),  SPL(126,251),
+  SPL(126,255),  SPL(129,251),  SPL(129,255),  SPL(131,253),  SPL(133,253),  SPL(133,255),  SPL(135,255),  SPL(137,253),
+  SPL(139,253),  SPL(139,255),  SPL(141,255),  SPL(143,253),  SPL(145,253),  SPL(145,255),  SPL(147,255),  SPL(149,253),
+  SPL(151,253),  SPL(151,255),  SPL(153,255),  SPL(155,253),  SPL(157,253),  SPL(157,255),  SPL(159,255),  SPL(161,253),
+  SPL(163,253),  SPL(163,255),  SPL(165,255),  SPL(167,253),  SPL(169,253),  SPL(169,255),  SPL(171,255),  SPL(173,253),
+  SPL(175,253),  SPL(175,255),  SPL(177,255),  SPL(179,253),  SPL(181,253),  SPL(181,255),  SPL(183,255),  SPL(185,253),
+  SPL(187,251),  SPL(187,255),  SPL(189,253),  SPL(191,253),  SPL(191,255),  SPL(193,255),  SPL(195,253),  SPL(197,253),
+  SPL(197,255),  SPL(199,255),  SPL(201,253),  SPL(203,253),  SPL(203,255),  SPL(205,255),  SPL(207,253),  SPL(209,253),
+  SPL(209,255),  SPL(211,255),  SPL(213,253),  SPL(215,253),  SPL(215,255),  SPL(217,255),  SPL(219,253),  SPL(221,253),
+  SPL(221,255),  SPL(223,255),  SPL(225,253),  SPL(227,253),  SPL(227,255),  SPL(229,255),  SPL(231,253),  SPL(233,253),
+  SPL(233,255),  SPL(235,255),  SPL(237,253),  SPL(239,253),  SPL(239,255),  SPL(241,255),  SPL(243,253),  SPL(245,253),
+  SPL(245,255),  SPL(247,255),  SPL(249,253),  SPL(251,251),  SPL(251,255),  SPL(253,253),  SPL(255,253),  SPL(255,255)
 };
 
 /* 256 * 2 * 1 = 512 */
 static PaletteSingleLookup2 const sp_lookup_8_4[256] =
 {
-  {  0,  0},  {  0,  4},  {  0,  7},  {  0, 10},  {  0, 13},  {  0, 16},  {  0, 19},  {  0, 22},
-  {  0, 25},  {  0, 28},  {  0, 31},  {  0, 34},  {  0, 37},  {  0, 40},  {  0, 43},  {  0, 46},
-  {  0, 49},  {  0, 52},  {  0, 55},  {  0, 58},  {  0, 61},  {  0, 64},  {  0, 68},  {  0, 71},
-  {  0, 74},  {  0, 77},  {  0, 80},  {  0, 83},  {  0, 86},  {  0, 89},  {  0, 92},  {  0, 95},
-  {  0, 98},  {  0,101},  {  0,104},  {  0,107},  {  0,110},  {  0,113},  {  0,116},  {  0,119},
-  {  0,122},  {  0,125},  {  0,128},  {  0,132},  {  0,135},  {  0,138},  {  0,141},  {  0,144},
-  {  0,147},  {  0,150},  {  0,153},  {  0,156},  {  0,159},  {  0,162},  {  0,165},  {  0,168},
-  {  0,171},  {  0,174},  {  0,177},  {  0,180},  {  0,183},  {  0,186},  {  0,189},  {  0,192},
-  {  0,196},  {  0,199},  {  0,202},  {  0,205},  {  0,208},  {  0,211},  {  0,214},  {  0,217},
-  {  0,220},  {  0,223},  {  0,226},  {  0,229},  {  0,232},  {  0,235},  {  0,238},  {  0,241},
-  {  0,244},  {  0,247},  {  0,250},  {  0,253},  {  1,254},  {  2,255},  {  4,254},  {  5,255},
-  {  7,254},  {  8,255},  { 10,254},  { 11,255},  { 13,254},  { 14,255},  { 16,254},  { 17,255},
-  { 19,254},  { 20,255},  { 22,254},  { 23,255},  { 25,254},  { 26,255},  { 28,254},  { 29,255},
-  { 31,254},  { 32,255},  { 34,254},  { 35,255},  { 37,254},  { 38,255},  { 40,254},  { 41,255},
-  { 43,254},  { 44,255},  { 46,254},  { 47,255},  { 49,254},  { 50,255},  { 52,254},  { 53,255},
-  { 55,254},  { 56,255},  { 58,254},  { 59,255},  { 61,253},  { 62,254},  { 63,255},  { 65,254},
-  { 66,255},  { 68,254},  { 69,255},  { 71,254},  { 72,255},  { 74,254},  { 75,255},  { 77,254},
-  { 78,255},  { 80,254},  { 81,255},  { 83,254},  { 84,255},  { 86,254},  { 87,255},  { 89,254},
-  { 90,255},  { 92,254},  { 93,255},  { 95,254},  { 96,255},  { 98,254},  { 99,255},  {101,254},
-  {102,255},  {104,254},  {105,255},  {107,254},  {108,255},  {110,254},  {111,255},  {113,254},
-  {114,255},  {116,254},  {117,255},  {119,254},  {120,255},  {122,254},  {123,255},  {125,253},
-  {126,254},  {127,255},  {129,254},  {130,255},  {132,254},  {133,255},  {135,254},  {136,255},
-  {138,254},  {139,255},  {141,254},  {142,255},  {144,254},  {145,255},  {147,254},  {148,255},
-  {150,254},  {151,255},  {153,254},  {154,255},  {156,254},  {157,255},  {159,254},  {160,255},
-  {162,254},  {163,255},  {165,254},  {166,255},  {168,254},  {169,255},  {171,254},  {172,255},
-  {174,254},  {175,255},  {177,254},  {178,255},  {180,254},  {181,255},  {183,254},  {184,255},
-  {186,254},  {187,255},  {189,253},  {190,254},  {191,255},  {193,254},  {194,255},  {196,254},
-  {197,255},  {199,254},  {200,255},  {202,254},  {203,255},  {205,254},  {206,255},  {208,254},
-  {209,255},  {211,254},  {212,255},  {214,254},  {215,255},  {217,254},  {218,255},  {220,254},
-  {221,255},  {223,254},  {224,255},  {226,254},  {227,255},  {229,254},  {230,255},  {232,254},
-  {233,255},  {235,254},  {236,255},  {238,254},  {239,255},  {241,254},  {242,255},  {244,254},
-  {245,255},  {247,254},  {248,255},  {250,254},  {251,255},  {253,253},  {254,254},  {255,255}
+  SPL(  0,  0),  SPL(  0,  4),  SPL(  0,  7),  SPL(  0, 10),  SPL(  0, 13),  SPL(  0, 16),  SPL(  0, 19),  SPL(  0, 22),
+  SPL(  0, 25),  SPL(  0, 28),  SPL(  0, 31),  SPL(  0, 34),  SPL(  0, 37),  SPL(  0, 40),  SPL(  0, 43),  SPL(  0, 46),
+  SPL(  0, 49),  SPL(  0, 52),  SPL(  0, 55),  SPL(  0, 58),  SPL(  0, 61),  SPL(  0, 64),  SPL(  0, 68),  SPL(  0, 71),
+  SPL(  0, 74),  SPL(  0, 77),  SPL(  0, 80),  SPL(  0, 83),  SPL(  0, 86),  SPL(  0, 89),  SPL(  0, 92),  SPL(  0, 95),
+  SPL(  0, 98),  SPL(  0,101),  SPL(  0,104),  SPL(  0,107),  SPL(  0,110),  SPL(  0,113),  SPL(  0,116),  SPL(  0,119),
+  SPL(  0,122),  SPL(  0,125),  SPL(  0,128),  SPL(  0,132),  SPL(  0,135),  SPL(  0,138),  SPL(  0,141),  SPL(  0,144),
+  SPL(  0,147),  SPL(  0,150),  SPL(  0,153),  SPL(  0,156),  SPL(  0,159),  SPL(  0,162),  SPL(  0,165),  SPL(  0,168),
+  SPL(  0,171),  SPL(  0,174),  SPL(  0,177),  SPL(  0,180),  SPL(  0,183),  SPL(  0,186),  SPL(  0,189),  SPL(  0,192),
+  SPL(  0,196),  SPL(  0,199),  SPL(  0,202),  SPL(  0,205),  SPL(  0,208),  SPL(  0,211),  SPL(  0,214),  SPL(  0,217),
+  SPL(  0,220),  SPL(  0,223),  SPL(  0,226),  SPL(  0,229),  SPL(  0,232),  SPL(  0,235),  SPL(  0,238),  SPL(  0,241),
+  SPL(  0,244),  SPL(  0,247),  SPL(  0,250),  SPL(  0,253),  SPL(  1,254),  SPL(  2,255),  SPL(  4,254),  SPL(  5,255),
+  SPL(  7,254),  SPL(  8,255),  SPL( 10,254),  SPL( 11,255),  SPL( 13,254),  SPL( 14,255),  SPL( 16,254),  SPL( 17,255),
+  SPL( 19,254),  SPL( 20,255),  SPL( 22,254),  SPL( 23,255),  SPL( 25,254),  SPL( 26,255),  SPL( 28,254),  SPL( 29,255),
+  SPL( 31,254),  SPL( 32,255),  SPL( 34,254),  SPL( 35,255),  SPL( 37,254),  SPL( 38,255),  SPL( 40,254),  SPL( 41,255),
+  SPL( 43,254),  SPL( 44,255),  SPL( 46,254),  SPL( 47,255),  SPL( 49,254),  SPL( 50,255),  SPL( 52,254),  SPL( 53,255),
+  SPL( 55,254),  SPL( 56,255),  SPL( 58,254),  SPL( 59,255),  SPL( 61,253),  SPL( 62,254),  SPL( 63,255),  SPL( 65,254),
+  SPL( 66,255),  SPL( 68,254),  SPL( 69,255),  SPL( 71,254),  SPL( 72,255),  SPL( 74,254),  SPL( 75,255),  SPL( 77,254),
+  SPL( 78,255),  SPL( 80,254),  SPL( 81,255),  SPL( 83,254),  SPL( 84,255),  SPL( 86,254),  SPL( 87,255),  SPL( 89,254),
+  SPL( 90,255),  SPL( 92,254),  SPL( 93,255),  SPL( 95,254),  SPL( 96,255),  SPL( 98,254),  SPL( 99,255),  SPL(101,254),
+  SPL(102,255),  SPL(104,254),  SPL(105,255),  SPL(107,254),  SPL(108,255),  SPL(110,254),  SPL(111,255),  SPL(113,254),
+  SPL(114,255),  SPL(116,254),  SPL(117,255),  SPL(119,254),  SPL(120,255),  SPL(122,254),  SPL(123,255),  SPL(125,253),
+  SPL(126,254),  SPL(127,255),  SPL(129,254),  SPL(130,255),  SPL(132,254),  SPL(133,255),  SPL(135,254),  SPL(136,255),
+  SPL(138,254),  SPL(139,255),  SPL(141,254),  SPL(142,255),  SPL(144,254),  SPL(145,255),  SPL(147,254),  SPL(148,255),
+  SPL(150,254),  SPL(151,255),  SPL(153,254),  SPL(154,255),  SPL(156,254),  SPL(157,255),  SPL(159,254),  SPL(160,255),
+  SPL(162,254),  SPL(163,255),  SPL(165,254),  SPL(166,255),  SPL(168,254),  SPL(169,255),  SPL(171,254),  SPL(172,255),
+  SPL(174,254),  SPL(175,255),  SPL(177,254),  SPL(178,255),  SPL(180,254),  SPL(181,255),  SPL(183,254),  SPL(184,255),
+  SPL(186,254),  SPL(187,255),  SPL(189,253),  SPL(190,254),  SPL(191,255),  SPL(193,254),  SPL(194,255),  SPL(196,254),
+  SPL(197,255),  SPL(199,254),  SPL(200,255),  SPL(202,254),  SPL(203,255),  SPL(205,254),  SPL(206,255),  SPL(208,254),
+  SPL(209,255),  SPL(211,254),  SPL(212,255),  SPL(214,254),  SPL(215,255),  SPL(217,254),  SPL(218,255),  SPL(220,254),
+  SPL(221,255),  SPL(223,254),  SPL(224,255),  SPL(226,254),  SPL(227,255),  SPL(229,254),  SPL(230,255),  SPL(232,254),
+  SPL(233,255),  SPL(235,254),  SPL(236,255),  SPL(238,254),  SPL(239,255),  SPL(241,254),  SPL(242,255),  SPL(244,254),
+  SPL(245,255),  SPL(247,254),  SPL(248,255),  SPL(250,254),  SPL(251,255),  SPL(253,253),  SPL(254,254),  SPL(255,255)
 };
 
 /* 256 * 2 * 1 = 512 */
 static PaletteSingleLookup4 const sp_lookup_5_8[256] =
 {
-  {  0,  0},  {  0,  8},  {  0, 16},  {  0, 24},  {  0, 33},  {  0, 41},  {  0, 49},  {  0, 49},
-  {  0, 57},  {  0, 66},  {  0, 74},  {  0, 82},  {  0, 90},  {  0, 99},  {  8, 57},  {  0,107},
-  {  0,115},  {  0,123},  {  0,132},  {  0,140},  {  0,148},  {  0,156},  { 24, 16},  {  0,165},
-  {  0,173},  {  0,181},  {  0,189},  {  0,198},  {  0,206},  { 16,115},  {  0,214},  {  0,222},
-  {  0,231},  {  0,239},  {  0,247},  {  0,255},  {  8,214},  { 24,123},  {  8,222},  {  8,231},
-  {  8,239},  {  8,247},  {  8,255},  { 16,214},  { 16,222},  { 33,123},  { 16,231},  { 16,239},
-  { 16,247},  { 16,255},  { 24,214},  { 24,222},  { 33,173},  { 24,231},  { 24,239},  { 24,247},
-  { 24,255},  { 33,206},  { 33,214},  { 33,222},  { 33,231},  { 33,239},  { 49,148},  { 33,247},
-  { 33,255},  { 41,214},  { 41,222},  { 41,231},  { 41,239},  { 41,247},  { 57,156},  { 41,255},
-  { 49,214},  { 49,222},  { 49,231},  { 49,239},  { 49,247},  { 49,255},  { 66,156},  { 57,214},
-  { 57,222},  { 57,231},  { 57,239},  { 57,247},  { 57,255},  { 66,206},  { 66,214},  { 66,222},
-  { 90, 82},  { 66,231},  { 66,239},  { 66,247},  { 66,255},  { 74,214},  { 74,222},  { 82,181},
-  { 74,231},  { 74,239},  { 74,247},  { 74,255},  { 82,214},  { 82,222},  { 82,231},  { 90,189},
-  { 82,239},  { 82,247},  { 82,255},  { 90,214},  { 90,222},  { 90,231},  { 90,239},  { 99,189},
-  { 90,247},  { 90,255},  { 99,206},  { 99,214},  { 99,222},  { 99,231},  { 99,239},  { 99,247},
-  { 99,255},  {123,115},  {107,214},  {107,222},  {107,231},  {107,239},  {107,247},  {107,255},
-  {115,214},  {132,115},  {115,222},  {115,231},  {115,239},  {115,247},  {115,255},  {123,214},
-  {123,222},  {132,173},  {123,231},  {123,239},  {123,247},  {123,255},  {132,206},  {132,214},
-  {132,222},  {132,231},  {140,189},  {132,239},  {132,247},  {132,255},  {140,214},  {140,222},
-  {140,231},  {140,239},  {156,148},  {140,247},  {140,255},  {148,214},  {148,222},  {148,231},
-  {148,239},  {148,247},  {165,148},  {148,255},  {156,214},  {156,222},  {156,231},  {156,239},
-  {156,247},  {156,255},  {165,206},  {165,214},  {181,123},  {165,222},  {165,231},  {165,239},
-  {165,247},  {165,255},  {173,214},  {173,222},  {189,132},  {173,231},  {173,239},  {173,247},
-  {173,255},  {181,214},  {181,222},  {189,181},  {181,231},  {181,239},  {181,247},  {181,255},
-  {189,214},  {189,222},  {189,231},  {198,181},  {189,239},  {189,247},  {189,255},  {198,206},
-  {198,214},  {198,222},  {198,231},  {198,239},  {198,247},  {214,156},  {198,255},  {206,214},
-  {206,222},  {206,231},  {206,239},  {206,247},  {206,255},  {222,165},  {214,214},  {214,222},
-  {214,231},  {214,239},  {214,247},  {214,255},  {222,214},  {231,165},  {222,222},  {222,231},
-  {222,239},  {222,247},  {222,255},  {231,206},  {231,214},  {231,222},  {239,181},  {231,231},
-  {231,239},  {231,247},  {231,255},  {239,214},  {239,222},  {239,231},  {247,189},  {239,239},
-  {239,247},  {239,255},  {247,214},  {247,222},  {247,231},  {247,239},  {255,198},  {247,247},
-  {247,255},  {255,214},  {255,222},  {255,231},  {255,239},  {255,247},  {255,255},  {255,255}
+  SPL(  0,  0),  SPL(  0,  8),  SPL(  0, 16),  SPL(  0, 24),  SPL(  0, 33),  SPL(  0, 41),  SPL(  0, 49),  SPL(  0, 49),
+  SPL(  0, 57),  SPL(  0, 66),  SPL(  0, 74),  SPL(  0, 82),  SPL(  0, 90),  SPL(  0, 99),  SPL(  8, 57),  SPL(  0,107),
+  SPL(  0,115),  SPL(  0,123),  SPL(  0,132),  SPL(  0,140),  SPL(  0,148),  SPL(  0,156),  SPL( 24, 16),  SPL(  0,165),
+  SPL(  0,173),  SPL(  0,181),  SPL(  0,189),  SPL(  0,198),  SPL(  0,206),  SPL( 16,115),  SPL(  0,214),  SPL(  0,222),
+  SPL(  0,231),  SPL(  0,239),  SPL(  0,247),  SPL(  0,255),  SPL(  8,214),  SPL( 24,123),  SPL(  8,222),  SPL(  8,231),
+  SPL(  8,239),  SPL(  8,247),  SPL(  8,255),  SPL( 16,214),  SPL( 16,222),  SPL( 33,123),  SPL( 16,231),  SPL( 16,239),
+  SPL( 16,247),  SPL( 16,255),  SPL( 24,214),  SPL( 24,222),  SPL( 33,173),  SPL( 24,231),  SPL( 24,239),  SPL( 24,247),
+  SPL( 24,255),  SPL( 33,206),  SPL( 33,214),  SPL( 33,222),  SPL( 33,231),  SPL( 33,239),  SPL( 49,148),  SPL( 33,247),
+  SPL( 33,255),  SPL( 41,214),  SPL( 41,222),  SPL( 41,231),  SPL( 41,239),  SPL( 41,247),  SPL( 57,156),  SPL( 41,255),
+  SPL( 49,214),  SPL( 49,222),  SPL( 49,231),  SPL( 49,239),  SPL( 49,247),  SPL( 49,255),  SPL( 66,156),  SPL( 57,214),
+  SPL( 57,222),  SPL( 57,231),  SPL( 57,239),  SPL( 57,247),  SPL( 57,255),  SPL( 66,206),  SPL( 66,214),  SPL( 66,222),
+  SPL( 90, 82),  SPL( 66,231),  SPL( 66,239),  SPL( 66,247),  SPL( 66,255),  SPL( 74,214),  SPL( 74,222),  SPL( 82,181),
+  SPL( 74,231),  SPL( 74,239),  SPL( 74,247),  SPL( 74,255),  SPL( 82,214),  SPL( 82,222),  SPL( 82,231),  SPL( 90,189),
+  SPL( 82,239),  SPL( 82,247),  SPL( 82,255),  SPL( 90,214),  SPL( 90,222),  SPL( 90,231),  SPL( 90,239),  SPL( 99,189),
+  SPL( 90,247),  SPL( 90,255),  SPL( 99,206),  SPL( 99,214),  SPL( 99,222),  SPL( 99,231),  SPL( 99,239),  SPL( 99,247),
+  SPL( 99,255),  SPL(123,115),  SPL(107,214),  SPL(107,222),  SPL(107,231),  SPL(107,239),  SPL(107,247),  SPL(107,255),
+  SPL(115,214),  SPL(132,115),  SPL(115,222),  SPL(115,231),  SPL(115,239),  SPL(115,247),  SPL(115,255),  SPL(123,214),
+  SPL(123,222),  SPL(132,173),  SPL(123,231),  SPL(123,239),  SPL(123,247),  SPL(123,255),  SPL(132,206),  SPL(132,214),
+  SPL(132,222),  SPL(132,231),  SPL(140,189),  SPL(132,239),  SPL(132,247),  SPL(132,255),  SPL(140,214),  SPL(140,222),
+  SPL(140,231),  SPL(140,239),  SPL(156,148),  SPL(140,247),  SPL(140,255),  SPL(148,214),  SPL(148,222),  SPL(148,231),
+  SPL(148,239),  SPL(148,247),  SPL(165,148),  SPL(148,255),  SPL(156,214),  SPL(156,222),  SPL(156,231),  SPL(156,239),
+  SPL(156,247),  SPL(156,255),  SPL(165,206),  SPL(165,214),  SPL(181,123),  SPL(165,222),  SPL(165,231),  SPL(165,239),
+  SPL(165,247),  SPL(165,255),  SPL(173,214),  SPL(173,222),  SPL(189,132),  SPL(173,231),  SPL(173,239),  SPL(173,247),
+  SPL(173,255),  SPL(181,214),  SPL(181,222),  SPL(189,181),  SPL(181,231),  SPL(181,239),  SPL(181,247),  SPL(181,255),
+  SPL(189,214),  SPL(189,222),  SPL(189,231),  SPL(198,181),  SPL(189,239),  SPL(189,247),  SPL(189,255),  SPL(198,206),
+  SPL(198,214),  SPL(198,222),  SPL(198,231),  SPL(198,239),  SPL(198,247),  SPL(214,156),  SPL(198,255),  SPL(206,214),
+  SPL(206,222),  SPL(206,231),  SPL(206,239),  SPL(206,247),  SPL(206,255),  SPL(222,165),  SPL(214,214),  SPL(214,222),
+  SPL(214,231),  SPL(214,239),  SPL(214,247),  SPL(214,255),  SPL(222,214),  SPL(231,165),  SPL(222,222),  SPL(222,231),
+  SPL(222,239),  SPL(222,247),  SPL(222,255),  SPL(231,206),  SPL(231,214),  SPL(231,222),  SPL(239,181),  SPL(231,231),
+  SPL(231,239),  SPL(231,247),  SPL(231,255),  SPL(239,214),  SPL(239,222),  SPL(239,231),  SPL(247,189),  SPL(239,239),
+  SPL(239,247),  SPL(239,255),  SPL(247,214),  SPL(247,222),  SPL(247,231),  SPL(247,239),  SPL(255,198),  SPL(247,247),
+  SPL(247,255),  SPL(255,214),  SPL(255,222),  SPL(255,231),  SPL(255,239),  SPL(255,247),  SPL(255,255),  SPL(255,255)
 };
 
 /* 256 * 2 * 1 = 512 */
 static PaletteSingleLookup4 const sp_lookup_6_8[256] =
 {
-  {  0,  0},  {  0,  8},  {  0, 16},  {  0, 24},  {  0, 32},  {  0, 36},  {  0, 44},  {  0, 52},
-  {  0, 60},  {  0, 65},  {  0, 73},  {  0, 81},  {  0, 89},  {  0, 93},  {  0,101},  {  0,109},
-  {  0,117},  {  0,121},  {  0,130},  {  0,138},  {  0,146},  {  0,150},  {  0,158},  {  0,166},
-  {  0,174},  {  0,178},  {  0,186},  {  0,195},  {  0,203},  {  0,207},  {  0,215},  {  0,223},
-  {  0,231},  {  0,235},  {  0,243},  {  0,251},  {  4,235},  {  4,239},  {  4,247},  {  4,255},
-  {  8,239},  {  8,243},  {  8,251},  { 12,235},  { 12,243},  { 12,247},  { 12,255},  { 16,239},
-  { 16,247},  { 16,251},  { 20,235},  { 20,243},  { 20,251},  { 20,255},  { 24,239},  { 24,247},
-  { 24,255},  { 28,235},  { 28,243},  { 28,251},  { 32,235},  { 32,239},  { 32,247},  { 32,255},
-  { 36,239},  { 36,243},  { 36,251},  { 40,235},  { 40,243},  { 40,247},  { 40,255},  { 44,239},
-  { 44,247},  { 44,251},  { 48,235},  { 48,243},  { 48,251},  { 48,255},  { 52,239},  { 52,247},
-  { 52,255},  { 56,235},  { 56,243},  { 56,251},  { 60,231},  { 60,239},  { 60,247},  { 60,255},
-  { 65,231},  { 65,239},  { 65,243},  { 65,251},  { 69,235},  { 69,243},  { 69,247},  { 69,255},
-  { 73,239},  { 73,247},  { 73,251},  { 77,235},  { 77,243},  { 77,251},  { 77,255},  { 81,239},
-  { 81,247},  { 81,255},  { 85,235},  { 85,243},  { 85,251},  { 89,235},  { 89,239},  { 89,247},
-  { 89,255},  { 93,239},  { 93,243},  { 93,251},  { 97,235},  { 97,243},  { 97,247},  { 97,255},
-  {101,239},  {101,247},  {101,251},  {105,235},  {105,243},  {105,251},  {105,255},  {109,239},
-  {109,247},  {109,255},  {113,235},  {113,243},  {113,251},  {117,231},  {117,239},  {117,247},
-  {117,255},  {121,235},  {121,243},  {121,251},  {125,235},  {125,239},  {125,247},  {125,255},
-  {130,231},  {130,239},  {130,247},  {130,251},  {134,235},  {134,243},  {134,251},  {134,255},
-  {138,239},  {138,247},  {138,255},  {142,235},  {142,243},  {142,251},  {146,235},  {146,239},
-  {146,247},  {146,255},  {150,239},  {150,243},  {150,251},  {154,235},  {154,243},  {154,247},
-  {154,255},  {158,239},  {158,247},  {158,251},  {162,235},  {162,243},  {162,251},  {162,255},
-  {166,239},  {166,247},  {166,255},  {170,235},  {170,243},  {170,251},  {174,231},  {174,239},
-  {174,247},  {174,255},  {178,235},  {178,243},  {178,251},  {182,235},  {182,239},  {182,247},
-  {182,255},  {186,239},  {186,243},  {186,251},  {190,235},  {190,243},  {190,247},  {190,255},
-  {195,231},  {195,239},  {195,247},  {195,255},  {199,235},  {199,243},  {199,251},  {203,235},
-  {203,239},  {203,247},  {203,255},  {207,239},  {207,243},  {207,251},  {211,235},  {211,243},
-  {211,247},  {211,255},  {215,239},  {215,247},  {215,251},  {219,235},  {219,243},  {219,251},
-  {219,255},  {223,239},  {223,247},  {223,255},  {227,235},  {227,243},  {227,251},  {231,231},
-  {231,239},  {231,247},  {231,255},  {235,235},  {235,243},  {235,251},  {239,235},  {239,239},
-  {239,247},  {239,255},  {243,239},  {243,243},  {243,251},  {247,239},  {247,243},  {247,247},
-  {247,255},  {251,243},  {251,247},  {251,251},  {255,239},  {255,247},  {255,251},  {255,255}
+  SPL(  0,  0),  SPL(  0,  8),  SPL(  0, 16),  SPL(  0, 24),  SPL(  0, 32),  SPL(  0, 36),  SPL(  0, 44),  SPL(  0, 52),
+  SPL(  0, 60),  SPL(  0, 65),  SPL(  0, 73),  SPL(  0, 81),  SPL(  0, 89),  SPL(  0, 93),  SPL(  0,101),  SPL(  0,109),
+  SPL(  0,117),  SPL(  0,121),  SPL(  0,130),  SPL(  0,138),  SPL(  0,146),  SPL(  0,150),  SPL(  0,158),  SPL(  0,166),
+  SPL(  0,174),  SPL(  0,178),  SPL(  0,186),  SPL(  0,195),  SPL(  0,203),  SPL(  0,207),  SPL(  0,215),  SPL(  0,223),
+  SPL(  0,231),  SPL(  0,235),  SPL(  0,243),  SPL(  0,251),  SPL(  4,235),  SPL(  4,239),  SPL(  4,247),  SPL(  4,255),
+  SPL(  8,239),  SPL(  8,243),  SPL(  8,251),  SPL( 12,235),  SPL( 12,243),  SPL( 12,247),  SPL( 12,255),  SPL( 16,239),
+  SPL( 16,247),  SPL( 16,251),  SPL( 20,235),  SPL( 20,243),  SPL( 20,251),  SPL( 20,255),  SPL( 24,239),  SPL( 24,247),
+  SPL( 24,255),  SPL( 28,235),  SPL( 28,243),  SPL( 28,251),  SPL( 32,235),  SPL( 32,239),  SPL( 32,247),  SPL( 32,255),
+  SPL( 36,239),  SPL( 36,243),  SPL( 36,251),  SPL( 40,235),  SPL( 40,243),  SPL( 40,247),  SPL( 40,255),  SPL( 44,239),
+  SPL( 44,247),  SPL( 44,251),  SPL( 48,235),  SPL( 48,243),  SPL( 48,251),  SPL( 48,255),  SPL( 52,239),  SPL( 52,247),
+  SPL( 52,255),  SPL( 56,235),  SPL( 56,243),  SPL( 56,251),  SPL( 60,231),  SPL( 60,239),  SPL( 60,247),  SPL( 60,255),
+  SPL( 65,231),  SPL( 65,239),  SPL( 65,243),  SPL( 65,251),  SPL( 69,235),  SPL( 69,243),  SPL( 69,247),  SPL( 69,255),
+  SPL( 73,239),  SPL( 73,247),  SPL( 73,251),  SPL( 77,235),  SPL( 77,243),  SPL( 77,251),  SPL( 77,255),  SPL( 81,239),
+  SPL( 81,247),  SPL( 81,255),  SPL( 85,235),  SPL( 85,243),  SPL( 85,251),  SPL( 89,235),  SPL( 89,239),  SPL( 89,247),
+  SPL( 89,255),  SPL( 93,239),  SPL( 93,243),  SPL( 93,251),  SPL( 97,235),  SPL( 97,243),  SPL( 97,247),  SPL( 97,255),
+  SPL(101,239),  SPL(101,247),  SPL(101,251),  SPL(105,235),  SPL(105,243),  SPL(105,251),  SPL(105,255),  SPL(109,239),
+  SPL(109,247),  SPL(109,255),  SPL(113,235),  SPL(113,243),  SPL(113,251),  SPL(117,231),  SPL(117,239),  SPL(117,247),
+  SPL(117,255),  SPL(121,235),  SPL(121,243),  SPL(121,251),  SPL(125,235),  SPL(125,239),  SPL(125,247),  SPL(125,255),
+  SPL(130,231),  SPL(130,239),  SPL(130,247),  SPL(130,251),  SPL(134,235),  SPL(134,243),  SPL(134,251),  SPL(134,255),
+  SPL(138,239),  SPL(138,247),  SPL(138,255),  SPL(142,235),  SPL(142,243),  SPL(142,251),  SPL(146,235),  SPL(146,239),
+  SPL(146,247),  SPL(146,255),  SPL(150,239),  SPL(150,243),  SPL(150,251),  SPL(154,235),  SPL(154,243),  SPL(154,247),
+  SPL(154,255),  SPL(158,239),  SPL(158,247),  SPL(158,251),  SPL(162,235),  SPL(162,243),  SPL(162,251),  SPL(162,255),
+  SPL(166,239),  SPL(166,247),  SPL(166,255),  SPL(170,235),  SPL(170,243),  SPL(170,251),  SPL(174,231),  SPL(174,239),
+  SPL(174,247),  SPL(174,255),  SPL(178,235),  SPL(178,243),  SPL(178,251),  SPL(182,235),  SPL(182,239),  SPL(182,247),
+  SPL(182,255),  SPL(186,239),  SPL(186,243),  SPL(186,251),  SPL(190,235),  SPL(190,243),  SPL(190,247),  SPL(190,255),
+  SPL(195,231),  SPL(195,239),  SPL(195,247),  SPL(195,255),  SPL(199,235),  SPL(199,243),  SPL(199,251),  SPL(203,235),
+  SPL(203,239),  SPL(203,247),  SPL(203,255),  SPL(207,239),  SPL(207,243),  SPL(207,251),  SPL(211,235),  SPL(211,243),
+  SPL(211,247),  SPL(211,255),  SPL(215,239),  SPL(215,247),  SPL(215,251),  SPL(219,235),  SPL(219,243),  SPL(219,251),
+  SPL(219,255),  SPL(223,239),  SPL(223,247),  SPL(223,255),  SPL(227,235),  SPL(227,243),  SPL(227,251),  SPL(231,231),
+  SPL(231,239),  SPL(231,247),  SPL(231,255),  SPL(235,235),  SPL(235,243),  SPL(235,251),  SPL(239,235),  SPL(239,239),
+  SPL(239,247),  SPL(239,255),  SPL(243,239),  SPL(243,243),  SPL(243,251),  SPL(247,239),  SPL(247,243),  SPL(247,247),
+  SPL(247,255),  SPL(251,243),  SPL(251,247),  SPL(251,251),  SPL(255,239),  SPL(255,247),  SPL(255,251),  SPL(255,255)
 };
 
 /* 256 * 2 * 1 = 512 */
 static PaletteSingleLookup4 const sp_lookup_7_8[256] =
 {
-  {  0,  0},  {  0,  8},  {  0, 16},  {  0, 22},  {  0, 30},  {  0, 36},  {  0, 44},  {  0, 50},
-  {  0, 58},  {  0, 64},  {  0, 72},  {  0, 80},  {  0, 86},  {  0, 94},  {  0,100},  {  0,108},
-  {  0,114},  {  0,122},  {  0,129},  {  0,137},  {  0,143},  {  0,151},  {  0,157},  {  0,165},
-  {  0,171},  {  0,179},  {  0,185},  {  0,193},  {  0,201},  {  0,207},  {  0,215},  {  0,221},
-  {  0,229},  {  0,235},  {  0,243},  {  0,249},  {  2,245},  {  2,251},  {  4,247},  {  4,253},
-  {  6,249},  {  6,255},  {  8,251},  { 10,245},  { 10,253},  { 12,247},  { 12,255},  { 14,249},
-  { 16,245},  { 16,251},  { 18,247},  { 18,253},  { 20,249},  { 20,255},  { 22,251},  { 24,245},
-  { 24,253},  { 26,247},  { 26,255},  { 28,249},  { 30,245},  { 30,251},  { 32,247},  { 32,253},
-  { 34,249},  { 34,255},  { 36,251},  { 38,245},  { 38,253},  { 40,247},  { 40,255},  { 42,249},
-  { 44,245},  { 44,251},  { 46,247},  { 46,253},  { 48,249},  { 48,255},  { 50,251},  { 52,245},
-  { 52,253},  { 54,247},  { 54,255},  { 56,249},  { 58,243},  { 58,251},  { 60,245},  { 60,253},
-  { 62,247},  { 62,255},  { 64,249},  { 66,245},  { 66,251},  { 68,247},  { 68,253},  { 70,249},
-  { 70,255},  { 72,251},  { 74,245},  { 74,253},  { 76,247},  { 76,255},  { 78,249},  { 80,245},
-  { 80,251},  { 82,247},  { 82,253},  { 84,249},  { 84,255},  { 86,251},  { 88,245},  { 88,253},
-  { 90,247},  { 90,255},  { 92,249},  { 94,245},  { 94,251},  { 96,247},  { 96,253},  { 98,249},
-  { 98,255},  {100,251},  {102,245},  {102,253},  {104,247},  {104,255},  {106,249},  {108,245},
-  {108,251},  {110,247},  {110,253},  {112,249},  {112,255},  {114,251},  {116,245},  {116,253},
-  {118,247},  {118,255},  {120,249},  {122,243},  {122,251},  {124,245},  {124,253},  {126,247},
-  {126,255},  {129,243},  {129,251},  {131,245},  {131,253},  {133,247},  {133,255},  {135,249},
-  {137,245},  {137,251},  {139,247},  {139,253},  {141,249},  {141,255},  {143,251},  {145,245},
-  {145,253},  {147,247},  {147,255},  {149,249},  {151,245},  {151,251},  {153,247},  {153,253},
-  {155,249},  {155,255},  {157,251},  {159,245},  {159,253},  {161,247},  {161,255},  {163,249},
-  {165,245},  {165,251},  {167,247},  {167,253},  {169,249},  {169,255},  {171,251},  {173,245},
-  {173,253},  {175,247},  {175,255},  {177,249},  {179,243},  {179,251},  {181,245},  {181,253},
-  {183,247},  {183,255},  {185,249},  {187,245},  {187,251},  {189,247},  {189,253},  {191,249},
-  {191,255},  {193,251},  {195,245},  {195,253},  {197,247},  {197,255},  {199,249},  {201,245},
-  {201,251},  {203,247},  {203,253},  {205,249},  {205,255},  {207,251},  {209,245},  {209,253},
-  {211,247},  {211,255},  {213,249},  {215,245},  {215,251},  {217,247},  {217,253},  {219,249},
-  {219,255},  {221,251},  {223,245},  {223,253},  {225,247},  {225,255},  {227,249},  {229,245},
-  {229,251},  {231,247},  {231,253},  {233,249},  {233,255},  {235,251},  {237,245},  {237,253},
-  {239,247},  {239,255},  {241,249},  {243,243},  {243,251},  {245,245},  {245,253},  {247,247},
-  {247,255},  {249,249},  {251,249},  {251,251},  {253,251},  {253,253},  {255,253},  {255,255}
+  SPL(  0,  0),  SPL(  0,  8),  SPL(  0, 16),  SPL(  0, 22),  SPL(  0, 30),  SPL(  0, 36),  SPL(  0, 44),  SPL(  0, 50),
+  SPL(  0, 58),  SPL(  0, 64),  SPL(  0, 72),  SPL(  0, 80),  SPL(  0, 86),  SPL(  0, 94),  SPL(  0,100),  SPL(  0,108),
+  SPL(  0,114),  SPL(  0,122),  SPL(  0,129),  SPL(  0,137),  SPL(  0,143),  SPL(  0,151),  SPL(  0,157),  SPL(  0,165),
+  SPL(  0,171),  SPL(  0,179),  SPL(  0,185),  SPL(  0,193),  SPL(  0,201),  SPL(  0,207),  SPL(  0,215),  SPL(  0,221),
+  SPL(  0,229),  SPL(  0,235),  SPL(  0,243),  SPL(  0,249),  SPL(  2,245),  SPL(  2,251),  SPL(  4,247),  SPL(  4,253),
+  SPL(  6,249),  SPL(  6,255),  SPL(  8,251),  SPL( 10,245),  SPL( 10,253),  SPL( 12,247),  SPL( 12,255),  SPL( 14,249),
+  SPL( 16,245),  SPL( 16,251),  SPL( 18,247),  SPL( 18,253),  SPL( 20,249),  SPL( 20,255),  SPL( 22,251),  SPL( 24,245),
+  SPL( 24,253),  SPL( 26,247),  SPL( 26,255),  SPL( 28,249),  SPL( 30,245),  SPL( 30,251),  SPL( 32,247),  SPL( 32,253),
+  SPL( 34,249),  SPL( 34,255),  SPL( 36,251),  SPL( 38,245),  SPL( 38,253),  SPL( 40,247),  SPL( 40,255),  SPL( 42,249),
+  SPL( 44,245),  SPL( 44,251),  SPL( 46,247),  SPL( 46,253),  SPL( 48,249),  SPL( 48,255),  SPL( 50,251),  SPL( 52,245),
+  SPL( 52,253),  SPL( 54,247),  SPL( 54,255),  SPL( 56,249),  SPL( 58,243),  SPL( 58,251),  SPL( 60,245),  SPL( 60,253),
+  SPL( 62,247),  SPL( 62,255),  SPL( 64,249),  SPL( 66,245),  SPL( 66,251),  SPL( 68,247),  SPL( 68,253),  SPL( 70,249),
+  SPL( 70,255),  SPL( 72,251),  SPL( 74,245),  SPL( 74,253),  SPL( 76,247),  SPL( 76,255),  SPL( 78,249),  SPL( 80,245),
+  SPL( 80,251),  SPL( 82,247),  SPL( 82,253),  SPL( 84,249),  SPL( 84,255),  SPL( 86,251),  SPL( 88,245),  SPL( 88,253),
+  SPL( 90,247),  SPL( 90,255),  SPL( 92,249),  SPL( 94,245),  SPL( 94,251),  SPL( 96,247),  SPL( 96,253),  SPL( 98,249),
+  SPL( 98,255),  SPL(100,251),  SPL(102,245),  SPL(102,253),  SPL(104,247),  SPL(104,255),  SPL(106,249),  SPL(108,245),
+  SPL(108,251),  SPL(110,247),  SPL(110,253),  SPL(112,249),  SPL(112,255),  SPL(114,251),  SPL(116,245),  SPL(116,253),
+  SPL(118,247),  SPL(118,255),  SPL(120,249),  SPL(122,243),  SPL(122,251),  SPL(124,245),  SPL(124,253),  SPL(126,247),
+  SPL(126,255),  SPL(129,243),  SPL(129,251),  SPL(131,245),  SPL(131,253),  SPL(133,247),  SPL(133,255),  SPL(135,249),
+  SPL(137,245),  SPL(137,251),  SPL(139,247),  SPL(139,253),  SPL(141,249),  SPL(141,255),  SPL(143,251),  SPL(145,245),
+  SPL(145,253),  SPL(147,247),  SPL(147,255),  SPL(149,249),  SPL(151,245),  SPL(151,251),  SPL(153,247),  SPL(153,253),
+  SPL(155,249),  SPL(155,255),  SPL(157,251),  SPL(159,245),  SPL(159,253),  SPL(161,247),  SPL(161,255),  SPL(163,249),
+  SPL(165,245),  SPL(165,251),  SPL(167,247),  SPL(167,253),  SPL(169,249),  SPL(169,255),  SPL(171,251),  SPL(173,245),
+  SPL(173,253),  SPL(175,247),  SPL(175,255),  SPL(177,249),  SPL(179,243),  SPL(179,251),  SPL(181,245),  SPL(181,253),
+  SPL(183,247),  SPL(183,255),  SPL(185,249),  SPL(187,245),  SPL(187,251),  SPL(189,247),  SPL(189,253),  SPL(191,249),
+  SPL(191,255),  SPL(193,251),  SPL(195,245),  SPL(195,253),  SPL(197,247),  SPL(197,255),  SPL(199,249),  SPL(201,245),
+  SPL(201,251),  SPL(203,247),  SPL(203,253),  SPL(205,249),  SPL(205,255),  SPL(207,251),  SPL(209,245),  SPL(209,253),
+  SPL(211,247),  SPL(211,255),  SPL(213,249),  SPL(215,245),  SPL(215,251),  SPL(217,247),  SPL(217,253),  SPL(219,249),
+  SPL(219,255),  SPL(221,251),  SPL(223,245),  SPL(223,253),  SPL(225,247),  SPL(225,255),  SPL(227,249),  SPL(229,245),
+  SPL(229,251),  SPL(231,247),  SPL(231,253),  SPL(233,249),  SPL(233,255),  SPL(235,251),  SPL(237,245),  SPL(237,253),
+  SPL(239,247),  SPL(239,255),  SPL(241,249),  SPL(243,243),  SPL(243,251),  SPL(245,245),  SPL(245,253),  SPL(247,247),
+  SPL(247,255),  SPL(249,249),  SPL(251,249),  SPL(251,251),  SPL(253,251),  SPL(253,253),  SPL(255,253),  SPL(255,255)
 };
 
 /* 256 * 2 * 1 = 512 */
 static PaletteSingleLookup8 const sp_lookup_8_16[256] =
 {
-  {  0,  0},  {  0, 16},  {  0, 32},  {  0, 48},  {  0, 64},  {  0, 80},  {  0, 96},  {  0,112},
-  {  0,128},  {  0,144},  {  0,160},  {  0,176},  {  0,192},  {  0,208},  {  0,224},  {  0,240},
-  {  1,241},  {  2,242},  {  3,243},  {  4,244},  {  5,245},  {  6,246},  {  7,247},  {  8,248},
-  {  9,249},  { 10,250},  { 11,251},  { 12,252},  { 13,253},  { 14,254},  { 15,255},  { 17,241},
-  { 18,242},  { 19,243},  { 20,244},  { 21,245},  { 22,246},  { 23,247},  { 24,248},  { 25,249},
-  { 26,250},  { 27,251},  { 28,252},  { 29,253},  { 30,254},  { 31,255},  { 33,241},  { 34,242},
-  { 35,243},  { 36,244},  { 37,245},  { 38,246},  { 39,247},  { 40,248},  { 41,249},  { 42,250},
-  { 43,251},  { 44,252},  { 45,253},  { 46,254},  { 47,255},  { 49,241},  { 50,242},  { 51,243},
-  { 52,244},  { 53,245},  { 54,246},  { 55,247},  { 56,248},  { 57,249},  { 58,250},  { 59,251},
-  { 60,252},  { 61,253},  { 62,254},  { 63,255},  { 65,241},  { 66,242},  { 67,243},  { 68,244},
-  { 69,245},  { 70,246},  { 71,247},  { 72,248},  { 73,249},  { 74,250},  { 75,251},  { 76,252},
-  { 77,253},  { 78,254},  { 79,255},  { 81,241},  { 82,242},  { 83,243},  { 84,244},  { 85,245},
-  { 86,246},  { 87,247},  { 88,248},  { 89,249},  { 90,250},  { 91,251},  { 92,252},  { 93,253},
-  { 94,254},  { 95,255},  { 97,241},  { 98,242},  { 99,243},  {100,244},  {101,245},  {102,246},
-  {103,247},  {104,248},  {105,249},  {106,250},  {107,251},  {108,252},  {109,253},  {110,254},
-  {111,255},  {113,241},  {114,242},  {115,243},  {116,244},  {117,245},  {118,246},  {119,247},
-  {120,248},  {121,249},  {122,250},  {123,251},  {124,252},  {125,253},  {126,254},  {127,255},
-  {129,241},  {130,242},  {131,243},  {132,244},  {133,245},  {134,246},  {135,247},  {136,248},
-  {137,249},  {138,250},  {139,251},  {140,252},  {141,253},  {142,254},  {143,255},  {145,241},
-  {146,242},  {147,243},  {148,244},  {149,245},  {150,246},  {151,247},  {152,248},  {153,249},
-  {154,250},  {155,251},  {156,252},  {157,253},  {158,254},  {159,255},  {161,241},  {162,242},
-  {163,243},  {164,244},  {165,245},  {166,246},  {167,247},  {168,248},  {169,249},  {170,250},
-  {171,251},  {172,252},  {173,253},  {174,254},  {175,255},  {177,241},  {178,242},  {179,243},
-  {180,244},  {181,245},  {182,246},  {183,247},  {184,248},  {185,249},  {186,250},  {187,251},
-  {188,252},  {189,253},  {190,254},  {191,255},  {193,241},  {194,242},  {195,243},  {196,244},
-  {197,245},  {198,246},  {199,247},  {200,248},  {201,249},  {202,250},  {203,251},  {204,252},
-  {205,253},  {206,254},  {207,255},  {209,241},  {210,242},  {211,243},  {212,244},  {213,245},
-  {214,246},  {215,247},  {216,248},  {217,249},  {218,250},  {219,251},  {220,252},  {221,253},
-  {222,254},  {223,255},  {225,241},  {226,242},  {227,243},  {228,244},  {229,245},  {230,246},
-  {231,247},  {232,248},  {233,249},  {234,250},  {235,251},  {236,252},  {237,253},  {238,254},
-  {239,255},  {241,241},  {242,242},  {243,243},  {244,244},  {245,245},  {246,246},  {247,247},
-  {248,248},  {249,249},  {250,250},  {251,251},  {252,252},  {253,253},  {254,254},  {255,255}
+  SPL(  0,  0),  SPL(  0, 16),  SPL(  0, 32),  SPL(  0, 48),  SPL(  0, 64),  SPL(  0, 80),  SPL(  0, 96),  SPL(  0,112),
+  SPL(  0,128),  SPL(  0,144),  SPL(  0,160),  SPL(  0,176),  SPL(  0,192),  SPL(  0,208),  SPL(  0,224),  SPL(  0,240),
+  SPL(  1,241),  SPL(  2,242),  SPL(  3,243),  SPL(  4,244),  SPL(  5,245),  SPL(  6,246),  SPL(  7,247),  SPL(  8,248),
+  SPL(  9,249),  SPL( 10,250),  SPL( 11,251),  SPL( 12,252),  SPL( 13,253),  SPL( 14,254),  SPL( 15,255),  SPL( 17,241),
+  SPL( 18,242),  SPL( 19,243),  SPL( 20,244),  SPL( 21,245),  SPL( 22,246),  SPL( 23,247),  SPL( 24,248),  SPL( 25,249),
+  SPL( 26,250),  SPL( 27,251),  SPL( 28,252),  SPL( 29,253),  SPL( 30,254),  SPL( 31,255),  SPL( 33,241),  SPL( 34,242),
+  SPL( 35,243),  SPL( 36,244),  SPL( 37,245),  SPL( 38,246),  SPL( 39,247),  SPL( 40,248),  SPL( 41,249),  SPL( 42,250),
+  SPL( 43,251),  SPL( 44,252),  SPL( 45,253),  SPL( 46,254),  SPL( 47,255),  SPL( 49,241),  SPL( 50,242),  SPL( 51,243),
+  SPL( 52,244),  SPL( 53,245),  SPL( 54,246),  SPL( 55,247),  SPL( 56,248),  SPL( 57,249),  SPL( 58,250),  SPL( 59,251),
+  SPL( 60,252),  SPL( 61,253),  SPL( 62,254),  SPL( 63,255),  SPL( 65,241),  SPL( 66,242),  SPL( 67,243),  SPL( 68,244),
+  SPL( 69,245),  SPL( 70,246),  SPL( 71,247),  SPL( 72,248),  SPL( 73,249),  SPL( 74,250),  SPL( 75,251),  SPL( 76,252),
+  SPL( 77,253),  SPL( 78,254),  SPL( 79,255),  SPL( 81,241),  SPL( 82,242),  SPL( 83,243),  SPL( 84,244),  SPL( 85,245),
+  SPL( 86,246),  SPL( 87,247),  SPL( 88,248),  SPL( 89,249),  SPL( 90,250),  SPL( 91,251),  SPL( 92,252),  SPL( 93,253),
+  SPL( 94,254),  SPL( 95,255),  SPL( 97,241),  SPL( 98,242),  SPL( 99,243),  SPL(100,244),  SPL(101,245),  SPL(102,246),
+  SPL(103,247),  SPL(104,248),  SPL(105,249),  SPL(106,250),  SPL(107,251),  SPL(108,252),  SPL(109,253),  SPL(110,254),
+  SPL(111,255),  SPL(113,241),  SPL(114,242),  SPL(115,243),  SPL(116,244),  SPL(117,245),  SPL(118,246),  SPL(119,247),
+  SPL(120,248),  SPL(121,249),  SPL(122,250),  SPL(123,251),  SPL(124,252),  SPL(125,253),  SPL(126,254),  SPL(127,255),
+  SPL(129,241),  SPL(130,242),  SPL(131,243),  SPL(132,244),  SPL(133,245),  SPL(134,246),  SPL(135,247),  SPL(136,248),
+  SPL(137,249),  SPL(138,250),  SPL(139,251),  SPL(140,252),  SPL(141,253),  SPL(142,254),  SPL(143,255),  SPL(145,241),
+  SPL(146,242),  SPL(147,243),  SPL(148,244),  SPL(149,245),  SPL(150,246),  SPL(151,247),  SPL(152,248),  SPL(153,249),
+  SPL(154,250),  SPL(155,251),  SPL(156,252),  SPL(157,253),  SPL(158,254),  SPL(159,255),  SPL(161,241),  SPL(162,242),
+  SPL(163,243),  SPL(164,244),  SPL(165,245),  SPL(166,246),  SPL(167,247),  SPL(168,248),  SPL(169,249),  SPL(170,250),
+  SPL(171,251),  SPL(172,252),  SPL(173,253),  SPL(174,254),  SPL(175,255),  SPL(177,241),  SPL(178,242),  SPL(179,243),
+  SPL(180,244),  SPL(181,245),  SPL(182,246),  SPL(183,247),  SPL(184,248),  SPL(185,249),  SPL(186,250),  SPL(187,251),
+  SPL(188,252),  SPL(189,253),  SPL(190,254),  SPL(191,255),  SPL(193,241),  SPL(194,242),  SPL(195,243),  SPL(196,244),
+  SPL(197,245),  SPL(198,246),  SPL(199,247),  SPL(200,248),  SPL(201,249),  SPL(202,250),  SPL(203,251),  SPL(204,252),
+  SPL(205,253),  SPL(206,254),  SPL(207,255),  SPL(209,241),  SPL(210,242),  SPL(211,243),  SPL(212,244),  SPL(213,245),
+  SPL(214,246),  SPL(215,247),  SPL(216,248),  SPL(217,249),  SPL(218,250),  SPL(219,251),  SPL(220,252),  SPL(221,253),
+  SPL(222,254),  SPL(223,255),  SPL(225,241),  SPL(226,242),  SPL(227,243),  SPL(228,244),  SPL(229,245),  SPL(230,246),
+  SPL(231,247),  SPL(232,248),  SPL(233,249),  SPL(234,250),  SPL(235,251),  SPL(236,252),  SPL(237,253),  SPL(238,254),
+  SPL(239,255),  SPL(241,241),  SPL(242,242),  SPL(243,243),  SPL(244,244),  SPL(245,245),  SPL(246,246),  SPL(247,247),
+  SPL(248,248),  SPL(249,249),  SPL(250,250),  SPL(251,251),  SPL(252,252),  SPL(253,253),  SPL(254,254),  SPL(255,255)
 };
 
 /* 256 * 2 * 4 = 2048 */
 static PaletteSingleLookup2 const sp_lookup_5u1_4[4][256] =
 {
 {
-  {  0,  0},  {  0,  0},  {  0,  8},  {  0,  8},  {  0, 16},  {  0, 16},  {  0, 16},  {  0, 24},
-  {  8,  8},  {  0, 32},  {  0, 32},  {  0, 32},  {  0, 40},  {  0, 40},  {  0, 40},  {  0, 48},
-  { 16, 16},  {  0, 56},  {  0, 56},  {  0, 56},  {  0, 65},  {  0, 65},  {  0, 65},  {  0, 73},
-  { 24, 24},  {  0, 81},  {  0, 81},  {  0, 81},  {  0, 89},  {  0, 89},  {  0, 89},  {  0, 97},
-  { 16, 65},  {  0,105},  {  0,105},  {  0,105},  {  0,113},  {  0,113},  {  0,113},  {  0,121},
-  { 24, 73},  {  0,130},  {  0,130},  { 65,  0},  {  0,138},  {  0,138},  { 65,  8},  {  0,146},
-  {  8,130},  { 73,  0},  {  0,154},  { 65, 24},  {  0,162},  {  0,162},  { 65, 32},  {  0,170},
-  { 16,138},  { 81,  8},  {  0,178},  { 65, 48},  {  0,186},  {  0,186},  { 65, 56},  {  0,195},
-  { 24,146},  { 65, 65},  {  0,203},  { 65, 73},  {  0,211},  {  0,211},  { 65, 81},  {  0,219},
-  { 32,154},  { 73, 73},  {  0,227},  { 65, 97},  {  0,235},  {  0,235},  { 65,105},  {  0,243},
-  { 24,195},  { 81, 81},  {  0,251},  { 65,121},  {  8,243},  {  8,243},  { 65,130},  {  8,251},
-  { 32,203},  { 89, 89},  { 16,243},  { 65,146},  {130, 16},  { 16,251},  { 65,154},  { 24,243},
-  { 40,211},  { 81,130},  { 24,251},  { 65,170},  {130, 40},  { 32,243},  { 65,178},  { 32,251},
-  { 48,219},  { 89,138},  { 40,243},  { 65,195},  {130, 65},  { 40,251},  { 65,203},  { 48,243},
-  { 56,227},  { 73,195},  { 48,251},  { 65,219},  {130, 89},  { 56,243},  { 65,227},  { 56,251},
-  { 65,235},  { 81,203},  {146, 73},  { 65,243},  {130,113},  { 65,251},  { 65,251},  {130,121},
-  { 73,243},  { 89,211},  {130,130},  { 73,251},  {130,138},  {195,  8},  { 81,243},  {130,146},
-  { 81,251},  { 97,219},  {138,138},  { 89,243},  {130,162},  {195, 32},  { 89,251},  {130,170},
-  { 97,243},  {105,227},  {146,146},  { 97,251},  {130,186},  {195, 56},  {105,243},  {130,195},
-  {105,251},  {113,235},  {154,154},  {113,243},  {130,211},  {195, 81},  {113,251},  {130,219},
-  {195, 89},  {121,243},  {146,195},  {121,251},  {130,235},  {195,105},  {130,243},  {130,243},
-  {195,113},  {130,251},  {154,203},  {219, 73},  {138,243},  {195,130},  {138,251},  {138,251},
-  {195,138},  {146,243},  {162,211},  {203,130},  {146,251},  {195,154},  {154,243},  {154,243},
-  {195,162},  {154,251},  {170,219},  {211,138},  {162,243},  {195,178},  {162,251},  {162,251},
-  {195,186},  {170,243},  {178,227},  {195,195},  {170,251},  {195,203},  {178,243},  {178,243},
-  {195,211},  {178,251},  {186,235},  {203,203},  {186,243},  {195,227},  {186,251},  {186,251},
-  {195,235},  {195,235},  {195,243},  {211,211},  {195,251},  {195,251},  {195,251},  {203,243},
-  {203,243},  {203,243},  {203,251},  {219,219},  {211,243},  {211,243},  {211,243},  {211,251},
-  {211,251},  {211,251},  {219,243},  {227,227},  {219,251},  {219,251},  {219,251},  {227,243},
-  {227,243},  {227,243},  {227,251},  {235,235},  {235,235},  {235,243},  {235,243},  {235,251},
-  {235,251},  {235,251},  {243,243},  {243,243},  {243,243},  {243,251},  {243,251},  {251,243},
-  {251,243},  {251,243},  {251,251},  {251,251},  {251,251},  {251,251},  {251,251},  {251,251}
+  SPL(  0,  0),  SPL(  0,  0),  SPL(  0,  8),  SPL(  0,  8),  SPL(  0, 16),  SPL(  0, 16),  SPL(  0, 16),  SPL(  0, 24),
+  SPL(  8,  8),  SPL(  0, 32),  SPL(  0, 32),  SPL(  0, 32),  SPL(  0, 40),  SPL(  0, 40),  SPL(  0, 40),  SPL(  0, 48),
+  SPL( 16, 16),  SPL(  0, 56),  SPL(  0, 56),  SPL(  0, 56),  SPL(  0, 65),  SPL(  0, 65),  SPL(  0, 65),  SPL(  0, 73),
+  SPL( 24, 24),  SPL(  0, 81),  SPL(  0, 81),  SPL(  0, 81),  SPL(  0, 89),  SPL(  0, 89),  SPL(  0, 89),  SPL(  0, 97),
+  SPL( 16, 65),  SPL(  0,105),  SPL(  0,105),  SPL(  0,105),  SPL(  0,113),  SPL(  0,113),  SPL(  0,113),  SPL(  0,121),
+  SPL( 24, 73),  SPL(  0,130),  SPL(  0,130),  SPL( 65,  0),  SPL(  0,138),  SPL(  0,138),  SPL( 65,  8),  SPL(  0,146),
+  SPL(  8,130),  SPL( 73,  0),  SPL(  0,154),  SPL( 65, 24),  SPL(  0,162),  SPL(  0,162),  SPL( 65, 32),  SPL(  0,170),
+  SPL( 16,138),  SPL( 81,  8),  SPL(  0,178),  SPL( 65, 48),  SPL(  0,186),  SPL(  0,186),  SPL( 65, 56),  SPL(  0,195),
+  SPL( 24,146),  SPL( 65, 65),  SPL(  0,203),  SPL( 65, 73),  SPL(  0,211),  SPL(  0,211),  SPL( 65, 81),  SPL(  0,219),
+  SPL( 32,154),  SPL( 73, 73),  SPL(  0,227),  SPL( 65, 97),  SPL(  0,235),  SPL(  0,235),  SPL( 65,105),  SPL(  0,243),
+  SPL( 24,195),  SPL( 81, 81),  SPL(  0,251),  SPL( 65,121),  SPL(  8,243),  SPL(  8,243),  SPL( 65,130),  SPL(  8,251),
+  SPL( 32,203),  SPL( 89, 89),  SPL( 16,243),  SPL( 65,146),  SPL(130, 16),  SPL( 16,251),  SPL( 65,154),  SPL( 24,243),
+  SPL( 40,211),  SPL( 81,130),  SPL( 24,251),  SPL( 65,170),  SPL(130, 40),  SPL( 32,243),  SPL( 65,178),  SPL( 32,251),
+  SPL( 48,219),  SPL( 89,138),  SPL( 40,243),  SPL( 65,195),  SPL(130, 65),  SPL( 40,251),  SPL( 65,203),  SPL( 48,243),
+  SPL( 56,227),  SPL( 73,195),  SPL( 48,251),  SPL( 65,219),  SPL(130, 89),  SPL( 56,243),  SPL( 65,227),  SPL( 56,251),
+  SPL( 65,235),  SPL( 81,203),  SPL(146, 73),  SPL( 65,243),  SPL(130,113),  SPL( 65,251),  SPL( 65,251),  SPL(130,121),
+  SPL( 73,243),  SPL( 89,211),  SPL(130,130),  SPL( 73,251),  SPL(130,138),  SPL(195,  8),  SPL( 81,243),  SPL(130,146),
+  SPL( 81,251),  SPL( 97,219),  SPL(138,138),  SPL( 89,243),  SPL(130,162),  SPL(195, 32),  SPL( 89,251),  SPL(130,170),
+  SPL( 97,243),  SPL(105,227),  SPL(146,146),  SPL( 97,251),  SPL(130,186),  SPL(195, 56),  SPL(105,243),  SPL(130,195),
+  SPL(105,251),  SPL(113,235),  SPL(154,154),  SPL(113,243),  SPL(130,211),  SPL(195, 81),  SPL(113,251),  SPL(130,219),
+  SPL(195, 89),  SPL(121,243),  SPL(146,195),  SPL(121,251),  SPL(130,235),  SPL(195,105),  SPL(130,243),  SPL(130,243),
+  SPL(195,113),  SPL(130,251),  SPL(154,203),  SPL(219, 73),  SPL(138,243),  SPL(195,130),  SPL(138,251),  SPL(138,251),
+  SPL(195,138),  SPL(146,243),  SPL(162,211),  SPL(203,130),  SPL(146,251),  SPL(195,154),  SPL(154,243),  SPL(154,243),
+  SPL(195,162),  SPL(154,251),  SPL(170,219),  SPL(211,138),  SPL(162,243),  SPL(195,178),  SPL(162,251),  SPL(162,251),
+  SPL(195,186),  SPL(170,243),  SPL(178,227),  SPL(195,195),  SPL(170,251),  SPL(195,203),  SPL(178,243),  SPL(178,243),
+  SPL(195,211),  SPL(178,251),  SPL(186,235),  SPL(203,203),  SPL(186,243),  SPL(195,227),  SPL(186,251),  SPL(186,251),
+  SPL(195,235),  SPL(195,235),  SPL(195,243),  SPL(211,211),  SPL(195,251),  SPL(195,251),  SPL(195,251),  SPL(203,243),
+  SPL(203,243),  SPL(203,243),  SPL(203,251),  SPL(219,219),  SPL(211,243),  SPL(211,243),  SPL(211,243),  SPL(211,251),
+  SPL(211,251),  SPL(211,251),  SPL(219,243),  SPL(227,227),  SPL(219,251),  SPL(219,251),  SPL(219,251),  SPL(227,243),
+  SPL(227,243),  SPL(227,243),  SPL(227,251),  SPL(235,235),  SPL(235,235),  SPL(235,243),  SPL(235,243),  SPL(235,251),
+  SPL(235,251),  SPL(235,251),  SPL(243,243),  SPL(243,243),  SPL(243,243),  SPL(243,251),  SPL(243,251),  SPL(251,243),
+  SPL(251,243),  SPL(251,243),  SPL(251,251),  SPL(251,251),  SPL(251,251),  SPL(251,251),  SPL(251,251),  SPL(251,251)
 },{
-  {  4,  0},  {  4,  0},  {  4,  0},  {  4,  0},  {  4,  8},  {  4,  8},  {  4,  8},  {  4, 16},
-  { 12,  0},  {  4, 24},  {  4, 24},  {  4, 24},  {  4, 32},  {  4, 32},  {  4, 32},  {  4, 40},
-  { 20,  8},  {  4, 48},  {  4, 48},  {  4, 48},  {  4, 56},  {  4, 56},  {  4, 56},  { 12, 48},
-  {  4, 65},  {  4, 65},  {  4, 73},  {  4, 73},  {  4, 81},  {  4, 81},  {  4, 81},  {  4, 89},
-  { 12, 73},  {  4, 97},  {  4, 97},  {  4, 97},  {  4,105},  {  4,105},  {  4,105},  {  4,113},
-  { 20, 81},  {  4,121},  {  4,121},  {  4,121},  {  4,130},  {  4,130},  { 69,  0},  {  4,138},
-  { 28, 89},  {  4,146},  {  4,146},  { 69, 16},  {  4,154},  {  4,154},  { 69, 24},  {  4,162},
-  { 20,130},  { 85,  0},  {  4,170},  { 69, 40},  {  4,178},  {  4,178},  { 69, 48},  {  4,186},
-  { 28,138},  { 93,  8},  {  4,195},  { 69, 65},  {  4,203},  {  4,203},  { 69, 73},  {  4,211},
-  { 12,195},  { 77, 65},  {  4,219},  { 69, 89},  {  4,227},  {  4,227},  { 69, 97},  {  4,235},
-  { 20,203},  { 85, 73},  {  4,243},  { 69,113},  {  4,251},  {  4,251},  { 69,121},  { 12,243},
-  { 28,211},  { 69,130},  { 12,251},  { 69,138},  {134,  8},  { 20,243},  { 69,146},  { 20,251},
-  { 36,219},  { 77,138},  { 28,243},  { 69,162},  {134, 32},  { 28,251},  { 69,170},  { 36,243},
-  { 44,227},  { 85,146},  { 36,251},  { 69,186},  {134, 56},  { 44,243},  { 69,195},  { 44,251},
-  { 52,235},  { 93,154},  { 52,243},  { 69,211},  {134, 81},  { 52,251},  { 69,219},  {134, 89},
-  { 60,243},  { 85,195},  { 60,251},  { 69,235},  {134,105},  { 69,243},  { 69,243},  {134,113},
-  { 69,251},  { 93,203},  {158, 73},  { 77,243},  {134,130},  {199,  0},  { 77,251},  {134,138},
-  { 85,243},  {101,211},  {142,130},  { 85,251},  {134,154},  {199, 24},  { 93,243},  {134,162},
-  { 93,251},  {109,219},  {150,138},  {101,243},  {134,178},  {199, 48},  {101,251},  {134,186},
-  {109,243},  {117,227},  {134,195},  {109,251},  {134,203},  {199, 73},  {117,243},  {134,211},
-  {117,251},  {125,235},  {142,203},  {125,243},  {134,227},  {199, 97},  {125,251},  {134,235},
-  {199,105},  {134,243},  {150,211},  {215, 81},  {134,251},  {199,121},  {142,243},  {142,243},
-  {199,130},  {142,251},  {158,219},  {223, 89},  {150,243},  {199,146},  {150,251},  {150,251},
-  {199,154},  {158,243},  {166,227},  {215,130},  {158,251},  {199,170},  {166,243},  {166,243},
-  {199,178},  {166,251},  {174,235},  {223,138},  {174,243},  {199,195},  {174,251},  {174,251},
-  {199,203},  {182,243},  {182,243},  {207,195},  {182,251},  {199,219},  {190,243},  {190,243},
-  {199,227},  {190,251},  {190,251},  {215,203},  {199,243},  {199,243},  {199,243},  {199,251},
-  {199,251},  {199,251},  {207,243},  {223,211},  {207,251},  {207,251},  {207,251},  {215,243},
-  {215,243},  {215,243},  {215,251},  {231,219},  {223,243},  {223,243},  {223,243},  {223,251},
-  {223,251},  {223,251},  {231,243},  {239,227},  {231,251},  {231,251},  {231,251},  {239,243},
-  {239,243},  {239,243},  {239,251},  {247,235},  {247,243},  {247,243},  {247,243},  {247,251},
-  {247,251},  {247,251},  {255,243},  {255,243},  {255,251},  {255,251},  {255,251},  {255,251}
+  SPL(  4,  0),  SPL(  4,  0),  SPL(  4,  0),  SPL(  4,  0),  SPL(  4,  8),  SPL(  4,  8),  SPL(  4,  8),  SPL(  4, 16),
+  SPL( 12,  0),  SPL(  4, 24),  SPL(  4, 24),  SPL(  4, 24),  SPL(  4, 32),  SPL(  4, 32),  SPL(  4, 32),  SPL(  4, 40),
+  SPL( 20,  8),  SPL(  4, 48),  SPL(  4, 48),  SPL(  4, 48),  SPL(  4, 56),  SPL(  4, 56),  SPL(  4, 56),  SPL( 12, 48),
+  SPL(  4, 65),  SPL(  4, 65),  SPL(  4, 73),  SPL(  4, 73),  SPL(  4, 81),  SPL(  4, 81),  SPL(  4, 81),  SPL(  4, 89),
+  SPL( 12, 73),  SPL(  4, 97),  SPL(  4, 97),  SPL(  4, 97),  SPL(  4,105),  SPL(  4,105),  SPL(  4,105),  SPL(  4,113),
+  SPL( 20, 81),  SPL(  4,121),  SPL(  4,121),  SPL(  4,121),  SPL(  4,130),  SPL(  4,130),  SPL( 69,  0),  SPL(  4,138),
+  SPL( 28, 89),  SPL(  4,146),  SPL(  4,146),  SPL( 69, 16),  SPL(  4,154),  SPL(  4,154),  SPL( 69, 24),  SPL(  4,162),
+  SPL( 20,130),  SPL( 85,  0),  SPL(  4,170),  SPL( 69, 40),  SPL(  4,178),  SPL(  4,178),  SPL( 69, 48),  SPL(  4,186),
+  SPL( 28,138),  SPL( 93,  8),  SPL(  4,195),  SPL( 69, 65),  SPL(  4,203),  SPL(  4,203),  SPL( 69, 73),  SPL(  4,211),
+  SPL( 12,195),  SPL( 77, 65),  SPL(  4,219),  SPL( 69, 89),  SPL(  4,227),  SPL(  4,227),  SPL( 69, 97),  SPL(  4,235),
+  SPL( 20,203),  SPL( 85, 73),  SPL(  4,243),  SPL( 69,113),  SPL(  4,251),  SPL(  4,251),  SPL( 69,121),  SPL( 12,243),
+  SPL( 28,211),  SPL( 69,130),  SPL( 12,251),  SPL( 69,138),  SPL(134,  8),  SPL( 20,243),  SPL( 69,146),  SPL( 20,251),
+  SPL( 36,219),  SPL( 77,138),  SPL( 28,243),  SPL( 69,162),  SPL(134, 32),  SPL( 28,251),  SPL( 69,170),  SPL( 36,243),
+  SPL( 44,227),  SPL( 85,146),  SPL( 36,251),  SPL( 69,186),  SPL(134, 56),  SPL( 44,243),  SPL( 69,195),  SPL( 44,251),
+  SPL( 52,235),  SPL( 93,154),  SPL( 52,243),  SPL( 69,211),  SPL(134, 81),  SPL( 52,251),  SPL( 69,219),  SPL(134, 89),
+  SPL( 60,243),  SPL( 85,195),  SPL( 60,251),  SPL( 69,235),  SPL(134,105),  SPL( 69,243),  SPL( 69,243),  SPL(134,113),
+  SPL( 69,251),  SPL( 93,203),  SPL(158, 73),  SPL( 77,243),  SPL(134,130),  SPL(199,  0),  SPL( 77,251),  SPL(134,138),
+  SPL( 85,243),  SPL(101,211),  SPL(142,130),  SPL( 85,251),  SPL(134,154),  SPL(199, 24),  SPL( 93,243),  SPL(134,162),
+  SPL( 93,251),  SPL(109,219),  SPL(150,138),  SPL(101,243),  SPL(134,178),  SPL(199, 48),  SPL(101,251),  SPL(134,186),
+  SPL(109,243),  SPL(117,227),  SPL(134,195),  SPL(109,251),  SPL(134,203),  SPL(199, 73),  SPL(117,243),  SPL(134,211),
+  SPL(117,251),  SPL(125,235),  SPL(142,203),  SPL(125,243),  SPL(134,227),  SPL(199, 97),  SPL(125,251),  SPL(134,235),
+  SPL(199,105),  SPL(134,243),  SPL(150,211),  SPL(215, 81),  SPL(134,251),  SPL(199,121),  SPL(142,243),  SPL(142,243),
+  SPL(199,130),  SPL(142,251),  SPL(158,219),  SPL(223, 89),  SPL(150,243),  SPL(199,146),  SPL(150,251),  SPL(150,251),
+  SPL(199,154),  SPL(158,243),  SPL(166,227),  SPL(215,130),  SPL(158,251),  SPL(199,170),  SPL(166,243),  SPL(166,243),
+  SPL(199,178),  SPL(166,251),  SPL(174,235),  SPL(223,138),  SPL(174,243),  SPL(199,195),  SPL(174,251),  SPL(174,251),
+  SPL(199,203),  SPL(182,243),  SPL(182,243),  SPL(207,195),  SPL(182,251),  SPL(199,219),  SPL(190,243),  SPL(190,243),
+  SPL(199,227),  SPL(190,251),  SPL(190,251),  SPL(215,203),  SPL(199,243),  SPL(199,243),  SPL(199,243),  SPL(199,251),
+  SPL(199,251),  SPL(199,251),  SPL(207,243),  SPL(223,211),  SPL(207,251),  SPL(207,251),  SPL(207,251),  SPL(215,243),
+  SPL(215,243),  SPL(215,243),  SPL(215,251),  SPL(231,219),  SPL(223,243),  SPL(223,243),  SPL(223,243),  SPL(223,251),
+  SPL(223,251),  SPL(223,251),  SPL(231,243),  SPL(239,227),  SPL(231,251),  SPL(231,251),  SPL(231,251),  SPL(239,243),
+  SPL(239,243),  SPL(239,243),  SPL(239,251),  SPL(247,235),  SPL(247,243),  SPL(247,243),  SPL(247,243),  SPL(247,251),
+  SPL(247,251),  SPL(247,251),  SPL(255,243),  SPL(255,243),  SPL(255,251),  SPL(255,251),  SPL(255,251),  SPL(255,251)
 },{
-  {  0,  4},  {  0,  4},  {  0,  4},  {  0, 12},  {  0, 12},  {  0, 20},  {  0, 20},  {  0, 20},
-  {  0, 28},  {  0, 28},  {  0, 28},  {  0, 36},  { 16,  4},  {  0, 44},  {  0, 44},  {  0, 44},
-  {  0, 52},  {  0, 52},  {  0, 52},  {  0, 60},  { 24, 12},  {  0, 69},  {  0, 69},  {  0, 69},
-  {  0, 77},  {  0, 77},  {  0, 77},  {  0, 85},  {  8, 69},  {  0, 93},  {  0, 93},  {  0, 93},
-  {  0,101},  {  0,101},  {  0,101},  {  0,109},  { 16, 77},  {  0,117},  {  0,117},  {  0,117},
-  {  0,125},  {  0,125},  {  0,125},  {  0,134},  { 24, 85},  {  0,142},  {  0,142},  { 65, 12},
-  {  0,150},  {  0,150},  { 65, 20},  {  0,158},  { 32, 93},  {  0,166},  {  0,166},  { 65, 36},
-  {  0,174},  {  0,174},  { 65, 44},  {  0,182},  { 24,134},  { 89,  4},  {  0,190},  { 65, 60},
-  {  0,199},  {  0,199},  { 65, 69},  {  0,207},  { 32,142},  { 97, 12},  {  0,215},  { 65, 85},
-  {  0,223},  {  0,223},  { 65, 93},  {  0,231},  { 16,199},  { 81, 69},  {  0,239},  { 65,109},
-  {  0,247},  {  0,247},  { 65,117},  {  0,255},  { 24,207},  { 89, 77},  {  8,247},  { 65,134},
-  {130,  4},  {  8,255},  { 65,142},  { 16,247},  { 32,215},  { 73,134},  { 16,255},  { 65,158},
-  {130, 28},  { 24,247},  { 65,166},  { 24,255},  { 40,223},  { 81,142},  { 32,247},  { 65,182},
-  {130, 52},  { 32,255},  { 65,190},  { 40,247},  { 48,231},  { 89,150},  { 40,255},  { 65,207},
-  {130, 77},  { 48,247},  { 65,215},  { 48,255},  { 56,239},  { 97,158},  { 56,247},  { 65,231},
-  {130,101},  { 56,255},  { 65,239},  {130,109},  { 65,247},  { 89,199},  {154, 69},  { 65,255},
-  {130,125},  { 73,247},  { 73,247},  {130,134},  { 73,255},  { 97,207},  {162, 77},  { 81,247},
-  {130,150},  {195, 20},  { 81,255},  {130,158},  { 89,247},  {105,215},  {146,134},  { 89,255},
-  {130,174},  {195, 44},  { 97,247},  {130,182},  { 97,255},  {113,223},  {154,142},  {105,247},
-  {130,199},  {195, 69},  {105,255},  {130,207},  {113,247},  {121,231},  {138,199},  {113,255},
-  {130,223},  {195, 93},  {121,247},  {130,231},  {121,255},  {130,239},  {146,207},  {211, 77},
-  {130,247},  {195,117},  {130,255},  {130,255},  {195,125},  {138,247},  {154,215},  {219, 85},
-  {138,255},  {195,142},  {146,247},  {146,247},  {195,150},  {146,255},  {162,223},  {227, 93},
-  {154,247},  {195,166},  {154,255},  {154,255},  {195,174},  {162,247},  {170,231},  {219,134},
-  {162,255},  {195,190},  {170,247},  {170,247},  {195,199},  {170,255},  {178,239},  {227,142},
-  {178,247},  {195,215},  {178,255},  {178,255},  {195,223},  {186,247},  {186,247},  {211,199},
-  {186,255},  {195,239},  {195,239},  {195,247},  {195,247},  {195,247},  {195,255},  {219,207},
-  {203,247},  {203,247},  {203,247},  {203,255},  {203,255},  {203,255},  {211,247},  {227,215},
-  {211,255},  {211,255},  {211,255},  {219,247},  {219,247},  {219,247},  {219,255},  {235,223},
-  {227,247},  {227,247},  {227,247},  {227,255},  {227,255},  {227,255},  {235,247},  {243,231},
-  {235,255},  {235,255},  {235,255},  {243,247},  {243,247},  {243,247},  {243,255},  {251,239},
-  {251,247},  {251,247},  {251,247},  {251,255},  {251,255},  {251,255},  {251,255},  {251,255}
+  SPL(  0,  4),  SPL(  0,  4),  SPL(  0,  4),  SPL(  0, 12),  SPL(  0, 12),  SPL(  0, 20),  SPL(  0, 20),  SPL(  0, 20),
+  SPL(  0, 28),  SPL(  0, 28),  SPL(  0, 28),  SPL(  0, 36),  SPL( 16,  4),  SPL(  0, 44),  SPL(  0, 44),  SPL(  0, 44),
+  SPL(  0, 52),  SPL(  0, 52),  SPL(  0, 52),  SPL(  0, 60),  SPL( 24, 12),  SPL(  0, 69),  SPL(  0, 69),  SPL(  0, 69),
+  SPL(  0, 77),  SPL(  0, 77),  SPL(  0, 77),  SPL(  0, 85),  SPL(  8, 69),  SPL(  0, 93),  SPL(  0, 93),  SPL(  0, 93),
+  SPL(  0,101),  SPL(  0,101),  SPL(  0,101),  SPL(  0,109),  SPL( 16, 77),  SPL(  0,117),  SPL(  0,117),  SPL(  0,117),
+  SPL(  0,125),  SPL(  0,125),  SPL(  0,125),  SPL(  0,134),  SPL( 24, 85),  SPL(  0,142),  SPL(  0,142),  SPL( 65, 12),
+  SPL(  0,150),  SPL(  0,150),  SPL( 65, 20),  SPL(  0,158),  SPL( 32, 93),  SPL(  0,166),  SPL(  0,166),  SPL( 65, 36),
+  SPL(  0,174),  SPL(  0,174),  SPL( 65, 44),  SPL(  0,182),  SPL( 24,134),  SPL( 89,  4),  SPL(  0,190),  SPL( 65, 60),
+  SPL(  0,199),  SPL(  0,199),  SPL( 65, 69),  SPL(  0,207),  SPL( 32,142),  SPL( 97, 12),  SPL(  0,215),  SPL( 65, 85),
+  SPL(  0,223),  SPL(  0,223),  SPL( 65, 93),  SPL(  0,231),  SPL( 16,199),  SPL( 81, 69),  SPL(  0,239),  SPL( 65,109),
+  SPL(  0,247),  SPL(  0,247),  SPL( 65,117),  SPL(  0,255),  SPL( 24,207),  SPL( 89, 77),  SPL(  8,247),  SPL( 65,134),
+  SPL(130,  4),  SPL(  8,255),  SPL( 65,142),  SPL( 16,247),  SPL( 32,215),  SPL( 73,134),  SPL( 16,255),  SPL( 65,158),
+  SPL(130, 28),  SPL( 24,247),  SPL( 65,166),  SPL( 24,255),  SPL( 40,223),  SPL( 81,142),  SPL( 32,247),  SPL( 65,182),
+  SPL(130, 52),  SPL( 32,255),  SPL( 65,190),  SPL( 40,247),  SPL( 48,231),  SPL( 89,150),  SPL( 40,255),  SPL( 65,207),
+  SPL(130, 77),  SPL( 48,247),  SPL( 65,215),  SPL( 48,255),  SPL( 56,239),  SPL( 97,158),  SPL( 56,247),  SPL( 65,231),
+  SPL(130,101),  SPL( 56,255),  SPL( 65,239),  SPL(130,109),  SPL( 65,247),  SPL( 89,199),  SPL(154, 69),  SPL( 65,255),
+  SPL(130,125),  SPL( 73,247),  SPL( 73,247),  SPL(130,134),  SPL( 73,255),  SPL( 97,207),  SPL(162, 77),  SPL( 81,247),
+  SPL(130,150),  SPL(195, 20),  SPL( 81,255),  SPL(130,158),  SPL( 89,247),  SPL(105,215),  SPL(146,134),  SPL( 89,255),
+  SPL(130,174),  SPL(195, 44),  SPL( 97,247),  SPL(130,182),  SPL( 97,255),  SPL(113,223),  SPL(154,142),  SPL(105,247),
+  SPL(130,199),  SPL(195, 69),  SPL(105,255),  SPL(130,207),  SPL(113,247),  SPL(121,231),  SPL(138,199),  SPL(113,255),
+  SPL(130,223),  SPL(195, 93),  SPL(121,247),  SPL(130,231),  SPL(121,255),  SPL(130,239),  SPL(146,207),  SPL(211, 77),
+  SPL(130,247),  SPL(195,117),  SPL(130,255),  SPL(130,255),  SPL(195,125),  SPL(138,247),  SPL(154,215),  SPL(219, 85),
+  SPL(138,255),  SPL(195,142),  SPL(146,247),  SPL(146,247),  SPL(195,150),  SPL(146,255),  SPL(162,223),  SPL(227, 93),
+  SPL(154,247),  SPL(195,166),  SPL(154,255),  SPL(154,255),  SPL(195,174),  SPL(162,247),  SPL(170,231),  SPL(219,134),
+  SPL(162,255),  SPL(195,190),  SPL(170,247),  SPL(170,247),  SPL(195,199),  SPL(170,255),  SPL(178,239),  SPL(227,142),
+  SPL(178,247),  SPL(195,215),  SPL(178,255),  SPL(178,255),  SPL(195,223),  SPL(186,247),  SPL(186,247),  SPL(211,199),
+  SPL(186,255),  SPL(195,239),  SPL(195,239),  SPL(195,247),  SPL(195,247),  SPL(195,247),  SPL(195,255),  SPL(219,207),
+  SPL(203,247),  SPL(203,247),  SPL(203,247),  SPL(203,255),  SPL(203,255),  SPL(203,255),  SPL(211,247),  SPL(227,215),
+  SPL(211,255),  SPL(211,255),  SPL(211,255),  SPL(219,247),  SPL(219,247),  SPL(219,247),  SPL(219,255),  SPL(235,223),
+  SPL(227,247),  SPL(227,247),  SPL(227,247),  SPL(227,255),  SPL(227,255),  SPL(227,255),  SPL(235,247),  SPL(243,231),
+  SPL(235,255),  SPL(235,255),  SPL(235,255),  SPL(243,247),  SPL(243,247),  SPL(243,247),  SPL(243,255),  SPL(251,239),
+  SPL(251,247),  SPL(251,247),  SPL(251,247),  SPL(251,255),  SPL(251,255),  SPL(251,255),  SPL(251,255),  SPL(251,255)
 },{
-  {  4,  4},  {  4,  4},  {  4,  4},  {  4,  4},  {  4,  4},  {  4,  4},  {  4, 12},  {  4, 12},
-  {  4, 20},  {  4, 20},  {  4, 20},  {  4, 28},  { 12, 12},  {  4, 36},  {  4, 36},  {  4, 36},
-  {  4, 44},  {  4, 44},  {  4, 44},  {  4, 52},  { 20, 20},  {  4, 60},  {  4, 60},  {  4, 60},
-  {  4, 69},  {  4, 69},  {  4, 69},  {  4, 77},  { 28, 28},  {  4, 85},  {  4, 85},  {  4, 85},
-  {  4, 93},  {  4, 93},  {  4, 93},  {  4,101},  { 20, 69},  {  4,109},  {  4,109},  {  4,109},
-  {  4,117},  {  4,117},  {  4,117},  {  4,125},  { 28, 77},  {  4,134},  {  4,134},  { 69,  4},
-  {  4,142},  {  4,142},  { 69, 12},  {  4,150},  { 12,134},  { 77,  4},  {  4,158},  { 69, 28},
-  {  4,166},  {  4,166},  { 69, 36},  {  4,174},  { 20,142},  { 85, 12},  {  4,182},  { 69, 52},
-  {  4,190},  {  4,190},  { 69, 60},  {  4,199},  { 28,150},  { 69, 69},  {  4,207},  { 69, 77},
-  {  4,215},  {  4,215},  { 69, 85},  {  4,223},  { 36,158},  { 77, 77},  {  4,231},  { 69,101},
-  {  4,239},  {  4,239},  { 69,109},  {  4,247},  { 28,199},  { 85, 85},  {  4,255},  { 69,125},
-  { 12,247},  { 12,247},  { 69,134},  { 12,255},  { 36,207},  { 93, 93},  { 20,247},  { 69,150},
-  {134, 20},  { 20,255},  { 69,158},  { 28,247},  { 44,215},  { 85,134},  { 28,255},  { 69,174},
-  {134, 44},  { 36,247},  { 69,182},  { 36,255},  { 52,223},  { 93,142},  { 44,247},  { 69,199},
-  {134, 69},  { 44,255},  { 69,207},  { 52,247},  { 60,231},  { 77,199},  { 52,255},  { 69,223},
-  {134, 93},  { 60,247},  { 69,231},  { 60,255},  { 69,239},  { 85,207},  {150, 77},  { 69,247},
-  {134,117},  { 69,255},  { 69,255},  {134,125},  { 77,247},  { 93,215},  {134,134},  { 77,255},
-  {134,142},  {199, 12},  { 85,247},  {134,150},  { 85,255},  {101,223},  {142,142},  { 93,247},
-  {134,166},  {199, 36},  { 93,255},  {134,174},  {101,247},  {109,231},  {150,150},  {101,255},
-  {134,190},  {199, 60},  {109,247},  {134,199},  {109,255},  {117,239},  {158,158},  {117,247},
-  {134,215},  {199, 85},  {117,255},  {134,223},  {199, 93},  {125,247},  {150,199},  {125,255},
-  {134,239},  {199,109},  {134,247},  {134,247},  {199,117},  {134,255},  {158,207},  {223, 77},
-  {142,247},  {199,134},  {142,255},  {142,255},  {199,142},  {150,247},  {166,215},  {207,134},
-  {150,255},  {199,158},  {158,247},  {158,247},  {199,166},  {158,255},  {174,223},  {215,142},
-  {166,247},  {199,182},  {166,255},  {166,255},  {199,190},  {174,247},  {182,231},  {199,199},
-  {174,255},  {199,207},  {182,247},  {182,247},  {199,215},  {182,255},  {190,239},  {207,207},
-  {190,247},  {199,231},  {190,255},  {190,255},  {199,239},  {199,239},  {199,247},  {215,215},
-  {199,255},  {199,255},  {199,255},  {207,247},  {207,247},  {207,247},  {207,255},  {223,223},
-  {215,247},  {215,247},  {215,247},  {215,255},  {215,255},  {215,255},  {223,247},  {231,231},
-  {223,255},  {223,255},  {223,255},  {231,247},  {231,247},  {231,247},  {231,255},  {239,239},
-  {239,239},  {239,247},  {239,247},  {239,255},  {239,255},  {239,255},  {247,247},  {247,247},
-  {247,247},  {247,255},  {247,255},  {255,247},  {255,247},  {255,247},  {255,255},  {255,255}
+  SPL(  4,  4),  SPL(  4,  4),  SPL(  4,  4),  SPL(  4,  4),  SPL(  4,  4),  SPL(  4,  4),  SPL(  4, 12),  SPL(  4, 12),
+  SPL(  4, 20),  SPL(  4, 20),  SPL(  4, 20),  SPL(  4, 28),  SPL( 12, 12),  SPL(  4, 36),  SPL(  4, 36),  SPL(  4, 36),
+  SPL(  4, 44),  SPL(  4, 44),  SPL(  4, 44),  SPL(  4, 52),  SPL( 20, 20),  SPL(  4, 60),  SPL(  4, 60),  SPL(  4, 60),
+  SPL(  4, 69),  SPL(  4, 69),  SPL(  4, 69),  SPL(  4, 77),  SPL( 28, 28),  SPL(  4, 85),  SPL(  4, 85),  SPL(  4, 85),
+  SPL(  4, 93),  SPL(  4, 93),  SPL(  4, 93),  SPL(  4,101),  SPL( 20, 69),  SPL(  4,109),  SPL(  4,109),  SPL(  4,109),
+  SPL(  4,117),  SPL(  4,117),  SPL(  4,117),  SPL(  4,125),  SPL( 28, 77),  SPL(  4,134),  SPL(  4,134),  SPL( 69,  4),
+  SPL(  4,142),  SPL(  4,142),  SPL( 69, 12),  SPL(  4,150),  SPL( 12,134),  SPL( 77,  4),  SPL(  4,158),  SPL( 69, 28),
+  SPL(  4,166),  SPL(  4,166),  SPL( 69, 36),  SPL(  4,174),  SPL( 20,142),  SPL( 85, 12),  SPL(  4,182),  SPL( 69, 52),
+  SPL(  4,190),  SPL(  4,190),  SPL( 69, 60),  SPL(  4,199),  SPL( 28,150),  SPL( 69, 69),  SPL(  4,207),  SPL( 69, 77),
+  SPL(  4,215),  SPL(  4,215),  SPL( 69, 85),  SPL(  4,223),  SPL( 36,158),  SPL( 77, 77),  SPL(  4,231),  SPL( 69,101),
+  SPL(  4,239),  SPL(  4,239),  SPL( 69,109),  SPL(  4,247),  SPL( 28,199),  SPL( 85, 85),  SPL(  4,255),  SPL( 69,125),
+  SPL( 12,247),  SPL( 12,247),  SPL( 69,134),  SPL( 12,255),  SPL( 36,207),  SPL( 93, 93),  SPL( 20,247),  SPL( 69,150),
+  SPL(134, 20),  SPL( 20,255),  SPL( 69,158),  SPL( 28,247),  SPL( 44,215),  SPL( 85,134),  SPL( 28,255),  SPL( 69,174),
+  SPL(134, 44),  SPL( 36,247),  SPL( 69,182),  SPL( 36,255),  SPL( 52,223),  SPL( 93,142),  SPL( 44,247),  SPL( 69,199),
+  SPL(134, 69),  SPL( 44,255),  SPL( 69,207),  SPL( 52,247),  SPL( 60,231),  SPL( 77,199),  SPL( 52,255),  SPL( 69,223),
+  SPL(134, 93),  SPL( 60,247),  SPL( 69,231),  SPL( 60,255),  SPL( 69,239),  SPL( 85,207),  SPL(150, 77),  SPL( 69,247),
+  SPL(134,117),  SPL( 69,255),  SPL( 69,255),  SPL(134,125),  SPL( 77,247),  SPL( 93,215),  SPL(134,134),  SPL( 77,255),
+  SPL(134,142),  SPL(199, 12),  SPL( 85,247),  SPL(134,150),  SPL( 85,255),  SPL(101,223),  SPL(142,142),  SPL( 93,247),
+  SPL(134,166),  SPL(199, 36),  SPL( 93,255),  SPL(134,174),  SPL(101,247),  SPL(109,231),  SPL(150,150),  SPL(101,255),
+  SPL(134,190),  SPL(199, 60),  SPL(109,247),  SPL(134,199),  SPL(109,255),  SPL(117,239),  SPL(158,158),  SPL(117,247),
+  SPL(134,215),  SPL(199, 85),  SPL(117,255),  SPL(134,223),  SPL(199, 93),  SPL(125,247),  SPL(150,199),  SPL(125,255),
+  SPL(134,239),  SPL(199,109),  SPL(134,247),  SPL(134,247),  SPL(199,117),  SPL(134,255),  SPL(158,207),  SPL(223, 77),
+  SPL(142,247),  SPL(199,134),  SPL(142,255),  SPL(142,255),  SPL(199,142),  SPL(150,247),  SPL(166,215),  SPL(207,134),
+  SPL(150,255),  SPL(199,158),  SPL(158,247),  SPL(158,247),  SPL(199,166),  SPL(158,255),  SPL(174,223),  SPL(215,142),
+  SPL(166,247),  SPL(199,182),  SPL(166,255),  SPL(166,255),  SPL(199,190),  SPL(174,247),  SPL(182,231),  SPL(199,199),
+  SPL(174,255),  SPL(199,207),  SPL(182,247),  SPL(182,247),  SPL(199,215),  SPL(182,255),  SPL(190,239),  SPL(207,207),
+  SPL(190,247),  SPL(199,231),  SPL(190,255),  SPL(190,255),  SPL(199,239),  SPL(199,239),  SPL(199,247),  SPL(215,215),
+  SPL(199,255),  SPL(199,255),  SPL(199,255),  SPL(207,247),  SPL(207,247),  SPL(207,247),  SPL(207,255),  SPL(223,223),
+  SPL(215,247),  SPL(215,247),  SPL(215,247),  SPL(215,255),  SPL(215,255),  SPL(215,255),  SPL(223,247),  SPL(231,231),
+  SPL(223,255),  SPL(223,255),  SPL(223,255),  SPL(231,247),  SPL(231,247),  SPL(231,247),  SPL(231,255),  SPL(239,239),
+  SPL(239,239),  SPL(239,247),  SPL(239,247),  SPL(239,255),  SPL(239,255),  SPL(239,255),  SPL(247,247),  SPL(247,247),
+  SPL(247,247),  SPL(247,255),  SPL(247,255),  SPL(255,247),  SPL(255,247),  SPL(255,247),  SPL(255,255),  SPL(255,255)
 }
 };
 
@@ -2189,137 +2189,137 @@ static PaletteSingleLookup2 const sp_lookup_5u1_4[4][256] =
 static PaletteSingleLookup2 const sp_lookup_7u1_4[4][256] =
 {
 {
-  {  0,  0},  {  0,  4},  {  0,  8},  {  0, 10},  {  0, 14},  {  0, 16},  {  0, 20},  {  0, 22},
-  {  0, 26},  {  0, 28},  {  0, 32},  {  0, 34},  {  0, 38},  {  0, 40},  {  0, 44},  {  0, 46},
-  {  0, 50},  {  0, 52},  {  0, 56},  {  0, 58},  {  0, 62},  {  0, 64},  {  0, 68},  {  0, 72},
-  {  0, 74},  {  0, 78},  {  0, 80},  {  0, 84},  {  0, 86},  {  0, 90},  {  0, 92},  {  0, 96},
-  {  0, 98},  {  0,102},  {  0,104},  {  0,108},  {  0,110},  {  0,114},  {  0,116},  {  0,120},
-  {  0,122},  {  0,126},  {  0,128},  {  0,132},  {  0,136},  {  0,138},  {  0,142},  {  0,144},
-  {  0,148},  {  0,150},  {  0,154},  {  0,156},  {  0,160},  {  0,162},  {  0,166},  {  0,168},
-  {  0,172},  {  0,174},  {  0,178},  {  0,180},  {  0,184},  {  0,186},  {  0,190},  {  0,192},
-  {  0,196},  {  0,200},  {  0,202},  {  0,206},  {  0,208},  {  0,212},  {  0,214},  {  0,218},
-  {  0,220},  {  0,224},  {  0,226},  {  0,230},  {  0,232},  {  0,236},  {  0,238},  {  0,242},
-  {  0,244},  {  0,248},  {  0,250},  {  0,254},  {  2,252},  {  4,252},  {  4,254},  {  6,254},
-  {  8,252},  { 10,252},  { 10,254},  { 12,254},  { 14,252},  { 16,252},  { 16,254},  { 18,254},
-  { 20,252},  { 22,252},  { 22,254},  { 24,254},  { 26,252},  { 28,252},  { 28,254},  { 30,254},
-  { 32,252},  { 34,252},  { 34,254},  { 36,254},  { 38,252},  { 40,252},  { 40,254},  { 42,254},
-  { 44,252},  { 46,252},  { 46,254},  { 48,254},  { 50,252},  { 52,252},  { 52,254},  { 54,254},
-  { 56,252},  { 58,250},  { 58,254},  { 60,252},  { 62,252},  { 62,254},  { 64,254},  { 66,252},
-  { 68,252},  { 68,254},  { 70,254},  { 72,252},  { 74,252},  { 74,254},  { 76,254},  { 78,252},
-  { 80,252},  { 80,254},  { 82,254},  { 84,252},  { 86,252},  { 86,254},  { 88,254},  { 90,252},
-  { 92,252},  { 92,254},  { 94,254},  { 96,252},  { 98,252},  { 98,254},  {100,254},  {102,252},
-  {104,252},  {104,254},  {106,254},  {108,252},  {110,252},  {110,254},  {112,254},  {114,252},
-  {116,252},  {116,254},  {118,254},  {120,252},  {122,250},  {122,254},  {124,252},  {126,252},
-  {126,254},  {128,254},  {130,252},  {132,252},  {132,254},  {134,254},  {136,252},  {138,252},
-  {138,254},  {140,254},  {142,252},  {144,252},  {144,254},  {146,254},  {148,252},  {150,252},
-  {150,254},  {152,254},  {154,252},  {156,252},  {156,254},  {158,254},  {160,252},  {162,252},
-  {162,254},  {164,254},  {166,252},  {168,252},  {168,254},  {170,254},  {172,252},  {174,252},
-  {174,254},  {176,254},  {178,252},  {180,252},  {180,254},  {182,254},  {184,252},  {186,250},
-  {186,254},  {188,252},  {190,252},  {190,254},  {192,254},  {194,252},  {196,252},  {196,254},
-  {198,254},  {200,252},  {202,252},  {202,254},  {204,254},  {206,252},  {208,252},  {208,254},
-  {210,254},  {212,252},  {214,252},  {214,254},  {216,254},  {218,252},  {220,252},  {220,254},
-  {222,254},  {224,252},  {226,252},  {226,254},  {228,254},  {230,252},  {232,252},  {232,254},
-  {234,254},  {236,252},  {238,252},  {238,254},  {240,254},  {242,252},  {244,252},  {244,254},
-  {246,254},  {248,252},  {250,250},  {250,254},  {252,252},  {254,252},  {254,254},  {254,254}
+  SPL(  0,  0),  SPL(  0,  4),  SPL(  0,  8),  SPL(  0, 10),  SPL(  0, 14),  SPL(  0, 16),  SPL(  0, 20),  SPL(  0, 22),
+  SPL(  0, 26),  SPL(  0, 28),  SPL(  0, 32),  SPL(  0, 34),  SPL(  0, 38),  SPL(  0, 40),  SPL(  0, 44),  SPL(  0, 46),
+  SPL(  0, 50),  SPL(  0, 52),  SPL(  0, 56),  SPL(  0, 58),  SPL(  0, 62),  SPL(  0, 64),  SPL(  0, 68),  SPL(  0, 72),
+  SPL(  0, 74),  SPL(  0, 78),  SPL(  0, 80),  SPL(  0, 84),  SPL(  0, 86),  SPL(  0, 90),  SPL(  0, 92),  SPL(  0, 96),
+  SPL(  0, 98),  SPL(  0,102),  SPL(  0,104),  SPL(  0,108),  SPL(  0,110),  SPL(  0,114),  SPL(  0,116),  SPL(  0,120),
+  SPL(  0,122),  SPL(  0,126),  SPL(  0,128),  SPL(  0,132),  SPL(  0,136),  SPL(  0,138),  SPL(  0,142),  SPL(  0,144),
+  SPL(  0,148),  SPL(  0,150),  SPL(  0,154),  SPL(  0,156),  SPL(  0,160),  SPL(  0,162),  SPL(  0,166),  SPL(  0,168),
+  SPL(  0,172),  SPL(  0,174),  SPL(  0,178),  SPL(  0,180),  SPL(  0,184),  SPL(  0,186),  SPL(  0,190),  SPL(  0,192),
+  SPL(  0,196),  SPL(  0,200),  SPL(  0,202),  SPL(  0,206),  SPL(  0,208),  SPL(  0,212),  SPL(  0,214),  SPL(  0,218),
+  SPL(  0,220),  SPL(  0,224),  SPL(  0,226),  SPL(  0,230),  SPL(  0,232),  SPL(  0,236),  SPL(  0,238),  SPL(  0,242),
+  SPL(  0,244),  SPL(  0,248),  SPL(  0,250),  SPL(  0,254),  SPL(  2,252),  SPL(  4,252),  SPL(  4,254),  SPL(  6,254),
+  SPL(  8,252),  SPL( 10,252),  SPL( 10,254),  SPL( 12,254),  SPL( 14,252),  SPL( 16,252),  SPL( 16,254),  SPL( 18,254),
+  SPL( 20,252),  SPL( 22,252),  SPL( 22,254),  SPL( 24,254),  SPL( 26,252),  SPL( 28,252),  SPL( 28,254),  SPL( 30,254),
+  SPL( 32,252),  SPL( 34,252),  SPL( 34,254),  SPL( 36,254),  SPL( 38,252),  SPL( 40,252),  SPL( 40,254),  SPL( 42,254),
+  SPL( 44,252),  SPL( 46,252),  SPL( 46,254),  SPL( 48,254),  SPL( 50,252),  SPL( 52,252),  SPL( 52,254),  SPL( 54,254),
+  SPL( 56,252),  SPL( 58,250),  SPL( 58,254),  SPL( 60,252),  SPL( 62,252),  SPL( 62,254),  SPL( 64,254),  SPL( 66,252),
+  SPL( 68,252),  SPL( 68,254),  SPL( 70,254),  SPL( 72,252),  SPL( 74,252),  SPL( 74,254),  SPL( 76,254),  SPL( 78,252),
+  SPL( 80,252),  SPL( 80,254),  SPL( 82,254),  SPL( 84,252),  SPL( 86,252),  SPL( 86,254),  SPL( 88,254),  SPL( 90,252),
+  SPL( 92,252),  SPL( 92,254),  SPL( 94,254),  SPL( 96,252),  SPL( 98,252),  SPL( 98,254),  SPL(100,254),  SPL(102,252),
+  SPL(104,252),  SPL(104,254),  SPL(106,254),  SPL(108,252),  SPL(110,252),  SPL(110,254),  SPL(112,254),  SPL(114,252),
+  SPL(116,252),  SPL(116,254),  SPL(118,254),  SPL(120,252),  SPL(122,250),  SPL(122,254),  SPL(124,252),  SPL(126,252),
+  SPL(126,254),  SPL(128,254),  SPL(130,252),  SPL(132,252),  SPL(132,254),  SPL(134,254),  SPL(136,252),  SPL(138,252),
+  SPL(138,254),  SPL(140,254),  SPL(142,252),  SPL(144,252),  SPL(144,254),  SPL(146,254),  SPL(148,252),  SPL(150,252),
+  SPL(150,254),  SPL(152,254),  SPL(154,252),  SPL(156,252),  SPL(156,254),  SPL(158,254),  SPL(160,252),  SPL(162,252),
+  SPL(162,254),  SPL(164,254),  SPL(166,252),  SPL(168,252),  SPL(168,254),  SPL(170,254),  SPL(172,252),  SPL(174,252),
+  SPL(174,254),  SPL(176,254),  SPL(178,252),  SPL(180,252),  SPL(180,254),  SPL(182,254),  SPL(184,252),  SPL(186,250),
+  SPL(186,254),  SPL(188,252),  SPL(190,252),  SPL(190,254),  SPL(192,254),  SPL(194,252),  SPL(196,252),  SPL(196,254),
+  SPL(198,254),  SPL(200,252),  SPL(202,252),  SPL(202,254),  SPL(204,254),  SPL(206,252),  SPL(208,252),  SPL(208,254),
+  SPL(210,254),  SPL(212,252),  SPL(214,252),  SPL(214,254),  SPL(216,254),  SPL(218,252),  SPL(220,252),  SPL(220,254),
+  SPL(222,254),  SPL(224,252),  SPL(226,252),  SPL(226,254),  SPL(228,254),  SPL(230,252),  SPL(232,252),  SPL(232,254),
+  SPL(234,254),  SPL(236,252),  SPL(238,252),  SPL(238,254),  SPL(240,254),  SPL(242,252),  SPL(244,252),  SPL(244,254),
+  SPL(246,254),  SPL(248,252),  SPL(250,250),  SPL(250,254),  SPL(252,252),  SPL(254,252),  SPL(254,254),  SPL(254,254)
 },{
-  {  1,  0},  {  1,  2},  {  1,  6},  {  1,  8},  {  1, 12},  {  1, 14},  {  1, 18},  {  1, 20},
-  {  1, 24},  {  1, 26},  {  1, 30},  {  1, 32},  {  1, 36},  {  1, 38},  {  1, 42},  {  1, 44},
-  {  1, 48},  {  1, 50},  {  1, 54},  {  1, 56},  {  1, 60},  {  1, 62},  {  1, 66},  {  1, 70},
-  {  1, 72},  {  1, 76},  {  1, 78},  {  1, 82},  {  1, 84},  {  1, 88},  {  1, 90},  {  1, 94},
-  {  1, 96},  {  1,100},  {  1,102},  {  1,106},  {  1,108},  {  1,112},  {  1,114},  {  1,118},
-  {  1,120},  {  1,124},  {  1,126},  {  1,130},  {  1,134},  {  1,136},  {  1,140},  {  1,142},
-  {  1,146},  {  1,148},  {  1,152},  {  1,154},  {  1,158},  {  1,160},  {  1,164},  {  1,166},
-  {  1,170},  {  1,172},  {  1,176},  {  1,178},  {  1,182},  {  1,184},  {  1,188},  {  1,190},
-  {  1,194},  {  1,198},  {  1,200},  {  1,204},  {  1,206},  {  1,210},  {  1,212},  {  1,216},
-  {  1,218},  {  1,222},  {  1,224},  {  1,228},  {  1,230},  {  1,234},  {  1,236},  {  1,240},
-  {  1,242},  {  1,246},  {  1,248},  {  1,252},  {  1,254},  {  3,254},  {  5,252},  {  7,252},
-  {  7,254},  {  9,254},  { 11,252},  { 13,252},  { 13,254},  { 15,254},  { 17,252},  { 19,252},
-  { 19,254},  { 21,254},  { 23,252},  { 25,252},  { 25,254},  { 27,254},  { 29,252},  { 31,252},
-  { 31,254},  { 33,254},  { 35,252},  { 37,252},  { 37,254},  { 39,254},  { 41,252},  { 43,252},
-  { 43,254},  { 45,254},  { 47,252},  { 49,252},  { 49,254},  { 51,254},  { 53,252},  { 55,252},
-  { 55,254},  { 57,254},  { 59,252},  { 61,250},  { 61,254},  { 63,252},  { 65,252},  { 65,254},
-  { 67,254},  { 69,252},  { 71,252},  { 71,254},  { 73,254},  { 75,252},  { 77,252},  { 77,254},
-  { 79,254},  { 81,252},  { 83,252},  { 83,254},  { 85,254},  { 87,252},  { 89,252},  { 89,254},
-  { 91,254},  { 93,252},  { 95,252},  { 95,254},  { 97,254},  { 99,252},  {101,252},  {101,254},
-  {103,254},  {105,252},  {107,252},  {107,254},  {109,254},  {111,252},  {113,252},  {113,254},
-  {115,254},  {117,252},  {119,252},  {119,254},  {121,254},  {123,252},  {125,250},  {125,254},
-  {127,252},  {129,252},  {129,254},  {131,254},  {133,252},  {135,252},  {135,254},  {137,254},
-  {139,252},  {141,252},  {141,254},  {143,254},  {145,252},  {147,252},  {147,254},  {149,254},
-  {151,252},  {153,252},  {153,254},  {155,254},  {157,252},  {159,252},  {159,254},  {161,254},
-  {163,252},  {165,252},  {165,254},  {167,254},  {169,252},  {171,252},  {171,254},  {173,254},
-  {175,252},  {177,252},  {177,254},  {179,254},  {181,252},  {183,252},  {183,254},  {185,254},
-  {187,252},  {189,250},  {189,254},  {191,252},  {193,252},  {193,254},  {195,254},  {197,252},
-  {199,252},  {199,254},  {201,254},  {203,252},  {205,252},  {205,254},  {207,254},  {209,252},
-  {211,252},  {211,254},  {213,254},  {215,252},  {217,252},  {217,254},  {219,254},  {221,252},
-  {223,252},  {223,254},  {225,254},  {227,252},  {229,252},  {229,254},  {231,254},  {233,252},
-  {235,252},  {235,254},  {237,254},  {239,252},  {241,252},  {241,254},  {243,254},  {245,252},
-  {247,252},  {247,254},  {249,254},  {251,252},  {253,252},  {253,254},  {255,254},  {255,254}
+  SPL(  1,  0),  SPL(  1,  2),  SPL(  1,  6),  SPL(  1,  8),  SPL(  1, 12),  SPL(  1, 14),  SPL(  1, 18),  SPL(  1, 20),
+  SPL(  1, 24),  SPL(  1, 26),  SPL(  1, 30),  SPL(  1, 32),  SPL(  1, 36),  SPL(  1, 38),  SPL(  1, 42),  SPL(  1, 44),
+  SPL(  1, 48),  SPL(  1, 50),  SPL(  1, 54),  SPL(  1, 56),  SPL(  1, 60),  SPL(  1, 62),  SPL(  1, 66),  SPL(  1, 70),
+  SPL(  1, 72),  SPL(  1, 76),  SPL(  1, 78),  SPL(  1, 82),  SPL(  1, 84),  SPL(  1, 88),  SPL(  1, 90),  SPL(  1, 94),
+  SPL(  1, 96),  SPL(  1,100),  SPL(  1,102),  SPL(  1,106),  SPL(  1,108),  SPL(  1,112),  SPL(  1,114),  SPL(  1,118),
+  SPL(  1,120),  SPL(  1,124),  SPL(  1,126),  SPL(  1,130),  SPL(  1,134),  SPL(  1,136),  SPL(  1,140),  SPL(  1,142),
+  SPL(  1,146),  SPL(  1,148),  SPL(  1,152),  SPL(  1,154),  SPL(  1,158),  SPL(  1,160),  SPL(  1,164),  SPL(  1,166),
+  SPL(  1,170),  SPL(  1,172),  SPL(  1,176),  SPL(  1,178),  SPL(  1,182),  SPL(  1,184),  SPL(  1,188),  SPL(  1,190),
+  SPL(  1,194),  SPL(  1,198),  SPL(  1,200),  SPL(  1,204),  SPL(  1,206),  SPL(  1,210),  SPL(  1,212),  SPL(  1,216),
+  SPL(  1,218),  SPL(  1,222),  SPL(  1,224),  SPL(  1,228),  SPL(  1,230),  SPL(  1,234),  SPL(  1,236),  SPL(  1,240),
+  SPL(  1,242),  SPL(  1,246),  SPL(  1,248),  SPL(  1,252),  SPL(  1,254),  SPL(  3,254),  SPL(  5,252),  SPL(  7,252),
+  SPL(  7,254),  SPL(  9,254),  SPL( 11,252),  SPL( 13,252),  SPL( 13,254),  SPL( 15,254),  SPL( 17,252),  SPL( 19,252),
+  SPL( 19,254),  SPL( 21,254),  SPL( 23,252),  SPL( 25,252),  SPL( 25,254),  SPL( 27,254),  SPL( 29,252),  SPL( 31,252),
+  SPL( 31,254),  SPL( 33,254),  SPL( 35,252),  SPL( 37,252),  SPL( 37,254),  SPL( 39,254),  SPL( 41,252),  SPL( 43,252),
+  SPL( 43,254),  SPL( 45,254),  SPL( 47,252),  SPL( 49,252),  SPL( 49,254),  SPL( 51,254),  SPL( 53,252),  SPL( 55,252),
+  SPL( 55,254),  SPL( 57,254),  SPL( 59,252),  SPL( 61,250),  SPL( 61,254),  SPL( 63,252),  SPL( 65,252),  SPL( 65,254),
+  SPL( 67,254),  SPL( 69,252),  SPL( 71,252),  SPL( 71,254),  SPL( 73,254),  SPL( 75,252),  SPL( 77,252),  SPL( 77,254),
+  SPL( 79,254),  SPL( 81,252),  SPL( 83,252),  SPL( 83,254),  SPL( 85,254),  SPL( 87,252),  SPL( 89,252),  SPL( 89,254),
+  SPL( 91,254),  SPL( 93,252),  SPL( 95,252),  SPL( 95,254),  SPL( 97,254),  SPL( 99,252),  SPL(101,252),  SPL(101,254),
+  SPL(103,254),  SPL(105,252),  SPL(107,252),  SPL(107,254),  SPL(109,254),  SPL(111,252),  SPL(113,252),  SPL(113,254),
+  SPL(115,254),  SPL(117,252),  SPL(119,252),  SPL(119,254),  SPL(121,254),  SPL(123,252),  SPL(125,250),  SPL(125,254),
+  SPL(127,252),  SPL(129,252),  SPL(129,254),  SPL(131,254),  SPL(133,252),  SPL(135,252),  SPL(135,254),  SPL(137,254),
+  SPL(139,252),  SPL(141,252),  SPL(141,254),  SPL(143,254),  SPL(145,252),  SPL(147,252),  SPL(147,254),  SPL(149,254),
+  SPL(151,252),  SPL(153,252),  SPL(153,254),  SPL(155,254),  SPL(157,252),  SPL(159,252),  SPL(159,254),  SPL(161,254),
+  SPL(163,252),  SPL(165,252),  SPL(165,254),  SPL(167,254),  SPL(169,252),  SPL(171,252),  SPL(171,254),  SPL(173,254),
+  SPL(175,252),  SPL(177,252),  SPL(177,254),  SPL(179,254),  SPL(181,252),  SPL(183,252),  SPL(183,254),  SPL(185,254),
+  SPL(187,252),  SPL(189,250),  SPL(189,254),  SPL(191,252),  SPL(193,252),  SPL(193,254),  SPL(195,254),  SPL(197,252),
+  SPL(199,252),  SPL(199,254),  SPL(201,254),  SPL(203,252),  SPL(205,252),  SPL(205,254),  SPL(207,254),  SPL(209,252),
+  SPL(211,252),  SPL(211,254),  SPL(213,254),  SPL(215,252),  SPL(217,252),  SPL(217,254),  SPL(219,254),  SPL(221,252),
+  SPL(223,252),  SPL(223,254),  SPL(225,254),  SPL(227,252),  SPL(229,252),  SPL(229,254),  SPL(231,254),  SPL(233,252),
+  SPL(235,252),  SPL(235,254),  SPL(237,254),  SPL(239,252),  SPL(241,252),  SPL(241,254),  SPL(243,254),  SPL(245,252),
+  SPL(247,252),  SPL(247,254),  SPL(249,254),  SPL(251,252),  SPL(253,252),  SPL(253,254),  SPL(255,254),  SPL(255,254)
 },{
-  {  0,  1},  {  0,  5},  {  0,  7},  {  0, 11},  {  0, 13},  {  0, 17},  {  0, 19},  {  0, 23},
-  {  0, 25},  {  0, 29},  {  0, 31},  {  0, 35},  {  0, 37},  {  0, 41},  {  0, 43},  {  0, 47},
-  {  0, 49},  {  0, 53},  {  0, 55},  {  0, 59},  {  0, 61},  {  0, 65},  {  0, 69},  {  0, 71},
-  {  0, 75},  {  0, 77},  {  0, 81},  {  0, 83},  {  0, 87},  {  0, 89},  {  0, 93},  {  0, 95},
-  {  0, 99},  {  0,101},  {  0,105},  {  0,107},  {  0,111},  {  0,113},  {  0,117},  {  0,119},
-  {  0,123},  {  0,125},  {  0,129},  {  0,133},  {  0,135},  {  0,139},  {  0,141},  {  0,145},
-  {  0,147},  {  0,151},  {  0,153},  {  0,157},  {  0,159},  {  0,163},  {  0,165},  {  0,169},
-  {  0,171},  {  0,175},  {  0,177},  {  0,181},  {  0,183},  {  0,187},  {  0,189},  {  0,193},
-  {  0,197},  {  0,199},  {  0,203},  {  0,205},  {  0,209},  {  0,211},  {  0,215},  {  0,217},
-  {  0,221},  {  0,223},  {  0,227},  {  0,229},  {  0,233},  {  0,235},  {  0,239},  {  0,241},
-  {  0,245},  {  0,247},  {  0,251},  {  0,253},  {  2,253},  {  2,255},  {  4,255},  {  6,253},
-  {  8,253},  {  8,255},  { 10,255},  { 12,253},  { 14,253},  { 14,255},  { 16,255},  { 18,253},
-  { 20,253},  { 20,255},  { 22,255},  { 24,253},  { 26,253},  { 26,255},  { 28,255},  { 30,253},
-  { 32,253},  { 32,255},  { 34,255},  { 36,253},  { 38,253},  { 38,255},  { 40,255},  { 42,253},
-  { 44,253},  { 44,255},  { 46,255},  { 48,253},  { 50,253},  { 50,255},  { 52,255},  { 54,253},
-  { 56,253},  { 56,255},  { 58,255},  { 60,253},  { 62,251},  { 62,255},  { 64,253},  { 66,253},
-  { 66,255},  { 68,255},  { 70,253},  { 72,253},  { 72,255},  { 74,255},  { 76,253},  { 78,253},
-  { 78,255},  { 80,255},  { 82,253},  { 84,253},  { 84,255},  { 86,255},  { 88,253},  { 90,253},
-  { 90,255},  { 92,255},  { 94,253},  { 96,253},  { 96,255},  { 98,255},  {100,253},  {102,253},
-  {102,255},  {104,255},  {106,253},  {108,253},  {108,255},  {110,255},  {112,253},  {114,253},
-  {114,255},  {116,255},  {118,253},  {120,253},  {120,255},  {122,255},  {124,253},  {126,251},
-  {126,255},  {128,253},  {130,253},  {130,255},  {132,255},  {134,253},  {136,253},  {136,255},
-  {138,255},  {140,253},  {142,253},  {142,255},  {144,255},  {146,253},  {148,253},  {148,255},
-  {150,255},  {152,253},  {154,253},  {154,255},  {156,255},  {158,253},  {160,253},  {160,255},
-  {162,255},  {164,253},  {166,253},  {166,255},  {168,255},  {170,253},  {172,253},  {172,255},
-  {174,255},  {176,253},  {178,253},  {178,255},  {180,255},  {182,253},  {184,253},  {184,255},
-  {186,255},  {188,253},  {190,251},  {190,255},  {192,253},  {194,253},  {194,255},  {196,255},
-  {198,253},  {200,253},  {200,255},  {202,255},  {204,253},  {206,253},  {206,255},  {208,255},
-  {210,253},  {212,253},  {212,255},  {214,255},  {216,253},  {218,253},  {218,255},  {220,255},
-  {222,253},  {224,253},  {224,255},  {226,255},  {228,253},  {230,253},  {230,255},  {232,255},
-  {234,253},  {236,253},  {236,255},  {238,255},  {240,253},  {242,253},  {242,255},  {244,255},
-  {246,253},  {248,253},  {248,255},  {250,255},  {252,253},  {254,253},  {254,255},  {254,255}
+  SPL(  0,  1),  SPL(  0,  5),  SPL(  0,  7),  SPL(  0, 11),  SPL(  0, 13),  SPL(  0, 17),  SPL(  0, 19),  SPL(  0, 23),
+  SPL(  0, 25),  SPL(  0, 29),  SPL(  0, 31),  SPL(  0, 35),  SPL(  0, 37),  SPL(  0, 41),  SPL(  0, 43),  SPL(  0, 47),
+  SPL(  0, 49),  SPL(  0, 53),  SPL(  0, 55),  SPL(  0, 59),  SPL(  0, 61),  SPL(  0, 65),  SPL(  0, 69),  SPL(  0, 71),
+  SPL(  0, 75),  SPL(  0, 77),  SPL(  0, 81),  SPL(  0, 83),  SPL(  0, 87),  SPL(  0, 89),  SPL(  0, 93),  SPL(  0, 95),
+  SPL(  0, 99),  SPL(  0,101),  SPL(  0,105),  SPL(  0,107),  SPL(  0,111),  SPL(  0,113),  SPL(  0,117),  SPL(  0,119),
+  SPL(  0,123),  SPL(  0,125),  SPL(  0,129),  SPL(  0,133),  SPL(  0,135),  SPL(  0,139),  SPL(  0,141),  SPL(  0,145),
+  SPL(  0,147),  SPL(  0,151),  SPL(  0,153),  SPL(  0,157),  SPL(  0,159),  SPL(  0,163),  SPL(  0,165),  SPL(  0,169),
+  SPL(  0,171),  SPL(  0,175),  SPL(  0,177),  SPL(  0,181),  SPL(  0,183),  SPL(  0,187),  SPL(  0,189),  SPL(  0,193),
+  SPL(  0,197),  SPL(  0,199),  SPL(  0,203),  SPL(  0,205),  SPL(  0,209),  SPL(  0,211),  SPL(  0,215),  SPL(  0,217),
+  SPL(  0,221),  SPL(  0,223),  SPL(  0,227),  SPL(  0,229),  SPL(  0,233),  SPL(  0,235),  SPL(  0,239),  SPL(  0,241),
+  SPL(  0,245),  SPL(  0,247),  SPL(  0,251),  SPL(  0,253),  SPL(  2,253),  SPL(  2,255),  SPL(  4,255),  SPL(  6,253),
+  SPL(  8,253),  SPL(  8,255),  SPL( 10,255),  SPL( 12,253),  SPL( 14,253),  SPL( 14,255),  SPL( 16,255),  SPL( 18,253),
+  SPL( 20,253),  SPL( 20,255),  SPL( 22,255),  SPL( 24,253),  SPL( 26,253),  SPL( 26,255),  SPL( 28,255),  SPL( 30,253),
+  SPL( 32,253),  SPL( 32,255),  SPL( 34,255),  SPL( 36,253),  SPL( 38,253),  SPL( 38,255),  SPL( 40,255),  SPL( 42,253),
+  SPL( 44,253),  SPL( 44,255),  SPL( 46,255),  SPL( 48,253),  SPL( 50,253),  SPL( 50,255),  SPL( 52,255),  SPL( 54,253),
+  SPL( 56,253),  SPL( 56,255),  SPL( 58,255),  SPL( 60,253),  SPL( 62,251),  SPL( 62,255),  SPL( 64,253),  SPL( 66,253),
+  SPL( 66,255),  SPL( 68,255),  SPL( 70,253),  SPL( 72,253),  SPL( 72,255),  SPL( 74,255),  SPL( 76,253),  SPL( 78,253),
+  SPL( 78,255),  SPL( 80,255),  SPL( 82,253),  SPL( 84,253),  SPL( 84,255),  SPL( 86,255),  SPL( 88,253),  SPL( 90,253),
+  SPL( 90,255),  SPL( 92,255),  SPL( 94,253),  SPL( 96,253),  SPL( 96,255),  SPL( 98,255),  SPL(100,253),  SPL(102,253),
+  SPL(102,255),  SPL(104,255),  SPL(106,253),  SPL(108,253),  SPL(108,255),  SPL(110,255),  SPL(112,253),  SPL(114,253),
+  SPL(114,255),  SPL(116,255),  SPL(118,253),  SPL(120,253),  SPL(120,255),  SPL(122,255),  SPL(124,253),  SPL(126,251),
+  SPL(126,255),  SPL(128,253),  SPL(130,253),  SPL(130,255),  SPL(132,255),  SPL(134,253),  SPL(136,253),  SPL(136,255),
+  SPL(138,255),  SPL(140,253),  SPL(142,253),  SPL(142,255),  SPL(144,255),  SPL(146,253),  SPL(148,253),  SPL(148,255),
+  SPL(150,255),  SPL(152,253),  SPL(154,253),  SPL(154,255),  SPL(156,255),  SPL(158,253),  SPL(160,253),  SPL(160,255),
+  SPL(162,255),  SPL(164,253),  SPL(166,253),  SPL(166,255),  SPL(168,255),  SPL(170,253),  SPL(172,253),  SPL(172,255),
+  SPL(174,255),  SPL(176,253),  SPL(178,253),  SPL(178,255),  SPL(180,255),  SPL(182,253),  SPL(184,253),  SPL(184,255),
+  SPL(186,255),  SPL(188,253),  SPL(190,251),  SPL(190,255),  SPL(192,253),  SPL(194,253),  SPL(194,255),  SPL(196,255),
+  SPL(198,253),  SPL(200,253),  SPL(200,255),  SPL(202,255),  SPL(204,253),  SPL(206,253),  SPL(206,255),  SPL(208,255),
+  SPL(210,253),  SPL(212,253),  SPL(212,255),  SPL(214,255),  SPL(216,253),  SPL(218,253),  SPL(218,255),  SPL(220,255),
+  SPL(222,253),  SPL(224,253),  SPL(224,255),  SPL(226,255),  SPL(228,253),  SPL(230,253),  SPL(230,255),  SPL(232,255),
+  SPL(234,253),  SPL(236,253),  SPL(236,255),  SPL(238,255),  SPL(240,253),  SPL(242,253),  SPL(242,255),  SPL(244,255),
+  SPL(246,253),  SPL(248,253),  SPL(248,255),  SPL(250,255),  SPL(252,253),  SPL(254,253),  SPL(254,255),  SPL(254,255)
 },{
-  {  1,  1},  {  1,  1},  {  1,  5},  {  1,  9},  {  1, 11},  {  1, 15},  {  1, 17},  {  1, 21},
-  {  1, 23},  {  1, 27},  {  1, 29},  {  1, 33},  {  1, 35},  {  1, 39},  {  1, 41},  {  1, 45},
-  {  1, 47},  {  1, 51},  {  1, 53},  {  1, 57},  {  1, 59},  {  1, 63},  {  1, 65},  {  1, 69},
-  {  1, 73},  {  1, 75},  {  1, 79},  {  1, 81},  {  1, 85},  {  1, 87},  {  1, 91},  {  1, 93},
-  {  1, 97},  {  1, 99},  {  1,103},  {  1,105},  {  1,109},  {  1,111},  {  1,115},  {  1,117},
-  {  1,121},  {  1,123},  {  1,127},  {  1,129},  {  1,133},  {  1,137},  {  1,139},  {  1,143},
-  {  1,145},  {  1,149},  {  1,151},  {  1,155},  {  1,157},  {  1,161},  {  1,163},  {  1,167},
-  {  1,169},  {  1,173},  {  1,175},  {  1,179},  {  1,181},  {  1,185},  {  1,187},  {  1,191},
-  {  1,193},  {  1,197},  {  1,201},  {  1,203},  {  1,207},  {  1,209},  {  1,213},  {  1,215},
-  {  1,219},  {  1,221},  {  1,225},  {  1,227},  {  1,231},  {  1,233},  {  1,237},  {  1,239},
-  {  1,243},  {  1,245},  {  1,249},  {  1,251},  {  1,255},  {  3,253},  {  5,253},  {  5,255},
-  {  7,255},  {  9,253},  { 11,253},  { 11,255},  { 13,255},  { 15,253},  { 17,253},  { 17,255},
-  { 19,255},  { 21,253},  { 23,253},  { 23,255},  { 25,255},  { 27,253},  { 29,253},  { 29,255},
-  { 31,255},  { 33,253},  { 35,253},  { 35,255},  { 37,255},  { 39,253},  { 41,253},  { 41,255},
-  { 43,255},  { 45,253},  { 47,253},  { 47,255},  { 49,255},  { 51,253},  { 53,253},  { 53,255},
-  { 55,255},  { 57,253},  { 59,251},  { 59,255},  { 61,253},  { 63,253},  { 63,255},  { 65,255},
-  { 67,253},  { 69,253},  { 69,255},  { 71,255},  { 73,253},  { 75,253},  { 75,255},  { 77,255},
-  { 79,253},  { 81,253},  { 81,255},  { 83,255},  { 85,253},  { 87,253},  { 87,255},  { 89,255},
-  { 91,253},  { 93,253},  { 93,255},  { 95,255},  { 97,253},  { 99,253},  { 99,255},  {101,255},
-  {103,253},  {105,253},  {105,255},  {107,255},  {109,253},  {111,253},  {111,255},  {113,255},
-  {115,253},  {117,253},  {117,255},  {119,255},  {121,253},  {123,251},  {123,255},  {125,253},
-  {127,253},  {127,255},  {129,255},  {131,253},  {133,253},  {133,255},  {135,255},  {137,253},
-  {139,253},  {139,255},  {141,255},  {143,253},  {145,253},  {145,255},  {147,255},  {149,253},
-  {151,253},  {151,255},  {153,255},  {155,253},  {157,253},  {157,255},  {159,255},  {161,253},
-  {163,253},  {163,255},  {165,255},  {167,253},  {169,253},  {169,255},  {171,255},  {173,253},
-  {175,253},  {175,255},  {177,255},  {179,253},  {181,253},  {181,255},  {183,255},  {185,253},
-  {187,251},  {187,255},  {189,253},  {191,253},  {191,255},  {193,255},  {195,253},  {197,253},
-  {197,255},  {199,255},  {201,253},  {203,253},  {203,255},  {205,255},  {207,253},  {209,253},
-  {209,255},  {211,255},  {213,253},  {215,253},  {215,255},  {217,255},  {219,253},  {221,253},
-  {221,255},  {223,255},  {225,253},  {227,253},  {227,255},  {229,255},  {231,253},  {233,253},
-  {233,255},  {235,255},  {237,253},  {239,253},  {239,255},  {241,255},  {243,253},  {245,253},
-  {245,255},  {247,255},  {249,253},  {251,251},  {251,255},  {253,253},  {255,253},  {255,255}
+  SPL(  1,  1),  SPL(  1,  1),  SPL(  1,  5),  SPL(  1,  9),  SPL(  1, 11),  SPL(  1, 15),  SPL(  1, 17),  SPL(  1, 21),
+  SPL(  1, 23),  SPL(  1, 27),  SPL(  1, 29),  SPL(  1, 33),  SPL(  1, 35),  SPL(  1, 39),  SPL(  1, 41),  SPL(  1, 45),
+  SPL(  1, 47),  SPL(  1, 51),  SPL(  1, 53),  SPL(  1, 57),  SPL(  1, 59),  SPL(  1, 63),  SPL(  1, 65),  SPL(  1, 69),
+  SPL(  1, 73),  SPL(  1, 75),  SPL(  1, 79),  SPL(  1, 81),  SPL(  1, 85),  SPL(  1, 87),  SPL(  1, 91),  SPL(  1, 93),
+  SPL(  1, 97),  SPL(  1, 99),  SPL(  1,103),  SPL(  1,105),  SPL(  1,109),  SPL(  1,111),  SPL(  1,115),  SPL(  1,117),
+  SPL(  1,121),  SPL(  1,123),  SPL(  1,127),  SPL(  1,129),  SPL(  1,133),  SPL(  1,137),  SPL(  1,139),  SPL(  1,143),
+  SPL(  1,145),  SPL(  1,149),  SPL(  1,151),  SPL(  1,155),  SPL(  1,157),  SPL(  1,161),  SPL(  1,163),  SPL(  1,167),
+  SPL(  1,169),  SPL(  1,173),  SPL(  1,175),  SPL(  1,179),  SPL(  1,181),  SPL(  1,185),  SPL(  1,187),  SPL(  1,191),
+  SPL(  1,193),  SPL(  1,197),  SPL(  1,201),  SPL(  1,203),  SPL(  1,207),  SPL(  1,209),  SPL(  1,213),  SPL(  1,215),
+  SPL(  1,219),  SPL(  1,221),  SPL(  1,225),  SPL(  1,227),  SPL(  1,231),  SPL(  1,233),  SPL(  1,237),  SPL(  1,239),
+  SPL(  1,243),  SPL(  1,245),  SPL(  1,249),  SPL(  1,251),  SPL(  1,255),  SPL(  3,253),  SPL(  5,253),  SPL(  5,255),
+  SPL(  7,255),  SPL(  9,253),  SPL( 11,253),  SPL( 11,255),  SPL( 13,255),  SPL( 15,253),  SPL( 17,253),  SPL( 17,255),
+  SPL( 19,255),  SPL( 21,253),  SPL( 23,253),  SPL( 23,255),  SPL( 25,255),  SPL( 27,253),  SPL( 29,253),  SPL( 29,255),
+  SPL( 31,255),  SPL( 33,253),  SPL( 35,253),  SPL( 35,255),  SPL( 37,255),  SPL( 39,253),  SPL( 41,253),  SPL( 41,255),
+  SPL( 43,255),  SPL( 45,253),  SPL( 47,253),  SPL( 47,255),  SPL( 49,255),  SPL( 51,253),  SPL( 53,253),  SPL( 53,255),
+  SPL( 55,255),  SPL( 57,253),  SPL( 59,251),  SPL( 59,255),  SPL( 61,253),  SPL( 63,253),  SPL( 63,255),  SPL( 65,255),
+  SPL( 67,253),  SPL( 69,253),  SPL( 69,255),  SPL( 71,255),  SPL( 73,253),  SPL( 75,253),  SPL( 75,255),  SPL( 77,255),
+  SPL( 79,253),  SPL( 81,253),  SPL( 81,255),  SPL( 83,255),  SPL( 85,253),  SPL( 87,253),  SPL( 87,255),  SPL( 89,255),
+  SPL( 91,253),  SPL( 93,253),  SPL( 93,255),  SPL( 95,255),  SPL( 97,253),  SPL( 99,253),  SPL( 99,255),  SPL(101,255),
+  SPL(103,253),  SPL(105,253),  SPL(105,255),  SPL(107,255),  SPL(109,253),  SPL(111,253),  SPL(111,255),  SPL(113,255),
+  SPL(115,253),  SPL(117,253),  SPL(117,255),  SPL(119,255),  SPL(121,253),  SPL(123,251),  SPL(123,255),  SPL(125,253),
+  SPL(127,253),  SPL(127,255),  SPL(129,255),  SPL(131,253),  SPL(133,253),  SPL(133,255),  SPL(135,255),  SPL(137,253),
+  SPL(139,253),  SPL(139,255),  SPL(141,255),  SPL(143,253),  SPL(145,253),  SPL(145,255),  SPL(147,255),  SPL(149,253),
+  SPL(151,253),  SPL(151,255),  SPL(153,255),  SPL(155,253),  SPL(157,253),  SPL(157,255),  SPL(159,255),  SPL(161,253),
+  SPL(163,253),  SPL(163,255),  SPL(165,255),  SPL(167,253),  SPL(169,253),  SPL(169,255),  SPL(171,255),  SPL(173,253),
+  SPL(175,253),  SPL(175,255),  SPL(177,255),  SPL(179,253),  SPL(181,253),  SPL(181,255),  SPL(183,255),  SPL(185,253),
+  SPL(187,251),  SPL(187,255),  SPL(189,253),  SPL(191,253),  SPL(191,255),  SPL(193,255),  SPL(195,253),  SPL(197,253),
+  SPL(197,255),  SPL(199,255),  SPL(201,253),  SPL(203,253),  SPL(203,255),  SPL(205,255),  SPL(207,253),  SPL(209,253),
+  SPL(209,255),  SPL(211,255),  SPL(213,253),  SPL(215,253),  SPL(215,255),  SPL(217,255),  SPL(219,253),  SPL(221,253),
+  SPL(221,255),  SPL(223,255),  SPL(225,253),  SPL(227,253),  SPL(227,255),  SPL(229,255),  SPL(231,253),  SPL(233,253),
+  SPL(233,255),  SPL(235,255),  SPL(237,253),  SPL(239,253),  SPL(239,255),  SPL(241,255),  SPL(243,253),  SPL(245,253),
+  SPL(245,255),  SPL(247,255),  SPL(249,253),  SPL(251,251),  SPL(251,255),  SPL(253,253),  SPL(255,253),  SPL(255,255)
 }
 };
 
@@ -2327,137 +2327,137 @@ static PaletteSingleLookup2 const sp_lookup_7u1_4[4][256] =
 static PaletteSingleLookup4 const sp_lookup_4u1_8[4][256] =
 {
 {
-  {  0,  0},  {  0,  0},  {  0, 16},  {  0, 16},  {  0, 33},  {  0, 33},  {  0, 49},  {  0, 49},
-  {  0, 66},  {  0, 66},  {  0, 66},  {  0, 82},  {  0, 82},  {  0, 99},  {  0, 99},  {  0,115},
-  {  0,115},  {  0,115},  {  0,132},  {  0,132},  {  0,148},  {  0,148},  {  0,165},  {  0,165},
-  {  0,165},  {  0,181},  {  0,181},  {  0,198},  { 33,  0},  { 16,115},  {  0,214},  {  0,214},
-  {  0,231},  { 33, 33},  {  0,247},  { 33, 49},  { 16,165},  { 33, 66},  { 16,181},  { 16,181},
-  { 16,181},  { 16,198},  { 33, 99},  { 16,214},  { 33,115},  { 16,231},  { 16,231},  { 16,231},
-  { 16,247},  { 33,148},  { 33,148},  { 33,165},  { 33,165},  { 33,181},  { 33,181},  { 33,198},
-  { 33,198},  { 33,198},  { 33,214},  { 33,214},  { 33,231},  { 66, 33},  { 49,148},  { 33,247},
-  { 33,247},  { 49,165},  { 66, 66},  { 49,181},  { 66, 82},  { 49,198},  { 66, 99},  { 49,214},
-  { 49,214},  { 49,214},  { 49,231},  { 66,132},  { 49,247},  { 66,148},  { 66,148},  { 66,165},
-  { 66,165},  { 66,181},  { 66,181},  { 66,181},  { 66,198},  { 99,  0},  { 66,214},  { 99, 16},
-  { 66,231},  { 66,231},  { 66,231},  { 66,247},  { 66,247},  { 82,165},  { 99, 66},  { 82,181},
-  { 99, 82},  { 82,198},  { 82,198},  { 99, 99},  { 82,214},  { 99,115},  { 82,231},  { 99,132},
-  { 82,247},  { 82,247},  { 82,247},  { 99,165},  { 99,165},  { 99,165},  { 99,181},  { 99,181},
-  { 99,198},  {132,  0},  { 99,214},  { 99,214},  { 99,214},  { 99,231},  {132, 33},  { 99,247},
-  {132, 49},  {115,165},  {115,165},  {115,165},  {115,181},  {115,181},  {115,198},  {132, 99},
-  {115,214},  {132,115},  {115,231},  {115,231},  {132,132},  {115,247},  {132,148},  {132,148},
-  {132,165},  {132,165},  {132,181},  {132,181},  {132,198},  {132,198},  {132,198},  {132,214},
-  {165, 16},  {132,231},  {165, 33},  {132,247},  {132,247},  {132,247},  {148,165},  {165, 66},
-  {148,181},  {165, 82},  {148,198},  {148,198},  {148,198},  {148,214},  {148,214},  {148,231},
-  {165,132},  {148,247},  {165,148},  {165,148},  {181, 66},  {165,165},  {165,165},  {165,181},
-  {165,181},  {165,198},  {198,  0},  {165,214},  {198, 16},  {165,231},  {165,231},  {165,231},
-  {165,247},  {198, 49},  {181,165},  {198, 66},  {181,181},  {181,181},  {181,181},  {181,198},
-  {198, 99},  {181,214},  {198,115},  {181,231},  {181,231},  {181,231},  {181,247},  {181,247},
-  {198,165},  {198,165},  {198,181},  {198,181},  {198,181},  {214, 99},  {198,198},  {198,198},
-  {198,214},  {198,214},  {198,231},  {231, 33},  {198,247},  {231, 49},  {214,165},  {214,165},
-  {214,181},  {214,181},  {231, 82},  {214,198},  {231, 99},  {214,214},  {214,214},  {214,214},
-  {214,231},  {231,132},  {214,247},  {231,148},  {231,165},  {231,165},  {231,181},  {231,181},
-  {231,181},  {231,198},  {231,198},  {231,214},  {231,214},  {231,214},  {247,132},  {231,231},
-  {231,231},  {231,247},  {231,247},  {247,165},  {247,181},  {247,181},  {247,181},  {247,198},
-  {247,198},  {247,214},  {247,214},  {247,231},  {247,231},  {247,231},  {247,247},  {247,247},
-  {247,247},  {247,247},  {247,247},  {247,247},  {247,247},  {247,247},  {247,247},  {247,247}
+  SPL(  0,  0),  SPL(  0,  0),  SPL(  0, 16),  SPL(  0, 16),  SPL(  0, 33),  SPL(  0, 33),  SPL(  0, 49),  SPL(  0, 49),
+  SPL(  0, 66),  SPL(  0, 66),  SPL(  0, 66),  SPL(  0, 82),  SPL(  0, 82),  SPL(  0, 99),  SPL(  0, 99),  SPL(  0,115),
+  SPL(  0,115),  SPL(  0,115),  SPL(  0,132),  SPL(  0,132),  SPL(  0,148),  SPL(  0,148),  SPL(  0,165),  SPL(  0,165),
+  SPL(  0,165),  SPL(  0,181),  SPL(  0,181),  SPL(  0,198),  SPL( 33,  0),  SPL( 16,115),  SPL(  0,214),  SPL(  0,214),
+  SPL(  0,231),  SPL( 33, 33),  SPL(  0,247),  SPL( 33, 49),  SPL( 16,165),  SPL( 33, 66),  SPL( 16,181),  SPL( 16,181),
+  SPL( 16,181),  SPL( 16,198),  SPL( 33, 99),  SPL( 16,214),  SPL( 33,115),  SPL( 16,231),  SPL( 16,231),  SPL( 16,231),
+  SPL( 16,247),  SPL( 33,148),  SPL( 33,148),  SPL( 33,165),  SPL( 33,165),  SPL( 33,181),  SPL( 33,181),  SPL( 33,198),
+  SPL( 33,198),  SPL( 33,198),  SPL( 33,214),  SPL( 33,214),  SPL( 33,231),  SPL( 66, 33),  SPL( 49,148),  SPL( 33,247),
+  SPL( 33,247),  SPL( 49,165),  SPL( 66, 66),  SPL( 49,181),  SPL( 66, 82),  SPL( 49,198),  SPL( 66, 99),  SPL( 49,214),
+  SPL( 49,214),  SPL( 49,214),  SPL( 49,231),  SPL( 66,132),  SPL( 49,247),  SPL( 66,148),  SPL( 66,148),  SPL( 66,165),
+  SPL( 66,165),  SPL( 66,181),  SPL( 66,181),  SPL( 66,181),  SPL( 66,198),  SPL( 99,  0),  SPL( 66,214),  SPL( 99, 16),
+  SPL( 66,231),  SPL( 66,231),  SPL( 66,231),  SPL( 66,247),  SPL( 66,247),  SPL( 82,165),  SPL( 99, 66),  SPL( 82,181),
+  SPL( 99, 82),  SPL( 82,198),  SPL( 82,198),  SPL( 99, 99),  SPL( 82,214),  SPL( 99,115),  SPL( 82,231),  SPL( 99,132),
+  SPL( 82,247),  SPL( 82,247),  SPL( 82,247),  SPL( 99,165),  SPL( 99,165),  SPL( 99,165),  SPL( 99,181),  SPL( 99,181),
+  SPL( 99,198),  SPL(132,  0),  SPL( 99,214),  SPL( 99,214),  SPL( 99,214),  SPL( 99,231),  SPL(132, 33),  SPL( 99,247),
+  SPL(132, 49),  SPL(115,165),  SPL(115,165),  SPL(115,165),  SPL(115,181),  SPL(115,181),  SPL(115,198),  SPL(132, 99),
+  SPL(115,214),  SPL(132,115),  SPL(115,231),  SPL(115,231),  SPL(132,132),  SPL(115,247),  SPL(132,148),  SPL(132,148),
+  SPL(132,165),  SPL(132,165),  SPL(132,181),  SPL(132,181),  SPL(132,198),  SPL(132,198),  SPL(132,198),  SPL(132,214),
+  SPL(165, 16),  SPL(132,231),  SPL(165, 33),  SPL(132,247),  SPL(132,247),  SPL(132,247),  SPL(148,165),  SPL(165, 66),
+  SPL(148,181),  SPL(165, 82),  SPL(148,198),  SPL(148,198),  SPL(148,198),  SPL(148,214),  SPL(148,214),  SPL(148,231),
+  SPL(165,132),  SPL(148,247),  SPL(165,148),  SPL(165,148),  SPL(181, 66),  SPL(165,165),  SPL(165,165),  SPL(165,181),
+  SPL(165,181),  SPL(165,198),  SPL(198,  0),  SPL(165,214),  SPL(198, 16),  SPL(165,231),  SPL(165,231),  SPL(165,231),
+  SPL(165,247),  SPL(198, 49),  SPL(181,165),  SPL(198, 66),  SPL(181,181),  SPL(181,181),  SPL(181,181),  SPL(181,198),
+  SPL(198, 99),  SPL(181,214),  SPL(198,115),  SPL(181,231),  SPL(181,231),  SPL(181,231),  SPL(181,247),  SPL(181,247),
+  SPL(198,165),  SPL(198,165),  SPL(198,181),  SPL(198,181),  SPL(198,181),  SPL(214, 99),  SPL(198,198),  SPL(198,198),
+  SPL(198,214),  SPL(198,214),  SPL(198,231),  SPL(231, 33),  SPL(198,247),  SPL(231, 49),  SPL(214,165),  SPL(214,165),
+  SPL(214,181),  SPL(214,181),  SPL(231, 82),  SPL(214,198),  SPL(231, 99),  SPL(214,214),  SPL(214,214),  SPL(214,214),
+  SPL(214,231),  SPL(231,132),  SPL(214,247),  SPL(231,148),  SPL(231,165),  SPL(231,165),  SPL(231,181),  SPL(231,181),
+  SPL(231,181),  SPL(231,198),  SPL(231,198),  SPL(231,214),  SPL(231,214),  SPL(231,214),  SPL(247,132),  SPL(231,231),
+  SPL(231,231),  SPL(231,247),  SPL(231,247),  SPL(247,165),  SPL(247,181),  SPL(247,181),  SPL(247,181),  SPL(247,198),
+  SPL(247,198),  SPL(247,214),  SPL(247,214),  SPL(247,231),  SPL(247,231),  SPL(247,231),  SPL(247,247),  SPL(247,247),
+  SPL(247,247),  SPL(247,247),  SPL(247,247),  SPL(247,247),  SPL(247,247),  SPL(247,247),  SPL(247,247),  SPL(247,247)
 },{
-  {  8,  0},  {  8,  0},  {  8,  0},  {  8,  0},  {  8,  0},  {  8,  0},  {  8,  0},  {  8,  0},
-  {  8, 16},  {  8, 16},  {  8, 16},  {  8, 33},  {  8, 33},  {  8, 49},  {  8, 49},  {  8, 66},
-  {  8, 66},  {  8, 66},  {  8, 82},  {  8, 82},  {  8, 99},  {  8, 99},  { 24, 16},  {  8,115},
-  {  8,115},  {  8,132},  {  8,132},  {  8,148},  {  8,148},  { 24, 66},  {  8,165},  {  8,165},
-  {  8,181},  {  8,181},  {  8,198},  { 41,  0},  {  8,214},  { 41, 16},  {  8,231},  {  8,231},
-  {  8,231},  {  8,247},  { 41, 49},  { 24,165},  { 41, 66},  { 24,181},  { 24,181},  { 24,181},
-  { 24,198},  { 41, 99},  { 24,214},  { 41,115},  { 24,231},  { 24,231},  { 24,231},  { 24,247},
-  { 41,148},  { 41,148},  { 41,165},  { 41,165},  { 41,181},  { 41,181},  { 57, 99},  { 41,198},
-  { 41,198},  { 41,214},  { 41,214},  { 41,231},  { 74, 33},  { 41,247},  { 74, 49},  { 57,165},
-  { 57,165},  { 57,165},  { 57,181},  { 74, 82},  { 57,198},  { 74, 99},  { 57,214},  { 57,214},
-  { 57,214},  { 57,231},  { 74,132},  { 57,247},  { 74,148},  { 74,148},  { 74,165},  { 74,165},
-  { 90, 82},  { 74,181},  { 74,181},  { 74,198},  { 74,198},  { 74,214},  {107, 16},  { 90,132},
-  { 74,231},  { 74,231},  { 74,247},  { 74,247},  { 90,165},  {107, 66},  { 90,181},  {107, 82},
-  { 90,198},  { 90,198},  { 90,198},  { 90,214},  {107,115},  { 90,231},  {107,132},  { 90,247},
-  { 90,247},  { 90,247},  {123, 66},  {107,165},  {107,165},  {107,181},  {107,181},  {107,198},
-  {140,  0},  {123,115},  {107,214},  {107,214},  {107,231},  {107,231},  {107,247},  {140, 49},
-  {123,165},  {140, 66},  {123,181},  {123,181},  {123,181},  {123,198},  {140, 99},  {123,214},
-  {140,115},  {123,231},  {123,231},  {123,231},  {123,247},  {140,148},  {140,148},  {140,165},
-  {140,165},  {140,181},  {140,181},  {156, 99},  {140,198},  {140,198},  {140,214},  {140,214},
-  {140,231},  {173, 33},  {156,148},  {140,247},  {140,247},  {156,165},  {156,165},  {156,181},
-  {173, 82},  {156,198},  {173, 99},  {156,214},  {156,214},  {156,214},  {156,231},  {173,132},
-  {156,247},  {173,148},  {173,165},  {173,165},  {173,165},  {189, 82},  {173,181},  {173,181},
-  {173,198},  {206,  0},  {173,214},  {206, 16},  {189,132},  {173,231},  {173,231},  {173,247},
-  {173,247},  {189,165},  {206, 66},  {189,181},  {206, 82},  {189,198},  {189,198},  {189,198},
-  {189,214},  {206,115},  {189,231},  {206,132},  {189,247},  {189,247},  {189,247},  {206,165},
-  {206,165},  {206,181},  {206,181},  {206,198},  {206,198},  {239,  0},  {222,115},  {206,214},
-  {206,214},  {206,231},  {239, 33},  {206,247},  {239, 49},  {222,165},  {239, 66},  {222,181},
-  {222,181},  {222,198},  {222,198},  {239, 99},  {222,214},  {239,115},  {222,231},  {222,231},
-  {222,231},  {222,247},  {239,148},  {239,165},  {239,165},  {239,181},  {239,181},  {239,181},
-  {239,198},  {239,198},  {239,214},  {239,214},  {239,231},  {239,231},  {239,231},  {255,148},
-  {239,247},  {239,247},  {255,165},  {255,181},  {255,181},  {255,198},  {255,198},  {255,198},
-  {255,214},  {255,214},  {255,231},  {255,231},  {255,247},  {255,247},  {255,247},  {255,247}
+  SPL(  8,  0),  SPL(  8,  0),  SPL(  8,  0),  SPL(  8,  0),  SPL(  8,  0),  SPL(  8,  0),  SPL(  8,  0),  SPL(  8,  0),
+  SPL(  8, 16),  SPL(  8, 16),  SPL(  8, 16),  SPL(  8, 33),  SPL(  8, 33),  SPL(  8, 49),  SPL(  8, 49),  SPL(  8, 66),
+  SPL(  8, 66),  SPL(  8, 66),  SPL(  8, 82),  SPL(  8, 82),  SPL(  8, 99),  SPL(  8, 99),  SPL( 24, 16),  SPL(  8,115),
+  SPL(  8,115),  SPL(  8,132),  SPL(  8,132),  SPL(  8,148),  SPL(  8,148),  SPL( 24, 66),  SPL(  8,165),  SPL(  8,165),
+  SPL(  8,181),  SPL(  8,181),  SPL(  8,198),  SPL( 41,  0),  SPL(  8,214),  SPL( 41, 16),  SPL(  8,231),  SPL(  8,231),
+  SPL(  8,231),  SPL(  8,247),  SPL( 41, 49),  SPL( 24,165),  SPL( 41, 66),  SPL( 24,181),  SPL( 24,181),  SPL( 24,181),
+  SPL( 24,198),  SPL( 41, 99),  SPL( 24,214),  SPL( 41,115),  SPL( 24,231),  SPL( 24,231),  SPL( 24,231),  SPL( 24,247),
+  SPL( 41,148),  SPL( 41,148),  SPL( 41,165),  SPL( 41,165),  SPL( 41,181),  SPL( 41,181),  SPL( 57, 99),  SPL( 41,198),
+  SPL( 41,198),  SPL( 41,214),  SPL( 41,214),  SPL( 41,231),  SPL( 74, 33),  SPL( 41,247),  SPL( 74, 49),  SPL( 57,165),
+  SPL( 57,165),  SPL( 57,165),  SPL( 57,181),  SPL( 74, 82),  SPL( 57,198),  SPL( 74, 99),  SPL( 57,214),  SPL( 57,214),
+  SPL( 57,214),  SPL( 57,231),  SPL( 74,132),  SPL( 57,247),  SPL( 74,148),  SPL( 74,148),  SPL( 74,165),  SPL( 74,165),
+  SPL( 90, 82),  SPL( 74,181),  SPL( 74,181),  SPL( 74,198),  SPL( 74,198),  SPL( 74,214),  SPL(107, 16),  SPL( 90,132),
+  SPL( 74,231),  SPL( 74,231),  SPL( 74,247),  SPL( 74,247),  SPL( 90,165),  SPL(107, 66),  SPL( 90,181),  SPL(107, 82),
+  SPL( 90,198),  SPL( 90,198),  SPL( 90,198),  SPL( 90,214),  SPL(107,115),  SPL( 90,231),  SPL(107,132),  SPL( 90,247),
+  SPL( 90,247),  SPL( 90,247),  SPL(123, 66),  SPL(107,165),  SPL(107,165),  SPL(107,181),  SPL(107,181),  SPL(107,198),
+  SPL(140,  0),  SPL(123,115),  SPL(107,214),  SPL(107,214),  SPL(107,231),  SPL(107,231),  SPL(107,247),  SPL(140, 49),
+  SPL(123,165),  SPL(140, 66),  SPL(123,181),  SPL(123,181),  SPL(123,181),  SPL(123,198),  SPL(140, 99),  SPL(123,214),
+  SPL(140,115),  SPL(123,231),  SPL(123,231),  SPL(123,231),  SPL(123,247),  SPL(140,148),  SPL(140,148),  SPL(140,165),
+  SPL(140,165),  SPL(140,181),  SPL(140,181),  SPL(156, 99),  SPL(140,198),  SPL(140,198),  SPL(140,214),  SPL(140,214),
+  SPL(140,231),  SPL(173, 33),  SPL(156,148),  SPL(140,247),  SPL(140,247),  SPL(156,165),  SPL(156,165),  SPL(156,181),
+  SPL(173, 82),  SPL(156,198),  SPL(173, 99),  SPL(156,214),  SPL(156,214),  SPL(156,214),  SPL(156,231),  SPL(173,132),
+  SPL(156,247),  SPL(173,148),  SPL(173,165),  SPL(173,165),  SPL(173,165),  SPL(189, 82),  SPL(173,181),  SPL(173,181),
+  SPL(173,198),  SPL(206,  0),  SPL(173,214),  SPL(206, 16),  SPL(189,132),  SPL(173,231),  SPL(173,231),  SPL(173,247),
+  SPL(173,247),  SPL(189,165),  SPL(206, 66),  SPL(189,181),  SPL(206, 82),  SPL(189,198),  SPL(189,198),  SPL(189,198),
+  SPL(189,214),  SPL(206,115),  SPL(189,231),  SPL(206,132),  SPL(189,247),  SPL(189,247),  SPL(189,247),  SPL(206,165),
+  SPL(206,165),  SPL(206,181),  SPL(206,181),  SPL(206,198),  SPL(206,198),  SPL(239,  0),  SPL(222,115),  SPL(206,214),
+  SPL(206,214),  SPL(206,231),  SPL(239, 33),  SPL(206,247),  SPL(239, 49),  SPL(222,165),  SPL(239, 66),  SPL(222,181),
+  SPL(222,181),  SPL(222,198),  SPL(222,198),  SPL(239, 99),  SPL(222,214),  SPL(239,115),  SPL(222,231),  SPL(222,231),
+  SPL(222,231),  SPL(222,247),  SPL(239,148),  SPL(239,165),  SPL(239,165),  SPL(239,181),  SPL(239,181),  SPL(239,181),
+  SPL(239,198),  SPL(239,198),  SPL(239,214),  SPL(239,214),  SPL(239,231),  SPL(239,231),  SPL(239,231),  SPL(255,148),
+  SPL(239,247),  SPL(239,247),  SPL(255,165),  SPL(255,181),  SPL(255,181),  SPL(255,198),  SPL(255,198),  SPL(255,198),
+  SPL(255,214),  SPL(255,214),  SPL(255,231),  SPL(255,231),  SPL(255,247),  SPL(255,247),  SPL(255,247),  SPL(255,247)
 },{
-  {  0,  8},  {  0,  8},  {  0,  8},  {  0, 24},  {  0, 24},  {  0, 41},  {  0, 41},  {  0, 57},
-  {  0, 57},  {  0, 57},  {  0, 74},  {  0, 74},  {  0, 90},  {  0, 90},  { 16,  8},  {  0,107},
-  {  0,107},  {  0,123},  {  0,123},  {  0,140},  {  0,140},  {  0,156},  {  0,156},  {  0,173},
-  {  0,173},  {  0,173},  {  0,189},  {  0,189},  {  0,206},  { 33,  8},  {  0,222},  {  0,222},
-  {  0,222},  {  0,239},  { 33, 41},  {  0,255},  { 33, 57},  { 16,173},  { 16,173},  { 16,173},
-  { 16,189},  { 33, 90},  { 16,206},  { 33,107},  { 16,222},  { 33,123},  { 16,239},  { 16,239},
-  { 33,140},  { 16,255},  { 33,156},  { 33,156},  { 33,173},  { 33,173},  { 33,189},  { 33,189},
-  { 33,206},  { 33,206},  { 33,206},  { 33,222},  { 66, 24},  { 33,239},  { 66, 41},  { 33,255},
-  { 33,255},  { 33,255},  { 49,173},  { 66, 74},  { 49,189},  { 66, 90},  { 49,206},  { 49,206},
-  { 49,206},  { 49,222},  { 66,123},  { 49,239},  { 66,140},  { 49,255},  { 66,156},  { 66,156},
-  { 82, 74},  { 66,173},  { 66,173},  { 66,189},  { 66,189},  { 66,206},  { 99,  8},  { 66,222},
-  { 99, 24},  { 66,239},  { 66,239},  { 66,239},  { 66,255},  { 99, 57},  { 82,173},  { 99, 74},
-  { 82,189},  { 82,189},  { 82,189},  { 82,206},  { 99,107},  { 82,222},  { 99,123},  { 82,239},
-  { 82,239},  { 82,239},  { 82,255},  { 99,156},  { 99,156},  { 99,173},  { 99,173},  { 99,189},
-  { 99,189},  {115,107},  { 99,206},  { 99,206},  { 99,222},  { 99,222},  { 99,239},  {132, 41},
-  { 99,255},  {132, 57},  {115,173},  {115,173},  {115,173},  {115,189},  {132, 90},  {115,206},
-  {132,107},  {115,222},  {115,222},  {115,222},  {115,239},  {132,140},  {115,255},  {132,156},
-  {132,156},  {132,173},  {132,173},  {148, 90},  {132,189},  {132,189},  {132,206},  {132,206},
-  {132,222},  {165, 24},  {148,140},  {132,239},  {132,239},  {132,255},  {132,255},  {148,173},
-  {165, 74},  {148,189},  {165, 90},  {148,206},  {148,206},  {148,206},  {148,222},  {165,123},
-  {148,239},  {165,140},  {148,255},  {148,255},  {148,255},  {181, 74},  {165,173},  {165,173},
-  {165,189},  {165,189},  {165,206},  {198,  8},  {181,123},  {165,222},  {165,222},  {165,239},
-  {165,239},  {165,255},  {198, 57},  {181,173},  {198, 74},  {181,189},  {181,189},  {181,189},
-  {181,206},  {198,107},  {181,222},  {198,123},  {181,239},  {181,239},  {181,239},  {181,255},
-  {198,156},  {198,173},  {198,173},  {198,189},  {198,189},  {198,189},  {214,107},  {198,206},
-  {198,206},  {198,222},  {198,222},  {198,239},  {231, 41},  {214,156},  {198,255},  {198,255},
-  {214,173},  {214,189},  {214,189},  {231, 90},  {214,206},  {231,107},  {214,222},  {214,222},
-  {214,222},  {214,239},  {231,140},  {214,255},  {231,156},  {231,173},  {231,173},  {231,173},
-  {247, 90},  {231,189},  {231,206},  {231,206},  {231,222},  {231,222},  {231,222},  {247,140},
-  {231,239},  {231,239},  {231,255},  {231,255},  {247,173},  {247,189},  {247,189},  {247,189},
-  {247,206},  {247,206},  {247,222},  {247,222},  {247,239},  {247,239},  {247,239},  {247,255},
-  {247,255},  {247,255},  {247,255},  {247,255},  {247,255},  {247,255},  {247,255},  {247,255}
+  SPL(  0,  8),  SPL(  0,  8),  SPL(  0,  8),  SPL(  0, 24),  SPL(  0, 24),  SPL(  0, 41),  SPL(  0, 41),  SPL(  0, 57),
+  SPL(  0, 57),  SPL(  0, 57),  SPL(  0, 74),  SPL(  0, 74),  SPL(  0, 90),  SPL(  0, 90),  SPL( 16,  8),  SPL(  0,107),
+  SPL(  0,107),  SPL(  0,123),  SPL(  0,123),  SPL(  0,140),  SPL(  0,140),  SPL(  0,156),  SPL(  0,156),  SPL(  0,173),
+  SPL(  0,173),  SPL(  0,173),  SPL(  0,189),  SPL(  0,189),  SPL(  0,206),  SPL( 33,  8),  SPL(  0,222),  SPL(  0,222),
+  SPL(  0,222),  SPL(  0,239),  SPL( 33, 41),  SPL(  0,255),  SPL( 33, 57),  SPL( 16,173),  SPL( 16,173),  SPL( 16,173),
+  SPL( 16,189),  SPL( 33, 90),  SPL( 16,206),  SPL( 33,107),  SPL( 16,222),  SPL( 33,123),  SPL( 16,239),  SPL( 16,239),
+  SPL( 33,140),  SPL( 16,255),  SPL( 33,156),  SPL( 33,156),  SPL( 33,173),  SPL( 33,173),  SPL( 33,189),  SPL( 33,189),
+  SPL( 33,206),  SPL( 33,206),  SPL( 33,206),  SPL( 33,222),  SPL( 66, 24),  SPL( 33,239),  SPL( 66, 41),  SPL( 33,255),
+  SPL( 33,255),  SPL( 33,255),  SPL( 49,173),  SPL( 66, 74),  SPL( 49,189),  SPL( 66, 90),  SPL( 49,206),  SPL( 49,206),
+  SPL( 49,206),  SPL( 49,222),  SPL( 66,123),  SPL( 49,239),  SPL( 66,140),  SPL( 49,255),  SPL( 66,156),  SPL( 66,156),
+  SPL( 82, 74),  SPL( 66,173),  SPL( 66,173),  SPL( 66,189),  SPL( 66,189),  SPL( 66,206),  SPL( 99,  8),  SPL( 66,222),
+  SPL( 99, 24),  SPL( 66,239),  SPL( 66,239),  SPL( 66,239),  SPL( 66,255),  SPL( 99, 57),  SPL( 82,173),  SPL( 99, 74),
+  SPL( 82,189),  SPL( 82,189),  SPL( 82,189),  SPL( 82,206),  SPL( 99,107),  SPL( 82,222),  SPL( 99,123),  SPL( 82,239),
+  SPL( 82,239),  SPL( 82,239),  SPL( 82,255),  SPL( 99,156),  SPL( 99,156),  SPL( 99,173),  SPL( 99,173),  SPL( 99,189),
+  SPL( 99,189),  SPL(115,107),  SPL( 99,206),  SPL( 99,206),  SPL( 99,222),  SPL( 99,222),  SPL( 99,239),  SPL(132, 41),
+  SPL( 99,255),  SPL(132, 57),  SPL(115,173),  SPL(115,173),  SPL(115,173),  SPL(115,189),  SPL(132, 90),  SPL(115,206),
+  SPL(132,107),  SPL(115,222),  SPL(115,222),  SPL(115,222),  SPL(115,239),  SPL(132,140),  SPL(115,255),  SPL(132,156),
+  SPL(132,156),  SPL(132,173),  SPL(132,173),  SPL(148, 90),  SPL(132,189),  SPL(132,189),  SPL(132,206),  SPL(132,206),
+  SPL(132,222),  SPL(165, 24),  SPL(148,140),  SPL(132,239),  SPL(132,239),  SPL(132,255),  SPL(132,255),  SPL(148,173),
+  SPL(165, 74),  SPL(148,189),  SPL(165, 90),  SPL(148,206),  SPL(148,206),  SPL(148,206),  SPL(148,222),  SPL(165,123),
+  SPL(148,239),  SPL(165,140),  SPL(148,255),  SPL(148,255),  SPL(148,255),  SPL(181, 74),  SPL(165,173),  SPL(165,173),
+  SPL(165,189),  SPL(165,189),  SPL(165,206),  SPL(198,  8),  SPL(181,123),  SPL(165,222),  SPL(165,222),  SPL(165,239),
+  SPL(165,239),  SPL(165,255),  SPL(198, 57),  SPL(181,173),  SPL(198, 74),  SPL(181,189),  SPL(181,189),  SPL(181,189),
+  SPL(181,206),  SPL(198,107),  SPL(181,222),  SPL(198,123),  SPL(181,239),  SPL(181,239),  SPL(181,239),  SPL(181,255),
+  SPL(198,156),  SPL(198,173),  SPL(198,173),  SPL(198,189),  SPL(198,189),  SPL(198,189),  SPL(214,107),  SPL(198,206),
+  SPL(198,206),  SPL(198,222),  SPL(198,222),  SPL(198,239),  SPL(231, 41),  SPL(214,156),  SPL(198,255),  SPL(198,255),
+  SPL(214,173),  SPL(214,189),  SPL(214,189),  SPL(231, 90),  SPL(214,206),  SPL(231,107),  SPL(214,222),  SPL(214,222),
+  SPL(214,222),  SPL(214,239),  SPL(231,140),  SPL(214,255),  SPL(231,156),  SPL(231,173),  SPL(231,173),  SPL(231,173),
+  SPL(247, 90),  SPL(231,189),  SPL(231,206),  SPL(231,206),  SPL(231,222),  SPL(231,222),  SPL(231,222),  SPL(247,140),
+  SPL(231,239),  SPL(231,239),  SPL(231,255),  SPL(231,255),  SPL(247,173),  SPL(247,189),  SPL(247,189),  SPL(247,189),
+  SPL(247,206),  SPL(247,206),  SPL(247,222),  SPL(247,222),  SPL(247,239),  SPL(247,239),  SPL(247,239),  SPL(247,255),
+  SPL(247,255),  SPL(247,255),  SPL(247,255),  SPL(247,255),  SPL(247,255),  SPL(247,255),  SPL(247,255),  SPL(247,255)
 },{
-  {  8,  8},  {  8,  8},  {  8,  8},  {  8,  8},  {  8,  8},  {  8,  8},  {  8,  8},  {  8,  8},
-  {  8,  8},  {  8,  8},  {  8, 24},  {  8, 24},  {  8, 41},  {  8, 41},  {  8, 57},  {  8, 57},
-  {  8, 74},  {  8, 74},  {  8, 74},  {  8, 90},  {  8, 90},  {  8,107},  {  8,107},  {  8,123},
-  {  8,123},  {  8,123},  {  8,140},  {  8,140},  {  8,156},  {  8,156},  {  8,173},  {  8,173},
-  {  8,173},  {  8,189},  {  8,189},  {  8,206},  { 41,  8},  { 24,123},  {  8,222},  {  8,222},
-  {  8,239},  { 41, 41},  {  8,255},  { 41, 57},  { 24,173},  { 41, 74},  { 24,189},  { 24,189},
-  { 24,189},  { 24,206},  { 41,107},  { 24,222},  { 41,123},  { 24,239},  { 24,239},  { 24,239},
-  { 24,255},  { 41,156},  { 41,156},  { 41,173},  { 41,173},  { 41,189},  { 41,189},  { 41,206},
-  { 41,206},  { 41,206},  { 41,222},  { 41,222},  { 41,239},  { 74, 41},  { 57,156},  { 41,255},
-  { 41,255},  { 57,173},  { 74, 74},  { 57,189},  { 74, 90},  { 57,206},  { 74,107},  { 57,222},
-  { 57,222},  { 57,222},  { 57,239},  { 74,140},  { 57,255},  { 74,156},  { 74,156},  { 74,173},
-  { 74,173},  { 74,189},  { 74,189},  { 74,189},  { 74,206},  {107,  8},  { 74,222},  {107, 24},
-  { 74,239},  { 74,239},  { 74,239},  { 74,255},  { 74,255},  { 90,173},  {107, 74},  { 90,189},
-  {107, 90},  { 90,206},  { 90,206},  {107,107},  { 90,222},  {107,123},  { 90,239},  {107,140},
-  { 90,255},  { 90,255},  { 90,255},  {107,173},  {107,173},  {107,173},  {107,189},  {107,189},
-  {107,206},  {140,  8},  {107,222},  {107,222},  {107,222},  {107,239},  {140, 41},  {107,255},
-  {140, 57},  {123,173},  {123,173},  {123,173},  {123,189},  {123,189},  {123,206},  {140,107},
-  {123,222},  {140,123},  {123,239},  {123,239},  {140,140},  {123,255},  {140,156},  {140,156},
-  {140,173},  {140,173},  {140,189},  {140,189},  {140,206},  {140,206},  {140,206},  {140,222},
-  {173, 24},  {140,239},  {173, 41},  {140,255},  {140,255},  {140,255},  {156,173},  {173, 74},
-  {156,189},  {173, 90},  {156,206},  {156,206},  {156,206},  {156,222},  {156,222},  {156,239},
-  {173,140},  {156,255},  {173,156},  {173,156},  {189, 74},  {173,173},  {173,173},  {173,189},
-  {173,189},  {173,206},  {206,  8},  {173,222},  {206, 24},  {173,239},  {173,239},  {173,239},
-  {173,255},  {206, 57},  {189,173},  {206, 74},  {189,189},  {189,189},  {189,189},  {189,206},
-  {206,107},  {189,222},  {206,123},  {189,239},  {189,239},  {189,239},  {189,255},  {189,255},
-  {206,173},  {206,173},  {206,189},  {206,189},  {206,189},  {222,107},  {206,206},  {206,206},
-  {206,222},  {206,222},  {206,239},  {239, 41},  {206,255},  {239, 57},  {222,173},  {222,173},
-  {222,189},  {222,189},  {239, 90},  {222,206},  {239,107},  {222,222},  {222,222},  {222,222},
-  {222,239},  {239,140},  {222,255},  {239,156},  {239,173},  {239,173},  {239,189},  {239,189},
-  {239,189},  {239,206},  {239,206},  {239,222},  {239,222},  {239,222},  {255,140},  {239,239},
-  {239,239},  {239,255},  {239,255},  {255,173},  {255,189},  {255,189},  {255,189},  {255,206},
-  {255,206},  {255,222},  {255,222},  {255,239},  {255,239},  {255,239},  {255,255},  {255,255}
+  SPL(  8,  8),  SPL(  8,  8),  SPL(  8,  8),  SPL(  8,  8),  SPL(  8,  8),  SPL(  8,  8),  SPL(  8,  8),  SPL(  8,  8),
+  SPL(  8,  8),  SPL(  8,  8),  SPL(  8, 24),  SPL(  8, 24),  SPL(  8, 41),  SPL(  8, 41),  SPL(  8, 57),  SPL(  8, 57),
+  SPL(  8, 74),  SPL(  8, 74),  SPL(  8, 74),  SPL(  8, 90),  SPL(  8, 90),  SPL(  8,107),  SPL(  8,107),  SPL(  8,123),
+  SPL(  8,123),  SPL(  8,123),  SPL(  8,140),  SPL(  8,140),  SPL(  8,156),  SPL(  8,156),  SPL(  8,173),  SPL(  8,173),
+  SPL(  8,173),  SPL(  8,189),  SPL(  8,189),  SPL(  8,206),  SPL( 41,  8),  SPL( 24,123),  SPL(  8,222),  SPL(  8,222),
+  SPL(  8,239),  SPL( 41, 41),  SPL(  8,255),  SPL( 41, 57),  SPL( 24,173),  SPL( 41, 74),  SPL( 24,189),  SPL( 24,189),
+  SPL( 24,189),  SPL( 24,206),  SPL( 41,107),  SPL( 24,222),  SPL( 41,123),  SPL( 24,239),  SPL( 24,239),  SPL( 24,239),
+  SPL( 24,255),  SPL( 41,156),  SPL( 41,156),  SPL( 41,173),  SPL( 41,173),  SPL( 41,189),  SPL( 41,189),  SPL( 41,206),
+  SPL( 41,206),  SPL( 41,206),  SPL( 41,222),  SPL( 41,222),  SPL( 41,239),  SPL( 74, 41),  SPL( 57,156),  SPL( 41,255),
+  SPL( 41,255),  SPL( 57,173),  SPL( 74, 74),  SPL( 57,189),  SPL( 74, 90),  SPL( 57,206),  SPL( 74,107),  SPL( 57,222),
+  SPL( 57,222),  SPL( 57,222),  SPL( 57,239),  SPL( 74,140),  SPL( 57,255),  SPL( 74,156),  SPL( 74,156),  SPL( 74,173),
+  SPL( 74,173),  SPL( 74,189),  SPL( 74,189),  SPL( 74,189),  SPL( 74,206),  SPL(107,  8),  SPL( 74,222),  SPL(107, 24),
+  SPL( 74,239),  SPL( 74,239),  SPL( 74,239),  SPL( 74,255),  SPL( 74,255),  SPL( 90,173),  SPL(107, 74),  SPL( 90,189),
+  SPL(107, 90),  SPL( 90,206),  SPL( 90,206),  SPL(107,107),  SPL( 90,222),  SPL(107,123),  SPL( 90,239),  SPL(107,140),
+  SPL( 90,255),  SPL( 90,255),  SPL( 90,255),  SPL(107,173),  SPL(107,173),  SPL(107,173),  SPL(107,189),  SPL(107,189),
+  SPL(107,206),  SPL(140,  8),  SPL(107,222),  SPL(107,222),  SPL(107,222),  SPL(107,239),  SPL(140, 41),  SPL(107,255),
+  SPL(140, 57),  SPL(123,173),  SPL(123,173),  SPL(123,173),  SPL(123,189),  SPL(123,189),  SPL(123,206),  SPL(140,107),
+  SPL(123,222),  SPL(140,123),  SPL(123,239),  SPL(123,239),  SPL(140,140),  SPL(123,255),  SPL(140,156),  SPL(140,156),
+  SPL(140,173),  SPL(140,173),  SPL(140,189),  SPL(140,189),  SPL(140,206),  SPL(140,206),  SPL(140,206),  SPL(140,222),
+  SPL(173, 24),  SPL(140,239),  SPL(173, 41),  SPL(140,255),  SPL(140,255),  SPL(140,255),  SPL(156,173),  SPL(173, 74),
+  SPL(156,189),  SPL(173, 90),  SPL(156,206),  SPL(156,206),  SPL(156,206),  SPL(156,222),  SPL(156,222),  SPL(156,239),
+  SPL(173,140),  SPL(156,255),  SPL(173,156),  SPL(173,156),  SPL(189, 74),  SPL(173,173),  SPL(173,173),  SPL(173,189),
+  SPL(173,189),  SPL(173,206),  SPL(206,  8),  SPL(173,222),  SPL(206, 24),  SPL(173,239),  SPL(173,239),  SPL(173,239),
+  SPL(173,255),  SPL(206, 57),  SPL(189,173),  SPL(206, 74),  SPL(189,189),  SPL(189,189),  SPL(189,189),  SPL(189,206),
+  SPL(206,107),  SPL(189,222),  SPL(206,123),  SPL(189,239),  SPL(189,239),  SPL(189,239),  SPL(189,255),  SPL(189,255),
+  SPL(206,173),  SPL(206,173),  SPL(206,189),  SPL(206,189),  SPL(206,189),  SPL(222,107),  SPL(206,206),  SPL(206,206),
+  SPL(206,222),  SPL(206,222),  SPL(206,239),  SPL(239, 41),  SPL(206,255),  SPL(239, 57),  SPL(222,173),  SPL(222,173),
+  SPL(222,189),  SPL(222,189),  SPL(239, 90),  SPL(222,206),  SPL(239,107),  SPL(222,222),  SPL(222,222),  SPL(222,222),
+  SPL(222,239),  SPL(239,140),  SPL(222,255),  SPL(239,156),  SPL(239,173),  SPL(239,173),  SPL(239,189),  SPL(239,189),
+  SPL(239,189),  SPL(239,206),  SPL(239,206),  SPL(239,222),  SPL(239,222),  SPL(239,222),  SPL(255,140),  SPL(239,239),
+  SPL(239,239),  SPL(239,255),  SPL(239,255),  SPL(255,173),  SPL(255,189),  SPL(255,189),  SPL(255,189),  SPL(255,206),
+  SPL(255,206),  SPL(255,222),  SPL(255,222),  SPL(255,239),  SPL(255,239),  SPL(255,239),  SPL(255,255),  SPL(255,255)
 }
 };
 
@@ -2465,71 +2465,71 @@ static PaletteSingleLookup4 const sp_lookup_4u1_8[4][256] =
 static PaletteSingleLookup4 const sp_lookup_6s1_8[2][256] =
 {
 {
-  {  0,  0},  {  0,  8},  {  0, 16},  {  0, 24},  {  0, 32},  {  0, 36},  {  0, 44},  {  0, 52},
-  {  0, 60},  {  0, 64},  {  0, 72},  {  0, 80},  {  0, 88},  {  0, 96},  {  0,100},  {  0,108},
-  {  0,116},  {  0,124},  {  0,129},  {  0,137},  {  0,145},  {  0,153},  {  0,157},  {  0,165},
-  {  0,173},  {  0,181},  {  0,185},  {  0,193},  {  0,201},  {  0,209},  {  0,217},  {  0,221},
-  {  0,229},  {  0,237},  {  0,245},  {  0,249},  {  4,233},  {  4,241},  {  4,249},  {  4,253},
-  {  8,237},  {  8,245},  {  8,253},  { 12,233},  { 12,241},  { 12,249},  { 16,233},  { 16,237},
-  { 16,245},  { 16,253},  { 20,237},  { 20,241},  { 20,249},  { 24,233},  { 24,241},  { 24,245},
-  { 24,253},  { 28,237},  { 28,245},  { 28,249},  { 32,233},  { 32,241},  { 32,249},  { 32,253},
-  { 36,237},  { 36,245},  { 36,253},  { 40,233},  { 40,241},  { 40,249},  { 44,229},  { 44,237},
-  { 44,245},  { 44,253},  { 48,233},  { 48,241},  { 48,249},  { 52,233},  { 52,237},  { 52,245},
-  { 52,253},  { 56,237},  { 56,241},  { 56,249},  { 60,233},  { 60,241},  { 60,245},  { 60,253},
-  { 64,237},  { 64,245},  { 64,249},  { 68,233},  { 68,241},  { 68,249},  { 68,253},  { 72,237},
-  { 72,245},  { 72,253},  { 76,233},  { 76,241},  { 76,249},  { 80,233},  { 80,237},  { 80,245},
-  { 80,253},  { 84,237},  { 84,241},  { 84,249},  { 88,233},  { 88,241},  { 88,245},  { 88,253},
-  { 92,237},  { 92,245},  { 92,249},  { 96,233},  { 96,241},  { 96,249},  { 96,253},  {100,237},
-  {100,245},  {100,253},  {104,233},  {104,241},  {104,249},  {108,229},  {108,237},  {108,245},
-  {108,253},  {112,233},  {112,241},  {112,249},  {116,233},  {116,237},  {116,245},  {116,253},
-  {120,237},  {120,241},  {120,249},  {124,233},  {124,241},  {124,245},  {124,253},  {129,229},
-  {129,237},  {129,245},  {129,253},  {133,233},  {133,241},  {133,249},  {137,233},  {137,237},
-  {137,245},  {137,253},  {141,237},  {141,241},  {141,249},  {145,233},  {145,241},  {145,245},
-  {145,253},  {149,237},  {149,245},  {149,249},  {153,233},  {153,241},  {153,249},  {153,253},
-  {157,237},  {157,245},  {157,253},  {161,233},  {161,241},  {161,249},  {165,229},  {165,237},
-  {165,245},  {165,253},  {169,233},  {169,241},  {169,249},  {173,233},  {173,237},  {173,245},
-  {173,253},  {177,237},  {177,241},  {177,249},  {181,233},  {181,241},  {181,245},  {181,253},
-  {185,237},  {185,245},  {185,249},  {189,233},  {189,241},  {189,249},  {189,253},  {193,237},
-  {193,245},  {193,253},  {197,233},  {197,241},  {197,249},  {201,233},  {201,237},  {201,245},
-  {201,253},  {205,237},  {205,241},  {205,249},  {209,233},  {209,241},  {209,245},  {209,253},
-  {213,237},  {213,245},  {213,249},  {217,233},  {217,241},  {217,249},  {217,253},  {221,237},
-  {221,245},  {221,253},  {225,233},  {225,241},  {225,249},  {229,229},  {229,237},  {229,245},
-  {229,253},  {233,233},  {233,241},  {233,249},  {237,233},  {237,237},  {237,245},  {237,253},
-  {241,237},  {241,241},  {241,249},  {245,237},  {245,241},  {245,245},  {245,253},  {249,241},
-  {249,245},  {249,249},  {253,237},  {253,245},  {253,249},  {253,253},  {253,253},  {253,253}
+  SPL(  0,  0),  SPL(  0,  8),  SPL(  0, 16),  SPL(  0, 24),  SPL(  0, 32),  SPL(  0, 36),  SPL(  0, 44),  SPL(  0, 52),
+  SPL(  0, 60),  SPL(  0, 64),  SPL(  0, 72),  SPL(  0, 80),  SPL(  0, 88),  SPL(  0, 96),  SPL(  0,100),  SPL(  0,108),
+  SPL(  0,116),  SPL(  0,124),  SPL(  0,129),  SPL(  0,137),  SPL(  0,145),  SPL(  0,153),  SPL(  0,157),  SPL(  0,165),
+  SPL(  0,173),  SPL(  0,181),  SPL(  0,185),  SPL(  0,193),  SPL(  0,201),  SPL(  0,209),  SPL(  0,217),  SPL(  0,221),
+  SPL(  0,229),  SPL(  0,237),  SPL(  0,245),  SPL(  0,249),  SPL(  4,233),  SPL(  4,241),  SPL(  4,249),  SPL(  4,253),
+  SPL(  8,237),  SPL(  8,245),  SPL(  8,253),  SPL( 12,233),  SPL( 12,241),  SPL( 12,249),  SPL( 16,233),  SPL( 16,237),
+  SPL( 16,245),  SPL( 16,253),  SPL( 20,237),  SPL( 20,241),  SPL( 20,249),  SPL( 24,233),  SPL( 24,241),  SPL( 24,245),
+  SPL( 24,253),  SPL( 28,237),  SPL( 28,245),  SPL( 28,249),  SPL( 32,233),  SPL( 32,241),  SPL( 32,249),  SPL( 32,253),
+  SPL( 36,237),  SPL( 36,245),  SPL( 36,253),  SPL( 40,233),  SPL( 40,241),  SPL( 40,249),  SPL( 44,229),  SPL( 44,237),
+  SPL( 44,245),  SPL( 44,253),  SPL( 48,233),  SPL( 48,241),  SPL( 48,249),  SPL( 52,233),  SPL( 52,237),  SPL( 52,245),
+  SPL( 52,253),  SPL( 56,237),  SPL( 56,241),  SPL( 56,249),  SPL( 60,233),  SPL( 60,241),  SPL( 60,245),  SPL( 60,253),
+  SPL( 64,237),  SPL( 64,245),  SPL( 64,249),  SPL( 68,233),  SPL( 68,241),  SPL( 68,249),  SPL( 68,253),  SPL( 72,237),
+  SPL( 72,245),  SPL( 72,253),  SPL( 76,233),  SPL( 76,241),  SPL( 76,249),  SPL( 80,233),  SPL( 80,237),  SPL( 80,245),
+  SPL( 80,253),  SPL( 84,237),  SPL( 84,241),  SPL( 84,249),  SPL( 88,233),  SPL( 88,241),  SPL( 88,245),  SPL( 88,253),
+  SPL( 92,237),  SPL( 92,245),  SPL( 92,249),  SPL( 96,233),  SPL( 96,241),  SPL( 96,249),  SPL( 96,253),  SPL(100,237),
+  SPL(100,245),  SPL(100,253),  SPL(104,233),  SPL(104,241),  SPL(104,249),  SPL(108,229),  SPL(108,237),  SPL(108,245),
+  SPL(108,253),  SPL(112,233),  SPL(112,241),  SPL(112,249),  SPL(116,233),  SPL(116,237),  SPL(116,245),  SPL(116,253),
+  SPL(120,237),  SPL(120,241),  SPL(120,249),  SPL(124,233),  SPL(124,241),  SPL(124,245),  SPL(124,253),  SPL(129,229),
+  SPL(129,237),  SPL(129,245),  SPL(129,253),  SPL(133,233),  SPL(133,241),  SPL(133,249),  SPL(137,233),  SPL(137,237),
+  SPL(137,245),  SPL(137,253),  SPL(141,237),  SPL(141,241),  SPL(141,249),  SPL(145,233),  SPL(145,241),  SPL(145,245),
+  SPL(145,253),  SPL(149,237),  SPL(149,245),  SPL(149,249),  SPL(153,233),  SPL(153,241),  SPL(153,249),  SPL(153,253),
+  SPL(157,237),  SPL(157,245),  SPL(157,253),  SPL(161,233),  SPL(161,241),  SPL(161,249),  SPL(165,229),  SPL(165,237),
+  SPL(165,245),  SPL(165,253),  SPL(169,233),  SPL(169,241),  SPL(169,249),  SPL(173,233),  SPL(173,237),  SPL(173,245),
+  SPL(173,253),  SPL(177,237),  SPL(177,241),  SPL(177,249),  SPL(181,233),  SPL(181,241),  SPL(181,245),  SPL(181,253),
+  SPL(185,237),  SPL(185,245),  SPL(185,249),  SPL(189,233),  SPL(189,241),  SPL(189,249),  SPL(189,253),  SPL(193,237),
+  SPL(193,245),  SPL(193,253),  SPL(197,233),  SPL(197,241),  SPL(197,249),  SPL(201,233),  SPL(201,237),  SPL(201,245),
+  SPL(201,253),  SPL(205,237),  SPL(205,241),  SPL(205,249),  SPL(209,233),  SPL(209,241),  SPL(209,245),  SPL(209,253),
+  SPL(213,237),  SPL(213,245),  SPL(213,249),  SPL(217,233),  SPL(217,241),  SPL(217,249),  SPL(217,253),  SPL(221,237),
+  SPL(221,245),  SPL(221,253),  SPL(225,233),  SPL(225,241),  SPL(225,249),  SPL(229,229),  SPL(229,237),  SPL(229,245),
+  SPL(229,253),  SPL(233,233),  SPL(233,241),  SPL(233,249),  SPL(237,233),  SPL(237,237),  SPL(237,245),  SPL(237,253),
+  SPL(241,237),  SPL(241,241),  SPL(241,249),  SPL(245,237),  SPL(245,241),  SPL(245,245),  SPL(245,253),  SPL(249,241),
+  SPL(249,245),  SPL(249,249),  SPL(253,237),  SPL(253,245),  SPL(253,249),  SPL(253,253),  SPL(253,253),  SPL(253,253)
 },{
-  {  2,  2},  {  2,  2},  {  2,  2},  {  2, 10},  {  2, 18},  {  2, 26},  {  2, 34},  {  2, 38},
-  {  2, 46},  {  2, 54},  {  2, 62},  {  2, 66},  {  2, 74},  {  2, 82},  {  2, 90},  {  2, 98},
-  {  2,102},  {  2,110},  {  2,118},  {  2,126},  {  2,131},  {  2,139},  {  2,147},  {  2,155},
-  {  2,159},  {  2,167},  {  2,175},  {  2,183},  {  2,187},  {  2,195},  {  2,203},  {  2,211},
-  {  2,219},  {  2,223},  {  2,231},  {  2,239},  {  2,247},  {  2,251},  {  6,235},  {  6,243},
-  {  6,251},  {  6,255},  { 10,239},  { 10,247},  { 10,255},  { 14,235},  { 14,243},  { 14,251},
-  { 18,235},  { 18,239},  { 18,247},  { 18,255},  { 22,239},  { 22,243},  { 22,251},  { 26,235},
-  { 26,243},  { 26,247},  { 26,255},  { 30,239},  { 30,247},  { 30,251},  { 34,235},  { 34,243},
-  { 34,251},  { 34,255},  { 38,239},  { 38,247},  { 38,255},  { 42,235},  { 42,243},  { 42,251},
-  { 46,231},  { 46,239},  { 46,247},  { 46,255},  { 50,235},  { 50,243},  { 50,251},  { 54,235},
-  { 54,239},  { 54,247},  { 54,255},  { 58,239},  { 58,243},  { 58,251},  { 62,235},  { 62,243},
-  { 62,247},  { 62,255},  { 66,239},  { 66,247},  { 66,251},  { 70,235},  { 70,243},  { 70,251},
-  { 70,255},  { 74,239},  { 74,247},  { 74,255},  { 78,235},  { 78,243},  { 78,251},  { 82,235},
-  { 82,239},  { 82,247},  { 82,255},  { 86,239},  { 86,243},  { 86,251},  { 90,235},  { 90,243},
-  { 90,247},  { 90,255},  { 94,239},  { 94,247},  { 94,251},  { 98,235},  { 98,243},  { 98,251},
-  { 98,255},  {102,239},  {102,247},  {102,255},  {106,235},  {106,243},  {106,251},  {110,231},
-  {110,239},  {110,247},  {110,255},  {114,235},  {114,243},  {114,251},  {118,235},  {118,239},
-  {118,247},  {118,255},  {122,239},  {122,243},  {122,251},  {126,235},  {126,243},  {126,247},
-  {126,255},  {131,231},  {131,239},  {131,247},  {131,255},  {135,235},  {135,243},  {135,251},
-  {139,235},  {139,239},  {139,247},  {139,255},  {143,239},  {143,243},  {143,251},  {147,235},
-  {147,243},  {147,247},  {147,255},  {151,239},  {151,247},  {151,251},  {155,235},  {155,243},
-  {155,251},  {155,255},  {159,239},  {159,247},  {159,255},  {163,235},  {163,243},  {163,251},
-  {167,231},  {167,239},  {167,247},  {167,255},  {171,235},  {171,243},  {171,251},  {175,235},
-  {175,239},  {175,247},  {175,255},  {179,239},  {179,243},  {179,251},  {183,235},  {183,243},
-  {183,247},  {183,255},  {187,239},  {187,247},  {187,251},  {191,235},  {191,243},  {191,251},
-  {191,255},  {195,239},  {195,247},  {195,255},  {199,235},  {199,243},  {199,251},  {203,235},
-  {203,239},  {203,247},  {203,255},  {207,239},  {207,243},  {207,251},  {211,235},  {211,243},
-  {211,247},  {211,255},  {215,239},  {215,247},  {215,251},  {219,235},  {219,243},  {219,251},
-  {219,255},  {223,239},  {223,247},  {223,255},  {227,235},  {227,243},  {227,251},  {231,231},
-  {231,239},  {231,247},  {231,255},  {235,235},  {235,243},  {235,251},  {239,235},  {239,239},
-  {239,247},  {239,255},  {243,239},  {243,243},  {243,251},  {247,239},  {247,243},  {247,247},
-  {247,255},  {251,243},  {251,247},  {251,251},  {255,239},  {255,247},  {255,251},  {255,255}
+  SPL(  2,  2),  SPL(  2,  2),  SPL(  2,  2),  SPL(  2, 10),  SPL(  2, 18),  SPL(  2, 26),  SPL(  2, 34),  SPL(  2, 38),
+  SPL(  2, 46),  SPL(  2, 54),  SPL(  2, 62),  SPL(  2, 66),  SPL(  2, 74),  SPL(  2, 82),  SPL(  2, 90),  SPL(  2, 98),
+  SPL(  2,102),  SPL(  2,110),  SPL(  2,118),  SPL(  2,126),  SPL(  2,131),  SPL(  2,139),  SPL(  2,147),  SPL(  2,155),
+  SPL(  2,159),  SPL(  2,167),  SPL(  2,175),  SPL(  2,183),  SPL(  2,187),  SPL(  2,195),  SPL(  2,203),  SPL(  2,211),
+  SPL(  2,219),  SPL(  2,223),  SPL(  2,231),  SPL(  2,239),  SPL(  2,247),  SPL(  2,251),  SPL(  6,235),  SPL(  6,243),
+  SPL(  6,251),  SPL(  6,255),  SPL( 10,239),  SPL( 10,247),  SPL( 10,255),  SPL( 14,235),  SPL( 14,243),  SPL( 14,251),
+  SPL( 18,235),  SPL( 18,239),  SPL( 18,247),  SPL( 18,255),  SPL( 22,239),  SPL( 22,243),  SPL( 22,251),  SPL( 26,235),
+  SPL( 26,243),  SPL( 26,247),  SPL( 26,255),  SPL( 30,239),  SPL( 30,247),  SPL( 30,251),  SPL( 34,235),  SPL( 34,243),
+  SPL( 34,251),  SPL( 34,255),  SPL( 38,239),  SPL( 38,247),  SPL( 38,255),  SPL( 42,235),  SPL( 42,243),  SPL( 42,251),
+  SPL( 46,231),  SPL( 46,239),  SPL( 46,247),  SPL( 46,255),  SPL( 50,235),  SPL( 50,243),  SPL( 50,251),  SPL( 54,235),
+  SPL( 54,239),  SPL( 54,247),  SPL( 54,255),  SPL( 58,239),  SPL( 58,243),  SPL( 58,251),  SPL( 62,235),  SPL( 62,243),
+  SPL( 62,247),  SPL( 62,255),  SPL( 66,239),  SPL( 66,247),  SPL( 66,251),  SPL( 70,235),  SPL( 70,243),  SPL( 70,251),
+  SPL( 70,255),  SPL( 74,239),  SPL( 74,247),  SPL( 74,255),  SPL( 78,235),  SPL( 78,243),  SPL( 78,251),  SPL( 82,235),
+  SPL( 82,239),  SPL( 82,247),  SPL( 82,255),  SPL( 86,239),  SPL( 86,243),  SPL( 86,251),  SPL( 90,235),  SPL( 90,243),
+  SPL( 90,247),  SPL( 90,255),  SPL( 94,239),  SPL( 94,247),  SPL( 94,251),  SPL( 98,235),  SPL( 98,243),  SPL( 98,251),
+  SPL( 98,255),  SPL(102,239),  SPL(102,247),  SPL(102,255),  SPL(106,235),  SPL(106,243),  SPL(106,251),  SPL(110,231),
+  SPL(110,239),  SPL(110,247),  SPL(110,255),  SPL(114,235),  SPL(114,243),  SPL(114,251),  SPL(118,235),  SPL(118,239),
+  SPL(118,247),  SPL(118,255),  SPL(122,239),  SPL(122,243),  SPL(122,251),  SPL(126,235),  SPL(126,243),  SPL(126,247),
+  SPL(126,255),  SPL(131,231),  SPL(131,239),  SPL(131,247),  SPL(131,255),  SPL(135,235),  SPL(135,243),  SPL(135,251),
+  SPL(139,235),  SPL(139,239),  SPL(139,247),  SPL(139,255),  SPL(143,239),  SPL(143,243),  SPL(143,251),  SPL(147,235),
+  SPL(147,243),  SPL(147,247),  SPL(147,255),  SPL(151,239),  SPL(151,247),  SPL(151,251),  SPL(155,235),  SPL(155,243),
+  SPL(155,251),  SPL(155,255),  SPL(159,239),  SPL(159,247),  SPL(159,255),  SPL(163,235),  SPL(163,243),  SPL(163,251),
+  SPL(167,231),  SPL(167,239),  SPL(167,247),  SPL(167,255),  SPL(171,235),  SPL(171,243),  SPL(171,251),  SPL(175,235),
+  SPL(175,239),  SPL(175,247),  SPL(175,255),  SPL(179,239),  SPL(179,243),  SPL(179,251),  SPL(183,235),  SPL(183,243),
+  SPL(183,247),  SPL(183,255),  SPL(187,239),  SPL(187,247),  SPL(187,251),  SPL(191,235),  SPL(191,243),  SPL(191,251),
+  SPL(191,255),  SPL(195,239),  SPL(195,247),  SPL(195,255),  SPL(199,235),  SPL(199,243),  SPL(199,251),  SPL(203,235),
+  SPL(203,239),  SPL(203,247),  SPL(203,255),  SPL(207,239),  SPL(207,243),  SPL(207,251),  SPL(211,235),  SPL(211,243),
+  SPL(211,247),  SPL(211,255),  SPL(215,239),  SPL(215,247),  SPL(215,251),  SPL(219,235),  SPL(219,243),  SPL(219,251),
+  SPL(219,255),  SPL(223,239),  SPL(223,247),  SPL(223,255),  SPL(227,235),  SPL(227,243),  SPL(227,251),  SPL(231,231),
+  SPL(231,239),  SPL(231,247),  SPL(231,255),  SPL(235,235),  SPL(235,243),  SPL(235,251),  SPL(239,235),  SPL(239,239),
+  SPL(239,247),  SPL(239,255),  SPL(243,239),  SPL(243,243),  SPL(243,251),  SPL(247,239),  SPL(247,243),  SPL(247,247),
+  SPL(247,255),  SPL(251,243),  SPL(251,247),  SPL(251,251),  SPL(255,239),  SPL(255,247),  SPL(255,251),  SPL(255,255)
 }
 };
 
@@ -2537,137 +2537,137 @@ static PaletteSingleLookup4 const sp_lookup_6s1_8[2][256] =
 static PaletteSingleLookup8 const sp_lookup_7u1_16[4][256] =
 {
 {
-  {  0,  0},  {  0, 16},  {  0, 32},  {  0, 48},  {  0, 64},  {  0, 80},  {  0, 96},  {  0,112},
-  {  0,128},  {  0,144},  {  0,160},  {  0,176},  {  0,192},  {  0,208},  {  0,224},  {  0,240},
-  {  2,226},  {  2,242},  {  4,228},  {  4,244},  {  6,230},  {  6,246},  {  8,232},  {  8,248},
-  { 10,234},  { 10,250},  { 12,236},  { 12,252},  { 14,238},  { 14,254},  { 16,240},  { 18,226},
-  { 18,242},  { 20,228},  { 20,244},  { 22,230},  { 22,246},  { 24,232},  { 24,248},  { 26,234},
-  { 26,250},  { 28,236},  { 28,252},  { 30,238},  { 30,254},  { 32,240},  { 34,226},  { 34,242},
-  { 36,228},  { 36,244},  { 38,230},  { 38,246},  { 40,232},  { 40,248},  { 42,234},  { 42,250},
-  { 44,236},  { 44,252},  { 46,238},  { 46,254},  { 48,240},  { 50,226},  { 50,242},  { 52,228},
-  { 52,244},  { 54,230},  { 54,246},  { 56,232},  { 56,248},  { 58,234},  { 58,250},  { 60,236},
-  { 60,252},  { 62,238},  { 62,254},  { 64,240},  { 66,226},  { 66,242},  { 68,228},  { 68,244},
-  { 70,230},  { 70,246},  { 72,232},  { 72,248},  { 74,234},  { 74,250},  { 76,236},  { 76,252},
-  { 78,238},  { 78,254},  { 80,240},  { 82,226},  { 82,242},  { 84,228},  { 84,244},  { 86,230},
-  { 86,246},  { 88,232},  { 88,248},  { 90,234},  { 90,250},  { 92,236},  { 92,252},  { 94,238},
-  { 94,254},  { 96,240},  { 98,226},  { 98,242},  {100,228},  {100,244},  {102,230},  {102,246},
-  {104,232},  {104,248},  {106,234},  {106,250},  {108,236},  {108,252},  {110,238},  {110,254},
-  {112,240},  {114,226},  {114,242},  {116,228},  {116,244},  {118,230},  {118,246},  {120,232},
-  {120,248},  {122,234},  {122,250},  {124,236},  {124,252},  {126,238},  {126,254},  {128,240},
-  {130,226},  {130,242},  {132,228},  {132,244},  {134,230},  {134,246},  {136,232},  {136,248},
-  {138,234},  {138,250},  {140,236},  {140,252},  {142,238},  {142,254},  {144,240},  {146,226},
-  {146,242},  {148,228},  {148,244},  {150,230},  {150,246},  {152,232},  {152,248},  {154,234},
-  {154,250},  {156,236},  {156,252},  {158,238},  {158,254},  {160,240},  {162,226},  {162,242},
-  {164,228},  {164,244},  {166,230},  {166,246},  {168,232},  {168,248},  {170,234},  {170,250},
-  {172,236},  {172,252},  {174,238},  {174,254},  {176,240},  {178,226},  {178,242},  {180,228},
-  {180,244},  {182,230},  {182,246},  {184,232},  {184,248},  {186,234},  {186,250},  {188,236},
-  {188,252},  {190,238},  {190,254},  {192,240},  {194,226},  {194,242},  {196,228},  {196,244},
-  {198,230},  {198,246},  {200,232},  {200,248},  {202,234},  {202,250},  {204,236},  {204,252},
-  {206,238},  {206,254},  {208,240},  {210,226},  {210,242},  {212,228},  {212,244},  {214,230},
-  {214,246},  {216,232},  {216,248},  {218,234},  {218,250},  {220,236},  {220,252},  {222,238},
-  {222,254},  {224,240},  {226,226},  {226,242},  {228,228},  {228,244},  {230,230},  {230,246},
-  {232,232},  {232,248},  {234,234},  {234,250},  {236,236},  {236,252},  {238,238},  {238,254},
-  {240,240},  {242,240},  {242,242},  {244,242},  {244,244},  {246,244},  {246,246},  {248,246},
-  {248,248},  {250,248},  {250,250},  {252,250},  {252,252},  {254,252},  {254,254},  {254,254}
+  SPL(  0,  0),  SPL(  0, 16),  SPL(  0, 32),  SPL(  0, 48),  SPL(  0, 64),  SPL(  0, 80),  SPL(  0, 96),  SPL(  0,112),
+  SPL(  0,128),  SPL(  0,144),  SPL(  0,160),  SPL(  0,176),  SPL(  0,192),  SPL(  0,208),  SPL(  0,224),  SPL(  0,240),
+  SPL(  2,226),  SPL(  2,242),  SPL(  4,228),  SPL(  4,244),  SPL(  6,230),  SPL(  6,246),  SPL(  8,232),  SPL(  8,248),
+  SPL( 10,234),  SPL( 10,250),  SPL( 12,236),  SPL( 12,252),  SPL( 14,238),  SPL( 14,254),  SPL( 16,240),  SPL( 18,226),
+  SPL( 18,242),  SPL( 20,228),  SPL( 20,244),  SPL( 22,230),  SPL( 22,246),  SPL( 24,232),  SPL( 24,248),  SPL( 26,234),
+  SPL( 26,250),  SPL( 28,236),  SPL( 28,252),  SPL( 30,238),  SPL( 30,254),  SPL( 32,240),  SPL( 34,226),  SPL( 34,242),
+  SPL( 36,228),  SPL( 36,244),  SPL( 38,230),  SPL( 38,246),  SPL( 40,232),  SPL( 40,248),  SPL( 42,234),  SPL( 42,250),
+  SPL( 44,236),  SPL( 44,252),  SPL( 46,238),  SPL( 46,254),  SPL( 48,240),  SPL( 50,226),  SPL( 50,242),  SPL( 52,228),
+  SPL( 52,244),  SPL( 54,230),  SPL( 54,246),  SPL( 56,232),  SPL( 56,248),  SPL( 58,234),  SPL( 58,250),  SPL( 60,236),
+  SPL( 60,252),  SPL( 62,238),  SPL( 62,254),  SPL( 64,240),  SPL( 66,226),  SPL( 66,242),  SPL( 68,228),  SPL( 68,244),
+  SPL( 70,230),  SPL( 70,246),  SPL( 72,232),  SPL( 72,248),  SPL( 74,234),  SPL( 74,250),  SPL( 76,236),  SPL( 76,252),
+  SPL( 78,238),  SPL( 78,254),  SPL( 80,240),  SPL( 82,226),  SPL( 82,242),  SPL( 84,228),  SPL( 84,244),  SPL( 86,230),
+  SPL( 86,246),  SPL( 88,232),  SPL( 88,248),  SPL( 90,234),  SPL( 90,250),  SPL( 92,236),  SPL( 92,252),  SPL( 94,238),
+  SPL( 94,254),  SPL( 96,240),  SPL( 98,226),  SPL( 98,242),  SPL(100,228),  SPL(100,244),  SPL(102,230),  SPL(102,246),
+  SPL(104,232),  SPL(104,248),  SPL(106,234),  SPL(106,250),  SPL(108,236),  SPL(108,252),  SPL(110,238),  SPL(110,254),
+  SPL(112,240),  SPL(114,226),  SPL(114,242),  SPL(116,228),  SPL(116,244),  SPL(118,230),  SPL(118,246),  SPL(120,232),
+  SPL(120,248),  SPL(122,234),  SPL(122,250),  SPL(124,236),  SPL(124,252),  SPL(126,238),  SPL(126,254),  SPL(128,240),
+  SPL(130,226),  SPL(130,242),  SPL(132,228),  SPL(132,244),  SPL(134,230),  SPL(134,246),  SPL(136,232),  SPL(136,248),
+  SPL(138,234),  SPL(138,250),  SPL(140,236),  SPL(140,252),  SPL(142,238),  SPL(142,254),  SPL(144,240),  SPL(146,226),
+  SPL(146,242),  SPL(148,228),  SPL(148,244),  SPL(150,230),  SPL(150,246),  SPL(152,232),  SPL(152,248),  SPL(154,234),
+  SPL(154,250),  SPL(156,236),  SPL(156,252),  SPL(158,238),  SPL(158,254),  SPL(160,240),  SPL(162,226),  SPL(162,242),
+  SPL(164,228),  SPL(164,244),  SPL(166,230),  SPL(166,246),  SPL(168,232),  SPL(168,248),  SPL(170,234),  SPL(170,250),
+  SPL(172,236),  SPL(172,252),  SPL(174,238),  SPL(174,254),  SPL(176,240),  SPL(178,226),  SPL(178,242),  SPL(180,228),
+  SPL(180,244),  SPL(182,230),  SPL(182,246),  SPL(184,232),  SPL(184,248),  SPL(186,234),  SPL(186,250),  SPL(188,236),
+  SPL(188,252),  SPL(190,238),  SPL(190,254),  SPL(192,240),  SPL(194,226),  SPL(194,242),  SPL(196,228),  SPL(196,244),
+  SPL(198,230),  SPL(198,246),  SPL(200,232),  SPL(200,248),  SPL(202,234),  SPL(202,250),  SPL(204,236),  SPL(204,252),
+  SPL(206,238),  SPL(206,254),  SPL(208,240),  SPL(210,226),  SPL(210,242),  SPL(212,228),  SPL(212,244),  SPL(214,230),
+  SPL(214,246),  SPL(216,232),  SPL(216,248),  SPL(218,234),  SPL(218,250),  SPL(220,236),  SPL(220,252),  SPL(222,238),
+  SPL(222,254),  SPL(224,240),  SPL(226,226),  SPL(226,242),  SPL(228,228),  SPL(228,244),  SPL(230,230),  SPL(230,246),
+  SPL(232,232),  SPL(232,248),  SPL(234,234),  SPL(234,250),  SPL(236,236),  SPL(236,252),  SPL(238,238),  SPL(238,254),
+  SPL(240,240),  SPL(242,240),  SPL(242,242),  SPL(244,242),  SPL(244,244),  SPL(246,244),  SPL(246,246),  SPL(248,246),
+  SPL(248,248),  SPL(250,248),  SPL(250,250),  SPL(252,250),  SPL(252,252),  SPL(254,252),  SPL(254,254),  SPL(254,254)
 },{
-  {  1,  0},  {  1,  2},  {  1, 18},  {  1, 34},  {  1, 50},  {  1, 66},  {  1, 82},  {  1, 98},
-  {  1,114},  {  1,130},  {  1,146},  {  1,162},  {  1,178},  {  1,194},  {  1,210},  {  1,226},
-  {  1,242},  {  3,228},  {  3,244},  {  5,230},  {  5,246},  {  7,232},  {  7,248},  {  9,234},
-  {  9,250},  { 11,236},  { 11,252},  { 13,238},  { 13,254},  { 15,240},  { 17,226},  { 17,242},
-  { 19,228},  { 19,244},  { 21,230},  { 21,246},  { 23,232},  { 23,248},  { 25,234},  { 25,250},
-  { 27,236},  { 27,252},  { 29,238},  { 29,254},  { 31,240},  { 33,226},  { 33,242},  { 35,228},
-  { 35,244},  { 37,230},  { 37,246},  { 39,232},  { 39,248},  { 41,234},  { 41,250},  { 43,236},
-  { 43,252},  { 45,238},  { 45,254},  { 47,240},  { 49,226},  { 49,242},  { 51,228},  { 51,244},
-  { 53,230},  { 53,246},  { 55,232},  { 55,248},  { 57,234},  { 57,250},  { 59,236},  { 59,252},
-  { 61,238},  { 61,254},  { 63,240},  { 65,226},  { 65,242},  { 67,228},  { 67,244},  { 69,230},
-  { 69,246},  { 71,232},  { 71,248},  { 73,234},  { 73,250},  { 75,236},  { 75,252},  { 77,238},
-  { 77,254},  { 79,240},  { 81,226},  { 81,242},  { 83,228},  { 83,244},  { 85,230},  { 85,246},
-  { 87,232},  { 87,248},  { 89,234},  { 89,250},  { 91,236},  { 91,252},  { 93,238},  { 93,254},
-  { 95,240},  { 97,226},  { 97,242},  { 99,228},  { 99,244},  {101,230},  {101,246},  {103,232},
-  {103,248},  {105,234},  {105,250},  {107,236},  {107,252},  {109,238},  {109,254},  {111,240},
-  {113,226},  {113,242},  {115,228},  {115,244},  {117,230},  {117,246},  {119,232},  {119,248},
-  {121,234},  {121,250},  {123,236},  {123,252},  {125,238},  {125,254},  {127,240},  {129,226},
-  {129,242},  {131,228},  {131,244},  {133,230},  {133,246},  {135,232},  {135,248},  {137,234},
-  {137,250},  {139,236},  {139,252},  {141,238},  {141,254},  {143,240},  {145,226},  {145,242},
-  {147,228},  {147,244},  {149,230},  {149,246},  {151,232},  {151,248},  {153,234},  {153,250},
-  {155,236},  {155,252},  {157,238},  {157,254},  {159,240},  {161,226},  {161,242},  {163,228},
-  {163,244},  {165,230},  {165,246},  {167,232},  {167,248},  {169,234},  {169,250},  {171,236},
-  {171,252},  {173,238},  {173,254},  {175,240},  {177,226},  {177,242},  {179,228},  {179,244},
-  {181,230},  {181,246},  {183,232},  {183,248},  {185,234},  {185,250},  {187,236},  {187,252},
-  {189,238},  {189,254},  {191,240},  {193,226},  {193,242},  {195,228},  {195,244},  {197,230},
-  {197,246},  {199,232},  {199,248},  {201,234},  {201,250},  {203,236},  {203,252},  {205,238},
-  {205,254},  {207,240},  {209,226},  {209,242},  {211,228},  {211,244},  {213,230},  {213,246},
-  {215,232},  {215,248},  {217,234},  {217,250},  {219,236},  {219,252},  {221,238},  {221,254},
-  {223,240},  {225,226},  {225,242},  {227,228},  {227,244},  {229,230},  {229,246},  {231,232},
-  {231,248},  {233,234},  {233,250},  {235,236},  {235,252},  {237,238},  {237,254},  {239,240},
-  {241,240},  {241,242},  {243,242},  {243,244},  {245,244},  {245,246},  {247,246},  {247,248},
-  {249,248},  {249,250},  {251,250},  {251,252},  {253,252},  {253,254},  {255,254},  {255,254}
+  SPL(  1,  0),  SPL(  1,  2),  SPL(  1, 18),  SPL(  1, 34),  SPL(  1, 50),  SPL(  1, 66),  SPL(  1, 82),  SPL(  1, 98),
+  SPL(  1,114),  SPL(  1,130),  SPL(  1,146),  SPL(  1,162),  SPL(  1,178),  SPL(  1,194),  SPL(  1,210),  SPL(  1,226),
+  SPL(  1,242),  SPL(  3,228),  SPL(  3,244),  SPL(  5,230),  SPL(  5,246),  SPL(  7,232),  SPL(  7,248),  SPL(  9,234),
+  SPL(  9,250),  SPL( 11,236),  SPL( 11,252),  SPL( 13,238),  SPL( 13,254),  SPL( 15,240),  SPL( 17,226),  SPL( 17,242),
+  SPL( 19,228),  SPL( 19,244),  SPL( 21,230),  SPL( 21,246),  SPL( 23,232),  SPL( 23,248),  SPL( 25,234),  SPL( 25,250),
+  SPL( 27,236),  SPL( 27,252),  SPL( 29,238),  SPL( 29,254),  SPL( 31,240),  SPL( 33,226),  SPL( 33,242),  SPL( 35,228),
+  SPL( 35,244),  SPL( 37,230),  SPL( 37,246),  SPL( 39,232),  SPL( 39,248),  SPL( 41,234),  SPL( 41,250),  SPL( 43,236),
+  SPL( 43,252),  SPL( 45,238),  SPL( 45,254),  SPL( 47,240),  SPL( 49,226),  SPL( 49,242),  SPL( 51,228),  SPL( 51,244),
+  SPL( 53,230),  SPL( 53,246),  SPL( 55,232),  SPL( 55,248),  SPL( 57,234),  SPL( 57,250),  SPL( 59,236),  SPL( 59,252),
+  SPL( 61,238),  SPL( 61,254),  SPL( 63,240),  SPL( 65,226),  SPL( 65,242),  SPL( 67,228),  SPL( 67,244),  SPL( 69,230),
+  SPL( 69,246),  SPL( 71,232),  SPL( 71,248),  SPL( 73,234),  SPL( 73,250),  SPL( 75,236),  SPL( 75,252),  SPL( 77,238),
+  SPL( 77,254),  SPL( 79,240),  SPL( 81,226),  SPL( 81,242),  SPL( 83,228),  SPL( 83,244),  SPL( 85,230),  SPL( 85,246),
+  SPL( 87,232),  SPL( 87,248),  SPL( 89,234),  SPL( 89,250),  SPL( 91,236),  SPL( 91,252),  SPL( 93,238),  SPL( 93,254),
+  SPL( 95,240),  SPL( 97,226),  SPL( 97,242),  SPL( 99,228),  SPL( 99,244),  SPL(101,230),  SPL(101,246),  SPL(103,232),
+  SPL(103,248),  SPL(105,234),  SPL(105,250),  SPL(107,236),  SPL(107,252),  SPL(109,238),  SPL(109,254),  SPL(111,240),
+  SPL(113,226),  SPL(113,242),  SPL(115,228),  SPL(115,244),  SPL(117,230),  SPL(117,246),  SPL(119,232),  SPL(119,248),
+  SPL(121,234),  SPL(121,250),  SPL(123,236),  SPL(123,252),  SPL(125,238),  SPL(125,254),  SPL(127,240),  SPL(129,226),
+  SPL(129,242),  SPL(131,228),  SPL(131,244),  SPL(133,230),  SPL(133,246),  SPL(135,232),  SPL(135,248),  SPL(137,234),
+  SPL(137,250),  SPL(139,236),  SPL(139,252),  SPL(141,238),  SPL(141,254),  SPL(143,240),  SPL(145,226),  SPL(145,242),
+  SPL(147,228),  SPL(147,244),  SPL(149,230),  SPL(149,246),  SPL(151,232),  SPL(151,248),  SPL(153,234),  SPL(153,250),
+  SPL(155,236),  SPL(155,252),  SPL(157,238),  SPL(157,254),  SPL(159,240),  SPL(161,226),  SPL(161,242),  SPL(163,228),
+  SPL(163,244),  SPL(165,230),  SPL(165,246),  SPL(167,232),  SPL(167,248),  SPL(169,234),  SPL(169,250),  SPL(171,236),
+  SPL(171,252),  SPL(173,238),  SPL(173,254),  SPL(175,240),  SPL(177,226),  SPL(177,242),  SPL(179,228),  SPL(179,244),
+  SPL(181,230),  SPL(181,246),  SPL(183,232),  SPL(183,248),  SPL(185,234),  SPL(185,250),  SPL(187,236),  SPL(187,252),
+  SPL(189,238),  SPL(189,254),  SPL(191,240),  SPL(193,226),  SPL(193,242),  SPL(195,228),  SPL(195,244),  SPL(197,230),
+  SPL(197,246),  SPL(199,232),  SPL(199,248),  SPL(201,234),  SPL(201,250),  SPL(203,236),  SPL(203,252),  SPL(205,238),
+  SPL(205,254),  SPL(207,240),  SPL(209,226),  SPL(209,242),  SPL(211,228),  SPL(211,244),  SPL(213,230),  SPL(213,246),
+  SPL(215,232),  SPL(215,248),  SPL(217,234),  SPL(217,250),  SPL(219,236),  SPL(219,252),  SPL(221,238),  SPL(221,254),
+  SPL(223,240),  SPL(225,226),  SPL(225,242),  SPL(227,228),  SPL(227,244),  SPL(229,230),  SPL(229,246),  SPL(231,232),
+  SPL(231,248),  SPL(233,234),  SPL(233,250),  SPL(235,236),  SPL(235,252),  SPL(237,238),  SPL(237,254),  SPL(239,240),
+  SPL(241,240),  SPL(241,242),  SPL(243,242),  SPL(243,244),  SPL(245,244),  SPL(245,246),  SPL(247,246),  SPL(247,248),
+  SPL(249,248),  SPL(249,250),  SPL(251,250),  SPL(251,252),  SPL(253,252),  SPL(253,254),  SPL(255,254),  SPL(255,254)
 },{
-  {  0,  1},  {  0, 17},  {  0, 33},  {  0, 49},  {  0, 65},  {  0, 81},  {  0, 97},  {  0,113},
-  {  0,129},  {  0,145},  {  0,161},  {  0,177},  {  0,193},  {  0,209},  {  0,225},  {  0,241},
-  {  2,227},  {  2,243},  {  4,229},  {  4,245},  {  6,231},  {  6,247},  {  8,233},  {  8,249},
-  { 10,235},  { 10,251},  { 12,237},  { 12,253},  { 14,239},  { 14,255},  { 16,241},  { 18,227},
-  { 18,243},  { 20,229},  { 20,245},  { 22,231},  { 22,247},  { 24,233},  { 24,249},  { 26,235},
-  { 26,251},  { 28,237},  { 28,253},  { 30,239},  { 30,255},  { 32,241},  { 34,227},  { 34,243},
-  { 36,229},  { 36,245},  { 38,231},  { 38,247},  { 40,233},  { 40,249},  { 42,235},  { 42,251},
-  { 44,237},  { 44,253},  { 46,239},  { 46,255},  { 48,241},  { 50,227},  { 50,243},  { 52,229},
-  { 52,245},  { 54,231},  { 54,247},  { 56,233},  { 56,249},  { 58,235},  { 58,251},  { 60,237},
-  { 60,253},  { 62,239},  { 62,255},  { 64,241},  { 66,227},  { 66,243},  { 68,229},  { 68,245},
-  { 70,231},  { 70,247},  { 72,233},  { 72,249},  { 74,235},  { 74,251},  { 76,237},  { 76,253},
-  { 78,239},  { 78,255},  { 80,241},  { 82,227},  { 82,243},  { 84,229},  { 84,245},  { 86,231},
-  { 86,247},  { 88,233},  { 88,249},  { 90,235},  { 90,251},  { 92,237},  { 92,253},  { 94,239},
-  { 94,255},  { 96,241},  { 98,227},  { 98,243},  {100,229},  {100,245},  {102,231},  {102,247},
-  {104,233},  {104,249},  {106,235},  {106,251},  {108,237},  {108,253},  {110,239},  {110,255},
-  {112,241},  {114,227},  {114,243},  {116,229},  {116,245},  {118,231},  {118,247},  {120,233},
-  {120,249},  {122,235},  {122,251},  {124,237},  {124,253},  {126,239},  {126,255},  {128,241},
-  {130,227},  {130,243},  {132,229},  {132,245},  {134,231},  {134,247},  {136,233},  {136,249},
-  {138,235},  {138,251},  {140,237},  {140,253},  {142,239},  {142,255},  {144,241},  {146,227},
-  {146,243},  {148,229},  {148,245},  {150,231},  {150,247},  {152,233},  {152,249},  {154,235},
-  {154,251},  {156,237},  {156,253},  {158,239},  {158,255},  {160,241},  {162,227},  {162,243},
-  {164,229},  {164,245},  {166,231},  {166,247},  {168,233},  {168,249},  {170,235},  {170,251},
-  {172,237},  {172,253},  {174,239},  {174,255},  {176,241},  {178,227},  {178,243},  {180,229},
-  {180,245},  {182,231},  {182,247},  {184,233},  {184,249},  {186,235},  {186,251},  {188,237},
-  {188,253},  {190,239},  {190,255},  {192,241},  {194,227},  {194,243},  {196,229},  {196,245},
-  {198,231},  {198,247},  {200,233},  {200,249},  {202,235},  {202,251},  {204,237},  {204,253},
-  {206,239},  {206,255},  {208,241},  {210,227},  {210,243},  {212,229},  {212,245},  {214,231},
-  {214,247},  {216,233},  {216,249},  {218,235},  {218,251},  {220,237},  {220,253},  {222,239},
-  {222,255},  {224,241},  {226,227},  {226,243},  {228,229},  {228,245},  {230,231},  {230,247},
-  {232,233},  {232,249},  {234,235},  {234,251},  {236,237},  {236,253},  {238,239},  {238,255},
-  {240,241},  {242,241},  {242,243},  {244,243},  {244,245},  {246,245},  {246,247},  {248,247},
-  {248,249},  {250,249},  {250,251},  {252,251},  {252,253},  {254,253},  {254,255},  {254,255}
+  SPL(  0,  1),  SPL(  0, 17),  SPL(  0, 33),  SPL(  0, 49),  SPL(  0, 65),  SPL(  0, 81),  SPL(  0, 97),  SPL(  0,113),
+  SPL(  0,129),  SPL(  0,145),  SPL(  0,161),  SPL(  0,177),  SPL(  0,193),  SPL(  0,209),  SPL(  0,225),  SPL(  0,241),
+  SPL(  2,227),  SPL(  2,243),  SPL(  4,229),  SPL(  4,245),  SPL(  6,231),  SPL(  6,247),  SPL(  8,233),  SPL(  8,249),
+  SPL( 10,235),  SPL( 10,251),  SPL( 12,237),  SPL( 12,253),  SPL( 14,239),  SPL( 14,255),  SPL( 16,241),  SPL( 18,227),
+  SPL( 18,243),  SPL( 20,229),  SPL( 20,245),  SPL( 22,231),  SPL( 22,247),  SPL( 24,233),  SPL( 24,249),  SPL( 26,235),
+  SPL( 26,251),  SPL( 28,237),  SPL( 28,253),  SPL( 30,239),  SPL( 30,255),  SPL( 32,241),  SPL( 34,227),  SPL( 34,243),
+  SPL( 36,229),  SPL( 36,245),  SPL( 38,231),  SPL( 38,247),  SPL( 40,233),  SPL( 40,249),  SPL( 42,235),  SPL( 42,251),
+  SPL( 44,237),  SPL( 44,253),  SPL( 46,239),  SPL( 46,255),  SPL( 48,241),  SPL( 50,227),  SPL( 50,243),  SPL( 52,229),
+  SPL( 52,245),  SPL( 54,231),  SPL( 54,247),  SPL( 56,233),  SPL( 56,249),  SPL( 58,235),  SPL( 58,251),  SPL( 60,237),
+  SPL( 60,253),  SPL( 62,239),  SPL( 62,255),  SPL( 64,241),  SPL( 66,227),  SPL( 66,243),  SPL( 68,229),  SPL( 68,245),
+  SPL( 70,231),  SPL( 70,247),  SPL( 72,233),  SPL( 72,249),  SPL( 74,235),  SPL( 74,251),  SPL( 76,237),  SPL( 76,253),
+  SPL( 78,239),  SPL( 78,255),  SPL( 80,241),  SPL( 82,227),  SPL( 82,243),  SPL( 84,229),  SPL( 84,245),  SPL( 86,231),
+  SPL( 86,247),  SPL( 88,233),  SPL( 88,249),  SPL( 90,235),  SPL( 90,251),  SPL( 92,237),  SPL( 92,253),  SPL( 94,239),
+  SPL( 94,255),  SPL( 96,241),  SPL( 98,227),  SPL( 98,243),  SPL(100,229),  SPL(100,245),  SPL(102,231),  SPL(102,247),
+  SPL(104,233),  SPL(104,249),  SPL(106,235),  SPL(106,251),  SPL(108,237),  SPL(108,253),  SPL(110,239),  SPL(110,255),
+  SPL(112,241),  SPL(114,227),  SPL(114,243),  SPL(116,229),  SPL(116,245),  SPL(118,231),  SPL(118,247),  SPL(120,233),
+  SPL(120,249),  SPL(122,235),  SPL(122,251),  SPL(124,237),  SPL(124,253),  SPL(126,239),  SPL(126,255),  SPL(128,241),
+  SPL(130,227),  SPL(130,243),  SPL(132,229),  SPL(132,245),  SPL(134,231),  SPL(134,247),  SPL(136,233),  SPL(136,249),
+  SPL(138,235),  SPL(138,251),  SPL(140,237),  SPL(140,253),  SPL(142,239),  SPL(142,255),  SPL(144,241),  SPL(146,227),
+  SPL(146,243),  SPL(148,229),  SPL(148,245),  SPL(150,231),  SPL(150,247),  SPL(152,233),  SPL(152,249),  SPL(154,235),
+  SPL(154,251),  SPL(156,237),  SPL(156,253),  SPL(158,239),  SPL(158,255),  SPL(160,241),  SPL(162,227),  SPL(162,243),
+  SPL(164,229),  SPL(164,245),  SPL(166,231),  SPL(166,247),  SPL(168,233),  SPL(168,249),  SPL(170,235),  SPL(170,251),
+  SPL(172,237),  SPL(172,253),  SPL(174,239),  SPL(174,255),  SPL(176,241),  SPL(178,227),  SPL(178,243),  SPL(180,229),
+  SPL(180,245),  SPL(182,231),  SPL(182,247),  SPL(184,233),  SPL(184,249),  SPL(186,235),  SPL(186,251),  SPL(188,237),
+  SPL(188,253),  SPL(190,239),  SPL(190,255),  SPL(192,241),  SPL(194,227),  SPL(194,243),  SPL(196,229),  SPL(196,245),
+  SPL(198,231),  SPL(198,247),  SPL(200,233),  SPL(200,249),  SPL(202,235),  SPL(202,251),  SPL(204,237),  SPL(204,253),
+  SPL(206,239),  SPL(206,255),  SPL(208,241),  SPL(210,227),  SPL(210,243),  SPL(212,229),  SPL(212,245),  SPL(214,231),
+  SPL(214,247),  SPL(216,233),  SPL(216,249),  SPL(218,235),  SPL(218,251),  SPL(220,237),  SPL(220,253),  SPL(222,239),
+  SPL(222,255),  SPL(224,241),  SPL(226,227),  SPL(226,243),  SPL(228,229),  SPL(228,245),  SPL(230,231),  SPL(230,247),
+  SPL(232,233),  SPL(232,249),  SPL(234,235),  SPL(234,251),  SPL(236,237),  SPL(236,253),  SPL(238,239),  SPL(238,255),
+  SPL(240,241),  SPL(242,241),  SPL(242,243),  SPL(244,243),  SPL(244,245),  SPL(246,245),  SPL(246,247),  SPL(248,247),
+  SPL(248,249),  SPL(250,249),  SPL(250,251),  SPL(252,251),  SPL(252,253),  SPL(254,253),  SPL(254,255),  SPL(254,255)
 },{
-  {  1,  1},  {  1,  1},  {  1, 17},  {  1, 33},  {  1, 49},  {  1, 65},  {  1, 81},  {  1, 97},
-  {  1,113},  {  1,129},  {  1,145},  {  1,161},  {  1,177},  {  1,193},  {  1,209},  {  1,225},
-  {  1,241},  {  3,227},  {  3,243},  {  5,229},  {  5,245},  {  7,231},  {  7,247},  {  9,233},
-  {  9,249},  { 11,235},  { 11,251},  { 13,237},  { 13,253},  { 15,239},  { 15,255},  { 17,241},
-  { 19,227},  { 19,243},  { 21,229},  { 21,245},  { 23,231},  { 23,247},  { 25,233},  { 25,249},
-  { 27,235},  { 27,251},  { 29,237},  { 29,253},  { 31,239},  { 31,255},  { 33,241},  { 35,227},
-  { 35,243},  { 37,229},  { 37,245},  { 39,231},  { 39,247},  { 41,233},  { 41,249},  { 43,235},
-  { 43,251},  { 45,237},  { 45,253},  { 47,239},  { 47,255},  { 49,241},  { 51,227},  { 51,243},
-  { 53,229},  { 53,245},  { 55,231},  { 55,247},  { 57,233},  { 57,249},  { 59,235},  { 59,251},
-  { 61,237},  { 61,253},  { 63,239},  { 63,255},  { 65,241},  { 67,227},  { 67,243},  { 69,229},
-  { 69,245},  { 71,231},  { 71,247},  { 73,233},  { 73,249},  { 75,235},  { 75,251},  { 77,237},
-  { 77,253},  { 79,239},  { 79,255},  { 81,241},  { 83,227},  { 83,243},  { 85,229},  { 85,245},
-  { 87,231},  { 87,247},  { 89,233},  { 89,249},  { 91,235},  { 91,251},  { 93,237},  { 93,253},
-  { 95,239},  { 95,255},  { 97,241},  { 99,227},  { 99,243},  {101,229},  {101,245},  {103,231},
-  {103,247},  {105,233},  {105,249},  {107,235},  {107,251},  {109,237},  {109,253},  {111,239},
-  {111,255},  {113,241},  {115,227},  {115,243},  {117,229},  {117,245},  {119,231},  {119,247},
-  {121,233},  {121,249},  {123,235},  {123,251},  {125,237},  {125,253},  {127,239},  {127,255},
-  {129,241},  {131,227},  {131,243},  {133,229},  {133,245},  {135,231},  {135,247},  {137,233},
-  {137,249},  {139,235},  {139,251},  {141,237},  {141,253},  {143,239},  {143,255},  {145,241},
-  {147,227},  {147,243},  {149,229},  {149,245},  {151,231},  {151,247},  {153,233},  {153,249},
-  {155,235},  {155,251},  {157,237},  {157,253},  {159,239},  {159,255},  {161,241},  {163,227},
-  {163,243},  {165,229},  {165,245},  {167,231},  {167,247},  {169,233},  {169,249},  {171,235},
-  {171,251},  {173,237},  {173,253},  {175,239},  {175,255},  {177,241},  {179,227},  {179,243},
-  {181,229},  {181,245},  {183,231},  {183,247},  {185,233},  {185,249},  {187,235},  {187,251},
-  {189,237},  {189,253},  {191,239},  {191,255},  {193,241},  {195,227},  {195,243},  {197,229},
-  {197,245},  {199,231},  {199,247},  {201,233},  {201,249},  {203,235},  {203,251},  {205,237},
-  {205,253},  {207,239},  {207,255},  {209,241},  {211,227},  {211,243},  {213,229},  {213,245},
-  {215,231},  {215,247},  {217,233},  {217,249},  {219,235},  {219,251},  {221,237},  {221,253},
-  {223,239},  {223,255},  {225,241},  {227,227},  {227,243},  {229,229},  {229,245},  {231,231},
-  {231,247},  {233,233},  {233,249},  {235,235},  {235,251},  {237,237},  {237,253},  {239,239},
-  {239,255},  {241,241},  {243,241},  {243,243},  {245,243},  {245,245},  {247,245},  {247,247},
-  {249,247},  {249,249},  {251,249},  {251,251},  {253,251},  {253,253},  {255,253},  {255,255}
+  SPL(  1,  1),  SPL(  1,  1),  SPL(  1, 17),  SPL(  1, 33),  SPL(  1, 49),  SPL(  1, 65),  SPL(  1, 81),  SPL(  1, 97),
+  SPL(  1,113),  SPL(  1,129),  SPL(  1,145),  SPL(  1,161),  SPL(  1,177),  SPL(  1,193),  SPL(  1,209),  SPL(  1,225),
+  SPL(  1,241),  SPL(  3,227),  SPL(  3,243),  SPL(  5,229),  SPL(  5,245),  SPL(  7,231),  SPL(  7,247),  SPL(  9,233),
+  SPL(  9,249),  SPL( 11,235),  SPL( 11,251),  SPL( 13,237),  SPL( 13,253),  SPL( 15,239),  SPL( 15,255),  SPL( 17,241),
+  SPL( 19,227),  SPL( 19,243),  SPL( 21,229),  SPL( 21,245),  SPL( 23,231),  SPL( 23,247),  SPL( 25,233),  SPL( 25,249),
+  SPL( 27,235),  SPL( 27,251),  SPL( 29,237),  SPL( 29,253),  SPL( 31,239),  SPL( 31,255),  SPL( 33,241),  SPL( 35,227),
+  SPL( 35,243),  SPL( 37,229),  SPL( 37,245),  SPL( 39,231),  SPL( 39,247),  SPL( 41,233),  SPL( 41,249),  SPL( 43,235),
+  SPL( 43,251),  SPL( 45,237),  SPL( 45,253),  SPL( 47,239),  SPL( 47,255),  SPL( 49,241),  SPL( 51,227),  SPL( 51,243),
+  SPL( 53,229),  SPL( 53,245),  SPL( 55,231),  SPL( 55,247),  SPL( 57,233),  SPL( 57,249),  SPL( 59,235),  SPL( 59,251),
+  SPL( 61,237),  SPL( 61,253),  SPL( 63,239),  SPL( 63,255),  SPL( 65,241),  SPL( 67,227),  SPL( 67,243),  SPL( 69,229),
+  SPL( 69,245),  SPL( 71,231),  SPL( 71,247),  SPL( 73,233),  SPL( 73,249),  SPL( 75,235),  SPL( 75,251),  SPL( 77,237),
+  SPL( 77,253),  SPL( 79,239),  SPL( 79,255),  SPL( 81,241),  SPL( 83,227),  SPL( 83,243),  SPL( 85,229),  SPL( 85,245),
+  SPL( 87,231),  SPL( 87,247),  SPL( 89,233),  SPL( 89,249),  SPL( 91,235),  SPL( 91,251),  SPL( 93,237),  SPL( 93,253),
+  SPL( 95,239),  SPL( 95,255),  SPL( 97,241),  SPL( 99,227),  SPL( 99,243),  SPL(101,229),  SPL(101,245),  SPL(103,231),
+  SPL(103,247),  SPL(105,233),  SPL(105,249),  SPL(107,235),  SPL(107,251),  SPL(109,237),  SPL(109,253),  SPL(111,239),
+  SPL(111,255),  SPL(113,241),  SPL(115,227),  SPL(115,243),  SPL(117,229),  SPL(117,245),  SPL(119,231),  SPL(119,247),
+  SPL(121,233),  SPL(121,249),  SPL(123,235),  SPL(123,251),  SPL(125,237),  SPL(125,253),  SPL(127,239),  SPL(127,255),
+  SPL(129,241),  SPL(131,227),  SPL(131,243),  SPL(133,229),  SPL(133,245),  SPL(135,231),  SPL(135,247),  SPL(137,233),
+  SPL(137,249),  SPL(139,235),  SPL(139,251),  SPL(141,237),  SPL(141,253),  SPL(143,239),  SPL(143,255),  SPL(145,241),
+  SPL(147,227),  SPL(147,243),  SPL(149,229),  SPL(149,245),  SPL(151,231),  SPL(151,247),  SPL(153,233),  SPL(153,249),
+  SPL(155,235),  SPL(155,251),  SPL(157,237),  SPL(157,253),  SPL(159,239),  SPL(159,255),  SPL(161,241),  SPL(163,227),
+  SPL(163,243),  SPL(165,229),  SPL(165,245),  SPL(167,231),  SPL(167,247),  SPL(169,233),  SPL(169,249),  SPL(171,235),
+  SPL(171,251),  SPL(173,237),  SPL(173,253),  SPL(175,239),  SPL(175,255),  SPL(177,241),  SPL(179,227),  SPL(179,243),
+  SPL(181,229),  SPL(181,245),  SPL(183,231),  SPL(183,247),  SPL(185,233),  SPL(185,249),  SPL(187,235),  SPL(187,251),
+  SPL(189,237),  SPL(189,253),  SPL(191,239),  SPL(191,255),  SPL(193,241),  SPL(195,227),  SPL(195,243),  SPL(197,229),
+  SPL(197,245),  SPL(199,231),  SPL(199,247),  SPL(201,233),  SPL(201,249),  SPL(203,235),  SPL(203,251),  SPL(205,237),
+  SPL(205,253),  SPL(207,239),  SPL(207,255),  SPL(209,241),  SPL(211,227),  SPL(211,243),  SPL(213,229),  SPL(213,245),
+  SPL(215,231),  SPL(215,247),  SPL(217,233),  SPL(217,249),  SPL(219,235),  SPL(219,251),  SPL(221,237),  SPL(221,253),
+  SPL(223,239),  SPL(223,255),  SPL(225,241),  SPL(227,227),  SPL(227,243),  SPL(229,229),  SPL(229,245),  SPL(231,231),
+  SPL(231,247),  SPL(233,233),  SPL(233,249),  SPL(235,235),  SPL(235,251),  SPL(237,237),  SPL(237,253),  SPL(239,239),
+  SPL(239,255),  SPL(241,241),  SPL(243,241),  SPL(243,243),  SPL(245,243),  SPL(245,245),  SPL(247,245),  SPL(247,247),
+  SPL(249,247),  SPL(249,249),  SPL(251,249),  SPL(251,251),  SPL(253,251),  SPL(253,253),  SPL(255,253),  SPL(255,255)
 }
 };
 #endif
@@ -35,27 +35,32 @@ namespace squish {
 /* *****************************************************************************
  */
 #if	!defined(SQUISH_USE_PRE)
+// start and end are packed into one word by value (start in the low byte),
+// all four channels can be gathered as 16 bit words and split in the vector
+// unit, the tables are 13 kB (26 * 256 * 2 bytes), one fit touches at most
+// four cache-lines of them
 struct PaletteSingleLookup2
 {
-  u8 start;
-  u8 end;
+  u16 packed;
 };
 
 struct PaletteSingleLookup4
 {
-  u8 start;
-  u8 end;
+  u16 packed;
 };
 
 struct PaletteSingleLookup8
 {
-  u8 start;
-  u8 end;
+  u16 packed;
 };
 
+#define	SPL(start, end)	{ (u16)((start) | ((end) << 8)) }
+
 #undef	SPL_ITERATIVE
 #include "palettesinglelookup.inl"
 
+#undef	SPL
+
 PaletteSingleSnap::PaletteSingleSnap(PaletteSet const* palette, int flags, int swap, int shared)
   : PaletteFit(palette, flags, swap, shared)
 {
@@ -184,17 +189,15 @@ Scr4 PaletteSingleSnap::ComputeEndPoints(int set, Vec4 const &metric, PaletteSin
   assert(m_entry[3] == (u8)FloatToInt<true,false>(255.0f * values->W(), 255));
    */
 
-  // just assign the end-points of index 1
-  Col4 s = Col4(
-    lookups[0] ? lookups[0][m_entry[0]].start : 0x00,
-    lookups[1] ? lookups[1][m_entry[1]].start : 0x00,
-    lookups[2] ? lookups[2][m_entry[2]].start : 0x00,
-    lookups[3] ? lookups[3][m_entry[3]].start : 0xFF);
-  Col4 e = Col4(
-    lookups[0] ? lookups[0][m_entry[0]].end : 0x00,
-    lookups[1] ? lookups[1][m_entry[1]].end : 0x00,
-    lookups[2] ? lookups[2][m_entry[2]].end : 0x00,
-    lookups[3] ? lookups[3][m_entry[3]].end : 0xFF);
+  // just assign the end-points of index 1, gather start (lo) and
+  // end (hi) of all four channels with one load each
+  Col4 se = Col4(
+    lookups[0] ? lookups[0][m_entry[0]].packed : 0x0000,
+    lookups[1] ? lookups[1][m_entry[1]].packed : 0x0000,
+    lookups[2] ? lookups[2][m_entry[2]].packed : 0x0000,
+    lookups[3] ? lookups[3][m_entry[3]].packed : 0xFFFF);
+  Col4 s = se & Col4(0xFF);
+  Col4 e = se >> 8;
 
   m_start[set] = Vec4(s) * (1.0f / 255.0f);
   m_end  [set] = Vec4(e) * (1.0f / 255.0f);
@@ -226,17 +229,15 @@ Scr4 PaletteSingleSnap::ComputeEndPoints(int set, Vec4 const &metric, PaletteSin
   assert(m_entry[3] == (u8)FloatToInt<true,false>(255.0f * values->W(), 255));
    */
 
-  // just assign the end-points of index 1
-  Col4 s = Col4(
-    lookups[0] ? lookups[0][m_entry[0]].start : 0x00,
-    lookups[1] ? lookups[1][m_entry[1]].start : 0x00,
-    lookups[2] ? lookups[2][m_entry[2]].start : 0x00,
-    lookups[3] ? lookups[3][m_entry[3]].start : 0xFF);
-  Col4 e = Col4(
-    lookups[0] ? lookups[0][m_entry[0]].end : 0x00,
-    lookups[1] ? lookups[1][m_entry[1]].end : 0x00,
-    lookups[2] ? lookups[2][m_entry[2]].end : 0x00,
-    lookups[3] ? lookups[3][m_entry[3]].end : 0xFF);
+  // just assign the end-points of index 1, gather start (lo) and
+  // end (hi) of all four channels with one load each
+  Col4 se = Col4(
+    lookups[0] ? lookups[0][m_entry[0]].packed : 0x0000,
+    lookups[1] ? lookups[1][m_entry[1]].packed : 0x0000,
+    lookups[2] ? lookups[2][m_entry[2]].packed : 0x0000,
+    lookups[3] ? lookups[3][m_entry[3]].packed : 0xFFFF);
+  Col4 s = se & Col4(0xFF);
+  Col4 e = se >> 8;
 
   m_start[set] = Vec4(s) * (1.0f / 255.0f);
   m_end  [set] = Vec4(e) * (1.0f / 255.0f);
@@ -268,17 +269,15 @@ Scr4 PaletteSingleSnap::ComputeEndPoints(int set, Vec4 const &metric, PaletteSin
   assert(m_entry[3] == (u8)FloatToInt<true,false>(255.0f * values->W(), 255));
    */
 
-  // just assign the end-points of index 1
-  Col4 s = Col4(
-    lookups[0] ? lookups[0][m_entry[0]].start : 0x00,
-    lookups[1] ? lookups[1][m_entry[1]].start : 0x00,
-    lookups[2] ? lookups[2][m_entry[2]].start : 0x00,
-    lookups[3] ? lookups[3][m_entry[3]].start : 0xFF);
-  Col4 e = Col4(
-    lookups[0] ? lookups[0][m_entry[0]].end : 0x00,
-    lookups[1] ? lookups[1][m_entry[1]].end : 0x00,
-    lookups[2] ? lookups[2][m_entry[2]].end : 0x00,
-    lookups[3] ? lookups[3][m_entry[3]].end : 0xFF);
+  // just assign the end-points of index 1, gather start (lo) and
+  // end (hi) of all four channels with one load each
+  Col4 se = Col4(
+    lookups[0] ? lookups[0][m_entry[0]].packed : 0x0000,
+    lookups[1] ? lookups[1][m_entry[1]].packed : 0x0000,
+    lookups[2] ? lookups[2][m_entry[2]].packed : 0x0000,
+    lookups[3] ? lookups[3][m_entry[3]].packed : 0xFFFF);
+  Col4 s = se & Col4(0xFF);
+  Col4 e = se >> 8;
 
   m_start[set] = Vec4(s) * (1.0f / 255.0f);
   m_end  [set] = Vec4(e) * (1.0f / 255.0f);
@@ -29,6 +29,10 @@
 
 #include "maths.h"
 
+#if	SQUISH_USE_F16C
+#include <immintrin.h>
+#endif
+
 namespace squish {
 
   // FloatTo...
@@ -55,6 +59,17 @@ namespace squish {
   static inline f23 SHalfToFloat(u16 h) {
     unsigned int c = shLUTm[shLUTo[h >> 10] + (h & 0x03FF)] + shLUTe[h >> 10]; return *((float *)&c); }
 
+  // ...ToFloat for whole pixels (multiples of 4)
+  static inline void SHalfToFloat(f23 *c, f10 const *h, int n) {
+#if	SQUISH_USE_F16C
+    for (int i = 0; i < n; i += 4)
+      _mm_storeu_ps(c + i, _mm_cvtph_ps(_mm_loadl_epi64((__m128i const *)(h + i))));
+#else
+    for (int i = 0; i < n; i += 1)
+      c[i] = SHalfToFloat(h[i].bits);
+#endif
+  }
+
 };
 
 #if	SQUISH_USE_ALTIVEC
@@ -1292,6 +1292,125 @@ private:
   short s[8];
 };
 
+class Col16
+{
+public:
+  typedef Col16 const& Arg;
+
+  Col16() {}
+
+  Col16( Col16 const& arg ) {
+    int i = 15; do { b[i] = arg.b[i]; } while (--i >= 0); }
+
+  Col16& operator=( Col16 const& arg ) {
+    int i = 15; do { b[i] = arg.b[i]; } while (--i >= 0);
+    return *this;
+  }
+
+  explicit Col16(int v) {
+    int i = 15; do { b[i] = (u8)v; } while (--i >= 0); }
+  explicit Col16(u8 v) {
+    int i = 15; do { b[i] = v; } while (--i >= 0); }
+
+  const u8 &operator[]( int pos ) const
+  {
+    return b[pos];
+  }
+
+  friend Col16 operator&( Col16::Arg left, Col16::Arg right ) {
+    Col16 res;
+    int i = 15; do { res.b[i] = left.b[i] & right.b[i]; } while (--i >= 0);
+    return res;
+  }
+
+  friend Col16 Min( Col16::Arg left, Col16::Arg right ) {
+    Col16 res;
+    int i = 15; do { res.b[i] = std::min(left.b[i], right.b[i]); } while (--i >= 0);
+    return res;
+  }
+
+  friend Col16 Max( Col16::Arg left, Col16::Arg right ) {
+    Col16 res;
+    int i = 15; do { res.b[i] = std::max(left.b[i], right.b[i]); } while (--i >= 0);
+    return res;
+  }
+
+  //! Returns |a - b| per unsigned byte
+  friend Col16 AbsoluteDifference( Col16::Arg left, Col16::Arg right ) {
+    Col16 res;
+    int i = 15; do { res.b[i] = (u8)std::abs((int)left.b[i] - (int)right.b[i]); } while (--i >= 0);
+    return res;
+  }
+
+  //! Returns the sum of all bytes
+  friend int HorizontalSum( Arg a ) {
+    int res = 0;
+    int i = 15; do { res += a.b[i]; } while (--i >= 0);
+    return res;
+  }
+
+  //! Returns the sum of all squared bytes
+  friend int HorizontalSumSquares( Arg a ) {
+    int res = 0;
+    int i = 15; do { res += a.b[i] * a.b[i]; } while (--i >= 0);
+    return res;
+  }
+
+  friend void LoadUnaligned( Col16 &a, void const *source ) {
+    int i = 15; do { a.b[i] = ((u8 const *)source)[i]; } while (--i >= 0); }
+
+  friend void StoreUnaligned( Col16::Arg a, void *destination ) {
+    int i = 15; do { ((u8 *)destination)[i] = a.b[i]; } while (--i >= 0); }
+
+  //! Unpacks the 16 3bit indices of a 64bit BC3-alpha/BC4 block into bytes
+  friend void LoadIndices3( Col16 &a, void const *block ) {
+    u8 const* bytes = (u8 const*)block + 2;
+    for (int i = 0; i < 2; ++i) {
+      int value = bytes[3 * i + 0] + (bytes[3 * i + 1] << 8) + (bytes[3 * i + 2] << 16);
+      for (int j = 0; j < 8; ++j)
+        a.b[8 * i + j] = (u8)((value >> (3 * j)) & 0x7);
+    }
+  }
+
+  //! Returns table[index] for 16 byte indices (< 16) into a 16 byte table
+  friend Col16 LookupBytes( Col16::Arg table, Col16::Arg indices ) {
+    Col16 res;
+    int i = 15; do { res.b[i] = table.b[indices.b[i] & 15]; } while (--i >= 0);
+    return res;
+  }
+
+  //! Returns table[index] for 16 byte indices (< 8) into a 8 word table
+  friend void LookupWords( Col16::Arg table, Col16::Arg indices, Col16 &lo, Col16 &hi ) {
+    int i = 7; do {
+      lo.b[2 * i + 0] = table.b[2 * indices.b[i + 0] + 0];
+      lo.b[2 * i + 1] = table.b[2 * indices.b[i + 0] + 1];
+      hi.b[2 * i + 0] = table.b[2 * indices.b[i + 8] + 0];
+      hi.b[2 * i + 1] = table.b[2 * indices.b[i + 8] + 1];
+    } while (--i >= 0);
+  }
+
+  friend void InterleaveBytes( Col16::Arg a, Col16::Arg b, Col16 &lo, Col16 &hi ) {
+    int i = 7; do {
+      lo.b[2 * i + 0] = a.b[i + 0]; lo.b[2 * i + 1] = b.b[i + 0];
+      hi.b[2 * i + 0] = a.b[i + 8]; hi.b[2 * i + 1] = b.b[i + 8];
+    } while (--i >= 0);
+  }
+
+  friend void InterleaveWords( Col16::Arg a, Col16::Arg b, Col16 &lo, Col16 &hi ) {
+    int i = 3; do {
+      lo.b[4 * i + 0] = a.b[2 * i + 0]; lo.b[4 * i + 1] = a.b[2 * i + 1];
+      lo.b[4 * i + 2] = b.b[2 * i + 0]; lo.b[4 * i + 3] = b.b[2 * i + 1];
+      hi.b[4 * i + 0] = a.b[2 * i + 8]; hi.b[4 * i + 1] = a.b[2 * i + 9];
+      hi.b[4 * i + 2] = b.b[2 * i + 8]; hi.b[4 * i + 3] = b.b[2 * i + 9];
+    } while (--i >= 0);
+  }
+
+#if	!defined(SQUISH_USE_AMP)
+private:
+#endif
+  u8 b[16];
+};
+
 #if	!defined(SQUISH_USE_COMPUTE)
 #define VEC4_CONST( X ) Vec4( X )
 
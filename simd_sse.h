@@ -71,6 +71,8 @@ namespace squish {
 
 #define COL4_CONST( X ) Col4( X )
 
+class Vec3;
+class Vec4;
 
 class Col3
 {
@@ -1045,6 +1047,7 @@ private:
 
 	friend class Col4;
 	friend class Vec3;
+	friend Vec3 SHalfToFloat( Col3::Arg v );
 };
 
 class Col4
@@ -2224,6 +2227,7 @@ private:
 
 	friend class Vec4;
 	friend class Col8;
+	friend Vec4 SHalfToFloat( Col4::Arg v );
 };
 
 #if	!defined(SQUISH_USE_PRE)
@@ -2623,6 +2627,162 @@ private:
 	friend class Vec4;
 };
 
+class Col16
+{
+public:
+	typedef Col16 const& Arg;
+
+	Col16() {}
+
+	explicit Col16( __m128i v ) : m_v( v ) {}
+
+	Col16( Arg arg ) : m_v( arg.m_v ) {}
+
+	Col16& operator=( Arg arg )
+	{
+		m_v = arg.m_v;
+		return *this;
+	}
+
+	explicit Col16(int s) : m_v( _mm_set1_epi8( (char)s ) ) {}
+	explicit Col16(u8 s) : m_v( _mm_set1_epi8( (char)s ) ) {}
+
+	const u8 &operator[]( int pos ) const
+	{
+		return ((u8 *)&m_v)[pos];
+	}
+
+	friend Col16 operator&( Arg left, Arg right )
+	{
+		return Col16( _mm_and_si128( left.m_v, right.m_v ) );
+	}
+
+	friend Col16 Min( Arg left, Arg right )
+	{
+		return Col16( _mm_min_epu8( left.m_v, right.m_v ) );
+	}
+
+	friend Col16 Max( Arg left, Arg right )
+	{
+		return Col16( _mm_max_epu8( left.m_v, right.m_v ) );
+	}
+
+	//! Returns |a - b| per unsigned byte
+	friend Col16 AbsoluteDifference( Arg left, Arg right )
+	{
+		return Col16( _mm_or_si128(
+			_mm_subs_epu8( left.m_v, right.m_v ),
+			_mm_subs_epu8( right.m_v, left.m_v ) ) );
+	}
+
+	//! Returns the sum of all bytes (psadbw against zero)
+	friend int HorizontalSum( Arg a )
+	{
+		__m128i res = _mm_sad_epu8( a.m_v, _mm_setzero_si128() );
+
+		res = _mm_add_epi32( res, _mm_shuffle_epi32( res, SQUISH_SSE_SWAP64() ) );
+
+		return _mm_cvtsi128_si32( res );
+	}
+
+	//! Returns the sum of all squared bytes
+	friend int HorizontalSumSquares( Arg a )
+	{
+		__m128i lo = _mm_unpacklo_epi8( a.m_v, _mm_setzero_si128() );
+		__m128i hi = _mm_unpackhi_epi8( a.m_v, _mm_setzero_si128() );
+		__m128i res;
+
+		// max 16 * 255 * 255 = 0x000FE010, fits
+		res = _mm_add_epi32( _mm_madd_epi16( lo, lo ), _mm_madd_epi16( hi, hi ) );
+		res = _mm_add_epi32( res, _mm_shuffle_epi32( res, SQUISH_SSE_SWAP64() ) );
+		res = _mm_add_epi32( res, _mm_shuffle_epi32( res, SQUISH_SSE_SWAP32() ) );
+
+		return _mm_cvtsi128_si32( res );
+	}
+
+	friend void LoadUnaligned( Col16 &a, void const *source )
+	{
+		a.m_v = _mm_loadu_si128( (__m128i const *)source );
+	}
+
+	friend void StoreUnaligned( Arg a, void *destination )
+	{
+		_mm_storeu_si128( (__m128i *)destination, a.m_v );
+	}
+
+	//! Unpacks the 16 3bit indices of a 64bit BC3-alpha/BC4 block into bytes
+	friend void LoadIndices3( Col16 &a, void const *block )
+	{
+		// drop the two end-points, 48 index-bits remain
+		__m128i v = _mm_srli_epi64( _mm_loadl_epi64( (__m128i const *)block ), 16 );
+
+#if ( SQUISH_USE_XSSE >= 3 )
+		// gather the two bytes covering each pair of indices (bit 6 * k)
+		v = _mm_shuffle_epi8( v, _mm_setr_epi8( 0, 1, 0, 1, 1, 2, 2, 3, 3, 4, 3, 4, 4, 5, 5, 6 ) );
+		// align each pair at bit 6 (offsets 0, 6, 4, 2)
+		v = _mm_mullo_epi16( v, _mm_setr_epi16( 64, 1, 4, 16, 64, 1, 4, 16 ) );
+		v = _mm_srli_epi16( v, 6 );
+#else
+		unsigned__int64 bits =
+			((unsigned__int64)(unsigned int)_mm_cvtsi128_si32( v ) <<  0) +
+			((unsigned__int64)(unsigned int)_mm_cvtsi128_si32( _mm_srli_epi64( v, 32 ) ) << 32);
+
+		v = _mm_setr_epi16(
+			(short)(bits >>  0), (short)(bits >>  6), (short)(bits >> 12), (short)(bits >> 18),
+			(short)(bits >> 24), (short)(bits >> 30), (short)(bits >> 36), (short)(bits >> 42) );
+#endif
+
+		// split the pairs into bytes
+		a.m_v = _mm_or_si128(
+			_mm_and_si128( v, _mm_set1_epi16( 0x0007 ) ),
+			_mm_and_si128( _mm_slli_epi16( v, 5 ), _mm_set1_epi16( 0x0700 ) ) );
+	}
+
+	//! Returns table[index] for 16 byte indices (< 16) into a 16 byte table
+	friend Col16 LookupBytes( Arg table, Arg indices )
+	{
+#if ( SQUISH_USE_XSSE >= 3 )
+		return Col16( _mm_shuffle_epi8( table.m_v, indices.m_v ) );
+#else
+		u8 a16 t[16], i[16], r[16];
+
+		_mm_store_si128( (__m128i *)t, table.m_v );
+		_mm_store_si128( (__m128i *)i, indices.m_v );
+
+		for (int n = 0; n < 16; n++)
+			r[n] = t[i[n] & 15];
+
+		return Col16( _mm_load_si128( (__m128i const *)r ) );
+#endif
+	}
+
+	//! Returns table[index] for 16 byte indices (< 8) into a 8 word table
+	friend void LookupWords( Arg table, Arg indices, Col16 &lo, Col16 &hi )
+	{
+		// byte-pairs (2 * i, 2 * i + 1)
+		__m128i i2 = _mm_add_epi8( indices.m_v, indices.m_v );
+		__m128i i3 = _mm_add_epi8( i2, _mm_set1_epi8( 1 ) );
+
+		lo = LookupBytes( table, Col16( _mm_unpacklo_epi8( i2, i3 ) ) );
+		hi = LookupBytes( table, Col16( _mm_unpackhi_epi8( i2, i3 ) ) );
+	}
+
+	friend void InterleaveBytes( Arg a, Arg b, Col16 &lo, Col16 &hi )
+	{
+		lo = Col16( _mm_unpacklo_epi8( a.m_v, b.m_v ) );
+		hi = Col16( _mm_unpackhi_epi8( a.m_v, b.m_v ) );
+	}
+
+	friend void InterleaveWords( Arg a, Arg b, Col16 &lo, Col16 &hi )
+	{
+		lo = Col16( _mm_unpacklo_epi16( a.m_v, b.m_v ) );
+		hi = Col16( _mm_unpackhi_epi16( a.m_v, b.m_v ) );
+	}
+
+private:
+	__m128i m_v;
+};
+
 #define VEC4_CONST( X ) Vec4( X )
 
 class Vec3
@@ -3352,6 +3512,8 @@ private:
 	__m128 m_v;
 
 	friend class Vec4;
+	template<const bool round>
+	friend Col3 FloatToSHalf( Vec3::Arg v );
 };
 
 template<const bool round>
@@ -3373,6 +3535,14 @@ Col3 FloatToSHalf( Vec3::Arg v );
 template<const bool round>
 Col3 FloatToSHalf( Vec3::Arg v )
 {
+#if	SQUISH_USE_F16C
+	// truncate like the tables, which also map overflows to INF instead of 0x7BFF
+	__m128i h = _mm_cvtepu16_epi32( _mm_cvtps_ph( v.m_v, _MM_FROUND_TO_ZERO ) );
+	__m128i o = _mm_castps_si128( _mm_cmpge_ps( _mm_and_ps( v.m_v, _mm_castsi128_ps( _mm_set1_epi32( 0x7FFFFFFF ) ) ), _mm_set1_ps( 65536.0f ) ) );
+	__m128i m = _mm_cmpeq_epi32( _mm_and_si128( h, _mm_set1_epi32( 0x7FFF ) ), _mm_set1_epi32( 0x7BFF ) );
+
+	return Col3( _mm_sub_epi32( h, _mm_and_si128( o, m ) ) );
+#else
 	Col3 h;
 
 	h.GetR() = FloatToSHalf(v.X());
@@ -3380,6 +3550,7 @@ Col3 FloatToSHalf( Vec3::Arg v )
 	h.GetB() = FloatToSHalf(v.Z());
 
 	return h;
+#endif
 }
 
 Vec3 UHalfToFloat( Col3::Arg v )
@@ -3395,6 +3566,12 @@ Vec3 UHalfToFloat( Col3::Arg v )
 
 Vec3 SHalfToFloat( Col3::Arg v )
 {
+#if	SQUISH_USE_F16C
+	// only the bottom 16 bits are the half, like the (u16) casts below
+	__m128i h = _mm_packus_epi32( _mm_and_si128( v.m_v, _mm_set1_epi32( 0xFFFF ) ), _mm_setzero_si128() );
+
+	return Vec3( _mm_cvtph_ps( h ) );
+#else
 	Vec3 f;
 
 	f.GetX() = SHalfToFloat((u16)v.R());
@@ -3402,6 +3579,7 @@ Vec3 SHalfToFloat( Col3::Arg v )
 	f.GetZ() = SHalfToFloat((u16)v.B());
 
 	return f;
+#endif
 }
 
 class Vec4
@@ -3674,6 +3852,11 @@ public:
 		return Vec4( _mm_and_ps( left.m_v, right.m_v ) );
 	}
 
+	friend Vec4 operator|( Arg left, Arg right )
+	{
+		return Vec4( _mm_or_ps( left.m_v, right.m_v ) );
+	}
+
 	friend Vec4 operator%( Arg left, Arg right )
 	{
 		return Vec4( _mm_andnot_ps( left.m_v, right.m_v ) );
@@ -4416,8 +4599,16 @@ public:
 		_mm_storeu_ps( (float *)destination, _mm_unpacklo_ps( a.m_v, b.m_v ) );
 	}
 
+	friend void Transpose( Vec4 &a, Vec4 &b, Vec4 &c, Vec4 &d )
+	{
+		_MM_TRANSPOSE4_PS( a.m_v, b.m_v, c.m_v, d.m_v );
+	}
+
 private:
 	__m128 m_v;
+
+	template<const bool round>
+	friend Col4 FloatToSHalf( Vec4::Arg v );
 };
 
 template<const bool round>
@@ -4440,6 +4631,14 @@ Col4 FloatToSHalf( Vec4::Arg v );
 template<const bool round>
 Col4 FloatToSHalf( Vec4::Arg v )
 {
+#if	SQUISH_USE_F16C
+	// truncate like the tables, which also map overflows to INF instead of 0x7BFF
+	__m128i h = _mm_cvtepu16_epi32( _mm_cvtps_ph( v.m_v, _MM_FROUND_TO_ZERO ) );
+	__m128i o = _mm_castps_si128( _mm_cmpge_ps( _mm_and_ps( v.m_v, _mm_castsi128_ps( _mm_set1_epi32( 0x7FFFFFFF ) ) ), _mm_set1_ps( 65536.0f ) ) );
+	__m128i m = _mm_cmpeq_epi32( _mm_and_si128( h, _mm_set1_epi32( 0x7FFF ) ), _mm_set1_epi32( 0x7BFF ) );
+
+	return Col4( _mm_sub_epi32( h, _mm_and_si128( o, m ) ) );
+#else
 	Col4 h;
 
 	h.GetR() = FloatToSHalf(v.X());
@@ -4448,6 +4647,7 @@ Col4 FloatToSHalf( Vec4::Arg v )
 	h.GetA() = FloatToSHalf(v.W());
 
 	return h;
+#endif
 }
 
 Vec4 UHalfToFloat( Col4::Arg v )
@@ -4464,6 +4664,12 @@ Vec4 UHalfToFloat( Col4::Arg v )
 
 Vec4 SHalfToFloat( Col4::Arg v )
 {
+#if	SQUISH_USE_F16C
+	// only the bottom 16 bits are the half, like the (u16) casts below
+	__m128i h = _mm_packus_epi32( _mm_and_si128( v.m_v, _mm_set1_epi32( 0xFFFF ) ), _mm_setzero_si128() );
+
+	return Vec4( _mm_cvtph_ps( h ) );
+#else
 	Vec4 f;
 
 	f.GetX() = SHalfToFloat((u16)v.R());
@@ -4472,6 +4678,7 @@ Vec4 SHalfToFloat( Col4::Arg v )
 	f.GetW() = SHalfToFloat((u16)v.A());
 
 	return f;
+#endif
 }
 
 // TODO: figure out how to put static const instances into an incomplete class body
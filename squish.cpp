@@ -75,16 +75,57 @@ namespace squish {
 #pragma warning(disable: 4482)
 
 /* *****************************************************************************
+ * BC7 effort levels, each level is a budget for the search:
+ * - modes: the modes which are tried (bit per mode-number, 6 is always possible)
+ * - partitions: the number of ranked partitions tried per mode (0 for all)
+ * - rotations: the number of component rotations tried (modes 4 and 5)
+ * - swaps: the number of index-selections tried (mode 4)
+ * - sharedbits: if the shared-bit trials are done (FEATURE_SHAREDBITS_TRIALS)
+ * - fit: the fit refining the best candidate (range-fit or cluster-fit iterations)
+ * - classify: if blocks with few colours skip the modes with more subsets
+ * - prune: if rotations are skipped by their estimated least error, which
+ *   isn't a strict bound of the coded error
+ *
+ * cluster-fit iterations of 14 and 15 also retry the swaps and shared-bits
  */
 #if	!defined(SQUISH_USE_PRE)
+struct EffortBudget {
+  int modes, partitions, rotations, swaps, sharedbits, fit, classify, prune;
+};
+
+static const EffortBudget effortbudget[10] = {
+  { 0x40,  0, 1, 1, 0, kColourRangeFit       , 1, 1 },	// 0: mode 6 only
+  { 0x4A,  4, 1, 1, 0, kColourRangeFit       , 1, 1 },	// 1: + 2-subset modes 1 and 3
+  { 0x7A,  8, 2, 1, 0, kColourRangeFit       , 1, 1 },	// 2: + rotated modes 4 and 5
+  { 0xFF,  8, 4, 2, 0, kColourRangeFit       , 1, 1 },	// 3: all modes
+  { 0xFF, 16, 4, 2, 0, kColourClusterFit *  1, 1, 1 },	// 4
+  { 0xFF, 32, 4, 2, 0, kColourClusterFit *  1, 1, 1 },	// 5
+  { 0xFF,  0, 4, 2, 1, kColourClusterFit *  1, 0, 0 },	// 6: all partitions
+  { 0xFF,  0, 4, 2, 1, kColourClusterFit *  2, 0, 0 },	// 7
+  { 0xFF,  0, 4, 2, 1, kColourClusterFit *  8, 0, 0 },	// 8
+  { 0xFF,  0, 4, 2, 1, kColourClusterFit * 15, 0, 0 },	// 9: the whole shebang
+};
+
+static EffortBudget const &GetEffortBudget(int effort)
+{
+  // no or an invalid level (11-15 fit into the bits) is the whole search
+  if ((effort < kEffortLevel0) || (effort > kEffortLevel9))
+    return effortbudget[9];
+
+  return effortbudget[(effort >> 20) - 1];
+}
+
+/* *****************************************************************************
+ */
 int SanitizeFlags(int flags)
 {
   // grab the flag bits
   int method = flags & (kBtcp);
   int fit    = flags & (kColourRangeFit | kAlphaIterativeFit | kColourIterativeClusterFits);
   int metric = flags & (kColourMetrics);
-  int extra  = flags & (kWeightColourByAlpha);
+  int extra  = flags & (kWeightColourByAlpha | kAlphaDualCodebookFit | kAlphaExhaustiveFit);
   int mode   = flags & (kVariableCodingModes);
+  int effort = flags & (kEffortLevels);
   int map    = flags & (kSrgbExternal | kSrgbInternal | kSignedExternal | kSignedInternal);
 
   // set defaults
@@ -107,8 +148,14 @@ int SanitizeFlags(int flags)
   if ((method == kBtc7) && (mode > kVariableCodingMode8))
     mode = 0;
 
+  // the effort level decides the fit for BC7, and is meaningless otherwise
+  if ((method != kBtc7) || (effort > kEffortLevel9))
+    effort = 0;
+  if (effort)
+    fit = GetEffortBudget(effort).fit;
+
   // done
-  return method + fit + metric + extra + mode + map;
+  return method + fit + metric + extra + mode + effort + map;
 }
 
 /* *****************************************************************************
@@ -154,6 +201,150 @@ void SetWeights(int flags, const f23* rgba)
   }
 }
 
+int g_partitionranking = FEATURE_PARTITION_RANKING;
+
+void SetPartitionRanking(int count)
+{
+  // 0 searches all partitions
+  g_partitionranking = std::max(0, std::min(64, count));
+}
+
+#if	defined(FEATURE_SHAREDBITS_TRIALS)
+int g_sharedbitstrials = FEATURE_SHAREDBITS_TRIALS;
+#endif
+
+void SetSharedBitsTrials(int strategy)
+{
+#if	defined(FEATURE_SHAREDBITS_TRIALS)
+  // the permutation trials are compiled into the range fit
+  if (((strategy >= SHAREDBITS_TRIAL_ALPHAONLYOPAQUE) && (strategy <= SHAREDBITS_TRIAL_ALL)) ||
+      ((strategy == SHAREDBITS_TRIAL_PARITY)))
+    g_sharedbitstrials = strategy;
+#endif
+}
+
+#if	defined(FEATURE_CLUSTERSEARCH_PREFIXSUMS)
+int g_clustersearchprefix = FEATURE_CLUSTERSEARCH_PREFIXSUMS;
+#endif
+
+void SetClusterSearchPrefixSums(bool enable)
+{
+#if	defined(FEATURE_CLUSTERSEARCH_PREFIXSUMS)
+  g_clustersearchprefix = enable ? 1 : 0;
+#endif
+}
+
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+int g_palettelayouts = FEATURE_PALETTEBLOCK_LAYOUTS;
+#endif
+
+void SetPaletteBlockLayouts(bool enable)
+{
+#if	defined(FEATURE_PALETTEBLOCK_LAYOUTS)
+  g_palettelayouts = enable ? 1 : 0;
+#endif
+}
+
+// the fits sum the error of the 16 texels over channels normalized to [0,1]
+float g_targeterror = FEATURE_TARGET_ERROR * (16.0f / (255.0f * 255.0f));
+
+void SetTargetError(float mse)
+{
+  g_targeterror = std::max(0.0f, mse) * (16.0f / (255.0f * 255.0f));
+}
+
+void SetTargetPSNR(float psnr)
+{
+  // PSNR = 10 * log10(peak^2 / MSE), the peak is 1 in the normalized range
+  g_targeterror = (psnr > 0.0f ? 16.0f * powf(10.0f, -0.1f * psnr) : 0.0f);
+}
+
+int g_alphacodebookguess = FEATURE_ALPHA_CODEBOOK_GUESS;
+
+void SetAlphaCodebookGuess(bool enable)
+{
+  g_alphacodebookguess = enable ? 1 : 0;
+}
+
+int g_blockclassifier = FEATURE_BLOCK_CLASSIFIER;
+
+void SetBlockClassifier(bool enable)
+{
+  g_blockclassifier = enable ? 1 : 0;
+}
+
+int g_hdrpartitionranking = FEATURE_HDR_PARTITION_RANKING;
+
+void SetHDRPartitionRanking(int count)
+{
+  // 0 searches all partitions
+  g_hdrpartitionranking = std::max(0, std::min(32, count));
+}
+
+int g_hdrmodepruning = FEATURE_HDR_MODE_PRUNING;
+
+void SetHDRModePruning(bool enable)
+{
+  g_hdrmodepruning = enable ? 1 : 0;
+}
+
+int g_powerestimate = FEATURE_POWERESTIMATE;
+int g_poweriterations = FEATURE_POWERESTIMATE_ITERATIONS;
+
+void SetPowerEstimate(bool enable)
+{
+  g_powerestimate = enable ? 1 : 0;
+}
+
+void SetPowerIterations(int count)
+{
+  // the convergence test remains, the count only caps it
+  g_poweriterations = std::max(1, std::min(64, count));
+}
+
+int g_solverstatistics = 0;
+long long g_solversolves = 0;
+long long g_solveriterations = 0;
+double g_solverseconds = 0.0;
+
+void SetSolverStatistics(bool enable)
+{
+  g_solverstatistics = enable ? 1 : 0;
+  g_solversolves = 0;
+  g_solveriterations = 0;
+  g_solverseconds = 0.0;
+}
+
+void GetSolverStatistics(long long& solves, long long& iterations, double& seconds)
+{
+  solves = g_solversolves;
+  iterations = g_solveriterations;
+  seconds = g_solverseconds;
+}
+
+int g_sharedbitsstatistics = 0;
+long long g_sharedbitspredictions = 0;
+long long g_sharedbitshits = 0;
+
+void SetSharedBitsStatistics(bool enable)
+{
+  g_sharedbitsstatistics = enable ? 1 : 0;
+  g_sharedbitspredictions = 0;
+  g_sharedbitshits = 0;
+}
+
+void GetSharedBitsStatistics(long long& predictions, long long& hits)
+{
+  predictions = g_sharedbitspredictions;
+  hits = g_sharedbitshits;
+}
+
+static doinline void CountSharedBitsPrediction(bool hit)
+{
+  g_sharedbitspredictions += 1;
+  g_sharedbitshits += hit ? 1 : 0;
+}
+
 /* *****************************************************************************
  */
 template<typename dtyp>
@@ -235,6 +426,38 @@ void CompressNormalBtc1u(dtyp const* xyzd, int mask, void* block, int flags)
 struct statistics gstat = {0};
 #endif
 
+/* guess before the mode search how many subsets are worth searching (see
+ * the observations in CompressPaletteBtc7uV1), this is a lossy heuristic
+ * which trades quality for speed:
+ * - 1-2 colours get 1 subset, the end-points can hold them (up to their
+ *   precision)
+ * - opaque lines get 1 subset, but GetChannel() only detects runs where one
+ *   channel varies or all vary alike (grey), and more subsets still code a
+ *   line better, their shorter ranges quantize finer (a grey ramp went from
+ *   rms 0.99 to 1.37)
+ * - 3-4 colours get at most 2 subsets, although 3 subsets still code some
+ *   of them better (rms 9.29 to 10.60 on such blocks)
+ * anything else gets the full search
+ */
+template<typename dtyp>
+static int ClassifyPaletteBlock(dtyp const* rgba, int mask, int flags)
+{
+  // the merged single set holds the unique colours of the whole block
+  PaletteSet merged(rgba, mask, flags + kVariableCodingMode7);
+
+  int count = merged.GetCount();
+  if (count <= 2)
+    return 1;
+#ifdef	FEATURE_TEST_LINES
+  if (!merged.IsTransparent() && (merged.GetChannel(0) >= 0))
+    return 1;
+#endif
+  if (count <= 4)
+    return 2;
+
+  return 3;
+}
+
 template<typename dtyp, class PaletteTypeFit>
 Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
 {
@@ -327,14 +550,20 @@ Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
   int lmts =  3;
   int lmtp = -1;
 
-  // use the same data-structure all the time
-  PaletteSet bestpal;
+  // or to the number of sets the block needs
+  if ((numm == 0) && g_blockclassifier)
+    lmts = ClassifyPaletteBlock(rgba, mask, flags);
+
+  // use the same data-structures all the time: the best set and the current candidate
+  PaletteSet workspace[2];
+  int bestset = -1;
   int bestmde = -1;
   int bestswp = -1;
   int bestbit = -1;
   int besttyp = -1;
 
   Scr4 error(FLT_MAX);
+  Scr4 target(g_targeterror);
 
   for (int m = sm; m <= em; m++) {
     int mode = modeorder[om][m];
@@ -387,6 +616,7 @@ Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
 
     // create the initial point set and quantizer
     PaletteSet initial(rgba, mask, flags + mode);
+    PaletteMoments moments(initial);
     vQuantizer qnt(cb, cb, cb, ab);
 
     // signal if we do we have anything better this iteration of the search
@@ -403,6 +633,9 @@ Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
     // if we see we have no transparent values, don't try non-rotated palettes (alpha is constant for all)
     if (!initial.IsTransparent() && initial.IsSeperateAlpha())
       sr = 1;
+
+    // try only the shared bits predicted from the end-points
+    bool parity = false;
 #if	defined(FEATURE_SHAREDBITS_TRIALS)
     // if we see we have no transparent values, force all shared bits to 1, or non-opaque codebook-entries occur
     // the all transparent case isn't so crucial, when we use IGNORE_ALPHA0 it's redundant to force 0 anyway
@@ -410,20 +643,47 @@ Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
       sb = eb;
     // otherwise just use the most occurring bit (parity) for all other cases
     // otherwise just use the most occurring bit (parity) for all non-alpha cases
-    else if (((FEATURE_SHAREDBITS_TRIALS == SHAREDBITS_TRIAL_ALPHAONLYOPAQUE)) ||
-	     ((FEATURE_SHAREDBITS_TRIALS == SHAREDBITS_TRIAL_ALPHAONLY) && (mode != kVariableCodingMode7) && !initial.IsTransparent()) ||
-	     ((FEATURE_SHAREDBITS_TRIALS == SHAREDBITS_TRIAL_LOWPRC) && (mode < kVariableCodingMode5) && (mode != kVariableCodingMode1)))
+    else if (((g_sharedbitstrials == SHAREDBITS_TRIAL_ALPHAONLYOPAQUE)) ||
+	     ((g_sharedbitstrials == SHAREDBITS_TRIAL_ALPHAONLY) && (mode != kVariableCodingMode7) && !initial.IsTransparent()) ||
+	     ((g_sharedbitstrials == SHAREDBITS_TRIAL_LOWPRC) && (mode < kVariableCodingMode5) && (mode != kVariableCodingMode1)))
       sb = eb = SBSKIP;
+    // or predict them from the end-points of each fit
+    else if ((g_sharedbitstrials == SHAREDBITS_TRIAL_PARITY) && (sb != eb))
+      parity = true;
 #endif
 
     // choose rotation or partition, they're mutually exclusive
     int spr = (er ? sr : sp),
 	epr = (er ? er : ep);
 
+    // rank the partitions by their estimated error, and search only the best ones
+    int ranking[64], numpr = epr - spr + 1;
+    for (int pr = spr; pr <= epr; pr++)
+      ranking[pr - spr] = pr;
+    if (!er && (nums > 1) && (lmtp == -1) && g_partitionranking && (g_partitionranking < numpr))
+      moments.RankPartitions(flags + mode, numpr, ranking), numpr = g_partitionranking;
+
+    // rank the rotations by their estimated error, the separate-alpha set
+    // doesn't keep all four channels, so the statistics come from a merged one
+    PaletteRotations rotations;
+    if (er) {
+      PaletteSet merged(rgba, mask, flags + kVariableCodingMode7);
+      PaletteMoments(merged).EstimateRotations(flags + mode, sr, er, rotations);
+
+      for (int rp = 0; rp < numpr; rp++)
+	ranking[rp] = rotations.ranking[rp];
+    }
+
     // search for the best partition/rotation
-    for (int pr = spr; pr <= epr; pr++) {
-      // create the minimal point set
-      PaletteSet palette(initial, mask, flags + mode, pr);
+    for (int rp = 0; rp < numpr; rp++) {
+      int pr = ranking[rp];
+
+      // create the minimal point set in the workspace not holding the best
+      // (the best one is used after the loop, it can't refer to the moments)
+      int cur = (bestset == 0 ? 1 : 0);
+
+      PaletteSet &palette = workspace[cur];
+      palette.Permute(initial, mask, flags + mode, pr);
 
 #if 0
       // if we see we have less colors than sets, 
@@ -436,11 +696,11 @@ Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
 #if defined(TRACK_STATISTICS)
       for (int xu = 0; xu < nums; xu++) {
 	int cnt = palette.GetCount(xu);
-	gstat.num_counts[mnum][p][xu][cnt]++;
+	gstat.num_counts[mnum][pr][xu][cnt]++;
 #ifdef	FEATURE_TEST_LINES
 	if (cnt > 2) {
 	  int chn = palette.GetChannel(xu) + 1;
-	  gstat.num_channels[mnum][p][xu][chn]++;
+	  gstat.num_channels[mnum][pr][xu][chn]++;
 	}
 #endif
       }
@@ -452,30 +712,41 @@ Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
       // do a range fit (which uses single palette fit if appropriate)
       PaletteTypeFit fit(&palette, flags + mode);
       
+      // the shared bits tried for this fit
+      int fb = sb, lb = eb;
+      if (parity)
+	fb = lb = fit.PredictSharedBits();
+
+      // the prediction is only measured against trials of all the bits
+      int predictbit = (g_sharedbitsstatistics && (fb != lb) ? fit.PredictSharedBits() : SBSKIP);
+      int trialbit = SBSKIP;
+
       // TODO: swap & shared are mutual exclusive
 
       // search for the best swap
       for (int x = sx; x <= ex; x++) {
 	fit.ChangeSwap(x);
 	// search for the best shared bit
-	for (int b = sb; b <= eb; b++) {
+	for (int b = fb; b <= lb; b++) {
 	  fit.ChangeShared(b);
 	  
 	  // update with old best error (reset IsBest)
 	  fit.SetError(error);
 
-	  // we could code it lossless, no point in trying any further at all
+	  // we could code it lossless (or good enough), no point in trying any further at all
 	  fit.PaletteTypeFit::Compress(block, qnt, mnum);
 	  if (fit.IsBest()) {
-	    if (fit.Lossless())
-	      return Scr4(0.0f);
+	    if (fit.Sufficient(target))
+	      return fit.GetError();
+
+	    trialbit = b;
 
 #if   !defined(TRACK_STATISTICS) && !defined(VERIFY_QUANTIZER)
 	    if (cluster)
 #endif
 	    {
 	      bestmde = mode,
-	      bestpal = palette,
+	      bestset = cur,
 	      bestswp = x,
 	      bestbit = b,
 	      besttyp = 0,
@@ -487,6 +758,10 @@ Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
 	  error = fit.GetError();
 	}
       }
+
+      // how often the prediction hits the best of the trials
+      if ((predictbit != SBSKIP) && (trialbit != SBSKIP))
+	CountSharedBitsPrediction(predictbit == trialbit);
     }
 
     // check the compression type and compress palette of the chosen partition even better
@@ -494,10 +769,10 @@ Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
       int degree = (flags & kColourIterativeClusterFits);
 
       // default to a cluster fit (could be iterative or not)
-      PaletteClusterFit fit(&bestpal, flags + mode);
+      PaletteClusterFit fit(&workspace[bestset], flags + mode);
       
       // we want the whole shebang, this takes looong!
-      if (degree < (kColourClusterFit * 15))
+      if ((degree < (kColourClusterFit * 15)) || parity)
 	sb = eb = bestbit;
       if (degree < (kColourClusterFit * 14))
 	sx = ex = bestswp;
@@ -512,11 +787,11 @@ Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
 	  // update with old best error (reset IsBest)
 	  fit.SetError(error);
 
-	  // we could code it lossless, no point in trying any further at all
+	  // we could code it lossless (or good enough), no point in trying any further at all
 	  fit.PaletteClusterFit::Compress(block, qnt, mnum);
 	  if (fit.IsBest()) {
-	    if (fit.Lossless())
-	      return Scr4(0.0f);
+	    if (fit.Sufficient(target))
+	      return fit.GetError();
 
 	    if (cluster || 1)
 	      besttyp = 1;
@@ -533,9 +808,9 @@ Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
     }
 
 #if defined(TRACK_STATISTICS)
-    gstat.win_partition[mnum][bestpal.GetPartition()]++;
-    gstat.win_rotation [mnum][bestpal.GetRotation ()]++;
-    gstat.win_swap     [mnum][bestpal.GetRotation ()][bestswp]++;
+    gstat.win_partition[mnum][workspace[bestset].GetPartition()]++;
+    gstat.win_rotation [mnum][workspace[bestset].GetRotation ()]++;
+    gstat.win_swap     [mnum][workspace[bestset].GetRotation ()][bestswp]++;
 #endif
   }
 
@@ -553,14 +828,14 @@ Scr4 CompressPaletteBtc7uV1(dtyp const* rgba, int mask, void* block, int flags)
 
   if (!besttyp) {
     // do a range fit (which uses single palette fit if appropriate)
-    PaletteRangeFit fit(&bestpal, flags + bestmde, bestswp, bestbit);
+    PaletteRangeFit fit(&workspace[bestset], flags + bestmde, bestswp, bestbit);
 
     fit.Compress(block, qnt, (bestmde >> 24) - 1);
     fit.Decompress((u8*)rgba, qnt, (bestmde >> 24) - 1);
   }
   else {
     // default to a cluster fit (could be iterative or not)
-    PaletteClusterFit fit(&bestpal, flags + bestmde, bestswp, bestbit);
+    PaletteClusterFit fit(&workspace[bestset], flags + bestmde, bestswp, bestbit);
 
     fit.Compress(block, qnt, (bestmde >> 24) - 1);
     fit.Decompress((u8*)rgba, qnt, (bestmde >> 24) - 1);
@@ -652,8 +927,11 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
     1
   };
 
-  // use the same data-structure all the time
-  PaletteSet bestpal[2];
+  // use the same data-structures all the time: the best sets of both
+  // mode-offsets and the current candidate, the best are never copied
+  // (a set is ~2.2k with SSE, copying it per improvement was ~90MB/512x512)
+  PaletteSet workspace[3];
+  int bestset[2] = {-1,-1};
   Vec4 bestblock[2];
   int bestqnt[2] = {-1,-1};
   int bestmde[2] = {-1,-1};
@@ -666,12 +944,33 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
   error[0] = Scr4(FLT_MAX);
   error[1] = Scr4(FLT_MAX);
 
+  // the error at which the search stops
+  Scr4 target(g_targeterror);
+
   // number of cases to walk through
   int numm = flags &  ( kVariableCodingModes),
         sc = (numm == 0 ? MODECASE_MIN : caseorder[(numm >> 24) - 1].casen),
 	ec = (numm == 0 ? MODECASE_MAX :                                sc);
              flags &= (~kVariableCodingModes);
 
+  // the search-space of the effort level, explicit modes are always searched
+  // single blocks don't get sanitized flags, invalid levels mean no level
+  int effort = flags & (kEffortLevels);
+  if (effort > kEffortLevel9)
+    effort = 0;
+  EffortBudget const budget = GetEffortBudget(effort);
+  int modes = (numm == 0 ? budget.modes : 0xFF);
+  int ranks = (effort ? budget.partitions : g_partitionranking);
+
+  // the effort level decides the fit, also for unsanitized flags of single blocks
+  if (effort)
+    flags = (flags & ~(kColourRangeFit | kColourIterativeClusterFits)) | budget.fit;
+
+  // the number of sets the block needs, explicit modes are always searched
+  int lmts = 3;
+  if ((numm == 0) && (effort ? budget.classify : g_blockclassifier))
+    lmts = ClassifyPaletteBlock(rgba, mask, flags);
+
   // cases: separate (2x), merged alpha (2x), and no alpha (4x)
   for (int mc = sc; mc <= ec; mc++) {
     // offset of the current case
@@ -679,6 +978,7 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
 
     // create the initial point set
     PaletteSet initial(rgba, mask, flags + caseorder[go].mode);
+    PaletteMoments moments(initial);
     
     // if we see we have transparent values, back up from trying to test non-alpha only modes
     // this will affect only successive trials, if an explicit mode is requested it's a NOP
@@ -695,6 +995,16 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
       // offset of the current group's start and end
       int sm = go + (mg * gm);
       int em = sm + (gm - 1);
+
+      // skip groups with none of the modes in the budget
+      int gmodes = 0;
+      for (int m = sm; m <= em; m++)
+	gmodes |= 1 << caseorder[m].mnum;
+      if (!(gmodes & modes))
+	continue;
+      // skip groups with more sets than the block needs
+      if (PaletteFit::GetNumSets(caseorder[sm].mnum) > lmts)
+	continue;
       
       // a mode has a specific number of sets, and variable rotations and partitions
       int numr = PaletteFit::GetRotationBits (caseorder[sm].mnum);
@@ -718,29 +1028,66 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
       // signal if we do we have anything better this iteration of the search
       bool better[2] = {false,false};
 
-      for (int pr = spr; pr <= epr; pr++) {
-	// create the minimal point set
-	PaletteSet palette(initial, mask, flags + caseorder[sm].mode, pr);
+      // rank the partitions by their estimated error, and search only the best ones
+      int ranking[64], numpr = epr - spr + 1;
+      for (int pr = spr; pr <= epr; pr++)
+	ranking[pr - spr] = pr;
+      if (!er && (nump > 0) && ranks && (ranks < numpr))
+	moments.RankPartitions(flags + caseorder[sm].mode, numpr, ranking), numpr = ranks;
+
+      // rank the rotations by their estimated error, and search only the best ones
+      // the separate-alpha set doesn't keep all four channels, a merged one does
+      PaletteRotations rotations;
+      if (er) {
+	PaletteSet merged(rgba, mask, flags + kVariableCodingMode7);
+	PaletteMoments(merged).EstimateRotations(flags + caseorder[sm].mode, sr, er, rotations);
+
+	for (int rp = 0; rp < numpr; rp++)
+	  ranking[rp] = rotations.ranking[rp];
+	numpr = std::min(numpr, budget.rotations);
+      }
+
+      for (int rp = 0; rp < numpr; rp++) {
+	int pr = ranking[rp];
+
+	// create the minimal point set in a workspace not holding any of the best
+	int cur = 0;
+	while ((cur == bestset[0]) || (cur == bestset[1]))
+	  cur++;
+
+	PaletteSet &palette = workspace[cur];
+	palette.Permute(initial, moments, mask, flags + caseorder[sm].mode, pr);
 
 	// do a range fit (which uses single palette fit if appropriate)
 	PaletteTypeFit fit(&palette, flags + caseorder[sm].mode);
 	
 	// exclude mode 1 from the upper partitions
+	int lm = em;
 	if ((em == 7) && (pr >= (1 << 4)))
-	  em = em - 1;
+	  lm = em - 1;
 
-	for (int m = sm; m <= em; m++) {
+	for (int m = sm; m <= lm; m++) {
 	  int mode = caseorder[m].mode;
 	  int mnum = caseorder[m].mnum;
 	  int mofs = (flags & kColourRangeFit ? 0 : m - sm);
 
+	  // skip modes not in the budget
+	  if (!(modes & (1 << mnum)))
+	    continue;
+	  // skip rotations which likely can't beat the best error of the mode anymore
+	  if (er && budget.prune && !(rotations.bound[pr] < error[mofs]))
+	    continue;
+
 	  // a mode has a specific number of sets, and variable rotations and partitions
 	  int numx = PaletteFit::GetSelectionBits(mnum);
 	  int numb = PaletteFit::GetSharedBits   (mnum);
 
 	  // search through index-swaps
 	  int sx =                             0,
-	      ex =               (1 << numx) - 1;
+	      ex = std::min(budget.swaps, 1 << numx) - 1;
+	  // or, if the budget allows just one, the one suggested by the spreads of the rotation
+	  if (er && (numx > 0) && (budget.swaps < 2) && (rotations.selection[pr] >= 0))
+	    sx = ex = rotations.selection[pr];
 	  // search through shared bits
 #ifdef FEATURE_SHAREDBITS_TRIALS
 	  int sb = (numb > 0   ?               0 : SBSKIP),
@@ -757,14 +1104,28 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
 	    sb = eb;
 	  // otherwise just use the most occurring bit (parity) for all other cases
 	  // otherwise just use the most occurring bit (parity) for all non-alpha cases
-	  else if (((FEATURE_SHAREDBITS_TRIALS == SHAREDBITS_TRIAL_ALPHAONLYOPAQUE)) ||
-		   ((FEATURE_SHAREDBITS_TRIALS == SHAREDBITS_TRIAL_ALPHAONLY) && (mode != kVariableCodingMode7) && !initial.IsTransparent()) ||
-		   ((FEATURE_SHAREDBITS_TRIALS == SHAREDBITS_TRIAL_LOWPRC) && (mode < kVariableCodingMode5) && (mode != kVariableCodingMode1)))
+	  else if (((g_sharedbitstrials == SHAREDBITS_TRIAL_ALPHAONLYOPAQUE)) ||
+		   ((g_sharedbitstrials == SHAREDBITS_TRIAL_ALPHAONLY) && (mode != kVariableCodingMode7) && !initial.IsTransparent()) ||
+		   ((g_sharedbitstrials == SHAREDBITS_TRIAL_LOWPRC) && (mode < kVariableCodingMode5) && (mode != kVariableCodingMode1)))
+	    sb = eb = SBSKIP;
+	  // or if the budget doesn't allow trials
+	  else if (!budget.sharedbits)
 	    sb = eb = SBSKIP;
 #endif
 
 	  // TODO: swap & shared are mutual exclusive
 	  fit.ChangeMode(mnum);
+
+#if	defined(FEATURE_SHAREDBITS_TRIALS)
+	  // or predict them from the end-points and try only those
+	  if ((g_sharedbitstrials == SHAREDBITS_TRIAL_PARITY) && (sb != eb))
+	    sb = eb = fit.PredictSharedBits();
+#endif
+
+	  // the prediction is only measured against trials of all the bits
+	  int predictbit = (g_sharedbitsstatistics && (sb != eb) ? fit.PredictSharedBits() : SBSKIP);
+	  int trialbit = SBSKIP;
+
 	  // search for the best swap
 	  for (int x = sx; x <= ex; x++) {
 	    fit.ChangeSwap(x);
@@ -775,11 +1136,13 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
 	      // update with old best error (reset IsBest)
 	      fit.SetError(error[mofs]);
 
-	      // we could code it lossless, no point in trying any further at all
+	      // we could code it lossless (or good enough), no point in trying any further at all
 	      fit.PaletteTypeFit::Compress(block, *caseqnt[m].qnt, mnum);
 	      if (fit.IsBest()) {
-		if (fit.Lossless())
-		  return Scr4(0.0f);
+		if (fit.Sufficient(target))
+		  return fit.GetError();
+
+		trialbit = b;
 
 #if   !defined(TRACK_STATISTICS) && !defined(VERIFY_QUANTIZER)
 		if (PaletteTypeFit::IsClusterable(flags))
@@ -787,7 +1150,7 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
 		{
 		  bestqnt[mofs] = m,
 		  bestmde[mofs] = mode,
-		  bestpal[mofs] = palette,
+		  bestset[mofs] = cur,
 		  bestswp[mofs] = x,
 		  bestbit[mofs] = b,
 		  besttyp[mofs] = 0,
@@ -801,6 +1164,10 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
 	      }
 	    }
 	  }
+
+	  // how often the prediction hits the best of the trials
+	  if ((predictbit != SBSKIP) && (trialbit != SBSKIP))
+	    CountSharedBitsPrediction(predictbit == trialbit);
 	}
 
 #if 0
@@ -841,7 +1208,7 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
 	      int degree = (flags & kColourIterativeClusterFits);
 
 	      // default to a cluster fit (could be iterative or not)
-	      PaletteClusterFit fit(&bestpal[m], flags + mode);
+	      PaletteClusterFit fit(&workspace[bestset[m]], flags + mode);
 
 	      // a mode has a specific number of sets, and variable rotations and partitions
 	      int numx = PaletteFit::GetSelectionBits(mnum);
@@ -849,7 +1216,7 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
 
 	      // search through index-swaps
 	      int sx =                             0,
-		  ex =               (1 << numx) - 1;
+		  ex = std::min(budget.swaps, 1 << numx) - 1;
 	      // search through shared bits
 #ifdef FEATURE_SHAREDBITS_TRIALS
 	      int sb = (numb > 0   ?               0 : SBSKIP),
@@ -862,14 +1229,20 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
 #if	defined(FEATURE_SHAREDBITS_TRIALS)
 	      // if we see we have no transparent values, force all shared bits to 1, or non-opaque codebook-entries occur
 	      // the all transparent case isn't so crucial, when we use IGNORE_ALPHA0 it's redundant to force 0 anyway
-	      if (!bestpal[m].IsTransparent() && bestpal[m].IsMergedAlpha())
+	      if (!workspace[bestset[m]].IsTransparent() && workspace[bestset[m]].IsMergedAlpha())
 		sb = eb;
 	      // otherwise just use the most occurring bit (parity) for all other cases
 	      // otherwise just use the most occurring bit (parity) for all non-alpha cases
-	      else if (((FEATURE_SHAREDBITS_TRIALS == SHAREDBITS_TRIAL_ALPHAONLYOPAQUE)) ||
-			((FEATURE_SHAREDBITS_TRIALS == SHAREDBITS_TRIAL_ALPHAONLY) && (mode != kVariableCodingMode7) && !bestpal[m].IsTransparent()) ||
-			((FEATURE_SHAREDBITS_TRIALS == SHAREDBITS_TRIAL_LOWPRC) && (mode < kVariableCodingMode5) && (mode != kVariableCodingMode1)))
+	      else if (((g_sharedbitstrials == SHAREDBITS_TRIAL_ALPHAONLYOPAQUE)) ||
+			((g_sharedbitstrials == SHAREDBITS_TRIAL_ALPHAONLY) && (mode != kVariableCodingMode7) && !workspace[bestset[m]].IsTransparent()) ||
+			((g_sharedbitstrials == SHAREDBITS_TRIAL_LOWPRC) && (mode < kVariableCodingMode5) && (mode != kVariableCodingMode1)))
+		sb = eb = SBSKIP;
+	      // or if the budget doesn't allow trials
+	      else if (!budget.sharedbits)
 		sb = eb = SBSKIP;
+	      // or keep the predicted ones
+	      else if (g_sharedbitstrials == SHAREDBITS_TRIAL_PARITY)
+		sb = eb = bestbit[m];
 #endif
 
 	      // we want the whole shebang, this takes looong!
@@ -890,11 +1263,11 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
 		  // update with old best error (reset IsBest)
 		  fit.SetError(tobeat);
 
-		  // we could code it lossless, no point in trying any further at all
+		  // we could code it lossless (or good enough), no point in trying any further at all
 		  fit.PaletteClusterFit::Compress(block, *caseqnt[bestqnt[m]].qnt, mnum);
 		  if (fit.IsBest()) {
-		    if (fit.Lossless())
-		      return Scr4(0.0f);
+		    if (fit.Sufficient(target))
+		      return fit.GetError();
 
 		    if (cluster || 1)
 		      besttyp[m] = 1;
@@ -918,12 +1291,12 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
   }
 
 #if defined(TRACK_STATISTICS)
-  gstat.win_partition[(bestmde >> 24) - 1][bestpal.GetPartition()]++;
-  gstat.win_rotation [(bestmde >> 24) - 1][bestpal.GetRotation ()]++;
-  gstat.win_swap     [(bestmde >> 24) - 1][bestpal.GetRotation ()][bestswp]++;
+  gstat.win_partition[(bestmde[0] >> 24) - 1][workspace[bestset[0]].GetPartition()]++;
+  gstat.win_rotation [(bestmde[0] >> 24) - 1][workspace[bestset[0]].GetRotation ()]++;
+  gstat.win_swap     [(bestmde[0] >> 24) - 1][workspace[bestset[0]].GetRotation ()][bestswp[0]]++;
 
-  gstat.win_mode     [(bestmde >> 24) - 1]++;
-  gstat.win_cluster  [(bestmde >> 24) - 1][besttyp]++;
+  gstat.win_mode     [(bestmde[0] >> 24) - 1]++;
+  gstat.win_cluster  [(bestmde[0] >> 24) - 1][besttyp[0]]++;
 #endif
   
 #if defined(VERIFY_ENCODER)
@@ -933,10 +1306,57 @@ Scr4 CompressPaletteBtc7uV2(dtyp const* rgba, int mask, void* block, int flags)
   return error[0];
 }
 
+/* -----------------------------------------------------------------------------
+ * all end-points of the delta-coded modes are coded relative to the first one,
+ * whatever the partition, so the block's range has to fit into the signed
+ * delta-bits at the mode's precision, otherwise the deltas are clamped
+ * one region spans at most one side of that range, two regions can span both
+ * (the first end-point inbetween), the explicit modes can't overflow
+ * slightly clamped deltas often still beat the coarser modes, only modes which
+ * would lose most of the range (more than 4x over) are skipped
+ */
+static int ClassifyHDRBlock(HDRSet const &set)
+{
+  Vec3 const* points = set.GetPoints(0);
+  int count = set.GetCount(0);
+  if (count < 2)
+    return 0x3FFF;
+
+  Vec3 lo = points[0];
+  Vec3 hi = points[0];
+  for (int i = 1; i < count; ++i) {
+    lo = Min(lo, points[i]);
+    hi = Max(hi, points[i]);
+  }
+
+  int usable = 0;
+  for (int mnum = 0; mnum < 14; mnum++) {
+    int tb = HDRFit::GetTruncationBits(mnum);
+    int db = HDRFit::GetDeltaBits(mnum);
+
+    if (db) {
+      fQuantizer qnt(tb, db);
+
+      // the lattice is monotonic, the extremes give the largest delta
+      // (all quantities in units of the mode's precision)
+      Col3 spread = (qnt.QuantizeToLattice(hi) - qnt.QuantizeToLattice(lo)) >> tb;
+      Col3 span = (qnt.griddltp + Col3(1)) * (HDRFit::GetNumSets(mnum) * 4);
+      if ((spread.R() > span.R()) ||
+	  (spread.G() > span.G()) ||
+	  (spread.B() > span.B()))
+	continue;
+    }
+
+    usable |= 1 << mnum;
+  }
+
+  return usable;
+}
+
 template<typename dtyp>
 void CompressColourBtc6u(dtyp const* rgb, int mask, void* block, int flags)
 {
-  static const int modeorder[1][14] = {
+  static const int modeorder[2][14] = {
     {
 #define MODEORDER_EXPL	    0
 #define MODEORDER_EXPL_MIN  0
@@ -956,29 +1376,70 @@ void CompressColourBtc6u(dtyp const* rgb, int mask, void* block, int flags)
       kVariableCodingMode12,//{ 1, 0,   0, { 2, 2, 2}, {9,9,9},  5, 4 },
       kVariableCodingMode13,//{ 1, 0,   0, { 4, 4, 4}, {8,8,8},  4, 4 },
       kVariableCodingMode14,//{ 1, 0,   0, {12,12,12}, {4,4,4},  0, 4 } 
+    },
+    {
+#define MODEORDER_RANK	    1
+      // order: one-region modes first, then two-region, by precision (hi to lo)
+      kVariableCodingMode14,// 16 bits
+      kVariableCodingMode13,// 12 bits
+      kVariableCodingMode12,// 11 bits
+      kVariableCodingMode11,// 10 bits
+      kVariableCodingMode3, // 11 bits
+      kVariableCodingMode4, // 11 bits
+      kVariableCodingMode5, // 11 bits
+      kVariableCodingMode1, // 10 bits
+      kVariableCodingMode6, //  9 bits
+      kVariableCodingMode7, //  8 bits
+      kVariableCodingMode8, //  8 bits
+      kVariableCodingMode9, //  8 bits
+      kVariableCodingMode2, //  7 bits
+      kVariableCodingMode10,//  6 bits
     }
   };
 
+  // number of ranked partitions to search, and pruning of overflowing modes
+  int lmtr = ((flags & kVariableCodingModes) == 0 ? g_hdrpartitionranking : 0);
+  int lmtd = ((flags & kVariableCodingModes) == 0 ? g_hdrmodepruning      : 0);
+
   int numm = flags &  ( kVariableCodingModes),
     sm = (numm == 0 ? MODEORDER_EXPL_MIN : (numm >> 24) - 1),
     em = (numm == 0 ? MODEORDER_EXPL_MAX :               sm),
-    om = (numm == 0 ? MODEORDER_EXPL     :   MODEORDER_EXPL);
+    om = (numm == 0 ? (lmtr | lmtd ? MODEORDER_RANK : MODEORDER_EXPL) : MODEORDER_EXPL);
 	     flags &= (~kVariableCodingModes);
 
 #undef MODEORDER_EXPL
 #undef MODEORDER_EXPL_MIN
 #undef MODEORDER_EXPL_MAX
+#undef MODEORDER_RANK
 
   // limits sets to 2 and choose the partition freely
   int lmts =  2;
   int lmtp = -1;
 
+  // the points are the same for all modes, rank the partitions once
+  int ranking[32];
+  Scr3 bounds[32];
+  int usable = 0x3FFF;
+  if (lmtr | lmtd) {
+    HDRSet base(rgb, mask, flags + kVariableCodingMode11);
+
+    if (lmtr) {
+      HDRMoments moments(base, flags);
+
+      moments.RankPartitions(32, ranking, bounds);
+    }
+
+    if (lmtd)
+      usable = ClassifyHDRBlock(base);
+  }
+
   // use the same data-structure all the time
-  HDRSet bestpal;
+  HDRSet palette;
   int bestmde = -1;
   int besttyp = -1;
 
   Scr3 error(FLT_MAX);
+  Scr3 target(g_targeterror);
 
   for (int m = sm; m <= em; m++) {
     int mode = modeorder[om][m];
@@ -993,10 +1454,24 @@ void CompressColourBtc6u(dtyp const* rgb, int mask, void* block, int flags)
     if (nums > lmts)
       break;
 
+    // skip modes which can't code the block's range
+    if (!(usable & (1 << mnum)))
+      continue;
+
     // lock on the perfect partition
     int sp = (lmtp == -1 ?               0 : lmtp),
 	ep = (lmtp == -1 ? (1 << nump) - 1 : lmtp);
 
+    // search the best ranked partitions only
+    bool ranked = (lmtr != 0) && (nums > 1);
+    if (ranked) {
+      // the two-region modes come last, none of them can improve anymore
+      if (!(error > bounds[ranking[0]]))
+	break;
+
+      sp = 0, ep = std::min(ep, lmtr - 1);
+    }
+
     int tb = HDRFit::GetTruncationBits(mnum);
     int db = HDRFit::GetDeltaBits(mnum);
 
@@ -1008,9 +1483,15 @@ void CompressColourBtc6u(dtyp const* rgb, int mask, void* block, int flags)
     bool better = false;
 
     // search for the best partition
-    for (int p = sp; p <= ep; p++) {
+    for (int r = sp; r <= ep; r++) {
+      int p = (ranked ? ranking[r] : r);
+
+      // the remaining partitions are estimated to be worse than the best
+      if (ranked && !(error > bounds[p]))
+	break;
+
       // create the minimal point set
-      HDRSet palette(initial, mask, flags + mode, p);
+      palette.Permute(initial, mask, flags + mode, p);
 
 #if 0
 			// if we see we have less colors than sets, 
@@ -1027,15 +1508,14 @@ void CompressColourBtc6u(dtyp const* rgb, int mask, void* block, int flags)
       fit.SetError(error);
       fit.Compress(block, qnt, mnum);
 
-      // we could code it lossless, no point in trying any further at all
+      // we could code it lossless (or good enough), no point in trying any further at all
       if (fit.IsBest()) {
-	if (fit.Lossless())
+	if (fit.Sufficient(target))
 	  return;
 
 	error = fit.GetError();
 	if (1)
 	  bestmde = mode,
-	  bestpal = palette,
 	  besttyp = 0,
 	  better  = true;
       }
@@ -1366,6 +1846,13 @@ void CompressMasked(f23 const* rgba, int mask, void* block, int flags)
     CompressMaskedColourBtc6u(rgba, mask, block, flags);
 }
 
+void CompressMasked(f10 const* rgba, int mask, void* block, int flags)
+{
+  // BTC-type compression (half-floats are HDR only)
+  /**/ if ((flags & kBtcp) == (kBtc6))
+    CompressMaskedColourBtc6u(rgba, mask, block, flags);
+}
+
 void Compress(u8 const* rgba, void* block, int flags)
 {
   // compress with full mask
@@ -1384,6 +1871,12 @@ void Compress(f23 const* rgba, void* block, int flags)
   CompressMasked(rgba, -1, block, flags);
 }
 
+void Compress(f10 const* rgba, void* block, int flags)
+{
+  // compress with full mask
+  CompressMasked(rgba, -1, block, flags);
+}
+
 /* *****************************************************************************
  */
 template<typename dtyp>
@@ -1651,6 +2144,13 @@ void Decompress(f23* rgba, void const* block, int flags)
     DecompressColourBtc6u(rgba, block, flags);
 }
 
+void Decompress(f10* rgba, void const* block, int flags)
+{
+  // BTC-type compression (half-floats are HDR only)
+  /**/ if ((flags & kBtcp) == (kBtc6))
+    DecompressColourBtc6u(rgba, block, flags);
+}
+
 /* *****************************************************************************
  */
 int GetStorageRequirements(int width, int height, int flags)
@@ -1884,6 +2384,12 @@ struct sqio GetSquishIO(int width, int height, sqio::dtp datatype, int flags)
       s.encoder = (sqio::enc)CompressMaskedColourBtc6u<f23>,
       s.decoder = (sqio::dec)DecompressColourBtc6u<f23>;
   }
+  else if (datatype == sqio::DT_F10) {
+    // BTC-type compression (half-floats are HDR only)
+    /**/ if ((s.flags & kBtcp) == (kBtc6))
+      s.encoder = (sqio::enc)CompressMaskedColourBtc6u<f10>,
+      s.decoder = (sqio::dec)DecompressColourBtc6u<f10>;
+  }
 
   return s;
 }
@@ -1948,11 +2454,9 @@ void CompressImage(u8 const* rgba, int width, int height, void* blocks, int flag
   }
 }
 
-void DecompressImage(u8* rgba, int width, int height, void const* blocks, int flags)
+template<typename dtyp>
+static void DecompressImageBlocks(dtyp* rgba, int width, int height, void const* blocks, int flags)
 {
-  // fix any bad flags
-  flags = SanitizeFlags(flags);
-
   // initialize the block input
   unsigned char const* sourceBlock = reinterpret_cast< unsigned char const* >(blocks);
   int bytesPerBlock = 16;
@@ -1970,12 +2474,12 @@ void DecompressImage(u8* rgba, int width, int height, void const* blocks, int fl
   for (int y = 0; y < height; y += 4) {
     for (int x = 0; x < width; x += 4) {
       // decompress the block
-      u8 targetRgba[4 * 16];
+      dtyp targetRgba[4 * 16];
 
       Decompress(targetRgba, sourceBlock, flags);
 
       // write the decompressed pixels to the correct image locations
-      u8 const* sourcePixel = targetRgba;
+      dtyp const* sourcePixel = targetRgba;
       for (int py = 0; py < 4; ++py) {
 	for (int px = 0; px < 4; ++px) {
 	  // get the target location
@@ -1983,7 +2487,7 @@ void DecompressImage(u8* rgba, int width, int height, void const* blocks, int fl
 	  int sy = y + py;
 
 	  if (sx < width && sy < height) {
-	    u8* targetPixel = rgba + 4 * (width * sy + sx);
+	    dtyp* targetPixel = rgba + 4 * (width * sy + sx);
 
 	    // copy the rgba value
 	    for (int i = 0; i < 4; ++i)
@@ -2001,6 +2505,101 @@ void DecompressImage(u8* rgba, int width, int height, void const* blocks, int fl
     }
   }
 }
+
+void DecompressImage(u8* rgba, int width, int height, void const* blocks, int flags)
+{
+  // fix any bad flags
+  flags = SanitizeFlags(flags);
+
+  // BTC7 is decoded bucketed by mode
+  if ((flags & kBtcp) == kBtc7) {
+    DecompressImageBtc7u(rgba, width, height, blocks);
+    return;
+  }
+
+  DecompressImageBlocks(rgba, width, height, blocks, flags);
+}
+
+void DecompressImage(u16* rgb, int width, int height, void const* blocks, int flags)
+{
+  // fix any bad flags
+  flags = SanitizeFlags(flags);
+
+  // BTC6 is decoded bucketed by mode
+  if ((flags & kBtcp) == kBtc6) {
+    DecompressImageBtc6u(rgb, width, height, blocks);
+    return;
+  }
+
+  DecompressImageBlocks(rgb, width, height, blocks, flags);
+}
+
+void DecompressImage(f23* rgba, int width, int height, void const* blocks, int flags)
+{
+  // fix any bad flags
+  flags = SanitizeFlags(flags);
+
+  // BTC6 is decoded bucketed by mode
+  if ((flags & kBtcp) == kBtc6) {
+    DecompressImageBtc6u(rgba, width, height, blocks);
+    return;
+  }
+
+  DecompressImageBlocks(rgba, width, height, blocks, flags);
+}
+
+void DecompressImage(f10* rgba, int width, int height, void const* blocks, int flags)
+{
+  // fix any bad flags
+  flags = SanitizeFlags(flags);
+
+  // BTC-type compression (half-floats are HDR only)
+  if ((flags & kBtcp) == kBtc6)
+    DecompressImageBtc6u(rgba, width, height, blocks);
+}
+
+template<typename dtyp>
+static void DecompressImageRGu(dtyp* rg, int width, int height, void const* blocks, int flags)
+{
+  // fix any bad flags
+  flags = SanitizeFlags(flags);
+
+  // only BC4/BC5 are decoded into planes
+  if (((flags & kBtcp) != kBtc4) && ((flags & kBtcp) != kBtc5))
+    return;
+
+  // z is reconstructed from the codebook values, not the decoded x/y
+  if ((flags & (kBtcp | kColourMetrics)) == (kBtc5 | kColourMetricUnit))
+    DecompressImageNormalsBtc5u(rg, width, height, blocks);
+  else
+    DecompressImageBtc45u(rg, width, height, blocks, ((flags & kBtcp) == kBtc4) ? 1 : 2);
+}
+
+template<typename dtyp>
+static void DecompressImageRGs(dtyp* rg, int width, int height, void const* blocks, int flags)
+{
+  // fix any bad flags
+  flags = SanitizeFlags(flags);
+
+  // only BC4/BC5 are decoded into planes
+  if (((flags & kBtcp) != kBtc4) && ((flags & kBtcp) != kBtc5))
+    return;
+
+  // z is reconstructed from the codebook values, not the decoded x/y
+  if ((flags & (kBtcp | kColourMetrics)) == (kBtc5 | kColourMetricUnit))
+    DecompressImageNormalsBtc5s(rg, width, height, blocks);
+  else
+    DecompressImageBtc45s(rg, width, height, blocks, ((flags & kBtcp) == kBtc4) ? 1 : 2);
+}
+
+void DecompressImageRG(u8 * rg, int width, int height, void const* blocks, int flags) {
+  DecompressImageRGu(rg, width, height, blocks, flags); }
+void DecompressImageRG(s8 * rg, int width, int height, void const* blocks, int flags) {
+  DecompressImageRGs(rg, width, height, blocks, flags); }
+void DecompressImageRG(u16* rg, int width, int height, void const* blocks, int flags) {
+  DecompressImageRGu(rg, width, height, blocks, flags); }
+void DecompressImageRG(s16* rg, int width, int height, void const* blocks, int flags) {
+  DecompressImageRGs(rg, width, height, blocks, flags); }
 #endif
 
 /* *****************************************************************************
@@ -75,6 +75,11 @@ enum
 	//! Use some metric (mask)
 	kColourMetrics = ( 7 << 4 ),
 
+	//! Fit both alpha/gray code-books instead of choosing one from the histogram (disabled by default, the choice is exact unless guessing is enabled).
+	kAlphaDualCodebookFit = ( 1 << 8 ),
+	//! Search the 8bit alpha/gray end-points exhaustively around the fit (disabled by default).
+	kAlphaExhaustiveFit = ( 1 << 9 ),
+
 	//! Weight the colour by alpha during cluster fit (disabled by default).
 	kWeightColourByAlpha = ( 1 << 10 ),
 	//! Don't code alpha, set alpha to 255 after weighting (disabled by default).
@@ -113,6 +118,19 @@ enum
 	kColourIterativeClusterFit8 = (  8 << 16 ),
 	kColourIterativeClusterFits = ( 15 << 16 ),
 
+	//! Use to bound the BC7 search to an effort level, coded as "1 + level" (not specified by default).
+	kEffortLevel0 = (  1 << 20 ),
+	kEffortLevel1 = (  2 << 20 ),
+	kEffortLevel2 = (  3 << 20 ),
+	kEffortLevel3 = (  4 << 20 ),
+	kEffortLevel4 = (  5 << 20 ),
+	kEffortLevel5 = (  6 << 20 ),
+	kEffortLevel6 = (  7 << 20 ),
+	kEffortLevel7 = (  8 << 20 ),
+	kEffortLevel8 = (  9 << 20 ),
+	kEffortLevel9 = ( 10 << 20 ),
+	kEffortLevels = ( 15 << 20 ),
+
 	//! Use to code a specific BC6/7 mode, coded as "1 + mode-number" (not specified by default).
 	kVariableCodingMode1  = (  1 << 24 ),
 	kVariableCodingMode2  = (  2 << 24 ),
@@ -163,8 +181,8 @@ typedef signed char s8;
 //! Typedef a quantity that is a single unsigned/signed short.
 typedef unsigned short u16;
 typedef signed short s16;
-//! Typedef a quantity that is a single half floating point.
-//typedef half f10;
+//! Typedef a quantity that is a single half floating point (BC6H only).
+struct f10 { u16 bits; };
 //! Typedef a quantity that is a single signed floating point.
 typedef float f23;
 
@@ -202,6 +220,7 @@ typedef float f23;
 void Compress( u8  const* rgba, void* block, int flags );
 void Compress( u16 const* rgb , void* block, int flags );
 void Compress( f23 const* rgba, void* block, int flags );
+void Compress( f10 const* rgba, void* block, int flags );
 
 // -----------------------------------------------------------------------------
 
@@ -245,6 +264,7 @@ void Compress( f23 const* rgba, void* block, int flags );
 void CompressMasked( u8  const* rgba, int mask, void* block, int flags );
 void CompressMasked( u16 const* rgb , int mask, void* block, int flags );
 void CompressMasked( f23 const* rgba, int mask, void* block, int flags );
+void CompressMasked( f10 const* rgba, int mask, void* block, int flags );
 
 // -----------------------------------------------------------------------------
 
@@ -266,6 +286,7 @@ void CompressMasked( f23 const* rgba, int mask, void* block, int flags );
 void Decompress( u8 * rgba, void const* block, int flags );
 void Decompress( u16* rgb , void const* block, int flags );
 void Decompress( f23* rgba, void const* block, int flags );
+void Decompress( f10* rgba, void const* block, int flags );
 
 // -----------------------------------------------------------------------------
 
@@ -273,7 +294,8 @@ struct sqio {
   enum dtp {
     DT_U8,
     DT_U16,
-    DT_F23
+    DT_F23,
+    DT_F10
   };
 
   int blockcount;
@@ -293,6 +315,186 @@ struct sqio {
 struct sqio GetSquishIO(int width, int height, sqio::dtp datatype, int flags);
 void SetWeights(int flags, const f23* rgba);
 
+/*! @brief Limits the number of BC7 partitions searched exhaustively.
+
+	@param count	The number of partitions fully evaluated per mode.
+
+	The partitions of the 2 and 3 subset modes are ranked by a cheap estimate
+	of their error, and only the best count of them are compressed and compared.
+	A count of 0 (the default) evaluates all of them. Down to 16 the error
+	stays within 0.002 rms of the full search on photographic images. Only
+	the range fits of the skipped partitions are saved, so the time barely
+	changes while the cluster fit of the best one dominates.
+*/
+void SetPartitionRanking(int count);
+
+/*! @brief Selects the implementation of the BC7 8-cluster search.
+
+	@param enable	Use the prefix-sum search instead of the nested loops.
+
+	Both search the same cluster configurations, the prefix-sum search
+	evaluates four of them at once. The sums are rounded differently, so a
+	few blocks can come out slightly different. It is off by default, as it
+	is only faster on some images. Without FEATURE_CLUSTERSEARCH_PREFIXSUMS
+	this does nothing.
+*/
+void SetClusterSearchPrefixSums(bool enable);
+
+/*! @brief Selects the implementation of the BC7 block packer and unpacker.
+
+	@param enable	Use the layout-driven packer/unpacker instead of the
+			hand-written per-mode functions.
+
+	Both produce bit-identical blocks and pixels, the layout-driven one is
+	instantiated at compile time from a bit-layout descriptor per mode.
+	Without FEATURE_PALETTEBLOCK_LAYOUTS this does nothing.
+*/
+void SetPaletteBlockLayouts(bool enable);
+
+/*! @brief Sets the error at which the BC7/BC6H search accepts a block.
+
+	@param mse	The per-block mean squared error in 8 bit units.
+
+	The mode, partition and rotation search stops as soon as a block is
+	coded with at most this error, instead of only when it is lossless. The
+	error is averaged over the 16 texels and weighted by the colour metric,
+	like the fits measure it. For BC6H it is relative to the same normalized
+	range. A value of 0 (the default) stops only on lossless blocks.
+*/
+void SetTargetError(float mse);
+
+/*! @brief Sets the BC7/BC6H target error from a PSNR.
+
+	@param psnr	The PSNR in dB, 0 stops only on lossless blocks.
+
+	Converts the PSNR to the per-block error of SetTargetError(). This is
+	only a per-block early-out: a block stops searching once it reaches the
+	error, blocks which never reach it keep their best (larger) error, so
+	the PSNR of the whole image is not guaranteed and can end up below the
+	target.
+*/
+void SetTargetPSNR(float psnr);
+
+/*! @brief Lets the alpha/gray code-book choice guess.
+
+	@param enable	Guess the 7-code for blocks without min/max present.
+
+	Without kAlphaDualCodebookFit one code-book is chosen from the histogram
+	of the block. By default only the exact choices are made (at most two
+	values, or min/max plus at most two others), all other blocks fit both.
+	The guess skips the 5-code fit of blocks without min/max present, it is
+	a heuristic which loses quality where a narrower 5-code would win.
+*/
+void SetAlphaCodebookGuess(bool enable);
+
+/*! @brief Enables the BC7 block classifier ahead of the mode search.
+
+	@param enable	Search blocks with few colours with fewer subsets.
+
+	Blocks with 1-2 colours, or opaque ones whose colours vary in a single
+	channel or all alike (grey), are searched with the single subset modes
+	only, blocks with 3-4 colours with at most two subsets. Everything else
+	gets the full search. This is a heuristic, the skipped modes can code
+	lines and 3-4 colours better, it trades that quality for speed. The
+	effort levels decide this on their own, this only applies without one.
+*/
+void SetBlockClassifier(bool enable);
+
+/*! @brief Limits the number of BC6H partitions searched exhaustively.
+
+	@param count	The number of partitions fully evaluated per mode.
+
+	The partitions of the two-region modes are ranked once per block by a
+	cheap estimate of their error. The one-region modes are searched first,
+	two-region modes and partitions which can't improve on them are skipped,
+	of the rest only the best count are compressed and compared. A count of
+	0 (the default) evaluates all of them.
+*/
+void SetHDRPartitionRanking(int count);
+
+/*! @brief Enables pruning of the BC6H modes by the block's range.
+
+	@param enable	Skip modes whose end-point deltas would overflow.
+
+	Modes which code the end-points as deltas can only span a limited range
+	at their precision. Those which would have to clamp the deltas to a
+	fraction of the block's range are not searched, and the others are
+	tried from the highest precision down.
+*/
+void SetHDRModePruning(bool enable);
+
+/*! @brief Selects how the BC7 shared/end-point bits (p-bits) are searched.
+
+	@param strategy	One of the SHAREDBITS_TRIAL_* values from config.h.
+
+	The strategies from SHAREDBITS_TRIAL_ALPHAONLYOPAQUE to SHAREDBITS_TRIAL_ALL
+	try the explicit p-bits for increasingly more modes, SHAREDBITS_TRIAL_PARITY
+	predicts them from the parity of the unquantized end-points and tries only
+	the prediction. Other values are ignored, the default is
+	FEATURE_SHAREDBITS_TRIALS.
+*/
+void SetSharedBitsTrials(int strategy);
+
+/*! @brief Selects the solver for the principal axis of the colour fits.
+
+	@param enable	Use the power-method instead of the closed-form solver.
+
+	The closed-form solver finds the roots of the characteristic polynomial
+	of the covariance, it only exists for three channels. The fits over two
+	and four channels always use the power-method. The default is
+	FEATURE_POWERESTIMATE.
+*/
+void SetPowerEstimate(bool enable);
+
+/*! @brief Limits the number of iterations of the power-method.
+
+	@param count	The maximum number of iterations per axis, 1 to 64.
+
+	The iterations stop earlier when the axis doesn't change anymore, the
+	limit only cuts off the slowly converging (near-degenerate) cases. The
+	default is FEATURE_POWERESTIMATE_ITERATIONS.
+*/
+void SetPowerIterations(int count);
+
+/*! @brief Enables the accounting of the principal axis solver.
+
+	@param enable	Count the solves, their iterations and their time.
+
+	The counters are reset on every call. They aren't synchronized, compress
+	from a single thread when they are enabled. Timing every solve costs
+	throughput, it is disabled by default.
+*/
+void SetSolverStatistics(bool enable);
+
+/*! @brief Reads the accounting of the principal axis solver.
+
+	@param solves	Receives the number of principal axes solved.
+	@param iterations	Receives the sum of the power-iterations of them.
+	@param seconds	Receives the time spent in the solver.
+
+	Dividing by the number of solves gives the averages of the compressed
+	image(s) since the last call to SetSolverStatistics().
+*/
+void GetSolverStatistics(long long& solves, long long& iterations, double& seconds);
+
+/*! @brief Enables the accounting of the BC7 p-bit parity prediction.
+
+	@param enable	Compare the predicted p-bits with the tried ones.
+
+	Wherever all the p-bits of a fit are tried, the ones predicted from the
+	parity of the end-points (SHAREDBITS_TRIAL_PARITY) are compared with
+	the ones of the best trial. The counters are reset on every call and
+	aren't synchronized, compress from a single thread when they are enabled.
+*/
+void SetSharedBitsStatistics(bool enable);
+
+/*! @brief Reads the accounting of the BC7 p-bit parity prediction.
+
+	@param predictions	Receives the number of fits compared.
+	@param hits	Receives how many of them predicted the best p-bits.
+*/
+void GetSharedBitsStatistics(long long& predictions, long long& hits);
+
 // -----------------------------------------------------------------------------
 
 /*! @brief Computes the amount of compressed storage required.
@@ -371,11 +573,47 @@ void CompressImage( f23 const* rgba, int width, int height, void* blocks, int fl
 	however, DXT1/BC1 will be used by default if none is specified. All other flags
 	are ignored.
 
-	Internally this function calls squish::Decompress for each block.
+	Internally this function calls squish::Decompress for each block. BC7
+	images are decoded a stripe of blocks at a time instead, the blocks are
+	bucketed by mode first and each bucket is decoded by a loop specialized
+	to its mode. Blocks of the reserved mode decode to transparent black.
+	The same is done for BC6H images, where the pixels are converted to the
+	half-float or float destination while they are written out, and blocks
+	of the reserved modes decode to zeros. BC6H is the only format accepted
+	for half-float destinations.
 */
 void DecompressImage( u8 * rgba, int width, int height, void const* blocks, int flags );
 void DecompressImage( u16* rgb , int width, int height, void const* blocks, int flags );
 void DecompressImage( f23* rgba, int width, int height, void const* blocks, int flags );
+void DecompressImage( f10* rgba, int width, int height, void const* blocks, int flags );
+
+// -----------------------------------------------------------------------------
+
+/*! @brief Decompresses a BC4/BC5 image in memory into R, RG or RGB planes.
+
+	@param rg	Storage for the decompressed pixels.
+	@param width	The width of the source image.
+	@param height	The height of the source image.
+	@param blocks	The compressed BTC4/BTC5 blocks.
+	@param flags	Compression flags.
+
+	The decompressed pixels will be written as a contiguous array of width*height
+	values with 1 (kBtc4), 2 (kBtc5) or 3 (kBtc5 | kColourMetricUnit) components
+	each, without the padding to 4 components DecompressImage produces. In the
+	last case x, y and z are reconstructed from the codebook values exactly as
+	DecompressImage does.
+
+	Unsigned destinations decode unsigned blocks, signed destinations decode
+	signed blocks. Other formats than kBtc4 and kBtc5 aren't decoded and
+	leave the destination untouched. All other flags are ignored.
+
+	Other than DecompressImage this function doesn't call squish::Decompress,
+	the indices of each block are unpacked and looked up in parallel.
+*/
+void DecompressImageRG( u8 * rg, int width, int height, void const* blocks, int flags );
+void DecompressImageRG( s8 * rg, int width, int height, void const* blocks, int flags );
+void DecompressImageRG( u16* rg, int width, int height, void const* blocks, int flags );
+void DecompressImageRG( s16* rg, int width, int height, void const* blocks, int flags );
 #endif
 
 /* *****************************************************************************